@@ -8,6 +8,12 @@ option(PXR_STRICT_BUILD_MODE "Turn on additional warnings. Enforce all warnings
 option(PXR_VALIDATE_GENERATED_CODE "Validate script generated code" OFF)
 option(PXR_HEADLESS_TEST_MODE "Disallow GUI based tests, useful for running under headless CI systems." OFF)
 option(PXR_BUILD_TESTS "Build tests" ON)
+option(PXR_BUILD_PERF_TESTS "Register performance tests (requires PXR_BUILD_TESTS)" ON)
+set(PXR_PERF_TEST_BASELINE_DIR ""
+    CACHE
+    PATH
+    "Directory holding performance test baselines; defaults to perf-baselines in the build directory"
+)
 option(PXR_BUILD_EXAMPLES "Build examples" ON)
 option(PXR_BUILD_TUTORIALS "Build tutorials" ON)
 option(PXR_BUILD_USD_TOOLS "Build commandline tools" ON)
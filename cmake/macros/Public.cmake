@@ -870,6 +870,125 @@ function(pxr_register_test TEST_NAME)
 
 endfunction() # pxr_register_test
 
+# Registers a performance test. Unlike pxr_register_test, the command is run
+# for WARMUP untimed iterations followed by ITERATIONS timed iterations by
+# cmake/macros/perfTestWrapper.py, which aggregates the metrics the command
+# reports via a perfstats.raw file (or its wall clock time if it reports
+# none), stores them as a baseline on the first run, and fails the test when
+# a metric's median regresses by more than FAIL_PERCENT percent over the
+# stored baseline. Baselines live in PXR_PERF_TEST_BASELINE_DIR (defaulting
+# to perf-baselines in the build directory) and can be refreshed by running
+# with the PXR_PERF_UPDATE_BASELINES environment variable set. Perf tests
+# run serially and carry the "perf" ctest label so they can be selected or
+# excluded with ctest -L/-LE.
+function(pxr_register_perf_test TEST_NAME)
+    if (NOT PXR_BUILD_TESTS OR NOT PXR_BUILD_PERF_TESTS)
+        return()
+    endif()
+
+    # If the package for this test does not have a target it must not be
+    # getting built, in which case we can skip building associated tests.
+    if (NOT TARGET ${PXR_PACKAGE})
+        return()
+    endif()
+
+    set(OPTIONS PYTHON REQUIRES_SHARED_LIBS REQUIRES_PYTHON_MODULES)
+    set(ONE_VALUE_ARGS COMMAND ITERATIONS WARMUP FAIL_PERCENT)
+    set(MULTI_VALUE_ARGS ENV PRE_PATH)
+
+    cmake_parse_arguments(bt
+        "${OPTIONS}" "${ONE_VALUE_ARGS}" "${MULTI_VALUE_ARGS}"
+        ${ARGN}
+    )
+
+    # Discard tests that require shared libraries, as pxr_register_test does.
+    if(NOT TARGET shared_libs)
+        if(bt_REQUIRES_SHARED_LIBS)
+            message(STATUS "Skipping test ${TEST_NAME}, shared libraries required")
+            return()
+        endif()
+    endif()
+
+    if(NOT TARGET python)
+        if(bt_PYTHON OR bt_REQUIRES_PYTHON_MODULES)
+            message(STATUS "Skipping test ${TEST_NAME}, Python modules required")
+            return()
+        endif()
+    endif()
+
+    if (NOT bt_ITERATIONS)
+        set(bt_ITERATIONS 5)
+    endif()
+
+    if (NOT bt_WARMUP)
+        set(bt_WARMUP 1)
+    endif()
+
+    if (NOT bt_FAIL_PERCENT)
+        set(bt_FAIL_PERCENT 50)
+    endif()
+
+    if (PXR_PERF_TEST_BASELINE_DIR)
+        set(baselineDir ${PXR_PERF_TEST_BASELINE_DIR})
+    else()
+        set(baselineDir ${PROJECT_BINARY_DIR}/perf-baselines)
+    endif()
+
+    set(perfWrapperCmd
+        ${PROJECT_SOURCE_DIR}/cmake/macros/perfTestWrapper.py
+        --verbose
+        --test-name=${TEST_NAME}
+        --baseline-dir=${baselineDir}
+        --iterations=${bt_ITERATIONS}
+        --warmup=${bt_WARMUP}
+        --fail-percent=${bt_FAIL_PERCENT})
+
+    if (bt_ENV)
+        foreach(env ${bt_ENV})
+            set(perfWrapperCmd ${perfWrapperCmd} --env-var=${env})
+        endforeach()
+    endif()
+
+    if (bt_PRE_PATH)
+        foreach(path ${bt_PRE_PATH})
+            set(perfWrapperCmd ${perfWrapperCmd} --pre-path=${path})
+        endforeach()
+    endif()
+
+    # See pxr_register_test for why the plugin path is needed for static
+    # builds.
+    if (NOT TARGET shared_libs)
+        set(perfWrapperCmd ${perfWrapperCmd} --env-var=${PXR_PLUGINPATH_NAME}=${CMAKE_INSTALL_PREFIX}/lib/usd)
+    endif()
+
+    # Ensure that Python imports the Python files built by this build.
+    set(_testPythonPath "${CMAKE_INSTALL_PREFIX}/lib/python;$ENV{PYTHONPATH}")
+    if(WIN32)
+        string(REGEX REPLACE "\\\\" "/" _testPythonPath "${_testPythonPath}")
+    else()
+        string(REPLACE ";" ":" _testPythonPath "${_testPythonPath}")
+    endif()
+
+    if (bt_PYTHON)
+        set(testCmd "${PYTHON_EXECUTABLE} ${bt_COMMAND}")
+    else()
+        set(testCmd "${bt_COMMAND}")
+    endif()
+
+    add_test(
+        NAME ${TEST_NAME}
+        COMMAND ${PYTHON_EXECUTABLE} ${perfWrapperCmd}
+                "--env-var=PYTHONPATH=${_testPythonPath}" ${testCmd}
+    )
+
+    # Timings from a machine under load are meaningless; never run perf
+    # tests concurrently with other tests.
+    set_tests_properties(${TEST_NAME}
+        PROPERTIES RUN_SERIAL TRUE LABELS "perf"
+    )
+
+endfunction() # pxr_register_perf_test
+
 function(pxr_setup_plugins)
     # Install a top-level plugInfo.json in the shared area and into the 
     # top-level plugin area
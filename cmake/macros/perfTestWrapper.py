@@ -0,0 +1,206 @@
+#
+# Copyright 2025 Pixar
+#
+# Licensed under the terms set forth in the LICENSE.txt file available at
+# https://openusd.org/license.
+#
+#
+# Usage: perfTestWrapper.py <options> <cmd>
+#
+# Wrapper for performance test commands which runs the given command for a
+# number of warmup and timed iterations, aggregates the measured metrics, and
+# compares them against a stored baseline.
+#
+# Commands may report fine grained metrics by writing a perfstats.raw file
+# into the run directory, one line per metric of the form
+#
+#   {'profile':'<name>','metric':'time','value':<nanoseconds>,'samples':1}
+#
+# which is the convention already used by the perf tests in this tree (e.g.
+# testHdSortedIdsPerf, testTraceReportPerf). If a command does not produce a
+# perfstats.raw file, the wall clock time of the whole command is recorded
+# under the metric name 'wallclock' instead.
+#
+# For each metric the median across the timed iterations is compared against
+# the baseline file <baseline-dir>/<test-name>.json. If no baseline exists,
+# or --update-baseline is given (or the PXR_PERF_UPDATE_BASELINES environment
+# variable is set to a non-empty value), the measured medians are written as
+# the new baseline and the test passes. Otherwise the test fails if any
+# metric's median exceeds its baseline by more than --fail-percent percent.
+#
+from __future__ import print_function
+
+import argparse
+import ast
+import json
+import os
+import shlex
+import subprocess
+import sys
+import time
+
+PERFSTATS_FILE = 'perfstats.raw'
+
+
+def _parseArgs():
+    parser = argparse.ArgumentParser(description='USD perf test wrapper')
+    parser.add_argument('--test-name', type=str, required=True,
+            help='Name of the test, used to locate its baseline file')
+    parser.add_argument('--baseline-dir', type=str, required=True,
+            help='Directory holding baseline metric files')
+    parser.add_argument('--iterations', type=int, default=5,
+            help='Number of timed iterations to run')
+    parser.add_argument('--warmup', type=int, default=1,
+            help='Number of untimed warmup iterations to run')
+    parser.add_argument('--fail-percent', type=float, default=50.0,
+            help=('Fail if a metric regresses by more than this percentage '
+                  'over its baseline'))
+    parser.add_argument('--update-baseline', action='store_true',
+            help='Overwrite the baseline with the measured metrics and pass')
+    parser.add_argument('--env-var', dest='envVars', default=[], type=str,
+            action='append',
+            help=('Variable to set in the test environment, in KEY=VALUE '
+                  'form. If "<PXR_TEST_DIR>" is in the value, it is replaced '
+                  'with the absolute path of the temp directory the tests '
+                  'are run in'))
+    parser.add_argument('--pre-path', dest='prePaths', default=[], type=str,
+            action='append', help='Path to prepend to the PATH env var.')
+    parser.add_argument('--verbose', '-v', action='store_true',
+            help='Verbose output')
+    parser.add_argument('cmd', metavar='CMD', type=str, nargs='+',
+            help='Test command to run')
+    return parser.parse_args()
+
+
+def _getTestEnv(args):
+    env = os.environ.copy()
+    for varStr in args.envVars:
+        try:
+            k, v = varStr.split('=', 1)
+        except ValueError:
+            sys.stderr.write(
+                "Error: envvar '{0}' not of the form key=value\n"
+                .format(varStr))
+            sys.exit(1)
+        v = v.replace('<PXR_TEST_DIR>', os.path.abspath(os.getcwd()))
+        env[k] = v
+    if args.prePaths:
+        env['PATH'] = os.pathsep.join(args.prePaths + [env.get('PATH', '')])
+    return env
+
+
+def _readPerfStats():
+    """Returns metric name to value in nanoseconds from perfstats.raw,
+    or None if the file does not exist."""
+    if not os.path.isfile(PERFSTATS_FILE):
+        return None
+    metrics = {}
+    with open(PERFSTATS_FILE, 'r') as f:
+        for line in f:
+            line = line.strip()
+            if not line:
+                continue
+            entry = ast.literal_eval(line)
+            if entry.get('metric') == 'time':
+                metrics[entry['profile']] = float(entry['value'])
+    return metrics
+
+
+def _runIteration(cmd, env, verbose):
+    """Runs the command once and returns its metrics: the contents of
+    perfstats.raw if the command wrote one, the wall clock time of the
+    command otherwise."""
+    if os.path.isfile(PERFSTATS_FILE):
+        os.remove(PERFSTATS_FILE)
+
+    t0 = time.time()
+    retcode = subprocess.call(cmd, shell=False, env=env,
+                              stdout=(None if verbose else subprocess.PIPE),
+                              stderr=subprocess.STDOUT)
+    elapsed = time.time() - t0
+
+    if retcode != 0:
+        sys.stderr.write(
+            "Error: test command failed with return code {0}\n"
+            .format(retcode))
+        sys.exit(retcode)
+
+    metrics = _readPerfStats()
+    if metrics is None:
+        metrics = {'wallclock': elapsed * 1e9}
+    return metrics
+
+
+def _median(values):
+    values = sorted(values)
+    n = len(values)
+    if n % 2:
+        return values[n // 2]
+    return 0.5 * (values[n // 2 - 1] + values[n // 2])
+
+
+def main():
+    args = _parseArgs()
+    env = _getTestEnv(args)
+    cmd = shlex.split(' '.join(args.cmd))
+
+    for i in range(args.warmup):
+        if args.verbose:
+            print("perfTestWrapper: warmup iteration {0} of {1}"
+                  .format(i + 1, args.warmup))
+        _runIteration(cmd, env, args.verbose)
+
+    samples = {}
+    for i in range(max(1, args.iterations)):
+        if args.verbose:
+            print("perfTestWrapper: timed iteration {0} of {1}"
+                  .format(i + 1, max(1, args.iterations)))
+        for metric, value in _runIteration(cmd, env, args.verbose).items():
+            samples.setdefault(metric, []).append(value)
+
+    medians = {metric: _median(values)
+               for metric, values in samples.items()}
+    for metric in sorted(medians):
+        print("perfTestWrapper: {0} : {1:.0f} ns (median of {2})"
+              .format(metric, medians[metric], len(samples[metric])))
+
+    baselineFile = os.path.join(args.baseline_dir, args.test_name + '.json')
+    updateBaseline = (args.update_baseline or
+                      bool(os.environ.get('PXR_PERF_UPDATE_BASELINES')))
+
+    if updateBaseline or not os.path.isfile(baselineFile):
+        if not os.path.isdir(args.baseline_dir):
+            os.makedirs(args.baseline_dir)
+        with open(baselineFile, 'w') as f:
+            json.dump(medians, f, indent=2, sort_keys=True)
+        print("perfTestWrapper: wrote baseline {0}".format(baselineFile))
+        return 0
+
+    with open(baselineFile, 'r') as f:
+        baseline = json.load(f)
+
+    failed = False
+    for metric in sorted(medians):
+        if metric not in baseline:
+            print("perfTestWrapper: {0} has no baseline, skipping"
+                  .format(metric))
+            continue
+        allowed = baseline[metric] * (1.0 + args.fail_percent / 100.0)
+        if medians[metric] > allowed:
+            sys.stderr.write(
+                "Error: metric '{0}' regressed: {1:.0f} ns > {2:.0f} ns "
+                "(baseline {3:.0f} ns + {4:.0f}%)\n"
+                .format(metric, medians[metric], allowed,
+                        baseline[metric], args.fail_percent))
+            failed = True
+
+    if failed:
+        sys.stderr.write(
+            "Re-run with PXR_PERF_UPDATE_BASELINES=1 to accept the "
+            "measured values as the new baseline.\n")
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
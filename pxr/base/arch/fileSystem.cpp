@@ -891,7 +891,8 @@ void ArchMemAdvise(void const *addr, size_t len, ArchMemAdvice adv)
         /* ArchMemAdviceNormal       = */ POSIX_MADV_NORMAL,
         /* ArchMemAdviceWillNeed     = */ POSIX_MADV_WILLNEED,
         /* ArchMemAdviceDontNeed     = */ POSIX_MADV_DONTNEED,
-        /* ArchMemAdviceRandomAccess = */ POSIX_MADV_RANDOM
+        /* ArchMemAdviceRandomAccess = */ POSIX_MADV_RANDOM,
+        /* ArchMemAdviceSequentialAccess = */ POSIX_MADV_SEQUENTIAL
     };
 
     int rval = posix_madvise(reinterpret_cast<void *>(alignedAddrInt),
@@ -1357,7 +1358,8 @@ void ArchFileAdvise(
         /* ArchFileAdviceNormal       = */ POSIX_FADV_NORMAL,
         /* ArchFileAdviceWillNeed     = */ POSIX_FADV_WILLNEED,
         /* ArchFileAdviceDontNeed     = */ POSIX_FADV_DONTNEED,
-        /* ArchFileAdviceRandomAccess = */ POSIX_FADV_RANDOM
+        /* ArchFileAdviceRandomAccess = */ POSIX_FADV_RANDOM,
+        /* ArchFileAdviceSequentialAccess = */ POSIX_FADV_SEQUENTIAL
     };
     int rval = posix_fadvise(fileno(file), offset, static_cast<off_t>(count),
                              adviceMap[adv]);
@@ -349,6 +349,7 @@ enum ArchMemAdvice {
     ArchMemAdviceWillNeed,     // OS may prefetch this range.
     ArchMemAdviceDontNeed,     // OS may free resources related to this range.
     ArchMemAdviceRandomAccess, // Prefetching may not be beneficial.
+    ArchMemAdviceSequentialAccess, // OS may read ahead aggressively.
 };
 
 /// Advise the OS regarding how the application intends to access a range of
@@ -399,6 +400,7 @@ enum ArchFileAdvice {
     ArchFileAdviceWillNeed,     // OS may prefetch this range.
     ArchFileAdviceDontNeed,     // OS may free resources related to this range.
     ArchFileAdviceRandomAccess, // Prefetching may not be beneficial.
+    ArchFileAdviceSequentialAccess, // OS may read ahead aggressively.
 };
 
 /// Advise the OS regarding how the application intends to access a range of
@@ -0,0 +1,570 @@
+//
+// Copyright 2026 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+#include "pxr/pxr.h"
+#include "pxr/base/gf/arrayOps.h"
+#include "pxr/base/gf/bbox3d.h"
+#include "pxr/base/gf/matrix4d.h"
+#include "pxr/base/gf/math.h"
+#include "pxr/base/gf/quatd.h"
+#include "pxr/base/gf/vec3d.h"
+#include "pxr/base/gf/vec3f.h"
+
+#include "pxr/base/arch/defines.h"
+#include "pxr/base/tf/envSetting.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+// Runtime AVX2 dispatch is available with gcc and clang on x86, which
+// support per-function target attributes; on other compilers and
+// architectures the scalar kernels below are used (and are simple enough
+// for the compiler to vectorize against the baseline instruction set).
+#if defined(ARCH_CPU_INTEL) && \
+    (defined(ARCH_COMPILER_GCC) || defined(ARCH_COMPILER_CLANG))
+#define _GF_ARRAY_OPS_X86_DISPATCH 1
+#include <immintrin.h>
+#endif
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+TF_DEFINE_ENV_SETTING(
+    GF_ENABLE_AVX2_ARRAY_OPS, true,
+    "Use AVX2 kernels for the bulk array operations in gf/arrayOps.h "
+    "on processors that support them. Disable to force the scalar "
+    "kernels, e.g. for testing or diagnosing numerical differences.");
+
+namespace {
+
+#if defined(_GF_ARRAY_OPS_X86_DISPATCH)
+
+bool
+_SupportsAVX2()
+{
+    static const bool supported =
+        TfGetEnvSetting(GF_ENABLE_AVX2_ARRAY_OPS) &&
+        __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    return supported;
+}
+
+__attribute__((target("avx2,fma")))
+void
+_TransformPointsAVX2(const GfMatrix4d &matrix,
+                     GfVec3d *points, size_t numPoints)
+{
+    // GfMatrix4d uses row vectors: p' = p[0]*row0 + p[1]*row1 +
+    // p[2]*row2 + row3, ignoring the projection column for affine
+    // transformation.
+    const double *m = matrix.data();
+    const __m256d r0 = _mm256_loadu_pd(m);
+    const __m256d r1 = _mm256_loadu_pd(m + 4);
+    const __m256d r2 = _mm256_loadu_pd(m + 8);
+    const __m256d r3 = _mm256_loadu_pd(m + 12);
+    // Store only the first three lanes of each result.
+    const __m256i mask = _mm256_setr_epi64x(-1, -1, -1, 0);
+
+    double *p = points->data();
+    for (size_t i = 0; i != numPoints; ++i, p += 3) {
+        __m256d acc = r3;
+        acc = _mm256_fmadd_pd(_mm256_set1_pd(p[0]), r0, acc);
+        acc = _mm256_fmadd_pd(_mm256_set1_pd(p[1]), r1, acc);
+        acc = _mm256_fmadd_pd(_mm256_set1_pd(p[2]), r2, acc);
+        _mm256_maskstore_pd(p, mask, acc);
+    }
+}
+
+__attribute__((target("avx2,fma")))
+void
+_TransformPointsAVX2(const GfMatrix4d &matrix,
+                     GfVec3f *points, size_t numPoints)
+{
+    // Compute in double and truncate to float, matching the scalar
+    // GfMatrix4d::TransformAffine(GfVec3f) path.
+    const double *m = matrix.data();
+    const __m256d r0 = _mm256_loadu_pd(m);
+    const __m256d r1 = _mm256_loadu_pd(m + 4);
+    const __m256d r2 = _mm256_loadu_pd(m + 8);
+    const __m256d r3 = _mm256_loadu_pd(m + 12);
+    const __m128i mask = _mm_setr_epi32(-1, -1, -1, 0);
+
+    float *p = points->data();
+    for (size_t i = 0; i != numPoints; ++i, p += 3) {
+        __m256d acc = r3;
+        acc = _mm256_fmadd_pd(_mm256_set1_pd(p[0]), r0, acc);
+        acc = _mm256_fmadd_pd(_mm256_set1_pd(p[1]), r1, acc);
+        acc = _mm256_fmadd_pd(_mm256_set1_pd(p[2]), r2, acc);
+        _mm_maskstore_ps(p, mask, _mm256_cvtpd_ps(acc));
+    }
+}
+
+__attribute__((target("avx2")))
+GfRange3f
+_ComputeExtentAVX2(const GfVec3f *points, size_t numPoints)
+{
+    // Process blocks of eight points (24 floats) with three 8-lane
+    // accumulators.  The component held by each lane rotates between the
+    // accumulators but is fixed for a given lane, so the final reduction
+    // below maps the 24 lanes back to x/y/z.
+    const float *f = points->data();
+    const size_t numBlocks = numPoints / 8;
+
+    GfVec3f min(std::numeric_limits<float>::max());
+    GfVec3f max(std::numeric_limits<float>::lowest());
+
+    if (numBlocks != 0) {
+        __m256 min0 = _mm256_loadu_ps(f);
+        __m256 min1 = _mm256_loadu_ps(f + 8);
+        __m256 min2 = _mm256_loadu_ps(f + 16);
+        __m256 max0 = min0, max1 = min1, max2 = min2;
+        for (size_t b = 1; b != numBlocks; ++b) {
+            const float *blk = f + b * 24;
+            const __m256 v0 = _mm256_loadu_ps(blk);
+            const __m256 v1 = _mm256_loadu_ps(blk + 8);
+            const __m256 v2 = _mm256_loadu_ps(blk + 16);
+            min0 = _mm256_min_ps(min0, v0);
+            min1 = _mm256_min_ps(min1, v1);
+            min2 = _mm256_min_ps(min2, v2);
+            max0 = _mm256_max_ps(max0, v0);
+            max1 = _mm256_max_ps(max1, v1);
+            max2 = _mm256_max_ps(max2, v2);
+        }
+
+        alignas(32) float mins[24], maxs[24];
+        _mm256_store_ps(mins, min0);
+        _mm256_store_ps(mins + 8, min1);
+        _mm256_store_ps(mins + 16, min2);
+        _mm256_store_ps(maxs, max0);
+        _mm256_store_ps(maxs + 8, max1);
+        _mm256_store_ps(maxs + 16, max2);
+        for (int lane = 0; lane != 24; ++lane) {
+            const int c = lane % 3;
+            min[c] = std::min(min[c], mins[lane]);
+            max[c] = std::max(max[c], maxs[lane]);
+        }
+    }
+
+    // Scalar tail.
+    for (size_t i = numBlocks * 8; i != numPoints; ++i) {
+        for (int c = 0; c != 3; ++c) {
+            min[c] = std::min(min[c], points[i][c]);
+            max[c] = std::max(max[c], points[i][c]);
+        }
+    }
+    return GfRange3f(min, max);
+}
+
+__attribute__((target("avx2,fma")))
+void
+_LerpPointsAVX2(float alpha, const GfVec3f *a, const GfVec3f *b,
+                GfVec3f *result, size_t numPoints)
+{
+    // Pure componentwise float math; treat the arrays as flat streams.
+    const float *fa = a->data();
+    const float *fb = b->data();
+    float *fr = result->data();
+    const size_t numFloats = numPoints * 3;
+    const __m256 va = _mm256_set1_ps(alpha);
+    const __m256 one = _mm256_set1_ps(1.0f - alpha);
+
+    size_t i = 0;
+    for (; i + 8 <= numFloats; i += 8) {
+        const __m256 lo = _mm256_mul_ps(one, _mm256_loadu_ps(fa + i));
+        _mm256_storeu_ps(
+            fr + i, _mm256_fmadd_ps(va, _mm256_loadu_ps(fb + i), lo));
+    }
+    for (; i != numFloats; ++i) {
+        fr[i] = (1.0f - alpha) * fa[i] + alpha * fb[i];
+    }
+}
+
+__attribute__((target("avx2")))
+void
+_ComputeAlignedRangesAVX2(const GfBBox3d *boxes, GfRange3d *ranges,
+                          size_t numBoxes)
+{
+    // Arvo's method, as in GfBBox3d::ComputeAlignedRange, with the three
+    // output components computed in parallel lanes.  Lane 3 accumulates
+    // garbage and is dropped when the result is read back.
+    for (size_t n = 0; n != numBoxes; ++n) {
+        const GfRange3d &box = boxes[n].GetRange();
+        if (box.IsEmpty()) {
+            ranges[n] = box;
+            continue;
+        }
+        const double *m = boxes[n].GetMatrix().data();
+        const double *bmin = box.GetMin().data();
+        const double *bmax = box.GetMax().data();
+        __m256d amin = _mm256_loadu_pd(m + 12);
+        __m256d amax = amin;
+        for (int i = 0; i != 3; ++i) {
+            const __m256d row = _mm256_loadu_pd(m + 4 * i);
+            const __m256d a = _mm256_mul_pd(_mm256_set1_pd(bmin[i]), row);
+            const __m256d b = _mm256_mul_pd(_mm256_set1_pd(bmax[i]), row);
+            amin = _mm256_add_pd(amin, _mm256_min_pd(a, b));
+            amax = _mm256_add_pd(amax, _mm256_max_pd(a, b));
+        }
+        alignas(32) double lo[4], hi[4];
+        _mm256_store_pd(lo, amin);
+        _mm256_store_pd(hi, amax);
+        ranges[n].SetMin(GfVec3d(lo[0], lo[1], lo[2]));
+        ranges[n].SetMax(GfVec3d(hi[0], hi[1], hi[2]));
+    }
+}
+
+__attribute__((target("avx2")))
+GfRange3d
+_ComputeUnionAVX2(const GfBBox3d *boxes, size_t numBoxes)
+{
+    // As above, but the per-box aligned ranges accumulate into a running
+    // union instead of being stored.
+    __m256d umin = _mm256_set1_pd(std::numeric_limits<double>::max());
+    __m256d umax = _mm256_set1_pd(std::numeric_limits<double>::lowest());
+    bool any = false;
+    for (size_t n = 0; n != numBoxes; ++n) {
+        const GfRange3d &box = boxes[n].GetRange();
+        if (box.IsEmpty()) {
+            continue;
+        }
+        any = true;
+        const double *m = boxes[n].GetMatrix().data();
+        const double *bmin = box.GetMin().data();
+        const double *bmax = box.GetMax().data();
+        __m256d amin = _mm256_loadu_pd(m + 12);
+        __m256d amax = amin;
+        for (int i = 0; i != 3; ++i) {
+            const __m256d row = _mm256_loadu_pd(m + 4 * i);
+            const __m256d a = _mm256_mul_pd(_mm256_set1_pd(bmin[i]), row);
+            const __m256d b = _mm256_mul_pd(_mm256_set1_pd(bmax[i]), row);
+            amin = _mm256_add_pd(amin, _mm256_min_pd(a, b));
+            amax = _mm256_add_pd(amax, _mm256_max_pd(a, b));
+        }
+        umin = _mm256_min_pd(umin, amin);
+        umax = _mm256_max_pd(umax, amax);
+    }
+    if (!any) {
+        return GfRange3d();
+    }
+    alignas(32) double lo[4], hi[4];
+    _mm256_store_pd(lo, umin);
+    _mm256_store_pd(hi, umax);
+    return GfRange3d(GfVec3d(lo[0], lo[1], lo[2]),
+                     GfVec3d(hi[0], hi[1], hi[2]));
+}
+
+#endif // _GF_ARRAY_OPS_X86_DISPATCH
+
+// ------------------------------------------------------------------------
+// Scalar kernels.  These are kept free of branches and member calls in
+// the inner loop so that optimizing compilers can vectorize them.
+
+template <class Vec>
+void
+_TransformPoints(const GfMatrix4d &matrix, Vec *points, size_t numPoints)
+{
+    for (size_t i = 0; i != numPoints; ++i) {
+        points[i] = matrix.TransformAffine(points[i]);
+    }
+}
+
+template <class Range, class Vec>
+Range
+_ComputeExtent(const Vec *points, size_t numPoints)
+{
+    if (numPoints == 0) {
+        return Range();
+    }
+    Vec min = points[0];
+    Vec max = points[0];
+    for (size_t i = 1; i != numPoints; ++i) {
+        for (int c = 0; c != 3; ++c) {
+            min[c] = std::min(min[c], points[i][c]);
+            max[c] = std::max(max[c], points[i][c]);
+        }
+    }
+    return Range(min, max);
+}
+
+template <class Vec, class Scalar>
+void
+_LerpPoints(Scalar alpha, const Vec *a, const Vec *b, Vec *result,
+            size_t numPoints)
+{
+    const Scalar *fa = a->data();
+    const Scalar *fb = b->data();
+    Scalar *fr = result->data();
+    const size_t numScalars = numPoints * 3;
+    for (size_t i = 0; i != numScalars; ++i) {
+        fr[i] = (Scalar(1) - alpha) * fa[i] + alpha * fb[i];
+    }
+}
+
+template <class Vec, class Scalar>
+void
+_NormalizeVectors(Vec *vectors, size_t numVectors, Scalar eps)
+{
+    for (size_t i = 0; i != numVectors; ++i) {
+        vectors[i].Normalize(eps);
+    }
+}
+
+// Closed-form conversion of an orthonormal row-major 3x3 rotation matrix
+// to a quaternion; the same algorithm as GfMatrix4d::ExtractRotationQuat.
+GfQuatd
+_QuatFromRotationRows(const double rm[3][3])
+{
+    int i;
+    if (rm[0][0] > rm[1][1])
+        i = (rm[0][0] > rm[2][2] ? 0 : 2);
+    else
+        i = (rm[1][1] > rm[2][2] ? 1 : 2);
+
+    GfVec3d im;
+    double r;
+    if (rm[0][0] + rm[1][1] + rm[2][2] > rm[i][i]) {
+        r = 0.5 * sqrt(rm[0][0] + rm[1][1] + rm[2][2] + 1.0);
+        im.Set((rm[1][2] - rm[2][1]) / (4.0 * r),
+               (rm[2][0] - rm[0][2]) / (4.0 * r),
+               (rm[0][1] - rm[1][0]) / (4.0 * r));
+    }
+    else {
+        const int j = (i + 1) % 3;
+        const int k = (i + 2) % 3;
+        const double q = 0.5 * sqrt(rm[i][i] - rm[j][j] - rm[k][k] + 1.0);
+        im[i] = q;
+        im[j] = (rm[i][j] + rm[j][i]) / (4.0 * q);
+        im[k] = (rm[k][i] + rm[i][k]) / (4.0 * q);
+        r     = (rm[j][k] - rm[k][j]) / (4.0 * q);
+    }
+    return GfQuatd(GfClamp(r, -1.0, 1.0), im);
+}
+
+} // anonymous namespace
+
+void
+GfTransformPoints(const GfMatrix4d &matrix, GfVec3f *points,
+                  size_t numPoints)
+{
+    if (numPoints == 0) {
+        return;
+    }
+#if defined(_GF_ARRAY_OPS_X86_DISPATCH)
+    if (_SupportsAVX2()) {
+        _TransformPointsAVX2(matrix, points, numPoints);
+        return;
+    }
+#endif
+    _TransformPoints(matrix, points, numPoints);
+}
+
+void
+GfTransformPoints(const GfMatrix4d &matrix, GfVec3d *points,
+                  size_t numPoints)
+{
+    if (numPoints == 0) {
+        return;
+    }
+#if defined(_GF_ARRAY_OPS_X86_DISPATCH)
+    if (_SupportsAVX2()) {
+        _TransformPointsAVX2(matrix, points, numPoints);
+        return;
+    }
+#endif
+    _TransformPoints(matrix, points, numPoints);
+}
+
+GfRange3f
+GfComputeExtent(const GfVec3f *points, size_t numPoints)
+{
+    if (numPoints == 0) {
+        return GfRange3f();
+    }
+#if defined(_GF_ARRAY_OPS_X86_DISPATCH)
+    if (_SupportsAVX2()) {
+        return _ComputeExtentAVX2(points, numPoints);
+    }
+#endif
+    return _ComputeExtent<GfRange3f>(points, numPoints);
+}
+
+GfRange3d
+GfComputeExtent(const GfVec3d *points, size_t numPoints)
+{
+    return _ComputeExtent<GfRange3d>(points, numPoints);
+}
+
+void
+GfLerpPoints(double alpha, const GfVec3f *a, const GfVec3f *b,
+             GfVec3f *result, size_t numPoints)
+{
+    if (numPoints == 0) {
+        return;
+    }
+#if defined(_GF_ARRAY_OPS_X86_DISPATCH)
+    if (_SupportsAVX2()) {
+        _LerpPointsAVX2(static_cast<float>(alpha), a, b, result, numPoints);
+        return;
+    }
+#endif
+    _LerpPoints(static_cast<float>(alpha), a, b, result, numPoints);
+}
+
+void
+GfLerpPoints(double alpha, const GfVec3d *a, const GfVec3d *b,
+             GfVec3d *result, size_t numPoints)
+{
+    if (numPoints == 0) {
+        return;
+    }
+    _LerpPoints(alpha, a, b, result, numPoints);
+}
+
+void
+GfNormalizeVectors(GfVec3f *vectors, size_t numVectors, float eps)
+{
+    _NormalizeVectors(vectors, numVectors, eps);
+}
+
+void
+GfNormalizeVectors(GfVec3d *vectors, size_t numVectors, double eps)
+{
+    _NormalizeVectors(vectors, numVectors, eps);
+}
+
+void
+GfComposeTransforms(const GfVec3d *scales, const GfQuatd *rotations,
+                    const GfVec3d *translations,
+                    GfMatrix4d *result, size_t numXforms)
+{
+    for (size_t n = 0; n != numXforms; ++n) {
+        const GfVec3d &s = scales[n];
+        const GfVec3d &t = translations[n];
+        const double r = rotations[n].GetReal();
+        const GfVec3d &i = rotations[n].GetImaginary();
+
+        // The upper 3x3 of S * R is the rotation matrix for the unit
+        // quaternion (as in GfMatrix4d::SetRotate) with row k scaled by
+        // s[k]; the last row is the translation.
+        result[n].Set(
+            s[0] * (1.0 - 2.0 * (i[1] * i[1] + i[2] * i[2])),
+            s[0] * (      2.0 * (i[0] * i[1] + i[2] *    r)),
+            s[0] * (      2.0 * (i[2] * i[0] - i[1] *    r)),
+            0.0,
+            s[1] * (      2.0 * (i[0] * i[1] - i[2] *    r)),
+            s[1] * (1.0 - 2.0 * (i[2] * i[2] + i[0] * i[0])),
+            s[1] * (      2.0 * (i[1] * i[2] + i[0] *    r)),
+            0.0,
+            s[2] * (      2.0 * (i[2] * i[0] + i[1] *    r)),
+            s[2] * (      2.0 * (i[1] * i[2] - i[0] *    r)),
+            s[2] * (1.0 - 2.0 * (i[1] * i[1] + i[0] * i[0])),
+            0.0,
+            t[0], t[1], t[2], 1.0);
+    }
+}
+
+void
+GfDecomposeTransforms(const GfMatrix4d *matrices,
+                      GfVec3d *scales, GfQuatd *rotations,
+                      GfVec3d *translations, size_t numXforms,
+                      double eps)
+{
+    for (size_t n = 0; n != numXforms; ++n) {
+        const GfMatrix4d &m = matrices[n];
+
+        translations[n].Set(m[3][0], m[3][1], m[3][2]);
+
+        GfVec3d rows[3] = {
+            GfVec3d(m[0][0], m[0][1], m[0][2]),
+            GfVec3d(m[1][0], m[1][1], m[1][2]),
+            GfVec3d(m[2][0], m[2][1], m[2][2]),
+        };
+
+        // A negative determinant means the matrix includes a reflection;
+        // carry it on the last scale axis so the remaining rows form a
+        // proper rotation.
+        const double det = GfDot(rows[0], GfCross(rows[1], rows[2]));
+
+        GfVec3d &s = scales[n];
+        double rm[3][3];
+        for (int k = 0; k != 3; ++k) {
+            double length = rows[k].GetLength();
+            if (k == 2 && det < 0.0) {
+                length = -length;
+            }
+            if (fabs(length) < eps) {
+                // Degenerate axis: clamp the scale as Factor does and
+                // substitute the canonical axis to keep the rotation
+                // orthonormal.
+                s[k] = length < 0.0 ? -eps : eps;
+                rm[k][0] = rm[k][1] = rm[k][2] = 0.0;
+                rm[k][k] = 1.0;
+            }
+            else {
+                s[k] = length;
+                rm[k][0] = rows[k][0] / length;
+                rm[k][1] = rows[k][1] / length;
+                rm[k][2] = rows[k][2] / length;
+            }
+        }
+
+        rotations[n] = _QuatFromRotationRows(rm);
+    }
+}
+
+void
+GfTransformBBoxes(const GfMatrix4d *matrices, GfBBox3d *boxes,
+                  size_t numBoxes)
+{
+    // The cost here is dominated by the matrix inverse each box maintains,
+    // so there is no dedicated SIMD kernel.
+    for (size_t n = 0; n != numBoxes; ++n) {
+        boxes[n].Transform(matrices[n]);
+    }
+}
+
+void
+GfTransformBBoxes(const GfMatrix4d &matrix, GfBBox3d *boxes,
+                  size_t numBoxes)
+{
+    for (size_t n = 0; n != numBoxes; ++n) {
+        boxes[n].Transform(matrix);
+    }
+}
+
+void
+GfComputeAlignedRanges(const GfBBox3d *boxes, GfRange3d *ranges,
+                       size_t numBoxes)
+{
+    if (numBoxes == 0) {
+        return;
+    }
+#if defined(_GF_ARRAY_OPS_X86_DISPATCH)
+    if (_SupportsAVX2()) {
+        _ComputeAlignedRangesAVX2(boxes, ranges, numBoxes);
+        return;
+    }
+#endif
+    for (size_t n = 0; n != numBoxes; ++n) {
+        ranges[n] = boxes[n].ComputeAlignedRange();
+    }
+}
+
+GfRange3d
+GfComputeUnion(const GfBBox3d *boxes, size_t numBoxes)
+{
+#if defined(_GF_ARRAY_OPS_X86_DISPATCH)
+    if (_SupportsAVX2()) {
+        return _ComputeUnionAVX2(boxes, numBoxes);
+    }
+#endif
+    GfRange3d result;
+    for (size_t n = 0; n != numBoxes; ++n) {
+        result.UnionWith(boxes[n].ComputeAlignedRange());
+    }
+    return result;
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
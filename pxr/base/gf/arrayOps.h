@@ -0,0 +1,141 @@
+//
+// Copyright 2026 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+#ifndef PXR_BASE_GF_ARRAY_OPS_H
+#define PXR_BASE_GF_ARRAY_OPS_H
+
+#include "pxr/pxr.h"
+#include "pxr/base/gf/api.h"
+#include "pxr/base/gf/limits.h"
+#include "pxr/base/gf/range3d.h"
+#include "pxr/base/gf/range3f.h"
+
+#include <cstddef>
+
+/// \file gf/arrayOps.h
+/// Bulk kernels over contiguous arrays of vector types.
+///
+/// These functions operate on contiguous runs of GfVec3f or GfVec3d, such
+/// as the storage behind a VtArray exposed through data() and cdata().
+/// On x86 they dispatch at runtime to AVX2 implementations when the
+/// processor supports them; on other architectures they use scalar loops
+/// written so that compilers targeting baseline SIMD instruction sets
+/// (e.g. NEON on arm64) can vectorize them.  Setting the environment
+/// variable GF_ENABLE_AVX2_ARRAY_OPS to false forces the scalar
+/// implementations everywhere.
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+class GfBBox3d;
+class GfMatrix4d;
+class GfQuatd;
+
+/// Transform every point in \p points in place by \p matrix, treating it
+/// as an affine transformation; equivalent to calling
+/// GfMatrix4d::TransformAffine on each point.
+GF_API
+void GfTransformPoints(const GfMatrix4d &matrix,
+                       GfVec3f *points, size_t numPoints);
+
+/// \overload
+GF_API
+void GfTransformPoints(const GfMatrix4d &matrix,
+                       GfVec3d *points, size_t numPoints);
+
+/// Return the range enclosing every point in \p points, or an empty range
+/// if \p numPoints is zero.
+GF_API
+GfRange3f GfComputeExtent(const GfVec3f *points, size_t numPoints);
+
+/// \overload
+GF_API
+GfRange3d GfComputeExtent(const GfVec3d *points, size_t numPoints);
+
+/// Componentwise linear interpolation of two point arrays: writes
+/// (1-alpha)*a[i] + alpha*b[i] to \p result for each of \p numPoints
+/// points, matching GfLerp.  \p result may alias \p a or \p b.
+GF_API
+void GfLerpPoints(double alpha, const GfVec3f *a, const GfVec3f *b,
+                  GfVec3f *result, size_t numPoints);
+
+/// \overload
+GF_API
+void GfLerpPoints(double alpha, const GfVec3d *a, const GfVec3d *b,
+                  GfVec3d *result, size_t numPoints);
+
+/// Normalize every vector in \p vectors in place, as GfVec3f::Normalize.
+GF_API
+void GfNormalizeVectors(GfVec3f *vectors, size_t numVectors,
+                        float eps = GF_MIN_VECTOR_LENGTH);
+
+/// \overload
+GF_API
+void GfNormalizeVectors(GfVec3d *vectors, size_t numVectors,
+                        double eps = GF_MIN_VECTOR_LENGTH);
+
+/// Compose a transformation matrix from each (scale, rotation,
+/// translation) triple, writing
+/// \code
+/// result[i] = S(scales[i]) * R(rotations[i]) * T(translations[i])
+/// \endcode
+/// to \p result, matching GfMatrix4d::SetScale, SetRotate and
+/// SetTranslate multiplied in that order.  The quaternions in
+/// \p rotations are assumed to be unit length.
+GF_API
+void GfComposeTransforms(const GfVec3d *scales, const GfQuatd *rotations,
+                         const GfVec3d *translations,
+                         GfMatrix4d *result, size_t numXforms);
+
+/// Decompose each affine transformation matrix in \p matrices into scale,
+/// rotation and translation factors such that
+/// \code
+/// matrices[i] = S(scales[i]) * R(rotations[i]) * T(translations[i])
+/// \endcode
+/// holds for matrices composed of those three operations.
+///
+/// Unlike GfMatrix4d::Factor, which runs an iterative Jacobi eigensolve
+/// per matrix, this computes the factors in closed form: the translation
+/// is read off the last row, the scales are the lengths of the upper-3x3
+/// rows (with the sign of the determinant carried on the last axis for
+/// reflections), and the rotation comes from a direct matrix-to-quaternion
+/// conversion.  In exchange, shear and projective components are
+/// discarded rather than reported; matrices containing them are not
+/// reproduced exactly by the composition above.  Scale components smaller
+/// in magnitude than \p eps are clamped to \p eps, as in Factor.
+GF_API
+void GfDecomposeTransforms(const GfMatrix4d *matrices,
+                           GfVec3d *scales, GfQuatd *rotations,
+                           GfVec3d *translations, size_t numXforms,
+                           double eps = 1e-10);
+
+/// Transform each box in \p boxes in place by the corresponding matrix in
+/// \p matrices, as GfBBox3d::Transform.
+GF_API
+void GfTransformBBoxes(const GfMatrix4d *matrices, GfBBox3d *boxes,
+                       size_t numBoxes);
+
+/// \overload transforming every box by the single matrix \p matrix.
+GF_API
+void GfTransformBBoxes(const GfMatrix4d &matrix, GfBBox3d *boxes,
+                       size_t numBoxes);
+
+/// Write the axis-aligned range of each box in \p boxes to \p ranges, as
+/// GfBBox3d::ComputeAlignedRange.
+GF_API
+void GfComputeAlignedRanges(const GfBBox3d *boxes, GfRange3d *ranges,
+                            size_t numBoxes);
+
+/// Return the union of the axis-aligned ranges of all boxes in \p boxes,
+/// or an empty range if \p numBoxes is zero or every box is empty.  This
+/// is the serial leaf of a bounds accumulation; use it as the loop
+/// callback of WorkParallelReduceN (with GfRange3d::GetUnion as the
+/// reduction) to union large spans in parallel.
+GF_API
+GfRange3d GfComputeUnion(const GfBBox3d *boxes, size_t numBoxes);
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // PXR_BASE_GF_ARRAY_OPS_H
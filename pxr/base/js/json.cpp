@@ -10,12 +10,23 @@
 #include "pxr/pxr.h"
 #include "pxr/base/js/json.h"
 
+#include "pxr/base/arch/defines.h"
 #include "pxr/base/tf/diagnostic.h"
 #include "pxr/base/tf/stringUtils.h"
 
 #include <iostream>
 #include <vector>
 
+// Enable rapidjson's SIMD-accelerated whitespace scanning where the target
+// architecture guarantees the instructions are available.  SSE2 is part of
+// the x86-64 baseline and NEON is part of AArch64.  This only affects this
+// translation unit; no other file includes the rapidjson headers.
+#if defined(ARCH_CPU_INTEL) && defined(ARCH_BITS_64)
+#define RAPIDJSON_SSE2
+#elif defined(ARCH_CPU_ARM) && defined(ARCH_BITS_64)
+#define RAPIDJSON_NEON
+#endif
+
 #if PXR_USE_NAMESPACES
 #define PXRJS PXR_NS
 #else
@@ -30,6 +41,7 @@
 #include "rapidjson/allocators.h"
 #include "rapidjson/document.h"
 #include "rapidjson/reader.h"
+#include "rapidjson/istreamwrapper.h"
 #include "rapidjson/ostreamwrapper.h"
 #include "rapidjson/prettywriter.h"
 #include "rapidjson/error/error.h"
@@ -115,6 +127,60 @@ public:
     std::vector<JsObject::mapped_type> values;
 };
 
+// Adapts the rapidjson SAX interface to JsParseHandler, forwarding each
+// event without materializing any values.
+struct _StreamingHandler
+    : public rj::BaseReaderHandler<rj::UTF8<>, _StreamingHandler>
+{
+    explicit _StreamingHandler(JsParseHandler* handler)
+        : _handler(handler) { }
+
+    bool Null() {
+        return _handler->OnNull();
+    }
+    bool Bool(bool b) {
+        return _handler->OnBool(b);
+    }
+    bool Int(int i) {
+        return _handler->OnInt64(i);
+    }
+    bool Uint(unsigned u) {
+        // Match the DOM handler above, which holds unsigned values as
+        // uint64.
+        return _handler->OnUInt64(u);
+    }
+    bool Int64(int64_t i) {
+        return _handler->OnInt64(i);
+    }
+    bool Uint64(uint64_t u) {
+        return _handler->OnUInt64(u);
+    }
+    bool Double(double d) {
+        return _handler->OnReal(d);
+    }
+    bool String(const char* str, rj::SizeType length, bool /* copy */) {
+        return _handler->OnString(str, length);
+    }
+    bool Key(const char* str, rj::SizeType length, bool /* copy */) {
+        return _handler->OnKey(str, length);
+    }
+    bool StartObject() {
+        return _handler->OnBeginObject();
+    }
+    bool EndObject(rj::SizeType memberCount) {
+        return _handler->OnEndObject(memberCount);
+    }
+    bool StartArray() {
+        return _handler->OnBeginArray();
+    }
+    bool EndArray(rj::SizeType elementCount) {
+        return _handler->OnEndArray(elementCount);
+    }
+
+private:
+    JsParseHandler* _handler;
+};
+
 // This class is needed to override writing out doubles. There is a bug in 
 // rapidJSON when writing out some double values. These classes uses the Tf
 // library to do the conversion instead.
@@ -269,6 +335,94 @@ JsParseString(
     return handler.values.empty() ? JsValue() : handler.values.front();
 }
 
+JsParseHandler::~JsParseHandler() = default;
+
+template <class Stream>
+static bool
+_ParseWithHandler(
+    Stream& stream,
+    JsParseHandler* handler,
+    JsParseError* error,
+    const std::string* data)
+{
+    _StreamingHandler streamingHandler(handler);
+    rj::Reader reader;
+    // Need Full precision flag to round trip double values correctly.
+    rj::ParseResult result =
+        reader.Parse<rj::kParseFullPrecisionFlag|rj::kParseStopWhenDoneFlag>(
+            stream, streamingHandler);
+
+    if (!result) {
+        if (error) {
+            const size_t eoff = result.Offset();
+            if (data) {
+                // Convert the character offset to line/column, as in
+                // JsParseString.
+                error->line = 1;
+                size_t nlpos = 0;
+                for (size_t i = 0; i < eoff && i < data->size(); ++i) {
+                    if ((*data)[i] == '\n') {
+                        error->line++;
+                        nlpos = i;
+                    }
+                }
+                error->column = eoff - nlpos;
+            } else {
+                // The input was not retained, so line/column information
+                // is unavailable; report the character offset in the
+                // column field.
+                error->line = 0;
+                error->column = eoff;
+            }
+            error->reason = rj::GetParseError_En(result.Code());
+        }
+        return false;
+    }
+
+    return true;
+}
+
+bool
+JsParseStreamWithHandler(
+    std::istream& istr,
+    JsParseHandler* handler,
+    JsParseError* error)
+{
+    if (!istr) {
+        TF_CODING_ERROR("Stream error");
+        return false;
+    }
+    if (!handler) {
+        TF_CODING_ERROR("Null handler");
+        return false;
+    }
+
+    // Unlike JsParseStream, read directly from the stream rather than
+    // buffering it into a string, so that peak memory use stays
+    // independent of the document size.
+    rj::IStreamWrapper is(istr);
+    return _ParseWithHandler(is, handler, error, nullptr);
+}
+
+bool
+JsParseStringWithHandler(
+    const std::string& data,
+    JsParseHandler* handler,
+    JsParseError* error)
+{
+    if (data.empty()) {
+        TF_CODING_ERROR("JSON string is empty");
+        return false;
+    }
+    if (!handler) {
+        TF_CODING_ERROR("Null handler");
+        return false;
+    }
+
+    rj::StringStream ss(data.c_str());
+    return _ParseWithHandler(ss, handler, error, &data);
+}
+
 void
 JsWriteToStream(
     const JsValue& value,
@@ -15,6 +15,7 @@
 #include "pxr/base/js/api.h"
 #include "pxr/base/js/value.h"
 
+#include <cstdint>
 #include <iosfwd>
 #include <string>
 
@@ -41,6 +42,78 @@ JsValue JsParseStream(std::istream& istr, JsParseError* error = 0);
 JS_API
 JsValue JsParseString(const std::string& data, JsParseError* error = 0);
 
+/// \class JsParseHandler
+///
+/// Interface for clients of the streaming parse entrypoints
+/// JsParseStreamWithHandler() and JsParseStringWithHandler().  The parser
+/// invokes one method per JSON event in document order.  This avoids
+/// constructing a JsValue tree, which can be much more efficient than
+/// JsParseStream if the data size is significant and the caller builds its
+/// own structures (or only needs a subset of the document).
+///
+/// Each method returns a bool; returning false stops the parse, which then
+/// fails with an error indicating client-requested termination.
+///
+class JsParseHandler {
+public:
+    JS_API virtual ~JsParseHandler();
+
+    /// Called when a null value is parsed.
+    virtual bool OnNull() = 0;
+
+    /// Called when a boolean value is parsed.
+    virtual bool OnBool(bool value) = 0;
+
+    /// Called when an integer value that fits in int64_t is parsed.
+    virtual bool OnInt64(int64_t value) = 0;
+
+    /// Called when an unsigned integer value larger than the maximum
+    /// int64_t is parsed.
+    virtual bool OnUInt64(uint64_t value) = 0;
+
+    /// Called when a floating point value is parsed.
+    virtual bool OnReal(double value) = 0;
+
+    /// Called when a string value is parsed.  The characters are only
+    /// valid for the duration of the call.
+    virtual bool OnString(const char* value, size_t length) = 0;
+
+    /// Called when an object member key is parsed.  The characters are
+    /// only valid for the duration of the call.
+    virtual bool OnKey(const char* key, size_t length) = 0;
+
+    /// Called when an object begins.
+    virtual bool OnBeginObject() = 0;
+
+    /// Called when an object ends.  \p memberCount is the number of
+    /// members the object contained.
+    virtual bool OnEndObject(size_t memberCount) = 0;
+
+    /// Called when an array begins.
+    virtual bool OnBeginArray() = 0;
+
+    /// Called when an array ends.  \p elementCount is the number of
+    /// elements the array contained.
+    virtual bool OnEndArray(size_t elementCount) = 0;
+};
+
+/// Parse the contents of input stream \p istr, invoking \p handler for each
+/// JSON event.  The input is consumed incrementally rather than buffered,
+/// so peak memory use is independent of the document size.  Returns true on
+/// success.  On failure, false is returned and \p error is populated if
+/// supplied; since the input is not retained, only the column field is set,
+/// holding the character offset of the error within the stream.
+JS_API
+bool JsParseStreamWithHandler(
+    std::istream& istr, JsParseHandler* handler, JsParseError* error = 0);
+
+/// Parse the contents of the JSON string \p data, invoking \p handler for
+/// each JSON event.  Returns true on success.  On failure, false is
+/// returned and \p error is populated if supplied.
+JS_API
+bool JsParseStringWithHandler(
+    const std::string& data, JsParseHandler* handler, JsParseError* error = 0);
+
 /// Convert the JsValue \p value to JSON and write the result to output stream
 /// \p ostr.
 JS_API
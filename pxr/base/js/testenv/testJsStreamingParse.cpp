@@ -0,0 +1,164 @@
+//
+// Copyright 2026 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+///
+/// \file testenv/testJsStreamingParse.cpp
+
+#include "pxr/pxr.h"
+#include "pxr/base/js/json.h"
+#include "pxr/base/tf/diagnostic.h"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+// A handler that rebuilds a JsValue from the event stream, so the result
+// can be compared against the DOM produced by JsParseString.
+class _TreeBuilder : public JsParseHandler
+{
+public:
+    bool OnNull() override {
+        _values.emplace_back();
+        return true;
+    }
+    bool OnBool(bool value) override {
+        _values.emplace_back(value);
+        return true;
+    }
+    bool OnInt64(int64_t value) override {
+        _values.emplace_back(value);
+        return true;
+    }
+    bool OnUInt64(uint64_t value) override {
+        _values.emplace_back(value);
+        return true;
+    }
+    bool OnReal(double value) override {
+        _values.emplace_back(value);
+        return true;
+    }
+    bool OnString(const char* value, size_t length) override {
+        _values.emplace_back(std::string(value, length));
+        return true;
+    }
+    bool OnKey(const char* key, size_t length) override {
+        _keys.emplace_back(key, length);
+        return true;
+    }
+    bool OnBeginObject() override {
+        return true;
+    }
+    bool OnEndObject(size_t memberCount) override {
+        const size_t kstart = _keys.size() - memberCount;
+        const size_t vstart = _values.size() - memberCount;
+        JsObject object;
+        for (size_t i = 0; i < memberCount; ++i) {
+            object.emplace(std::move(_keys[kstart + i]),
+                           std::move(_values[vstart + i]));
+        }
+        _keys.resize(kstart);
+        _values.resize(vstart);
+        _values.emplace_back(std::move(object));
+        return true;
+    }
+    bool OnBeginArray() override {
+        return true;
+    }
+    bool OnEndArray(size_t elementCount) override {
+        JsArray array(_values.end() - elementCount, _values.end());
+        _values.resize(_values.size() - elementCount);
+        _values.emplace_back(std::move(array));
+        return true;
+    }
+
+    JsValue GetValue() const {
+        TF_AXIOM(_values.size() == 1);
+        return _values.front();
+    }
+
+private:
+    std::vector<std::string> _keys;
+    std::vector<JsValue> _values;
+};
+
+// A handler that stops the parse as soon as it sees a key.
+class _StopAtFirstKey : public _TreeBuilder
+{
+public:
+    bool OnKey(const char*, size_t) override {
+        return false;
+    }
+};
+
+} // anonymous namespace
+
+int main(int argc, char const *argv[])
+{
+    const std::string data =
+        "{\n"
+        "    \"name\": \"streaming\",\n"
+        "    \"count\": 42,\n"
+        "    \"big\": 18446744073709551615,\n"
+        "    \"negative\": -7,\n"
+        "    \"pi\": 3.14159,\n"
+        "    \"enabled\": true,\n"
+        "    \"nothing\": null,\n"
+        "    \"nested\": { \"values\": [ 1, 2.5, \"three\", [], {} ] }\n"
+        "}\n";
+
+    // The event stream must reproduce the same value as the DOM parse.
+    const JsValue expected = JsParseString(data);
+    TF_AXIOM(!expected.IsNull());
+
+    {
+        _TreeBuilder builder;
+        JsParseError error;
+        TF_AXIOM(JsParseStringWithHandler(data, &builder, &error));
+        TF_AXIOM(builder.GetValue() == expected);
+    }
+
+    // Stream parsing must produce the same result as string parsing.
+    {
+        _TreeBuilder builder;
+        std::istringstream istr(data);
+        JsParseError error;
+        TF_AXIOM(JsParseStreamWithHandler(istr, &builder, &error));
+        TF_AXIOM(builder.GetValue() == expected);
+    }
+
+    // Returning false from the handler stops the parse with an error.
+    {
+        _StopAtFirstKey stopper;
+        JsParseError error;
+        TF_AXIOM(!JsParseStringWithHandler(data, &stopper, &error));
+        TF_AXIOM(!error.reason.empty());
+    }
+
+    // Malformed input reports an error with line/column for string input.
+    {
+        _TreeBuilder builder;
+        JsParseError error;
+        TF_AXIOM(!JsParseStringWithHandler("{ \"a\": }", &builder, &error));
+        TF_AXIOM(error.line == 1);
+        TF_AXIOM(!error.reason.empty());
+    }
+
+    // Malformed input reports an offset for stream input.
+    {
+        _TreeBuilder builder;
+        std::istringstream istr("{ \"a\": }");
+        JsParseError error;
+        TF_AXIOM(!JsParseStreamWithHandler(istr, &builder, &error));
+        TF_AXIOM(error.line == 0);
+        TF_AXIOM(!error.reason.empty());
+    }
+
+    return 0;
+}
@@ -0,0 +1,244 @@
+//
+// Copyright 2026 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+#include "pxr/pxr.h"
+#include "pxr/base/plug/infoCache.h"
+
+#include "pxr/base/plug/debugCodes.h"
+
+#include "pxr/base/arch/fileSystem.h"
+#include "pxr/base/js/json.h"
+#include "pxr/base/tf/debug.h"
+#include "pxr/base/tf/fileUtils.h"
+#include "pxr/base/tf/hash.h"
+#include "pxr/base/tf/stringUtils.h"
+
+#include <cstdint>
+#include <fstream>
+#include <type_traits>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+namespace {
+
+constexpr uint32_t _FileMagic = 0x506c6743; // 'PlgC'
+constexpr uint32_t _FileVersion = 1;
+
+template <class T>
+void _Write(std::ostream &out, const T &value)
+{
+    static_assert(std::is_trivially_copyable<T>::value, "");
+    out.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+void _WriteString(std::ostream &out, const std::string &s)
+{
+    _Write<uint64_t>(out, s.size());
+    out.write(s.data(), s.size());
+}
+
+template <class T>
+bool _Read(std::istream &in, T *value)
+{
+    static_assert(std::is_trivially_copyable<T>::value, "");
+    in.read(reinterpret_cast<char *>(value), sizeof(T));
+    return static_cast<bool>(in);
+}
+
+bool _ReadString(std::istream &in, std::string *s)
+{
+    uint64_t size = 0;
+    if (!_Read(in, &size)) {
+        return false;
+    }
+    s->resize(size);
+    in.read(&(*s)[0], size);
+    return static_cast<bool>(in);
+}
+
+} // anonymous namespace
+
+std::string
+Plug_InfoCache::GetCacheFilePath(
+    const std::string& cacheDir,
+    const std::vector<std::string>& pathnames)
+{
+    return TfStringCatPaths(
+        cacheDir,
+        TfStringPrintf("plugInfo-%zx.bin", TfHash()(pathnames)));
+}
+
+bool
+Plug_InfoCache::Read(
+    const std::string& cacheFilePath,
+    const std::vector<std::string>& pathnames,
+    const std::function<bool (const std::string&)>& addVisitedPath,
+    const std::function<void (const Plug_RegistrationMetadata&)>& addPlugin)
+{
+    std::ifstream in(cacheFilePath, std::ios::binary);
+    if (!in) {
+        return false;
+    }
+
+    uint32_t magic = 0, version = 0;
+    if (!_Read(in, &magic) || magic != _FileMagic ||
+        !_Read(in, &version) || version != _FileVersion) {
+        return false;
+    }
+
+    // The cache must have been written for the same ordered search paths;
+    // the hash in the file name is not proof against collisions.
+    uint64_t numPaths = 0;
+    if (!_Read(in, &numPaths) || numPaths != pathnames.size()) {
+        return false;
+    }
+    for (const std::string& pathname : pathnames) {
+        std::string stored;
+        if (!_ReadString(in, &stored) || stored != pathname) {
+            return false;
+        }
+    }
+
+    // Validate that every plugInfo file visited when the cache was
+    // written still exists with the same size and timestamp.
+    uint64_t numVisited = 0;
+    if (!_Read(in, &numVisited)) {
+        return false;
+    }
+    std::vector<std::string> visitedPaths;
+    visitedPaths.reserve(numVisited);
+    for (uint64_t i = 0; i != numVisited; ++i) {
+        std::string path;
+        int64_t length = 0;
+        double mtime = 0.0;
+        if (!_ReadString(in, &path) ||
+            !_Read(in, &length) || !_Read(in, &mtime)) {
+            return false;
+        }
+        double curMtime = 0.0;
+        if (ArchGetFileLength(path.c_str()) != length ||
+            !ArchGetModificationTime(path.c_str(), &curMtime) ||
+            curMtime != mtime) {
+            TF_DEBUG(PLUG_INFO_SEARCH).Msg(
+                "Plugin info cache %s is stale: %s changed\n",
+                cacheFilePath.c_str(), path.c_str());
+            return false;
+        }
+        visitedPaths.push_back(std::move(path));
+    }
+
+    // Read the plugin records before invoking any callbacks so that a
+    // truncated or malformed cache has no side effects.
+    uint64_t numPlugins = 0;
+    if (!_Read(in, &numPlugins)) {
+        return false;
+    }
+    std::vector<Plug_RegistrationMetadata> plugins;
+    plugins.reserve(numPlugins);
+    for (uint64_t i = 0; i != numPlugins; ++i) {
+        Plug_RegistrationMetadata metadata;
+        uint32_t type = 0;
+        std::string plugInfoText;
+        if (!_Read(in, &type) ||
+            !_ReadString(in, &metadata.pluginName) ||
+            !_ReadString(in, &metadata.pluginPath) ||
+            !_ReadString(in, &metadata.libraryPath) ||
+            !_ReadString(in, &metadata.resourcePath) ||
+            !_ReadString(in, &plugInfoText)) {
+            return false;
+        }
+        metadata.type = static_cast<Plug_RegistrationMetadata::Type>(type);
+        if (!plugInfoText.empty()) {
+            JsParseError error;
+            const JsValue plugInfo = JsParseString(plugInfoText, &error);
+            if (!plugInfo.IsObject()) {
+                return false;
+            }
+            metadata.plugInfo = plugInfo.GetJsObject();
+        }
+        plugins.push_back(std::move(metadata));
+    }
+
+    uint32_t trailer = 0;
+    if (!_Read(in, &trailer) || trailer != _FileMagic) {
+        return false;
+    }
+
+    TF_DEBUG(PLUG_INFO_SEARCH).Msg(
+        "Read %zu plugins from plugin info cache %s\n",
+        plugins.size(), cacheFilePath.c_str());
+
+    for (const std::string& path : visitedPaths) {
+        addVisitedPath(path);
+    }
+    for (const Plug_RegistrationMetadata& metadata : plugins) {
+        addPlugin(metadata);
+    }
+    return true;
+}
+
+bool
+Plug_InfoCache::Write(
+    const std::string& cacheFilePath,
+    const std::vector<std::string>& pathnames,
+    const std::vector<std::string>& visitedPaths,
+    const std::vector<Plug_RegistrationMetadata>& plugins)
+{
+    std::ofstream out(cacheFilePath, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        return false;
+    }
+
+    _Write(out, _FileMagic);
+    _Write(out, _FileVersion);
+
+    _Write<uint64_t>(out, pathnames.size());
+    for (const std::string& pathname : pathnames) {
+        _WriteString(out, pathname);
+    }
+
+    _Write<uint64_t>(out, visitedPaths.size());
+    for (const std::string& path : visitedPaths) {
+        const int64_t length = ArchGetFileLength(path.c_str());
+        double mtime = 0.0;
+        if (length < 0 || !ArchGetModificationTime(path.c_str(), &mtime)) {
+            // A visited file we can no longer stat would make the cache
+            // unvalidatable; don't write one.
+            out.close();
+            TfDeleteFile(cacheFilePath);
+            return false;
+        }
+        _WriteString(out, path);
+        _Write(out, length);
+        _Write(out, mtime);
+    }
+
+    _Write<uint64_t>(out, plugins.size());
+    for (const Plug_RegistrationMetadata& metadata : plugins) {
+        _Write<uint32_t>(out, metadata.type);
+        _WriteString(out, metadata.pluginName);
+        _WriteString(out, metadata.pluginPath);
+        _WriteString(out, metadata.libraryPath);
+        _WriteString(out, metadata.resourcePath);
+        _WriteString(out, metadata.plugInfo.empty()
+                     ? std::string()
+                     : JsWriteToString(JsValue(metadata.plugInfo)));
+    }
+
+    _Write(out, _FileMagic);
+    if (!out) {
+        out.close();
+        TfDeleteFile(cacheFilePath);
+        return false;
+    }
+
+    TF_DEBUG(PLUG_INFO_SEARCH).Msg(
+        "Wrote %zu plugins to plugin info cache %s\n",
+        plugins.size(), cacheFilePath.c_str());
+    return true;
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,67 @@
+//
+// Copyright 2026 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+#ifndef PXR_BASE_PLUG_INFO_CACHE_H
+#define PXR_BASE_PLUG_INFO_CACHE_H
+
+#include "pxr/pxr.h"
+#include "pxr/base/plug/info.h"
+
+#include <functional>
+#include <string>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// Single-file binary cache of plugin registration metadata.
+///
+/// Discovering plugins normally walks every plugInfo.json file on the
+/// plugin path and parses it with JsParseStream, which dominates cold
+/// process startup when many plugins are installed.  This cache stores
+/// the discovery result for one ordered set of search paths in a single
+/// file: the plugInfo files that were visited (with their sizes and
+/// timestamps, for validation) and the resulting registration metadata.
+///
+/// A cache file is only used if the search paths match the ones it was
+/// written for and every recorded plugInfo file still exists with the
+/// same size and timestamp; otherwise callers fall back to the normal
+/// discovery walk and rewrite the cache.  Note that validation covers
+/// the files seen when the cache was written, so plugins newly installed
+/// under an already-cached search path require removing the cache file
+/// (or writing to a fresh cache directory) to be discovered.
+class Plug_InfoCache {
+public:
+    /// Returns the cache file path for \p pathnames under \p cacheDir.
+    static std::string GetCacheFilePath(
+        const std::string& cacheDir,
+        const std::vector<std::string>& pathnames);
+
+    /// Reads the cache at \p cacheFilePath, which must have been written
+    /// for \p pathnames.  If the cache is present and valid, invokes
+    /// \p addVisitedPath for each recorded plugInfo path and \p addPlugin
+    /// for each recorded plugin and returns true.  Returns false if the
+    /// cache is missing, stale, or malformed, in which case no callbacks
+    /// are invoked.
+    static bool Read(
+        const std::string& cacheFilePath,
+        const std::vector<std::string>& pathnames,
+        const std::function<bool (const std::string&)>& addVisitedPath,
+        const std::function<void (const Plug_RegistrationMetadata&)>&
+            addPlugin);
+
+    /// Writes a cache for \p pathnames to \p cacheFilePath recording the
+    /// visited plugInfo paths and discovered plugins.  Returns false and
+    /// removes any partial output on failure.
+    static bool Write(
+        const std::string& cacheFilePath,
+        const std::vector<std::string>& pathnames,
+        const std::vector<std::string>& visitedPaths,
+        const std::vector<Plug_RegistrationMetadata>& plugins);
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // PXR_BASE_PLUG_INFO_CACHE_H
@@ -11,6 +11,7 @@
 #include "pxr/base/plug/debugCodes.h"
 #include "pxr/base/plug/notice.h"
 #include "pxr/base/plug/info.h"
+#include "pxr/base/plug/infoCache.h"
 #include "pxr/base/plug/plugin.h"
 
 #include "pxr/base/arch/attributes.h"
@@ -115,24 +116,67 @@ PlugRegistry::_RegisterPlugins(const std::vector<std::string>& pathsToPlugInfo,
     TF_DESCRIBE_SCOPE("Registering plugins");
     TfAutoMallocTag2 tag2("Plug", "PlugRegistry::RegisterPlugins");
 
+    // If PXR_PLUG_INFO_CACHE_DIR is set to a writable directory, try to
+    // satisfy this registration from a previously written discovery cache
+    // instead of walking and parsing plugInfo files, and record enough of
+    // the walk to write the cache when we miss.
+    static const std::string cacheDir = TfGetenv("PXR_PLUG_INFO_CACHE_DIR");
+    const std::string cacheFilePath = cacheDir.empty()
+        ? std::string()
+        : Plug_InfoCache::GetCacheFilePath(cacheDir, pathsToPlugInfo);
+
     typedef tbb::concurrent_vector<PlugPluginPtr> NewPluginsVec;
     NewPluginsVec newPlugins;
     {
         Plug_TaskArena taskArena;
         // XXX -- Is this mutex really needed?
         std::lock_guard<std::mutex> lock(_mutex);
-        WorkWithScopedParallelism([&]() {
+
+        const bool cacheHit =
+            !cacheFilePath.empty() &&
+            Plug_InfoCache::Read(
+                cacheFilePath,
+                pathsToPlugInfo,
+                std::bind(
+                    &PlugRegistry::_InsertRegisteredPluginPath,
+                    this, std::placeholders::_1),
+                std::bind(
+                    &PlugRegistry::_RegisterPlugin<NewPluginsVec>,
+                    this, std::placeholders::_1, &newPlugins));
+
+        if (!cacheHit) {
+            tbb::concurrent_vector<std::string> visitedPaths;
+            tbb::concurrent_vector<Plug_RegistrationMetadata> foundPlugins;
+            WorkWithScopedParallelism([&]() {
                 Plug_ReadPlugInfo(
                     pathsToPlugInfo,
                     pathsAreOrdered,
-                    std::bind(
-                        &PlugRegistry::_InsertRegisteredPluginPath,
-                        this, std::placeholders::_1),
-                    std::bind(
-                        &PlugRegistry::_RegisterPlugin<NewPluginsVec>,
-                        this, std::placeholders::_1, &newPlugins),
+                    [this, &visitedPaths](const std::string& path) {
+                        if (_InsertRegisteredPluginPath(path)) {
+                            visitedPaths.push_back(path);
+                            return true;
+                        }
+                        return false;
+                    },
+                    [this, &newPlugins, &foundPlugins](
+                        const Plug_RegistrationMetadata& metadata) {
+                        foundPlugins.push_back(metadata);
+                        _RegisterPlugin(metadata, &newPlugins);
+                    },
                     &taskArena);
-        }, /*dropPythonGIL=*/false);
+            }, /*dropPythonGIL=*/false);
+
+            if (!cacheFilePath.empty() &&
+                TfMakeDirs(cacheDir, -1, /*existOk=*/true)) {
+                Plug_InfoCache::Write(
+                    cacheFilePath,
+                    pathsToPlugInfo,
+                    std::vector<std::string>(
+                        visitedPaths.begin(), visitedPaths.end()),
+                    std::vector<Plug_RegistrationMetadata>(
+                        foundPlugins.begin(), foundPlugins.end()));
+            }
+        }
         // We explicitly do not drop the GIL here because of sad stories like
         // the following. A shared library loads and during its initialization,
         // it wants to look up information from plugins, and thus invokes this
@@ -13,6 +13,9 @@
 // XXX: Need to isolate symbols here?
 #include "pxrLZ4/lz4.h"
 
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
 #include <algorithm>
 #include <cstring>
 
@@ -20,10 +23,36 @@ PXR_NAMESPACE_OPEN_SCOPE
 
 using namespace pxr_lz4;
 
+namespace {
+
+// Inputs larger than this are split into chunks that are compressed
+// independently and concurrently.  The LZ4 match window is tiny compared to
+// this size, so chunking costs essentially nothing in compression ratio.
+constexpr size_t ChunkSize = 16 * 1024 * 1024;
+
+// The output format stores the chunk count in a single byte, so a compressed
+// buffer holds at most this many chunks.  Positive counts denote
+// independently compressed chunks; negative counts denote chunks chained
+// through a shared dictionary.
+constexpr size_t MaxNumChunks = 127;
+
+// Return the chunk size used when compressing \p inputSize bytes.  Inputs too
+// large to split into MaxNumChunks chunks of ChunkSize bytes get
+// correspondingly larger chunks.
+size_t
+_GetChunkSize(size_t inputSize)
+{
+    size_t numChunks =
+        std::min(MaxNumChunks, (inputSize + ChunkSize - 1) / ChunkSize);
+    return (inputSize + numChunks - 1) / numChunks;
+}
+
+} // anon
+
 size_t
 TfFastCompression::GetMaxInputSize()
 {
-    return 127 * static_cast<size_t>(LZ4_MAX_INPUT_SIZE);
+    return MaxNumChunks * static_cast<size_t>(LZ4_MAX_INPUT_SIZE);
 }
 
 size_t
@@ -31,15 +60,16 @@ TfFastCompression::GetCompressedBufferSize(size_t inputSize)
 {
     if (inputSize > GetMaxInputSize())
         return 0;
-    
+
     // If it fits in one chunk then it's just the compress bound plus 1.
-    if (inputSize <= LZ4_MAX_INPUT_SIZE) {
+    if (inputSize <= ChunkSize) {
         return LZ4_compressBound(inputSize) + 1;
     }
-    size_t nWholeChunks = inputSize / LZ4_MAX_INPUT_SIZE;
-    size_t partChunkSz = inputSize % LZ4_MAX_INPUT_SIZE;
+    size_t chunkSize = _GetChunkSize(inputSize);
+    size_t nWholeChunks = inputSize / chunkSize;
+    size_t partChunkSz = inputSize % chunkSize;
     size_t sz = 1 + nWholeChunks *
-        (LZ4_compressBound(LZ4_MAX_INPUT_SIZE) + sizeof(int32_t));
+        (LZ4_compressBound(chunkSize) + sizeof(int32_t));
     if (partChunkSz)
         sz += LZ4_compressBound(partChunkSz) + sizeof(int32_t);
     return sz;
@@ -55,45 +85,109 @@ TfFastCompression::CompressToBuffer(
                         inputSize, GetMaxInputSize());
         return 0;
     }
-    
+
     // If it fits in one chunk, just do it.
     char const * const origCompressed = compressed;
-    if (inputSize <= LZ4_MAX_INPUT_SIZE) {
+    if (inputSize <= ChunkSize) {
         compressed[0] = 0; // < zero byte means one chunk.
         compressed += 1 + LZ4_compress_default(
             input, compressed + 1, inputSize,
             LZ4_compressBound(inputSize));
-    } else {
-        size_t nWholeChunks = inputSize / LZ4_MAX_INPUT_SIZE;
-        size_t partChunkSz = inputSize % LZ4_MAX_INPUT_SIZE;
-        *compressed++ = nWholeChunks + (partChunkSz ? 1 : 0);
-        auto writeChunk = [](char const *&input, char *&output, size_t size) {
-            char *o = output;
-            output += sizeof(int32_t);
-            int32_t n = LZ4_compress_default(
-                input, output, size, LZ4_compressBound(size));
-            std::memcpy(o, &n, sizeof(n));
-            output += n;
-            input += size;
-        };
-        for (size_t chunk = 0; chunk != nWholeChunks; ++chunk) {
-            writeChunk(input, compressed, LZ4_MAX_INPUT_SIZE);
-        }
-        if (partChunkSz) {
-            writeChunk(input, compressed, partChunkSz);
+        return compressed - origCompressed;
+    }
+
+    // Otherwise compress the chunks concurrently.  Each chunk is compressed
+    // into its own worst-case-sized region of the output buffer, then the
+    // regions are packed together behind their int32 sizes.
+    size_t const chunkSize = _GetChunkSize(inputSize);
+    size_t const partChunkSz = inputSize % chunkSize;
+    size_t const numChunks = inputSize / chunkSize + (partChunkSz ? 1 : 0);
+    size_t const chunkRegionSize =
+        LZ4_compressBound(chunkSize) + sizeof(int32_t);
+
+    *compressed++ = numChunks;
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, numChunks),
+        [&](tbb::blocked_range<size_t> const &range) {
+            for (size_t i = range.begin(); i != range.end(); ++i) {
+                size_t const thisChunkSz =
+                    (i + 1 == numChunks && partChunkSz) ?
+                    partChunkSz : chunkSize;
+                char *out = compressed + i * chunkRegionSize;
+                int32_t n = LZ4_compress_default(
+                    input + i * chunkSize, out + sizeof(int32_t),
+                    thisChunkSz, LZ4_compressBound(thisChunkSz));
+                std::memcpy(out, &n, sizeof(n));
+            }
+        });
+
+    // Pack the chunk regions together.  Chunks move left only, and never past
+    // the previous chunk's region, so a memmove per chunk is safe.
+    char *packed = compressed;
+    for (size_t i = 0; i != numChunks; ++i) {
+        char const *region = compressed + i * chunkRegionSize;
+        int32_t n = 0;
+        std::memcpy(&n, region, sizeof(n));
+        if (packed != region) {
+            std::memmove(packed, region, sizeof(int32_t) + n);
         }
+        packed += sizeof(int32_t) + n;
+    }
+
+    return packed - origCompressed;
+}
+
+size_t
+TfFastCompression::CompressToBufferChained(
+    char const *input, char *compressed, size_t inputSize)
+{
+    if (inputSize > GetMaxInputSize()) {
+        TF_CODING_ERROR("Attempted to compress a buffer of %zu bytes, "
+                        "more than the maximum supported %zu",
+                        inputSize, GetMaxInputSize());
+        return 0;
+    }
+
+    // Single chunks are identical in both formats.
+    if (inputSize <= ChunkSize) {
+        return CompressToBuffer(input, compressed, inputSize);
     }
 
+    // Compress the chunks serially with a streaming compressor so that each
+    // chunk's match window extends into the preceding input.  Since the input
+    // chunks are contiguous, the stream uses the prefix-dictionary fast path.
+    char const * const origCompressed = compressed;
+    size_t const chunkSize = _GetChunkSize(inputSize);
+    size_t const partChunkSz = inputSize % chunkSize;
+    size_t const numChunks = inputSize / chunkSize + (partChunkSz ? 1 : 0);
+
+    *compressed++ = -static_cast<int8_t>(numChunks);
+    LZ4_stream_t *stream = LZ4_createStream();
+    for (size_t i = 0; i != numChunks; ++i) {
+        size_t const thisChunkSz = (i + 1 == numChunks && partChunkSz) ?
+            partChunkSz : chunkSize;
+        int32_t n = LZ4_compress_fast_continue(
+            stream, input + i * chunkSize, compressed + sizeof(int32_t),
+            thisChunkSz, LZ4_compressBound(thisChunkSz), /*acceleration=*/1);
+        std::memcpy(compressed, &n, sizeof(n));
+        compressed += sizeof(int32_t) + n;
+    }
+    LZ4_freeStream(stream);
+
     return compressed - origCompressed;
-}    
+}
 
 size_t
 TfFastCompression::DecompressFromBuffer(
     char const *compressed, char *output,
     size_t compressedSize, size_t maxOutputSize)
 {
-    // Check first byte for # chunks.
-    int nChunks = *compressed++;
+    // Check first byte for # chunks; negative counts denote chained chunks.
+    int nChunks = static_cast<int8_t>(*compressed++);
+    bool const chained = nChunks < 0;
+    if (chained) {
+        nChunks = -nChunks;
+    }
     if (nChunks == 0) {
         // Just one.
         int nDecompressed = LZ4_decompress_safe(
@@ -105,15 +199,22 @@ TfFastCompression::DecompressFromBuffer(
         }
         return nDecompressed;
     } else {
-        // Do each chunk.
+        // Do each chunk.  Chained chunks use the already-decompressed prefix
+        // of the output as their dictionary.
+        char const * const origOutput = output;
         size_t totalDecompressed = 0;
         for (int i = 0; i != nChunks; ++i) {
             int32_t chunkSize = 0;
             std::memcpy(&chunkSize, compressed, sizeof(chunkSize));
             compressed += sizeof(chunkSize);
-            int nDecompressed = LZ4_decompress_safe(
-                compressed, output, chunkSize,
-                std::min<size_t>(LZ4_MAX_INPUT_SIZE, maxOutputSize));
+            int nDecompressed = chained ?
+                LZ4_decompress_safe_usingDict(
+                    compressed, output, chunkSize,
+                    std::min<size_t>(LZ4_MAX_INPUT_SIZE, maxOutputSize),
+                    origOutput, output - origOutput) :
+                LZ4_decompress_safe(
+                    compressed, output, chunkSize,
+                    std::min<size_t>(LZ4_MAX_INPUT_SIZE, maxOutputSize));
             if (nDecompressed < 0) {
                 TF_RUNTIME_ERROR("Failed to decompress data, possibly corrupt? "
                                  "LZ4 error code: %d", nDecompressed);
@@ -36,13 +36,26 @@ public:
     /// \p compressed.  The \p compressed buffer must point to at least
     /// GetCompressedBufferSize(uncompressedSize) bytes.  Return the number of
     /// bytes written to the \p compressed buffer.  Issue a runtime error and
-    /// return ~0 in case of an error.
+    /// return ~0 in case of an error.  Large inputs are split into chunks
+    /// that are compressed concurrently.
     TF_API static size_t
     CompressToBuffer(char const *input, char *compressed, size_t inputSize);
-                           
+
+    /// Like CompressToBuffer(), but compress the chunks of a large input
+    /// serially, each using the preceding input as a shared dictionary.
+    /// This preserves cross-chunk redundancy at the cost of concurrency, so
+    /// it trades compression speed for a better ratio on large repetitive
+    /// inputs.  The result decompresses with DecompressFromBuffer(), but not
+    /// with software that predates this function, so only use this where
+    /// compatibility is negotiated separately.
+    TF_API static size_t
+    CompressToBufferChained(
+        char const *input, char *compressed, size_t inputSize);
+
     /// Decompress \p compressedSize bytes in \p compressed and store the
     /// result in \p output.  No more than \p maxOutputSize bytes will be
-    /// written to \p output.
+    /// written to \p output.  Accepts buffers produced by either
+    /// CompressToBuffer() or CompressToBufferChained().
     TF_API static size_t
     DecompressFromBuffer(char const *compressed, char *output,
                          size_t compressedSize, size_t maxOutputSize);
@@ -0,0 +1,45 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+#ifndef PXR_BASE_TF_FLAT_HASH_MAP_H
+#define PXR_BASE_TF_FLAT_HASH_MAP_H
+
+/// \file tf/flatHashMap.h
+
+#include "pxr/pxr.h"
+#include "pxr/base/tf/hash.h"
+#include "pxr/base/tf/pxrTslRobinMap/robin_map.h"
+
+#include <functional>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// An open-addressing hash map that stores its elements contiguously, with
+/// the same API shape as TfHashMap / std::unordered_map.  Because lookups
+/// probe adjacent slots instead of chasing bucket chains, this is typically
+/// much faster than the node-based tables for hot lookup-dominated maps.
+///
+/// Differences from the node-based tables that callers must account for:
+///
+///   - Elements are stored in the table itself, so insertion and erasure
+///     may invalidate all iterators, references, and pointers to elements,
+///     not just those for the affected key.  Do not use this for maps that
+///     hand out long-lived references to their mapped values.
+///
+///   - Dereferencing an iterator yields a const reference; to mutate the
+///     mapped value through an iterator, use \c it.value() rather than
+///     \c it->second.
+///
+///   - The mapped type must be movable (or copyable), since elements are
+///     relocated on rehash.
+///
+template <class Key, class Mapped, class HashFn = TfHash,
+          class EqualKey = std::equal_to<Key>>
+using TfFlatHashMap = pxr_tsl::robin_map<Key, Mapped, HashFn, EqualKey>;
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // PXR_BASE_TF_FLAT_HASH_MAP_H
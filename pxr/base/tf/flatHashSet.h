@@ -0,0 +1,35 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+#ifndef PXR_BASE_TF_FLAT_HASH_SET_H
+#define PXR_BASE_TF_FLAT_HASH_SET_H
+
+/// \file tf/flatHashSet.h
+
+#include "pxr/pxr.h"
+#include "pxr/base/tf/hash.h"
+#include "pxr/base/tf/pxrTslRobinMap/robin_set.h"
+
+#include <functional>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// An open-addressing hash set that stores its elements contiguously, with
+/// the same API shape as TfHashSet / std::unordered_set.  Because lookups
+/// probe adjacent slots instead of chasing bucket chains, this is typically
+/// much faster than the node-based tables for hot lookup-dominated sets.
+///
+/// As with TfFlatHashMap, insertion and erasure may invalidate all
+/// iterators, references, and pointers to elements, and the element type
+/// must be movable (or copyable), since elements are relocated on rehash.
+///
+template <class Key, class HashFn = TfHash,
+          class EqualKey = std::equal_to<Key>>
+using TfFlatHashSet = pxr_tsl::robin_set<Key, HashFn, EqualKey>;
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // PXR_BASE_TF_FLAT_HASH_SET_H
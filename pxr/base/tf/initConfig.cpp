@@ -24,14 +24,19 @@ ARCH_CONSTRUCTOR(Tf_InitConfig, 2, void)
 {
     std::string capture = TfGetenv("TF_MALLOC_TAG_CAPTURE");
     std::string debug   = TfGetenv("TF_MALLOC_TAG_DEBUG");
-    if (!capture.empty() || !debug.empty() ||
+    int sampleInterval  = TfGetenvInt("TF_MALLOC_TAG_SAMPLE_INTERVAL", 0);
+    if (!capture.empty() || !debug.empty() || sampleInterval > 0 ||
         TfGetenvBool("TF_MALLOC_TAG", false)) {
         std::string errMsg;
 
+        if (sampleInterval > 0) {
+            TfMallocTag::SetSampleInterval(sampleInterval);
+        }
+
         /*
          * Only the most basic error output can be done this early...
          */
-        
+
         if (!TfMallocTag::Initialize(&errMsg)) {
             fprintf(stderr, "%s: TF_MALLOC_TAG environment variable set, but\n"
                     "            malloc tag initialization failed: %s\n",
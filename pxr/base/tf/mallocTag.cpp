@@ -76,6 +76,11 @@ static ArchMallocHook _mallocHook;      // zero-initialized POD
 static Tf_MallocGlobalData* _mallocGlobalData = nullptr;
 std::atomic<bool> TfMallocTag::_isInitialized { false };
 
+// Sampling interval in bytes; zero means track every allocation.  Read with
+// relaxed ordering on every allocation, so keep it in its own variable rather
+// than behind the global data lock.
+static std::atomic<size_t> _sampleIntervalBytes { 0 };
+
 static bool Tf_MatchesMallocTagDebugName(const string& name);
 static bool Tf_MatchesMallocTagTraceName(const string& name);
 static void Tf_MallocTagDebugHook(const void* ptr, size_t size) ARCH_NOINLINE;
@@ -546,7 +551,29 @@ struct TfMallocTag::_ThreadData {
             : _mallocGlobalData->_rootNode;
     }
 
+    // Decide whether an allocation of \p blockSize bytes should be recorded
+    // given a nonzero sampling \p interval.  Each thread counts down bytes of
+    // allocation traffic; when the counter crosses zero the allocation is
+    // recorded and billed one interval per crossing, so billed totals are
+    // unbiased estimates of true totals.  Returns true and sets
+    // \p chargedSize if the allocation should be recorded.
+    inline bool ShouldSample(size_t blockSize, size_t interval,
+                             size_t *chargedSize) {
+        _sampleBytesLeft -= static_cast<ptrdiff_t>(blockSize);
+        if (_sampleBytesLeft >= 0) {
+            return false;
+        }
+        size_t numIntervals = 0;
+        do {
+            _sampleBytesLeft += static_cast<ptrdiff_t>(interval);
+            ++numIntervals;
+        } while (_sampleBytesLeft < 0);
+        *chargedSize = numIntervals * interval;
+        return true;
+    }
+
     _TaggingState _taggingState;
+    ptrdiff_t _sampleBytesLeft = 0;
     std::vector<Tf_MallocPathNode*> _nodeStack;
     pxr_tsl::robin_set<Tf_MallocCallSite *, TfHash> _callSitesOnStack;
 };
@@ -922,6 +949,18 @@ TfMallocTag::SetDebugMatchList(const std::string& matchList)
     }
 }
 
+void
+TfMallocTag::SetSampleInterval(size_t intervalBytes)
+{
+    _sampleIntervalBytes.store(intervalBytes, std::memory_order_relaxed);
+}
+
+size_t
+TfMallocTag::GetSampleInterval()
+{
+    return _sampleIntervalBytes.load(std::memory_order_relaxed);
+}
+
 void
 TfMallocTag::SetCapturedMallocStacksMatchList(const std::string& matchList)
 {
@@ -972,7 +1011,17 @@ TfMallocTag::_MallocWrapper(size_t nBytes, const void*)
 
     Tf_MallocPathNode *node = td.GetCurrentPathNode();
     size_t blockSize = Tf_GetMallocBlockSize(ptr, nBytes);
-    
+
+    // In sampling mode only record a subset of allocations, billing each
+    // recorded block a multiple of the sampling interval.  Unrecorded blocks
+    // are simply absent from _blockInfo; _UnregisterBlock tolerates that.
+    if (size_t interval =
+            _sampleIntervalBytes.load(std::memory_order_relaxed)) {
+        if (!td.ShouldSample(blockSize, interval, &blockSize)) {
+            return ptr;
+        }
+    }
+
     // Take a shared/read lock on the global data mutex.
     TfBigRWMutex::ScopedLock
         lock(_mallocGlobalData->_mutex, /*write=*/false);
@@ -1016,7 +1065,14 @@ TfMallocTag::_ReallocWrapper(void* oldPtr, size_t nBytes, const void*)
 
     Tf_MallocPathNode* newNode = td.GetCurrentPathNode();
     size_t blockSize = Tf_GetMallocBlockSize(newPtr, nBytes);
-    
+
+    if (size_t interval =
+            _sampleIntervalBytes.load(std::memory_order_relaxed)) {
+        if (!td.ShouldSample(blockSize, interval, &blockSize)) {
+            return newPtr;
+        }
+    }
+
     // Update malloc global data with bookkeeping information.
     _mallocGlobalData->_RegisterBlock(newPtr, blockSize, newNode);
     return newPtr;
@@ -1035,6 +1091,13 @@ TfMallocTag::_MemalignWrapper(size_t alignment, size_t nBytes, const void*)
     Tf_MallocPathNode *node = td.GetCurrentPathNode();
     size_t blockSize = Tf_GetMallocBlockSize(ptr, nBytes);
 
+    if (size_t interval =
+            _sampleIntervalBytes.load(std::memory_order_relaxed)) {
+        if (!td.ShouldSample(blockSize, interval, &blockSize)) {
+            return ptr;
+        }
+    }
+
     // Update malloc global data with bookkeeping information.
     TfBigRWMutex::ScopedLock lock(_mallocGlobalData->_mutex, /*write=*/false);
     _mallocGlobalData->_RegisterBlock(ptr, blockSize, node);
@@ -371,6 +371,32 @@ public:
     /// debugging traps.
     TF_API static void SetDebugMatchList(const std::string& matchList);
 
+    /// Set the allocation sampling interval, in bytes.
+    ///
+    /// By default every allocation is tracked, which is accurate but can
+    /// meaningfully slow down allocation-heavy workloads.  When \p
+    /// intervalBytes is nonzero, only allocations at roughly every \p
+    /// intervalBytes bytes of allocation traffic per thread are recorded,
+    /// and each recorded allocation is billed one interval's worth of
+    /// bytes (large blocks may be billed several intervals).  The billed
+    /// totals reported by GetTotalBytes(), GetMaxTotalBytes() and
+    /// GetCallTree() thus become statistical estimates of the true
+    /// values, with overhead bounded by the interval: larger intervals
+    /// are cheaper and noisier.  Intervals on the order of 64K to 1M
+    /// bytes keep the cost low enough to leave tagging always enabled
+    /// while still resolving per-tag usage at the megabyte level.
+    ///
+    /// The interval may be set at any time, but only allocations made
+    /// after the call are sampled; it is most useful set before
+    /// Initialize(), e.g. via the TF_MALLOC_TAG_SAMPLE_INTERVAL
+    /// environment variable.  Pass zero to restore full capture.
+    TF_API static void SetSampleInterval(size_t intervalBytes);
+
+    /// Return the allocation sampling interval in bytes, or zero if every
+    /// allocation is being tracked.
+    /// \sa SetSampleInterval
+    TF_API static size_t GetSampleInterval();
+
     /// Sets the tags to trace.
     ///
     /// When memory is allocated for any tag that matches \p matchList a stack
@@ -255,6 +255,19 @@ public:
             return IsValid();
         }
 
+        /// Declare that the listener registered with this key is
+        /// thread-safe, permitting its callback to be invoked concurrently
+        /// with other thread-safe listeners' callbacks when a notice is
+        /// delivered.  The callback must not rely on being invoked in the
+        /// sending thread and must synchronize any shared state it touches,
+        /// including diagnostics.  Listeners that do not opt in continue to
+        /// be invoked serially in the sending thread.
+        void AllowConcurrentDelivery() const {
+            if (_deliverer) {
+                _deliverer->_AllowConcurrentDelivery();
+            }
+        }
+
     private:
         Key(const _DelivererWeakPtr & d) : _deliverer(d) {}
 
@@ -445,7 +458,8 @@ private:
     class _DelivererBase : public TfWeakBase {
     public:
         _DelivererBase()
-            : _list(0), _active(true), _markedForRemoval(false)
+            : _list(0), _active(true), _markedForRemoval(false),
+              _concurrentAllowed(false)
         {
         }
         
@@ -494,6 +508,16 @@ private:
             return _markedForRemoval;
         }
 
+        void _AllowConcurrentDelivery() {
+            _concurrentAllowed = true;
+        }
+
+        // True if the listener has declared itself thread-safe via
+        // TfNotice::Key::AllowConcurrentDelivery().
+        bool _IsConcurrentDeliveryAllowed() const {
+            return _concurrentAllowed;
+        }
+
         virtual TfType GetNoticeType() const = 0;
         
         virtual bool Delivers(TfType const &noticeType,
@@ -530,7 +554,8 @@ private:
         
         bool _active;
         bool _markedForRemoval;
-        
+        bool _concurrentAllowed;
+
         friend class Tf_NoticeRegistry;
     };
 
@@ -15,6 +15,10 @@
 #include "pxr/base/tf/stringUtils.h"
 #include "pxr/base/arch/demangle.h"
 
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+#include <atomic>
 #include <typeinfo>
 
 using std::string;
@@ -276,28 +280,59 @@ Tf_NoticeRegistry::_Deliver(const TfNotice &n, const TfType &type,
                              const std::type_info &senderType,
                              const std::vector<TfNotice::WeakProbePtr> &probes,
                              const _DelivererListEntry & entry)
-{ 
+{
     _DelivererList *dlist = entry.first;
     if (!dlist)
         return 0;
 
+    auto markDead = [this](_DelivererList::value_type deliverer) {
+        _Lock lock(_userCountMutex);
+        if (!deliverer->_IsMarkedForRemoval()) {
+            deliverer->_Deactivate();
+            deliverer->_MarkForRemoval();
+            _deadEntries.push_back(TfCreateWeakPtr(deliverer));
+        }
+    };
+
+    // Deliverers whose listeners have declared themselves thread-safe are
+    // collected and invoked together after the serial pass.  Probes expect
+    // strictly nested BeginDelivery/EndDelivery calls, so concurrent
+    // delivery is disabled while any probes are installed.
+    vector<_DelivererList::value_type> concurrent;
+
     int nSent = 0;
     _DelivererList::iterator i = entry.second;
     while (i != dlist->end()) {
         _DelivererList::value_type deliverer = *i;
-        if (deliverer->_IsActive() && deliverer->
+        if (deliverer->_IsActive() &&
+            probes.empty() && deliverer->_IsConcurrentDeliveryAllowed()) {
+            concurrent.push_back(deliverer);
+        } else if (deliverer->_IsActive() && deliverer->
             _SendToListener(n, type, s, senderUniqueId, senderType, probes)) {
             ++nSent;
         } else {
-            _Lock lock(_userCountMutex);
-            if (!deliverer->_IsMarkedForRemoval()) {
-                deliverer->_Deactivate();
-                deliverer->_MarkForRemoval();
-                _deadEntries.push_back(TfCreateWeakPtr(deliverer));
-            }
+            markDead(deliverer);
         }
         ++i;
     }
+
+    if (!concurrent.empty()) {
+        std::atomic<int> nSentConcurrently(0);
+        tbb::parallel_for(
+            tbb::blocked_range<size_t>(0, concurrent.size()),
+            [&](tbb::blocked_range<size_t> const &range) {
+                for (size_t j = range.begin(); j != range.end(); ++j) {
+                    if (concurrent[j]->_SendToListener(
+                            n, type, s, senderUniqueId, senderType, probes)) {
+                        ++nSentConcurrently;
+                    } else {
+                        markDead(concurrent[j]);
+                    }
+                }
+            });
+        nSent += nSentConcurrently;
+    }
+
     return nSent;
 }
 
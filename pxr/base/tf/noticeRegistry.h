@@ -19,6 +19,7 @@
 #include "pxr/base/tf/singleton.h"
 #include "pxr/base/tf/type.h"
 
+#include <tbb/concurrent_unordered_map.h>
 #include <tbb/enumerable_thread_specific.h>
 #include <tbb/spin_mutex.h>
 #include <atomic>
@@ -132,7 +133,11 @@ private:
         _DelivererContainer() : _perSenderTable(0) {}
     };
 
-    typedef TfHashMap<TfType, _DelivererContainer*, TfHash> _DelivererTable;
+    // The deliverer table is read-mostly: containers are created the first
+    // time a listener registers for a notice type and are never removed, so
+    // senders can look them up concurrently without locking.
+    typedef tbb::concurrent_unordered_map<TfType, _DelivererContainer*, TfHash>
+        _DelivererTable;
 
     typedef TfHashSet<TfNotice::WeakProbePtr, TfHash> _ProbeTable;
 
@@ -175,19 +180,23 @@ private:
     }
 
     _DelivererContainer* _GetDelivererContainer(const TfType& t) {
-        _Lock lock(_tableMutex);
         _DelivererTable::iterator i = _delivererTable.find(t);
         return (i == _delivererTable.end()) ? NULL : i->second;
     }
-    
+
     _DelivererContainer* _GetOrCreateDelivererContainer(const TfType& t) {
-        _Lock lock(_tableMutex);    
         _DelivererTable::iterator i = _delivererTable.find(t);
-
-        if (i == _delivererTable.end())
-            return (_delivererTable[t] = new _DelivererContainer);
-        else
+        if (i != _delivererTable.end()) {
             return i->second;
+        }
+        // Try to insert a new container; if another thread beat us to it,
+        // discard ours and use the winner's.
+        _DelivererContainer *container = new _DelivererContainer;
+        auto result = _delivererTable.insert({t, container});
+        if (!result.second) {
+            delete container;
+        }
+        return result.first->second;
     }
 
     int _Deliver(const TfNotice &n, const TfType &type,
@@ -204,7 +213,6 @@ private:
     }
 
     _DelivererTable _delivererTable;
-    _Mutex _tableMutex;
 
     // The user count and mutex track the number of callers into the registry
     // to determine when it is safe to remove entries from deliverer lists;
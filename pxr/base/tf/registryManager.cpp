@@ -202,7 +202,10 @@ public:
     /// Subscribe to a type.  This causes all of the registration functions
     /// for the type to be run if they haven't run already and causes any
     /// registration functions added later for that type to run during
-    /// library load.
+    /// library load.  If deferred registration is enabled then functions
+    /// added later are only indexed at library load; a repeated call to
+    /// this method for an already subscribed type runs any functions
+    /// indexed since the last call.
     void SubscribeTo(const string& typeName);
 
     /// Unsubscribe from a type.  Any registration functions added later
@@ -255,6 +258,10 @@ private:
     // Misc state.
     std::recursive_mutex _mutex;
 
+    // If true, loading a library only indexes its registration functions;
+    // they run on the next subscription demand rather than during load.
+    bool _deferRegistrationFunctions;
+
     // Subscription state.
     _LibraryNameMap _libraryNameMap;
     set<TypeName> _subscriptions;
@@ -275,6 +282,9 @@ private:
 bool Tf_RegistryManagerImpl::runUnloadersAtExit = false;
 
 Tf_RegistryManagerImpl::Tf_RegistryManagerImpl()
+    // Not a TfEnvSetting because those are loaded by a registry function.
+    : _deferRegistrationFunctions(
+        TfGetenvBool("TF_DEFER_REGISTRY_FUNCTIONS", false))
 {
     // Call SetInstanceConstructed since TfDebug will end up calling back here.
     TfSingleton<Tf_RegistryManagerImpl>::SetInstanceConstructed(*this);
@@ -385,6 +395,12 @@ Tf_RegistryManagerImpl::SubscribeTo(const string& typeName)
         _orderedSubscriptions.push_back(typeName);
         _RunRegistrationFunctionsNoLock(typeName);
     }
+    else if (_deferRegistrationFunctions) {
+        // A repeated subscription is the demand signal in deferred mode:
+        // run any functions indexed by libraries loaded since the last
+        // call.  This is cheap (a single map lookup) when there are none.
+        _RunRegistrationFunctionsNoLock(typeName);
+    }
 }
 
 void
@@ -413,8 +429,17 @@ Tf_RegistryManagerImpl::_ProcessLibraryNoLock()
     if (_active.local().identifier) {
         // Going inactive.  Move active library state over to global state.
         if (_TransferActiveLibraryNoLock()) {
-            // Run subscriptions.
-            _UpdateSubscribersNoLock();
+            if (_deferRegistrationFunctions) {
+                // Leave the functions indexed; they run when the
+                // subscribing facility next demands them.
+                TF_DEBUG(TF_DISCOVERY_TERSE).
+                    Msg("TfRegistryManager: "
+                        "deferring registration functions\n");
+            }
+            else {
+                // Run subscriptions.
+                _UpdateSubscribersNoLock();
+            }
         }
     }
 }
@@ -47,6 +47,14 @@ public:
     /// this call is made, when new code is dynamically loaded then any
     /// \c TF_REGISTRY_FUNCTION() functions of type \c T in the new code
     /// will automatically be run when the code is loaded.
+    ///
+    /// If the environment variable \c TF_DEFER_REGISTRY_FUNCTIONS is set,
+    /// dynamically loaded code only indexes its functions instead of
+    /// running them at load time.  A facility opting into this mode must
+    /// call \c SubscribeTo<T>() again whenever it requires a complete
+    /// registry; the repeated call runs any functions indexed since the
+    /// last call and is cheap when there are none.  This keeps registry
+    /// work off the library load path for types that are never demanded.
     template <class T>
     void SubscribeTo() {
         _SubscribeTo(typeid(T));
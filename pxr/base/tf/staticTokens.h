@@ -84,7 +84,7 @@ PXR_NAMESPACE_OPEN_SCOPE
 /// TF_DECLARE_PUBLIC_TOKENS.
 /// \hideinitializer
 #define TF_DEFINE_PUBLIC_TOKENS(key, seq)                                   \
-    _TF_DEFINE_TOKENS(key)                                                  \
+    _TF_DEFINE_TOKENS(key, seq)                                             \
     TfStaticData<_TF_TOKENS_STRUCT_NAME(key)> key
 
 /// Macro to define private tokens.
@@ -92,7 +92,8 @@ PXR_NAMESPACE_OPEN_SCOPE
 #define TF_DEFINE_PRIVATE_TOKENS(key, seq)                                  \
     namespace {                                                             \
     struct _TF_TOKENS_STRUCT_NAME_PRIVATE(key) {                            \
-        _TF_TOKENS_STRUCT_NAME_PRIVATE(key)() = default;                    \
+        _TF_TOKENS_STRUCT_NAME_PRIVATE(key)()                               \
+        _TF_TOKENS_DEFINE_CTOR_BODY(seq)                                    \
         _TF_TOKENS_DECLARE_MEMBERS(seq)                                     \
     };                                                                      \
     }                                                                       \
@@ -119,21 +120,48 @@ PXR_NAMESPACE_OPEN_SCOPE
 // Declaration Macros
 
 // Private macro used to generate TfToken member variables.  elem can either
-// be a tuple on the form (name, value) or just a name.
+// be a tuple on the form (name, value) or just a name.  The members are
+// default constructed and populated by the generated constructor (see
+// _TF_TOKENS_DEFINE_CTOR_BODY), which interns all of the strings in one
+// bulk pass.
 //
 #define _TF_TOKENS_DECLARE_MEMBER(unused, elem)                             \
     TfToken _TF_PP_IFF(TF_PP_IS_TUPLE(elem),                                \
-        TF_PP_TUPLE_ELEM(0, elem), elem){                                   \
-            _TF_PP_IFF(TF_PP_IS_TUPLE(elem),                                \
-                TF_PP_TUPLE_ELEM(1, elem), TF_PP_STRINGIZE(elem)),          \
-            TfToken::Immortal};
+        TF_PP_TUPLE_ELEM(0, elem), elem);
 #define _TF_TOKENS_DECLARE_TOKEN_MEMBERS(seq)                               \
     TF_PP_SEQ_FOR_EACH(_TF_TOKENS_DECLARE_MEMBER, ~, seq)
 
-#define _TF_TOKENS_FORWARD_TOKEN(unused, elem) TF_PP_TUPLE_ELEM(0, elem),
 #define _TF_TOKENS_DECLARE_ALL_TOKENS(seq)                                  \
-    std::vector<TfToken> allTokens =                                        \
-        {TF_PP_SEQ_FOR_EACH(_TF_TOKENS_FORWARD_TOKEN, ~, seq)};
+    std::vector<TfToken> allTokens;
+
+// Private macros used to generate the constructor body.  The string for
+// each token is forwarded to a single TfToken::BulkIntern call, which takes
+// each internal token-table lock at most once, rather than once per token.
+// The interned tokens land in allTokens in sequence order, and the token
+// members are then assigned from it.
+//
+#define _TF_TOKENS_FORWARD_STRING(unused, elem)                             \
+    _TF_PP_IFF(TF_PP_IS_TUPLE(elem),                                        \
+        TF_PP_TUPLE_ELEM(1, elem), TF_PP_STRINGIZE(elem)),
+
+#define _TF_TOKENS_ASSIGN_MEMBER(unused, elem)                              \
+    _TF_PP_IFF(TF_PP_IS_TUPLE(elem),                                        \
+        TF_PP_TUPLE_ELEM(0, elem), elem) = allTokens[_tfTokensIndex++];
+
+#define _TF_TOKENS_DEFINE_CTOR_BODY(seq)                                    \
+    {                                                                       \
+        static const char * const _tfTokensStrings[] = {                    \
+            TF_PP_SEQ_FOR_EACH(_TF_TOKENS_FORWARD_STRING, ~, seq)           \
+        };                                                                  \
+        constexpr size_t _tfTokensCount =                                   \
+            sizeof(_tfTokensStrings) / sizeof(_tfTokensStrings[0]);         \
+        allTokens.resize(_tfTokensCount);                                   \
+        TfToken::BulkIntern(_tfTokensStrings, _tfTokensCount,               \
+                            allTokens.data(), /* makeImmortal = */ true);   \
+        size_t _tfTokensIndex = 0;                                          \
+        TF_PP_SEQ_FOR_EACH(_TF_TOKENS_ASSIGN_MEMBER, ~, seq)                \
+        (void)_tfTokensIndex;                                               \
+    }
 
 // Private macro used to declare the list of members as TfTokens
 //
@@ -162,9 +190,10 @@ PXR_NAMESPACE_OPEN_SCOPE
 
 // Private macro to define the struct of tokens.
 //
-#define _TF_DEFINE_TOKENS(key)                                              \
+#define _TF_DEFINE_TOKENS(key, seq)                                         \
     _TF_TOKENS_STRUCT_NAME(key)::~_TF_TOKENS_STRUCT_NAME(key)() = default;  \
-    _TF_TOKENS_STRUCT_NAME(key)::_TF_TOKENS_STRUCT_NAME(key)() = default;   \
+    _TF_TOKENS_STRUCT_NAME(key)::_TF_TOKENS_STRUCT_NAME(key)()              \
+    _TF_TOKENS_DEFINE_CTOR_BODY(seq)
 
 PXR_NAMESPACE_CLOSE_SCOPE
 
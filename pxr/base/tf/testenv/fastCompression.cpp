@@ -20,7 +20,7 @@ PXR_NAMESPACE_USING_DIRECTIVE
 
 static char values[] = { 'a', 'b', 'c', 'd' };
 
-static bool testRoundTrip(size_t sz)
+static bool testRoundTrip(size_t sz, bool chained = false)
 {
     // Create some data to compress.
     std::unique_ptr<char []> src(new char[sz]);
@@ -31,11 +31,14 @@ static bool testRoundTrip(size_t sz)
         new char[TfFastCompression::GetCompressedBufferSize(sz)]);
 
     TfErrorMark m;
-    
+
     // Compress.
-    size_t compressedSize =
+    size_t compressedSize = chained ?
+        TfFastCompression::CompressToBufferChained(
+            src.get(), compressed.get(), sz) :
         TfFastCompression::CompressToBuffer(src.get(), compressed.get(), sz);
-    printf("Compressed %zu bytes to %zu\n", sz, compressedSize);
+    printf("Compressed %zu bytes to %zu%s\n", sz, compressedSize,
+           chained ? " (chained)" : "");
 
     // Decompress.
     std::unique_ptr<char []> decomp(new char[sz]);
@@ -68,6 +71,10 @@ Test_TfFastCompression()
             TF_FATAL_ERROR("Failed to (de)compress size %s\n",
                            TfStringify(sz).c_str());
         }
+        if (!testRoundTrip(sz, /*chained=*/true)) {
+            TF_FATAL_ERROR("Failed to (de)compress size %s (chained)\n",
+                           TfStringify(sz).c_str());
+        }
     }
     return true;
 }
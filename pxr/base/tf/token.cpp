@@ -20,7 +20,7 @@
 
 #include "pxr/base/arch/align.h"
 
-#include <tbb/spin_mutex.h>
+#include <tbb/spin_rw_mutex.h>
 
 #include <atomic>
 #include <algorithm>
@@ -77,12 +77,16 @@ struct Tf_TokenRegistry
     // TODO: Consider a better container than TfHashSet here.
     using _RepSet = TfHashSet<TfToken::_Rep, _InnerHash, _Eq>;
 
-    // Align this structure to ensure no false sharing of 'mutex'.
+    // Align this structure to ensure no false sharing of 'mutex'.  The
+    // mutex is a reader-writer lock so that looking up existing tokens --
+    // by far the common case once a process is warm -- can proceed
+    // concurrently within a shard; only insertions and sweeps take the
+    // lock exclusively.
     struct alignas(ARCH_CACHE_LINE_SIZE)
     _Set {
         _RepSet reps;
         unsigned insertsUntilSweepCheck = _MinInsertsUntilSweepCheck;
-        mutable tbb::spin_mutex mutex;
+        mutable tbb::spin_rw_mutex mutex;
     };
 
     // Data members.
@@ -106,6 +110,61 @@ struct Tf_TokenRegistry
         return _GetPtrImpl<string const &>(s, makeImmortal);
     }
 
+    // Intern a batch of strings, grouping them by shard so that each
+    // shard's lock is taken at most once no matter how many strings land
+    // in it.
+    void _BulkGetPtrs(char const * const *strs, size_t count, TfToken *out,
+                      bool makeImmortal) {
+        // Counting sort of input indices by shard.  Empty strings produce
+        // empty tokens and take no shard slot.
+        constexpr uint32_t NoShard = _NumSets;
+        uint32_t shardCounts[_NumSets] = {0};
+        std::vector<uint32_t> setNums(count);
+        for (size_t i = 0; i != count; ++i) {
+            if (_IsEmpty(strs[i])) {
+                setNums[i] = NoShard;
+                out[i] = TfToken();
+            }
+            else {
+                setNums[i] = _GetSetNum(strs[i]);
+                ++shardCounts[setNums[i]];
+            }
+        }
+
+        uint32_t shardStarts[_NumSets + 1];
+        uint32_t total = 0;
+        for (unsigned s = 0; s != _NumSets; ++s) {
+            shardStarts[s] = total;
+            total += shardCounts[s];
+        }
+        shardStarts[_NumSets] = total;
+
+        std::vector<uint32_t> order(total);
+        {
+            uint32_t fill[_NumSets];
+            memcpy(fill, shardStarts, sizeof(fill));
+            for (size_t i = 0; i != count; ++i) {
+                if (setNums[i] != NoShard) {
+                    order[fill[setNums[i]]++] = static_cast<uint32_t>(i);
+                }
+            }
+        }
+
+        for (unsigned s = 0; s != _NumSets; ++s) {
+            if (shardStarts[s] == shardStarts[s + 1]) {
+                continue;
+            }
+            _Set &set = _sets[s];
+            tbb::spin_rw_mutex::scoped_lock lock(set.mutex, /*write=*/true);
+            for (uint32_t j = shardStarts[s]; j != shardStarts[s + 1]; ++j) {
+                const uint32_t i = order[j];
+                TfToken t;
+                t._rep = _GetPtrWithSetLocked(set, s, strs[i], makeImmortal);
+                out[i] = std::move(t);
+            }
+        }
+    }
+
     inline _RepPtrAndBits _FindPtrChar(char const *s) const {
         return _FindPtrImpl(s);
     }
@@ -118,7 +177,8 @@ struct Tf_TokenRegistry
     void _DumpStats() const {
         std::vector<std::pair<size_t, size_t> > sizesWithSet;
         for (size_t i = 0; i != _NumSets; ++i) {
-            tbb::spin_mutex::scoped_lock lock(_sets[i].mutex);
+            tbb::spin_rw_mutex::scoped_lock lock(
+                _sets[i].mutex, /*write=*/false);
             sizesWithSet.push_back(std::make_pair(_sets[i].reps.size(), i));
         }
         std::sort(sizesWithSet.begin(), sizesWithSet.end());
@@ -163,6 +223,26 @@ private:
         return compCode;
     }
 
+    // Take a reference to an existing rep (or make it immortal).  The
+    // refcount members are atomic, so this requires only a shared lock on
+    // the rep's set: the lock's purpose is to exclude concurrent sweeps,
+    // which erase zero-refcount reps under an exclusive lock.
+    static _RepPtrAndBits _GrabRep(_RepPtr rep, bool makeImmortal) {
+        bool isCounted = rep->_refCount.load(std::memory_order_relaxed) & 1;
+        if (isCounted) {
+            if (makeImmortal) {
+                // Clear counted flag.
+                rep->_refCount.fetch_and(~1u, std::memory_order_relaxed);
+                isCounted = false;
+            }
+            else {
+                // Add one reference (we count by 2's).
+                rep->_refCount.fetch_add(2, std::memory_order_relaxed);
+            }
+        }
+        return _RepPtrAndBits(rep, isCounted);
+    }
+
     /*
      * Either finds a key that is stringwise-equal to s,
      * or puts a new _Rep into the map for s.
@@ -176,25 +256,31 @@ private:
         unsigned setNum = _GetSetNum(_CStr(s));
         _Set &set = _sets[setNum];
 
-        tbb::spin_mutex::scoped_lock lock(set.mutex);
+        // Hot path: the token already exists, and a shared lock suffices
+        // to find it and take a reference.
+        {
+            tbb::spin_rw_mutex::scoped_lock lock(set.mutex, /*write=*/false);
+            _RepSet::iterator iter = set.reps.find(_LookupRep(_CStr(s)));
+            if (iter != set.reps.end()) {
+                return _GrabRep(&(*iter), makeImmortal);
+            }
+        }
+
+        tbb::spin_rw_mutex::scoped_lock lock(set.mutex, /*write=*/true);
+        return _GetPtrWithSetLocked(set, setNum, s, makeImmortal);
+    }
 
+    /*
+     * The insertion slow path for _GetPtrImpl and _BulkGetPtrs; the caller
+     * must hold an exclusive lock on the set.
+     */
+    template <class Str>
+    _RepPtrAndBits _GetPtrWithSetLocked(_Set &set, unsigned setNum,
+                                        Str s, bool makeImmortal) {
         // Insert or lookup an existing.
         _RepSet::iterator iter = set.reps.find(_LookupRep(_CStr(s)));
         if (iter != set.reps.end()) {
-            _RepPtr rep = &(*iter);
-            bool isCounted = rep->_refCount.load(std::memory_order_relaxed) & 1;
-            if (isCounted) {
-                if (makeImmortal) {
-                    // Clear counted flag.
-                    rep->_refCount.fetch_and(~1u, std::memory_order_relaxed);
-                    isCounted = false;
-                }
-                else {
-                    // Add one reference (we count by 2's).
-                    rep->_refCount.fetch_add(2, std::memory_order_relaxed);
-                }
-            }
-            return _RepPtrAndBits(rep, isCounted);
+            return _GrabRep(&(*iter), makeImmortal);
         } else {
             // No entry present, add a new entry.  First check if we should
             // clean house.
@@ -264,7 +350,7 @@ private:
         size_t setNum = _GetSetNum(_CStr(s));
         _Set const &set = _sets[setNum];
 
-        tbb::spin_mutex::scoped_lock lock(set.mutex);
+        tbb::spin_rw_mutex::scoped_lock lock(set.mutex, /*write=*/false);
 
         _RepSet::const_iterator iter = set.reps.find(_LookupRep(_CStr(s)));
         if (iter == set.reps.end()) {
@@ -329,6 +415,14 @@ TfToken::Find(const string& s)
     return t;
 }
 
+void
+TfToken::BulkIntern(char const * const *strs, size_t count, TfToken *out,
+                    bool makeImmortal)
+{
+    Tf_TokenRegistry::_GetInstance()._BulkGetPtrs(strs, count, out,
+                                                  makeImmortal);
+}
+
 bool 
 TfToken::operator==(const string &o) const
 {
@@ -138,6 +138,17 @@ public:
     // will return it.  Otherwise, the empty token will be returned.
     TF_API static TfToken Find(std::string const& s);
 
+    /// Intern \p count null-terminated strings from \p strs, writing the
+    /// corresponding tokens to \p out.  Equivalent to assigning
+    /// TfToken(strs[i]) to out[i] for each i, but groups the strings by
+    /// internal table shard and takes each shard's lock only once, which
+    /// is substantially cheaper when interning many strings at a time
+    /// (e.g. reading a file's token section).  If \p makeImmortal is true
+    /// the tokens are interned as immortal, as if by TfToken(strs[i],
+    /// TfToken::Immortal); static token tables use this.
+    TF_API static void BulkIntern(char const * const *strs, size_t count,
+                                  TfToken *out, bool makeImmortal = false);
+
     /// Return a size_t hash for this token.
     //
     // The hash is based on the token's storage identity; this is immutable
@@ -13,6 +13,7 @@
 #include "pxr/base/tf/bigRWMutex.h"
 #include "pxr/base/tf/hash.h"
 #include "pxr/base/tf/hashmap.h"
+#include "pxr/base/tf/hashset.h"
 #include "pxr/base/tf/instantiateSingleton.h"
 #include "pxr/base/tf/iterator.h"
 #include "pxr/base/tf/mallocTag.h"
@@ -34,6 +35,8 @@
 #include "pxr/base/tf/pyUtils.h"
 #endif // PXR_PYTHON_SUPPORT_ENABLED
 
+#include <tbb/spin_mutex.h>
+
 #include <atomic>
 #include <algorithm>
 #include <iostream>
@@ -130,6 +133,19 @@ struct TfType::_TypeInfo {
     // True if we have sent a TfTypeWasDeclaredNotice for this type.
     bool hasSentNotice;
 
+    // Lock-free ancestor query cache.  A snapshot holds this type's full
+    // C3-linearized ancestor list plus a set keyed by _TypeInfo for O(1)
+    // IsA checks, tagged with the hierarchy version it was built against.
+    // Snapshots are immutable once published; superseded snapshots are
+    // retired to the registry rather than freed, since lock-free readers
+    // may still be using them.
+    struct _AncestorCache {
+        size_t version;
+        TypeVector allAncestors;
+        TfHashSet<_TypeInfo const *, TfHash> ancestorSet;
+    };
+    std::atomic<_AncestorCache *> ancestorCache;
+
     ////////////////////////////////////////////////////////////////////////
 
     // A type is "defined" as soon as it has either type_info or a
@@ -182,7 +198,8 @@ struct TfType::_TypeInfo {
         sizeofType(0),
         isPodType(false),
         isEnumType(false),
-        hasSentNotice(false)
+        hasSentNotice(false),
+        ancestorCache(nullptr)
     {
     }
 };
@@ -211,6 +228,25 @@ public:
 
     RWMutex &GetMutex() const { return _mutex; }
 
+    // Return the current hierarchy version.  The version is bumped whenever
+    // a type's set of bases grows, invalidating published ancestor cache
+    // snapshots.
+    size_t GetHierarchyVersion() const {
+        return _hierarchyVersion.load(std::memory_order_acquire);
+    }
+
+    // Callers must hold the registry write lock.
+    void BumpHierarchyVersion() {
+        _hierarchyVersion.fetch_add(1, std::memory_order_release);
+    }
+
+    // Return an ancestor cache snapshot for \p info that is current for the
+    // hierarchy version, building and publishing one if needed.  Return
+    // nullptr if the hierarchy is inconsistent.  Callers must hold at least
+    // a read lock on the registry mutex.
+    TfType::_TypeInfo::_AncestorCache *
+    GetOrBuildAncestorCache(TfType::_TypeInfo *info);
+
     inline void WaitForInitializingThread() const {
         // If we are the initializing thread or if the registry is initialized,
         // we don't have to wait.
@@ -332,8 +368,25 @@ public:
 private:
     Tf_TypeRegistry();
 
+    // Compute the C3-linearized ancestor list of \p info, mirroring
+    // TfType::GetAllAncestorTypes() but without re-taking the registry lock
+    // at each level.  Return false if the hierarchy is inconsistent.
+    // Callers must hold at least a read lock on the registry mutex.
+    bool _ComputeAllAncestorTypes(TfType::_TypeInfo *info,
+                                  TypeVector *result) const;
+
     mutable RWMutex _mutex;
 
+    // Version counter for the type hierarchy; see GetHierarchyVersion().
+    std::atomic<size_t> _hierarchyVersion{0};
+
+    // Superseded ancestor cache snapshots, kept alive because lock-free
+    // readers may still reference them.  Hierarchy growth is effectively a
+    // startup-time activity, so this list stays small.
+    tbb::spin_mutex _retiredAncestorCachesMutex;
+    std::vector<std::unique_ptr<TfType::_TypeInfo::_AncestorCache>>
+        _retiredAncestorCaches;
+
     // The thread that is currently performing initialization.  This is set to a
     // default-constructed thread::id when initialization is complete.
     mutable std::atomic<std::thread::id> _initializingThread;
@@ -686,6 +739,80 @@ _MergeAncestors(vector<TypeVector> *seqs, TypeVector *result)
     }
 }
 
+bool
+Tf_TypeRegistry::_ComputeAllAncestorTypes(
+    TfType::_TypeInfo *info, TypeVector *result) const
+{
+    const TypeVector &baseTypes = info->baseTypes;
+    const size_t numBaseTypes = baseTypes.size();
+
+    // Simple case: single (or no) inheritance
+    if (numBaseTypes <= 1) {
+        result->push_back(info->canonicalTfType);
+        if (numBaseTypes == 1) {
+            return _ComputeAllAncestorTypes(baseTypes.front()._info, result);
+        }
+        return true;
+    }
+
+    vector<TypeVector> seqs;
+    seqs.reserve(2 + numBaseTypes);
+
+    // 1st input sequence: This class.
+    seqs.push_back(TypeVector(1, info->canonicalTfType));
+
+    // 2nd input sequence: Direct bases, in order.
+    seqs.push_back(baseTypes);
+
+    // Remaining sequences: Inherited types for each direct base.
+    for (const TfType &base: baseTypes) {
+        seqs.push_back(TypeVector());
+        if (!_ComputeAllAncestorTypes(base._info, &seqs.back())) {
+            return false;
+        }
+    }
+
+    return _MergeAncestors(&seqs, result);
+}
+
+TfType::_TypeInfo::_AncestorCache *
+Tf_TypeRegistry::GetOrBuildAncestorCache(TfType::_TypeInfo *info)
+{
+    size_t version = GetHierarchyVersion();
+    TfType::_TypeInfo::_AncestorCache *cache =
+        info->ancestorCache.load(std::memory_order_acquire);
+    if (cache && cache->version == version) {
+        return cache;
+    }
+
+    auto newCache = std::make_unique<TfType::_TypeInfo::_AncestorCache>();
+    newCache->version = version;
+    if (!_ComputeAllAncestorTypes(info, &newCache->allAncestors)) {
+        // Inconsistent hierarchy; the caller falls back to the uncached
+        // path, which diagnoses the problem.
+        return nullptr;
+    }
+    for (const TfType &ancestor: newCache->allAncestors) {
+        newCache->ancestorSet.insert(ancestor._info);
+    }
+
+    // Publish.  The hierarchy version cannot change while we hold a read
+    // lock, so a competing snapshot is either current (use it) or older
+    // (replace it).
+    while (!info->ancestorCache.compare_exchange_strong(
+               cache, newCache.get(),
+               std::memory_order_release, std::memory_order_acquire)) {
+        if (cache && cache->version == version) {
+            return cache;
+        }
+    }
+    if (cache) {
+        tbb::spin_mutex::scoped_lock lock(_retiredAncestorCachesMutex);
+        _retiredAncestorCaches.emplace_back(cache);
+    }
+    return newCache.release();
+}
+
 void
 TfType::GetAllAncestorTypes(vector<TfType> *result) const
 {
@@ -694,6 +821,31 @@ TfType::GetAllAncestorTypes(vector<TfType> *result) const
         return;
     }
 
+    auto &r = Tf_TypeRegistry::GetInstance();
+
+    // Fast path: if this type's ancestor cache snapshot is current, use it
+    // without taking the registry lock.
+    if (_TypeInfo::_AncestorCache *cache =
+            _info->ancestorCache.load(std::memory_order_acquire)) {
+        if (cache->version == r.GetHierarchyVersion()) {
+            result->insert(result->end(),
+                           cache->allAncestors.begin(),
+                           cache->allAncestors.end());
+            return;
+        }
+    }
+
+    {
+        ScopedLock lock(r.GetMutex(), /*write=*/false);
+        if (_TypeInfo::_AncestorCache *cache =
+                r.GetOrBuildAncestorCache(_info)) {
+            result->insert(result->end(),
+                           cache->allAncestors.begin(),
+                           cache->allAncestors.end());
+            return;
+        }
+    }
+
     const vector<TfType> &baseTypes = GetBaseTypes();
     const size_t numBaseTypes = baseTypes.size();
 
@@ -799,13 +951,28 @@ TfType::IsA(TfType queryType) const
         return true;
     }
 
+    auto &r = Tf_TypeRegistry::GetInstance();
+
+    // Fast path: if this type's ancestor cache snapshot is current, consult
+    // it without taking the registry lock.
+    if (_TypeInfo::_AncestorCache *cache =
+            _info->ancestorCache.load(std::memory_order_acquire)) {
+        if (cache->version == r.GetHierarchyVersion()) {
+            return cache->ancestorSet.count(queryType._info);
+        }
+    }
+
     // If the query type doesn't have any child types, then iterating over all
     // our base types wastes time.
-    ScopedLock lock(GetRegistryMutex(), /*write=*/false);
+    ScopedLock lock(r.GetMutex(), /*write=*/false);
     if (queryType._info->derivedTypes.empty()) {
         return false;
     }
 
+    if (_TypeInfo::_AncestorCache *cache = r.GetOrBuildAncestorCache(_info)) {
+        return cache->ancestorSet.count(queryType._info);
+    }
+
     return _IsAImplNoLock(queryType);
 }
 
@@ -1032,10 +1199,13 @@ TfType::_AddBasesNoLock(
             }
         }
     
-        // Fully replace the list of existing bases if needed.  This is so that 
-        // we set the order even if we register bases for a type (partially) 
-        // multiple times. 
+        // Fully replace the list of existing bases if needed.  This is so that
+        // we set the order even if we register bases for a type (partially)
+        // multiple times.
         _info->baseTypes = newBases;
+
+        // Invalidate published ancestor cache snapshots.
+        Tf_TypeRegistry::GetInstance().BumpHierarchyVersion();
     }
 }
 
@@ -10,12 +10,14 @@
 #include "pxr/pxr.h"
 #include "pxr/base/trace/collection.h"
 #include "pxr/base/trace/collectionNotice.h"
+#include "pxr/base/trace/perfCounters.h"
 #include "pxr/base/trace/reporter.h"
 #include "pxr/base/trace/trace.h"
 
 #include "pxr/base/arch/stackTrace.h"
 #include "pxr/base/arch/timing.h"
 
+#include "pxr/base/tf/diagnostic.h"
 #include "pxr/base/tf/getenv.h"
 #include "pxr/base/tf/instantiateSingleton.h"
 
@@ -40,6 +42,8 @@ PXR_NAMESPACE_OPEN_SCOPE
 TF_INSTANTIATE_SINGLETON(TraceCollector);
 
 std::atomic<int> TraceCollector::_isEnabled(0);
+std::atomic<int> TraceCollector::_isPerfCounterSamplingEnabled(0);
+std::atomic<size_t> TraceCollector::_eventBufferLimit(0);
 
 TraceCollector::_PerThreadData* TraceCollector::_GetThreadData() noexcept
 {
@@ -76,6 +80,19 @@ TraceCollector::TraceCollector()
     
     const bool globalTracing = TfGetenvBool("PXR_ENABLE_GLOBAL_TRACE", false);
 
+    // A nonzero event buffer limit bounds per-thread event storage and
+    // enables collection, for always-on bounded tracing.
+    const int eventBufferLimit =
+        TfGetenvInt("PXR_TRACE_EVENT_BUFFER_LIMIT", 0);
+    if (eventBufferLimit > 0) {
+        SetEventBufferLimit(eventBufferLimit);
+        SetEnabled(true);
+    }
+
+    if (TfGetenvBool("PXR_TRACE_PERF_COUNTERS", false)) {
+        SetPerfCounterSamplingEnabled(true);
+    }
+
 #ifdef PXR_PYTHON_SUPPORT_ENABLED
     const bool globalPyTracing =
         TfGetenvBool("PXR_ENABLE_GLOBAL_PY_TRACE", false);
@@ -105,6 +122,56 @@ TraceCollector::SetEnabled(bool isEnabled)
     _isEnabled.store((int)isEnabled, std::memory_order_release);
 }
 
+void
+TraceCollector::SetEventBufferLimit(size_t numEvents)
+{
+    _eventBufferLimit.store(numEvents, std::memory_order_relaxed);
+}
+
+size_t
+TraceCollector::GetEventBufferLimit()
+{
+    return _eventBufferLimit.load(std::memory_order_relaxed);
+}
+
+void
+TraceCollector::SetPerfCounterSamplingEnabled(bool enabled)
+{
+    if (enabled && !Trace_PerfCounters::IsSupported()) {
+        TF_WARN("Hardware performance counter sampling is not supported "
+                "on this platform.");
+        return;
+    }
+    _isPerfCounterSamplingEnabled.store(
+        (int)enabled, std::memory_order_release);
+}
+
+void
+TraceCollector::RecordPerfCounterDeltas(TraceCategoryId cat)
+{
+    if (!IsPerfCounterSamplingEnabled()) {
+        return;
+    }
+
+    Trace_PerfCounters::Deltas deltas;
+    if (!Trace_PerfCounters::ReadDeltas(&deltas)) {
+        return;
+    }
+
+    constexpr static TraceStaticKeyData cyclesKey("PMU cycles");
+    constexpr static TraceStaticKeyData cacheMissesKey("PMU cache misses");
+    constexpr static TraceStaticKeyData branchMissesKey("PMU branch misses");
+
+    _PerThreadData *threadData = GetInstance()._GetThreadData();
+    threadData->EmplaceEvent(TraceEvent::CounterDelta, TraceKey(cyclesKey),
+                             static_cast<double>(deltas.cycles), cat);
+    threadData->EmplaceEvent(TraceEvent::CounterDelta, TraceKey(cacheMissesKey),
+                             static_cast<double>(deltas.cacheMisses), cat);
+    threadData->EmplaceEvent(TraceEvent::CounterDelta,
+                             TraceKey(branchMissesKey),
+                             static_cast<double>(deltas.branchMisses), cat);
+}
+
 
 void
 TraceCollector::Scope(
@@ -123,6 +190,10 @@ TraceCollector::_BeginEvent(const Key& key, TraceCategoryId cat)
         return 0;
     }
 
+    if (ARCH_UNLIKELY(IsPerfCounterSamplingEnabled())) {
+        RecordPerfCounterDeltas(cat);
+    }
+
     _PerThreadData *threadData = _GetThreadData();
     return threadData->BeginEvent(key, cat);
 }
@@ -135,6 +206,10 @@ TraceCollector::_EndEvent(const Key& key, TraceCategoryId cat)
         return 0;
     }
 
+    if (ARCH_UNLIKELY(IsPerfCounterSamplingEnabled())) {
+        RecordPerfCounterDeltas(cat);
+    }
+
     _PerThreadData *threadData = _GetThreadData();
     return threadData->EndEvent(key, cat);
 }
@@ -207,6 +282,12 @@ TraceCollector::Clear()
 void
 TraceCollector::_EndScope(const TraceKey& key, TraceCategoryId cat)
 {
+    // Attribute the counters accumulated since the last boundary to the
+    // scope being closed, before the end event closes it.
+    if (ARCH_UNLIKELY(IsPerfCounterSamplingEnabled())) {
+        RecordPerfCounterDeltas(cat);
+    }
+
     // Note we're not calling _NewEvent, be fast and don't
     // need to cache key
     _PerThreadData *threadData = _GetThreadData();
@@ -305,6 +386,7 @@ TraceCollector::SetPythonTracingEnabled(bool enabled)
 
 TraceCollector::_PerThreadData::_PerThreadData()
     : _writing()
+    , _numEvents(0)
 {
     _threadIndex = TraceGetThreadId();
     _events = new EventList();
@@ -323,6 +405,7 @@ TraceCollector::_PerThreadData::BeginEvent(const Key& key, TraceCategoryId cat)
     EventList* events = _events.load(std::memory_order_acquire);
     const TraceEvent& event = 
         events->EmplaceBack(TraceEvent::Begin, events->CacheKey(key), cat);
+    _CountEvent();
     return event.GetTimeStamp();
 }
 
@@ -334,6 +417,7 @@ TraceCollector::_PerThreadData::EndEvent(const Key& key, TraceCategoryId cat)
     EventList* events = _events.load(std::memory_order_acquire);
     const TraceEvent& event =
         events->EmplaceBack(TraceEvent::End, events->CacheKey(key), cat);
+    _CountEvent();
     return event.GetTimeStamp();
 }
 
@@ -345,6 +429,7 @@ TraceCollector::_PerThreadData::MarkerEvent(const Key& key, TraceCategoryId cat)
     EventList* events = _events.load(std::memory_order_acquire);
     const TraceEvent& event =
         events->EmplaceBack(TraceEvent::Marker, events->CacheKey(key), cat);
+    _CountEvent();
     return event.GetTimeStamp();
 }
 
@@ -359,6 +444,7 @@ TraceCollector::_PerThreadData::BeginEventAtTime(
         uint64_t(ms * 1000 / double(ArchTicksToSeconds(1000000)));
     EventList* events = _events.load(std::memory_order_acquire);
     events->EmplaceBack(TraceEvent::Begin, events->CacheKey(key), ts, cat);
+    _CountEvent();
 }
 
 void
@@ -372,6 +458,7 @@ TraceCollector::_PerThreadData::EndEventAtTime(
         uint64_t(ms * 1000 / double(ArchTicksToSeconds(1000000)));
     EventList* events = _events.load(std::memory_order_acquire);
     events->EmplaceBack(TraceEvent::End, events->CacheKey(key), ts, cat);
+    _CountEvent();
 }
 
 void
@@ -385,6 +472,7 @@ TraceCollector::_PerThreadData::MarkerEventAtTime(
         uint64_t(ms * 1000 / double(ArchTicksToSeconds(1000000)));
     EventList* events = _events.load(std::memory_order_acquire);
     events->EmplaceBack(TraceEvent::Marker, events->CacheKey(key), ts, cat);
+    _CountEvent();
 }
 
 void
@@ -402,6 +490,7 @@ TraceCollector::_PerThreadData::CounterDelta(
     EventList* events = _events.load(std::memory_order_acquire);
     events->EmplaceBack(
         TraceEvent::CounterDelta, events->CacheKey(key), value, cat);
+    _CountEvent();
 }
 
 void
@@ -412,6 +501,7 @@ TraceCollector::_PerThreadData::CounterValue(
     EventList* events = _events.load(std::memory_order_acquire);
     events->EmplaceBack(
         TraceEvent::CounterValue, events->CacheKey(key), value, cat);
+    _CountEvent();
 }
 
 #ifdef PXR_PYTHON_SUPPORT_ENABLED
@@ -458,10 +548,44 @@ TraceCollector::_PerThreadData::GetCollectionData() {
     // potentially writing to prevList.
     while (_writing.load(std::memory_order_acquire)) {}
 
+    // In ring-buffer mode splice any retained segments ahead of the current
+    // list so the collection is ordered oldest to newest.
+    std::deque<std::unique_ptr<EventList>> retained;
+    {
+        tbb::spin_mutex::scoped_lock lock(_retainedMutex);
+        retained.swap(_retainedEvents);
+    }
+    if (!retained.empty()) {
+        std::unique_ptr<EventList> merged = std::move(retained.front());
+        retained.pop_front();
+        for (std::unique_ptr<EventList> &segment : retained) {
+            merged->Append(std::move(*segment));
+        }
+        merged->Append(std::move(*prevList));
+        return merged;
+    }
+
     // Now it should be ok to release the list to the outside.
     return prevList;
 }
 
+void
+TraceCollector::_PerThreadData::_RotateEvents() {
+    _numEvents = 0;
+
+    // Retire the current event list to the retained segments and direct
+    // subsequent events to a fresh list.  The exchange keeps ownership
+    // unique even if another thread concurrently swaps the list out for
+    // collection.
+    std::unique_ptr<EventList> full(_events.exchange(new EventList()));
+
+    tbb::spin_mutex::scoped_lock lock(_retainedMutex);
+    _retainedEvents.push_back(std::move(full));
+    while (_retainedEvents.size() >= _NumEventSegments) {
+        _retainedEvents.pop_front();
+    }
+}
+
 void
 TraceCollector::_PerThreadData::Clear() {
     // Swap out the data and let the event list be cleaned up.
@@ -31,6 +31,8 @@
 #include "pxr/base/arch/pragmas.h"
 
 #include <atomic>
+#include <deque>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -78,6 +80,64 @@ public:
         return (_isEnabled.load(std::memory_order_acquire) == 1);
     }
 
+    /// Limit the number of events retained per thread to approximately
+    /// \p numEvents, recording into a bounded ring buffer.
+    ///
+    /// By default the collector retains every recorded event until the next
+    /// call to CreateCollection() or Clear(), which makes long-running
+    /// processes grow without bound when tracing is left enabled.  With a
+    /// nonzero limit, each thread periodically retires its oldest events so
+    /// that only roughly the last \p numEvents per thread are kept; a
+    /// subsequent CreateCollection() then produces the most recent window of
+    /// activity, e.g. for export with TraceReporter::ReportChromeTracing().
+    /// This bounds memory use and allows tracing to be left enabled in
+    /// production, at the cost of scopes that began before the start of the
+    /// window appearing truncated.
+    ///
+    /// The limit may also be set at startup with the
+    /// PXR_TRACE_EVENT_BUFFER_LIMIT environment variable; a nonzero value
+    /// additionally enables collection, for always-on bounded tracing.
+    /// Pass zero to return to unbounded collection.
+    TRACE_API static void SetEventBufferLimit(size_t numEvents);
+
+    /// Returns the per-thread event retention limit, or zero if collection
+    /// is unbounded.
+    /// \sa SetEventBufferLimit
+    TRACE_API static size_t GetEventBufferLimit();
+
+    /// Enables or disables sampling of hardware performance counters
+    /// (processor cycles, cache misses, and branch misses) at scope
+    /// boundaries.
+    ///
+    /// When enabled, each scope boundary additionally records counter
+    /// deltas covering the code executed since the previous boundary on the
+    /// same thread.  The deltas appear as the "PMU cycles", "PMU cache
+    /// misses", and "PMU branch misses" counters in TraceReporter's
+    /// aggregate tree, attributed to the scope in which the work occurred,
+    /// which makes it possible to tell memory-bound scopes from
+    /// compute-bound ones without external tooling.
+    ///
+    /// Sampling is supported on Linux via perf_event_open; enabling it on
+    /// other platforms, or where the kernel denies access to the PMU, has
+    /// no effect.  It may also be enabled at startup with the
+    /// PXR_TRACE_PERF_COUNTERS environment variable.
+    TRACE_API static void SetPerfCounterSamplingEnabled(bool enabled);
+
+    /// Returns whether hardware performance counter sampling is enabled.
+    /// \sa SetPerfCounterSamplingEnabled
+    static bool IsPerfCounterSamplingEnabled() {
+        return _isPerfCounterSamplingEnabled.load(std::memory_order_acquire)
+            == 1;
+    }
+
+    /// Records deltas of the sampled hardware performance counters since
+    /// the previous boundary on this thread, as counter events with
+    /// category \p cat.  Called by the scope macros at scope boundaries
+    /// when sampling is enabled; does nothing if sampling is disabled or
+    /// the counters are unavailable.
+    /// \sa SetPerfCounterSamplingEnabled
+    TRACE_API static void RecordPerfCounterDeltas(TraceCategoryId cat);
+
     /// Default Trace category which corresponds to events stored for TRACE_
     /// macros.
     struct DefaultCategory {
@@ -419,6 +479,12 @@ private:
     // and TRACE_SCOPE macros
     void _BeginScope(const TraceKey& key, TraceCategoryId cat)
     {
+        // Attribute the counters accumulated since the last boundary to the
+        // enclosing scope, before the begin event opens this one.
+        if (ARCH_UNLIKELY(IsPerfCounterSamplingEnabled())) {
+            RecordPerfCounterDeltas(cat);
+        }
+
         // Note we're not calling _NewEvent, don't need to cache key
         _PerThreadData *threadData = _GetThreadData();
         threadData->BeginScope(key, cat);
@@ -511,11 +577,13 @@ private:
             void BeginScope(const TraceKey& key, TraceCategoryId cat) {
                 AtomicRef lock(_writing);
                 _BeginScope(key, cat);
+                _CountEvent();
             }
 
             void EndScope(const TraceKey& key, TraceCategoryId cat) {
                 AtomicRef lock(_writing);
                 _EndScope(key, cat);
+                _CountEvent();
             }
 
             TRACE_API void CounterDelta(
@@ -530,6 +598,7 @@ private:
                 AtomicRef lock(_writing);
                 _events.load(std::memory_order_acquire)->EmplaceBack(
                     TraceEvent::Data, key, data, cat);
+                _CountEvent();
             }
 
             template <typename T>
@@ -539,6 +608,7 @@ private:
                 EventList* events = _events.load(std::memory_order_acquire);
                 const auto* cached = events->StoreData(data);
                 events->EmplaceBack(TraceEvent::Data, key, cached, cat);
+                _CountEvent();
             }
 
             template <typename... Args>
@@ -546,6 +616,7 @@ private:
                 AtomicRef lock(_writing);
                 _events.load(std::memory_order_acquire)->EmplaceBack(
                     std::forward<Args>(args)...);
+                _CountEvent();
             }
 
 #ifdef PXR_PYTHON_SUPPORT_ENABLED
@@ -566,10 +637,39 @@ private:
 
             void _EndScope(const TraceKey& key, TraceCategoryId cat);
 
+            // Number of retained segments the event buffer limit is divided
+            // into; more segments make the retained window's size more
+            // accurate at the cost of more frequent rotation.
+            static constexpr size_t _NumEventSegments = 4;
+
+            // When a ring-buffer limit is set, rotate the current event list
+            // into the retained segments once it has accumulated a segment's
+            // worth of events.  Must be called with _writing held.
+            void _CountEvent() {
+                const size_t limit =
+                    _eventBufferLimit.load(std::memory_order_relaxed);
+                if (ARCH_UNLIKELY(limit != 0) &&
+                    ++_numEvents * _NumEventSegments >= limit) {
+                    _RotateEvents();
+                }
+            }
+
+            TRACE_API void _RotateEvents();
+
             // Flag to let other threads know that the list is being written to.
             mutable std::atomic<bool> _writing;
             std::atomic<EventList*> _events;
 
+            // Number of events recorded into the current event list; only
+            // maintained when an event buffer limit is set.
+            size_t _numEvents;
+
+            // Older event lists retained in ring-buffer mode, ordered oldest
+            // to newest.  Guarded by _retainedMutex since collection may
+            // drain the segments from another thread.
+            std::deque<std::unique_ptr<EventList>> _retainedEvents;
+            tbb::spin_mutex _retainedMutex;
+
             class AtomicRef {
             public:
                 AtomicRef(std::atomic<bool>& b) : _bool(b) {
@@ -597,6 +697,12 @@ private:
 
     TRACE_API static std::atomic<int> _isEnabled;
 
+    // Whether hardware performance counters are sampled at scope boundaries.
+    TRACE_API static std::atomic<int> _isPerfCounterSamplingEnabled;
+
+    // Approximate per-thread event retention limit; zero means unbounded.
+    TRACE_API static std::atomic<size_t> _eventBufferLimit;
+
     // A list with one _PerThreadData per thread.
     TraceConcurrentList<_PerThreadData> _allPerThreadData;
 
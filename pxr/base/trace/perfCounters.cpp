@@ -0,0 +1,158 @@
+//
+// Copyright 2018 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+
+#include "pxr/pxr.h"
+#include "pxr/base/trace/perfCounters.h"
+
+#include "pxr/base/arch/defines.h"
+#include "pxr/base/arch/hints.h"
+#include "pxr/base/tf/diagnostic.h"
+
+#if defined(ARCH_OS_LINUX)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#endif
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+#if defined(ARCH_OS_LINUX)
+
+namespace {
+
+// One counter group per thread: cycles is the group leader, with cache
+// misses and branch misses as members so all three counters are read
+// atomically with a single system call (PERF_FORMAT_GROUP).
+struct _ThreadCounters {
+    ~_ThreadCounters() {
+        for (int i = 0; i != 2; ++i) {
+            if (memberFds[i] >= 0) {
+                close(memberFds[i]);
+            }
+        }
+        if (groupFd >= 0) {
+            close(groupFd);
+        }
+    }
+
+    int groupFd = -1;
+    int memberFds[2] = {-1, -1};
+    bool failed = false;
+    uint64_t last[3] = {0, 0, 0};
+};
+
+thread_local _ThreadCounters _threadCounters;
+
+int
+_OpenCounter(uint64_t config, int groupFd)
+{
+    perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = config;
+    attr.disabled = (groupFd == -1);
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP;
+    return syscall(SYS_perf_event_open, &attr,
+                   /*pid=*/0, /*cpu=*/-1, groupFd, /*flags=*/0);
+}
+
+bool
+_OpenCounters(_ThreadCounters *counters)
+{
+    counters->groupFd =
+        _OpenCounter(PERF_COUNT_HW_CPU_CYCLES, -1);
+    if (counters->groupFd >= 0) {
+        counters->memberFds[0] =
+            _OpenCounter(PERF_COUNT_HW_CACHE_MISSES, counters->groupFd);
+        counters->memberFds[1] =
+            _OpenCounter(PERF_COUNT_HW_BRANCH_MISSES, counters->groupFd);
+    }
+    if (counters->groupFd < 0
+            || counters->memberFds[0] < 0 || counters->memberFds[1] < 0) {
+        const int openErrno = errno;
+        counters->failed = true;
+
+        // Warn only for the first thread that fails; the usual causes
+        // (perf_event_paranoid, containers, missing PMU) affect the whole
+        // process.
+        static std::atomic<bool> warned(false);
+        if (!warned.exchange(true)) {
+            TF_WARN("Failed to open hardware performance counters "
+                    "(perf_event_open: %s).  Performance counter sampling "
+                    "will be disabled; check "
+                    "/proc/sys/kernel/perf_event_paranoid.",
+                    strerror(openErrno));
+        }
+        return false;
+    }
+
+    ioctl(counters->groupFd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(counters->groupFd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    return true;
+}
+
+} // anonymous namespace
+
+bool
+Trace_PerfCounters::IsSupported()
+{
+    return true;
+}
+
+bool
+Trace_PerfCounters::ReadDeltas(Deltas *deltas)
+{
+    _ThreadCounters &counters = _threadCounters;
+    if (ARCH_UNLIKELY(counters.groupFd < 0)) {
+        if (counters.failed || !_OpenCounters(&counters)) {
+            return false;
+        }
+    }
+
+    struct {
+        uint64_t nr;
+        uint64_t values[3];
+    } data;
+    if (read(counters.groupFd, &data, sizeof(data)) != sizeof(data)
+            || data.nr != 3) {
+        return false;
+    }
+
+    deltas->cycles = data.values[0] - counters.last[0];
+    deltas->cacheMisses = data.values[1] - counters.last[1];
+    deltas->branchMisses = data.values[2] - counters.last[2];
+    counters.last[0] = data.values[0];
+    counters.last[1] = data.values[1];
+    counters.last[2] = data.values[2];
+    return true;
+}
+
+#else // !ARCH_OS_LINUX
+
+bool
+Trace_PerfCounters::IsSupported()
+{
+    return false;
+}
+
+bool
+Trace_PerfCounters::ReadDeltas(Deltas *deltas)
+{
+    return false;
+}
+
+#endif // ARCH_OS_LINUX
+
+PXR_NAMESPACE_CLOSE_SCOPE
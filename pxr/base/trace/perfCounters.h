@@ -0,0 +1,54 @@
+//
+// Copyright 2018 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+
+#ifndef PXR_BASE_TRACE_PERF_COUNTERS_H
+#define PXR_BASE_TRACE_PERF_COUNTERS_H
+
+#include "pxr/pxr.h"
+#include "pxr/base/trace/api.h"
+
+#include <cstdint>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+////////////////////////////////////////////////////////////////////////////////
+/// \class Trace_PerfCounters
+///
+/// Internal access to hardware performance counters (PMU), used by
+/// TraceCollector to sample processor cycles, cache misses, and branch misses
+/// at scope boundaries.
+///
+/// On Linux the counters are opened through perf_event_open, one counter
+/// group per thread, and all three counters are read with a single system
+/// call.  Other platforms report that sampling is unsupported.
+///
+class Trace_PerfCounters {
+public:
+    // Counter deltas since the previous successful ReadDeltas call on the
+    // same thread.
+    struct Deltas {
+        uint64_t cycles;
+        uint64_t cacheMisses;
+        uint64_t branchMisses;
+    };
+
+    /// Reads this thread's counters and returns the deltas since the
+    /// previous successful read on this thread.  The counters are opened on
+    /// first use.  Returns false, without reporting further errors, if the
+    /// counters cannot be opened or read; the first failed open in the
+    /// process issues a warning.
+    TRACE_API static bool ReadDeltas(Deltas *deltas);
+
+    /// Returns whether this platform supports performance counter sampling.
+    /// Note that a supported platform may still refuse access to the PMU at
+    /// runtime, e.g. via perf_event_paranoid; that is reported by ReadDeltas.
+    TRACE_API static bool IsSupported();
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // PXR_BASE_TRACE_PERF_COUNTERS_H
@@ -44,7 +44,8 @@ TraceReporter::TraceReporter(const string& label,
     _label(label),
     _groupByFunction(true),
     _foldRecursiveCalls(false),
-    _shouldAdjustForOverheadAndNoise(true)
+    _shouldAdjustForOverheadAndNoise(true),
+    _retainFullTraceData(true)
 {
     _aggregateTree = TraceAggregateTree::New();
     _eventTree = TraceEventTree::New();
@@ -423,6 +424,7 @@ TraceReporter::ClearTree()
 { 
     _aggregateTree->Clear();
     _eventTree = TraceEventTree::New();
+    _lastCounterValues.clear();
     _Clear();
 }
 
@@ -499,6 +501,19 @@ TraceReporter::ShouldAdjustForOverheadAndNoise() const
     return _shouldAdjustForOverheadAndNoise;
 }
 
+void
+TraceReporter::SetRetainFullTraceData(bool retain)
+{
+    _retainFullTraceData = retain;
+    _SetRetainProcessedCollections(retain);
+}
+
+bool
+TraceReporter::GetRetainFullTraceData() const
+{
+    return _retainFullTraceData;
+}
+
 /* static */
 TraceAggregateNode::Id
 TraceReporter::CreateValidEventId() 
@@ -512,14 +527,26 @@ TraceReporter::_ProcessCollection(
 {
     if (collection) {
 
-        // We just always build the single (additional) event tree for the 
-        // (additional) new collection given and pass it on to the aggregate 
-        // tree. Note that the call to Add() merges in the newGraph to 
-        // _eventTree which thus represents the merged sum of all collections 
-        // seen here whereas newGraph is just the graph for the new collection. 
-
-        TraceEventTreeRefPtr newGraph = _eventTree->Add(*collection);
-        _aggregateTree->Append(newGraph, *collection);
+        // We just always build the single (additional) event tree for the
+        // (additional) new collection given and pass it on to the aggregate
+        // tree. Note that the call to Add() merges in the newGraph to
+        // _eventTree which thus represents the merged sum of all collections
+        // seen here whereas newGraph is just the graph for the new collection.
+
+        if (_retainFullTraceData) {
+            TraceEventTreeRefPtr newGraph = _eventTree->Add(*collection);
+            _aggregateTree->Append(newGraph, *collection);
+        } else {
+            // Build a transient event tree for just this collection, seeded
+            // with the final counter values from the previous one so counter
+            // deltas stay correct, and fold it into the aggregate tree.  The
+            // transient tree and the raw collection are released afterwards,
+            // keeping memory bounded.
+            TraceEventTreeRefPtr newGraph =
+                TraceEventTree::New(*collection, &_lastCounterValues);
+            _aggregateTree->Append(newGraph, *collection);
+            _lastCounterValues = newGraph->GetFinalCounterValues();
+        }
     }
 }
 
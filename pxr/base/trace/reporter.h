@@ -21,6 +21,7 @@
 
 #include <iosfwd>
 #include <string>
+#include <unordered_map>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -189,6 +190,21 @@ public:
     /// noise.
     TRACE_API bool ShouldAdjustForOverheadAndNoise() const;
 
+    /// Sets whether the reporter retains the full trace data in addition to
+    /// the aggregate tree.  When disabled, each collection is folded into
+    /// the aggregate tree as it is received and then released: raw
+    /// collections are not retained for SerializeProcessedCollections and
+    /// the merged event tree is not built, so memory stays bounded and each
+    /// update costs time proportional to new events only, which makes
+    /// long-running captures practical.  The event tree (GetEventRoot,
+    /// GetEventTree, ReportChromeTracing) only reflects data received while
+    /// retention was enabled.  Default is enabled.
+    TRACE_API void SetRetainFullTraceData(bool retain);
+
+    /// Returns whether the reporter retains the full trace data.
+    /// \sa SetRetainFullTraceData
+    TRACE_API bool GetRetainFullTraceData() const;
+
     /// @}
 
     /// Creates a valid TraceAggregateNode::Id object.
@@ -213,9 +229,17 @@ private:
     bool _groupByFunction;
     bool _foldRecursiveCalls;
     bool _shouldAdjustForOverheadAndNoise;
+    bool _retainFullTraceData;
 
     TraceAggregateTreeRefPtr _aggregateTree;
     TraceEventTreeRefPtr _eventTree;
+
+    // Final counter values from the last processed collection (in
+    // TraceEventTree::CounterMap form), used to seed transient event trees
+    // so counter deltas stay correct when the merged event tree is not
+    // being built.
+    std::unordered_map<TfToken, double, TfToken::HashFunctor>
+        _lastCounterValues;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
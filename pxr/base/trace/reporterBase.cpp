@@ -40,6 +40,12 @@ TraceReporterBase::_Clear()
     }
 }
 
+void
+TraceReporterBase::_SetRetainProcessedCollections(bool retain)
+{
+    _retainProcessedCollections = retain;
+}
+
 void
 TraceReporterBase::_Update()
 {
@@ -48,7 +54,9 @@ TraceReporterBase::_Update()
     std::vector<CollectionPtr> data = _dataSource->ConsumeData();
     for (const CollectionPtr& collection : data) {
         _ProcessCollection(collection);
-        _processedCollections.push_back(collection);
+        if (_retainProcessedCollections) {
+            _processedCollections.push_back(collection);
+        }
     }
 }
 
@@ -60,9 +60,17 @@ protected:
     /// Called once per collection from _Update()
     virtual void _ProcessCollection(const CollectionPtr&) = 0;
 
+    /// Sets whether collections are retained after they have been processed.
+    /// Retained collections are used by SerializeProcessedCollections; when
+    /// retention is disabled, each collection is released as soon as
+    /// _ProcessCollection returns, keeping memory bounded during long
+    /// captures.  Default is to retain.
+    TRACE_API void _SetRetainProcessedCollections(bool retain);
+
 private:
     DataSourcePtr _dataSource;
     tbb::concurrent_vector<CollectionPtr> _processedCollections;
+    bool _retainProcessedCollections = true;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,76 @@
+//
+// Copyright 2018 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+
+#include "pxr/base/trace/trace.h"
+#include "pxr/base/trace/aggregateTree.h"
+#include "pxr/base/trace/reporter.h"
+
+#include "pxr/base/tf/stringUtils.h"
+
+#include <iostream>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+// Touch enough data to generate some cache and branch traffic.
+static volatile int sink;
+
+static void
+DoWork()
+{
+    TRACE_FUNCTION();
+    int total = 0;
+    for (int i = 0; i < 100000; ++i) {
+        total += (i % 7 == 0) ? i : -i;
+    }
+    sink = total;
+}
+
+static void
+TestPerfCounters()
+{
+    TRACE_FUNCTION();
+    for (int i = 0; i < 10; ++i) {
+        DoWork();
+    }
+}
+
+int
+main(int argc, char* argv[])
+{
+    TraceCollector* collector = &TraceCollector::GetInstance();
+    TraceReporterPtr reporter = TraceReporter::GetGlobalReporter();
+
+    collector->SetEnabled(true);
+    TraceCollector::SetPerfCounterSamplingEnabled(true);
+
+    TestPerfCounters();
+
+    collector->SetEnabled(false);
+    TraceCollector::SetPerfCounterSamplingEnabled(false);
+    reporter->ReportChromeTracing(std::cout);
+    reporter->Report(std::cout);
+
+    // The PMU may legitimately be unavailable (non-Linux platform, kernel
+    // perf_event_paranoid, containers), in which case sampling records
+    // nothing; only verify counter contents when cycles were recorded.
+    const TraceReporter::CounterMap& counters =
+        reporter->GetAggregateTreeRoot()
+            ? reporter->GetCounters() : TraceReporter::CounterMap();
+    TraceReporter::CounterMap::const_iterator it =
+        counters.find(TfToken("PMU cycles"));
+    if (it == counters.end()) {
+        std::cout << "Performance counters unavailable; skipping validation\n";
+        return 0;
+    }
+
+    TF_AXIOM(it->second > 0.0);
+    TF_AXIOM(counters.count(TfToken("PMU cache misses")));
+    TF_AXIOM(counters.count(TfToken("PMU branch misses")));
+    std::cout << "PMU cycles recorded: " << it->second << "\n";
+
+    return 0;
+}
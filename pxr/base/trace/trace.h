@@ -193,6 +193,14 @@ public:
     explicit TraceScopeAuto(const TraceStaticKeyData& key) noexcept
         : _key(&key)
         , _intervalTimer(/*start=*/TraceCollector::IsEnabled()) {
+        if (ARCH_UNLIKELY(TraceCollector::IsPerfCounterSamplingEnabled())
+                && _intervalTimer.IsStarted()) {
+            // Attribute the counters accumulated since the last boundary to
+            // the enclosing scope, then restart the timer so the boundary
+            // sample precedes this scope's interval.
+            TraceCollector::RecordPerfCounterDeltas(TraceCategory::Default);
+            _intervalTimer.Start();
+        }
     }
 
     /// Constructor that also records scope arguments.
@@ -202,6 +210,11 @@ public:
         : _key(&key)
         , _intervalTimer(/*start=*/false) {
         if (TraceCollector::IsEnabled()) {
+            if (ARCH_UNLIKELY(
+                    TraceCollector::IsPerfCounterSamplingEnabled())) {
+                TraceCollector::RecordPerfCounterDeltas(
+                    TraceCategory::Default);
+            }
             _intervalTimer.Start();
             TraceCollector
                 ::GetInstance().ScopeArgs(std::forward<Args>(args)...);
@@ -212,6 +225,14 @@ public:
     ///
     ~TraceScopeAuto() noexcept {
         if (_intervalTimer.IsStarted()) {
+            // Attribute the counters accumulated since the last boundary to
+            // this scope, sampling before the stop time so the counter
+            // events fall inside the recorded interval.
+            if (ARCH_UNLIKELY(
+                    TraceCollector::IsPerfCounterSamplingEnabled())) {
+                TraceCollector::RecordPerfCounterDeltas(
+                    TraceCategory::Default);
+            }
             TraceCollector::TimeStamp stopTicks =
                 _intervalTimer.GetCurrentTicks();
             TraceCollector::Scope(
@@ -135,6 +135,9 @@ void wrapReporter()
             &This::ShouldAdjustForOverheadAndNoise,
             &This::SetShouldAdjustForOverheadAndNoise)
 
+        .add_property("retainFullTraceData",
+            &This::GetRetainFullTraceData, &This::SetRetainFullTraceData)
+
         .add_static_property("globalReporter", &This::GetGlobalReporter)
         ;
 
@@ -278,6 +278,73 @@ Ts_Eval(
     return VtValue();
 }
 
+std::vector<VtValue>
+Ts_EvalMultiple(
+    const TsSpline &val,
+    const std::vector<TsTime> &times, TsSide side,
+    Ts_EvalType evalType)
+{
+    std::vector<VtValue> result;
+    result.reserve(times.size());
+
+    if (val.empty()) {
+        result.resize(times.size());
+        return result;
+    }
+
+    // The eval cache for the segment that contained the previous time, and
+    // the open time interval it covers.  While consecutive times fall
+    // strictly inside the same segment, we reuse the cache rather than
+    // repeating the knot search and the Bezier setup for every time.
+    Ts_UntypedEvalCache::SharedPtr segmentCache;
+    TsTime segmentStart = 0.0, segmentEnd = 0.0;
+
+    TsTime lastTime = -std::numeric_limits<TsTime>::infinity();
+    for (const TsTime time : times) {
+        if (time < lastTime) {
+            TF_CODING_ERROR("Eval times must be sorted in "
+                            "non-decreasing order");
+            result.resize(times.size());
+            return result;
+        }
+        lastTime = time;
+
+        if (segmentCache && time > segmentStart && time < segmentEnd) {
+            result.push_back(evalType == Ts_EvalValue ?
+                segmentCache->Eval(time) :
+                segmentCache->EvalDerivative(time));
+            continue;
+        }
+
+        // Find the segment containing this time.  Times at knots, outside
+        // the knot range, or in segments with special-cased derivatives are
+        // delegated to the single-time path, which handles sides, held
+        // knots, and extrapolation.
+        const auto lbIt = val.lower_bound(time);
+        if (lbIt != val.begin() && lbIt != val.end()
+                && lbIt->GetTime() != time) {
+            const auto prevIt = lbIt - 1;
+            if (evalType == Ts_EvalValue
+                    || !prevIt->IsExtrapolatable()
+                    || prevIt->SupportsTangents()
+                    || prevIt->GetKnotType() != TsKnotLinear) {
+                segmentCache = Ts_UntypedEvalCache::New(*prevIt, *lbIt);
+                segmentStart = prevIt->GetTime();
+                segmentEnd = lbIt->GetTime();
+                result.push_back(evalType == Ts_EvalValue ?
+                    segmentCache->Eval(time) :
+                    segmentCache->EvalDerivative(time));
+                continue;
+            }
+        }
+
+        segmentCache.reset();
+        result.push_back(Ts_Eval(val, time, side, evalType));
+    }
+
+    return result;
+}
+
 // For the routine below, define loose comparisons to account for precision
 // errors.  This epsilon value is always used on the parameter space [0, 1],
 // meaning it has the same effect no matter what the domain and range of the
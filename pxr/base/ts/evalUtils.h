@@ -27,6 +27,15 @@ VtValue Ts_Eval(
     TsTime time, TsSide side,
     Ts_EvalType evalType);
 
+// Evaluate either the value or derivative at each time in the given vector,
+// which must be sorted in non-decreasing order.  Equivalent to calling
+// Ts_Eval for each time, but the knot search and interpolation setup are
+// amortized across consecutive times that fall in the same keyframe segment.
+std::vector<VtValue> Ts_EvalMultiple(
+    const TsSpline &val,
+    const std::vector<TsTime> &times, TsSide side,
+    Ts_EvalType evalType);
+
 // Return piecewise linear samples for a value between two times to within
 // a given tolerance.
 TsSamples Ts_Sample( const TsSpline & val,
@@ -925,6 +925,33 @@ TsSpline::EvalDerivative( TsTime time, TsSide side ) const
     return Ts_Eval(*this, time, side, Ts_EvalDerivative);
 }
 
+std::vector<VtValue>
+TsSpline::EvalMultipleTimes( const std::vector<TsTime> &times,
+                             TsSide side ) const
+{
+    return Ts_EvalMultiple(*this, times, side, Ts_EvalValue);
+}
+
+std::vector<VtValue>
+TsSpline::EvalDerivativeMultipleTimes( const std::vector<TsTime> &times,
+                                       TsSide side ) const
+{
+    return Ts_EvalMultiple(*this, times, side, Ts_EvalDerivative);
+}
+
+// static
+std::vector<VtValue>
+TsSpline::EvalMultipleSplines( const std::vector<TsSpline> &splines,
+                               TsTime time, TsSide side )
+{
+    std::vector<VtValue> result;
+    result.reserve(splines.size());
+    for (const TsSpline &spline : splines) {
+        result.push_back(spline.Eval(time, side));
+    }
+    return result;
+}
+
 bool
 TsSpline::DoSidesDiffer(const TsTime time) const
 {
@@ -393,6 +393,29 @@ public:
     VtValue EvalDerivative(
         TsTime time, TsSide side=TsRight ) const;
 
+    /// Evaluates the value of the spline at each time in \p times, which must
+    /// be sorted in non-decreasing order.  Equivalent to calling Eval() for
+    /// each time, but the knot search and interpolation setup are amortized
+    /// across consecutive times that fall in the same keyframe segment.  If
+    /// there are no keyframes, empty VtValues are returned.
+    TS_API
+    std::vector<VtValue> EvalMultipleTimes(
+        const std::vector<TsTime> &times, TsSide side=TsRight ) const;
+
+    /// Evaluates the derivative of the spline at each time in \p times, which
+    /// must be sorted in non-decreasing order.  Equivalent to calling
+    /// EvalDerivative() for each time; see EvalMultipleTimes().
+    TS_API
+    std::vector<VtValue> EvalDerivativeMultipleTimes(
+        const std::vector<TsTime> &times, TsSide side=TsRight ) const;
+
+    /// Evaluates each spline in \p splines at the given time.  Equivalent to
+    /// calling Eval() on each spline in turn.
+    TS_API
+    static std::vector<VtValue> EvalMultipleSplines(
+        const std::vector<TsSpline> &splines,
+        TsTime time, TsSide side=TsRight );
+
     /// Returns whether the left-side value and the right-side value at the
     /// specified time are different.  This is always false for a time where
     /// there is no keyframe.  For a keyframe time, the sides differ if (1)
@@ -0,0 +1,143 @@
+//
+// Copyright 2023 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+
+#include "pxr/pxr.h"
+#include "pxr/base/ts/keyFrame.h"
+#include "pxr/base/ts/spline.h"
+
+#include "pxr/base/tf/diagnosticLite.h"
+#include "pxr/base/tf/stopwatch.h"
+#include "pxr/base/vt/value.h"
+
+#include <cstdio>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+// Build a spline with a mix of knot types, one knot per unit of time.
+static TsSpline
+_MakeSpline(size_t numKnots)
+{
+    TsSpline spline;
+    for (size_t i = 0; i < numKnots; ++i) {
+        const TsTime time = static_cast<TsTime>(i);
+        const double value = (i % 7) * 0.5 - (i % 3);
+        TsKnotType knotType = TsKnotBezier;
+        if (i % 11 == 5) {
+            knotType = TsKnotLinear;
+        } else if (i % 17 == 9) {
+            knotType = TsKnotHeld;
+        }
+        spline.SetKeyFrame(
+            TsKeyFrame(time, value, knotType,
+                       /* leftTangentSlope = */ 0.3,
+                       /* rightTangentSlope = */ -0.2,
+                       /* leftTangentLength = */ 0.4,
+                       /* rightTangentLength = */ 0.4));
+    }
+    return spline;
+}
+
+// Sorted sample times covering extrapolation regions, knot times, and
+// several samples per segment.
+static std::vector<TsTime>
+_MakeSampleTimes(size_t numKnots, size_t samplesPerKnot)
+{
+    std::vector<TsTime> times;
+    times.reserve((numKnots + 4) * samplesPerKnot);
+    const TsTime start = -2.0;
+    const TsTime end = static_cast<TsTime>(numKnots) + 2.0;
+    const TsTime step = (end - start) / ((numKnots + 4) * samplesPerKnot);
+    for (TsTime t = start; t < end; t += step) {
+        times.push_back(t);
+    }
+    return times;
+}
+
+// Verify that the batched APIs agree exactly with per-call evaluation.
+static void
+TestCorrectness()
+{
+    const TsSpline spline = _MakeSpline(100);
+    const std::vector<TsTime> times = _MakeSampleTimes(100, 8);
+
+    const std::vector<VtValue> values = spline.EvalMultipleTimes(times);
+    const std::vector<VtValue> derivs =
+        spline.EvalDerivativeMultipleTimes(times);
+    TF_AXIOM(values.size() == times.size());
+    TF_AXIOM(derivs.size() == times.size());
+
+    for (size_t i = 0; i < times.size(); ++i) {
+        TF_AXIOM(values[i] == spline.Eval(times[i]));
+        TF_AXIOM(derivs[i] == spline.EvalDerivative(times[i]));
+    }
+
+    // Many splines at one time.
+    std::vector<TsSpline> splines;
+    for (size_t i = 0; i < 10; ++i) {
+        splines.push_back(_MakeSpline(20 + i));
+    }
+    const std::vector<VtValue> perSpline =
+        TsSpline::EvalMultipleSplines(splines, 7.25);
+    TF_AXIOM(perSpline.size() == splines.size());
+    for (size_t i = 0; i < splines.size(); ++i) {
+        TF_AXIOM(perSpline[i] == splines[i].Eval(7.25));
+    }
+
+    // Empty spline yields empty values.
+    const TsSpline empty;
+    const std::vector<VtValue> emptyValues = empty.EvalMultipleTimes(times);
+    TF_AXIOM(emptyValues.size() == times.size());
+    for (const VtValue &v : emptyValues) {
+        TF_AXIOM(v.IsEmpty());
+    }
+}
+
+// Benchmark batched evaluation against the single-time loop.  This is
+// informational; we verify only that the batch path produces output, not
+// timing ratios, to keep the test deterministic on loaded machines.
+static void
+Benchmark()
+{
+    const size_t numKnots = 1000;
+    const size_t samplesPerKnot = 24;
+    const TsSpline spline = _MakeSpline(numKnots);
+    const std::vector<TsTime> times =
+        _MakeSampleTimes(numKnots, samplesPerKnot);
+
+    TfStopwatch perCallTimer;
+    perCallTimer.Start();
+    std::vector<VtValue> perCall;
+    perCall.reserve(times.size());
+    for (const TsTime t : times) {
+        perCall.push_back(spline.Eval(t));
+    }
+    perCallTimer.Stop();
+
+    TfStopwatch batchTimer;
+    batchTimer.Start();
+    const std::vector<VtValue> batch = spline.EvalMultipleTimes(times);
+    batchTimer.Stop();
+
+    TF_AXIOM(batch == perCall);
+
+    printf("Evaluated %zu times on a %zu-knot spline:\n",
+           times.size(), numKnots);
+    printf("  per-call Eval:     %f ms\n",
+           perCallTimer.GetSeconds() * 1000.0);
+    printf("  EvalMultipleTimes: %f ms\n",
+           batchTimer.GetSeconds() * 1000.0);
+}
+
+int main()
+{
+    TestCorrectness();
+    Benchmark();
+
+    printf("Test SUCCEEDED\n");
+    return 0;
+}
@@ -20,6 +20,22 @@ TF_DEFINE_ENV_SETTING(
     "Log a stack trace when a VtArray is copied to detach it from shared "
     "storage, to help track down unintended copies.");
 
+static thread_local VtArrayAllocator *_threadArrayAllocator = nullptr;
+
+VtArrayAllocator *
+VtArraySetThreadAllocator(VtArrayAllocator *allocator)
+{
+    VtArrayAllocator *prev = _threadArrayAllocator;
+    _threadArrayAllocator = allocator;
+    return prev;
+}
+
+VtArrayAllocator *
+VtArrayGetThreadAllocator()
+{
+    return _threadArrayAllocator;
+}
+
 void
 Vt_ArrayBase::_DetachCopyHook(char const *funcName) const
 {
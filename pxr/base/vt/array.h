@@ -54,6 +54,48 @@ protected:
     void (*_detachedFn)(Vt_ArrayForeignDataSource *self);
 };
 
+/// \class VtArrayAllocator
+///
+/// Interface for supplying the storage behind VtArray.
+///
+/// By default VtArray obtains storage from global operator new and
+/// releases it with operator delete.  Clients that create and destroy
+/// large numbers of short-lived arrays (e.g. populating transient
+/// primvar data) can instead install an allocator for the calling thread
+/// with VtArraySetThreadAllocator(), typically backed by a per-thread
+/// arena or pool, to avoid contending on and fragmenting the global heap.
+///
+/// Each storage block records the allocator it was obtained from and is
+/// returned to that allocator when the last array sharing it is
+/// destroyed.  Since arrays are copied by sharing storage and may be
+/// destroyed on any thread, Deallocate() must be safe to call from
+/// threads other than the one that called Allocate(), and the allocator
+/// must outlive every array allocated from it.
+class VtArrayAllocator
+{
+public:
+    virtual ~VtArrayAllocator() = default;
+
+    /// Return a pointer to \p numBytes of storage suitably aligned for any
+    /// scalar value type held by VtArray.
+    virtual void *Allocate(size_t numBytes) = 0;
+
+    /// Release storage previously returned by Allocate().  \p numBytes is
+    /// the size originally requested.
+    virtual void Deallocate(void *ptr, size_t numBytes) = 0;
+};
+
+/// Install \p allocator as the source of VtArray storage allocated by the
+/// calling thread and return the previously installed allocator, or null
+/// if storage came from the global heap.  Pass null to restore the
+/// default.  \sa VtArrayAllocator
+VT_API VtArrayAllocator *VtArraySetThreadAllocator(
+    VtArrayAllocator *allocator);
+
+/// Return the allocator installed for the calling thread, or null if none
+/// is installed.  \sa VtArraySetThreadAllocator
+VT_API VtArrayAllocator *VtArrayGetThreadAllocator();
+
 // Private base class helper for VtArray implementation.
 class Vt_ArrayBase
 {
@@ -85,11 +127,20 @@ protected:
     // immediately preceding the start of the array's _data in memory.  See
     // _GetControlBlock() for details.
     struct _ControlBlock {
-        _ControlBlock() : nativeRefCount(0), capacity(0) {}
-        _ControlBlock(size_t initCount, size_t initCap)
-            : nativeRefCount(initCount), capacity(initCap) {}
+        _ControlBlock() : nativeRefCount(0), capacity(0), allocator(nullptr) {}
+        _ControlBlock(size_t initCount, size_t initCap,
+                      VtArrayAllocator *alloc)
+            : nativeRefCount(initCount), capacity(initCap), allocator(alloc) {}
         mutable std::atomic<size_t> nativeRefCount;
         size_t capacity;
+        // The allocator this block was obtained from, or null if it came
+        // from global operator new.  Blocks are returned to their original
+        // allocator regardless of which thread destroys the last array
+        // sharing them.
+        VtArrayAllocator *allocator;
+        // Padding so the array data following the block keeps the 16-byte
+        // alignment that operator new provides for the block itself.
+        size_t _unused = 0;
     };
     
     _ControlBlock &_GetControlBlock(void *nativeData) {
@@ -779,6 +830,15 @@ class VtArray : public Vt_ArrayBase {
         return data()[index];
     }
 
+    /// Return true if this array's underlying storage refers to memory
+    /// owned by a foreign data source -- for example, a memory-mapped crate
+    /// file -- rather than heap storage allocated by the array itself.
+    /// Such arrays detach to their own copy-on-write heap storage when
+    /// mutated.
+    bool HasForeignDataSource() const {
+        return _foreignSource != nullptr;
+    }
+
     /// Tests if two arrays are identical, i.e. that they share
     /// the same underlying copy-on-write data.  See also operator==().
     bool IsIdentical(VtArray const & other) const {
@@ -866,9 +926,12 @@ class VtArray : public Vt_ArrayBase {
         size_t numBytes = (capacity <= max_size())
             ? sizeof(_ControlBlock) + capacity * sizeof(value_type)
             : std::numeric_limits<size_t>::max();
-        void *data = ::operator new(numBytes);
+        VtArrayAllocator *alloc = VtArrayGetThreadAllocator();
+        void *data = ARCH_LIKELY(!alloc)
+            ? ::operator new(numBytes)
+            : alloc->Allocate(numBytes);
         // Placement-new a control block.
-        ::new (data) _ControlBlock(/*count=*/1, capacity);
+        ::new (data) _ControlBlock(/*count=*/1, capacity, alloc);
         // Data starts after the block.
         return reinterpret_cast<value_type *>(
             static_cast<_ControlBlock *>(data) + 1);
@@ -894,8 +957,19 @@ class VtArray : public Vt_ArrayBase {
                      p != e; ++p) {
                     p->~value_type();
                 }
-                ::operator delete(static_cast<void *>(
-                                      std::addressof(_GetControlBlock(_data))));
+                // Return the block to the allocator it came from, which
+                // need not be the calling thread's current allocator.
+                _ControlBlock &block = _GetControlBlock(_data);
+                VtArrayAllocator *alloc = block.allocator;
+                if (ARCH_LIKELY(!alloc)) {
+                    ::operator delete(static_cast<void *>(&block));
+                }
+                else {
+                    alloc->Deallocate(
+                        static_cast<void *>(&block),
+                        sizeof(_ControlBlock) +
+                        block.capacity * sizeof(value_type));
+                }
             }
         }
         else {
@@ -0,0 +1,130 @@
+//
+// Copyright 2026 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+#ifndef PXR_BASE_VT_EXTRACT_VALUES_H
+#define PXR_BASE_VT_EXTRACT_VALUES_H
+
+#include "pxr/pxr.h"
+
+#include "pxr/base/vt/traits.h"
+#include "pxr/base/vt/types.h"
+#include "pxr/base/vt/value.h"
+
+#include "pxr/base/tf/span.h"
+
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// Return the length of the initial run of values in \p values that all
+/// hold the same type as the first value.  Returns 0 if \p values is
+/// empty.
+///
+/// Bulk consumers (e.g., metadata scans over many specs) can use this to
+/// process homogeneous runs of values with a single type dispatch,
+/// rather than dispatching on the held type of every value.
+inline size_t
+VtGetHomogeneousRunLength(TfSpan<const VtValue> values)
+{
+    if (values.empty()) {
+        return 0;
+    }
+
+    // For "known" value types (those in VT_VALUE_TYPES) comparing the
+    // type index is a cheap integer comparison; fall back to comparing
+    // typeids for other types.
+    const int typeIndex = values.front().GetKnownValueTypeIndex();
+
+    size_t run = 1;
+    if (typeIndex != -1) {
+        while (run < values.size() &&
+               values[run].GetKnownValueTypeIndex() == typeIndex) {
+            ++run;
+        }
+    } else {
+        std::type_info const &typeInfo = values.front().GetTypeid();
+        while (run < values.size() &&
+               TfSafeTypeCompare(values[run].GetTypeid(), typeInfo)) {
+            ++run;
+        }
+    }
+    return run;
+}
+
+/// Extract the objects of type \p T held by \p values, appending them to
+/// \p extracted.  Values holding any other type (or nothing) are skipped.
+/// Returns the number of extracted objects.
+///
+/// If \p indices is not null, the index into \p values of each extracted
+/// object is appended to it, so that callers can correlate the extracted
+/// objects with their source values.
+///
+/// For known value types the per-value type check is a single integer
+/// comparison against the held type's index and the objects are copied
+/// out with VtValue::UncheckedGet, avoiding the error-handling and
+/// conversion machinery of VtValue::Get.  This makes extracting, say,
+/// all doubles or all tokens from a large vector of metadata values
+/// substantially cheaper than per-value IsHolding/Get dispatch.
+template <class T>
+size_t
+VtExtractValues(
+    TfSpan<const VtValue> values,
+    std::vector<T> *extracted,
+    std::vector<size_t> *indices = nullptr)
+{
+    static_assert(VtIsKnownValueType_Workaround<T>::value,
+                  "VtExtractValues only supports known value types "
+                  "(those in VT_VALUE_TYPES)");
+
+    const int typeIndex = VtGetKnownValueTypeIndex<T>();
+
+    size_t numExtracted = 0;
+    for (size_t i = 0; i < values.size(); ++i) {
+        if (values[i].GetKnownValueTypeIndex() == typeIndex) {
+            extracted->push_back(values[i].UncheckedGet<T>());
+            if (indices) {
+                indices->push_back(i);
+            }
+            ++numExtracted;
+        }
+    }
+    return numExtracted;
+}
+
+/// \overload
+///
+/// Extract into a caller-provided span rather than appending to a
+/// vector.  \p extracted must be at least as large as \p values;
+/// extracted objects are written contiguously from the beginning of
+/// \p extracted and the number written is returned.
+template <class T>
+size_t
+VtExtractValues(
+    TfSpan<const VtValue> values,
+    TfSpan<T> extracted)
+{
+    static_assert(VtIsKnownValueType_Workaround<T>::value,
+                  "VtExtractValues only supports known value types "
+                  "(those in VT_VALUE_TYPES)");
+
+    if (!TF_VERIFY(extracted.size() >= values.size())) {
+        return 0;
+    }
+
+    const int typeIndex = VtGetKnownValueTypeIndex<T>();
+
+    size_t numExtracted = 0;
+    for (VtValue const &value : values) {
+        if (value.GetKnownValueTypeIndex() == typeIndex) {
+            extracted[numExtracted++] = value.UncheckedGet<T>();
+        }
+    }
+    return numExtracted;
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // PXR_BASE_VT_EXTRACT_VALUES_H
@@ -8,6 +8,7 @@
 #include "pxr/pxr.h"
 #include "pxr/base/vt/array.h"
 #include "pxr/base/vt/dictionary.h"
+#include "pxr/base/vt/extractValues.h"
 #include "pxr/base/vt/value.h"
 #include "pxr/base/vt/streamOut.h"
 #include "pxr/base/vt/types.h"
@@ -1818,6 +1819,47 @@ testKnownValueTypeIndex()
     TF_AXIOM(!VtIsKnownValueType<TypeNotKnownToVt>());
 }
 
+static void
+testExtractValues()
+{
+    const std::vector<VtValue> values {
+        VtValue(1.0),
+        VtValue(2.0),
+        VtValue(TfToken("a")),
+        VtValue(3.0),
+        VtValue(std::string("str")),
+        VtValue(TfToken("b")),
+        VtValue(),
+    };
+
+    // Homogeneous run detection.
+    TF_AXIOM(VtGetHomogeneousRunLength(TfSpan<const VtValue>()) == 0);
+    TF_AXIOM(VtGetHomogeneousRunLength(values) == 2);
+    TF_AXIOM(VtGetHomogeneousRunLength(
+                 TfSpan<const VtValue>(values).subspan(2)) == 1);
+
+    // Bulk extraction of doubles with source indices.
+    std::vector<double> doubles;
+    std::vector<size_t> indices;
+    TF_AXIOM(VtExtractValues<double>(values, &doubles, &indices) == 3);
+    TF_AXIOM(doubles == (std::vector<double> { 1.0, 2.0, 3.0 }));
+    TF_AXIOM(indices == (std::vector<size_t> { 0, 1, 3 }));
+
+    // Bulk extraction of tokens; floats do not match doubles.
+    std::vector<TfToken> tokens;
+    TF_AXIOM(VtExtractValues<TfToken>(values, &tokens) == 2);
+    TF_AXIOM(tokens ==
+             (std::vector<TfToken> { TfToken("a"), TfToken("b") }));
+
+    std::vector<float> floats;
+    TF_AXIOM(VtExtractValues<float>(values, &floats) == 0);
+
+    // Span-based extraction.
+    std::vector<double> buffer(values.size());
+    TF_AXIOM(VtExtractValues<double>(values, TfSpan<double>(buffer)) == 3);
+    TF_AXIOM(buffer[0] == 1.0 && buffer[1] == 2.0 && buffer[2] == 3.0);
+}
+
 static void testVtCheapToCopy() {
     static_assert(VtValueTypeHasCheapCopy<float>::value, "");
     static_assert(VtValueTypeHasCheapCopy<int>::value, "");
@@ -1846,6 +1888,7 @@ int main(int argc, char *argv[])
     testCombinedVtValueProxies();
 
     testVisitValue();
+    testExtractValues();
     testKnownValueTypeIndex();
     testVtCheapToCopy();
 
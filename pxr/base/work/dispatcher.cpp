@@ -18,6 +18,7 @@ WorkDispatcher::WorkDispatcher()
 #if TBB_INTERFACE_VERSION_MAJOR >= 12
       , _taskGroup(_context)
 #endif
+      , _telemetry("WorkDispatcher")
 {
     _waitCleanupFlag.clear();
     
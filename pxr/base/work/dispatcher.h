@@ -10,6 +10,7 @@
 /// \file work/dispatcher.h
 
 #include "pxr/pxr.h"
+#include "pxr/base/work/telemetry.h"
 #include "pxr/base/work/threadLimits.h"
 #include "pxr/base/work/api.h"
 
@@ -94,7 +95,7 @@ public:
     template <class Callable>
     inline void Run(Callable &&c) {
 #if TBB_INTERFACE_VERSION_MAJOR >= 12
-        _taskGroup.run(_InvokerTask<typename std::remove_reference<Callable>::type>(std::forward<Callable>(c), &_errors));
+        _taskGroup.run(_InvokerTask<typename std::remove_reference<Callable>::type>(std::forward<Callable>(c), &_errors, &_telemetry));
 #else
         _rootTask->spawn(_MakeInvokerTask(std::forward<Callable>(c)));
 #endif
@@ -133,11 +134,13 @@ private:
 #if TBB_INTERFACE_VERSION_MAJOR >= 12
     template <class Fn>
     struct _InvokerTask {
-        explicit _InvokerTask(Fn &&fn, _ErrorTransports *err) 
-            : _fn(std::move(fn)), _errors(err) {}
+        explicit _InvokerTask(Fn &&fn, _ErrorTransports *err,
+                              Work_ParallelTelemetry *telemetry)
+            : _fn(std::move(fn)), _errors(err), _telemetry(telemetry) {}
 
-        explicit _InvokerTask(Fn const &fn, _ErrorTransports *err) 
-            : _fn(fn), _errors(err) {}
+        explicit _InvokerTask(Fn const &fn, _ErrorTransports *err,
+                              Work_ParallelTelemetry *telemetry)
+            : _fn(fn), _errors(err), _telemetry(telemetry) {}
 
         // Ensure only moves happen, no copies.
         _InvokerTask(_InvokerTask &&other) = default;
@@ -145,6 +148,7 @@ private:
         _InvokerTask &operator=(const _InvokerTask &other) = delete;
 
         void operator()() const {
+            _telemetry->RecordTask();
             TfErrorMark m;
             _fn();
             if (!m.IsClean())
@@ -153,17 +157,21 @@ private:
     private:
         Fn _fn;
         _ErrorTransports *_errors;
+        Work_ParallelTelemetry *_telemetry;
     };
 #else
     template <class Fn>
     struct _InvokerTask : public tbb::task {
-        explicit _InvokerTask(Fn &&fn, _ErrorTransports *err)
-            : _fn(std::move(fn)), _errors(err) {}
+        explicit _InvokerTask(Fn &&fn, _ErrorTransports *err,
+                              Work_ParallelTelemetry *telemetry)
+            : _fn(std::move(fn)), _errors(err), _telemetry(telemetry) {}
 
-        explicit _InvokerTask(Fn const &fn, _ErrorTransports *err)
-            : _fn(fn), _errors(err) {}
+        explicit _InvokerTask(Fn const &fn, _ErrorTransports *err,
+                              Work_ParallelTelemetry *telemetry)
+            : _fn(fn), _errors(err), _telemetry(telemetry) {}
 
         virtual tbb::task* execute() {
+            _telemetry->RecordTask();
             TfErrorMark m;
             // In anticipation of OneTBB, ensure that _fn meets OneTBB's
             // requirement that a task's call operator must be const.
@@ -175,15 +183,16 @@ private:
     private:
         Fn _fn;
         _ErrorTransports *_errors;
+        Work_ParallelTelemetry *_telemetry;
     };
 
     // Make an _InvokerTask instance, letting the function template deduce Fn.
     template <class Fn>
     _InvokerTask<typename std::remove_reference<Fn>::type>&
-    _MakeInvokerTask(Fn &&fn) { 
+    _MakeInvokerTask(Fn &&fn) {
         return *new( _rootTask->allocate_additional_child_of(*_rootTask) )
             _InvokerTask<typename std::remove_reference<Fn>::type>(
-                std::forward<Fn>(fn), &_errors);
+                std::forward<Fn>(fn), &_errors, &_telemetry);
     }
 #endif
 
@@ -213,6 +222,10 @@ private:
     // this thread.
     _ErrorTransports _errors;
 
+    // Parallelism telemetry for the dispatcher's tasks, emitted as Trace
+    // counters when the dispatcher is destroyed.
+    Work_ParallelTelemetry _telemetry;
+
     // Concurrent calls to Wait() have to serialize certain cleanup operations.
     std::atomic_flag _waitCleanupFlag;
 };
@@ -0,0 +1,359 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+#ifndef PXR_BASE_WORK_FUTURE_H
+#define PXR_BASE_WORK_FUTURE_H
+
+/// \file work/future.h
+
+#include "pxr/pxr.h"
+#include "pxr/base/work/api.h"
+#include "pxr/base/work/dispatcher.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+template <class T> class WorkFuture;
+
+// Shared state common to all future value types: readiness, blocking waits,
+// and continuations registered by Then() and WorkWhenAll().
+class Work_FutureStateBase
+{
+public:
+    bool IsReady() const {
+        return _ready.load(std::memory_order_acquire);
+    }
+
+    void Wait() const {
+        if (IsReady()) {
+            return;
+        }
+        std::unique_lock<std::mutex> lock(_mutex);
+        _cv.wait(lock, [this]() { return IsReady(); });
+    }
+
+    // Invoke \p fn when this state becomes ready, or immediately if it
+    // already is.  The continuation is invoked on the thread that marks the
+    // state ready; continuations that want concurrency schedule themselves
+    // onto a dispatcher.
+    void AddContinuation(std::function<void ()> &&fn) {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (!IsReady()) {
+                _continuations.push_back(std::move(fn));
+                return;
+            }
+        }
+        fn();
+    }
+
+protected:
+    ~Work_FutureStateBase() = default;
+
+    void _MarkReady() {
+        std::vector<std::function<void ()>> continuations;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _ready.store(true, std::memory_order_release);
+            continuations.swap(_continuations);
+        }
+        _cv.notify_all();
+        for (std::function<void ()> const &fn : continuations) {
+            fn();
+        }
+    }
+
+private:
+    mutable std::mutex _mutex;
+    mutable std::condition_variable _cv;
+    std::atomic<bool> _ready{false};
+    std::vector<std::function<void ()>> _continuations;
+};
+
+// Shared state holding a value of type T.
+template <class T>
+class Work_FutureState : public Work_FutureStateBase
+{
+public:
+    template <class... Args>
+    void Set(Args&&... args) {
+        _value.emplace(std::forward<Args>(args)...);
+        _MarkReady();
+    }
+
+    T const &Get() const {
+        Wait();
+        return *_value;
+    }
+
+private:
+    std::optional<T> _value;
+};
+
+// Shared state for futures that carry no value.
+template <>
+class Work_FutureState<void> : public Work_FutureStateBase
+{
+public:
+    void Set() {
+        _MarkReady();
+    }
+
+    void Get() const {
+        Wait();
+    }
+};
+
+// Grants the free functions below access to a future's shared state.
+struct Work_FutureAccess
+{
+    template <class T>
+    static WorkFuture<T> Create(WorkDispatcher *dispatcher) {
+        WorkFuture<T> future;
+        future._dispatcher = dispatcher;
+        return future;
+    }
+
+    template <class T>
+    static std::shared_ptr<Work_FutureState<T>> const &
+    GetState(WorkFuture<T> const &future) {
+        return future._state;
+    }
+};
+
+// Computes the result type of a continuation: invoked with the preceding
+// future's value, or with no arguments when that future is void.
+template <class T, class Fn>
+struct Work_FutureThenResult
+{
+    using type = std::invoke_result_t<Fn, T const &>;
+};
+
+template <class Fn>
+struct Work_FutureThenResult<void, Fn>
+{
+    using type = std::invoke_result_t<Fn>;
+};
+
+// Invoke \p fn with the (ready) value of \p in and store its result in
+// \p out, handling void inputs and void results.
+template <class U, class Fn, class T>
+void
+Work_InvokeAndSetFutureValue(Work_FutureState<U> &out,
+                             Fn const &fn,
+                             Work_FutureState<T> const &in)
+{
+    auto invoke = [&fn, &in]() -> decltype(auto) {
+        if constexpr (std::is_void_v<T>) {
+            return fn();
+        } else {
+            return fn(in.Get());
+        }
+    };
+    if constexpr (std::is_void_v<U>) {
+        invoke();
+        out.Set();
+    } else {
+        out.Set(invoke());
+    }
+}
+
+/// \class WorkFuture
+///
+/// A handle to the eventual result of a task run by a WorkDispatcher.
+///
+/// Futures are created by WorkRunFuture(), which runs a callable on a
+/// dispatcher and makes the future ready with the callable's return value
+/// when it completes.  A future may be copied; all copies share one result.
+/// The result is retrieved with Get(), which blocks until it is available,
+/// or consumed asynchronously by chaining a continuation with Then().
+///
+/// For example, to overlap loading with independent work and consume the
+/// result without bespoke synchronization:
+///
+/// \code
+/// WorkDispatcher dispatcher;
+/// WorkFuture<SdfLayerRefPtr> layer = WorkRunFuture(dispatcher, OpenLayer);
+/// WorkFuture<void> done = layer.Then(dispatcher, ComposeLayer);
+/// // ... other work ...
+/// dispatcher.Wait();
+/// \endcode
+///
+/// The same rules apply as for WorkDispatcher::Run(): the dispatcher given
+/// to WorkRunFuture() or Then() must outlive the completion of the task,
+/// and Get() or Wait() must not be called from a task run by the same
+/// dispatcher that will produce the value, since that task could then never
+/// complete.  TfErrors raised by tasks are transported to the caller of
+/// WorkDispatcher::Wait(), as with Run().
+///
+/// If the result is not yet available, Wait() and Get() wait on the
+/// associated dispatcher, executing its pending tasks; this guarantees
+/// progress even when concurrency is limited and TBB defers task execution
+/// to waiting threads.  They therefore follow WorkDispatcher::Wait()'s
+/// synchronization rules.
+///
+template <class T>
+class WorkFuture
+{
+public:
+    /// Construct a future with no result yet; used by WorkRunFuture() and
+    /// Then() to create the future they will fulfill.
+    WorkFuture() : _state(std::make_shared<Work_FutureState<T>>()) {}
+
+    /// Returns true if the result is available.
+    bool IsReady() const {
+        return _state->IsReady();
+    }
+
+    /// Block until the result is available, executing pending tasks of the
+    /// associated dispatcher.
+    void Wait() const {
+        if (!_state->IsReady() && _dispatcher) {
+            _dispatcher->Wait();
+        }
+        _state->Wait();
+    }
+
+    /// Block until the result is available, then return it.  Returns a
+    /// reference for non-void T; for WorkFuture<void> this just waits.
+    /// \sa Wait
+    decltype(auto) Get() const {
+        Wait();
+        return _state->Get();
+    }
+
+    /// Run \p fn on \p dispatcher once this future's result is available,
+    /// passing it the result (or no argument for WorkFuture<void>), and
+    /// return a future for \p fn's own result.
+    ///
+    /// If the result is already available, \p fn is scheduled immediately.
+    /// As with Run(), \p dispatcher must outlive the continuation.
+    template <class Fn>
+    WorkFuture<typename Work_FutureThenResult<T, Fn>::type>
+    Then(WorkDispatcher &dispatcher, Fn &&fn) const {
+        using U = typename Work_FutureThenResult<T, Fn>::type;
+        WorkFuture<U> result = Work_FutureAccess::Create<U>(&dispatcher);
+        std::shared_ptr<Work_FutureState<T>> state = _state;
+        std::shared_ptr<Work_FutureState<U>> resultState =
+            Work_FutureAccess::GetState(result);
+        // As with Run(), the callable must be const-invocable; it is moved
+        // onto the dispatcher when the preceding result becomes available.
+        state->AddContinuation(
+            [&dispatcher, state, resultState,
+             fn = std::forward<Fn>(fn)]() mutable {
+                dispatcher.Run(
+                    [state, resultState, fn = std::move(fn)]() {
+                        Work_InvokeAndSetFutureValue(
+                            *resultState, fn, *state);
+                    });
+            });
+        return result;
+    }
+
+private:
+    friend struct Work_FutureAccess;
+
+    std::shared_ptr<Work_FutureState<T>> _state;
+
+    // The dispatcher that runs the task producing this future's value, used
+    // by Wait() to guarantee progress; null for default-constructed futures.
+    WorkDispatcher *_dispatcher = nullptr;
+};
+
+/// Run \p callable on \p dispatcher and return a WorkFuture for its result.
+///
+/// This is the future-returning counterpart of WorkDispatcher::Run(); the
+/// same lifetime and Wait() rules apply.
+/// \relates WorkFuture
+template <class Callable>
+WorkFuture<std::invoke_result_t<std::decay_t<Callable>>>
+WorkRunFuture(WorkDispatcher &dispatcher, Callable &&callable)
+{
+    using T = std::invoke_result_t<std::decay_t<Callable>>;
+    WorkFuture<T> result = Work_FutureAccess::Create<T>(&dispatcher);
+    std::shared_ptr<Work_FutureState<T>> state =
+        Work_FutureAccess::GetState(result);
+    dispatcher.Run(
+        [state, callable = std::forward<Callable>(callable)]() {
+            if constexpr (std::is_void_v<T>) {
+                callable();
+                state->Set();
+            } else {
+                state->Set(callable());
+            }
+        });
+    return result;
+}
+
+// Shared implementation for the WorkWhenAll overloads: make the returned
+// future ready once every one of \p states has become ready.
+inline WorkFuture<void>
+Work_WhenAllImpl(WorkDispatcher &dispatcher,
+                 std::vector<Work_FutureStateBase *> const &states)
+{
+    WorkFuture<void> result = Work_FutureAccess::Create<void>(&dispatcher);
+    std::shared_ptr<Work_FutureState<void>> resultState =
+        Work_FutureAccess::GetState(result);
+    if (states.empty()) {
+        resultState->Set();
+        return result;
+    }
+    std::shared_ptr<std::atomic<size_t>> remaining =
+        std::make_shared<std::atomic<size_t>>(states.size());
+    for (Work_FutureStateBase *state : states) {
+        state->AddContinuation([remaining, resultState]() {
+            if (remaining->fetch_sub(1) == 1) {
+                resultState->Set();
+            }
+        });
+    }
+    return result;
+}
+
+/// Returns a WorkFuture<void> that becomes ready once every future in
+/// \p futures is ready.  The individual results remain retrievable from the
+/// input futures.  An empty vector yields an already-ready future.
+/// \p dispatcher should be the dispatcher running the tasks that produce
+/// the input futures, so that waiting on the returned future makes progress.
+/// \relates WorkFuture
+template <class T>
+WorkFuture<void>
+WorkWhenAll(WorkDispatcher &dispatcher,
+            std::vector<WorkFuture<T>> const &futures)
+{
+    std::vector<Work_FutureStateBase *> states;
+    states.reserve(futures.size());
+    for (WorkFuture<T> const &future : futures) {
+        states.push_back(Work_FutureAccess::GetState(future).get());
+    }
+    return Work_WhenAllImpl(dispatcher, states);
+}
+
+/// Returns a WorkFuture<void> that becomes ready once every one of the
+/// given futures, which may have different value types, is ready.
+/// \sa WorkWhenAll(WorkDispatcher &, std::vector<WorkFuture<T>> const &)
+/// \relates WorkFuture
+template <class... Ts>
+WorkFuture<void>
+WorkWhenAll(WorkDispatcher &dispatcher, WorkFuture<Ts> const &... futures)
+{
+    std::vector<Work_FutureStateBase *> states{
+        Work_FutureAccess::GetState(futures).get()...};
+    return Work_WhenAllImpl(dispatcher, states);
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // PXR_BASE_WORK_FUTURE_H
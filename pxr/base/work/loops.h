@@ -9,14 +9,20 @@
 
 /// \file work/loops.h
 #include "pxr/pxr.h"
+#include "pxr/base/work/telemetry.h"
 #include "pxr/base/work/threadLimits.h"
 #include "pxr/base/work/api.h"
 
+#include "pxr/base/arch/timing.h"
+
 #include <tbb/blocked_range.h>
 #include <tbb/parallel_for.h>
 #include <tbb/parallel_for_each.h>
 #include <tbb/task_group.h>
 
+#include <algorithm>
+#include <cstdint>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -63,29 +69,36 @@ WorkParallelForN(size_t n, Fn &&callback, size_t grainSize)
     // Don't bother with parallel_for, if concurrency is limited to 1.
     if (WorkHasConcurrency()) {
 
-        class Work_ParallelForN_TBB 
+        class Work_ParallelForN_TBB
         {
         public:
-            Work_ParallelForN_TBB(Fn &fn) : _fn(fn) { }
+            Work_ParallelForN_TBB(Fn &fn, Work_ParallelTelemetry *telemetry)
+                : _fn(fn), _telemetry(telemetry) { }
 
             void operator()(const tbb::blocked_range<size_t> &r) const {
+                _telemetry->RecordTask();
                 // Note that we std::forward _fn using Fn in order get the
                 // right operator().
                 // We maintain the right type in this way:
-                //  If Fn is T&, then reference collapsing gives us T& for _fn 
+                //  If Fn is T&, then reference collapsing gives us T& for _fn
                 //  If Fn is T, then std::forward correctly gives us T&& for _fn
                 std::forward<Fn>(_fn)(r.begin(), r.end());
             }
 
         private:
             Fn &_fn;
+            Work_ParallelTelemetry *_telemetry;
         };
 
+        // Emits per-region parallelism counters to the enclosing trace
+        // scope when tracing is active; costs a branch per task otherwise.
+        Work_ParallelTelemetry telemetry("WorkParallelForN", n, grainSize);
+
         // In most cases we do not want to inherit cancellation state from the
         // parent context, so we create an isolated task group context.
         tbb::task_group_context ctx(tbb::task_group_context::isolated);
         tbb::parallel_for(tbb::blocked_range<size_t>(0,n,grainSize),
-            Work_ParallelForN_TBB(callback),
+            Work_ParallelForN_TBB(callback, &telemetry),
             ctx);
 
     } else {
@@ -98,20 +111,69 @@ WorkParallelForN(size_t n, Fn &&callback, size_t grainSize)
 
 ///////////////////////////////////////////////////////////////////////////////
 ///
-/// WorkParallelForN(size_t n, CallbackType callback, size_t grainSize = 1)
+/// WorkParallelForN(size_t n, CallbackType callback)
 ///
-/// Runs \p callback in parallel over the range 0 to n.
+/// Runs \p callback in parallel over the range 0 to n, choosing a grain size
+/// adaptively.
 ///
 /// Callback must be of the form:
 ///
 ///     void LoopCallback(size_t begin, size_t end);
 ///
+/// The first items of the range are run serially to measure the cost of the
+/// callback, and the remainder of the range is partitioned so that each task
+/// amortizes its scheduling overhead while still producing enough tasks to
+/// balance load across threads.  This makes cheap per-item callbacks scale
+/// without per-call-site grain size tuning; callers that know their cost
+/// profile can still pass an explicit grain size to the overload above as a
+/// per-call hint.
 ///
 template <typename Fn>
 void
 WorkParallelForN(size_t n, Fn &&callback)
 {
-    WorkParallelForN(n, std::forward<Fn>(callback), 1);
+    if (n == 0) {
+        return;
+    }
+
+    // If concurrency is limited to 1, execute serially.
+    if (!WorkHasConcurrency()) {
+        WorkSerialForN(n, std::forward<Fn>(callback));
+        return;
+    }
+
+    // Sample the leading items serially to estimate the per-item cost.  The
+    // items have to be processed anyway, so the only overhead here is the
+    // timer query.
+    const size_t numSampled = std::min<size_t>(n, 32);
+    ArchIntervalTimer timer;
+    std::forward<Fn>(callback)(0, numSampled);
+    const int64_t sampleNanos =
+        ArchTicksToNanoseconds(timer.GetElapsedTicks());
+
+    if (numSampled == n) {
+        return;
+    }
+
+    // Aim for tasks that are expensive enough to amortize scheduling
+    // overhead, but produce several tasks per thread so the scheduler can
+    // balance load.
+    constexpr int64_t targetTaskNanos = 50000;
+    const int64_t nanosPerItem =
+        std::max<int64_t>(sampleNanos / numSampled, 1);
+    const size_t remaining = n - numSampled;
+    const size_t maxGrainSize = std::max<size_t>(
+        remaining / (4 * WorkGetConcurrencyLimit()), 1);
+    const size_t grainSize = std::min<size_t>(
+        std::max<int64_t>(targetTaskNanos / nanosPerItem, 1), maxGrainSize);
+
+    WorkParallelForN(
+        remaining,
+        [numSampled, &callback](size_t begin, size_t end) {
+            std::forward<Fn>(callback)(
+                begin + numSampled, end + numSampled);
+        },
+        grainSize);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,116 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+// numa.cpp
+//
+
+#include "pxr/pxr.h"
+#include "pxr/base/work/numa.h"
+#include "pxr/base/work/threadLimits.h"
+
+// Blocked range is not used in this file, but this header happens to pull in
+// the TBB version header in a way that works in all TBB versions.
+#include <tbb/blocked_range.h>
+#include <tbb/task_arena.h>
+
+#if TBB_INTERFACE_VERSION_MAJOR >= 12
+#include <tbb/info.h>
+#endif
+
+#include <memory>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+#if TBB_INTERFACE_VERSION_MAJOR >= 12
+
+// One lazily-initialized arena per NUMA domain, shared by all callers so
+// that repeated WorkRunInNumaNode calls reuse the same pinned worker pool.
+// Deliberately leaked: arenas may still be referenced by worker threads at
+// static destruction time.
+namespace {
+
+struct Work_NumaArenas
+{
+    Work_NumaArenas()
+        : nodeIds(tbb::info::numa_nodes())
+        , arenas(nodeIds.size())
+    {
+        for (size_t i = 0; i != nodeIds.size(); ++i) {
+            arenas[i] = std::make_unique<tbb::task_arena>(
+                tbb::task_arena::constraints(nodeIds[i]));
+        }
+    }
+
+    // When the scheduler has no NUMA topology support (e.g. TBBBIND is
+    // unavailable), numa_nodes() returns a single unconstrained entry, so
+    // this degrades gracefully to the default arena behavior.
+    std::vector<tbb::numa_node_id> nodeIds;
+    std::vector<std::unique_ptr<tbb::task_arena>> arenas;
+};
+
+Work_NumaArenas &
+Work_GetNumaArenas()
+{
+    static Work_NumaArenas &arenas = *new Work_NumaArenas;
+    return arenas;
+}
+
+} // anonymous namespace
+
+unsigned
+WorkGetNumaNodeCount()
+{
+    return Work_GetNumaArenas().arenas.size();
+}
+
+unsigned
+WorkGetNumaNodeConcurrency(unsigned node)
+{
+    Work_NumaArenas &arenas = Work_GetNumaArenas();
+    if (node >= arenas.arenas.size()) {
+        return WorkGetConcurrencyLimit();
+    }
+    return tbb::info::default_concurrency(arenas.nodeIds[node]);
+}
+
+void
+WorkRunInNumaNode(unsigned node, std::function<void()> const &fn)
+{
+    Work_NumaArenas &arenas = Work_GetNumaArenas();
+    if (node >= arenas.arenas.size()) {
+        fn();
+        return;
+    }
+    arenas.arenas[node]->execute(fn);
+}
+
+#else // TBB_INTERFACE_VERSION_MAJOR < 12
+
+// Older TBB has no NUMA topology API; report a single domain and run
+// callables directly in the current arena.
+
+unsigned
+WorkGetNumaNodeCount()
+{
+    return 1;
+}
+
+unsigned
+WorkGetNumaNodeConcurrency(unsigned node)
+{
+    return WorkGetConcurrencyLimit();
+}
+
+void
+WorkRunInNumaNode(unsigned node, std::function<void()> const &fn)
+{
+    fn();
+}
+
+#endif
+
+PXR_NAMESPACE_CLOSE_SCOPE
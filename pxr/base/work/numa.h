@@ -0,0 +1,57 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+#ifndef PXR_BASE_WORK_NUMA_H
+#define PXR_BASE_WORK_NUMA_H
+
+#include "pxr/pxr.h"
+#include "pxr/base/work/api.h"
+
+#include <functional>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// \file work/numa.h
+
+/// Return the number of NUMA locality domains available to the program.
+///
+/// Returns 1 when the platform, the underlying concurrency subsystem, or
+/// the process's affinity mask provides no NUMA topology information, so
+/// callers can always iterate domains [0, count).
+///
+WORK_API unsigned WorkGetNumaNodeCount();
+
+/// Return the maximum concurrency available in the NUMA locality domain
+/// \p node, where \p node is in [0, WorkGetNumaNodeCount()).
+///
+/// Returns WorkGetConcurrencyLimit() when no NUMA topology information is
+/// available or \p node is out of range.
+///
+WORK_API unsigned WorkGetNumaNodeConcurrency(unsigned node);
+
+/// Run \p fn inside a scheduler arena whose worker threads are pinned to
+/// the NUMA locality domain \p node, where \p node is in
+/// [0, WorkGetNumaNodeCount()).
+///
+/// All parallelism spawned from within \p fn (WorkParallelForN, dispatchers,
+/// etc.) executes on threads bound to that domain, so caches and -- under
+/// the common first-touch OS policy -- memory allocated while running stay
+/// node local. This call blocks until \p fn returns.
+///
+/// Callers with large independent workloads (e.g. stage composition) can
+/// partition work across domains by invoking this from one driving thread
+/// per domain.
+///
+/// When NUMA pinning is unavailable (older schedulers, missing topology
+/// support, single-node machines) \p fn simply runs in the default arena,
+/// so this is always safe to call.
+///
+WORK_API void WorkRunInNumaNode(unsigned node,
+                                std::function<void()> const &fn);
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // PXR_BASE_WORK_NUMA_H
@@ -0,0 +1,75 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+#include "pxr/pxr.h"
+#include "pxr/base/work/taskGraph.h"
+
+#include "pxr/base/tf/diagnostic.h"
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+WorkTaskGraph::WorkTaskGraph()
+    : _numCompleted(0)
+{
+}
+
+WorkTaskGraph::~WorkTaskGraph() = default;
+
+void
+WorkTaskGraph::AddDependency(TaskId task, TaskId dependsOn)
+{
+    if (task >= _tasks.size() || dependsOn >= _tasks.size()) {
+        TF_CODING_ERROR("Invalid task id");
+        return;
+    }
+    if (task == dependsOn) {
+        TF_CODING_ERROR("Task %zu cannot depend on itself", task);
+        return;
+    }
+    _tasks[dependsOn].successors.push_back(&_tasks[task]);
+    _tasks[task].numUnfinishedDeps.fetch_add(1, std::memory_order_relaxed);
+}
+
+void
+WorkTaskGraph::RunAndWait()
+{
+    // Schedule every task with no dependencies; each completing task then
+    // schedules the successors it readies, so the dispatcher's work-stealing
+    // scheduler sees new tasks as soon as they become runnable.
+    for (_Task &task : _tasks) {
+        if (task.numUnfinishedDeps.load(std::memory_order_relaxed) == 0) {
+            _dispatcher.Run([this, &task]() { _RunTask(&task); });
+        }
+    }
+    _dispatcher.Wait();
+
+    // Every task that never became ready must lie on a dependency cycle.
+    const size_t numCompleted =
+        _numCompleted.load(std::memory_order_relaxed);
+    if (numCompleted != _tasks.size()) {
+        TF_CODING_ERROR("%zu of %zu tasks did not run because their "
+                        "dependencies form a cycle",
+                        _tasks.size() - numCompleted, _tasks.size());
+    }
+}
+
+void
+WorkTaskGraph::_RunTask(_Task *task)
+{
+    task->fn();
+    _numCompleted.fetch_add(1, std::memory_order_relaxed);
+    for (_Task *successor : task->successors) {
+        // The task that completes the last dependency schedules the
+        // successor.  Acquire/release ordering makes the effects of all of
+        // the successor's dependencies visible to it.
+        if (successor->numUnfinishedDeps.fetch_sub(
+                1, std::memory_order_acq_rel) == 1) {
+            _dispatcher.Run([this, successor]() { _RunTask(successor); });
+        }
+    }
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,114 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+#ifndef PXR_BASE_WORK_TASK_GRAPH_H
+#define PXR_BASE_WORK_TASK_GRAPH_H
+
+/// \file work/taskGraph.h
+
+#include "pxr/pxr.h"
+#include "pxr/base/work/api.h"
+#include "pxr/base/work/dispatcher.h"
+
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <utility>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// \class WorkTaskGraph
+///
+/// A WorkTaskGraph runs a set of tasks related by dependencies, scheduling
+/// each task as soon as all of the tasks it depends on have completed.  This
+/// expresses finer-grained ordering than the fork-join structure provided by
+/// WorkDispatcher: independent tasks in different "phases" of a computation
+/// may overlap, rather than every task in one phase waiting on a barrier for
+/// every task in the previous phase.
+///
+/// Typical use is to add all tasks with AddTask(), declare ordering
+/// constraints between them with AddDependency(), and then invoke
+/// RunAndWait():
+///
+/// \code
+/// WorkTaskGraph graph;
+/// WorkTaskGraph::TaskId load = graph.AddTask(LoadSources);
+/// WorkTaskGraph::TaskId commit = graph.AddTask(CommitResources);
+/// WorkTaskGraph::TaskId draw = graph.AddTask(BuildDrawItems);
+/// graph.AddDependency(commit, load);   // commit runs after load
+/// graph.AddDependency(draw, commit);   // draw runs after commit
+/// graph.RunAndWait();
+/// \endcode
+///
+/// The graph must be fully built before RunAndWait() is invoked; AddTask()
+/// and AddDependency() must not be called concurrently or from within running
+/// tasks.  Dependencies must form a directed acyclic graph: tasks on a
+/// dependency cycle can never become ready and are reported as a coding error
+/// after the remaining tasks complete.  A graph is single-shot; create a new
+/// instance to run another set of tasks.
+///
+class WorkTaskGraph
+{
+public:
+    /// An identifier for a task added to the graph.
+    using TaskId = size_t;
+
+    /// Construct an empty task graph.
+    WORK_API WorkTaskGraph();
+
+    WORK_API ~WorkTaskGraph();
+
+    WorkTaskGraph(WorkTaskGraph const &) = delete;
+    WorkTaskGraph &operator=(WorkTaskGraph const &) = delete;
+
+    /// Add a task invoking \p callable to the graph and return its id.  The
+    /// task initially has no dependencies.
+    template <class Callable>
+    TaskId AddTask(Callable &&callable) {
+        _tasks.emplace_back(std::forward<Callable>(callable));
+        return _tasks.size() - 1;
+    }
+
+    /// Declare that \p task must not run until \p dependsOn has completed.
+    /// Both ids must have been returned by AddTask() on this graph.
+    /// Declaring the same dependency more than once is allowed and has no
+    /// additional effect beyond the first declaration.
+    WORK_API void AddDependency(TaskId task, TaskId dependsOn);
+
+    /// Run all tasks, respecting the declared dependencies, and block until
+    /// they have completed.  Tasks with no dependencies between them may run
+    /// concurrently, with work-stealing execution provided by the underlying
+    /// WorkDispatcher.
+    WORK_API void RunAndWait();
+
+private:
+    struct _Task {
+        template <class Callable>
+        explicit _Task(Callable &&callable)
+            : fn(std::forward<Callable>(callable))
+            , numUnfinishedDeps(0)
+        {}
+
+        std::function<void ()> fn;
+        std::atomic<int> numUnfinishedDeps;
+        std::vector<_Task *> successors;
+    };
+
+    // Invoke the task's function, then schedule any successors for which it
+    // was the last unfinished dependency.
+    void _RunTask(_Task *task);
+
+    // Use a deque so that task addresses remain stable as tasks are added.
+    std::deque<_Task> _tasks;
+    std::atomic<size_t> _numCompleted;
+    WorkDispatcher _dispatcher;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // PXR_BASE_WORK_TASK_GRAPH_H
@@ -0,0 +1,70 @@
+//
+// Copyright 2025 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+
+#include "pxr/pxr.h"
+#include "pxr/base/work/telemetry.h"
+#include "pxr/base/work/threadLimits.h"
+
+#include "pxr/base/trace/collector.h"
+
+#include <string>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+Work_ParallelTelemetry::Work_ParallelTelemetry(
+    char const *regionName, size_t numItems, size_t grainSize)
+    : _regionName(regionName)
+    , _numItems(numItems)
+    , _grainSize(grainSize)
+    , _enabled(TraceCollector::IsEnabled())
+{
+}
+
+Work_ParallelTelemetry::~Work_ParallelTelemetry()
+{
+    if (!_enabled) {
+        return;
+    }
+
+    size_t numTasks = 0, numWorkers = 0;
+    for (const size_t count : _taskCounts) {
+        numTasks += count;
+        ++numWorkers;
+    }
+    if (numTasks == 0) {
+        return;
+    }
+
+    TraceCollector &collector = TraceCollector::GetInstance();
+    const std::string prefix(_regionName);
+
+    collector.RecordCounterDelta(
+        TraceCollector::Key(prefix + " tasks"), double(numTasks));
+    collector.RecordCounterValue(
+        TraceCollector::Key(prefix + " workers"), double(numWorkers));
+    collector.RecordCounterValue(
+        TraceCollector::Key(prefix + " occupancy %"),
+        100.0 * double(numWorkers) / double(WorkGetConcurrencyLimit()));
+
+    // Each worker beyond the first joined the region by stealing work from
+    // another thread; this undercounts repeated steals by the same worker,
+    // which TBB does not expose.
+    collector.RecordCounterDelta(
+        TraceCollector::Key(prefix + " steals (est)"),
+        double(numWorkers - 1));
+
+    if (_numItems != 0) {
+        collector.RecordCounterDelta(
+            TraceCollector::Key(prefix + " items"), double(_numItems));
+    }
+    if (_grainSize != 0) {
+        collector.RecordCounterValue(
+            TraceCollector::Key(prefix + " grain size"), double(_grainSize));
+    }
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,81 @@
+//
+// Copyright 2025 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+#ifndef PXR_BASE_WORK_TELEMETRY_H
+#define PXR_BASE_WORK_TELEMETRY_H
+
+/// \file work/telemetry.h
+
+#include "pxr/pxr.h"
+#include "pxr/base/work/api.h"
+
+#include <tbb/enumerable_thread_specific.h>
+
+#include <cstddef>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// \class Work_ParallelTelemetry
+///
+/// Records parallelism telemetry for a single parallel region and emits it
+/// as Trace counters when destroyed, so the TraceReporter timeline shows
+/// how well the region scaled.  The counters are prefixed with the region
+/// name given at construction and report the number of tasks executed, the
+/// number of worker threads that participated, the percentage of the
+/// concurrency limit those workers represent, an estimate of scheduler
+/// steals (each worker beyond the first joins a region by stealing work
+/// from another thread; TBB does not expose its actual steal counts), and
+/// the grain size and item count when known.
+///
+/// Counters are emitted at the trace scope active when the telemetry object
+/// is destroyed, which for stack-allocated use is the scope that launched
+/// the parallel region.  If tracing is inactive when the telemetry object
+/// is constructed, the per-task cost is a single branch and nothing is
+/// emitted.
+class Work_ParallelTelemetry
+{
+public:
+    /// Begins telemetry for one parallel region.  \p regionName prefixes
+    /// the emitted counter names and must outlive this object; \p numItems
+    /// and \p grainSize are reported when nonzero.
+    WORK_API
+    explicit Work_ParallelTelemetry(
+        char const *regionName, size_t numItems = 0, size_t grainSize = 0);
+
+    /// Emits the accumulated counters at the current trace scope.
+    WORK_API
+    ~Work_ParallelTelemetry();
+
+    Work_ParallelTelemetry(Work_ParallelTelemetry const &) = delete;
+    Work_ParallelTelemetry &operator=(Work_ParallelTelemetry const &) = delete;
+
+    /// Returns true if tracing was active when this object was constructed
+    /// and the region's tasks are being recorded.
+    bool IsEnabled() const { return _enabled; }
+
+    /// Records that the calling thread executed one task for this region.
+    /// Thread-safe; called from within the region's tasks.
+    void RecordTask() {
+        if (_enabled) {
+            ++_taskCounts.local();
+        }
+    }
+
+private:
+    char const *_regionName;
+    size_t _numItems;
+    size_t _grainSize;
+
+    // Per-thread task tallies; the number of populated entries is the
+    // number of distinct workers that participated.
+    tbb::enumerable_thread_specific<size_t> _taskCounts;
+
+    bool _enabled;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // PXR_BASE_WORK_TELEMETRY_H
@@ -0,0 +1,161 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+
+#include "pxr/pxr.h"
+#include "pxr/base/work/future.h"
+#include "pxr/base/work/dispatcher.h"
+#include "pxr/base/work/threadLimits.h"
+
+#include "pxr/base/tf/diagnostic.h"
+
+#include <atomic>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+// Run a value-returning task and retrieve its result with Get().
+static void
+TestRunFuture()
+{
+    WorkDispatcher dispatcher;
+
+    WorkFuture<int> answer = WorkRunFuture(dispatcher, []() {
+        return 42;
+    });
+    TF_AXIOM(answer.Get() == 42);
+
+    std::atomic<bool> ran(false);
+    WorkFuture<void> side = WorkRunFuture(dispatcher, [&ran]() {
+        ran = true;
+    });
+    side.Wait();
+    TF_AXIOM(ran && side.IsReady());
+
+    dispatcher.Wait();
+}
+
+// Chain continuations, including value-to-value, value-to-void, and
+// continuations attached after the result is already available.
+static void
+TestThen()
+{
+    WorkDispatcher dispatcher;
+
+    WorkFuture<int> length =
+        WorkRunFuture(dispatcher, []() {
+            return std::string("overlapped");
+        })
+        .Then(dispatcher, [](std::string const &s) {
+            return s.size();
+        })
+        .Then(dispatcher, [](size_t n) {
+            return static_cast<int>(2 * n);
+        });
+    TF_AXIOM(length.Get() == 20);
+
+    // Attaching to an already-ready future schedules immediately.
+    std::atomic<int> observed(0);
+    WorkFuture<void> done =
+        length.Then(dispatcher, [&observed](int n) {
+            observed = n;
+        });
+    done.Wait();
+    TF_AXIOM(observed == 20);
+
+    dispatcher.Wait();
+}
+
+// Join many homogeneous futures and a heterogeneous set with WorkWhenAll.
+static void
+TestWhenAll()
+{
+    static const size_t numTasks = 100;
+
+    WorkDispatcher dispatcher;
+    std::atomic<size_t> numCompleted(0);
+
+    std::vector<WorkFuture<size_t>> futures;
+    futures.reserve(numTasks);
+    for (size_t i = 0; i != numTasks; ++i) {
+        futures.push_back(WorkRunFuture(dispatcher, [i, &numCompleted]() {
+            ++numCompleted;
+            return i;
+        }));
+    }
+
+    WorkWhenAll(dispatcher, futures).Wait();
+    TF_AXIOM(numCompleted == numTasks);
+    for (size_t i = 0; i != numTasks; ++i) {
+        TF_AXIOM(futures[i].IsReady() && futures[i].Get() == i);
+    }
+
+    // Heterogeneous join.
+    WorkFuture<int> i = WorkRunFuture(dispatcher, []() { return 7; });
+    WorkFuture<std::string> s =
+        WorkRunFuture(dispatcher, []() { return std::string("seven"); });
+    WorkWhenAll(dispatcher, i, s).Wait();
+    TF_AXIOM(i.Get() == 7 && s.Get() == "seven");
+
+    // An empty set is immediately ready.
+    TF_AXIOM(WorkWhenAll(dispatcher, std::vector<WorkFuture<int>>()).IsReady());
+
+    dispatcher.Wait();
+}
+
+// Overlap "I/O" with compute: a producer future feeds a continuation while
+// independent work runs on the same dispatcher.
+static void
+TestOverlap()
+{
+    WorkDispatcher dispatcher;
+    std::atomic<size_t> computeSum(0);
+
+    WorkFuture<std::vector<int>> loaded =
+        WorkRunFuture(dispatcher, []() {
+            return std::vector<int>(1000, 2);
+        });
+    WorkFuture<int> total =
+        loaded.Then(dispatcher, [](std::vector<int> const &data) {
+            int sum = 0;
+            for (int x : data) {
+                sum += x;
+            }
+            return sum;
+        });
+
+    for (size_t i = 0; i != 100; ++i) {
+        dispatcher.Run([&computeSum]() { ++computeSum; });
+    }
+
+    dispatcher.Wait();
+    TF_AXIOM(total.IsReady());
+    TF_AXIOM(total.Get() == 2000);
+    TF_AXIOM(computeSum == 100);
+}
+
+int
+main(int argc, char **argv)
+{
+    WorkSetMaximumConcurrencyLimit();
+
+    printf("Testing WorkRunFuture...\n");
+    TestRunFuture();
+
+    printf("Testing Then chaining...\n");
+    TestThen();
+
+    printf("Testing WorkWhenAll...\n");
+    TestWhenAll();
+
+    printf("Testing overlapping producer/consumer...\n");
+    TestOverlap();
+
+    printf("Done.\n");
+    return 0;
+}
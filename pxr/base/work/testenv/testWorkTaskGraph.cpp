@@ -0,0 +1,134 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+
+#include "pxr/pxr.h"
+#include "pxr/base/work/taskGraph.h"
+#include "pxr/base/work/threadLimits.h"
+
+#include "pxr/base/tf/diagnostic.h"
+
+#include <atomic>
+#include <cstdio>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+// Run a diamond-shaped graph and verify that every dependency completed
+// before its dependents ran.
+static void
+TestDiamond()
+{
+    std::atomic<bool> ranA(false), ranB(false), ranC(false), ranD(false);
+
+    WorkTaskGraph graph;
+    WorkTaskGraph::TaskId a = graph.AddTask([&ranA]() {
+        ranA = true;
+    });
+    WorkTaskGraph::TaskId b = graph.AddTask([&ranA, &ranB]() {
+        TF_AXIOM(ranA);
+        ranB = true;
+    });
+    WorkTaskGraph::TaskId c = graph.AddTask([&ranA, &ranC]() {
+        TF_AXIOM(ranA);
+        ranC = true;
+    });
+    WorkTaskGraph::TaskId d = graph.AddTask([&ranB, &ranC, &ranD]() {
+        TF_AXIOM(ranB && ranC);
+        ranD = true;
+    });
+    graph.AddDependency(b, a);
+    graph.AddDependency(c, a);
+    graph.AddDependency(d, b);
+    graph.AddDependency(d, c);
+    graph.RunAndWait();
+
+    TF_AXIOM(ranA && ranB && ranC && ranD);
+}
+
+// Run a layered graph where each task depends on a few tasks from the
+// previous layer, and verify completion counts as tasks observe them.
+static void
+TestLayers()
+{
+    static const size_t numLayers = 50;
+    static const size_t numTasksPerLayer = 20;
+
+    std::atomic<size_t> numCompleted(0);
+    std::vector<std::atomic<bool>> done(numLayers * numTasksPerLayer);
+    for (std::atomic<bool> &d : done) {
+        d = false;
+    }
+
+    WorkTaskGraph graph;
+    std::vector<WorkTaskGraph::TaskId> prevLayer, curLayer;
+    for (size_t layer = 0; layer < numLayers; ++layer) {
+        curLayer.clear();
+        for (size_t i = 0; i < numTasksPerLayer; ++i) {
+            const size_t index = layer * numTasksPerLayer + i;
+            WorkTaskGraph::TaskId id = graph.AddTask(
+                [&done, &numCompleted, index]() {
+                    done[index] = true;
+                    ++numCompleted;
+                });
+            // Depend on a handful of tasks from the previous layer, and
+            // verify they completed when this task runs.
+            for (size_t j = 0; j < 3 && j < prevLayer.size(); ++j) {
+                const size_t dep = (i + j) % numTasksPerLayer;
+                graph.AddDependency(id, prevLayer[dep]);
+            }
+            curLayer.push_back(id);
+        }
+        prevLayer.swap(curLayer);
+    }
+    graph.RunAndWait();
+
+    TF_AXIOM(numCompleted == numLayers * numTasksPerLayer);
+    for (std::atomic<bool> &d : done) {
+        TF_AXIOM(d);
+    }
+}
+
+// Verify that duplicate dependencies and an empty graph are handled.
+static void
+TestEdgeCases()
+{
+    {
+        WorkTaskGraph graph;
+        graph.RunAndWait();
+    }
+    {
+        std::atomic<bool> ranA(false), ranB(false);
+        WorkTaskGraph graph;
+        WorkTaskGraph::TaskId a = graph.AddTask([&ranA]() { ranA = true; });
+        WorkTaskGraph::TaskId b = graph.AddTask([&ranA, &ranB]() {
+            TF_AXIOM(ranA);
+            ranB = true;
+        });
+        graph.AddDependency(b, a);
+        graph.AddDependency(b, a);
+        graph.RunAndWait();
+        TF_AXIOM(ranA && ranB);
+    }
+}
+
+int
+main(int argc, char **argv)
+{
+    WorkSetMaximumConcurrencyLimit();
+
+    printf("Testing diamond graph...\n");
+    TestDiamond();
+
+    printf("Testing layered graph...\n");
+    TestLayers();
+
+    printf("Testing edge cases...\n");
+    TestEdgeCases();
+
+    printf("Done.\n");
+    return 0;
+}
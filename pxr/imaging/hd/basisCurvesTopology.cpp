@@ -43,6 +43,7 @@ HdBasisCurvesTopology::HdBasisCurvesTopology()
   , _invisiblePoints()
   , _invisibleCurves()
   , _numPoints()
+  , _cachedHash(0)
 {
     HD_PERF_COUNTER_INCR(HdPerfTokens->basisCurvesTopology);
 }
@@ -56,11 +57,29 @@ HdBasisCurvesTopology::HdBasisCurvesTopology(const HdBasisCurvesTopology& src)
   , _curveIndices(src._curveIndices)
   , _invisiblePoints(src._invisiblePoints)
   , _invisibleCurves(src._invisibleCurves)
+  , _cachedHash(src._cachedHash.load(std::memory_order_relaxed))
 {
     HD_PERF_COUNTER_INCR(HdPerfTokens->basisCurvesTopology);
     _numPoints = _ComputeNumPoints(_curveVertexCounts, _curveIndices);
 }
 
+HdBasisCurvesTopology &
+HdBasisCurvesTopology::operator=(const HdBasisCurvesTopology &src)
+{
+    HdTopology::operator=(src);
+    _curveType = src._curveType;
+    _curveBasis = src._curveBasis;
+    _curveWrap = src._curveWrap;
+    _curveVertexCounts = src._curveVertexCounts;
+    _curveIndices = src._curveIndices;
+    _invisiblePoints = src._invisiblePoints;
+    _invisibleCurves = src._invisibleCurves;
+    _numPoints = src._numPoints;
+    _cachedHash.store(src._cachedHash.load(std::memory_order_relaxed),
+                      std::memory_order_relaxed);
+    return *this;
+}
+
 HdBasisCurvesTopology::HdBasisCurvesTopology(const TfToken &curveType,
                                              const TfToken &curveBasis,
                                              const TfToken &curveWrap,
@@ -74,6 +93,7 @@ HdBasisCurvesTopology::HdBasisCurvesTopology(const TfToken &curveType,
   , _curveIndices(curveIndices)
   , _invisiblePoints()
   , _invisibleCurves()
+  , _cachedHash(0)
 {
     if (_curveType != HdTokens->linear && _curveType != HdTokens->cubic){
         TF_WARN("Curve type must be 'linear' or 'cubic'.  Got: '%s'", _curveType.GetText());
@@ -120,7 +140,15 @@ HdBasisCurvesTopology::ComputeHash() const
 {
     HD_TRACE_FUNCTION();
 
-    HdTopology::ID hash = 0;
+    // All hashed fields are fixed at construction, so compute the hash once
+    // and reuse it; hair-heavy scenes hash large vertex-count arrays for
+    // every curve prim otherwise.  Prims sync in parallel, hence the atomic.
+    HdTopology::ID hash = _cachedHash.load(std::memory_order_relaxed);
+    if (hash != 0) {
+        return hash;
+    }
+
+    hash = 0;
     hash = ArchHash64((const char*)&_curveBasis, sizeof(TfToken), hash);
     hash = ArchHash64((const char*)&_curveType, sizeof(TfToken), hash);
     hash = ArchHash64((const char*)&_curveWrap, sizeof(TfToken), hash);
@@ -131,6 +159,7 @@ HdBasisCurvesTopology::ComputeHash() const
     
     // Note: We don't hash topological visibility, because it is treated as a
     // per-prim opinion, and hence, shouldn't break topology sharing.
+    _cachedHash.store(hash, std::memory_order_relaxed);
     return hash;
 }
 
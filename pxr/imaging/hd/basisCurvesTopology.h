@@ -18,6 +18,8 @@
 
 #include "pxr/base/tf/token.h"
 
+#include <atomic>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 /// \class HdBasisCurvesTopology
@@ -63,6 +65,8 @@ public:
     HdBasisCurvesTopology();
     HD_API
     HdBasisCurvesTopology(const HdBasisCurvesTopology &src);
+    HD_API
+    HdBasisCurvesTopology &operator=(const HdBasisCurvesTopology &src);
 
     HD_API
     HdBasisCurvesTopology(const TfToken &curveType,
@@ -154,6 +158,11 @@ private:
     VtIntArray _invisiblePoints;
     VtIntArray _invisibleCurves;
     size_t _numPoints;
+
+    // Cached result of ComputeHash().  The hashed fields are fixed at
+    // construction and prims sync in parallel, hence the atomic; 0 means
+    // not yet computed.
+    mutable std::atomic<ID> _cachedHash;
 };
 
 HD_API
@@ -14,10 +14,16 @@
 #include "pxr/imaging/hd/dirtyBitsTranslator.h"
 #include "pxr/imaging/hd/sceneIndex.h"
 
+#include "pxr/base/arch/demangle.h"
+#include "pxr/base/arch/stackTrace.h"
+#include "pxr/base/arch/symbols.h"
+#include "pxr/base/arch/timing.h"
 #include "pxr/base/tf/debug.h"
+#include "pxr/base/tf/staticTokens.h"
 #include "pxr/base/tf/token.h"
 
 #include <iostream>
+#include <map>
 #include <sstream>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -48,6 +54,10 @@ HdChangeTracker::HdChangeTracker()
     , _rprimRenderTagVersion(1)
     , _taskRenderTagsVersion(1)
     , _emulationSceneIndex(nullptr)
+    , _numInvalidationRecords(0)
+    , _numDroppedInvalidationRecords(0)
+    , _invalidationRecordingStartTicks(0)
+    , _recordInvalidations(false)
 {
     /*NOTHING*/
 }
@@ -58,6 +68,110 @@ HdChangeTracker::~HdChangeTracker()
     HF_MALLOC_TAG_FUNCTION();
 }
 
+TF_DEFINE_PRIVATE_TOKENS(
+    _invalidationKindTokens,
+    (rprim)
+    (sprim)
+    (bprim)
+    (instancer)
+    (allRprims)
+);
+
+void
+HdChangeTracker::SetInvalidationRecordingEnabled(bool enabled,
+                                                size_t capacity)
+{
+    if (enabled) {
+        _invalidationRecords.clear();
+        _invalidationRecords.resize(capacity);
+        _numInvalidationRecords.store(0, std::memory_order_relaxed);
+        _numDroppedInvalidationRecords.store(0, std::memory_order_relaxed);
+        _invalidationRecordingStartTicks = ArchGetTickTime();
+    }
+    _recordInvalidations.store(enabled, std::memory_order_release);
+}
+
+bool
+HdChangeTracker::IsInvalidationRecordingEnabled() const
+{
+    return _recordInvalidations.load(std::memory_order_relaxed);
+}
+
+void
+HdChangeTracker::_RecordInvalidation(SdfPath const& id, TfToken const& kind,
+                                     HdDirtyBits bits)
+{
+    const size_t slot =
+        _numInvalidationRecords.fetch_add(1, std::memory_order_relaxed);
+    if (slot >= _invalidationRecords.size()) {
+        _numDroppedInvalidationRecords.fetch_add(
+            1, std::memory_order_relaxed);
+        return;
+    }
+
+    _RawInvalidationRecord &record = _invalidationRecords[slot];
+    record.primId = id;
+    record.kind = kind;
+    record.dirtyBits = bits;
+    record.ticks = ArchGetTickTime() - _invalidationRecordingStartTicks;
+
+    // Capture the immediate caller of the public Mark*Dirty entry point;
+    // symbolization is deferred to GetInvalidationRecords so the marking
+    // path only pays for the stack probe.
+    uintptr_t frames[1] = { 0 };
+    ArchGetStackFrames(1, /*numFramesToSkipAtTop=*/3, frames);
+    record.callSite = frames[0];
+}
+
+std::vector<HdChangeTracker::InvalidationRecord>
+HdChangeTracker::GetInvalidationRecords() const
+{
+    const size_t numRecords =
+        std::min(_numInvalidationRecords.load(std::memory_order_relaxed),
+                 _invalidationRecords.size());
+
+    // Each distinct call site only needs to be symbolized once.
+    std::map<uintptr_t, std::string> resolvedCallers;
+
+    std::vector<InvalidationRecord> result;
+    result.reserve(numRecords);
+    for (size_t i = 0; i < numRecords; ++i) {
+        _RawInvalidationRecord const &raw = _invalidationRecords[i];
+
+        auto it = resolvedCallers.find(raw.callSite);
+        if (it == resolvedCallers.end()) {
+            std::string symbolName;
+            if (raw.callSite != 0) {
+                ArchGetAddressInfo(
+                    reinterpret_cast<void *>(raw.callSite),
+                    nullptr, nullptr, &symbolName, nullptr);
+            }
+            std::string caller = "<unknown>";
+            if (!symbolName.empty()) {
+                const std::string demangled = ArchGetDemangled(symbolName);
+                caller = demangled.empty() ? symbolName : demangled;
+            }
+            it = resolvedCallers.emplace(
+                raw.callSite, std::move(caller)).first;
+        }
+
+        InvalidationRecord record;
+        record.primId = raw.primId;
+        record.kind = raw.kind;
+        record.dirtyBits = raw.dirtyBits;
+        record.timeNanos = ArchTicksToNanoseconds(raw.ticks);
+        record.caller = it->second;
+        result.push_back(std::move(record));
+    }
+    return result;
+}
+
+size_t
+HdChangeTracker::GetNumDroppedInvalidationRecords() const
+{
+    return _numDroppedInvalidationRecords.load(std::memory_order_relaxed);
+}
+
 void 
 HdChangeTracker::_LogCacheAccess(TfToken const& cacheName, 
                                  SdfPath const& id, 
@@ -75,6 +189,25 @@ HdChangeTracker::RprimInserted(SdfPath const& id, HdDirtyBits initialDirtyState)
 {
     TF_DEBUG(HD_RPRIM_ADDED).Msg("Rprim Added: %s\n", id.GetText());
     _rprimState[id] = initialDirtyState;
+    if (initialDirtyState != HdChangeTracker::Clean) {
+        _dirtyRprimIds.insert(id);
+    }
+
+    ++_sceneStateVersion;
+    ++_rprimIndexVersion;
+}
+
+void
+HdChangeTracker::RprimsInserted(
+    std::vector<std::pair<SdfPath, HdDirtyBits>> const& entries)
+{
+    for (const auto &[id, initialDirtyState] : entries) {
+        TF_DEBUG(HD_RPRIM_ADDED).Msg("Rprim Added: %s\n", id.GetText());
+        _rprimState[id] = initialDirtyState;
+        if (initialDirtyState != HdChangeTracker::Clean) {
+            _dirtyRprimIds.insert(id);
+        }
+    }
 
     ++_sceneStateVersion;
     ++_rprimIndexVersion;
@@ -85,6 +218,7 @@ HdChangeTracker::RprimRemoved(SdfPath const& id)
 {
     TF_DEBUG(HD_RPRIM_REMOVED).Msg("Rprim Removed: %s\n", id.GetText());
     _rprimState.erase(id);
+    _dirtyRprimIds.erase(id);
 
     ++_sceneStateVersion;
     ++_rprimIndexVersion;
@@ -98,6 +232,10 @@ HdChangeTracker::MarkRprimDirty(SdfPath const& id, HdDirtyBits bits)
         return;
     }
 
+    if (ARCH_UNLIKELY(_recordInvalidations.load(std::memory_order_relaxed))) {
+        _RecordInvalidation(id, _invalidationKindTokens->rprim, bits);
+    }
+
     if (_emulationSceneIndex) {
 
         // There's a set of dirty bits that are used as internal signalling
@@ -158,6 +296,7 @@ void HdChangeTracker::_MarkRprimDirty(SdfPath const& id, HdDirtyBits bits)
     // Used to ensure the repr has been created. Don't touch scene state version
     if (bits == HdChangeTracker::InitRepr) {
         it->second |= HdChangeTracker::InitRepr;
+        _dirtyRprimIds.insert(id);
         return;
     }
 
@@ -173,6 +312,7 @@ void HdChangeTracker::_MarkRprimDirty(SdfPath const& id, HdDirtyBits bits)
         ++_varyingStateVersion;
     }
     it->second = oldBits | bits;
+    _dirtyRprimIds.insert(id);
     ++_sceneStateVersion;
 
     if ((bits & DirtyVisibility) != 0) {
@@ -216,6 +356,9 @@ HdChangeTracker::ResetVaryingState()
     TF_FOR_ALL (it, _rprimState) {
         if (IsClean(it->second)) {
             it->second &= ~Varying;
+            if (it->second == HdChangeTracker::Clean) {
+                _dirtyRprimIds.erase(it->first);
+            }
         }
     }
 }
@@ -236,6 +379,9 @@ HdChangeTracker::ResetRprimVaryingState(SdfPath const& id)
     // want to pick up the possible change on the next iteration.
 
     it->second &= ~Varying;
+    if (it->second == HdChangeTracker::Clean) {
+        _dirtyRprimIds.erase(id);
+    }
 }
 
 void
@@ -247,6 +393,9 @@ HdChangeTracker::MarkRprimClean(SdfPath const& id, HdDirtyBits newBits)
         return;
     // preserve the variability bit
     it->second = (it->second & Varying) | newBits;
+    if (it->second == HdChangeTracker::Clean) {
+        _dirtyRprimIds.erase(id);
+    }
 }
 
 void
@@ -466,6 +615,10 @@ HdChangeTracker::MarkInstancerDirty(SdfPath const& id, HdDirtyBits bits)
         return;
     }
 
+    if (ARCH_UNLIKELY(_recordInvalidations.load(std::memory_order_relaxed))) {
+        _RecordInvalidation(id, _invalidationKindTokens->instancer, bits);
+    }
+
     if (_emulationSceneIndex) {
         // We need to dispatch based on prim type.
         HdSceneIndexPrim prim = _emulationSceneIndex->GetPrim(id);
@@ -592,6 +745,10 @@ HdChangeTracker::MarkSprimDirty(SdfPath const& id, HdDirtyBits bits)
         return;
     }
 
+    if (ARCH_UNLIKELY(_recordInvalidations.load(std::memory_order_relaxed))) {
+        _RecordInvalidation(id, _invalidationKindTokens->sprim, bits);
+    }
+
     if (_emulationSceneIndex) {
         // We need to dispatch based on prim type.
         HdSceneIndexPrim prim = _emulationSceneIndex->GetPrim(id);
@@ -689,6 +846,10 @@ HdChangeTracker::MarkBprimDirty(SdfPath const& id, HdDirtyBits bits)
         return;
     }
 
+    if (ARCH_UNLIKELY(_recordInvalidations.load(std::memory_order_relaxed))) {
+        _RecordInvalidation(id, _invalidationKindTokens->bprim, bits);
+    }
+
     if (_emulationSceneIndex) {
         // We need to dispatch based on prim type.
         HdSceneIndexPrim prim = _emulationSceneIndex->GetPrim(id);
@@ -962,6 +1123,11 @@ HdChangeTracker::MarkAllRprimsDirty(HdDirtyBits bits)
         return;
     }
 
+    if (ARCH_UNLIKELY(_recordInvalidations.load(std::memory_order_relaxed))) {
+        _RecordInvalidation(
+            SdfPath::EmptyPath(), _invalidationKindTokens->allRprims, bits);
+    }
+
     if (_emulationSceneIndex) {
         // Since bit -> locator translation is dependent on prim type,
         // we can't do much better than devolving to MarkRprimDirty.
@@ -1006,6 +1172,7 @@ HdChangeTracker::MarkAllRprimsDirty(HdDirtyBits bits)
         // MarkRprim dirty).
         if ((bits & ((~rprimDirtyBits) | DirtyRenderTag | DirtyRepr)) != 0) {
             rprimDirtyBits |= bits;
+            _dirtyRprimIds.insert(it->first);
 
             if ((rprimDirtyBits & HdChangeTracker::Varying) == 0) {
                 rprimDirtyBits |= HdChangeTracker::Varying;
@@ -1068,6 +1235,23 @@ HdChangeTracker::GetRprimDirtyBits(SdfPath const& id) const
     return it->second;// & (~Varying);
 }
 
+SdfPathVector
+HdChangeTracker::GetDirtyRprimIds() const
+{
+    return SdfPathVector(_dirtyRprimIds.begin(), _dirtyRprimIds.end());
+}
+
+SdfPathVector
+HdChangeTracker::GetDirtyRprimIds(SdfPath const& rootPath) const
+{
+    SdfPathVector result;
+    for (SdfPathSet::const_iterator it = _dirtyRprimIds.lower_bound(rootPath);
+         it != _dirtyRprimIds.end() && it->HasPrefix(rootPath); ++it) {
+        result.push_back(*it);
+    }
+    return result;
+}
+
 void 
 HdChangeTracker::AddCollection(TfToken const& collectionName)
 {
@@ -97,6 +97,13 @@ public:
     HD_API
     void RprimInserted(SdfPath const& id, HdDirtyBits initialDirtyState);
 
+    /// Start tracking a batch of Rprims, given as pairs of id and initial
+    /// dirty state.  The scene state and rprim index versions are bumped
+    /// once for the whole batch.
+    HD_API
+    void RprimsInserted(
+        std::vector<std::pair<SdfPath, HdDirtyBits>> const& entries);
+
     /// Stop tracking Rprim with the given \p id.
     HD_API
     void RprimRemoved(SdfPath const& id);
@@ -111,6 +118,24 @@ public:
     HD_API
     HdDirtyBits GetRprimDirtyBits(SdfPath const& id) const;
 
+    /// Returns the ids of all rprims that currently have dirty or varying
+    /// state, in sorted path order.
+    ///
+    /// The ids come from an index that is maintained as rprims are dirtied
+    /// and cleaned, so the cost is proportional to the number of dirty
+    /// rprims rather than the total number of rprims being tracked.
+    HD_API
+    SdfPathVector GetDirtyRprimIds() const;
+
+    /// Returns the ids of the rprims at or below \p rootPath that currently
+    /// have dirty or varying state, in sorted path order.
+    ///
+    /// Since paths sort hierarchically, the dirty rprims in a subtree form a
+    /// contiguous range of the index and can be enumerated in time
+    /// proportional to the number of dirty rprims in that subtree.
+    HD_API
+    SdfPathVector GetDirtyRprimIds(SdfPath const& rootPath) const;
+
     /// Flag the Rprim with the given \p id as being dirty. Multiple calls with
     /// different dirty bits accumulate.
     HD_API
@@ -560,6 +585,56 @@ public:
     static void DumpDirtyBits(HdDirtyBits dirtyBits);
 
     /// @}
+    // ---------------------------------------------------------------------- //
+    /// \name Invalidation Recording
+    /// @{
+    // ---------------------------------------------------------------------- //
+
+    /// A single invalidation captured while recording is enabled; see
+    /// SetInvalidationRecordingEnabled().
+    struct InvalidationRecord {
+        /// Id of the marked prim; empty for MarkAllRprimsDirty.
+        SdfPath primId;
+        /// Kind of marking call: "rprim", "sprim", "bprim", "instancer"
+        /// or "allRprims".
+        TfToken kind;
+        /// The dirty bits the caller requested.
+        HdDirtyBits dirtyBits = 0;
+        /// Time of the marking call in nanoseconds since recording was
+        /// enabled.
+        uint64_t timeNanos = 0;
+        /// Resolved symbol of the marking call site, identifying the
+        /// scene index, adapter or delegate responsible.
+        std::string caller;
+    };
+
+    /// Enable or disable recording of invalidations.  While enabled, every
+    /// public Mark*Dirty call captures the prim, dirty bits, timestamp and
+    /// calling code into a preallocated buffer of \p capacity entries;
+    /// marking calls beyond the capacity are counted but not recorded.
+    /// Enabling resets any previously recorded entries.  Recording adds a
+    /// stack probe to every marking call, so it is intended for diagnosing
+    /// invalidation storms, not for always-on use.
+    HD_API
+    void SetInvalidationRecordingEnabled(bool enabled,
+                                         size_t capacity = 100000);
+
+    /// Returns true if invalidation recording is enabled.
+    HD_API
+    bool IsInvalidationRecordingEnabled() const;
+
+    /// Returns the recorded invalidations, in call order, with the call
+    /// site of each entry resolved to a symbol name.  May be called after
+    /// disabling recording to export a frame's worth of invalidations.
+    HD_API
+    std::vector<InvalidationRecord> GetInvalidationRecords() const;
+
+    /// Returns the number of marking calls that occurred while recording
+    /// but did not fit in the buffer.
+    HD_API
+    size_t GetNumDroppedInvalidationRecords() const;
+
+    /// @}
 
 private:
 
@@ -587,6 +662,12 @@ private:
 
     // Core dirty state.
     _IDStateMap _rprimState;
+
+    // Sorted index of the rprims in _rprimState with any nonzero dirty
+    // state, including the Varying bit.  Because paths sort hierarchically,
+    // the dirty rprims in a subtree form a contiguous range, so dirty prims
+    // can be enumerated without sweeping the full rprim set.
+    SdfPathSet _dirtyRprimIds;
     _IDStateMap _instancerState;
     _IDStateMap _taskState;
     _IDStateMap _sprimState;
@@ -665,6 +746,24 @@ private:
     // HdSceneIndexAdapterSceneDelegate. This prevents dirtying cycles while
     // allowing single HdRenderIndex/HdChangeTracker instances to be used for
     // both ends of emulation.
+    // Invalidation recording state; see SetInvalidationRecordingEnabled().
+    // Records are written lock-free into preallocated slots so concurrent
+    // marking calls only contend on the slot counter.
+    struct _RawInvalidationRecord {
+        SdfPath primId;
+        TfToken kind;
+        HdDirtyBits dirtyBits;
+        uint64_t ticks;
+        uintptr_t callSite;
+    };
+    void _RecordInvalidation(SdfPath const& id, TfToken const& kind,
+                             HdDirtyBits bits);
+    std::vector<_RawInvalidationRecord> _invalidationRecords;
+    std::atomic<size_t> _numInvalidationRecords;
+    std::atomic<size_t> _numDroppedInvalidationRecords;
+    uint64_t _invalidationRecordingStartTicks;
+    std::atomic<bool> _recordInvalidations;
+
     friend class HdSceneIndexAdapterSceneDelegate;
     void _MarkRprimDirty(SdfPath const& id, HdDirtyBits bits=AllDirty);
     void _MarkSprimDirty(SdfPath const& id, HdDirtyBits bits=AllDirty);
@@ -14,6 +14,11 @@
 
 #include "pxr/usd/sdf/pathExpression.h"
 
+#include "pxr/base/work/dispatcher.h"
+#include "pxr/base/work/withScopedParallelism.h"
+
+#include <tbb/concurrent_queue.h>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 namespace {
@@ -36,6 +41,65 @@ _AddAllDescendants(
     }
 }
 
+// Concurrent queue of matching prim paths that worker threads produce.
+using _MatchQueue = tbb::concurrent_queue<SdfPath>;
+
+// Evaluate the expression at `primPath` and farm off subtree traversals to
+// `dispatcher`, honoring the same pruning rules as the serial traversal in
+// PopulateMatches.  Each prim is visited at most once, so `queue` receives
+// unique paths.
+void
+_PopulateMatchesRecursively(
+    WorkDispatcher *dispatcher,
+    const HdCollectionExpressionEvaluator *eval,
+    const HdSceneIndexBaseRefPtr &si,
+    HdCollectionExpressionEvaluator::MatchKind matchKind,
+    SdfPath primPath,
+    _MatchQueue *queue)
+{
+    const SdfPredicateFunctionResult r = eval->Match(primPath);
+
+    const bool matches = r.GetValue();
+    const bool constantOverDescendants = r.IsConstant();
+
+    bool traverseDescendants = true;
+    if (matches) {
+        queue->push(primPath);
+
+        const bool addDescendantPrims =
+            (constantOverDescendants &&
+             matchKind == HdCollectionExpressionEvaluator::MatchAll) ||
+            (matchKind ==
+             HdCollectionExpressionEvaluator::
+                 ShallowestMatchesAndAllDescendants);
+
+        if (addDescendantPrims) {
+            SdfPathVector descendants;
+            _AddAllDescendants(si, primPath, &descendants);
+            for (const SdfPath &path : descendants) {
+                queue->push(path);
+            }
+        }
+
+        traverseDescendants =
+            !addDescendantPrims &&
+            matchKind != HdCollectionExpressionEvaluator::ShallowestMatches;
+    } else {
+        // Result does not match at primPath; prune if it can't match on any
+        // descendant either.
+        traverseDescendants = !constantOverDescendants;
+    }
+
+    if (traverseDescendants) {
+        for (SdfPath childPath : si->GetChildPrimPaths(primPath)) {
+            dispatcher->Run([=]() {
+                _PopulateMatchesRecursively(
+                    dispatcher, eval, si, matchKind, childPath, queue);
+            });
+        }
+    }
+}
+
 } // anon
 
 HdCollectionExpressionEvaluator::HdCollectionExpressionEvaluator(
@@ -108,51 +172,21 @@ HdCollectionExpressionEvaluator::PopulateMatches(
 
     HD_TRACE_FUNCTION();
 
-    // Serial traversal for now. Couple of ways to improve it:
-    // - Use a work queue to farm off subtree traversals.
-    // - Add support for incremental search in the evaluator to make evaluation
-    //   stateful over a subtree. However, this seems tricky if using the
-    //   HdSceneIndexPrim as the domain object for the evaluator since obtaining
-    //   its path isn't straightforward.
-    // 
+    // The expression was compiled into the evaluator at construction, so
+    // evaluation over a subtree is embarrassingly parallel: farm off each
+    // child subtree to a dispatcher and collect matches on a concurrent
+    // queue.  Note that the order of the collected paths is therefore
+    // non-deterministic.
     const HdSceneIndexBaseRefPtr &si = GetSceneIndex();
-    HdSceneIndexPrimView view(si, rootPath);
-
-    for (auto it = view.begin(); it != view.end(); ++it) {
-        const SdfPath &primPath = *it;
-
-        const SdfPredicateFunctionResult r = Match(primPath);
-
-        const bool matches = r.GetValue();
-        const bool constantOverDescendants = r.IsConstant();
-
-        if (matches) {
-            result->push_back(primPath);
-
-            const bool addDescendantPrims =
-                (constantOverDescendants && matchKind == MatchAll) ||
-                (matchKind == ShallowestMatchesAndAllDescendants);
-            
-            if (addDescendantPrims) {
-                _AddAllDescendants(si, primPath, result);
-            }
-
-            const bool skipDescendantTraversal =
-                addDescendantPrims ||
-                (matchKind == ShallowestMatches);
-
-            if (skipDescendantTraversal) {
-                it.SkipDescendants();
-            }
-
-        } else {
-            // Result does not match at primPath ...
-            if (constantOverDescendants) {
-                // ... nor does it on any descendants.
-                it.SkipDescendants();
-            }
-        }
-    }
+    _MatchQueue queue;
+    WorkWithScopedParallelism([&]() {
+        WorkDispatcher dispatcher;
+        _PopulateMatchesRecursively(
+            &dispatcher, this, si, matchKind, rootPath, &queue);
+        dispatcher.Wait();
+    });
+
+    result->insert(result->end(), queue.unsafe_begin(), queue.unsafe_end());
 }
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -87,7 +87,9 @@ public:
     /// An empty evaluator would leave \p result unaffected.
     ///
     /// \note: \p result is guaranteed to have unique paths because a scene
-    ///        index prim is traversed at most once.
+    ///        index prim is traversed at most once.  Subtrees are evaluated
+    ///        in parallel, so the order of the appended paths is not
+    ///        specified.
     ///
     HD_API
     void
@@ -136,7 +138,9 @@ public:
     ///                                      "/a/foobar/bar", "/a/foobar/baz"}
     ///
     /// \note: \p result is guaranteed to have unique paths because a scene
-    ///        index prim is traversed at most once.
+    ///        index prim is traversed at most once.  Subtrees are evaluated
+    ///        in parallel, so the order of the appended paths is not
+    ///        specified.
     ///
     HD_API
     void
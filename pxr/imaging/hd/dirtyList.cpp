@@ -290,21 +290,35 @@ HdDirtyList::_UpdateDirtyIdsIfNeeded()
     // run the predicate filter.  As the include path is root and an empty
     // exclude path, this should hit the filter's fast path.
 
-    static const SdfPathVector includePaths = {SdfPath::AbsoluteRootPath()};
-    static const SdfPathVector excludePaths;
-    const SdfPathVector & rprimPaths = _renderIndex.GetRprimIds();
-
     _DirtyFilterParam filterParam = {&_renderIndex, _trackedRenderTags, mask};
     _dirtyIds.clear();
 
-    HdPrimGather gather;
-    gather.PredicatedFilter(
-        rprimPaths,
-        includePaths,
-        excludePaths,
-        _DirtyRprimIdsFilterPredicate,
-        &filterParam,
-        &_dirtyIds);
+    if (mask == HdChangeTracker::Varying) {
+        // When gathering just the varying prims, enumerate the change
+        // tracker's dirty rprim index instead of sweeping the full rprim
+        // set; the cost is proportional to the number of dirty prims.
+        // The index is sorted by path, matching the gather's ordering.
+        for (const SdfPath &dirtyRprimId :
+                 _GetChangeTracker().GetDirtyRprimIds()) {
+            if (_DirtyRprimIdsFilterPredicate(dirtyRprimId, &filterParam)) {
+                _dirtyIds.push_back(dirtyRprimId);
+            }
+        }
+    } else {
+        static const SdfPathVector includePaths =
+            {SdfPath::AbsoluteRootPath()};
+        static const SdfPathVector excludePaths;
+        const SdfPathVector & rprimPaths = _renderIndex.GetRprimIds();
+
+        HdPrimGather gather;
+        gather.PredicatedFilter(
+            rprimPaths,
+            includePaths,
+            excludePaths,
+            _DirtyRprimIdsFilterPredicate,
+            &filterParam,
+            &_dirtyIds);
+    }
     
     if (TfDebug::IsEnabled(HD_DIRTY_LIST)) {
 
@@ -19,6 +19,9 @@
 #include "pxr/imaging/hd/task.h"
 #include "pxr/imaging/hd/tokens.h"
 
+#include "pxr/base/work/loops.h"
+#include "pxr/base/work/withScopedParallelism.h"
+
 #include <sstream>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -129,10 +132,34 @@ HdEngine::Execute(HdRenderIndex *index, HdTaskSharedPtrVector *tasks)
             "--------------------------------------------------------------\n");
     {
         TRACE_FUNCTION_SCOPE("Task Prepare");
-        for (size_t taskNum = 0; taskNum < numTasks; ++taskNum) {
-            const HdTaskSharedPtr &task = (*tasks)[taskNum];
-
-            task->Prepare(&_taskContext, index);
+        size_t taskNum = 0;
+        while (taskNum < numTasks) {
+            // Gather a run of consecutive tasks which declare their Prepare
+            // free of task context dependencies; within such a run the
+            // serial ordering is not observable, so the tasks can be
+            // prepared concurrently.
+            size_t runEnd = taskNum;
+            while (runEnd < numTasks &&
+                   (*tasks)[runEnd]->IsParallelPrepareSafe()) {
+                ++runEnd;
+            }
+
+            if (runEnd - taskNum > 1) {
+                WorkWithScopedParallelism([&]() {
+                    WorkParallelForN(runEnd - taskNum,
+                        [this, tasks, index, taskNum](
+                            size_t begin, size_t end) {
+                            for (size_t i = begin; i < end; ++i) {
+                                (*tasks)[taskNum + i]->Prepare(
+                                    &_taskContext, index);
+                            }
+                        });
+                });
+                taskNum = runEnd;
+            } else {
+                (*tasks)[taskNum]->Prepare(&_taskContext, index);
+                ++taskNum;
+            }
         }
     }
 
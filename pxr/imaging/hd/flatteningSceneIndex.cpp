@@ -9,7 +9,9 @@
 #include "pxr/imaging/hd/invalidatableContainerDataSource.h"
 #include "pxr/imaging/hd/retainedDataSource.h"
 #include "pxr/base/trace/trace.h"
+#include "pxr/base/work/loops.h"
 #include "pxr/base/work/utils.h"
+#include "pxr/base/work/withScopedParallelism.h"
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -470,34 +472,97 @@ HdFlatteningSceneIndex::_DirtyHierarchy(
     const HdDataSourceLocatorSet &dirtyLocators,
     HdSceneIndexObserver::DirtiedPrimEntries * const dirtyEntries)
 {
+    TRACE_FUNCTION();
+
     // XXX: here and elsewhere, if a parent xform is dirtied and the child has
     // resetXformStack, we could skip dirtying the child...
 
-    auto startEndIt = _prims.FindSubtreeRange(primPath);
-    for (auto it = startEndIt.first; it != startEndIt.second; ) {
-        HdSceneIndexPrim &prim = it->second;
-
-        if (_PrimLevelWrappingDataSourceHandle dataSource =
-                _PrimLevelWrappingDataSource::Cast(prim.dataSource)) {
-            if (dataSource->PrimDirtied(relativeDirtyLocators)) {
-                // If we invalidated any data for any prim besides "primPath"
-                // (which already has a notice), generate a new PrimsDirtied
-                // notice.
-                if (it->first != primPath) {
-                    dirtyEntries->emplace_back(it->first, dirtyLocators);
-                }
-            } else {
+    const auto startEndIt = _prims.FindSubtreeRange(primPath);
+    auto it = startEndIt.first;
+    if (it == startEndIt.second) {
+        return;
+    }
+
+    // Invalidate the subtree root itself first; "primPath" already has a
+    // notice, so it contributes no new dirty entry.
+    if (it->first == primPath) {
+        if (_PrimLevelWrappingDataSourceHandle const dataSource =
+                _PrimLevelWrappingDataSource::Cast(it->second.dataSource)) {
+            if (!dataSource->PrimDirtied(relativeDirtyLocators)) {
                 // If we didn't invalidate any data, we can safely assume that
                 // no downstream prims depended on this prim for their
-                // flattened result, and skip to the next subtree. This is
+                // flattened result, and skip the whole subtree. This is
                 // an important optimization for (e.g.) scene population,
                 // where no data is cached yet...
-                it = it.GetNextSubtree();
-                continue;
+                return;
             }
         }
         ++it;
     }
+
+    // Invalidates all cached prims in [range.first, range.second), pruning
+    // subtrees that provably have no cached flattened data.
+    using _Range = std::pair<_PrimTable::iterator, _PrimTable::iterator>;
+    const auto invalidateSubtree =
+        [&relativeDirtyLocators, &dirtyLocators](
+            const _Range &range,
+            HdSceneIndexObserver::DirtiedPrimEntries * const entries) {
+        for (auto it = range.first; it != range.second; ) {
+            if (_PrimLevelWrappingDataSourceHandle const dataSource =
+                    _PrimLevelWrappingDataSource::Cast(
+                        it->second.dataSource)) {
+                if (dataSource->PrimDirtied(relativeDirtyLocators)) {
+                    entries->emplace_back(it->first, dirtyLocators);
+                } else {
+                    // See comment on the analogous pruning above.
+                    it = it.GetNextSubtree();
+                    continue;
+                }
+            }
+            ++it;
+        }
+    };
+
+    // Partition the descendants into the subtrees rooted at each child so
+    // that invalidating a large dirtied hierarchy - e.g. moving a group of
+    // many prims - sweeps the children in parallel.  Each worker runs the
+    // same pruned serial walk the old single-threaded sweep used.
+    std::vector<_Range> subtrees;
+    while (it != startEndIt.second) {
+        const auto nextIt = it.GetNextSubtree();
+        subtrees.emplace_back(it, nextIt);
+        it = nextIt;
+    }
+
+    if (subtrees.size() <= 1 || !WorkHasConcurrency()) {
+        for (const _Range &subtree : subtrees) {
+            invalidateSubtree(subtree, dirtyEntries);
+        }
+        return;
+    }
+
+    // Collect the dirty entries per subtree and concatenate them in subtree
+    // order afterwards so the notice order stays deterministic.
+    std::vector<HdSceneIndexObserver::DirtiedPrimEntries> subtreeEntries(
+        subtrees.size());
+    WorkWithScopedParallelism([&]() {
+        // Subtree sizes can be wildly unbalanced, so let each subtree be
+        // its own task.
+        WorkParallelForN(
+            subtrees.size(),
+            [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    invalidateSubtree(subtrees[i], &subtreeEntries[i]);
+                }
+            },
+            /*grainSize=*/1);
+    });
+    for (HdSceneIndexObserver::DirtiedPrimEntries &entries : subtreeEntries) {
+        dirtyEntries->insert(
+            dirtyEntries->end(),
+            std::make_move_iterator(entries.begin()),
+            std::make_move_iterator(entries.end()));
+    }
 }
 
 PXR_NAMESPACE_CLOSE_SCOPE
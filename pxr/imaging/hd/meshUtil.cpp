@@ -18,6 +18,9 @@
 #include "pxr/base/gf/vec3d.h"
 #include "pxr/base/gf/vec4d.h"
 
+#include "pxr/base/work/loops.h"
+
+#include <atomic>
 #include <unordered_set>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -217,7 +220,16 @@ void _TriangulateFaceVarying(
     int numFVarValues = 0;
     int holeIndex = 0;
     int numHoleFaces = holeFaces.size();
-    for (int i = 0; i < (int)faceVertexCounts.size(); ++i) {
+    int const numFaces = (int)faceVertexCounts.size();
+
+    // Per-face source and destination offsets for the parallel pass
+    // below. Skipped (degenerate or hole) faces get dst offset -1.
+    std::vector<int> srcOffsets(numFaces);
+    std::vector<int> dstOffsets(numFaces);
+
+    for (int i = 0, v = 0; i < numFaces; ++i) {
+        srcOffsets[i] = v;
+        dstOffsets[i] = -1;
         int nv = faceVertexCounts[i] - 2;
         if (nv < 1) {
             // skip degenerated face
@@ -226,53 +238,57 @@ void _TriangulateFaceVarying(
             // skip hole face
             ++holeIndex;
         } else {
+            dstOffsets[i] = numFVarValues;
             numFVarValues += 3 * nv;
         }
+        v += faceVertexCounts[i];
     }
     if (invalidTopology) {
         TF_WARN("degenerated face found [%s]", id.GetText());
-        invalidTopology = false;
     }
 
     VtArray<T> results(numFVarValues);
-    // reset holeIndex
-    holeIndex = 0;
-
-    int dstIndex = 0;
-    for (int i = 0, v = 0; i < (int)faceVertexCounts.size(); ++i) {
-        int nVerts = faceVertexCounts[i];
+    T * const resultsPtr = results.data();
+    std::atomic<bool> invalidElements(false);
+
+    WorkParallelForN(numFaces, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            // Skip degenerate and hole faces.
+            int dstIndex = dstOffsets[i];
+            if (dstIndex < 0) {
+                continue;
+            }
+            int const v = srcOffsets[i];
+            int const nVerts = faceVertexCounts[i];
 
-        if (nVerts < 3) {
-            // Skip degenerate faces.
-        } else if (holeIndex < numHoleFaces && holeFaces[holeIndex] == i) {
-            // Skip hole faces.
-            ++holeIndex;
-        } else {
             // triangulate.
             // apply same triangulation as index does
             for (int j=0; j < nVerts-2; ++j) {
-                if (!_FanTriangulate(&results[dstIndex],
+                if (!_FanTriangulate(&resultsPtr[dstIndex],
                         source, v, j, numElements, flip)) {
-                    invalidTopology = true;
+                    invalidElements.store(true, std::memory_order_relaxed);
                 }
                 // To keep edge flags consistent, when a face is triangulated
                 // and the topology is flipped we rotate the first and last
                 // triangle indices. See ComputeTriangleIndices.
                 if (nVerts > 3 && flip) {
                     if (j == 0) {
-                        std::swap(results[dstIndex], results[dstIndex+1]);
-                        std::swap(results[dstIndex+1], results[dstIndex+2]);
+                        std::swap(resultsPtr[dstIndex],
+                                  resultsPtr[dstIndex+1]);
+                        std::swap(resultsPtr[dstIndex+1],
+                                  resultsPtr[dstIndex+2]);
                     } else if (j == nVerts-3) {
-                        std::swap(results[dstIndex+1], results[dstIndex+2]);
-                        std::swap(results[dstIndex], results[dstIndex+1]);
+                        std::swap(resultsPtr[dstIndex+1],
+                                  resultsPtr[dstIndex+2]);
+                        std::swap(resultsPtr[dstIndex],
+                                  resultsPtr[dstIndex+1]);
                     }
                 }
                 dstIndex += 3;
             }
         }
-        v += nVerts;
-    }
-    if (invalidTopology) {
+    });
+    if (invalidElements.load()) {
         TF_WARN("numVerts and verts are incosistent [%s]", id.GetText());
     }
 
@@ -793,7 +809,16 @@ _QuadrangulateFaceVarying(SdfPath const& id,
     int numFVarValues = 0;
     int holeIndex = 0;
     int numHoleFaces = holeFaces.size();
-    for (int i = 0; i < (int)faceVertexCounts.size(); ++i) {
+    int const numFaces = (int)faceVertexCounts.size();
+
+    // Per-face source and destination offsets for the parallel pass
+    // below. Skipped (degenerate or hole) faces get dst offset -1.
+    std::vector<int> srcOffsets(numFaces);
+    std::vector<int> dstOffsets(numFaces);
+
+    for (int i = 0, v = 0; i < numFaces; ++i) {
+        srcOffsets[i] = v;
+        dstOffsets[i] = -1;
         int nVerts = faceVertexCounts[i];
         if (nVerts < 3) {
             // skip degenerated face
@@ -802,108 +827,114 @@ _QuadrangulateFaceVarying(SdfPath const& id,
             // skip hole face
             ++holeIndex;
         } else if (nVerts == 4) {
+            dstOffsets[i] = numFVarValues;
             numFVarValues += 4;
         } else {
+            dstOffsets[i] = numFVarValues;
             numFVarValues += 4 * nVerts;
         }
+        v += nVerts;
     }
     if (invalidTopology) {
         TF_WARN("degenerated face found [%s]", id.GetText());
-        invalidTopology = false;
     }
 
     VtArray<T> results(numFVarValues);
-    // reset holeIndex
-    holeIndex = 0;
-
-    int dstIndex = 0;
-    for (int i = 0, v = 0; i < (int)faceVertexCounts.size(); ++i) {
-        int nVerts = faceVertexCounts[i];
-        if (nVerts < 3) {
-            // skip degenerated faces.
-        } else if (holeIndex < numHoleFaces && holeFaces[holeIndex] == i) {
-            // skip hole faces.
-            ++holeIndex;
-        } else if (nVerts == 4) {
-            // copy
-            if (v+nVerts > numElements) {
-                invalidTopology = true;
-                results[dstIndex++] = T(0);
-                results[dstIndex++] = T(0);
-                results[dstIndex++] = T(0);
-                results[dstIndex++] = T(0);
-            } else {
-                results[dstIndex++] = source[v];
-                if (flip) {
-                    results[dstIndex++] = source[v+3]; 
-                    results[dstIndex++] = source[v+2]; 
-                    results[dstIndex++] = source[v+1]; 
+    T * const resultsPtr = results.data();
+    std::atomic<bool> invalidElements(false);
+
+    WorkParallelForN(numFaces, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            // Skip degenerate and hole faces.
+            int dstIndex = dstOffsets[i];
+            if (dstIndex < 0) {
+                continue;
+            }
+            int const v = srcOffsets[i];
+            int const nVerts = faceVertexCounts[i];
+
+            if (nVerts == 4) {
+                // copy
+                if (v+nVerts > numElements) {
+                    invalidElements.store(true, std::memory_order_relaxed);
+                    resultsPtr[dstIndex++] = T(0);
+                    resultsPtr[dstIndex++] = T(0);
+                    resultsPtr[dstIndex++] = T(0);
+                    resultsPtr[dstIndex++] = T(0);
                 } else {
-                    results[dstIndex++] = source[v+1]; 
-                    results[dstIndex++] = source[v+2]; 
-                    results[dstIndex++] = source[v+3]; 
+                    resultsPtr[dstIndex++] = source[v];
+                    if (flip) {
+                        resultsPtr[dstIndex++] = source[v+3];
+                        resultsPtr[dstIndex++] = source[v+2];
+                        resultsPtr[dstIndex++] = source[v+1];
+                    } else {
+                        resultsPtr[dstIndex++] = source[v+1];
+                        resultsPtr[dstIndex++] = source[v+2];
+                        resultsPtr[dstIndex++] = source[v+3];
+                    }
+                }
+            } else {
+                // quadrangulate
+                // compute the center first
+
+                // early out if overrunning
+                if (v+nVerts > numElements) {
+                    invalidElements.store(true, std::memory_order_relaxed);
+                    for (int j = 0; j < nVerts; ++j) {
+                        resultsPtr[dstIndex++] = T(0);
+                        resultsPtr[dstIndex++] = T(0);
+                        resultsPtr[dstIndex++] = T(0);
+                        resultsPtr[dstIndex++] = T(0);
+                    }
+                    continue;
                 }
-            }
-        } else {
-            // quadrangulate
-            // compute the center first
 
-            // early out if overrunning
-            if (v+nVerts > numElements) {
-                invalidTopology = true;
+                T center(0);
                 for (int j = 0; j < nVerts; ++j) {
-                    results[dstIndex++] = T(0);
-                    results[dstIndex++] = T(0);
-                    results[dstIndex++] = T(0);
-                    results[dstIndex++] = T(0);
+                    center += source[v+j];
                 }
-                continue;
-            } 
-
-            T center(0);
-            for (int j = 0; j < nVerts; ++j) {
-                center += source[v+j];
-            }
-            center /= nVerts;
+                center /= nVerts;
 
-            // mid edges
-            T e0 = (source[v] + source[v+1]) * 0.5;
-            T e1 = (source[v] + source[v+(nVerts-1)%nVerts]) * 0.5;
+                // mid edges
+                T e0 = (source[v] + source[v+1]) * 0.5;
+                T e1 = (source[v] + source[v+(nVerts-1)%nVerts]) * 0.5;
 
-            results[dstIndex++] = source[v];
-            if (flip) {
-                results[dstIndex++] = e1; 
-                results[dstIndex++] = center; 
-                results[dstIndex++] = e0; 
-
-                for (int j = nVerts - 1; j > 0; --j) {
-                    e0 = (source[v+j] + source[v+(j+1)%nVerts]) * 0.5;
-                    e1 = (source[v+j] + source[v+(j+nVerts-1)%nVerts]) * 0.5;
-
-                    results[dstIndex++] = source[v+j];
-                    results[dstIndex++] = e1; 
-                    results[dstIndex++] = center; 
-                    results[dstIndex++] = e0; 
-                }
-            } else {
-                results[dstIndex++] = e0; 
-                results[dstIndex++] = center;
-                results[dstIndex++] = e1; 
-
-                for (int j = 1; j < nVerts; ++j) {
-                    e0 = (source[v+j] + source[v+(j+1)%nVerts]) * 0.5;
-                    e1 = (source[v+j] + source[v+(j+nVerts-1)%nVerts]) * 0.5;
-
-                    results[dstIndex++] = source[v+j];
-                    results[dstIndex++] = e0; 
-                    results[dstIndex++] = center;
-                    results[dstIndex++] = e1; 
+                resultsPtr[dstIndex++] = source[v];
+                if (flip) {
+                    resultsPtr[dstIndex++] = e1;
+                    resultsPtr[dstIndex++] = center;
+                    resultsPtr[dstIndex++] = e0;
+
+                    for (int j = nVerts - 1; j > 0; --j) {
+                        e0 = (source[v+j] + source[v+(j+1)%nVerts]) * 0.5;
+                        e1 = (source[v+j] +
+                              source[v+(j+nVerts-1)%nVerts]) * 0.5;
+
+                        resultsPtr[dstIndex++] = source[v+j];
+                        resultsPtr[dstIndex++] = e1;
+                        resultsPtr[dstIndex++] = center;
+                        resultsPtr[dstIndex++] = e0;
+                    }
+                } else {
+                    resultsPtr[dstIndex++] = e0;
+                    resultsPtr[dstIndex++] = center;
+                    resultsPtr[dstIndex++] = e1;
+
+                    for (int j = 1; j < nVerts; ++j) {
+                        e0 = (source[v+j] + source[v+(j+1)%nVerts]) * 0.5;
+                        e1 = (source[v+j] +
+                              source[v+(j+nVerts-1)%nVerts]) * 0.5;
+
+                        resultsPtr[dstIndex++] = source[v+j];
+                        resultsPtr[dstIndex++] = e0;
+                        resultsPtr[dstIndex++] = center;
+                        resultsPtr[dstIndex++] = e1;
+                    }
                 }
             }
         }
-        v += nVerts;
-    }
-    if (invalidTopology) {
+    });
+    if (invalidElements.load()) {
         TF_WARN("numVerts and verts are incosistent [%s]", id.GetText());
     }
 
@@ -12,6 +12,48 @@ PXR_NAMESPACE_OPEN_SCOPE
 
 HdNoticeBatchingSceneIndex::_BatchEntry::~_BatchEntry() = default;
 
+void
+HdNoticeBatchingSceneIndex::_PrimsAddedBatchEntry::Insert(
+    const HdSceneIndexObserver::AddedPrimEntries &newEntries)
+{
+    for (const HdSceneIndexObserver::AddedPrimEntry &entry : newEntries) {
+        const auto [it, inserted] =
+            entryIndices.emplace(entry.primPath, entries.size());
+        if (inserted) {
+            entries.push_back(entry);
+        } else {
+            // A repeated added entry is a resync; the latest type wins.
+            entries[it->second].primType = entry.primType;
+        }
+    }
+}
+
+void
+HdNoticeBatchingSceneIndex::_PrimsRemovedBatchEntry::Insert(
+    const HdSceneIndexObserver::RemovedPrimEntries &newEntries)
+{
+    for (const HdSceneIndexObserver::RemovedPrimEntry &entry : newEntries) {
+        if (queuedPaths.insert(entry.primPath).second) {
+            entries.push_back(entry);
+        }
+    }
+}
+
+void
+HdNoticeBatchingSceneIndex::_PrimsDirtiedBatchEntry::Insert(
+    const HdSceneIndexObserver::DirtiedPrimEntries &newEntries)
+{
+    for (const HdSceneIndexObserver::DirtiedPrimEntry &entry : newEntries) {
+        const auto [it, inserted] =
+            entryIndices.emplace(entry.primPath, entries.size());
+        if (inserted) {
+            entries.push_back(entry);
+        } else {
+            entries[it->second].dirtyLocators.insert(entry.dirtyLocators);
+        }
+    }
+}
+
 HdNoticeBatchingSceneIndex::HdNoticeBatchingSceneIndex(
     const HdSceneIndexBaseRefPtr &inputScene)
 : HdSingleInputFilteringSceneIndexBase(inputScene)
@@ -44,15 +86,14 @@ HdNoticeBatchingSceneIndex::_PrimsAdded(
             if (_PrimsAddedBatchEntry *batchEntry =
                     dynamic_cast<_PrimsAddedBatchEntry*>(
                         _batches.back().get())) {
-                batchEntry->entries.insert(
-                    batchEntry->entries.end(), entries.begin(), entries.end());
+                batchEntry->Insert(entries);
                 return;
             }
         }
 
         _PrimsAddedBatchEntry *batchEntry = new _PrimsAddedBatchEntry;
         _batches.emplace_back(batchEntry);
-         batchEntry->entries = entries;
+        batchEntry->Insert(entries);
 
     } else {
         _SendPrimsAdded(entries);
@@ -71,15 +112,14 @@ HdNoticeBatchingSceneIndex::_PrimsRemoved(
             if (_PrimsRemovedBatchEntry *batchEntry =
                     dynamic_cast<_PrimsRemovedBatchEntry*>(
                         _batches.back().get())) {
-                batchEntry->entries.insert(
-                    batchEntry->entries.end(), entries.begin(), entries.end());
+                batchEntry->Insert(entries);
                 return;
             }
         }
 
         _PrimsRemovedBatchEntry *batchEntry = new _PrimsRemovedBatchEntry;
         _batches.emplace_back(batchEntry);
-         batchEntry->entries = entries;
+        batchEntry->Insert(entries);
 
     } else {
         _SendPrimsRemoved(entries);
@@ -98,15 +138,14 @@ HdNoticeBatchingSceneIndex::_PrimsDirtied(
             if (_PrimsDirtiedBatchEntry *batchEntry =
                     dynamic_cast<_PrimsDirtiedBatchEntry*>(
                         _batches.back().get())) {
-                batchEntry->entries.insert(
-                    batchEntry->entries.end(), entries.begin(), entries.end());
+                batchEntry->Insert(entries);
                 return;
             }
         }
 
         _PrimsDirtiedBatchEntry *batchEntry = new _PrimsDirtiedBatchEntry;
         _batches.emplace_back(batchEntry);
-         batchEntry->entries = entries;
+        batchEntry->Insert(entries);
 
     } else {
         _SendPrimsDirtied(entries);
@@ -9,6 +9,9 @@
 
 #include "pxr/imaging/hd/filteringSceneIndex.h"
 
+#include <unordered_map>
+#include <unordered_set>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 class HdNoticeBatchingSceneIndex;
@@ -37,9 +40,12 @@ public:
     bool IsBatchingEnabled() const;
 
     /// Once batching is enabled, observed notices are queued in contiguious
-    /// blocks by notice type. Disabling batching immediately forwards and
-    /// flushes any queued batches. Batching state is not currently tracked in
-    /// a nested manner.
+    /// blocks by notice type. Within a block, redundant entries are coalesced:
+    /// dirtied entries for the same prim merge their locator sets, repeated
+    /// added entries for the same prim collapse to the latest one and exact
+    /// duplicate removed entries are dropped. Disabling batching immediately
+    /// forwards and flushes any queued batches. Batching state is not
+    /// currently tracked in a nested manner.
     void SetBatchingEnabled(bool enabled);
     
     /// Forwards any queued notices accumuated while batching state is enabled.
@@ -71,17 +77,29 @@ protected:
 
     struct _PrimsAddedBatchEntry : public _BatchEntry
     {
+        void Insert(const HdSceneIndexObserver::AddedPrimEntries &entries);
+
         HdSceneIndexObserver::AddedPrimEntries entries;
+        // Index of each path's entry, used to coalesce repeated entries.
+        std::unordered_map<SdfPath, size_t, SdfPath::Hash> entryIndices;
     };
 
     struct _PrimsRemovedBatchEntry : public _BatchEntry
     {
+        void Insert(const HdSceneIndexObserver::RemovedPrimEntries &entries);
+
         HdSceneIndexObserver::RemovedPrimEntries entries;
+        // Paths already queued, used to drop duplicate entries.
+        std::unordered_set<SdfPath, SdfPath::Hash> queuedPaths;
     };
 
     struct _PrimsDirtiedBatchEntry : public _BatchEntry
     {
+        void Insert(const HdSceneIndexObserver::DirtiedPrimEntries &entries);
+
         HdSceneIndexObserver::DirtiedPrimEntries entries;
+        // Index of each path's entry, used to coalesce repeated entries.
+        std::unordered_map<SdfPath, size_t, SdfPath::Hash> entryIndices;
     };
 
     bool _batchingEnabled;
@@ -383,15 +383,43 @@ Hd_PrimTypeIndex<PrimType>::SyncPrims(HdChangeTracker  &tracker,
 
     _dirtyPrimDelegates.clear();
     HdSceneDelegate *prevDelegate = nullptr;
+
+    _ParallelSyncHelper<PrimType> psyncHelper{
+        {}, renderParam, &tracker,
+        Hd_PrimTypeIndex<PrimType>::_TrackerMarkPrimClean};
+
+    auto flushParallelSync = [&psyncHelper]() {
+        if (psyncHelper.syncVector.empty()) {
+            return;
+        }
+        WorkWithScopedParallelism([&]()
+        {
+            WorkParallelForN(psyncHelper.syncVector.size(),
+                             std::bind(&_ParallelSyncHelper<PrimType>::Sync,
+                                       &psyncHelper,
+                                       std::placeholders::_1,
+                                       std::placeholders::_2));
+        });
+        psyncHelper.syncVector.clear();
+    };
+
     for (size_t typeIdx = 0; typeIdx < numTypes; ++typeIdx) {
 
         const bool parallelSyncEnabled =
             renderDelegate->IsParallelSyncEnabled(_primTypeNames[typeIdx]);
         _PrimTypeEntry &typeEntry =  _entries[typeIdx];
-        _ParallelSyncHelper<PrimType> psyncHelper{
-            {}, renderParam, &tracker,
-            Hd_PrimTypeIndex<PrimType>::_TrackerMarkPrimClean};
-        psyncHelper.syncVector.reserve(typeEntry.primMap.size());
+
+        // Prims of consecutive parallel-enabled types accumulate into a
+        // single parallel region so they sync concurrently rather than in
+        // per-type regions separated by barriers.  A type without parallel
+        // sync forces the accumulated work to complete first, preserving the
+        // type-ordering guarantee for delegates that rely on it.
+        if (!parallelSyncEnabled) {
+            flushParallelSync();
+        } else {
+            psyncHelper.syncVector.reserve(
+                psyncHelper.syncVector.size() + typeEntry.primMap.size());
+        }
 
         // Populate data for parallel sync and update dirty prim delegates
         for (auto primIt  = typeEntry.primMap.begin();
@@ -417,18 +445,9 @@ Hd_PrimTypeIndex<PrimType>::SyncPrims(HdChangeTracker  &tracker,
                 }
             }
         }
-
-        if (!psyncHelper.syncVector.empty()) {
-            WorkWithScopedParallelism([&]()
-            {        
-                WorkParallelForN(psyncHelper.syncVector.size(),
-                                 std::bind(&_ParallelSyncHelper<PrimType>::Sync,
-                                           &psyncHelper,
-                                           std::placeholders::_1,
-                                           std::placeholders::_2));
-            });
-        }        
     }
+
+    flushParallelSync();
 }
 
 template <class PrimType>
@@ -225,6 +225,11 @@ bool HdRenderDelegate::IsParallelSyncEnabled(
     return false;
 }
 
+bool HdRenderDelegate::IsParallelRprimCreationEnabled() const
+{
+    return false;
+}
+
 bool
 HdRenderDelegate::Resume()
 {
@@ -510,6 +510,13 @@ public:
     HD_API
     virtual bool IsParallelSyncEnabled(const TfToken &primType) const;
 
+    /// Whether CreateRprim may be called concurrently from multiple
+    /// threads during bulk insertion (see HdRenderIndex::InsertRprims).
+    /// The default is false; delegates whose rprim constructors are
+    /// thread-safe can override this to speed up initial population.
+    HD_API
+    virtual bool IsParallelRprimCreationEnabled() const;
+
 protected:
     /// This class must be derived from.
     HD_API
@@ -35,8 +35,10 @@
 
 #include "pxr/base/work/dispatcher.h"
 #include "pxr/base/work/loops.h"
+#include "pxr/base/work/taskGraph.h"
 #include "pxr/base/work/withScopedParallelism.h"
 #include "pxr/base/tf/envSetting.h"
+#include "pxr/base/tf/hash.h"
 #include "pxr/base/tf/pyLock.h"
 
 #include "pxr/base/arch/vsnprintf.h"
@@ -339,7 +341,104 @@ HdRenderIndex::_InsertRprim(TfToken const& typeId,
     _rprimMap[rprimId] = std::move(info);
 }
 
-void 
+void
+HdRenderIndex::InsertRprims(HdSceneDelegate* sceneDelegate,
+                            RprimEntryVector const& entries)
+{
+    HD_TRACE_FUNCTION();
+    HF_MALLOC_TAG_FUNCTION();
+
+    // If we are using emulation, we will need to populate
+    // a data source with the prim information
+    if (_IsEnabledSceneIndexEmulation()) {
+        for (RprimEntry const& entry : entries) {
+            _emulationSceneIndex->AddLegacyPrim(
+                entry.rprimId, entry.typeId, sceneDelegate);
+        }
+        return;
+    }
+
+    _InsertRprims(sceneDelegate, entries);
+}
+
+void
+HdRenderIndex::_InsertRprims(HdSceneDelegate* sceneDelegate,
+                             RprimEntryVector const& entries)
+{
+    HD_TRACE_FUNCTION();
+    HF_MALLOC_TAG_FUNCTION();
+
+    SdfPath const &sceneDelegateId = sceneDelegate->GetDelegateID();
+
+    // Validate and construct the rprims.  The map and tracker are only read
+    // here, so creation can run in parallel when the render delegate
+    // declares its rprim constructors thread-safe.
+    std::vector<HdRprim *> rprims(entries.size(), nullptr);
+    const auto createFn = [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            RprimEntry const &entry = entries[i];
+            if (ARCH_UNLIKELY(TfMapLookupPtr(_rprimMap, entry.rprimId))) {
+                continue;
+            }
+            if (!entry.rprimId.HasPrefix(sceneDelegateId)) {
+                TF_CODING_ERROR(
+                    "Scene Delegate Id (%s) must prefix prim Id (%s)",
+                    sceneDelegateId.GetText(), entry.rprimId.GetText());
+                continue;
+            }
+            rprims[i] = _renderDelegate->CreateRprim(
+                entry.typeId, entry.rprimId);
+        }
+    };
+
+    if (entries.size() > 1 &&
+        _renderDelegate->IsParallelRprimCreationEnabled() &&
+        WorkHasConcurrency()) {
+        WorkWithScopedParallelism([&]() {
+            WorkParallelForN(entries.size(), createFn);
+        });
+    } else {
+        createFn(0, entries.size());
+    }
+
+    // Register the new rprims, deferring the change tracker's version bumps
+    // to a single batched update.
+    std::vector<std::pair<SdfPath, HdDirtyBits>> trackerEntries;
+    trackerEntries.reserve(entries.size());
+    for (size_t i = 0; i < entries.size(); ++i) {
+        HdRprim * const rprim = rprims[i];
+        if (rprim == nullptr) {
+            continue;
+        }
+        SdfPath const &rprimId = entries[i].rprimId;
+        if (ARCH_UNLIKELY(TfMapLookupPtr(_rprimMap, rprimId))) {
+            // Duplicate id within the batch; keep the first.
+            _renderDelegate->DestroyRprim(rprim);
+            continue;
+        }
+
+        _rprimIds.Insert(rprimId);
+
+        // Force an initial "renderTag" sync.  We add the bit here since the
+        // render index manages render tags, rather than the rprim
+        // implementation.
+        trackerEntries.emplace_back(
+            rprimId, rprim->GetInitialDirtyBitsMask() |
+                     HdChangeTracker::DirtyRenderTag);
+        _AllocatePrimId(rprim);
+
+        _RprimInfo info = {
+          sceneDelegate,
+          rprim
+        };
+        _rprimMap[rprimId] = std::move(info);
+    }
+    if (!trackerEntries.empty()) {
+        _tracker.RprimsInserted(trackerEntries);
+    }
+}
+
+void
 HdRenderIndex::RemoveRprim(SdfPath const& id)
 {
     HD_TRACE_FUNCTION();
@@ -511,6 +610,9 @@ HdRenderIndex::_Clear()
     _rprimMap.clear();
     _rprimIds.Clear();
     _rprimPrimIdMap.clear();
+    { std::lock_guard<std::mutex> lock(_collectionGatherCacheMutex);
+        _collectionGatherCache.clear();
+    }
 
     // Clear S & B prims
     _sprimIndex.Clear(_tracker, _renderDelegate);
@@ -953,16 +1055,53 @@ HdRenderIndex::GetDrawItems(HdRprimCollection const& collection,
     const SdfPathVector &includePaths = collection.GetRootPaths();
     const SdfPathVector &excludePaths = collection.GetExcludePaths();
 
-    _FilterParam filterParam = {renderTags, this};
+    // The intersection of the collection's path filters against the rprim
+    // index depends only on the rprim ids and the prims' render tags, so
+    // cache the result and reuse it until either changes.  This makes
+    // repeated gathers for the same collection -- e.g. one per render pass
+    // per frame -- a lookup rather than a filter over every rprim.
+    const unsigned rprimIndexVersion = _tracker.GetRprimIndexVersion();
+    const unsigned renderTagVersion = _tracker.GetRenderTagVersion();
+    const size_t gatherKey =
+        TfHash::Combine(includePaths, excludePaths, renderTags);
+
+    bool gathered = false;
+    { std::lock_guard<std::mutex> lock(_collectionGatherCacheMutex);
+        const auto it = _collectionGatherCache.find(gatherKey);
+        if (it != _collectionGatherCache.end()) {
+            const _CollectionGatherEntry &entry = it->second;
+            if (entry.rprimIndexVersion == rprimIndexVersion &&
+                entry.renderTagVersion == renderTagVersion &&
+                entry.includePaths == includePaths &&
+                entry.excludePaths == excludePaths &&
+                entry.renderTags == renderTags) {
+                rprimIds = entry.rprimIds;
+                gathered = true;
+            }
+        }
+    }
 
-    HdPrimGather gather;
+    if (!gathered) {
+        _FilterParam filterParam = {renderTags, this};
 
-    gather.PredicatedFilter(paths,
-                            includePaths,
-                            excludePaths,
-                            _DrawItemFilterPredicate,
-                            &filterParam,
-                            &rprimIds);
+        HdPrimGather gather;
+
+        gather.PredicatedFilter(paths,
+                                includePaths,
+                                excludePaths,
+                                _DrawItemFilterPredicate,
+                                &filterParam,
+                                &rprimIds);
+
+        std::lock_guard<std::mutex> lock(_collectionGatherCacheMutex);
+        _CollectionGatherEntry &entry = _collectionGatherCache[gatherKey];
+        entry.rprimIndexVersion = rprimIndexVersion;
+        entry.renderTagVersion = renderTagVersion;
+        entry.includePaths = includePaths;
+        entry.excludePaths = excludePaths;
+        entry.renderTags = renderTags;
+        entry.rprimIds = rprimIds;
+    }
 
     _ConcurrentDrawItems concurrentDrawItems;
 
@@ -1399,70 +1538,90 @@ HdRenderIndex::SyncAll(HdTaskSharedPtrVector *tasks,
 
     HdRenderParam *renderParam = _renderDelegate->GetRenderParam();
 
-    _bprimIndex.SyncPrims(_tracker, _renderDelegate->GetRenderParam(),
-                          _renderDelegate);
-
-    _sprimIndex.SyncPrims(_tracker, _renderDelegate->GetRenderParam(),
-                          _renderDelegate);
-
     ////////////////////////////////////////////////////////////////////////////
     //
-    // Task Sync
+    // Bprim, Sprim and Task Sync
     //
-    // NOTE: Syncing tasks may update _collectionsToSync for
-    // processing the dirty rprims below.
+    // These phases are scheduled as a dependency-ordered task graph.  The
+    // edges encode the ordering the previously serial code relied on:
+    // sprims may reference bprim state (e.g. texture resources), and task
+    // sync may read sprim state (e.g. cameras) and updates
+    // _collectionsToSync, which the rprim sync below consumes.  Phases with
+    // no edge between them are free to run concurrently.
     //
     {
-        TRACE_FUNCTION_SCOPE("Task Sync");
+        TRACE_FUNCTION_SCOPE("Non-Rprim Sync");
 
-        size_t numTasks = tasks->size();
-        for (size_t taskNum = 0; taskNum < numTasks; ++taskNum) {
-            HdTaskSharedPtr &task = (*tasks)[taskNum];
+        WorkTaskGraph syncGraph;
 
-            if (!TF_VERIFY(task)) {
-                TF_CODING_ERROR("Null Task in task list.  Entry Num: %zu",
-                                taskNum);
-                continue;
-            }
+        const WorkTaskGraph::TaskId bprimSync = syncGraph.AddTask([&]() {
+            _bprimIndex.SyncPrims(_tracker, renderParam, _renderDelegate);
+        });
 
-            SdfPath taskId = task->GetId();
+        const WorkTaskGraph::TaskId sprimSync = syncGraph.AddTask([&]() {
+            _sprimIndex.SyncPrims(_tracker, renderParam, _renderDelegate);
+        });
 
-            // Is this a tracked task?
-            _TaskMap::iterator taskMapIt = _taskMap.find(taskId);
-            if (taskMapIt != _taskMap.end()) {
-                _TaskInfo &taskInfo = taskMapIt->second;
+        // NOTE: Syncing tasks may update _collectionsToSync for
+        // processing the dirty rprims below.
+        const WorkTaskGraph::TaskId taskSync = syncGraph.AddTask([&]() {
+            TRACE_FUNCTION_SCOPE("Task Sync");
 
-                // If the task is in the render index, then we have the
-                // possibility that the task passed in points to a
-                // different instance than the one stored in the render index
-                // even though they have the same id.
-                //
-                // For consistency, we always use the registered task in the
-                // render index for a given id, as that is the one the state is
-                // tracked for.
-                //
-                // However, this is still a weird situation, so report the
-                // issue as a verify so it can be addressed.
-                TF_VERIFY(taskInfo.task == task);
+            size_t numTasks = tasks->size();
+            for (size_t taskNum = 0; taskNum < numTasks; ++taskNum) {
+                HdTaskSharedPtr &task = (*tasks)[taskNum];
 
-                HdDirtyBits taskDirtyBits = _tracker.GetTaskDirtyBits(taskId);
+                if (!TF_VERIFY(task)) {
+                    TF_CODING_ERROR("Null Task in task list.  Entry Num: %zu",
+                                    taskNum);
+                    continue;
+                }
 
-                taskInfo.task->Sync(taskInfo.sceneDelegate,
-                                    taskContext,
-                                    &taskDirtyBits);
+                SdfPath taskId = task->GetId();
 
-                _tracker.MarkTaskClean(taskId, taskDirtyBits);
+                // Is this a tracked task?
+                _TaskMap::iterator taskMapIt = _taskMap.find(taskId);
+                if (taskMapIt != _taskMap.end()) {
+                    _TaskInfo &taskInfo = taskMapIt->second;
 
-            } else {
-                // Dummy dirty bits
-                HdDirtyBits taskDirtyBits = 0;
+                    // If the task is in the render index, then we have the
+                    // possibility that the task passed in points to a
+                    // different instance than the one stored in the render
+                    // index even though they have the same id.
+                    //
+                    // For consistency, we always use the registered task in
+                    // the render index for a given id, as that is the one the
+                    // state is tracked for.
+                    //
+                    // However, this is still a weird situation, so report the
+                    // issue as a verify so it can be addressed.
+                    TF_VERIFY(taskInfo.task == task);
 
-                // This is an untracked task, never added to the render index.
-                task->Sync(nullptr,
-                           taskContext,
-                           &taskDirtyBits);
+                    HdDirtyBits taskDirtyBits =
+                        _tracker.GetTaskDirtyBits(taskId);
+
+                    taskInfo.task->Sync(taskInfo.sceneDelegate,
+                                        taskContext,
+                                        &taskDirtyBits);
+
+                    _tracker.MarkTaskClean(taskId, taskDirtyBits);
+
+                } else {
+                    // Dummy dirty bits
+                    HdDirtyBits taskDirtyBits = 0;
+
+                    // This is an untracked task, never added to the render
+                    // index.
+                    task->Sync(nullptr,
+                               taskContext,
+                               &taskDirtyBits);
+                }
             }
-        }
+        });
+
+        syncGraph.AddDependency(sprimSync, bprimSync);
+        syncGraph.AddDependency(taskSync, sprimSync);
+        syncGraph.RunAndWait();
     }
 
     ////////////////////////////////////////////////////////////////////////////
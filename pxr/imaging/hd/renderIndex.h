@@ -35,6 +35,7 @@
 #include <vector>
 #include <unordered_map>
 #include <memory>
+#include <mutex>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -194,6 +195,23 @@ public:
                      HdSceneDelegate* sceneDelegate,
                      SdfPath const& rprimId);
 
+    /// An rprim type/id pair for bulk insertion via InsertRprims.
+    struct RprimEntry {
+        TfToken typeId;
+        SdfPath rprimId;
+    };
+    using RprimEntryVector = std::vector<RprimEntry>;
+
+    /// Insert a batch of rprims into the index.  Equivalent to calling
+    /// InsertRprim for each entry, but updates the change tracker's version
+    /// counters once for the whole batch and, if the render delegate
+    /// declares rprim creation thread-safe (see
+    /// HdRenderDelegate::IsParallelRprimCreationEnabled), constructs the
+    /// rprims in parallel.  Intended for initial scene population.
+    HD_API
+    void InsertRprims(HdSceneDelegate* sceneDelegate,
+                      RprimEntryVector const& entries);
+
     /// Remove a rprim from index
     HD_API
     void RemoveRprim(SdfPath const& id);
@@ -461,6 +479,8 @@ private:
     void _InsertRprim(TfToken const& typeId,
                       HdSceneDelegate* sceneDelegate,
                       SdfPath const& rprimId);
+    void _InsertRprims(HdSceneDelegate* sceneDelegate,
+                       RprimEntryVector const& entries);
     void _InsertSprim(TfToken const& typeId,
                       HdSceneDelegate* delegate,
                       SdfPath const& sprimId);
@@ -517,6 +537,24 @@ private:
     _RprimMap _rprimMap;
     Hd_SortedIds _rprimIds;
 
+    // Cached results of the collection intersection performed by
+    // GetDrawItems(), keyed by a hash of the collection's path filters and
+    // the render tags.  Entries are validated against the tracker's rprim
+    // index and render tag versions, so they are recomputed when prims
+    // come and go and reused as-is otherwise.
+    struct _CollectionGatherEntry {
+        unsigned rprimIndexVersion = 0;
+        unsigned renderTagVersion = 0;
+        SdfPathVector includePaths;
+        SdfPathVector excludePaths;
+        TfTokenVector renderTags;
+        SdfPathVector rprimIds;
+    };
+    typedef std::unordered_map<size_t, _CollectionGatherEntry>
+        _CollectionGatherCache;
+    _CollectionGatherCache _collectionGatherCache;
+    std::mutex _collectionGatherCacheMutex;
+
     _RprimPrimIDVector _rprimPrimIdMap;
 
     _TaskMap _taskMap;
@@ -304,9 +304,32 @@ HdSceneIndexAdapterSceneDelegate::PrimsAdded(
     // Drop per-thread scene index input prim cache
     _inputPrimCache.clear();
 
+    // Entries for prims that are new to the render index and rprim-typed
+    // take a bulk insertion path; this is the bulk of initial population.
+    // The batch is flushed before any other kind of entry is processed so
+    // that relative ordering (e.g. a geom subset dirtying its parent rprim)
+    // is preserved.
+    HdRenderIndex::RprimEntryVector newRprims;
+    const auto flushNewRprims = [this, &newRprims]() {
+        if (!newRprims.empty()) {
+            GetRenderIndex()._InsertRprims(this, newRprims);
+            newRprims.clear();
+        }
+    };
+
     for (const AddedPrimEntry &entry : entries) {
-        _PrimAdded(entry.primPath, entry.primType);
+        if (_primCache.find(entry.primPath) == _primCache.end() &&
+            entry.primType != HdPrimTypeTokens->geomSubset &&
+            GetRenderIndex().IsRprimTypeSupported(entry.primType)) {
+            newRprims.push_back({entry.primType, entry.primPath});
+            _primCache[entry.primPath].primType = entry.primType;
+        } else {
+            flushNewRprims();
+            _PrimAdded(entry.primPath, entry.primType);
+        }
     }
+    flushNewRprims();
+
     if (!entries.empty()) {
         _sceneDelegatesBuilt = false;
     }
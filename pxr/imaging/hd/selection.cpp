@@ -217,6 +217,7 @@ void HdSelection::_GetSelectionPrimPathsForMode(
         return;
     }
 
+    paths->reserve(paths->size() + _selMap[mode].size());
     for (auto const &pair : _selMap[mode]) {
         SdfPath const &rprimPath = pair.first;
         paths->push_back(rprimPath);
@@ -33,6 +33,12 @@ HdTask::GetRenderTags() const
     return EMPTY_SET;
 }
 
+bool
+HdTask::IsParallelPrepareSafe() const
+{
+    return false;
+}
+
 /// Returns the minimal set of dirty bits to place in the
 /// change tracker for use in the first sync of this prim.
 /// Typically this would be all dirty bits.
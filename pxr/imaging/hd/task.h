@@ -93,7 +93,9 @@ public:
     /// resources with the resource registry or other render delegate
     /// specific mechanism.
     ///
-    /// Tasks are always "Prepared" in execution order.
+    /// Tasks are always "Prepared" in execution order, except that
+    /// consecutive tasks returning true from IsParallelPrepareSafe() may be
+    /// prepared concurrently.
     ///
     /// Inter-task communication is achievable via the task context.
     /// The same task context is used for the prepare and execution phases.
@@ -136,6 +138,21 @@ public:
 
     SdfPath const& GetId() const { return _id; }
 
+    /// Parallel prepare declaration.
+    ///
+    /// Tasks are prepared in execution order by default since they may
+    /// communicate through the task context. A task whose Prepare neither
+    /// writes the task context nor depends on entries written by another
+    /// task's Prepare in the same execution may return true to declare
+    /// that; HdEngine prepares consecutive runs of such tasks concurrently.
+    ///
+    /// This declaration covers the Prepare phase only. Task execution
+    /// remains non-parallel and ordered.
+    ///
+    /// The default implementation returns false.
+    HD_API
+    virtual bool IsParallelPrepareSafe() const;
+
     /// Returns the minimal set of dirty bits to place in the
     /// change tracker for use in the first sync of this prim.
     /// Typically this would be all dirty bits.
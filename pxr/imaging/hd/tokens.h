@@ -177,6 +177,7 @@ PXR_NAMESPACE_OPEN_SCOPE
     (instMeshTopology)                          \
     (instMeshTopologyRange)                     \
     (instPrimvarRange)                          \
+    (instSubdivision)                           \
     (instVertexAdjacency)                       \
     (meshTopology)                              \
     (nonUniformSize)                            \
@@ -186,6 +187,7 @@ PXR_NAMESPACE_OPEN_SCOPE
     (quadrangulateFaceVarying)                  \
     (quadrangulatedVerts)                       \
     (rebuildBatches)                            \
+    (sharedPrimvarRangeHits)                    \
     (singleBufferSize)                          \
     (ssboSize)                                  \
     (skipInvisibleRprimSync)                    \
@@ -736,7 +736,33 @@ HdGpGenerativeProceduralResolvingSceneIndex::_UpdateProcedural(
     _ProcEntry &procEntry = *procEntryPtr;
 
     if (forceUpdate) {
-        procEntry.state.store(_ProcEntry::StateUncooked);
+        // If only declared dependencies (and not the procedural prim itself)
+        // have been dirtied, the arguments which drive UpdateDependencies are
+        // unchanged; go straight to recooking the outputs against the precise
+        // dirtied set rather than resetting to fully uncooked. Dependency
+        // sets which follow scene structure are still refreshed since prim
+        // add/remove invalidation doesn't come through this path.
+        if (dirtiedDependencies
+                && procEntry.state.load() == _ProcEntry::StateCooked
+                && procEntry.proc
+                && dirtiedDependencies->find(proceduralPrimPath) ==
+                    dirtiedDependencies->end()) {
+            procEntry.state.store(_ProcEntry::StateDependenciesCooked);
+
+            // a procedural which previously indicated it was finished with
+            // asynchronous processing is given an opportunity to restart in
+            // response to its declared dependencies dirtying
+            if (_attemptAsync &&
+                    _activeSyncProcedurals.find(proceduralPrimPath) ==
+                        _activeSyncProcedurals.end()) {
+                if (procEntry.proc->AsyncBegin(true)) {
+                    _activeSyncProcedurals[proceduralPrimPath] =
+                        TfCreateWeakPtr(&procEntry);
+                }
+            }
+        } else {
+            procEntry.state.store(_ProcEntry::StateUncooked);
+        }
     }
 
     if (procEntry.state.load() < _ProcEntry::StateDependenciesCooked) {
@@ -758,28 +784,28 @@ HdGpGenerativeProceduralResolvingSceneIndex::_UpdateProcedural(
     const HdGpGenerativeProcedural::DependencyMap &localDirtiedDependencies =
         dirtiedDependencies ? *dirtiedDependencies : procEntry.dependencies;
 
-    // TODO, move this within the compare_exchange_strong so that only one
-    //       side cooks or add pre-proc entry mutex
-    HdGpGenerativeProcedural::ChildPrimTypeMap newChildTypes =
-        procEntry.proc->Update(
-            _GetInputSceneIndex(),
-            procEntry.childTypes,
-            localDirtiedDependencies,
-            outputNotices ? &outputNotices->dirtied : nullptr);
+    // Update is documented as never running concurrently for a single
+    // instance, and a cook is rarely cheap. Hold the cook mutex across the
+    // cook itself so that only the thread which wins the state exchange
+    // cooks; other threads arriving here block until the result is in place
+    // and then find the state already advanced.
+    std::unique_lock<std::mutex> cookLock(procEntry.cookMutex);
 
     _ProcEntry::State current = _ProcEntry::StateDependenciesCooked;
     if (procEntry.state.compare_exchange_strong(
             current, _ProcEntry::StateCooking)) {
 
-        std::unique_lock<std::mutex> cookLock(procEntry.cookMutex);
+        HdGpGenerativeProcedural::ChildPrimTypeMap newChildTypes =
+            procEntry.proc->Update(
+                _GetInputSceneIndex(),
+                procEntry.childTypes,
+                localDirtiedDependencies,
+                outputNotices ? &outputNotices->dirtied : nullptr);
 
         _UpdateProceduralResult(
              &procEntry, proceduralPrimPath, newChildTypes, outputNotices);
 
-         procEntry.state.store(_ProcEntry::StateCooked);
-
-    } else {
-        std::unique_lock<std::mutex> cookLock(procEntry.cookMutex);
+        procEntry.state.store(_ProcEntry::StateCooked);
     }
 
     return procEntryPtr;
@@ -10,6 +10,8 @@
 #include "pxr/base/trace/trace.h"
 #include "pxr/base/work/loops.h"
 
+#include <atomic>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 // For texture debug string
@@ -125,21 +127,33 @@ HdStAssetUvTextureCpuData::HdStAssetUvTextureCpuData(
     }
 
     {
-        // Read the actual mips from each image and store them in a big buffer of
-        // contiguous memory.
+        // Read the actual mips from each image and store them in a big buffer
+        // of contiguous memory.  Each mip decodes from its own image into a
+        // disjoint region of the buffer, so the mips can be read in parallel;
+        // this also deepens the parallelism of the registry's per-texture
+        // parallel load when there are fewer textures than cores.
         TRACE_FUNCTION_SCOPE("filling in image data");
 
-        for (size_t i = 0; i < numUsableMips; ++i) {
-            if (!HdStTextureUtils::ReadAndConvertImage(
-                    mips[firstMip + i],
-                    /* flipped = */ originLocation == HioImage::OriginLowerLeft,
-                    premultiplyAlpha,
-                    mipInfos[i],
-                    /* layer = */ 0,
-                    _rawBuffer.get())) {
-                TF_WARN("Unable to read Texture '%s'.", filePath.c_str());
-                return;
-            }
+        std::atomic<bool> success(true);
+        WorkParallelForN(
+            numUsableMips,
+            [&, this](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    if (!HdStTextureUtils::ReadAndConvertImage(
+                            mips[firstMip + i],
+                            /* flipped = */
+                            originLocation == HioImage::OriginLowerLeft,
+                            premultiplyAlpha,
+                            mipInfos[i],
+                            /* layer = */ 0,
+                            _rawBuffer.get())) {
+                        success = false;
+                    }
+                }
+            });
+        if (!success) {
+            TF_WARN("Unable to read Texture '%s'.", filePath.c_str());
+            return;
         }
     }
 
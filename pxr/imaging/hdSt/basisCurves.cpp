@@ -42,6 +42,7 @@ HdStBasisCurves::HdStBasisCurves(SdfPath const& id)
     , _topology()
     , _topologyId(0)
     , _customDirtyBitsInUse(0)
+    , _deferredDirtyBits(HdChangeTracker::Clean)
     , _refineLevel(0)
     , _displayOpacity(false)
     , _occludedSelectionShowsThrough(false)
@@ -69,6 +70,35 @@ HdStBasisCurves::Sync(HdSceneDelegate *delegate,
 {
     _UpdateVisibility(delegate, dirtyBits);
 
+    if (!_deferredReprTokens.empty()) {
+        if (!IsVisible()) {
+            // Draw item creation is deferred and the prim is still hidden:
+            // accumulate the requested updates and skip this sync; they are
+            // replayed when the prim is first seen visible.
+            _deferredDirtyBits |= *dirtyBits;
+            *dirtyBits = HdChangeTracker::Clean;
+            return;
+        }
+
+        // First sync with the prim visible: create the deferred draw items
+        // and replay the dirty state accumulated while hidden.
+        *dirtyBits |= _deferredDirtyBits;
+        _deferredDirtyBits = HdChangeTracker::Clean;
+        for (TfToken const &deferredToken : _deferredReprTokens) {
+            _ReprVector::iterator it =
+                std::find_if(_reprs.begin(), _reprs.end(),
+                             _ReprComparator(deferredToken));
+            if (TF_VERIFY(it != _reprs.end())) {
+                _CreateReprDrawItems(it->second, deferredToken, dirtyBits);
+            }
+        }
+        _deferredReprTokens.clear();
+
+        // Notify render passes and the draw items cache that new draw items
+        // exist so that they re-gather.
+        HdStMarkDeferredDrawItemsCreated(renderParam);
+    }
+
     bool updateMaterialTags = false;
     if (*dirtyBits & HdChangeTracker::DirtyMaterialId) {
         HdStSetMaterialId(delegate, renderParam, this);
@@ -128,6 +158,12 @@ HdStBasisCurves::Finalize(HdRenderParam *renderParam)
     // Decrement material tag counts for each draw item material tag
     for (auto const& reprPair : _reprs) {
         const TfToken &reprToken = reprPair.first;
+        // If draw item creation for this repr is still deferred, no items
+        // exist and no counts were ever increased.
+        if (std::find(_deferredReprTokens.begin(), _deferredReprTokens.end(),
+                      reprToken) != _deferredReprTokens.end()) {
+            continue;
+        }
         _BasisCurvesReprConfig::DescArray const &descs =
             _GetReprDesc(reprToken);
         HdReprSharedPtr repr = reprPair.second;
@@ -413,50 +449,66 @@ HdStBasisCurves::_InitRepr(TfToken const &reprToken, HdDirtyBits *dirtyBits)
                                             _ReprComparator(reprToken));
     bool isNew = it == _reprs.end();
     if (isNew) {
-        _BasisCurvesReprConfig::DescArray descs = _GetReprDesc(reprToken);
-
         // add new repr
         _reprs.emplace_back(reprToken, std::make_shared<HdRepr>());
         HdReprSharedPtr &repr = _reprs.back().second;
 
         *dirtyBits |= HdChangeTracker::NewRepr;
 
-        // allocate all draw items
-        for (size_t descIdx = 0; descIdx < descs.size(); ++descIdx) {
-            const HdBasisCurvesReprDesc &desc = descs[descIdx];
+        if (HdStIsDeferredDrawItemCreationEnabled()) {
+            // Defer draw item allocation until the prim is first seen
+            // visible; Sync creates the items then. The empty repr keeps
+            // draw item gathering benign for this prim in the meantime.
+            _deferredReprTokens.push_back(reprToken);
+            return;
+        }
 
-            if (desc.geomStyle == HdBasisCurvesGeomStyleInvalid) {
-                continue;
-            }
+        _CreateReprDrawItems(repr, reprToken, dirtyBits);
+    }
+}
 
-            HdRepr::DrawItemUniquePtr drawItem =
-                std::make_unique<HdStDrawItem>(&_sharedData);
-            HdDrawingCoord *drawingCoord = drawItem->GetDrawingCoord();
-            repr->AddDrawItem(std::move(drawItem));
-            if (desc.geomStyle == HdBasisCurvesGeomStyleWire) {
-                // Why does geom style require this change?
-                drawingCoord->SetTopologyIndex(HdStBasisCurves::HullTopology);
-                if (!(_customDirtyBitsInUse & DirtyHullIndices)) {
-                    _customDirtyBitsInUse |= DirtyHullIndices;
-                    *dirtyBits |= DirtyHullIndices;
-                }
-            } else if (desc.geomStyle == HdBasisCurvesGeomStylePoints) {
-                drawingCoord->SetTopologyIndex(HdStBasisCurves::PointsTopology);
-                if (!(_customDirtyBitsInUse & DirtyPointsIndices)) {
-                    _customDirtyBitsInUse |= DirtyPointsIndices;
-                    *dirtyBits |= DirtyPointsIndices;
-                }
-            } else {
-                if (!(_customDirtyBitsInUse & DirtyIndices)) {
-                    _customDirtyBitsInUse |= DirtyIndices;
-                    *dirtyBits |= DirtyIndices;
-                }
-            }
+void
+HdStBasisCurves::_CreateReprDrawItems(HdReprSharedPtr const &repr,
+                                      TfToken const &reprToken,
+                                      HdDirtyBits *dirtyBits)
+{
+    _BasisCurvesReprConfig::DescArray descs = _GetReprDesc(reprToken);
 
-            // Set up drawing coord instance primvars.
-            drawingCoord->SetInstancePrimvarBaseIndex(
-                HdStBasisCurves::InstancePrimvar);
+    // allocate all draw items
+    for (size_t descIdx = 0; descIdx < descs.size(); ++descIdx) {
+        const HdBasisCurvesReprDesc &desc = descs[descIdx];
+
+        if (desc.geomStyle == HdBasisCurvesGeomStyleInvalid) {
+            continue;
+        }
+
+        HdRepr::DrawItemUniquePtr drawItem =
+            std::make_unique<HdStDrawItem>(&_sharedData);
+        HdDrawingCoord *drawingCoord = drawItem->GetDrawingCoord();
+        repr->AddDrawItem(std::move(drawItem));
+        if (desc.geomStyle == HdBasisCurvesGeomStyleWire) {
+            // Why does geom style require this change?
+            drawingCoord->SetTopologyIndex(HdStBasisCurves::HullTopology);
+            if (!(_customDirtyBitsInUse & DirtyHullIndices)) {
+                _customDirtyBitsInUse |= DirtyHullIndices;
+                *dirtyBits |= DirtyHullIndices;
+            }
+        } else if (desc.geomStyle == HdBasisCurvesGeomStylePoints) {
+            drawingCoord->SetTopologyIndex(HdStBasisCurves::PointsTopology);
+            if (!(_customDirtyBitsInUse & DirtyPointsIndices)) {
+                _customDirtyBitsInUse |= DirtyPointsIndices;
+                *dirtyBits |= DirtyPointsIndices;
+            }
+        } else {
+            if (!(_customDirtyBitsInUse & DirtyIndices)) {
+                _customDirtyBitsInUse |= DirtyIndices;
+                *dirtyBits |= DirtyIndices;
+            }
         }
+
+        // Set up drawing coord instance primvars.
+        drawingCoord->SetInstancePrimvarBaseIndex(
+            HdStBasisCurves::InstancePrimvar);
     }
 }
 
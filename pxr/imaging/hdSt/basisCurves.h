@@ -138,6 +138,10 @@ private:
     bool _SupportsRefinement(int refineLevel);
     bool _SupportsUserWidths(HdStDrawItem* drawItem);
     bool _SupportsUserNormals(HdStDrawItem* drawItem);
+
+    void _CreateReprDrawItems(HdReprSharedPtr const &repr,
+                              TfToken const &reprToken,
+                              HdDirtyBits *dirtyBits);
     
     void _UpdateDrawItem(HdSceneDelegate *sceneDelegate,
                          HdRenderParam *renderParam,
@@ -161,6 +165,13 @@ private:
     HdSt_BasisCurvesTopologySharedPtr _topology;
     HdTopology::ID _topologyId;
     HdDirtyBits _customDirtyBitsInUse;
+
+    // Reprs whose draw item creation has been deferred until the prim is
+    // first seen visible, along with the dirty bits accumulated while the
+    // prim remained hidden. Only used when deferred draw item creation is
+    // enabled; empty otherwise.
+    TfTokenVector _deferredReprTokens;
+    HdDirtyBits _deferredDirtyBits;
     int _refineLevel;  // XXX: could be moved into HdBasisCurveTopology.
     bool _displayOpacity : 1;
     bool _occludedSelectionShowsThrough : 1;
@@ -6,6 +6,9 @@
 //
 #include "pxr/imaging/hdSt/bufferArrayRegistry.h"
 #include "pxr/imaging/hd/bufferArray.h"
+#include "pxr/imaging/hd/bufferArrayRange.h"
+
+#include "pxr/base/tf/stringUtils.h"
 
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -59,6 +62,17 @@ HdBufferArrayRangeSharedPtr HdStBufferArrayRegistry::AllocateRange(
                               role,
                               bufferSpecs,
                               usageHint);
+
+        // Pre-size the first buffer array for this aggregation if a layout
+        // profile recorded a capacity for it.
+        if (!_capacityHints.empty()) {
+            auto const hintIt = _capacityHints.find(aggrId);
+            if (hintIt != _capacityHints.end()) {
+                std::lock_guard<std::mutex> lock(entry.lock);
+                strategy->SetBufferCapacityHint(
+                    entry.bufferArrays.front(), hintIt->second);
+            }
+        }
     } else {
 
         // There's a potential multi-thread race condition where
@@ -237,6 +251,48 @@ HdStBufferArrayRegistry::GetResourceAllocation(
     return gpuMemoryUsed;
 }
 
+VtDictionary
+HdStBufferArrayRegistry::GetLayoutProfile() const
+{
+    VtDictionary profile;
+    TF_FOR_ALL (entryIt, _entries) {
+        size_t numElements = 0;
+        TF_FOR_ALL (bufferIt, entryIt->second.bufferArrays) {
+            HdBufferArraySharedPtr const &bufferArray = *bufferIt;
+            size_t rangeCount = bufferArray->GetRangeCount();
+            for (size_t rangeIdx = 0; rangeIdx < rangeCount; ++rangeIdx) {
+                if (HdBufferArrayRangeSharedPtr range =
+                        bufferArray->GetRange(rangeIdx).lock()) {
+                    numElements += range->GetNumElements();
+                }
+            }
+        }
+        if (numElements > 0) {
+            profile[TfStringPrintf("%zu", entryIt->first)] =
+                VtValue(numElements);
+        }
+    }
+    return profile;
+}
+
+void
+HdStBufferArrayRegistry::ApplyLayoutProfile(VtDictionary const &profile)
+{
+    _capacityHints.clear();
+    for (const auto &entry : profile) {
+        const size_t numElements = entry.second.GetWithDefault<size_t>(0);
+        if (numElements == 0) {
+            continue;
+        }
+        bool outOfRange = false;
+        const uint64_t aggrId = TfStringToUInt64(entry.first, &outOfRange);
+        if (outOfRange) {
+            continue;
+        }
+        _capacityHints[aggrId] = numElements;
+    }
+}
+
 void
 HdStBufferArrayRegistry::_InsertNewBufferArray(
     _Entry &entry,
@@ -25,6 +25,7 @@
 #include <condition_variable>
 #include <memory>
 #include <mutex>
+#include <unordered_map>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -62,11 +63,28 @@ public:
     void   GarbageCollect();
 
     /// Generate a report on resources consumed by the managed
-    /// buffer array.  The returned size is an esitmate of the 
+    /// buffer array.  The returned size is an esitmate of the
     /// gpu memory consumed by the buffers
     HDST_API
-    size_t GetResourceAllocation(HdStAggregationStrategy *strategy, 
+    size_t GetResourceAllocation(HdStAggregationStrategy *strategy,
                                  VtDictionary &result) const;
+
+    /// Returns a layout profile capturing, for each aggregation id, the
+    /// total number of elements currently allocated in its buffer arrays.
+    /// The profile can be persisted by the application and applied to a
+    /// fresh registry with ApplyLayoutProfile() to size buffer arrays up
+    /// front.
+    HDST_API
+    VtDictionary GetLayoutProfile() const;
+
+    /// Applies a layout profile captured by GetLayoutProfile().  The first
+    /// buffer array created for an aggregation id found in the profile is
+    /// pre-sized to the recorded element count, avoiding the grow-copy
+    /// cycles otherwise seen while a scene is first populated.  Strategies
+    /// that do not support capacity hints ignore them.
+    /// Not thread-safe; call before allocation begins.
+    HDST_API
+    void ApplyLayoutProfile(VtDictionary const &profile);
     
     /// Debug dump
     HDST_API
@@ -122,6 +140,12 @@ private:
                                 HdStAggregationStrategy::AggregationId, _Entry>;
     _BufferArrayIndex _entries;
 
+    // Element capacity hints per aggregation id, populated by
+    // ApplyLayoutProfile() and consulted when the first buffer array for an
+    // aggregation is created.
+    std::unordered_map<HdStAggregationStrategy::AggregationId, size_t>
+        _capacityHints;
+
     /// Concurrently adds a new buffer to an entry in the cache.
     /// If expectedTail differs from the buffer at the end of the
     /// entries list after locking, then this function fails and
@@ -18,6 +18,8 @@
 #include "pxr/imaging/hd/perfLog.h"
 #include "pxr/imaging/hd/renderIndex.h"
 
+#include "pxr/base/gf/bbox3d.h"
+#include "pxr/base/gf/frustum.h"
 #include "pxr/base/gf/matrix4d.h"
 #include "pxr/base/tf/diagnostic.h"
 #include "pxr/base/tf/envSetting.h"
@@ -29,15 +31,43 @@
 #include <tbb/enumerable_thread_specific.h>
 
 #include <algorithm>
+#include <cmath>
 #include <unordered_map>
+#include <unordered_set>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
 
+TF_DEFINE_ENV_SETTING(HDST_ENABLE_COARSE_BATCH_CULLING, true,
+    "Enable coarse frustum culling of whole draw batches using their "
+    "aggregate bounds, ahead of per-draw-item culling.");
+
+static bool
+_IsEnabledCoarseBatchCulling()
+{
+    static bool enabled =
+        TfGetEnvSetting(HDST_ENABLE_COARSE_BATCH_CULLING);
+    return enabled;
+}
+
+TF_DEFINE_ENV_SETTING(HDST_ENABLE_INCREMENTAL_BATCH_UPDATES, true,
+    "Append newly added draw items to the existing draw batches instead "
+    "of rebuilding and re-sorting all batches, when the draw item list "
+    "only grew.");
+
+static bool
+_IsEnabledIncrementalBatchUpdates()
+{
+    static bool enabled =
+        TfGetEnvSetting(HDST_ENABLE_INCREMENTAL_BATCH_UPDATES);
+    return enabled;
+}
+
 HdStCommandBuffer::HdStCommandBuffer()
     : _visibleSize(0)
     , _visChangeCount(0)
     , _drawBatchesVersion(0)
+    , _batchBoundsVersion(0)
 {
     /*NOTHING*/
 }
@@ -131,6 +161,13 @@ struct _BatchMap {
         return newBatch;
     }
 
+    // Make an already existing draw batch known under the given key so
+    // that subsequent insertions may append to it. Used to seed the map
+    // from the current batches when updating them incrementally.
+    void Register(Key key, HdSt_DrawBatchSharedPtr const &batch) {
+        _batchesByKey[key].push_back(batch);
+    }
+
 private:
     void _SetPreviousBatchForKey(
         Key key, HdSt_DrawBatchSharedPtr const &batch) {
@@ -144,23 +181,18 @@ private:
     HdSt_DrawBatchSharedPtr _prevBatchForKey;
 };
 
-void
-_InsertDrawItemInstance(
-    HdSt_DrawBatchSharedPtrVector *drawBatches,
-    HdStDrawItemInstance *drawItemInstance,
-    _BatchMap *batchMap,
-    bool const usePipelineDrawBatch,
+// The draw item instances in a batch need to have compatible
+// pipeline configurations and resource allocations.
+// Currently, draw items with distinct geometric shader hashes
+// or buffer array hashes can never be part of the same batch.
+// We combine these two hashes into a key that can be used to to
+// reduce the number of batches which need to be considered
+// as candidate batches.
+size_t
+_ComputeDrawBatchKey(
+    HdStDrawItem const *drawItem,
     bool const allowTextureResourceRebinding)
 {
-    HdStDrawItem const *drawItem = drawItemInstance->GetDrawItem();
-
-    // The draw item instances in a batch need to have compatible
-    // pipeline configurations and resource allocations.
-    // Currently, draw items with distinct geometric shader hashes
-    // or buffer array hashes can never be part of the same batch.
-    // We combine these two hashes into a key that can be used to to
-    // reduce the number of batches which need to be considered
-    // as candidate batches.
     size_t key = TfHash::Combine(
         drawItem->GetGeometricShader()->ComputeHash(),
         drawItem->GetBufferArraysHash()
@@ -175,6 +207,20 @@ _InsertDrawItemInstance(
         key = TfHash::Combine(key, textureHash);
     }
 
+    return key;
+}
+
+void
+_InsertDrawItemInstance(
+    HdSt_DrawBatchSharedPtrVector *drawBatches,
+    HdStDrawItemInstance *drawItemInstance,
+    _BatchMap *batchMap,
+    bool const usePipelineDrawBatch,
+    bool const allowTextureResourceRebinding)
+{
+    size_t const key = _ComputeDrawBatchKey(
+        drawItemInstance->GetDrawItem(), allowTextureResourceRebinding);
+
     // Keep track of newly created draw batches.
     if (HdSt_DrawBatchSharedPtr newBatch =
         batchMap->InsertOrAppend(
@@ -187,7 +233,7 @@ _InsertDrawItemInstance(
 void
 _BatchDrawItemInstances(
     HdSt_DrawBatchSharedPtrVector *drawBatches,
-    std::vector<HdStDrawItemInstance> &instances,
+    std::deque<HdStDrawItemInstance> &instances,
     bool const usePipelineDrawBatch)
 {
     _BatchMap batchMap;
@@ -307,9 +353,9 @@ HdStCommandBuffer::PrepareDraw(
 
     Hgi const * const hgi = resourceRegistry->GetHgi();
 
-    if (_IsEnabledFrustumCullCPU(hgi)) {    
-        const bool freezeCulling = TfDebug::IsEnabled(HD_FREEZE_CULL_FRUSTUM);
+    const bool freezeCulling = TfDebug::IsEnabled(HD_FREEZE_CULL_FRUSTUM);
 
+    if (_IsEnabledFrustumCullCPU(hgi)) {
         if (!freezeCulling) {
             _FrustumCullCPU(renderPassState->GetCullMatrix());
         }
@@ -323,8 +369,21 @@ HdStCommandBuffer::PrepareDraw(
         SyncDrawItemVisibility(tracker.GetVisibilityChangeCount());
     }
 
-    for (auto const& batch : _drawBatches) {
-        batch->PrepareDraw(gfxCmds, renderPassState, resourceRegistry);
+    if (_IsEnabledCoarseBatchCulling()) {
+        if (!freezeCulling) {
+            _FrustumCullBatches(
+                renderIndex->GetChangeTracker().GetSceneStateVersion(),
+                renderPassState->GetCullMatrix());
+        }
+    } else {
+        _batchVisibility.clear();
+    }
+
+    for (size_t i = 0; i < _drawBatches.size(); ++i) {
+        if (_IsBatchVisible(i)) {
+            _drawBatches[i]->PrepareDraw(
+                gfxCmds, renderPassState, resourceRegistry);
+        }
     }
 
     // Once all the prepare work is done, add a memory barrier before the next
@@ -334,9 +393,13 @@ HdStCommandBuffer::PrepareDraw(
 
     computeCmds->InsertMemoryBarrier(HgiMemoryBarrierAll);
 
-    for (auto const& batch : _drawBatches) {
-        batch->EncodeDraw(renderPassState, resourceRegistry,
-            /*firstDrawBatch*/batch == *_drawBatches.begin());
+    bool firstDrawBatch = true;
+    for (size_t i = 0; i < _drawBatches.size(); ++i) {
+        if (_IsBatchVisible(i)) {
+            _drawBatches[i]->EncodeDraw(renderPassState, resourceRegistry,
+                                        firstDrawBatch);
+            firstDrawBatch = false;
+        }
     }
 
     computeCmds->InsertMemoryBarrier(HgiMemoryBarrierAll);
@@ -367,9 +430,13 @@ HdStCommandBuffer::ExecuteDraw(
     //
     // draw batches
     //
-    for (auto const& batch : _drawBatches) {
-        batch->ExecuteDraw(gfxCmds, renderPassState, resourceRegistry,
-            /*firstDrawBatch*/batch == *_drawBatches.begin());
+    bool firstDrawBatch = true;
+    for (size_t i = 0; i < _drawBatches.size(); ++i) {
+        if (_IsBatchVisible(i)) {
+            _drawBatches[i]->ExecuteDraw(gfxCmds, renderPassState,
+                                         resourceRegistry, firstDrawBatch);
+            firstDrawBatch = false;
+        }
     }
 
     HD_PERF_COUNTER_SET(HdPerfTokens->drawBatches, _drawBatches.size());
@@ -385,11 +452,122 @@ HdStCommandBuffer::SetDrawItems(
         currentDrawBatchesVersion == _drawBatchesVersion) {
         return;
     }
+
+    // The existing batches are only reusable when they are still valid
+    // for the current batch version.
+    if (currentDrawBatchesVersion == _drawBatchesVersion &&
+        _IsEnabledIncrementalBatchUpdates() &&
+        _UpdateDrawBatchesIncrementally(drawItems, hgi)) {
+        _drawItems = drawItems;
+        return;
+    }
+
     _drawItems = drawItems;
     _RebuildDrawBatches(hgi);
     _drawBatchesVersion = currentDrawBatchesVersion;
 }
 
+bool
+HdStCommandBuffer::_UpdateDrawBatchesIncrementally(
+    HdDrawItemConstPtrVectorSharedPtr const &drawItems,
+    Hgi const *hgi)
+{
+    HD_TRACE_FUNCTION();
+
+    if (!_drawItems || !drawItems) {
+        return false;
+    }
+
+    bool const usePipelineDrawBatch = HdSt_PipelineDrawBatch::IsEnabled(hgi);
+
+    // Texture aggregation re-sorts draw item instances across batches,
+    // which an append-only update cannot reproduce.
+    if (!usePipelineDrawBatch && (_GetTextureAggregationThreshold() > 0)) {
+        return false;
+    }
+
+    // Determine whether the new draw item list is the previous list
+    // plus additions. Anything else (e.g., prims were removed or
+    // changed reprs, exchanging their draw items) invalidates pointers
+    // held by the batches and requires a full rebuild.
+    std::unordered_set<HdDrawItem const*> previousItems(
+        _drawItems->begin(), _drawItems->end());
+
+    std::vector<HdStDrawItem const*> addedItems;
+    for (HdDrawItem const *drawItem : *drawItems) {
+        if (previousItems.erase(drawItem) == 0) {
+            addedItems.push_back(
+                static_cast<HdStDrawItem const*>(drawItem));
+        }
+    }
+    if (!previousItems.empty()) {
+        return false;
+    }
+    if (addedItems.empty()) {
+        // Same set of draw items in a different vector.
+        return true;
+    }
+
+    TF_DEBUG(HDST_DRAW_BATCH).Msg(
+        "Incrementally adding %lu draw items to command buffer %p\n",
+        addedItems.size(), (void*)this);
+
+    // Seed the batch map from the existing batches so that the added
+    // draw items can be appended to compatible batches.
+    _BatchMap batchMap;
+    for (HdSt_DrawBatchSharedPtr const &batch : _drawBatches) {
+        std::vector<HdStDrawItemInstance const*> const &instances =
+            batch->GetDrawItemInstances();
+        if (!instances.empty()) {
+            batchMap.Register(
+                _ComputeDrawBatchKey(
+                    instances.front()->GetDrawItem(),
+                    /*allowTextureResourceRebinding=*/false),
+                batch);
+        }
+    }
+
+    for (HdStDrawItem const *drawItem : addedItems) {
+        if (!TF_VERIFY(drawItem->GetGeometricShader(), "%s",
+                       drawItem->GetRprimID().GetText()) ||
+            !TF_VERIFY(drawItem->GetMaterialNetworkShader(), "%s",
+                       drawItem->GetRprimID().GetText())) {
+            continue;
+        }
+
+        // _drawItemInstances is a deque, so appending does not move the
+        // instances the existing batches point to.
+        _drawItemInstances.emplace_back(drawItem);
+        HdStDrawItemInstance &instance = _drawItemInstances.back();
+
+        _InsertDrawItemInstance(
+            &_drawBatches,
+            &instance,
+            &batchMap,
+            usePipelineDrawBatch,
+            /*allowTextureResourceRebinding=*/false);
+
+        // The batch the instance ended up in needs to recompile its
+        // draw commands to include the new instance.
+        if (HdSt_DrawBatch * const batch = instance.GetBatch()) {
+            batch->ResetCompiledDrawCommands();
+        }
+    }
+
+    // Force the next visibility sync to consider the new instances and
+    // recompute the coarse batch culling state.
+    _visChangeCount = 0;
+    _batchBounds.clear();
+    _batchVisibility.clear();
+    _batchBoundsVersion = 0;
+
+    TF_DEBUG(HDST_DRAW_BATCH).Msg(
+        "   %lu draw batches in use for %lu draw items\n",
+        _drawBatches.size(), drawItems->size());
+
+    return true;
+}
+
 void
 HdStCommandBuffer::RebuildDrawBatchesIfNeeded(unsigned currentBatchesVersion,
     Hgi const *hgi)
@@ -466,7 +644,10 @@ HdStCommandBuffer::_RebuildDrawBatches(Hgi const *hgi)
 
     _drawBatches.clear();
     _drawItemInstances.clear();
-    _drawItemInstances.reserve(_drawItems->size());
+
+    _batchBounds.clear();
+    _batchVisibility.clear();
+    _batchBoundsVersion = 0;
 
     HD_PERF_COUNTER_INCR(HdPerfTokens->rebuildBatches);
 
@@ -571,7 +752,7 @@ HdStCommandBuffer::_FrustumCullCPU(GfMatrix4d const &cullMatrix)
 
     struct _Worker {
         static
-        void cull(std::vector<HdStDrawItemInstance> * drawItemInstances,
+        void cull(std::deque<HdStDrawItemInstance> * drawItemInstances,
                   GfMatrix4d const &cullMatrix,
                   size_t begin, size_t end) 
         {
@@ -609,6 +790,83 @@ HdStCommandBuffer::_FrustumCullCPU(GfMatrix4d const &cullMatrix)
     }
 }
 
+static bool
+_IsFinite(GfRange3d const &range)
+{
+    GfVec3d const &min = range.GetMin();
+    GfVec3d const &max = range.GetMax();
+    for (int i = 0; i < 3; ++i) {
+        if (!std::isfinite(min[i]) || !std::isfinite(max[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Returns the union of the world space bounds of the batch's draw items,
+// or an empty range when the batch cannot be culled conservatively.
+static GfRange3d
+_ComputeBatchBounds(HdSt_DrawBatchSharedPtr const &batch)
+{
+    GfRange3d bounds;
+    for (HdStDrawItemInstance const *instance : batch->GetDrawItemInstances()) {
+        HdStDrawItem const *item = instance->GetDrawItem();
+
+        // Instanced draw items carry prototype bounds only, and items with
+        // empty or infinite bounds opt out of culling; in either case the
+        // batch has to be treated as always visible.
+        if (item->GetInstanceIndexRange()) {
+            return GfRange3d();
+        }
+        GfRange3d const itemBounds = item->GetBounds().ComputeAlignedRange();
+        if (itemBounds.IsEmpty() || !_IsFinite(itemBounds)) {
+            return GfRange3d();
+        }
+        bounds.UnionWith(itemBounds);
+    }
+    return bounds;
+}
+
+void
+HdStCommandBuffer::_FrustumCullBatches(
+    unsigned const sceneStateVersion,
+    GfMatrix4d const &cullMatrix)
+{
+    HD_TRACE_FUNCTION();
+
+    size_t const numBatches = _drawBatches.size();
+
+    // Draw item bounds only change along with the scene state, so the
+    // aggregate batch bounds stay valid while only the view changes.
+    if (_batchBounds.size() != numBatches ||
+        _batchBoundsVersion != sceneStateVersion) {
+        _batchBounds.resize(numBatches);
+        WorkParallelForN(numBatches,
+            [this](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    _batchBounds[i] = _ComputeBatchBounds(_drawBatches[i]);
+                }
+            });
+        _batchBoundsVersion = sceneStateVersion;
+    }
+
+    _batchVisibility.resize(numBatches);
+    size_t numCulled = 0;
+    for (size_t i = 0; i < numBatches; ++i) {
+        GfRange3d const &bounds = _batchBounds[i];
+        bool const visible =
+            bounds.IsEmpty() ||
+            GfFrustum::IntersectsViewVolume(GfBBox3d(bounds), cullMatrix);
+        _batchVisibility[i] = visible;
+        if (!visible) {
+            ++numCulled;
+        }
+    }
+
+    TF_DEBUG(HD_DRAWITEMS_CULLED).Msg("COARSE CULLED: %zu of %zu batches\n",
+                                      numCulled, numBatches);
+}
+
 void
 HdStCommandBuffer::SetEnableTinyPrimCulling(bool tinyPrimCulling)
 {
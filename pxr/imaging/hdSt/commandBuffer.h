@@ -13,7 +13,9 @@
 #include "pxr/imaging/hdSt/drawItemInstance.h"
 
 #include "pxr/base/gf/matrix4d.h"
+#include "pxr/base/gf/range3d.h"
 
+#include <deque>
 #include <memory>
 #include <vector>
 
@@ -70,6 +72,9 @@ public:
     /// Sets the draw items to use for batching.
     /// If the shared pointer or version is different, batches are rebuilt and
     /// the batch version is updated.
+    /// When the new draw item list only adds items to the previous one,
+    /// the added items are appended to the existing batches instead of
+    /// rebuilding and re-sorting all batches.
     HDST_API
     void SetDrawItems(HdDrawItemConstPtrVectorSharedPtr const &drawItems,
                       unsigned currentBatchVersion,
@@ -102,16 +107,45 @@ public:
 
 private:
     void _RebuildDrawBatches(Hgi const *hgi);
-    
+
+    /// Incrementally extend the existing draw batches when \p drawItems
+    /// is the previous draw item list plus additions. Returns false when
+    /// the update cannot be applied incrementally (e.g., items were
+    /// removed or exchanged) and a full rebuild is required.
+    bool _UpdateDrawBatchesIncrementally(
+        HdDrawItemConstPtrVectorSharedPtr const &drawItems,
+        Hgi const *hgi);
+
     /// Cull drawItemInstances based on view frustum cull matrix
     void _FrustumCullCPU(GfMatrix4d const &cullMatrix);
 
+    /// Cull whole draw batches based on their aggregate bounds, skipping
+    /// per-item cull work and draw submission for fully-invisible batches.
+    void _FrustumCullBatches(unsigned sceneStateVersion,
+                             GfMatrix4d const &cullMatrix);
+
+    /// Returns whether the batch survived the coarse batch culling pass.
+    /// Batches are visible when coarse culling is disabled or stale.
+    bool _IsBatchVisible(size_t batchIndex) const {
+        return batchIndex >= _batchVisibility.size() ||
+               _batchVisibility[batchIndex];
+    }
+
     HdDrawItemConstPtrVectorSharedPtr _drawItems;
-    std::vector<HdStDrawItemInstance> _drawItemInstances;
+    // A deque provides stable addresses, so the draw batches can hold
+    // on to pointers to the instances across incremental appends.
+    std::deque<HdStDrawItemInstance> _drawItemInstances;
     HdSt_DrawBatchSharedPtrVector _drawBatches;
     size_t _visibleSize;
     unsigned int _visChangeCount;
     unsigned int _drawBatchesVersion;
+
+    // Aggregate world space bounds per draw batch, recomputed only when the
+    // scene state changes. An empty range marks a batch that cannot be
+    // culled conservatively.
+    std::vector<GfRange3d> _batchBounds;
+    std::vector<bool> _batchVisibility;
+    unsigned int _batchBoundsVersion;
 };
 
 
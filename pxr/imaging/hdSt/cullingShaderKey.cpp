@@ -22,6 +22,7 @@ TF_DEFINE_PRIVATE_TOKENS(
     ((mainInstancingVS, "ViewFrustumCull.VertexInstancing"))
     ((mainVS,           "ViewFrustumCull.Vertex"))
     ((mainInstancingCS, "ViewFrustumCull.ComputeInstancing"))
+    ((mainCompactionCS, "ViewFrustumCull.ComputeCompaction"))
     ((mainCS,           "ViewFrustumCull.Compute"))
 );
 
@@ -43,7 +44,7 @@ HdSt_CullingShaderKey::~HdSt_CullingShaderKey()
 }
 
 HdSt_CullingComputeShaderKey::HdSt_CullingComputeShaderKey(
-    bool instancing, bool tinyCull, bool counting)
+    bool instancing, bool tinyCull, bool counting, bool compaction)
     : glslfx(_tokens->baseGLSLFX)
 {
 
@@ -51,7 +52,8 @@ HdSt_CullingComputeShaderKey::HdSt_CullingComputeShaderKey(
     CS[1] = counting ? _tokens->counting : _tokens->noCounting;
     CS[2] = tinyCull ? _tokens->tinyCull : _tokens->noTinyCull;
     CS[3] = _tokens->isVisible;
-    CS[4] = instancing ? _tokens->mainInstancingCS : _tokens->mainCS;
+    CS[4] = instancing ? _tokens->mainInstancingCS :
+            compaction ? _tokens->mainCompactionCS : _tokens->mainCS;
     CS[5] = TfToken();
 }
 
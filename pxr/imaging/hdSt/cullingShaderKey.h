@@ -36,7 +36,8 @@ struct HdSt_CullingShaderKey : public HdSt_ShaderKey
 
 struct HdSt_CullingComputeShaderKey : public HdSt_ShaderKey
 {
-    HdSt_CullingComputeShaderKey(bool instancing, bool tinyCull, bool counting);
+    HdSt_CullingComputeShaderKey(bool instancing, bool tinyCull, bool counting,
+                                 bool compaction);
     ~HdSt_CullingComputeShaderKey();
 
     TfToken const &GetGlslfxFilename() const override { return glslfx; }
@@ -16,6 +16,8 @@
 #include "pxr/imaging/hdSt/textureHandle.h"
 #include "pxr/imaging/hdSt/dynamicUvTextureObject.h"
 
+#include "pxr/imaging/hgi/blitCmds.h"
+#include "pxr/imaging/hgi/blitCmdsOps.h"
 #include "pxr/imaging/hgi/computeCmds.h"
 #include "pxr/imaging/hgi/computePipeline.h"
 #include "pxr/imaging/hgi/shaderProgram.h"
@@ -24,10 +26,28 @@
 #include "pxr/imaging/hd/perfLog.h"
 #include "pxr/imaging/hf/perfLog.h"
 
+#include "pxr/base/arch/fileSystem.h"
+#include "pxr/base/tf/envSetting.h"
+#include "pxr/base/tf/fileUtils.h"
+#include "pxr/base/tf/hash.h"
+#include "pxr/base/tf/pathUtils.h"
+#include "pxr/base/tf/safeOutputFile.h"
+#include "pxr/base/tf/stringUtils.h"
 #include "pxr/base/tf/token.h"
 
+#include <cstdio>
+#include <vector>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
+TF_DEFINE_ENV_SETTING(HDST_DOMELIGHT_CACHE_DIR, "",
+    "Directory used to cache convolved dome light textures on disk. "
+    "When set, the irradiance, prefilter and BRDF maps computed for an "
+    "environment map are written to this directory and uploaded from it "
+    "on subsequent dome light changes instead of being re-convolved on "
+    "the GPU. The directory is created on demand. Empty disables the "
+    "cache.");
+
 
 HdSt_DomeLightComputationGPU::HdSt_DomeLightComputationGPU(
     const TfToken &shaderToken,
@@ -59,13 +79,149 @@ _FillPixelsByteSize(HgiTextureDesc * const desc)
         s * desc->dimensions[0] * desc->dimensions[1] * desc->dimensions[2];
 }
 
+// On-disk layout of a cached convolved texture: a header followed by the
+// raw pixel data of all mip levels, tightly packed in mip order as
+// described by HgiGetMipInfos.
+namespace {
+struct _CacheHeader {
+    uint32_t magic;
+    uint32_t version;
+    int32_t width;
+    int32_t height;
+    uint32_t numLevels;
+    uint32_t format;
+    uint64_t dataByteSize;
+};
+
+constexpr uint32_t _cacheMagic = 0x48444c43; // 'HDLC'
+// Bump when the convolution shaders or the cache layout change.
+constexpr uint32_t _cacheVersion = 1;
+}
+
+static
+size_t
+_ComputeCacheDataByteSize(
+    const int width, const int height, const unsigned int numLevels)
+{
+    const std::vector<HgiMipInfo> mipInfos =
+        HgiGetMipInfos(
+            HgiFormatFloat16Vec4, GfVec3i(width, height, 1),
+            /* layerCount = */ 1);
+    if (mipInfos.size() < numLevels) {
+        return 0;
+    }
+    const HgiMipInfo &last = mipInfos[numLevels - 1];
+    return last.byteOffset + last.byteSizePerLayer;
+}
+
+// Returns the path of the cache file for the given map, or the empty
+// string when caching is disabled. The source image is identified by its
+// file path, length and modification time, so edited or replaced
+// environment maps are re-convolved; the filter parameters (output
+// dimensions and mip count) are part of the key as well.
+static
+std::string
+_GetCacheFilePath(
+    const TfToken &shaderToken,
+    const std::string &srcFilePath,
+    const int width, const int height, const unsigned int numLevels)
+{
+    const std::string &cacheDir =
+        TfGetEnvSetting(HDST_DOMELIGHT_CACHE_DIR);
+    if (cacheDir.empty() || srcFilePath.empty()) {
+        return std::string();
+    }
+
+    double mTime = 0.0;
+    ArchGetModificationTime(srcFilePath.c_str(), &mTime);
+    const int64_t srcLength = ArchGetFileLength(srcFilePath.c_str());
+
+    const size_t hash = TfHash::Combine(
+        srcFilePath, srcLength, mTime, width, height, numLevels,
+        _cacheVersion);
+    return TfStringCatPaths(
+        cacheDir,
+        TfStringPrintf("%s_%016zx.bin", shaderToken.GetText(), hash));
+}
+
+// Validates the cache file against the expected texture parameters and,
+// if pixels is non-null, reads the pixel data of all mip levels into it.
+static
+bool
+_ReadCacheFile(
+    const std::string &filePath,
+    const int width, const int height, const unsigned int numLevels,
+    std::vector<uint8_t> * const pixels)
+{
+    FILE * const file = ArchOpenFile(filePath.c_str(), "rb");
+    if (!file) {
+        return false;
+    }
+
+    _CacheHeader header;
+    bool valid =
+        fread(&header, sizeof(header), 1, file) == 1 &&
+        header.magic == _cacheMagic &&
+        header.version == _cacheVersion &&
+        header.width == width &&
+        header.height == height &&
+        header.numLevels == numLevels &&
+        header.format == static_cast<uint32_t>(HgiFormatFloat16Vec4) &&
+        header.dataByteSize ==
+            _ComputeCacheDataByteSize(width, height, numLevels);
+
+    if (valid && pixels) {
+        pixels->resize(header.dataByteSize);
+        valid = fread(pixels->data(), 1, pixels->size(), file) ==
+            pixels->size();
+    }
+
+    fclose(file);
+    return valid;
+}
+
+static
+void
+_WriteCacheFile(
+    const std::string &filePath,
+    const int width, const int height, const unsigned int numLevels,
+    const std::vector<uint8_t> &pixels)
+{
+    const std::string dir = TfGetPathName(filePath);
+    if (!dir.empty() && !TfIsDir(dir) && !TfMakeDirs(dir)) {
+        TF_WARN("Could not create dome light cache directory %s.",
+                dir.c_str());
+        return;
+    }
+
+    _CacheHeader header;
+    header.magic = _cacheMagic;
+    header.version = _cacheVersion;
+    header.width = width;
+    header.height = height;
+    header.numLevels = numLevels;
+    header.format = static_cast<uint32_t>(HgiFormatFloat16Vec4);
+    header.dataByteSize = pixels.size();
+
+    // Write to a temporary file that is renamed into place on Close so
+    // that concurrent processes never observe a partial cache file.
+    TfSafeOutputFile file = TfSafeOutputFile::Replace(filePath);
+    if (!file.Get()) {
+        return;
+    }
+    fwrite(&header, sizeof(header), 1, file.Get());
+    fwrite(pixels.data(), 1, pixels.size(), file.Get());
+    file.Close();
+}
+
 static
 bool
 _GetSrcTextureDimensionsAndName(
     HdStSimpleLightingShaderSharedPtr const &shader,
     GfVec3i * srcDim,
     HgiTextureHandle * srcTextureName,
-    HgiSamplerHandle * srcSamplerName)
+    HgiSamplerHandle * srcSamplerName,
+    std::string * srcFilePath)
 {
     // Get source texture, the dome light environment map
     HdStTextureHandleSharedPtr const &srcTextureHandle =
@@ -104,6 +260,7 @@ _GetSrcTextureDimensionsAndName(
     *srcDim = srcTexture->GetDescriptor().dimensions;
     *srcTextureName = srcTextureObject->GetTexture();
     *srcSamplerName = srcSamplerObject->GetSampler();
+    *srcFilePath = srcTextureObject->GetTextureIdentifier().GetFilePath();
 
     return true;
 }
@@ -122,35 +279,6 @@ HdSt_DomeLightComputationGPU::Execute(
     constexpr int localSize = 8;
     const bool hasUniforms = _roughness >= 0.0f;
 
-    HdStGLSLProgramSharedPtr const computeProgram =
-        HdStGLSLProgram::GetComputeProgram(
-            HdStPackageDomeLightShader(), 
-            _shaderToken,
-            "",
-            static_cast<HdStResourceRegistry*>(resourceRegistry), 
-            [&] (HgiShaderFunctionDesc &computeDesc) {
-                computeDesc.debugName = _shaderToken.GetString();
-                computeDesc.shaderStage = HgiShaderStageCompute;
-                computeDesc.computeDescriptor.localSize = 
-                    GfVec3i(localSize, localSize, 1);
-
-                HgiShaderFunctionAddTexture(&computeDesc, "inTexture",
-                    /*bindIndex = */0);
-                HgiShaderFunctionAddWritableTexture(&computeDesc, "outTexture",
-                    /*bindIndex = */1, /*dimensions = */2, 
-                    HgiFormatFloat16Vec4);
-                if (hasUniforms) {
-                    HgiShaderFunctionAddConstantParam(
-                        &computeDesc, "inRoughness", HdStTokens->_float);
-                }
-                HgiShaderFunctionAddStageInput(
-                    &computeDesc, "hd_GlobalInvocationID", "uvec3",
-                    HgiShaderKeywordTokens->hdGlobalInvocationID);
-            });
-    if (!TF_VERIFY(computeProgram)) {
-        return;
-    }
-
     HdStSimpleLightingShaderSharedPtr const shader = _lightingShader.lock();
     if (!TF_VERIFY(shader)) {
         return;
@@ -160,8 +288,10 @@ HdSt_DomeLightComputationGPU::Execute(
     GfVec3i srcDim;
     HgiTextureHandle srcTextureName;
     HgiSamplerHandle srcSamplerName;
+    std::string srcFilePath;
     if (!_GetSrcTextureDimensionsAndName(
-            shader, &srcDim, &srcTextureName, &srcSamplerName)) {
+            shader, &srcDim, &srcTextureName, &srcSamplerName,
+            &srcFilePath)) {
         return;
     }
 
@@ -190,6 +320,12 @@ HdSt_DomeLightComputationGPU::Execute(
         return;
     }
 
+    // When the disk cache is enabled, the convolved texture may be
+    // uploaded from a previous run instead of being re-computed.
+    const std::string cacheFilePath =
+        _GetCacheFilePath(_shaderToken, srcFilePath, width, height,
+                          _numLevels);
+
     if (_level == 0) {
         // Level zero is in charge of actually creating the
         // GPU resource.
@@ -202,7 +338,54 @@ HdSt_DomeLightComputationGPU::Execute(
         desc.usage =
             HgiTextureUsageBitsShaderRead | HgiTextureUsageBitsShaderWrite;
         _FillPixelsByteSize(&desc);
+
+        std::vector<uint8_t> cachedPixels;
+        if (!cacheFilePath.empty() &&
+            _ReadCacheFile(cacheFilePath, width, height, _numLevels,
+                           &cachedPixels)) {
+            // Create the texture with all mip levels uploaded from the
+            // cache and skip the convolution dispatch entirely.
+            desc.initialData = cachedPixels.data();
+            desc.pixelsByteSize = cachedPixels.size();
+            dstUvTextureObject->CreateTexture(desc);
+            return;
+        }
+
         dstUvTextureObject->CreateTexture(desc);
+    } else if (!cacheFilePath.empty() &&
+               _ReadCacheFile(cacheFilePath, width, height, _numLevels,
+                              nullptr)) {
+        // Level zero already uploaded this mip level from the cache.
+        return;
+    }
+
+    HdStGLSLProgramSharedPtr const computeProgram =
+        HdStGLSLProgram::GetComputeProgram(
+            HdStPackageDomeLightShader(),
+            _shaderToken,
+            "",
+            static_cast<HdStResourceRegistry*>(resourceRegistry),
+            [&] (HgiShaderFunctionDesc &computeDesc) {
+                computeDesc.debugName = _shaderToken.GetString();
+                computeDesc.shaderStage = HgiShaderStageCompute;
+                computeDesc.computeDescriptor.localSize =
+                    GfVec3i(localSize, localSize, 1);
+
+                HgiShaderFunctionAddTexture(&computeDesc, "inTexture",
+                    /*bindIndex = */0);
+                HgiShaderFunctionAddWritableTexture(&computeDesc, "outTexture",
+                    /*bindIndex = */1, /*dimensions = */2,
+                    HgiFormatFloat16Vec4);
+                if (hasUniforms) {
+                    HgiShaderFunctionAddConstantParam(
+                        &computeDesc, "inRoughness", HdStTokens->_float);
+                }
+                HgiShaderFunctionAddStageInput(
+                    &computeDesc, "hd_GlobalInvocationID", "uvec3",
+                    HgiShaderKeywordTokens->hdGlobalInvocationID);
+            });
+    if (!TF_VERIFY(computeProgram)) {
+        return;
     }
 
     // Create a texture view for the layer we want to write to
@@ -278,6 +461,44 @@ HdSt_DomeLightComputationGPU::Execute(
     hgi->DestroyTextureView(&dstTextureView);
     hgi->DestroyComputePipeline(&pipeline);
     hgi->DestroyResourceBindings(&resourceBindings);
+
+    if (!cacheFilePath.empty() && _level == _numLevels - 1) {
+        // All convolution dispatches for this map have been recorded.
+        // Flush them and read the result back so the convolved texture
+        // can be written to the disk cache. The stall only occurs on a
+        // cache miss, where the convolution itself already dominates.
+        computeCmds->InsertMemoryBarrier(HgiMemoryBarrierAll);
+        hdStResourceRegistry->SubmitComputeWork();
+
+        const size_t dataByteSize =
+            _ComputeCacheDataByteSize(width, height, _numLevels);
+        if (dataByteSize == 0) {
+            return;
+        }
+        std::vector<uint8_t> pixels(dataByteSize);
+
+        const std::vector<HgiMipInfo> mipInfos =
+            HgiGetMipInfos(
+                HgiFormatFloat16Vec4, GfVec3i(width, height, 1),
+                /* layerCount = */ 1);
+
+        HgiBlitCmds * const blitCmds =
+            hdStResourceRegistry->GetGlobalBlitCmds();
+        for (unsigned int mip = 0; mip < _numLevels; ++mip) {
+            HgiTextureGpuToCpuOp readBackOp;
+            readBackOp.gpuSourceTexture = dstUvTextureObject->GetTexture();
+            readBackOp.mipLevel = mip;
+            readBackOp.cpuDestinationBuffer =
+                pixels.data() + mipInfos[mip].byteOffset;
+            readBackOp.destinationBufferByteSize =
+                mipInfos[mip].byteSizePerLayer;
+            blitCmds->CopyTextureGpuToCpu(readBackOp);
+        }
+        hdStResourceRegistry->SubmitBlitWork(
+            HgiSubmitWaitTypeWaitUntilCompleted);
+
+        _WriteCacheFile(cacheFilePath, width, height, _numLevels, pixels);
+    }
 }
 
 PXR_NAMESPACE_CLOSE_SCOPE
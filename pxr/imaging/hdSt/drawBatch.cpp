@@ -130,6 +130,11 @@ HdSt_DrawBatch::SetEnableTinyPrimCulling(bool tinyPrimCulling)
 {
 }
 
+void
+HdSt_DrawBatch::ResetCompiledDrawCommands()
+{
+}
+
 namespace {
 inline bool isAggregated(HdBufferArrayRangeSharedPtr const &rangeA,
                          HdBufferArrayRangeSharedPtr const &rangeB)
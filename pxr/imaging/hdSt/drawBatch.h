@@ -108,6 +108,13 @@ public:
     HDST_API
     virtual void SetEnableTinyPrimCulling(bool tinyPrimCulling);
 
+    /// Discard any draw commands compiled from the batch's draw item
+    /// instances so that the next PrepareDraw rebuilds them. Called
+    /// after draw item instances have been appended to a batch that
+    /// was already prepared.
+    HDST_API
+    virtual void ResetCompiledDrawCommands();
+
 protected:
     HDST_API
     virtual void _Init(HdStDrawItemInstance * drawItemInstance);
@@ -56,6 +56,9 @@ public:
     // HDST_API
     void SetBatch(HdSt_DrawBatch *batch);
 
+    /// Query the batch this draw item instance belongs to
+    HdSt_DrawBatch *GetBatch() const { return _batch; }
+
     /// Return a const pointer to draw item
     HdStDrawItem const *GetDrawItem() const { return _drawItem; }
 
@@ -52,6 +52,15 @@ _GetGeomSubsetDrawItemsVersion(HdRenderIndex *renderIndex)
     return size_t(stRenderParam->GetGeomSubsetDrawItemsVersion());
 }
 
+static size_t
+_GetDeferredDrawItemsVersion(HdRenderIndex *renderIndex)
+{
+    HdStRenderParam *stRenderParam = static_cast<HdStRenderParam*>(
+        renderIndex->GetRenderDelegate()->GetRenderParam());
+
+    return size_t(stRenderParam->GetDeferredDrawItemsVersion());
+}
+
 //------------------------------------------------------------------------------
 
 HdDrawItemConstPtrVectorSharedPtr
@@ -153,11 +162,15 @@ HdSt_DrawItemsCache::_IsCacheEntryStale(
     const bool geomSubsetDrawItemsChanged =
         val.geomSubsetDrawItemsVersion != _GetGeomSubsetDrawItemsVersion(
             renderIndex);
+    const bool deferredDrawItemsChanged =
+        val.deferredDrawItemsVersion != _GetDeferredDrawItemsVersion(
+            renderIndex);
 
     return collectionVersionChanged ||
            renderTagsVersionChanged ||
            materialTagsVersionChanged ||
-           geomSubsetDrawItemsChanged;
+           geomSubsetDrawItemsChanged ||
+           deferredDrawItemsChanged;
 }
 
 void
@@ -177,6 +190,8 @@ HdSt_DrawItemsCache::_UpdateCacheEntry(
     val->materialTagsVersion = _GetMaterialTagsVersion(renderIndex);
     val->geomSubsetDrawItemsVersion = _GetGeomSubsetDrawItemsVersion(
         renderIndex);
+    val->deferredDrawItemsVersion = _GetDeferredDrawItemsVersion(
+        renderIndex);
 
     val->drawItems = std::make_shared<HdDrawItemConstPtrVector>();
 
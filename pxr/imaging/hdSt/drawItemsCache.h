@@ -105,13 +105,15 @@ private:
         : collectionVersion(0),
           renderTagsVersion(0),
           materialTagsVersion(0),
-          geomSubsetDrawItemsVersion(0) {}
-        
+          geomSubsetDrawItemsVersion(0),
+          deferredDrawItemsVersion(0) {}
+
         HdDrawItemConstPtrVectorSharedPtr drawItems;
         size_t collectionVersion;
         size_t renderTagsVersion;
         size_t materialTagsVersion;
         size_t geomSubsetDrawItemsVersion;
+        size_t deferredDrawItemsVersion;
     };
 
     bool _IsCacheEntryStale(_CacheValue const &val,
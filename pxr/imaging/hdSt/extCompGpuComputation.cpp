@@ -259,19 +259,14 @@ HdStExtCompGpuComputation::Execute(
         resourceBindingsInstance.GetValue();
     HgiResourceBindingsHandle resourceBindings = *resourceBindingsPtr.get();
 
-    HgiComputeCmds* computeCmds = hdStResourceRegistry->GetGlobalComputeCmds();
-
-    computeCmds->PushDebugGroup("ExtComputation");
-    computeCmds->BindResources(resourceBindings);
-    computeCmds->BindPipeline(pipeline);
-
-    // Queue transfer uniform buffer
-    computeCmds->SetConstantValues(pipeline, 0, uboSize, &_uniforms[0]);
-
-    // Queue compute work
-    computeCmds->Dispatch(GetDispatchCount(), 1);
-
-    computeCmds->PopDebugGroup();
+    // Stage the dispatch with the resource registry rather than recording
+    // it directly so that the many small ext computation dispatches of a
+    // commit are recorded grouped by pipeline and resource bindings.
+    // Ext computations have no ordering dependencies within their compute
+    // queue (see HdSt_GetExtComputationPrimvarsComputations), so the
+    // grouping is free to reorder them.
+    hdStResourceRegistry->AddBatchedComputeDispatch(
+        pipeline, resourceBindings, std::move(_uniforms), GetDispatchCount());
 }
 
 void
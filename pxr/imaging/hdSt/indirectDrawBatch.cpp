@@ -143,6 +143,12 @@ HdSt_IndirectDrawBatch::SetEnableTinyPrimCulling(bool tinyPrimCulling)
     }
 }
 
+void
+HdSt_IndirectDrawBatch::ResetCompiledDrawCommands()
+{
+    _dispatchBuffer.reset();
+}
+
 /* static */
 bool
 HdSt_IndirectDrawBatch::IsEnabledGPUFrustumCulling()
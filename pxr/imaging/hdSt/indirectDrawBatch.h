@@ -71,6 +71,9 @@ public:
     HDST_API
     void SetEnableTinyPrimCulling(bool tinyPrimCulling) override;
 
+    HDST_API
+    void ResetCompiledDrawCommands() override;
+
     /// Returns whether to do frustum culling on the GPU
     HDST_API
     static bool IsEnabledGPUFrustumCulling();
@@ -1065,10 +1065,57 @@ _GatherMaterialParams(
     }
 }
 
+// Returns the node path relative to the material prim so that equivalent
+// networks authored under different material prims hash identically.
+static SdfPath
+_GetMaterialRelativePath(SdfPath const& nodePath, SdfPath const& materialId)
+{
+    return nodePath.HasPrefix(materialId)
+        ? nodePath.MakeRelativePath(materialId)
+        : nodePath;
+}
+
+// Computes a hash identifying the network map, with node paths taken
+// relative to the material prim.  Two materials with the same hash produce
+// the same processing result (parameter values are included, so parameter
+// edits yield a new hash).
+static size_t
+_ComputeNetworkMapHash(
+    SdfPath const& materialId,
+    HdMaterialNetworkMap const& hdNetworkMap)
+{
+    Tf_HashState h;
+    for (auto const& nameToNetwork : hdNetworkMap.map) {
+        TfHashAppend(h, nameToNetwork.first);
+        HdMaterialNetwork const& network = nameToNetwork.second;
+        for (HdMaterialNode const& node : network.nodes) {
+            TfHashAppend(h, _GetMaterialRelativePath(node.path, materialId));
+            TfHashAppend(h, node.identifier);
+            for (auto const& param : node.parameters) {
+                TfHashAppend(h, param.first);
+                TfHashAppend(h, param.second.GetHash());
+            }
+        }
+        for (HdMaterialRelationship const& rel : network.relationships) {
+            TfHashAppend(h, _GetMaterialRelativePath(rel.inputId, materialId));
+            TfHashAppend(h, rel.inputName);
+            TfHashAppend(h, _GetMaterialRelativePath(rel.outputId, materialId));
+            TfHashAppend(h, rel.outputName);
+        }
+        TfHashAppend(h, network.primvars);
+    }
+    for (SdfPath const& terminal : hdNetworkMap.terminals) {
+        TfHashAppend(h, _GetMaterialRelativePath(terminal, materialId));
+    }
+    return h.GetCode();
+}
+
 HdStMaterialNetwork::HdStMaterialNetwork()
-    : _materialTag(HdStMaterialTagTokens->defaultMaterialTag)
-    , _surfaceGfxHash(0)
+    : _surfaceGfxHash(0)
+    , _networkHash(0)
+    , _result(std::make_shared<HdSt_MaterialNetworkResult>())
 {
+    _result->materialTag = HdStMaterialTagTokens->defaultMaterialTag;
 }
 
 HdStMaterialNetwork::~HdStMaterialNetwork() = default;
@@ -1081,31 +1128,47 @@ HdStMaterialNetwork::ProcessMaterialNetwork(
 {
     HD_TRACE_FUNCTION();
 
-    _fragmentSource.clear();
-    _geometrySource.clear();
-    _displacementSource.clear();
-    _materialMetadata.clear();
-    _materialParams.clear();
-    _textureDescriptors.clear();
-    _materialTag = HdStMaterialTagTokens->defaultMaterialTag;
+    // Scenes commonly carry many materials that are copies of a few unique
+    // networks, and an unchanged material re-syncs with the same map, so
+    // the full processing result is keyed on the network hash and shared
+    // through the resource registry.
+    const size_t networkHash = _ComputeNetworkMapHash(materialId,
+                                                      hdNetworkMap);
+    if (networkHash == _networkHash) {
+        return;
+    }
+    _networkHash = networkHash;
+
+    HdInstance<HdSt_MaterialNetworkResultSharedPtr> resultInstance =
+        resourceRegistry->RegisterMaterialNetworkResult(networkHash);
+    if (HdSt_MaterialNetworkResultSharedPtr const& shared =
+            resultInstance.GetValue()) {
+        _result = shared;
+        return;
+    }
+
+    HdSt_MaterialNetworkResultSharedPtr result =
+        std::make_shared<HdSt_MaterialNetworkResult>();
+    result->materialTag = HdStMaterialTagTokens->defaultMaterialTag;
 
     // The fragment source comes from the 'surface' network or the
     // 'volume' network.
     bool isVolume = false;
     HdMaterialNetwork2 surfaceNetwork =
         HdConvertToHdMaterialNetwork2(hdNetworkMap, &isVolume);
-    const TfToken &terminalName = (isVolume) ? HdMaterialTerminalTokens->volume 
+    const TfToken &terminalName = (isVolume) ? HdMaterialTerminalTokens->volume
                                             : HdMaterialTerminalTokens->surface;
 
     SdfPath surfTerminalPath;
-    if (HdMaterialNode2 const* surfTerminal = 
+    if (HdMaterialNode2 const* surfTerminal =
             _GetTerminalNode(surfaceNetwork, terminalName, &surfTerminalPath)) {
 
 #ifdef PXR_MATERIALX_SUPPORT_ENABLED
         if (!isVolume) {
-            _materialXGfx = HdSt_ApplyMaterialXFilter(&surfaceNetwork, materialId,
+            result->materialXGfx =
+                HdSt_ApplyMaterialXFilter(&surfaceNetwork, materialId,
                                       *surfTerminal, surfTerminalPath,
-                                      &_materialParams, resourceRegistry);
+                                      &result->params, resourceRegistry);
         }
 #endif
         // Extract the glslfx and metadata for surface/volume.
@@ -1117,72 +1180,90 @@ HdStMaterialNetwork::ProcessMaterialNetwork(
             // This produces no fragmentSource which means Storm's material
             // will use the fallback shader.
             if (_surfaceGfx->IsValid()) {
-                
-                _fragmentSource = _surfaceGfx->GetSurfaceSource();
-                _volumeSource = _surfaceGfx->GetVolumeSource();
 
-                _materialMetadata = _surfaceGfx->GetMetadata();
-                _materialTag = _GetMaterialTag(_materialMetadata, *surfTerminal);
+                result->fragmentSource = _surfaceGfx->GetSurfaceSource();
+                result->volumeSource = _surfaceGfx->GetVolumeSource();
+
+                result->metadata = _surfaceGfx->GetMetadata();
+                result->materialTag =
+                    _GetMaterialTag(result->metadata, *surfTerminal);
                 _GatherMaterialParams(surfaceNetwork, *surfTerminal,
-                                      &_materialParams, &_textureDescriptors, 
-                                      _materialTag);
+                                      &result->params,
+                                      &result->textureDescriptors,
+                                      result->materialTag);
 
                 // OSL networks have a displacement network in hdNetworkMap
                 // under terminal: HdMaterialTerminalTokens->displacement.
                 // For Storm however we expect the displacement shader to be
                 // provided via the surface glslfx / terminal.
-                _displacementSource = _surfaceGfx->GetDisplacementSource();
+                result->displacementSource =
+                    _surfaceGfx->GetDisplacementSource();
             }
         }
     }
+
+    // Textures located via a scene prim (e.g. draw targets) are identified
+    // by paths specific to this material's network, so such results are
+    // kept per material rather than published for sharing.
+    bool shareable = true;
+    for (TextureDescriptor const& desc : result->textureDescriptors) {
+        if (desc.useTexturePrimToFindTexture) {
+            shareable = false;
+            break;
+        }
+    }
+    if (shareable) {
+        resultInstance.SetValue(result);
+    }
+    _result = result;
 }
 
 TfToken const&
 HdStMaterialNetwork::GetMaterialTag() const
 {
-    return _materialTag;
+    return _result->materialTag;
 }
 
-std::string const& 
+std::string const&
 HdStMaterialNetwork::GetFragmentCode() const
 {
-    return _fragmentSource;
+    return _result->fragmentSource;
 }
 
-std::string const& 
+std::string const&
 HdStMaterialNetwork::GetVolumeCode() const
 {
-    return _volumeSource;
+    return _result->volumeSource;
 }
 
 std::string const&
 HdStMaterialNetwork::GetGeometryCode() const
 {
-    return _geometrySource;
+    return _result->geometrySource;
 }
 
 std::string const&
 HdStMaterialNetwork::GetDisplacementCode() const
 {
-    return _displacementSource;
+    return _result->displacementSource;
 }
 
 VtDictionary const&
 HdStMaterialNetwork::GetMetadata() const
 {
-    return _materialMetadata;
+    return _result->metadata;
 }
 
 HdSt_MaterialParamVector const&
 HdStMaterialNetwork::GetMaterialParams() const
 {
-    return _materialParams;
+    return _result->params;
 }
 
 HdStMaterialNetwork::TextureDescriptorVector const &
 HdStMaterialNetwork::GetTextureDescriptors() const
 {
-    return _textureDescriptors;
+    return _result->textureDescriptors;
 }
 
 
@@ -24,6 +24,10 @@ class HdStResourceRegistry;
 using HioGlslfxSharedPtr = std::shared_ptr<class HioGlslfx>;
 using HdSt_MaterialParamVector = std::vector<class HdSt_MaterialParam>;
 
+struct HdSt_MaterialNetworkResult;
+using HdSt_MaterialNetworkResultSharedPtr =
+    std::shared_ptr<HdSt_MaterialNetworkResult>;
+
 /// \class HdStMaterialNetwork
 ///
 /// Helps HdStMaterial process a Hydra material network into shader source code
@@ -96,18 +100,32 @@ public:
     TextureDescriptorVector const& GetTextureDescriptors() const;
 
 private:
-    TfToken _materialTag;
-    std::string _fragmentSource;
-    std::string _volumeSource;
-    std::string _geometrySource;
-    std::string _displacementSource;
-    VtDictionary _materialMetadata;
-    HdSt_MaterialParamVector _materialParams;
-    TextureDescriptorVector _textureDescriptors;
     HioGlslfxSharedPtr _surfaceGfx;
     size_t _surfaceGfxHash;
+
+    // Hash of the last processed network map and the (possibly shared)
+    // processing result it produced.
+    size_t _networkHash;
+    HdSt_MaterialNetworkResultSharedPtr _result;
+};
+
+/// \struct HdSt_MaterialNetworkResult
+///
+/// The outputs of processing a material network.  Results are shared through
+/// the resource registry across materials whose networks hash identically,
+/// so they must not be mutated after registration.
+struct HdSt_MaterialNetworkResult
+{
+    TfToken materialTag;
+    std::string fragmentSource;
+    std::string volumeSource;
+    std::string geometrySource;
+    std::string displacementSource;
+    VtDictionary metadata;
+    HdSt_MaterialParamVector params;
+    HdStMaterialNetwork::TextureDescriptorVector textureDescriptors;
 #ifdef PXR_MATERIALX_SUPPORT_ENABLED
-    MaterialX::ShaderPtr _materialXGfx;
+    MaterialX::ShaderPtr materialXGfx;
 #endif
 };
 
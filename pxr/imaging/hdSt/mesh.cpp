@@ -76,6 +76,7 @@ HdStMesh::HdStMesh(SdfPath const& id)
     , _topologyId(0)
     , _vertexPrimvarId(0)
     , _customDirtyBitsInUse(0)
+    , _deferredDirtyBits(HdChangeTracker::Clean)
     , _pointsDataType(HdTypeInvalid)
     , _sceneNormalsInterpolation()
     , _cullStyle(HdCullStyleDontCare)
@@ -111,6 +112,35 @@ HdStMesh::Sync(HdSceneDelegate *delegate,
 {
     _UpdateVisibility(delegate, dirtyBits);
 
+    if (!_deferredReprTokens.empty()) {
+        if (!IsVisible()) {
+            // Draw item creation is deferred and the prim is still hidden:
+            // accumulate the requested updates and skip this sync; they are
+            // replayed when the prim is first seen visible.
+            _deferredDirtyBits |= *dirtyBits;
+            *dirtyBits = HdChangeTracker::Clean;
+            return;
+        }
+
+        // First sync with the prim visible: create the deferred draw items
+        // and replay the dirty state accumulated while hidden.
+        *dirtyBits |= _deferredDirtyBits;
+        _deferredDirtyBits = HdChangeTracker::Clean;
+        for (TfToken const &deferredToken : _deferredReprTokens) {
+            _ReprVector::iterator it =
+                std::find_if(_reprs.begin(), _reprs.end(),
+                             _ReprComparator(deferredToken));
+            if (TF_VERIFY(it != _reprs.end())) {
+                _CreateReprDrawItems(it->second, deferredToken, dirtyBits);
+            }
+        }
+        _deferredReprTokens.clear();
+
+        // Notify render passes and the draw items cache that new draw items
+        // exist so that they re-gather.
+        HdStMarkDeferredDrawItemsCreated(renderParam);
+    }
+
     bool updateMaterialTags = false;
     if (*dirtyBits & HdChangeTracker::DirtyMaterialId) {
         HdStSetMaterialId(delegate, renderParam, this);
@@ -179,6 +209,12 @@ HdStMesh::Finalize(HdRenderParam *renderParam)
     // Decrement material tag counts for each draw item material tag
     for (auto const& reprPair : _reprs) {
         const TfToken &reprToken = reprPair.first;
+        // If draw item creation for this repr is still deferred, no items
+        // exist and no counts were ever increased.
+        if (std::find(_deferredReprTokens.begin(), _deferredReprTokens.end(),
+                      reprToken) != _deferredReprTokens.end()) {
+            continue;
+        }
         _MeshReprConfig::DescArray const &descs =
             _GetReprDesc(reprToken);
         HdReprSharedPtr repr = reprPair.second;
@@ -685,9 +721,13 @@ HdStMesh::_PopulateTopology(HdSceneDelegate *sceneDelegate,
                 // (see the lengthy comment in PopulateVertexPrimvar)
                 if (refineLevel > 0) {
                     // OpenSubdiv preprocessing
-                    HdBufferSourceSharedPtr
-                        topologySource = topology->GetOsdTopologyComputation(id);
-                    resourceRegistry->AddSource(topologySource);
+                    // (null when the refinement tables are shared with an
+                    // equivalent topology and have already been computed)
+                    if (HdBufferSourceSharedPtr topologySource =
+                            topology->GetOsdTopologyComputation(
+                                id, resourceRegistry.get())) {
+                        resourceRegistry->AddSource(topologySource);
+                    }
                 }
 
                 // we also need quadinfo if requested.
@@ -2235,6 +2275,10 @@ HdStMesh::_GetSharedPrimvarRange(uint64_t primvarId,
         barInstance.SetValue(range);
     } else {
         range = barInstance.GetValue();
+
+        // Another mesh with identical primvar data has already populated
+        // this range; count the allocation we avoided.
+        HD_PERF_COUNTER_INCR(HdPerfTokens->sharedPrimvarRangeHits);
     }
 
     if (isFirstInstance) {
@@ -2721,96 +2765,112 @@ HdStMesh::_InitRepr(TfToken const &reprToken, HdDirtyBits *dirtyBits)
         // ranges may change)
         *dirtyBits |= HdChangeTracker::NewRepr;
 
-        _MeshReprConfig::DescArray descs = _GetReprDesc(reprToken);
+        if (HdStIsDeferredDrawItemCreationEnabled()) {
+            // Defer draw item allocation until the prim is first seen
+            // visible; Sync creates the items then. The empty repr keeps
+            // draw item gathering benign for this prim in the meantime.
+            _deferredReprTokens.push_back(reprToken);
+            return;
+        }
 
-        // allocate all draw items
-        size_t numGeomSubsets = _topology ? 
-            _topology->GetGeomSubsets().size() : 0;
-        
-        for (size_t descIdx = 0; descIdx < descs.size(); ++descIdx) {
-            const HdMeshReprDesc &desc = descs[descIdx];
+        _CreateReprDrawItems(repr, reprToken, dirtyBits);
+    } // if new repr
+}
 
-            if (desc.geomStyle == HdMeshGeomStyleInvalid) {
-                continue;
-            }
+void
+HdStMesh::_CreateReprDrawItems(HdReprSharedPtr const &repr,
+                               TfToken const &reprToken,
+                               HdDirtyBits *dirtyBits)
+{
+    _MeshReprConfig::DescArray descs = _GetReprDesc(reprToken);
 
-            int geomSubsetTopologyIndexOffset = 0;
-            {
-                HdRepr::DrawItemUniquePtr drawItem =
-                    std::make_unique<HdStDrawItem>(&_sharedData);
-                HdDrawingCoord *drawingCoord = drawItem->GetDrawingCoord();
-                repr->AddDrawItem(std::move(drawItem));
-
-                switch (desc.geomStyle) {
-                    case HdMeshGeomStyleHull:
-                    case HdMeshGeomStyleHullEdgeOnly:
-                    case HdMeshGeomStyleHullEdgeOnSurf:
-                    {
-                        geomSubsetTopologyIndexOffset = 1; 
-                        drawingCoord->SetTopologyIndex(HdStMesh::HullTopology);
-                        if (!(_customDirtyBitsInUse & DirtyHullIndices)) {
-                            _customDirtyBitsInUse |= DirtyHullIndices;
-                            *dirtyBits |= DirtyHullIndices;
-                        }
-                        break;
+    // allocate all draw items
+    size_t numGeomSubsets = _topology ?
+        _topology->GetGeomSubsets().size() : 0;
+
+    for (size_t descIdx = 0; descIdx < descs.size(); ++descIdx) {
+        const HdMeshReprDesc &desc = descs[descIdx];
+
+        if (desc.geomStyle == HdMeshGeomStyleInvalid) {
+            continue;
+        }
+
+        int geomSubsetTopologyIndexOffset = 0;
+        {
+            HdRepr::DrawItemUniquePtr drawItem =
+                std::make_unique<HdStDrawItem>(&_sharedData);
+            HdDrawingCoord *drawingCoord = drawItem->GetDrawingCoord();
+            repr->AddDrawItem(std::move(drawItem));
+
+            switch (desc.geomStyle) {
+                case HdMeshGeomStyleHull:
+                case HdMeshGeomStyleHullEdgeOnly:
+                case HdMeshGeomStyleHullEdgeOnSurf:
+                {
+                    geomSubsetTopologyIndexOffset = 1; 
+                    drawingCoord->SetTopologyIndex(HdStMesh::HullTopology);
+                    if (!(_customDirtyBitsInUse & DirtyHullIndices)) {
+                        _customDirtyBitsInUse |= DirtyHullIndices;
+                        *dirtyBits |= DirtyHullIndices;
                     }
+                    break;
+                }
 
-                    case HdMeshGeomStylePoints:
-                    {
-                        // in the current implementation, we use topology
-                        // for points too, to draw a subset of vertex primvars
-                        // (note that the points may be followed by the refined
-                        // vertices)
-                        drawingCoord->SetTopologyIndex(HdStMesh::PointsTopology);
-                        if (!(_customDirtyBitsInUse & DirtyPointsIndices)) {
-                            _customDirtyBitsInUse |= DirtyPointsIndices;
-                            *dirtyBits |= DirtyPointsIndices;
-                        }
-                        break;
+                case HdMeshGeomStylePoints:
+                {
+                    // in the current implementation, we use topology
+                    // for points too, to draw a subset of vertex primvars
+                    // (note that the points may be followed by the refined
+                    // vertices)
+                    drawingCoord->SetTopologyIndex(HdStMesh::PointsTopology);
+                    if (!(_customDirtyBitsInUse & DirtyPointsIndices)) {
+                        _customDirtyBitsInUse |= DirtyPointsIndices;
+                        *dirtyBits |= DirtyPointsIndices;
                     }
+                    break;
+                }
 
-                    default:
-                    {
-                        if (!(_customDirtyBitsInUse & DirtyIndices)) {
-                            _customDirtyBitsInUse |= DirtyIndices;
-                            *dirtyBits |= DirtyIndices;
-                        }
+                default:
+                {
+                    if (!(_customDirtyBitsInUse & DirtyIndices)) {
+                        _customDirtyBitsInUse |= DirtyIndices;
+                        *dirtyBits |= DirtyIndices;
                     }
                 }
+            }
+
+            // Set up drawing coord instance primvars.
+            drawingCoord->SetInstancePrimvarBaseIndex(
+                HdStMesh::FreeSlot + 2 * numGeomSubsets);
+        }
 
-                // Set up drawing coord instance primvars.
+        // Allocate geom subset draw items
+        if (desc.geomStyle != HdMeshGeomStylePoints) {
+            for (size_t i = 0; i < numGeomSubsets; ++i) {
+                HdRepr::DrawItemUniquePtr drawItem =
+                    std::make_unique<HdStDrawItem>(&_sharedData);
+                HdDrawingCoord *drawingCoord = drawItem->GetDrawingCoord();
+                repr->AddGeomSubsetDrawItem(std::move(drawItem));
+                drawingCoord->SetTopologyIndex(
+                    HdStMesh::FreeSlot + 2 * i + 
+                        geomSubsetTopologyIndexOffset);
                 drawingCoord->SetInstancePrimvarBaseIndex(
                     HdStMesh::FreeSlot + 2 * numGeomSubsets);
             }
+        }
 
-            // Allocate geom subset draw items
-            if (desc.geomStyle != HdMeshGeomStylePoints) {
-                for (size_t i = 0; i < numGeomSubsets; ++i) {
-                    HdRepr::DrawItemUniquePtr drawItem =
-                        std::make_unique<HdStDrawItem>(&_sharedData);
-                    HdDrawingCoord *drawingCoord = drawItem->GetDrawingCoord();
-                    repr->AddGeomSubsetDrawItem(std::move(drawItem));
-                    drawingCoord->SetTopologyIndex(
-                        HdStMesh::FreeSlot + 2 * i + 
-                            geomSubsetTopologyIndexOffset);
-                    drawingCoord->SetInstancePrimvarBaseIndex(
-                        HdStMesh::FreeSlot + 2 * numGeomSubsets);
-                }
+        if (desc.flatShadingEnabled) {
+            if (!(_customDirtyBitsInUse & DirtyFlatNormals)) {
+                _customDirtyBitsInUse |= DirtyFlatNormals;
+                *dirtyBits |= DirtyFlatNormals;
             }
-
-            if (desc.flatShadingEnabled) {
-                if (!(_customDirtyBitsInUse & DirtyFlatNormals)) {
-                    _customDirtyBitsInUse |= DirtyFlatNormals;
-                    *dirtyBits |= DirtyFlatNormals;
-                }
-            } else {
-                if (!(_customDirtyBitsInUse & DirtySmoothNormals)) {
-                    _customDirtyBitsInUse |= DirtySmoothNormals;
-                    *dirtyBits |= DirtySmoothNormals;
-                }
+        } else {
+            if (!(_customDirtyBitsInUse & DirtySmoothNormals)) {
+                _customDirtyBitsInUse |= DirtySmoothNormals;
+                *dirtyBits |= DirtySmoothNormals;
             }
-        } // for each repr desc for the repr
-    } // if new repr
+        }
+    } // for each repr desc for the repr
 }
 
 void
@@ -75,6 +75,10 @@ protected:
     HDST_API
     void _InitRepr(TfToken const &reprToken, HdDirtyBits *dirtyBits) override;
 
+    void _CreateReprDrawItems(HdReprSharedPtr const &repr,
+                              TfToken const &reprToken,
+                              HdDirtyBits *dirtyBits);
+
     HDST_API
     HdDirtyBits _PropagateDirtyBits(HdDirtyBits bits) const override;
 
@@ -320,6 +324,13 @@ private:
     HdTopology::ID _vertexPrimvarId;
     HdDirtyBits _customDirtyBitsInUse;
 
+    // Reprs whose draw item creation has been deferred until the prim is
+    // first seen visible, along with the dirty bits accumulated while the
+    // prim remained hidden. Only used when deferred draw item creation is
+    // enabled; empty otherwise.
+    TfTokenVector _deferredReprTokens;
+    HdDirtyBits _deferredDirtyBits;
+
     HdType _pointsDataType;
     HdInterpolation _sceneNormalsInterpolation;
     HdCullStyle _cullStyle;
@@ -24,6 +24,8 @@
 #include "pxr/base/gf/vec3f.h"
 #include "pxr/base/tf/diagnostic.h"
 
+#include "pxr/base/arch/hash.h"
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 // Given an index builder buffer source and a face indices buffer source
@@ -282,7 +284,9 @@ HdSt_MeshTopology::RefinesToBoxSplineTrianglePatches() const
 }
 
 HdBufferSourceSharedPtr
-HdSt_MeshTopology::GetOsdTopologyComputation(SdfPath const &id)
+HdSt_MeshTopology::GetOsdTopologyComputation(
+    SdfPath const &id,
+    HdStResourceRegistry *resourceRegistry)
 {
     if (HdBufferSourceSharedPtr builder = _osdTopologyBuilder.lock()) {
         return builder;
@@ -294,14 +298,46 @@ HdSt_MeshTopology::GetOsdTopologyComputation(SdfPath const &id)
     bool const adaptive = RefinesToBSplinePatches() ||
                           RefinesToBoxSplineTrianglePatches();
 
-    // create HdSt_Subdivision
-    _subdivision = std::make_unique<HdSt_Subdivision>(adaptive, _refineLevel);
+    // The far analysis only depends on the base topology, the face-varying
+    // topologies and the refinement mode, so topologies registered under
+    // distinct ids (e.g. due to the quadrangulation salt) can still share
+    // one HdSt_Subdivision.
+    ID subdivisionId = ComputeHash();
+    for (VtIntArray const &fvarTopology : _fvarTopologies) {
+        subdivisionId = ArchHash64((const char*)fvarTopology.cdata(),
+                                   sizeof(int) * fvarTopology.size(),
+                                   subdivisionId);
+    }
+    subdivisionId = ArchHash64((const char*)&adaptive,
+                               sizeof(adaptive), subdivisionId);
+
+    // ask registry if there's a sharable subdivision
+    HdInstance<HdSt_SubdivisionSharedPtr> subdivisionInstance =
+        resourceRegistry->RegisterSubdivision(subdivisionId);
+
+    if (subdivisionInstance.IsFirstInstance()) {
+        // create HdSt_Subdivision
+        subdivisionInstance.SetValue(
+            std::make_shared<HdSt_Subdivision>(adaptive, _refineLevel));
+    }
+    _subdivision = subdivisionInstance.GetValue();
 
     if (!TF_VERIFY(_subdivision)) return HdBufferSourceSharedPtr();
 
-    // create a topology computation for HdSt_Subdivision
+    if (_subdivision->HasRefinementTables()) {
+        // The refinement tables have already been computed for an
+        // equivalent topology; no preprocessing is needed.
+        return HdBufferSourceSharedPtr();
+    }
+
+    // While the registry instance lock is held, chain onto a pending
+    // topology computation scheduled by an equivalent topology, if any.
     HdBufferSourceSharedPtr builder =
-        _subdivision->CreateTopologyComputation(this, id);
+        _subdivision->GetPendingTopologyComputation();
+    if (!builder) {
+        // create a topology computation for HdSt_Subdivision
+        builder = _subdivision->CreateTopologyComputation(this, id);
+    }
     _osdTopologyBuilder = builder; // retain weak ptr
     return builder;
 }
@@ -43,6 +43,8 @@ using HdSt_QuadInfoBuilderComputationSharedPtr =
 
 using HdSt_MeshTopologySharedPtr = std::shared_ptr<class HdSt_MeshTopology>;
 
+using HdSt_SubdivisionSharedPtr = std::shared_ptr<class HdSt_Subdivision>;
+
 
 
 /// \class HdSt_MeshTopology
@@ -190,7 +192,12 @@ public:
 
     /// Returns the subdivision topology computation. It computes
     /// far mesh and produces refined quad-indices buffer.
-    HdBufferSourceSharedPtr GetOsdTopologyComputation(SdfPath const &debugId);
+    /// The refinement tables are shared via \p resourceRegistry between
+    /// topologies with equivalent subdivision state; returns null if the
+    /// shared tables have already been computed.
+    HdBufferSourceSharedPtr GetOsdTopologyComputation(
+        SdfPath const &debugId,
+        HdStResourceRegistry *resourceRegistry);
 
     /// Returns the refined indices builder computation.
     /// This just returns index and primitive buffer, and should be preceded by
@@ -286,7 +293,7 @@ private:
 
     // OpenSubdiv
     RefineMode _refineMode;
-    std::unique_ptr<HdSt_Subdivision> _subdivision;
+    HdSt_SubdivisionSharedPtr _subdivision;
     HdBufferSourceWeakPtr _osdTopologyBuilder;
     HdBufferSourceWeakPtr _osdBaseFaceToRefinedFacesMap;
 
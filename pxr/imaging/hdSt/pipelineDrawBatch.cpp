@@ -42,6 +42,9 @@
 #include "pxr/base/tf/envSetting.h"
 #include "pxr/base/tf/staticTokens.h"
 
+#include "pxr/base/work/threadLimits.h"
+
+#include <algorithm>
 #include <iostream>
 #include <limits>
 
@@ -53,6 +56,7 @@ TF_DEFINE_PRIVATE_TOKENS(
     (constantPrimvars)
 
     (dispatchBuffer)
+    (drawCommandCount)
     (drawCullInput)
 
     (drawIndirect)
@@ -66,6 +70,13 @@ TF_DEFINE_PRIVATE_TOKENS(
 TF_DEFINE_ENV_SETTING(HDST_ENABLE_PIPELINE_DRAW_BATCH_GPU_FRUSTUM_CULLING, true,
                       "Enable pipeline draw batching GPU frustum culling");
 
+TF_DEFINE_ENV_SETTING(HDST_ENABLE_PIPELINE_DRAW_BATCH_GPU_CULL_COMPACTION,
+                      false,
+                      "Compact the GPU frustum culling output and draw only "
+                      "the surviving draw commands using an indirect count "
+                      "draw. Changes the relative order of draw commands "
+                      "within a batch.");
+
 HdSt_PipelineDrawBatch::HdSt_PipelineDrawBatch(
     HdStDrawItemInstance * drawItemInstance,
     bool const allowGpuFrustumCulling,
@@ -86,6 +97,8 @@ HdSt_PipelineDrawBatch::HdSt_PipelineDrawBatch(
     , _useInstancing(false)
     , _useGpuCulling(false)
     , _useInstanceCulling(false)
+    /* Set before culling shader compilation in _CreateCullingProgram(). */
+    , _useCullCompaction(false)
     , _allowGpuFrustumCulling(allowGpuFrustumCulling)
     , _allowIndirectCommandEncoding(allowIndirectCommandEncoding)
     , _instanceCountOffset(0)
@@ -141,6 +154,12 @@ HdSt_PipelineDrawBatch::SetEnableTinyPrimCulling(bool tinyPrimCulling)
     }
 }
 
+void
+HdSt_PipelineDrawBatch::ResetCompiledDrawCommands()
+{
+    _dispatchBuffer.reset();
+}
+
 /* static */
 bool
 HdSt_PipelineDrawBatch::IsEnabled(Hgi const *hgi)
@@ -175,6 +194,15 @@ HdSt_PipelineDrawBatch::IsEnabledGPUInstanceFrustumCulling()
     return HdSt_IndirectDrawBatch::IsEnabledGPUInstanceFrustumCulling();
 }
 
+/* static */
+bool
+HdSt_PipelineDrawBatch::IsEnabledGPUCullCompaction()
+{
+    static bool isEnabled = TfGetEnvSetting(
+        HDST_ENABLE_PIPELINE_DRAW_BATCH_GPU_CULL_COMPACTION);
+    return isEnabled;
+}
+
 ////////////////////////////////////////////////////////////
 // GPU Command Buffer Preparation
 ////////////////////////////////////////////////////////////
@@ -1410,7 +1438,7 @@ HdSt_PipelineDrawBatch::ExecuteDraw(
         if (drawIndirect) {
             _ExecuteDrawIndirect(gfxCmds, state.indexBar);
         } else {
-            _ExecuteDrawImmediate(gfxCmds, state.indexBar);
+            _ExecuteDrawImmediate(hgi, gfxCmds, state.indexBar);
         }
 
         hgi->DestroyResourceBindings(&resourceBindings);
@@ -1431,30 +1459,60 @@ HdSt_PipelineDrawBatch::_ExecuteDrawIndirect(
         GetBufferArrayRange()->GetResource(HdTokens->drawDispatch);
     if (!TF_VERIFY(paramBuffer)) return;
 
+    // When the culling shader has compacted the draw command stream, only
+    // the leading commands of the dispatch buffer are valid and the draw
+    // count lives in a GPU buffer written by the culling shader.
+    bool const useDrawCount = _useCullCompaction &&
+        TF_VERIFY(_drawCommandCountBuffer);
+
     if (!_useDrawIndexed) {
-        gfxCmds->DrawIndirect(
-            paramBuffer->GetHandle(),
-            paramBuffer->GetOffset(),
-            _dispatchBuffer->GetCount(),
-            paramBuffer->GetStride());
+        if (useDrawCount) {
+            gfxCmds->DrawIndirectCount(
+                paramBuffer->GetHandle(),
+                paramBuffer->GetOffset(),
+                _drawCommandCountBuffer->GetHandle(),
+                _drawCommandCountBuffer->GetOffset(),
+                _dispatchBuffer->GetCount(),
+                paramBuffer->GetStride());
+        } else {
+            gfxCmds->DrawIndirect(
+                paramBuffer->GetHandle(),
+                paramBuffer->GetOffset(),
+                _dispatchBuffer->GetCount(),
+                paramBuffer->GetStride());
+        }
     } else {
         HdStBufferResourceSharedPtr indexBuffer =
             indexBar->GetResource(HdTokens->indices);
         if (!TF_VERIFY(indexBuffer)) return;
 
-        gfxCmds->DrawIndexedIndirect(
-            indexBuffer->GetHandle(),
-            paramBuffer->GetHandle(),
-            paramBuffer->GetOffset(),
-            _dispatchBuffer->GetCount(),
-            paramBuffer->GetStride(),
-            _drawCommandBuffer,
-            _patchBaseVertexByteOffset);
+        if (useDrawCount) {
+            gfxCmds->DrawIndexedIndirectCount(
+                indexBuffer->GetHandle(),
+                paramBuffer->GetHandle(),
+                paramBuffer->GetOffset(),
+                _drawCommandCountBuffer->GetHandle(),
+                _drawCommandCountBuffer->GetOffset(),
+                _dispatchBuffer->GetCount(),
+                paramBuffer->GetStride(),
+                _drawCommandBuffer,
+                _patchBaseVertexByteOffset);
+        } else {
+            gfxCmds->DrawIndexedIndirect(
+                indexBuffer->GetHandle(),
+                paramBuffer->GetHandle(),
+                paramBuffer->GetOffset(),
+                _dispatchBuffer->GetCount(),
+                paramBuffer->GetStride(),
+                _drawCommandBuffer,
+                _patchBaseVertexByteOffset);
+        }
     }
 }
 
 void
 HdSt_PipelineDrawBatch::_ExecuteDrawImmediate(
+    Hgi * hgi,
     HgiGraphicsCmds * gfxCmds,
     HdStBufferArrayRangeSharedPtr const & indexBar)
 {
@@ -1463,20 +1521,39 @@ HdSt_PipelineDrawBatch::_ExecuteDrawImmediate(
     uint32_t const drawCount = _dispatchBuffer->GetCount();
     uint32_t const strideUInt32 = _dispatchBuffer->GetCommandNumUints();
 
+    // When the backend records command segments in parallel, split large
+    // batches into one segment per worker thread so that recording 100k+
+    // draw commands is not bound to a single core. Small batches stay on
+    // one segment; the fixed per-segment cost isn't worth it below this.
+    uint32_t constexpr minDrawsPerSegment = 2048;
+    uint32_t numSegments = 1;
+    if (hgi->GetCapabilities()->IsSet(
+            HgiDeviceCapabilitiesBitsParallelCmdsRecording)) {
+        numSegments = std::min(
+            static_cast<uint32_t>(WorkGetConcurrencyLimit()),
+            std::max(1u, drawCount / minDrawsPerSegment));
+    }
+
     if (!_useDrawIndexed) {
-        for (uint32_t i = 0; i < drawCount; ++i) {
-            _DrawNonIndexedCommand const * cmd =
-                reinterpret_cast<_DrawNonIndexedCommand*>(
-                    &_drawCommandBuffer[i * strideUInt32]);
-
-            if (cmd->common.count && cmd->common.instanceCount) {
-                gfxCmds->Draw(
-                    cmd->common.count,
-                    cmd->common.baseVertex,
-                    cmd->common.instanceCount,
-                    cmd->common.baseInstance);
-            }
-        }
+        gfxCmds->RecordParallel(
+            numSegments,
+            [&](uint32_t segment, HgiGraphicsCmds * segmentCmds) {
+                uint32_t const begin = segment * drawCount / numSegments;
+                uint32_t const end = (segment + 1) * drawCount / numSegments;
+                for (uint32_t i = begin; i < end; ++i) {
+                    _DrawNonIndexedCommand const * cmd =
+                        reinterpret_cast<_DrawNonIndexedCommand*>(
+                            &_drawCommandBuffer[i * strideUInt32]);
+
+                    if (cmd->common.count && cmd->common.instanceCount) {
+                        segmentCmds->Draw(
+                            cmd->common.count,
+                            cmd->common.baseVertex,
+                            cmd->common.instanceCount,
+                            cmd->common.baseInstance);
+                    }
+                }
+            });
     } else {
         HdStBufferResourceSharedPtr indexBuffer =
             indexBar->GetResource(HdTokens->indices);
@@ -1486,34 +1563,41 @@ HdSt_PipelineDrawBatch::_ExecuteDrawImmediate(
             _drawItemInstances[0]->GetDrawItem()->
                     GetGeometricShader()->GetUseMetalTessellation();
 
-        for (uint32_t i = 0; i < drawCount; ++i) {
-            _DrawIndexedCommand const * cmd =
-                reinterpret_cast<_DrawIndexedCommand*>(
-                    &_drawCommandBuffer[i * strideUInt32]);
-
-            uint32_t const indexBufferByteOffset =
-                static_cast<uint32_t>(cmd->common.baseIndex * sizeof(uint32_t));
-
-            if (cmd->common.count && cmd->common.instanceCount) {
-                if (useMetalTessellation) {
-                    gfxCmds->DrawIndexed(
-                        indexBuffer->GetHandle(),
-                        cmd->metalPatch.patchCount,
-                        indexBufferByteOffset,
-                        cmd->metalPatch.baseVertex,
-                        cmd->metalPatch.instanceCount,
-                        cmd->metalPatch.baseInstance);
-                } else {
-                    gfxCmds->DrawIndexed(
-                        indexBuffer->GetHandle(),
-                        cmd->common.count,
-                        indexBufferByteOffset,
-                        cmd->common.baseVertex,
-                        cmd->common.instanceCount,
-                        cmd->common.baseInstance);
+        gfxCmds->RecordParallel(
+            numSegments,
+            [&](uint32_t segment, HgiGraphicsCmds * segmentCmds) {
+                uint32_t const begin = segment * drawCount / numSegments;
+                uint32_t const end = (segment + 1) * drawCount / numSegments;
+                for (uint32_t i = begin; i < end; ++i) {
+                    _DrawIndexedCommand const * cmd =
+                        reinterpret_cast<_DrawIndexedCommand*>(
+                            &_drawCommandBuffer[i * strideUInt32]);
+
+                    uint32_t const indexBufferByteOffset =
+                        static_cast<uint32_t>(
+                            cmd->common.baseIndex * sizeof(uint32_t));
+
+                    if (cmd->common.count && cmd->common.instanceCount) {
+                        if (useMetalTessellation) {
+                            segmentCmds->DrawIndexed(
+                                indexBuffer->GetHandle(),
+                                cmd->metalPatch.patchCount,
+                                indexBufferByteOffset,
+                                cmd->metalPatch.baseVertex,
+                                cmd->metalPatch.instanceCount,
+                                cmd->metalPatch.baseInstance);
+                        } else {
+                            segmentCmds->DrawIndexed(
+                                indexBuffer->GetHandle(),
+                                cmd->common.count,
+                                indexBufferByteOffset,
+                                cmd->common.baseVertex,
+                                cmd->common.instanceCount,
+                                cmd->common.baseInstance);
+                        }
+                    }
                 }
-            }
-        }
+            });
     }
 }
 
@@ -1691,7 +1775,16 @@ HdSt_PipelineDrawBatch::_ExecuteFrustumCull(
                 _tokens->drawIndirectResult,
                 _resultBuffer,
                 _resultBuffer->GetOffset());
-                
+
+    }
+
+    if (_useCullCompaction) {
+        _ResetGPUDrawCommandCount(resourceRegistry);
+        state.binder.GetBufferBindingDesc(
+                &bindingsDesc,
+                _tokens->drawCommandCount,
+                _drawCommandCountBuffer,
+                _drawCommandCountBuffer->GetOffset());
     }
 
     // bind destination buffer
@@ -1812,7 +1905,7 @@ HdSt_PipelineDrawBatch::_ExecutePTCS(
     if (drawIndirect) {
         _ExecuteDrawIndirect(ptcsGfxCmds, state.indexBar);
     } else {
-        _ExecuteDrawImmediate(ptcsGfxCmds, state.indexBar);
+        _ExecuteDrawImmediate(hgi, ptcsGfxCmds, state.indexBar);
     }
 
     hgi->DestroyResourceBindings(&resourceBindings);
@@ -1919,15 +2012,62 @@ HdSt_PipelineDrawBatch::_EndGPUCountVisibleInstances(
     *result = count;
 }
 
+void
+HdSt_PipelineDrawBatch::_ResetGPUDrawCommandCount(
+    HdStResourceRegistrySharedPtr const & resourceRegistry)
+{
+    if (!_drawCommandCountBuffer) {
+        HdTupleType tupleType;
+        tupleType.type = HdTypeInt32;
+        tupleType.count = 1;
+
+        _drawCommandCountBuffer =
+            resourceRegistry->RegisterBufferResource(
+                _tokens->drawCommandCount, tupleType, HgiBufferUsageStorage);
+    }
+
+    // Reset the count of compacted draw commands, to be incremented by the
+    // culling shader for each surviving draw command.
+    static const int32_t count = 0;
+    HgiBlitCmds* blitCmds = resourceRegistry->GetGlobalBlitCmds();
+    HgiBufferCpuToGpuOp op;
+    op.cpuSourceBuffer = &count;
+    op.sourceByteOffset = 0;
+    op.gpuDestinationBuffer = _drawCommandCountBuffer->GetHandle();
+    op.destinationByteOffset = 0;
+    op.byteSize = sizeof(count);
+    blitCmds->CopyBufferCpuToGpu(op);
+
+    // The reset must have executed on the GPU before the culling shader
+    // runs in a later submission.
+    resourceRegistry->SubmitBlitWork();
+}
+
 void
 HdSt_PipelineDrawBatch::_CreateCullingProgram(
     HdStResourceRegistrySharedPtr const & resourceRegistry)
 {
+    // Compact the culled draw command stream only for non-instanced
+    // batches (the per-instance culling path rewrites the dispatch buffer
+    // in place) and only when the device can source the draw count for an
+    // indirect draw from a GPU buffer.
+    bool const useCullCompaction =
+        IsEnabledGPUCullCompaction() &&
+        !_useInstancing &&
+        resourceRegistry->GetHgi()->GetCapabilities()->
+            IsSet(HgiDeviceCapabilitiesBitsIndirectCountDraws);
+
+    if (useCullCompaction != _useCullCompaction) {
+        _useCullCompaction = useCullCompaction;
+        _dirtyCullingProgram = true;
+    }
+
     if (!_cullingProgram.GetGLSLProgram() || _dirtyCullingProgram) {
         // Create a culling compute shader key
         HdSt_CullingComputeShaderKey shaderKey(_useInstanceCulling,
             _useTinyPrimCulling,
-            IsEnabledGPUCountVisibleInstances());
+            IsEnabledGPUCountVisibleInstances(),
+            _useCullCompaction);
 
         // access the drawing coord from the drawCullInput buffer
         _CullingProgram::DrawingCoordBufferBinding drawingCoordBufferBinding{
@@ -1940,6 +2080,7 @@ HdSt_PipelineDrawBatch::_CreateCullingProgram(
         HdSt_GeometricShaderSharedPtr cullShader =
             HdSt_GeometricShader::Create(shaderKey, resourceRegistry);
         _cullingProgram.SetDrawingCoordBufferBinding(drawingCoordBufferBinding);
+        _cullingProgram.SetUseCompaction(_useCullCompaction);
         _cullingProgram.SetGeometricShader(cullShader);
 
         _cullingProgram.CompileShader(_drawItemInstances.front()->GetDrawItem(),
@@ -1985,6 +2126,11 @@ HdSt_PipelineDrawBatch::_CullingProgram::_GetCustomBindings(
     customBindings->push_back(HdStBindingRequest(HdStBinding::SSBO,
                                   _tokens->drawCullInput));
 
+    if (_useCompaction) {
+        customBindings->push_back(HdStBindingRequest(HdStBinding::SSBO,
+                                      _tokens->drawCommandCount));
+    }
+
     // set instanceDraw true if instanceCulling is enabled.
     // this value will be used to determine if glVertexAttribDivisor needs to
     // be enabled or not.
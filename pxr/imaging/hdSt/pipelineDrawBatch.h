@@ -73,6 +73,9 @@ public:
     HDST_API
     void SetEnableTinyPrimCulling(bool tinyPrimCulling) override;
 
+    HDST_API
+    void ResetCompiledDrawCommands() override;
+
     /// Returns whether pipeline draw batching is enabled.
     HDST_API
     static bool IsEnabled(Hgi const *hgi);
@@ -90,6 +93,13 @@ public:
     HDST_API
     static bool IsEnabledGPUInstanceFrustumCulling();
 
+    /// Returns whether to compact the culled draw command stream and
+    /// execute only the surviving draw commands using an indirect count
+    /// draw. Disabled by default, since compaction changes the relative
+    /// order of draw commands within a batch.
+    HDST_API
+    static bool IsEnabledGPUCullCompaction();
+
 protected:
     HDST_API
     void _Init(HdStDrawItemInstance * drawItemInstance) override;
@@ -102,10 +112,14 @@ private:
         _CullingProgram()
             : _useDrawIndexed(true)
             , _useInstanceCulling(false)
+            , _useCompaction(false)
             , _bufferArrayHash(0) { }
         void Initialize(bool useDrawIndexed,
                         bool useInstanceCulling,
                         size_t bufferArrayHash);
+        void SetUseCompaction(bool useCompaction) {
+            _useCompaction = useCompaction;
+        }
     protected:
         // _DrawingProgram overrides
         void _GetCustomBindings(
@@ -114,6 +128,7 @@ private:
     private:
         bool _useDrawIndexed;
         bool _useInstanceCulling;
+        bool _useCompaction;
         size_t _bufferArrayHash;
     };
 
@@ -134,6 +149,7 @@ private:
                 HdStBufferArrayRangeSharedPtr const & indexBar);
 
     void _ExecuteDrawImmediate(
+                Hgi * hgi,
                 HgiGraphicsCmds * gfxCmds,
                 HdStBufferArrayRangeSharedPtr const & indexBar);
 
@@ -155,6 +171,9 @@ private:
         HdStResourceRegistrySharedPtr const & resourceRegistry,
         size_t * result);
 
+    void _ResetGPUDrawCommandCount(
+        HdStResourceRegistrySharedPtr const & resourceRegistry);
+
     HdStDispatchBufferSharedPtr _dispatchBuffer;
     HdStDispatchBufferSharedPtr _dispatchBufferCullInput;
 
@@ -167,6 +186,7 @@ private:
     size_t _barElementOffsetsHash;
 
     HdStBufferResourceSharedPtr _resultBuffer;
+    HdStBufferResourceSharedPtr _drawCommandCountBuffer;
 
     size_t _numVisibleItems;
     size_t _numTotalVertices;
@@ -180,6 +200,7 @@ private:
     bool _useInstancing;
     bool _useGpuCulling;
     bool _useInstanceCulling;
+    bool _useCullCompaction;
     bool const _allowGpuFrustumCulling;
     bool const _allowIndirectCommandEncoding;
 
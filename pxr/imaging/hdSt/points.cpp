@@ -34,6 +34,8 @@ PXR_NAMESPACE_OPEN_SCOPE
 HdStPoints::HdStPoints(SdfPath const& id)
   : HdPoints(id)
   , _displayOpacity(false)
+  , _drawItemCreationDeferred(false)
+  , _deferredDirtyBits(HdChangeTracker::Clean)
 {
     /*NOTHING*/
 }
@@ -56,6 +58,28 @@ HdStPoints::Sync(HdSceneDelegate *delegate,
 {
     _UpdateVisibility(delegate, dirtyBits);
 
+    if (_drawItemCreationDeferred) {
+        if (!IsVisible()) {
+            // Draw item creation is deferred and the prim is still hidden:
+            // accumulate the requested updates and skip this sync; they are
+            // replayed when the prim is first seen visible.
+            _deferredDirtyBits |= *dirtyBits;
+            *dirtyBits = HdChangeTracker::Clean;
+            return;
+        }
+
+        // First sync with the prim visible: create the deferred draw items
+        // and replay the dirty state accumulated while hidden.
+        *dirtyBits |= _deferredDirtyBits;
+        _deferredDirtyBits = HdChangeTracker::Clean;
+        _CreateReprDrawItems(reprToken, dirtyBits);
+        _drawItemCreationDeferred = false;
+
+        // Notify render passes and the draw items cache that new draw items
+        // exist so that they re-gather.
+        HdStMarkDeferredDrawItemsCreated(renderParam);
+    }
+
     bool updateMaterialTags = false;
     if (*dirtyBits & HdChangeTracker::DirtyMaterialId) {
         HdStSetMaterialId(delegate, renderParam, this);
@@ -89,8 +113,10 @@ HdStPoints::Finalize(HdRenderParam *renderParam)
     HdStRenderParam * const stRenderParam =
         static_cast<HdStRenderParam*>(renderParam);
 
-    // Decrement material tag counts for each draw item material tag
-    if (!_reprs.empty()) {
+    // Decrement material tag counts for each draw item material tag.  If
+    // draw item creation is still deferred, no items exist and no counts
+    // were ever increased.
+    if (!_reprs.empty() && !_drawItemCreationDeferred) {
         const std::pair<TfToken, HdReprSharedPtr> &reprPair = _reprs.front();
         const TfToken &reprToken = reprPair.first;
         _PointsReprConfig::DescArray const &descs = _GetReprDesc(reprToken);
@@ -405,24 +431,16 @@ HdStPoints::_InitRepr(TfToken const &reprToken, HdDirtyBits *dirtyBits)
         _smoothHullRepr = std::make_shared<HdRepr>();
         *dirtyBits |= HdChangeTracker::NewRepr;
 
-        _PointsReprConfig::DescArray const &descs = _GetReprDesc(reprToken);
-        // allocate all draw items
-        for (size_t descIdx = 0; descIdx < descs.size(); ++descIdx) {
-            const HdPointsReprDesc &desc = descs[descIdx];
-
-            if (desc.geomStyle != HdPointsGeomStyleInvalid) {
-                HdRepr::DrawItemUniquePtr drawItem =
-                    std::make_unique<HdStDrawItem>(&_sharedData);
-                HdDrawingCoord *drawingCoord = drawItem->GetDrawingCoord();
-                _smoothHullRepr->AddDrawItem(std::move(drawItem));
-
-                // Set up drawing coord instance primvars.
-                drawingCoord->SetInstancePrimvarBaseIndex(
-                    HdStPoints::InstancePrimvar);
-            }
+        if (HdStIsDeferredDrawItemCreationEnabled()) {
+            // Defer draw item allocation until the prim is first seen
+            // visible; Sync creates the items then. The empty repr keeps
+            // draw item gathering benign for this prim in the meantime.
+            _drawItemCreationDeferred = true;
+        } else {
+            _CreateReprDrawItems(reprToken, dirtyBits);
         }
     }
-     
+
     _ReprVector::iterator it = std::find_if(_reprs.begin(), _reprs.end(),
                                             _ReprComparator(reprToken));
     bool isNew = it == _reprs.end();
@@ -433,5 +451,27 @@ HdStPoints::_InitRepr(TfToken const &reprToken, HdDirtyBits *dirtyBits)
     }
 }
 
+void
+HdStPoints::_CreateReprDrawItems(TfToken const &reprToken,
+                                 HdDirtyBits *dirtyBits)
+{
+    _PointsReprConfig::DescArray const &descs = _GetReprDesc(reprToken);
+    // allocate all draw items
+    for (size_t descIdx = 0; descIdx < descs.size(); ++descIdx) {
+        const HdPointsReprDesc &desc = descs[descIdx];
+
+        if (desc.geomStyle != HdPointsGeomStyleInvalid) {
+            HdRepr::DrawItemUniquePtr drawItem =
+                std::make_unique<HdStDrawItem>(&_sharedData);
+            HdDrawingCoord *drawingCoord = drawItem->GetDrawingCoord();
+            _smoothHullRepr->AddDrawItem(std::move(drawItem));
+
+            // Set up drawing coord instance primvars.
+            drawingCoord->SetInstancePrimvarBaseIndex(
+                HdStPoints::InstancePrimvar);
+        }
+    }
+}
+
 PXR_NAMESPACE_CLOSE_SCOPE
 
@@ -73,10 +73,20 @@ private:
 
     bool _displayOpacity;
 
+    // Whether draw item creation has been deferred until the prim is first
+    // seen visible, along with the dirty bits accumulated while the prim
+    // remained hidden. All repr tokens share _smoothHullRepr, so a single
+    // flag suffices.
+    bool _drawItemCreationDeferred;
+    HdDirtyBits _deferredDirtyBits;
+
     enum DrawingCoord {
         InstancePrimvar = HdDrawingCoord::CustomSlotsBegin
     };
 
+    void _CreateReprDrawItems(TfToken const &reprToken,
+                              HdDirtyBits *dirtyBits);
+
     void _UpdateDrawItem(HdSceneDelegate *sceneDelegate,
                          HdRenderParam *renderParam,
                          HdStDrawItem *drawItem,
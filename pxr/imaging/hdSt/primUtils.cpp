@@ -48,6 +48,12 @@ PXR_NAMESPACE_OPEN_SCOPE
 TF_DEFINE_ENV_SETTING(HDST_ENABLE_SHARED_VERTEX_PRIMVAR, 1,
                       "Enable sharing of vertex primvar");
 
+TF_DEFINE_ENV_SETTING(HDST_ENABLE_DEFERRED_DRAW_ITEM_CREATION, false,
+                      "Defer creation of a prim's draw items until the prim "
+                      "is first seen visible, rather than creating them when "
+                      "its repr is initialized. Avoids draw item construction "
+                      "and sync costs for prims that are never unhidden.");
+
 TF_MAKE_STATIC_DATA(
     HdSt_MaterialNetworkShaderSharedPtr,
     _fallbackWidgetShader)
@@ -89,6 +95,24 @@ HdStMarkGeomSubsetDrawItemsDirty(HdRenderParam *renderParam)
     }
 }
 
+bool
+HdStIsDeferredDrawItemCreationEnabled()
+{
+    static const bool enabled =
+        TfGetEnvSetting(HDST_ENABLE_DEFERRED_DRAW_ITEM_CREATION);
+    return enabled;
+}
+
+void
+HdStMarkDeferredDrawItemsCreated(HdRenderParam *renderParam)
+{
+    if (TF_VERIFY(renderParam)) {
+        HdStRenderParam *stRenderParam =
+            static_cast<HdStRenderParam*>(renderParam);
+        stRenderParam->MarkDeferredDrawItemsCreated();
+    }
+}
+
 void
 HdStMarkGarbageCollectionNeeded(HdRenderParam *renderParam)
 {
@@ -1256,7 +1280,7 @@ HdStComputeSharedPrimvarId(
             HdBufferSourceSharedPtr src = bufferSource->GetPreChainedBuffer();
 
             while (src) {
-                size_t chainedSourceId = bufferSource->ComputeHash();
+                size_t chainedSourceId = src->ComputeHash();
                 primvarId = ArchHash64((const char*)&chainedSourceId,
                                        sizeof(chainedSourceId), primvarId);
 
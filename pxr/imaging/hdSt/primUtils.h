@@ -52,6 +52,14 @@ void HdStMarkMaterialTagsDirty(HdRenderParam *renderParam);
 HDST_API
 void HdStMarkGeomSubsetDrawItemsDirty(HdRenderParam *renderParam);
 
+// Returns whether draw item creation is deferred until a prim is first
+// seen visible, rather than happening when its repr is initialized.
+HDST_API
+bool HdStIsDeferredDrawItemCreationEnabled();
+
+HDST_API
+void HdStMarkDeferredDrawItemsCreated(HdRenderParam *renderParam);
+
 HDST_API
 void HdStMarkGarbageCollectionNeeded(HdRenderParam *renderParam);
 
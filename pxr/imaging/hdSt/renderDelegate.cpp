@@ -220,6 +220,27 @@ HdStRenderDelegate::GetRenderStats() const
         gpuMemIt->second = VtValue(gpuMemTotal + texMem);
     }
 
+    // Fold in GPU execution times of labeled command submissions (e.g. the
+    // hdx tasks), measured with timestamp queries when the device supports
+    // them. Harvesting consumes the completed queries, so each measurement
+    // is reported exactly once.
+    if (_hgi && _hgi->SupportsGpuTimeQueries()) {
+        HgiGpuTimeQueryResultVector gpuTimes;
+        if (_hgi->ConsumeGpuTimeQueryResults(&gpuTimes)) {
+            VtDictionary gpuTimeMs;
+            for (HgiGpuTimeQueryResult const& result : gpuTimes) {
+                const std::string &key = result.name.GetString();
+                const double ms =
+                    VtDictionaryGet<double>(gpuTimeMs, key, VtDefault = 0.0);
+                gpuTimeMs[key] =
+                    VtValue(ms + double(result.nanoseconds) / 1.0e6);
+            }
+            if (!gpuTimeMs.empty()) {
+                ra["gpuTimeMs"] = VtValue(std::move(gpuTimeMs));
+            }
+        }
+    }
+
     return ra;
 }
 
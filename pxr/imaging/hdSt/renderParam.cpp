@@ -13,6 +13,7 @@ HdStRenderParam::HdStRenderParam()
     : _drawBatchesVersion(1)
     , _materialTagsVersion(1)
     , _geomSubsetDrawItemsVersion(1)
+    , _deferredDrawItemsVersion(1)
     , _needsGarbageCollection(false)
 {
 }
@@ -61,6 +62,20 @@ HdStRenderParam::GetGeomSubsetDrawItemsVersion() const
     return _geomSubsetDrawItemsVersion.load(std::memory_order_relaxed);
 }
 
+void
+HdStRenderParam::MarkDeferredDrawItemsCreated()
+{
+    ++_deferredDrawItemsVersion; // uses std::memory_order_seq_cst
+}
+
+unsigned int
+HdStRenderParam::GetDeferredDrawItemsVersion() const
+{
+    // Can use relaxed ordering because render passes are expected to
+    // only read the value, and that too in a single threaded fashion.
+    return _deferredDrawItemsVersion.load(std::memory_order_relaxed);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // materialTag tracking
 
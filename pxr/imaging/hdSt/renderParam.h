@@ -56,6 +56,16 @@ public:
     HDST_API
     unsigned int GetGeomSubsetDrawItemsVersion() const;
 
+    /// Marks that draw items whose creation had been deferred (for prims
+    /// that were invisible when their repr was initialized) have now been
+    /// created, meaning that the draw items associated with the collection
+    /// of a render pass need to be re-gathered.
+    HDST_API
+    void MarkDeferredDrawItemsCreated();
+
+    HDST_API
+    unsigned int GetDeferredDrawItemsVersion() const;
+
     // ---------------------------------------------------------------------- //
     /// Material tag tracking
     // ---------------------------------------------------------------------- /
@@ -124,6 +134,7 @@ private:
     std::atomic_uint _drawBatchesVersion;
     std::atomic_uint _materialTagsVersion;
     std::atomic_uint _geomSubsetDrawItemsVersion;
+    std::atomic_uint _deferredDrawItemsVersion;
     bool _needsGarbageCollection; // Doesn't need to be atomic since parallel
                                   // sync might only set it (and not clear).
 
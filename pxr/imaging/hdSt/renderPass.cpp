@@ -64,6 +64,15 @@ _GetGeomSubsetDrawItemsVersion(HdRenderIndex *renderIndex)
     return stRenderParam->GetGeomSubsetDrawItemsVersion();
 }
 
+unsigned int
+_GetDeferredDrawItemsVersion(HdRenderIndex *renderIndex)
+{
+    HdStRenderParam *stRenderParam = static_cast<HdStRenderParam*>(
+        renderIndex->GetRenderDelegate()->GetRenderParam());
+
+    return stRenderParam->GetDeferredDrawItemsVersion();
+}
+
 HdSt_RenderPass::HdSt_RenderPass(HdRenderIndex *index,
                                  HdRprimCollection const &collection)
     : HdRenderPass(index, collection)
@@ -74,6 +83,7 @@ HdSt_RenderPass::HdSt_RenderPass(HdRenderIndex *index,
     , _taskRenderTagsVersion(0)
     , _materialTagsVersion(0)
     , _geomSubsetDrawItemsVersion(0)
+    , _deferredDrawItemsVersion(0)
     , _collectionChanged(false)
     , _drawItemCount(0)
     , _drawItemsChanged(false)
@@ -138,6 +148,7 @@ HdSt_RenderPass::_Execute(HdRenderPassStateSharedPtr const &renderPassState,
     std::string prepareName = "HdSt_RenderPass: Prepare " +
         collection.GetMaterialTag().GetString();
 
+    prepareGfxCmds->SetSubmissionLabel(TfToken(prepareName));
     prepareGfxCmds->PushDebugGroup(prepareName.c_str());
 
     _cmdBuffer.PrepareDraw(prepareGfxCmds.get(),
@@ -157,6 +168,7 @@ HdSt_RenderPass::_Execute(HdRenderPassStateSharedPtr const &renderPassState,
     std::string passName = "HdSt_RenderPass: " +
         collection.GetMaterialTag().GetString();
 
+    gfxCmds->SetSubmissionLabel(TfToken(passName));
     gfxCmds->PushDebugGroup(passName.c_str());
 
     gfxCmds->SetViewport(stRenderPassState->ComputeViewport());
@@ -224,6 +236,9 @@ HdSt_RenderPass::_UpdateDrawItems(TfTokenVector const& renderTags)
     const unsigned int geomSubsetDrawItemsVersion =
         _GetGeomSubsetDrawItemsVersion(GetRenderIndex());
 
+    const unsigned int deferredDrawItemsVersion =
+        _GetDeferredDrawItemsVersion(GetRenderIndex());
+
     const bool collectionChanged = _collectionChanged ||
         (_collectionVersion != collectionVersion);
 
@@ -235,6 +250,9 @@ HdSt_RenderPass::_UpdateDrawItems(TfTokenVector const& renderTags)
     const bool geomSubsetDrawItemsChanged =
         _geomSubsetDrawItemsVersion != geomSubsetDrawItemsVersion;
 
+    const bool deferredDrawItemsChanged =
+        _deferredDrawItemsVersion != deferredDrawItemsVersion;
+
     const int taskRenderTagsVersion = tracker.GetTaskRenderTagsVersion();
     bool taskRenderTagsChanged = false;
     if (_taskRenderTagsVersion != taskRenderTagsVersion) {
@@ -249,6 +267,7 @@ HdSt_RenderPass::_UpdateDrawItems(TfTokenVector const& renderTags)
         rprimRenderTagChanged ||
         materialTagsChanged ||
         geomSubsetDrawItemsChanged ||
+        deferredDrawItemsChanged ||
         taskRenderTagsChanged) {
 
         if (TfDebug::IsEnabled(HDST_DRAW_ITEM_GATHER)) {
@@ -275,6 +294,11 @@ HdSt_RenderPass::_UpdateDrawItems(TfTokenVector const& renderTags)
                     "GeomSubsetDrawItemsChanged (version = %d -> %d)\n",
                     _geomSubsetDrawItemsVersion, geomSubsetDrawItemsVersion);
             }
+            if (deferredDrawItemsChanged) {
+                TfDebug::Helper::Msg(
+                    "DeferredDrawItemsChanged (version = %d -> %d)\n",
+                    _deferredDrawItemsVersion, deferredDrawItemsVersion);
+            }
             if (taskRenderTagsChanged) {
                 TfDebug::Helper::Msg( "TaskRenderTagsChanged\n" );
             }
@@ -301,6 +325,7 @@ HdSt_RenderPass::_UpdateDrawItems(TfTokenVector const& renderTags)
         _rprimRenderTagVersion = rprimRenderTagVersion;
         _materialTagsVersion = materialTagsVersion;
         _geomSubsetDrawItemsVersion = geomSubsetDrawItemsVersion;
+        _deferredDrawItemsVersion = deferredDrawItemsVersion;
     }
 }
 
@@ -74,6 +74,9 @@ private:
     // The version number of the geom subset draw items.
     unsigned int _geomSubsetDrawItemsVersion;
 
+    // The version number of deferred draw item creation.
+    unsigned int _deferredDrawItemsVersion;
+
     // A flag indicating that the held collection changed since this renderPass
     // was last drawn.
     //
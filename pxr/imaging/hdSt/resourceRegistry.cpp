@@ -33,6 +33,11 @@
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+TF_DEFINE_ENV_SETTING(HDST_ENABLE_HGI_MEMORY_DEFRAGMENTATION, false,
+    "Enable scheduling of incremental GPU memory defragmentation "
+    "(Hgi::DefragmentMemory) during garbage collection. Experimental; "
+    "requires that no resource bindings are cached across frames.");
+
 TF_DEFINE_ENV_SETTING(HDST_ENABLE_RESOURCE_INSTANCING, true,
                   "Enable instance registry deduplication of resource data");
 
@@ -138,6 +143,7 @@ void HdStResourceRegistry::InvalidateShaderRegistry()
 {
     _geometricShaderRegistry.Invalidate();
     _glslfxFileRegistry.Invalidate();
+    _materialNetworkResultRegistry.Invalidate();
 #ifdef PXR_MATERIALX_SUPPORT_ENABLED
     _materialXShaderRegistry.Invalidate();
 #endif
@@ -592,6 +598,14 @@ HdStResourceRegistry::RegisterVertexAdjacencyBuilder(
                      HdPerfTokens->instVertexAdjacency);
 }
 
+HdInstance<HdSt_SubdivisionSharedPtr>
+HdStResourceRegistry::RegisterSubdivision(
+        HdInstance<HdSt_SubdivisionSharedPtr>::ID id)
+{
+    return _Register(id, _subdivisionRegistry,
+                     HdPerfTokens->instSubdivision);
+}
+
 HdInstance<HdBufferArrayRangeSharedPtr>
 HdStResourceRegistry::RegisterMeshIndexRange(
         HdInstance<HdBufferArrayRangeSharedPtr>::ID id, TfToken const &name)
@@ -645,6 +659,13 @@ HdStResourceRegistry::RegisterGLSLFXFile(
     return _glslfxFileRegistry.GetInstance(id);
 }
 
+HdInstance<HdSt_MaterialNetworkResultSharedPtr>
+HdStResourceRegistry::RegisterMaterialNetworkResult(
+        HdInstance<HdSt_MaterialNetworkResultSharedPtr>::ID id)
+{
+    return _materialNetworkResultRegistry.GetInstance(id);
+}
+
 #ifdef PXR_MATERIALX_SUPPORT_ENABLED
 HdInstance<MaterialX::ShaderPtr>
 HdStResourceRegistry::RegisterMaterialXShader(
@@ -762,6 +783,80 @@ HdStResourceRegistry::SubmitComputeWork(HgiSubmitWaitType wait)
     }
 }
 
+void
+HdStResourceRegistry::AddBatchedComputeDispatch(
+    HgiComputePipelineHandle const &pipeline,
+    HgiResourceBindingsHandle const &resourceBindings,
+    std::vector<int32_t> &&constants,
+    int dispatchCount)
+{
+    _batchedDispatches.push_back(
+        { pipeline, resourceBindings, std::move(constants), dispatchCount });
+}
+
+void
+HdStResourceRegistry::_RecordBatchedComputeDispatches()
+{
+    if (_batchedDispatches.empty()) {
+        return;
+    }
+
+    // Group dispatches sharing a pipeline and resource bindings so that
+    // each group binds its state only once.
+    std::stable_sort(
+        _batchedDispatches.begin(), _batchedDispatches.end(),
+        [](_BatchedDispatch const &a, _BatchedDispatch const &b) {
+            if (a.pipeline.GetId() != b.pipeline.GetId()) {
+                return a.pipeline.GetId() < b.pipeline.GetId();
+            }
+            return a.resourceBindings.GetId() < b.resourceBindings.GetId();
+        });
+
+    HgiComputeCmds * const computeCmds = GetGlobalComputeCmds();
+    computeCmds->PushDebugGroup("BatchedComputeDispatch");
+
+    HgiComputePipelineHandle boundPipeline;
+    HgiResourceBindingsHandle boundResourceBindings;
+    _BatchedDispatch const *prev = nullptr;
+
+    for (_BatchedDispatch const &dispatch : _batchedDispatches) {
+        // Duplicate dispatches write identical data to identical
+        // locations; fold them into one.
+        if (prev &&
+            prev->pipeline == dispatch.pipeline &&
+            prev->resourceBindings == dispatch.resourceBindings &&
+            prev->dispatchCount == dispatch.dispatchCount &&
+            prev->constants == dispatch.constants) {
+            continue;
+        }
+        prev = &dispatch;
+
+        const bool pipelineChanged = boundPipeline != dispatch.pipeline;
+
+        // Rebind the resources whenever the pipeline changes; the
+        // bindings of the previous group may not be layout compatible.
+        if (pipelineChanged ||
+            boundResourceBindings != dispatch.resourceBindings) {
+            boundResourceBindings = dispatch.resourceBindings;
+            computeCmds->BindResources(boundResourceBindings);
+        }
+        if (pipelineChanged) {
+            boundPipeline = dispatch.pipeline;
+            computeCmds->BindPipeline(boundPipeline);
+        }
+
+        computeCmds->SetConstantValues(
+            dispatch.pipeline, 0,
+            sizeof(int32_t) * dispatch.constants.size(),
+            dispatch.constants.data());
+        computeCmds->Dispatch(dispatch.dispatchCount, 1);
+    }
+
+    computeCmds->PopDebugGroup();
+
+    _batchedDispatches.clear();
+}
+
 void
 HdStResourceRegistry::_CommitTextures()
 {
@@ -913,7 +1008,22 @@ HdStResourceRegistry::_Commit()
         // Ideally we wouldn't have requested the GPU copy at all (as it's
         // redundant) but we did, so we need to ensure these operations are
         // completed before we issue the CPU to GPU updates.
-        SubmitBlitWork(HgiSubmitWaitTypeWaitUntilCompleted);
+        //
+        // Only unified memory devices need the CPU-side wait, since their
+        // CPU to GPU updates are written directly by the CPU, bypassing the
+        // command stream. Elsewhere the updates are recorded into the same
+        // queue, so a memory barrier is sufficient to order them after the
+        // reallocation copies and the CPU does not stall on a full GPU
+        // round trip for every commit that reallocates.
+        if (_hgi->GetCapabilities()->IsSet(
+                HgiDeviceCapabilitiesBitsUnifiedMemory)) {
+            SubmitBlitWork(HgiSubmitWaitTypeWaitUntilCompleted);
+        } else {
+            if (_blitCmds) {
+                _blitCmds->InsertMemoryBarrier(HgiMemoryBarrierAll);
+            }
+            SubmitBlitWork();
+        }
     }
 
     {
@@ -985,6 +1095,10 @@ HdStResourceRegistry::_Commit()
                 HD_PERF_COUNTER_INCR(HdPerfTokens->computationsCommited);
             }
 
+            // Record dispatches that computations staged for batching
+            // before the queue is submitted.
+            _RecordBatchedComputeDispatches();
+
             // Submit Hgi work between each computation queue to feed GPU.
             // Some computations may use BlitCmds (CopyComputation) so we must
             // submit blit and compute work.
@@ -1067,6 +1181,13 @@ HdStResourceRegistry::_GarbageCollect()
         HD_PERF_COUNTER_SET(HdPerfTokens->instVertexAdjacency, count);
     }
 
+    // Collected after the mesh topology registry so that subdivisions
+    // referenced only by collected topologies are also collected.
+    {
+        size_t count = _subdivisionRegistry.GarbageCollect();
+        HD_PERF_COUNTER_SET(HdPerfTokens->instSubdivision, count);
+    }
+
     {
         size_t count = 0;
         for (auto & it: _meshTopologyIndexRangeRegistry) {
@@ -1097,6 +1218,7 @@ HdStResourceRegistry::_GarbageCollect()
     _geometricShaderRegistry.GarbageCollect();
     _glslProgramRegistry.GarbageCollect();
     _glslfxFileRegistry.GarbageCollect();
+    _materialNetworkResultRegistry.GarbageCollect();
 #ifdef PXR_MATERIALX_SUPPORT_ENABLED
     _materialXShaderRegistry.GarbageCollect();
 #endif
@@ -1120,6 +1242,13 @@ HdStResourceRegistry::_GarbageCollect()
 
     // Garbage collection may reallocate buffers, so we must submit blit work.
     SubmitBlitWork();
+
+    // Garbage collection runs between frames, after unused Hgi resources
+    // have been destroyed, so this is the natural point for the backend to
+    // compact its memory. One call performs a bounded amount of work.
+    if (TfGetEnvSetting(HDST_ENABLE_HGI_MEMORY_DEFRAGMENTATION)) {
+        _hgi->DefragmentMemory();
+    }
 }
 
 HdBufferArrayRangeSharedPtr
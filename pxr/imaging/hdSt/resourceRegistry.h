@@ -41,6 +41,8 @@ using HdStComputationSharedPtr = std::shared_ptr<class HdStComputation>;
 using HdStDispatchBufferSharedPtr = std::shared_ptr<class HdStDispatchBuffer>;
 using HdStGLSLProgramSharedPtr = std::shared_ptr<class HdStGLSLProgram>;
 using HioGlslfxSharedPtr = std::shared_ptr<class HioGlslfx>;
+using HdSt_MaterialNetworkResultSharedPtr =
+    std::shared_ptr<struct HdSt_MaterialNetworkResult>;
 
 using HdSt_BasisCurvesTopologySharedPtr =
     std::shared_ptr<class HdSt_BasisCurvesTopology>;
@@ -60,8 +62,10 @@ using HdStResourceRegistrySharedPtr =
     std::shared_ptr<class HdStResourceRegistry>;
 using HdSt_VertexAdjacencyBuilderSharedPtr = 
     std::shared_ptr<class HdSt_VertexAdjacencyBuilder>;
-using HdSt_MeshTopologySharedPtr = 
+using HdSt_MeshTopologySharedPtr =
     std::shared_ptr<class HdSt_MeshTopology>;
+using HdSt_SubdivisionSharedPtr =
+    std::shared_ptr<class HdSt_Subdivision>;
 using HgiResourceBindingsSharedPtr = 
     std::shared_ptr<HgiResourceBindingsHandle>;
 using HgiGraphicsPipelineSharedPtr = 
@@ -358,6 +362,11 @@ public:
     RegisterVertexAdjacencyBuilder(
         HdInstance<HdSt_VertexAdjacencyBuilderSharedPtr>::ID id);
 
+    /// Subdivision refinement table instancing
+    HDST_API
+    HdInstance<HdSt_SubdivisionSharedPtr>
+    RegisterSubdivision(HdInstance<HdSt_SubdivisionSharedPtr>::ID id);
+
     /// Topology Index buffer array range instancing
     /// Returns the HdInstance points to shared HdBufferArrayRange,
     /// distinguished by given ID.
@@ -405,6 +414,13 @@ public:
     HdInstance<HioGlslfxSharedPtr>
     RegisterGLSLFXFile(HdInstance<HioGlslfxSharedPtr>::ID id);
 
+    /// Register a processed material network result, shared across
+    /// materials whose networks hash identically.
+    HDST_API
+    HdInstance<HdSt_MaterialNetworkResultSharedPtr>
+    RegisterMaterialNetworkResult(
+        HdInstance<HdSt_MaterialNetworkResultSharedPtr>::ID id);
+
 #ifdef PXR_MATERIALX_SUPPORT_ENABLED
     /// Register MaterialX GLSLFX Shader.
     HDST_API
@@ -476,6 +492,21 @@ public:
     HDST_API
     void SubmitComputeWork(HgiSubmitWaitType wait = HgiSubmitWaitTypeNoWait);
 
+    /// Stages a compute dispatch for batched recording into the global
+    /// compute cmds. Dispatches staged while a compute queue executes are
+    /// recorded together before the queue is submitted: they are grouped
+    /// by pipeline and resource bindings so that each group binds its
+    /// state only once, and duplicate dispatches are folded into one.
+    /// Since grouping may reorder dispatches, this must only be used for
+    /// dispatches that have no ordering dependencies within their compute
+    /// queue.
+    HDST_API
+    void AddBatchedComputeDispatch(
+        HgiComputePipelineHandle const &pipeline,
+        HgiResourceBindingsHandle const &resourceBindings,
+        std::vector<int32_t> &&constants,
+        int dispatchCount);
+
     /// Returns the staging buffer used when committing data to the GPU.
     HDST_API
     HdStStagingBuffer* GetStagingBuffer();
@@ -603,6 +634,20 @@ private:
     typedef tbb::concurrent_vector<_PendingComputation> _PendingComputationList;
     _PendingComputationList  _pendingComputations[HdStComputeQueueCount];
 
+    // Compute dispatches staged for batched recording. Only accessed from
+    // the commit loop, which executes computations serially.
+    struct _BatchedDispatch {
+        HgiComputePipelineHandle pipeline;
+        HgiResourceBindingsHandle resourceBindings;
+        std::vector<int32_t> constants;
+        int dispatchCount;
+    };
+    std::vector<_BatchedDispatch> _batchedDispatches;
+
+    // Sort, coalesce and record the staged dispatches into the global
+    // compute cmds.
+    void _RecordBatchedComputeDispatches();
+
     // aggregated buffer array
     HdStBufferArrayRegistry _nonUniformBufferArrayRegistry;
     HdStBufferArrayRegistry _nonUniformImmutableBufferArrayRegistry;
@@ -638,6 +683,10 @@ private:
     HdInstanceRegistry<HdSt_VertexAdjacencyBuilderSharedPtr>
         _vertexAdjacencyBuilderRegistry;
 
+    // Register subdivision refinement tables.
+    HdInstanceRegistry<HdSt_SubdivisionSharedPtr>
+        _subdivisionRegistry;
+
     // Register topology index buffers.
     typedef HdInstanceRegistry<HdBufferArrayRangeSharedPtr>
         _TopologyIndexRangeInstanceRegistry;
@@ -669,6 +718,10 @@ private:
     HdInstanceRegistry<HioGlslfxSharedPtr>
         _glslfxFileRegistry;
 
+    // processed material network result registry
+    HdInstanceRegistry<HdSt_MaterialNetworkResultSharedPtr>
+        _materialNetworkResultRegistry;
+
 #ifdef PXR_MATERIALX_SUPPORT_ENABLED
     // MaterialX glslfx shader registry
     HdInstanceRegistry<MaterialX::ShaderPtr> _materialXShaderRegistry;
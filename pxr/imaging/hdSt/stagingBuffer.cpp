@@ -19,8 +19,17 @@ HdStStagingBuffer::HdStStagingBuffer(HdStResourceRegistry *resourceRegistry)
     , _capacity(0)
     , _activeSlot(0)
 {
-    _tripleBuffered = resourceRegistry->GetHgi()->GetCapabilities()->
-                          IsSet(HgiDeviceCapabilitiesBitsUnifiedMemory);
+    // With unified memory or persistently mapped staging buffers, writes
+    // through GetCPUStagingAddress are directly GPU-visible, so no CPU to
+    // GPU upload is issued at Flush.  Triple buffer so the CPU can stage
+    // the next batch while the GPU still reads the previous one.
+    HgiCapabilities const *capabilities =
+        resourceRegistry->GetHgi()->GetCapabilities();
+    _unifiedMemory =
+        capabilities->IsSet(HgiDeviceCapabilitiesBitsUnifiedMemory);
+    _tripleBuffered = _unifiedMemory ||
+        capabilities->IsSet(
+            HgiDeviceCapabilitiesBitsPersistentStagingBuffers);
 }
 
 HdStStagingBuffer::~HdStStagingBuffer()
@@ -69,9 +78,12 @@ HdStStagingBuffer::StageCopy(HgiBufferCpuToGpuOp const &copyOp)
     // stating buffer to avoid many small GPU buffer upload can be more
     // expensive than just submitting the CPU to GPU copy operation directly.
     // The value of 'queueThreshold' is estimated (when is the extra memcpy
-    // into the staging buffer slower than immediately issuing a gpu upload)
+    // into the staging buffer slower than immediately issuing a gpu upload).
+    // Such copies upload straight from the source data (e.g. a buffer
+    // source's span over mmap'ed array storage), so they neither copy twice
+    // nor grow the staging allocation.
     static const int queueThreshold = 512*1024;
-    if (!_tripleBuffered && copyOp.byteSize > queueThreshold) {
+    if (!_unifiedMemory && copyOp.byteSize > queueThreshold) {
         HgiBlitCmds* blitCmds = _resourceRegistry->GetGlobalBlitCmds();
         blitCmds->CopyBufferCpuToGpu(copyOp);
         return;
@@ -86,6 +98,8 @@ HdStStagingBuffer::StageCopy(HgiBufferCpuToGpuOp const &copyOp)
         buffer->GetDescriptor().byteSize < _capacity ||
         buffer->GetDescriptor().byteSize > _capacity * recoveryRatio) {
         HgiBufferDesc bufferDesc;
+        bufferDesc.debugName = "HdStStagingBuffer";
+        bufferDesc.usage = HgiBufferUsageStaging;
         bufferDesc.byteSize = _capacity;
 
         Hgi* hgi = _resourceRegistry->GetHgi();
@@ -69,6 +69,7 @@ private:
     size_t _capacity;
     size_t _activeSlot;
     bool _tripleBuffered;
+    bool _unifiedMemory;
     std::vector<HgiBufferGpuToGpuOp> _gpuCopyOps;
 };
 
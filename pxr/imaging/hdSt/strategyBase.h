@@ -64,6 +64,14 @@ public:
     /// (Optional) called to Flush consolidated / staging buffers.
     HDST_API
     virtual void Flush() {}
+
+    /// (Optional) pre-size a newly created buffer array so it can hold at
+    /// least \p numElements elements before needing to grow.  Strategies
+    /// that do not support capacity hints ignore this.
+    HDST_API
+    virtual void SetBufferCapacityHint(
+        HdBufferArraySharedPtr const & /*bufferArray*/,
+        size_t /*numElements*/) {}
 };
 
 
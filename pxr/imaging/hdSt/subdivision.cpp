@@ -724,6 +724,7 @@ HdSt_Subdivision::HdSt_Subdivision(bool adaptive, int refineLevel)
     : _adaptive(adaptive)
     , _refineLevel(refineLevel)
     , _maxNumFaceVarying(0)
+    , _refinementTablesSet(false)
 {
 }
 
@@ -750,6 +751,8 @@ HdSt_Subdivision::SetRefinementTables(
     for (size_t i = 0; i < _faceVaryingStencils.size(); ++i) {
         _maxNumFaceVarying = std::max(_maxNumFaceVarying, GetNumFaceVarying(i));
     }
+
+    _refinementTablesSet = true;
 }
 
 int
@@ -910,7 +913,10 @@ HdBufferSourceSharedPtr
 HdSt_Subdivision::CreateTopologyComputation(HdSt_MeshTopology *topology,
                                             SdfPath const &id)
 {
-    return std::make_shared<HdSt_OsdTopologyComputation>(topology, id);
+    HdBufferSourceSharedPtr builder =
+        std::make_shared<HdSt_OsdTopologyComputation>(topology, id);
+    _topologyBuilder = builder; // retain weak ptr
+    return builder;
 }
 
 HdBufferSourceSharedPtr
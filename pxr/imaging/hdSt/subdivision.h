@@ -27,6 +27,8 @@ PXR_NAMESPACE_OPEN_SCOPE
 
 using HdSt_GpuStencilTableSharedPtr =
         std::shared_ptr<class HdSt_GpuStencilTable>;
+using HdSt_SubdivisionSharedPtr =
+        std::shared_ptr<class HdSt_Subdivision>;
 
 /// \class Hd_Subdivision
 ///
@@ -118,6 +120,20 @@ public:
         std::vector<std::unique_ptr<StencilTable const>> && faceVaryingStencils,
         std::unique_ptr<PatchTable const> && patchTable);
 
+    /// Returns true once SetRefinementTables() has been called, i.e. the
+    /// far analysis for this subdivision has completed.
+    bool HasRefinementTables() const {
+        return _refinementTablesSet;
+    }
+
+    /// Returns the topology computation created by the most recent call
+    /// to CreateTopologyComputation() if it is still pending resolution,
+    /// otherwise null. Allows topologies sharing this subdivision to
+    /// depend on a single far analysis.
+    HdBufferSourceSharedPtr GetPendingTopologyComputation() const {
+        return _topologyBuilder.lock();
+    }
+
     StencilTable const *
     GetStencilTable(HdSt_MeshTopology::Interpolation interpolation,
                     int fvarChannel) const;
@@ -150,6 +166,9 @@ private:
     bool const _adaptive;
     int const _refineLevel;
     int _maxNumFaceVarying; // calculated during SetRefinementTables()
+    bool _refinementTablesSet;
+
+    HdBufferSourceWeakPtr _topologyBuilder;
 
     std::mutex _gpuStencilMutex;
     HdSt_GpuStencilTableSharedPtr _gpuVertexStencils;
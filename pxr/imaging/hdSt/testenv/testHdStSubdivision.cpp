@@ -78,8 +78,13 @@ _DumpRefinedPoints(std::string const & name,
     // build topology and allocate index buffer
     HdBufferSpecVector bufferSpecs;
     HdBufferSourceSharedPtr topology =
-                           rdTopology->GetOsdTopologyComputation(SdfPath(name));
-    registry->AddSource(topology);
+                           rdTopology->GetOsdTopologyComputation(
+                               SdfPath(name), registry.get());
+    if (topology) {
+        // null when the refinement tables are shared with an equivalent
+        // topology and have already been computed.
+        registry->AddSource(topology);
+    }
     HdBufferSourceSharedPtr index = rdTopology->GetOsdIndexBuilderComputation();
 
     index->GetBufferSpecs(&bufferSpecs);
@@ -493,8 +498,11 @@ PrimitiveIDMappingTest(bool usePtexIndex)
 
     // build topology and allocate index buffer
     HdBufferSourceSharedPtr topology
-        =  rdTopology->GetOsdTopologyComputation(SdfPath("/polygons"));
-    registry->AddSource(topology);
+        =  rdTopology->GetOsdTopologyComputation(
+            SdfPath("/polygons"), registry.get());
+    if (topology) {
+        registry->AddSource(topology);
+    }
 
     HdBufferSourceSharedPtr index = rdTopology->GetOsdIndexBuilderComputation();
 
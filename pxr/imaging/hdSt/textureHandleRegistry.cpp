@@ -12,11 +12,33 @@
 #include "pxr/imaging/hdSt/textureObject.h"
 #include "pxr/imaging/hdSt/textureHandle.h"
 
+#include "pxr/base/tf/envSetting.h"
+
 #include <mutex>
 #include <unordered_map>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+TF_DEFINE_ENV_SETTING(HDST_ENABLE_TIERED_TEXTURE_LOADING, false,
+    "Load textures at a small placeholder target memory first and "
+    "promote them to their full memory request over subsequent "
+    "commits.");
+
+TF_DEFINE_ENV_SETTING(HDST_TIERED_TEXTURE_PLACEHOLDER_MEMORY, 65536,
+    "Target memory in bytes for textures in the placeholder tier "
+    "when tiered texture loading is enabled.");
+
+TF_DEFINE_ENV_SETTING(HDST_TIERED_TEXTURE_PROMOTIONS_PER_COMMIT, 16,
+    "Maximum number of textures promoted from the placeholder tier "
+    "to their full memory request per commit when tiered texture "
+    "loading is enabled.");
+
+TF_DEFINE_ENV_SETTING(HDST_TIERED_TEXTURE_MEMORY_BUDGET, 0,
+    "Total GPU texture memory in megabytes that textures may consume "
+    "before the oldest promoted textures are demoted back to the "
+    "placeholder tier (0 disables the budget). Only has an effect "
+    "when tiered texture loading is enabled.");
+
 class HdSt_TextureHandleRegistry::_TextureToHandlesMap
 {
 public:
@@ -131,6 +153,16 @@ private:
 HdSt_TextureHandleRegistry::HdSt_TextureHandleRegistry(
     HdStResourceRegistry * registry)
     : _textureTypeToMemoryRequestChanged(false)
+    , _tieredLoadingEnabled(
+        TfGetEnvSetting(HDST_ENABLE_TIERED_TEXTURE_LOADING))
+    , _placeholderMemory(
+        std::max(TfGetEnvSetting(HDST_TIERED_TEXTURE_PLACEHOLDER_MEMORY), 1))
+    , _texturesPromotedPerCommit(
+        std::max(TfGetEnvSetting(HDST_TIERED_TEXTURE_PROMOTIONS_PER_COMMIT),
+                 1))
+    , _textureMemoryBudget(
+        size_t(std::max(TfGetEnvSetting(HDST_TIERED_TEXTURE_MEMORY_BUDGET),
+                        0)) * 1024 * 1024)
     , _samplerObjectRegistry(
         std::make_unique<HdSt_SamplerObjectRegistry>(registry))
     , _textureObjectRegistry(
@@ -226,10 +258,97 @@ HdSt_TextureHandleRegistry::_ComputeMemoryRequest(
     }
 
     if (hasHandle) {
+        if (_tieredLoadingEnabled) {
+            maxRequest = _ApplyResidencyTier(texture, maxRequest);
+        }
         texture->SetTargetMemory(maxRequest);
     }
 }
 
+// Clamp the memory request of a texture still in the placeholder
+// tier - enrolling textures not seen before for later promotion.
+size_t
+HdSt_TextureHandleRegistry::_ApplyResidencyTier(
+    HdStTextureObjectSharedPtr const &texture,
+    const size_t memoryRequest)
+{
+    const auto it =
+        _residencyTiers.emplace(texture, _ResidencyTier::Placeholder);
+    if (it.second) {
+        _promotionQueue.push_back(texture);
+    }
+
+    if (it.first->second == _ResidencyTier::Full) {
+        return memoryRequest;
+    }
+
+    // A request below the placeholder memory (note that 0 means
+    // unrestricted) needs no clamping.
+    if (memoryRequest > 0 && memoryRequest < _placeholderMemory) {
+        return memoryRequest;
+    }
+
+    return _placeholderMemory;
+}
+
+// Promote and demote textures between the residency tiers. Runs before
+// target memory is computed so that tier changes are picked up by this
+// commit.
+void
+HdSt_TextureHandleRegistry::_ProcessTierTransitions()
+{
+    TRACE_FUNCTION();
+
+    // Drop tier state for textures that were garbage collected.
+    for (auto it = _residencyTiers.begin(); it != _residencyTiers.end(); ) {
+        if (it->first.expired()) {
+            it = _residencyTiers.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    if (_textureMemoryBudget > 0 &&
+        size_t(_textureObjectRegistry->GetTotalTextureMemory()) >
+            _textureMemoryBudget) {
+        // Over budget: demote the oldest promoted textures back to the
+        // placeholder tier (bounded per commit) instead of promoting
+        // more. Demotions are sticky - demoted textures are not
+        // re-enqueued for promotion - to avoid reload thrashing when
+        // the budget is at capacity.
+        size_t numDemoted = 0;
+        while (numDemoted < _texturesPromotedPerCommit &&
+               !_demotionQueue.empty()) {
+            HdStTextureObjectPtr const texturePtr = _demotionQueue.front();
+            _demotionQueue.pop_front();
+            if (!texturePtr.expired()) {
+                _residencyTiers[texturePtr] = _ResidencyTier::Placeholder;
+                _dirtyTextures.push_back(texturePtr);
+                numDemoted++;
+            }
+        }
+        return;
+    }
+
+    // Promote a bounded number of textures per commit from the
+    // placeholder tier to their full memory request. There is no
+    // feedback channel from drawing (e.g., screen coverage) to
+    // prioritize promotions, so textures are promoted in allocation
+    // order.
+    size_t numPromoted = 0;
+    while (numPromoted < _texturesPromotedPerCommit &&
+           !_promotionQueue.empty()) {
+        HdStTextureObjectPtr const texturePtr = _promotionQueue.front();
+        _promotionQueue.pop_front();
+        if (!texturePtr.expired()) {
+            _residencyTiers[texturePtr] = _ResidencyTier::Full;
+            _demotionQueue.push_back(texturePtr);
+            _dirtyTextures.push_back(texturePtr);
+            numPromoted++;
+        }
+    }
+}
+
 // Compute target memory for textures.
 void
 HdSt_TextureHandleRegistry::_ComputeMemoryRequests(
@@ -389,6 +508,12 @@ HdSt_TextureHandleRegistry::_Commit()
 std::set<HdStShaderCodeSharedPtr>
 HdSt_TextureHandleRegistry::Commit()
 {
+    // Apply pending residency tier promotions and budget-driven
+    // demotions so that affected textures are reloaded by this commit.
+    if (_tieredLoadingEnabled) {
+        _ProcessTierTransitions();
+    }
+
     // Garbage collect texture handles and textures and compute
     // target memory for the textures before calling the commit
     // on the texture registry.
@@ -16,6 +16,7 @@
 
 #include <tbb/concurrent_vector.h>
 
+#include <deque>
 #include <set>
 #include <memory>
 
@@ -52,6 +53,14 @@ using HdStShaderCodeSharedPtr =
 /// collection, and determining what HdStShaderCode instances are
 /// affecting by (re-)committing a texture.
 ///
+/// When tiered texture loading is enabled (see
+/// HDST_ENABLE_TIERED_TEXTURE_LOADING), textures are first loaded at
+/// a small placeholder target memory and then promoted to their full
+/// memory request over subsequent commits - bounded per commit and by
+/// a global texture memory budget - so that scenes referencing many
+/// textures show (soft) imagery quickly instead of blocking on full
+/// resolution loads.
+///
 class HdSt_TextureHandleRegistry final
 {
 public:
@@ -137,6 +146,11 @@ private:
     void _ComputeMemoryRequests(const std::set<HdStTextureObjectSharedPtr> &);
     void _ComputeAllMemoryRequests();
 
+    size_t _ApplyResidencyTier(
+        HdStTextureObjectSharedPtr const &texture,
+        size_t memoryRequest);
+    void _ProcessTierTransitions();
+
     bool _GarbageCollectHandlesAndComputeTargetMemory();
     void _GarbageCollectAndComputeTargetMemory();
     std::set<HdStShaderCodeSharedPtr> _Commit();
@@ -165,6 +179,24 @@ private:
     // the texture).
     tbb::concurrent_vector<HdStShaderCodePtr> _dirtyShaders;
 
+    // Tiered texture loading state. Textures in the placeholder tier
+    // have their target memory clamped to _placeholderMemory until
+    // _ProcessTierTransitions promotes them to the full tier.
+    enum class _ResidencyTier { Placeholder, Full };
+
+    bool _tieredLoadingEnabled;
+    size_t _placeholderMemory;
+    size_t _texturesPromotedPerCommit;
+    size_t _textureMemoryBudget;
+
+    std::map<HdStTextureObjectPtr, _ResidencyTier,
+             std::owner_less<HdStTextureObjectPtr>> _residencyTiers;
+    // Textures awaiting promotion, in allocation order.
+    std::deque<HdStTextureObjectPtr> _promotionQueue;
+    // Promoted textures in promotion order - the oldest ones are
+    // demoted first when the texture memory budget is exceeded.
+    std::deque<HdStTextureObjectPtr> _demotionQueue;
+
     std::unique_ptr<class HdSt_SamplerObjectRegistry> _samplerObjectRegistry;
     std::unique_ptr<class HdSt_TextureObjectRegistry> _textureObjectRegistry;
     std::unique_ptr<_TextureToHandlesMap> _textureToHandlesMap;
@@ -10,6 +10,7 @@
 #include "pxr/base/gf/half.h"
 #include "pxr/base/gf/math.h"
 #include "pxr/base/trace/trace.h"
+#include "pxr/base/work/loops.h"
 
 #include "pxr/imaging/hgi/hgi.h"
 #include "pxr/imaging/hgi/blitCmds.h"
@@ -516,6 +517,75 @@ HdStTextureUtils::ComputeDimensionsFromTargetMemory(
     return mipInfos.back().dimensions;
 }
 
+// Reads and converts an image in bands of scanlines so that only a small
+// band of the native-resolution data is resident at any one time.  Used
+// when the image supports scanline reads and no resampling is needed;
+// e.g., converting a 16k scanline exr to RGBA this way avoids staging the
+// multi-GB full-resolution image.
+static
+bool
+_ReadAndConvertImageScanlines(
+    HioImageSharedPtr const &image,
+    const bool flipped,
+    const HdStTextureUtils::ConversionFunction conversionFunction,
+    const HgiMipInfo &mipInfo,
+    unsigned char * const mipLayerStart)
+{
+    TRACE_FUNCTION();
+
+    const int width = mipInfo.dimensions[0];
+    const int height = mipInfo.dimensions[1];
+
+    const size_t hioRowBytes =
+        HioGetDataSize(image->GetFormat(), GfVec3i(width, 1, 1));
+    const size_t hgiRowBytes = mipInfo.byteSizePerLayer / height;
+
+    // Aim for bands of ~4MB of source data.
+    constexpr size_t bandTargetBytes = 4 * 1024 * 1024;
+    const int bandRows = std::max<int>(
+        1, std::min<size_t>(height, bandTargetBytes / hioRowBytes));
+
+    std::unique_ptr<unsigned char[]> bandBuffer;
+    if (conversionFunction) {
+        bandBuffer = std::make_unique<unsigned char[]>(bandRows * hioRowBytes);
+    }
+
+    for (int rowStart = 0; rowStart < height; rowStart += bandRows) {
+        const int numRows = std::min(bandRows, height - rowStart);
+
+        HioImage::StorageSpec spec;
+        spec.width = width;
+        spec.height = numRows;
+        spec.format = image->GetFormat();
+        spec.flipped = flipped;
+        spec.data = conversionFunction
+            ? static_cast<void*>(bandBuffer.get())
+            : static_cast<void*>(mipLayerStart + rowStart * hgiRowBytes);
+
+        if (!image->ReadScanlines(rowStart, numRows, spec)) {
+            return false;
+        }
+
+        if (conversionFunction) {
+            // The band converts from a separate staging buffer, so rows
+            // can be converted in parallel; decode of the next band is
+            // serialized behind this, but conversion of a multi-MB band
+            // is memory-bound and splits well across cores.
+            WorkParallelForN(
+                numRows,
+                [&](size_t beginRow, size_t endRow) {
+                    conversionFunction(
+                        bandBuffer.get() + beginRow * hioRowBytes,
+                        static_cast<size_t>(width) * (endRow - beginRow),
+                        mipLayerStart +
+                            (rowStart + beginRow) * hgiRowBytes);
+                });
+        }
+    }
+
+    return true;
+}
+
 bool
 HdStTextureUtils::ReadAndConvertImage(
     HioImageSharedPtr const &image,
@@ -538,6 +608,16 @@ HdStTextureUtils::ReadAndConvertImage(
         static_cast<unsigned char*>(bufferStart)
         + mipInfo.byteOffset + layer * mipInfo.byteSizePerLayer;
 
+    // If the image can be decoded in bands of scanlines and no resampling
+    // is needed, read and convert it band by band rather than staging the
+    // full-resolution image.
+    if (image->SupportsScanlineReads() &&
+        image->GetWidth() == mipInfo.dimensions[0] &&
+        image->GetHeight() == mipInfo.dimensions[1]) {
+        return _ReadAndConvertImageScanlines(
+            image, flipped, conversionFunction, mipInfo, mipLayerStart);
+    }
+
     HioImage::StorageSpec spec;
     spec.width  = mipInfo.dimensions[0];
     spec.height = mipInfo.dimensions[1];
@@ -6,10 +6,12 @@
 //
 #include "pxr/imaging/hdSt/udimTextureObject.h"
 
+#include "pxr/imaging/hdSt/resourceRegistry.h"
 #include "pxr/imaging/hdSt/subtextureIdentifier.h"
 #include "pxr/imaging/hdSt/textureIdentifier.h"
 #include "pxr/imaging/hdSt/textureUtils.h"
 
+#include "pxr/imaging/hgi/blitCmds.h"
 #include "pxr/imaging/hgi/hgi.h"
 #include "pxr/imaging/hgi/texture.h"
 #include "pxr/imaging/hgi/types.h"
@@ -112,6 +114,7 @@ HdStUdimTextureObject::HdStUdimTextureObject(
   : HdStTextureObject(textureId, textureObjectRegistry)
   , _dimensions(0)
   , _mipCount(0)
+  , _generateMipmaps(false)
   , _hgiFormat(HgiFormatInvalid)
 {
 }
@@ -134,6 +137,13 @@ HdStUdimTextureObject::_DestroyTextures()
     }
 }
 
+static
+GfVec3i
+_GetDimensions(HioImageSharedPtr const &image)
+{
+    return GfVec3i(image->GetWidth(), image->GetHeight(), 1);
+}
+
 static
 const HioImageSharedPtr &
 _GetSmallestImageLargerThan(
@@ -184,9 +194,13 @@ HdStUdimTextureObject::_Load()
 
     _tileCount = static_cast<int>(tiles.size());
 
+    // The index of the mip image in firstImageMips that we start with.
+    size_t firstMip;
+
     _dimensions =
         HdStTextureUtils::ComputeDimensionsFromTargetMemory(
-            firstImageMips, _hgiFormat, _tileCount, GetTargetMemory());
+            firstImageMips, _hgiFormat, _tileCount, GetTargetMemory(),
+            &firstMip);
 
     // Texture array queries will use a float as the array specifier.
     const unsigned int maxTileId = std::get<0>(tiles.back()) + 1;
@@ -195,13 +209,37 @@ HdStUdimTextureObject::_Load()
     // Use Hgi to compute the mip sizes from the dimensions
     const std::vector<HgiMipInfo> mipInfos =
         HgiGetMipInfos(_hgiFormat, _dimensions, _tileCount);
-    _mipCount = mipInfos.size();
 
-    const HgiMipInfo &lastMipInfo = mipInfos.back();
+    // We always read the data of the first mip from the tile images.
+    // Determine, using the first tile as reference, how many of the
+    // following mips can be filled from authored mip images (c.f.
+    // HdStAssetUvTextureCpuData).
+    size_t numUsableMips = 1;
+    while (firstMip + numUsableMips < firstImageMips.size() &&
+           numUsableMips < mipInfos.size() &&
+           _GetDimensions(firstImageMips[firstMip + numUsableMips]) ==
+                                    mipInfos[numUsableMips].dimensions) {
+        numUsableMips++;
+    }
+
+    if (numUsableMips > 1) {
+        // We have authored mips we can use, so use them.
+        _mipCount = numUsableMips;
+    } else {
+        // No authored mips: read only the first mip of each tile and
+        // generate the remaining mips on the GPU during commit. This
+        // avoids decoding and downsampling each tile image once per
+        // mip level.
+        _generateMipmaps = true;
+        _mipCount = mipInfos.size();
+    }
+
+    const HgiMipInfo &lastReadMipInfo = mipInfos[numUsableMips - 1];
 
     // Allocate memory for the mipData, ready for upload to GPU
     _textureData.resize(
-        lastMipInfo.byteOffset + _tileCount * lastMipInfo.byteSizePerLayer);
+        lastReadMipInfo.byteOffset +
+        _tileCount * lastReadMipInfo.byteSizePerLayer);
 
     WorkParallelForN(tiles.size(), [&](size_t begin, size_t end) {
         for (size_t tileId = begin; tileId < end; ++tileId) {
@@ -213,7 +251,8 @@ HdStUdimTextureObject::_Load()
             if (images.empty()) {
                 continue;
             }
-            for (const HgiMipInfo &mipInfo : mipInfos) {
+            for (size_t i = 0; i < numUsableMips; ++i) {
+                const HgiMipInfo &mipInfo = mipInfos[i];
                 HioImageSharedPtr const &image =
                     _GetSmallestImageLargerThan(images, mipInfo.dimensions);
                 HdStTextureUtils::ReadAndConvertImage(
@@ -284,6 +323,14 @@ HdStUdimTextureObject::_Commit()
         texDesc.initialData = _textureData.data();
         texDesc.pixelsByteSize = _textureData.size();
         _texelTexture = hgi->CreateTexture(texDesc);
+
+        if (_generateMipmaps) {
+            HdStResourceRegistry * const registry = _GetResourceRegistry();
+            if (TF_VERIFY(registry)) {
+                HgiBlitCmds * const blitCmds = registry->GetGlobalBlitCmds();
+                blitCmds->GenerateMipMaps(_texelTexture);
+            }
+        }
     }
 
     // Layout GPU texture creation
@@ -77,6 +77,7 @@ private:
     GfVec3i _dimensions;
     size_t _tileCount;
     size_t _mipCount;
+    bool _generateMipmaps;
     HgiFormat _hgiFormat;
 
     HgiTextureHandle _texelTexture;
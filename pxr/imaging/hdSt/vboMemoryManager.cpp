@@ -122,6 +122,18 @@ HdStVBOMemoryManager::GetResourceAllocation(
 }
 
 
+/// Pre-sizes the buffer array to hold numElements elements
+void
+HdStVBOMemoryManager::SetBufferCapacityHint(
+    HdBufferArraySharedPtr const &bufferArray,
+    size_t numElements)
+{
+    _StripedBufferArraySharedPtr bufferArray_ =
+        std::static_pointer_cast<_StripedBufferArray> (bufferArray);
+    bufferArray_->SetCapacityHint(numElements);
+}
+
+
 // ---------------------------------------------------------------------------
 //  _StripedBufferArray
 // ---------------------------------------------------------------------------
@@ -134,6 +146,7 @@ HdStVBOMemoryManager::_StripedBufferArray::_StripedBufferArray(
       _resourceRegistry(resourceRegistry),
       _needsCompaction(false),
       _totalCapacity(0),
+      _capacityHint(0),
       _maxBytesPerElement(0),
       _bufferUsage(0)
 {
@@ -275,8 +288,6 @@ HdStVBOMemoryManager::_StripedBufferArray::Reallocate(
     HD_TRACE_FUNCTION();
     HF_MALLOC_TAG_FUNCTION();
 
-    HD_PERF_COUNTER_INCR(HdPerfTokens->vboRelocated);
-
     _StripedBufferArraySharedPtr curRangeOwner_ =
         std::static_pointer_cast<_StripedBufferArray> (curRangeOwner);
 
@@ -316,8 +327,55 @@ HdStVBOMemoryManager::_StripedBufferArray::Reallocate(
     // update range list (should be done before early exit)
     _SetRangeList(ranges);
 
-    _totalCapacity = totalNumElements;
-    
+    // If the current allocation is already large enough and no live range
+    // moves, extend in place: new ranges land in the spare tail capacity
+    // (typically reserved through SetCapacityHint) and no data needs to be
+    // copied.  Compaction must still run the full path so that removing
+    // ranges reclaims memory.
+    bool extendsInPlace =
+        (curRangeOwner_.get() == this) &&
+        !_needsCompaction &&
+        (_totalCapacity > 0) &&
+        (totalNumElements <= static_cast<size_t>(_totalCapacity));
+    if (extendsInPlace) {
+        for (size_t idx = 0; idx < ranges.size(); ++idx) {
+            _StripedBufferArrayRangeSharedPtr range =
+                std::static_pointer_cast<_StripedBufferArrayRange>(
+                    ranges[idx]);
+            // Ranges with capacity hold data at their current offset;
+            // they must not move.  Freshly assigned ranges have no data
+            // yet and may land anywhere.
+            if (!range ||
+                (range->GetCapacity() > 0 &&
+                 static_cast<size_t>(range->GetElementOffset()) !=
+                     newOffsets[idx])) {
+                extendsInPlace = false;
+                break;
+            }
+        }
+    }
+    if (extendsInPlace) {
+        for (size_t idx = 0; idx < ranges.size(); ++idx) {
+            _StripedBufferArrayRangeSharedPtr range =
+                std::static_pointer_cast<_StripedBufferArrayRange>(
+                    ranges[idx]);
+            range->SetElementOffset(newOffsets[idx]);
+            range->SetCapacity(range->GetNumElements());
+        }
+        _needsReallocation = false;
+        _needsCompaction = false;
+
+        // increment version to rebuild dispatch buffers.
+        IncrementVersion();
+        return;
+    }
+
+    HD_PERF_COUNTER_INCR(HdPerfTokens->vboRelocated);
+
+    // Reserve any capacity hint up front so population-time growth can be
+    // accommodated in place instead of with repeated grow-copy cycles.
+    _totalCapacity = std::max(totalNumElements, _capacityHint);
+
     Hgi* hgi = _resourceRegistry->GetHgi();
     HgiBlitCmds* blitCmds = _resourceRegistry->GetGlobalBlitCmds();
     blitCmds->PushDebugGroup(__ARCH_PRETTY_FUNCTION__);
@@ -64,9 +64,16 @@ public:
 
     /// Returns the size of the GPU memory used by the passed buffer array
     virtual size_t GetResourceAllocation(
-        HdBufferArraySharedPtr const &bufferArray, 
+        HdBufferArraySharedPtr const &bufferArray,
         VtDictionary &result) const;
 
+    /// Pre-sizes the buffer array so it can hold \p numElements elements
+    /// before needing to grow.
+    HDST_API
+    virtual void SetBufferCapacityHint(
+        HdBufferArraySharedPtr const &bufferArray,
+        size_t numElements);
+
 protected:
     class _StripedBufferArray;
 
@@ -265,6 +272,12 @@ protected:
             _needsCompaction = true;
         }
 
+        /// Sets the minimum element capacity to allocate on the next
+        /// reallocation.
+        void SetCapacityHint(size_t numElements) {
+            _capacityHint = numElements;
+        }
+
         /// Returns the GPU resource. If the buffer array contains more
         /// than one resource, this method raises a coding error.
         HDST_API
@@ -301,6 +314,7 @@ protected:
         HdStResourceRegistry* _resourceRegistry;
         bool _needsCompaction;
         int _totalCapacity;
+        size_t _capacityHint;
         size_t _maxBytesPerElement;
         HgiBufferUsage _bufferUsage;
 
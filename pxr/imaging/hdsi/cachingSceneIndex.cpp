@@ -0,0 +1,269 @@
+//
+// Copyright 2022 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+#include "pxr/imaging/hdsi/cachingSceneIndex.h"
+
+#include "pxr/imaging/hd/dataSource.h"
+
+#include <mutex>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+// Holds the memoized value for each cached locator of one prim.  A
+// std::mutex (rather than a spin mutex) serializes the fill since the
+// upstream evaluation being guarded may be expensive.
+struct Hdsi_CachingSceneIndexPrimCache
+{
+    explicit Hdsi_CachingSceneIndexPrimCache(size_t numSlots)
+        : values(numSlots)
+        , computed(numSlots, false)
+    {
+    }
+
+    // Returns the memoized value for \p slot, evaluating and storing
+    // \p input->Get(name) on the first pull.
+    HdDataSourceBaseHandle GetOrFill(
+        size_t slot,
+        const HdContainerDataSourceHandle &input,
+        const TfToken &name)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!computed[slot]) {
+            values[slot] = input->Get(name);
+            computed[slot] = true;
+        }
+        return values[slot];
+    }
+
+    // Drops the memoized value for \p slot so the next pull re-evaluates.
+    void Invalidate(size_t slot)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        values[slot] = nullptr;
+        computed[slot] = false;
+    }
+
+    std::mutex mutex;
+    std::vector<HdDataSourceBaseHandle> values;
+    std::vector<bool> computed;
+};
+
+namespace
+{
+
+using _PrimCacheSharedPtr = std::shared_ptr<Hdsi_CachingSceneIndexPrimCache>;
+using _LocatorVectorConstPtr =
+    std::shared_ptr<const std::vector<HdDataSourceLocator>>;
+
+// A locator tail still to be traversed, paired with the cache slot it
+// fills once fully traversed.
+struct _SlotLocator
+{
+    HdDataSourceLocator locator;
+    size_t slot;
+};
+using _SlotLocatorVector = std::vector<_SlotLocator>;
+
+/// Container that overlays memoized values at the given locator tails on
+/// top of \p input.  Pulls outside the tails forward to \p input.
+class _CachingContainerDataSource : public HdContainerDataSource
+{
+public:
+    HD_DECLARE_DATASOURCE(_CachingContainerDataSource);
+
+    TfTokenVector GetNames() override
+    {
+        return _input ? _input->GetNames() : TfTokenVector();
+    }
+
+    HdDataSourceBaseHandle Get(const TfToken &name) override
+    {
+        if (!_input) {
+            return nullptr;
+        }
+
+        // Collect the tails entered by this name.  A tail of length one
+        // ends here and is served from the cache; a longer tail requires
+        // descending into the child container.
+        _SlotLocatorVector childSlotLocators;
+        for (const _SlotLocator &slotLocator : _slotLocators) {
+            if (slotLocator.locator.GetFirstElement() != name) {
+                continue;
+            }
+            if (slotLocator.locator.GetElementCount() == 1) {
+                return _cache->GetOrFill(slotLocator.slot, _input, name);
+            }
+            childSlotLocators.push_back(
+                { slotLocator.locator.RemoveFirstElement(),
+                  slotLocator.slot });
+        }
+
+        HdDataSourceBaseHandle result = _input->Get(name);
+        if (!childSlotLocators.empty()) {
+            if (HdContainerDataSourceHandle container =
+                    HdContainerDataSource::Cast(result)) {
+                return _CachingContainerDataSource::New(
+                    container, _cache, std::move(childSlotLocators));
+            }
+        }
+        return result;
+    }
+
+private:
+    _CachingContainerDataSource(
+        HdContainerDataSourceHandle input,
+        _PrimCacheSharedPtr cache,
+        _SlotLocatorVector slotLocators)
+        : _input(std::move(input))
+        , _cache(std::move(cache))
+        , _slotLocators(std::move(slotLocators))
+    {
+    }
+
+    HdContainerDataSourceHandle _input;
+    _PrimCacheSharedPtr _cache;
+    _SlotLocatorVector _slotLocators;
+};
+
+};
+
+// static
+HdsiCachingSceneIndexRefPtr
+HdsiCachingSceneIndex::New(
+    const HdSceneIndexBaseRefPtr &inputSceneIndex,
+    const HdDataSourceLocatorSet &cachedLocators)
+{
+    return TfCreateRefPtr(
+        new HdsiCachingSceneIndex(inputSceneIndex, cachedLocators));
+}
+
+HdSceneIndexPrim
+HdsiCachingSceneIndex::GetPrim(const SdfPath &primPath) const
+{
+    if (auto input = _GetInputSceneIndex()) {
+        HdSceneIndexPrim prim = input->GetPrim(primPath);
+        if (prim.dataSource && !_cachedLocators->empty()) {
+            _SlotLocatorVector slotLocators;
+            slotLocators.reserve(_cachedLocators->size());
+            for (size_t i = 0; i < _cachedLocators->size(); ++i) {
+                slotLocators.push_back({ (*_cachedLocators)[i], i });
+            }
+            prim.dataSource = _CachingContainerDataSource::New(
+                prim.dataSource,
+                _GetOrCreatePrimCache(primPath),
+                std::move(slotLocators));
+        }
+        return prim;
+    }
+    return { TfToken(), nullptr };
+}
+
+SdfPathVector
+HdsiCachingSceneIndex::GetChildPrimPaths(const SdfPath &primPath) const
+{
+    if (auto input = _GetInputSceneIndex()) {
+        return input->GetChildPrimPaths(primPath);
+    }
+    return {};
+}
+
+void
+HdsiCachingSceneIndex::_PrimsAdded(
+    const HdSceneIndexBase &sender,
+    const HdSceneIndexObserver::AddedPrimEntries &entries)
+{
+    // A re-added prim is a full resync; drop its cache.
+    {
+        tbb::spin_rw_mutex::scoped_lock lock(_primCachesMutex,
+                                             /*write =*/ true);
+        for (const HdSceneIndexObserver::AddedPrimEntry &entry : entries) {
+            _primCaches.erase(entry.primPath);
+        }
+    }
+    _SendPrimsAdded(entries);
+}
+
+void
+HdsiCachingSceneIndex::_PrimsRemoved(
+    const HdSceneIndexBase &sender,
+    const HdSceneIndexObserver::RemovedPrimEntries &entries)
+{
+    {
+        tbb::spin_rw_mutex::scoped_lock lock(_primCachesMutex,
+                                             /*write =*/ true);
+        for (const HdSceneIndexObserver::RemovedPrimEntry &entry : entries) {
+            if (entry.primPath.IsAbsoluteRootPath()) {
+                _primCaches.clear();
+                break;
+            }
+            for (auto it = _primCaches.begin(); it != _primCaches.end(); ) {
+                if (it->first.HasPrefix(entry.primPath)) {
+                    it = _primCaches.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+        }
+    }
+    _SendPrimsRemoved(entries);
+}
+
+void
+HdsiCachingSceneIndex::_PrimsDirtied(
+    const HdSceneIndexBase &sender,
+    const HdSceneIndexObserver::DirtiedPrimEntries &entries)
+{
+    {
+        tbb::spin_rw_mutex::scoped_lock lock(_primCachesMutex,
+                                             /*write =*/ false);
+        for (const HdSceneIndexObserver::DirtiedPrimEntry &entry : entries) {
+            const auto it = _primCaches.find(entry.primPath);
+            if (it == _primCaches.end()) {
+                continue;
+            }
+            for (size_t i = 0; i < _cachedLocators->size(); ++i) {
+                if (entry.dirtyLocators.Intersects((*_cachedLocators)[i])) {
+                    it->second->Invalidate(i);
+                }
+            }
+        }
+    }
+    _SendPrimsDirtied(entries);
+}
+
+HdsiCachingSceneIndex::HdsiCachingSceneIndex(
+    const HdSceneIndexBaseRefPtr &inputSceneIndex,
+    const HdDataSourceLocatorSet &cachedLocators)
+    : HdSingleInputFilteringSceneIndexBase(inputSceneIndex)
+    , _cachedLocators(
+        std::make_shared<const std::vector<HdDataSourceLocator>>(
+            cachedLocators.begin(), cachedLocators.end()))
+{
+}
+
+HdsiCachingSceneIndex::~HdsiCachingSceneIndex() = default;
+
+HdsiCachingSceneIndex::_PrimCacheSharedPtr
+HdsiCachingSceneIndex::_GetOrCreatePrimCache(const SdfPath &primPath) const
+{
+    {
+        tbb::spin_rw_mutex::scoped_lock lock(_primCachesMutex,
+                                             /*write =*/ false);
+        const auto it = _primCaches.find(primPath);
+        if (it != _primCaches.end()) {
+            return it->second;
+        }
+    }
+
+    tbb::spin_rw_mutex::scoped_lock lock(_primCachesMutex, /*write =*/ true);
+    _PrimCacheSharedPtr &cache = _primCaches[primPath];
+    if (!cache) {
+        cache = std::make_shared<Hdsi_CachingSceneIndexPrimCache>(
+            _cachedLocators->size());
+    }
+    return cache;
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
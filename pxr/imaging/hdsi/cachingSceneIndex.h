@@ -0,0 +1,90 @@
+//
+// Copyright 2022 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+#ifndef PXR_IMAGING_HDSI_CACHING_SCENE_INDEX_H
+#define PXR_IMAGING_HDSI_CACHING_SCENE_INDEX_H
+
+#include "pxr/imaging/hd/dataSourceLocator.h"
+#include "pxr/imaging/hd/filteringSceneIndex.h"
+#include "pxr/imaging/hdsi/api.h"
+
+#include "pxr/pxr.h"
+
+#include <tbb/spin_rw_mutex.h>
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+// Per-prim cache storage shared between the scene index and the data
+// sources it hands out; defined in the translation unit.
+struct Hdsi_CachingSceneIndexPrimCache;
+
+TF_DECLARE_REF_PTRS(HdsiCachingSceneIndex);
+
+/// Scene index that memoizes the data sources found at a fixed set of
+/// locators on each prim.  The first consumer to pull on a cached locator
+/// evaluates the upstream data source and stores the result; subsequent
+/// pulls return the stored handle until a dirtied prim entry whose dirty
+/// locators intersect the cached locator invalidates it.  This lets
+/// expensive upstream computation (procedural expansion, implicit surface
+/// tessellation, etc.) run once per change instead of once per consumer.
+///
+/// Data sources at locators outside the cached set are forwarded from the
+/// input scene unmodified.
+class HdsiCachingSceneIndex final : public HdSingleInputFilteringSceneIndexBase
+{
+public:
+    HDSI_API
+    static HdsiCachingSceneIndexRefPtr
+    New(const HdSceneIndexBaseRefPtr &inputSceneIndex,
+        const HdDataSourceLocatorSet &cachedLocators);
+
+public: // HdSceneIndex overrides
+    HDSI_API
+    HdSceneIndexPrim GetPrim(const SdfPath &primPath) const override;
+    HDSI_API
+    SdfPathVector GetChildPrimPaths(const SdfPath &primPath) const override;
+
+protected: // HdSingleInputFilteringSceneIndexBase overrides
+    void _PrimsAdded(
+        const HdSceneIndexBase &sender,
+        const HdSceneIndexObserver::AddedPrimEntries &entries) override;
+    void _PrimsRemoved(
+        const HdSceneIndexBase &sender,
+        const HdSceneIndexObserver::RemovedPrimEntries &entries) override;
+    void _PrimsDirtied(
+        const HdSceneIndexBase &sender,
+        const HdSceneIndexObserver::DirtiedPrimEntries &entries) override;
+
+protected:
+    HdsiCachingSceneIndex(
+        const HdSceneIndexBaseRefPtr &inputSceneIndex,
+        const HdDataSourceLocatorSet &cachedLocators);
+    ~HdsiCachingSceneIndex() override;
+
+private:
+    using _PrimCacheSharedPtr =
+        std::shared_ptr<Hdsi_CachingSceneIndexPrimCache>;
+
+    // Returns the cache for \p primPath, creating it on first use.
+    _PrimCacheSharedPtr _GetOrCreatePrimCache(const SdfPath &primPath) const;
+
+    // The cached locators, in set order; cache slots are indices into this
+    // vector.  Shared with the data sources handed out by GetPrim so they
+    // remain valid if they outlive this scene index.
+    std::shared_ptr<const std::vector<HdDataSourceLocator>> _cachedLocators;
+
+    using _PrimCacheMap =
+        std::unordered_map<SdfPath, _PrimCacheSharedPtr, SdfPath::Hash>;
+    mutable _PrimCacheMap _primCaches;
+    mutable tbb::spin_rw_mutex _primCachesMutex;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif
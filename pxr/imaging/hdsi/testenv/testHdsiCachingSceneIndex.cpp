@@ -0,0 +1,217 @@
+//
+// Copyright 2022 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+
+#include "pxr/imaging/hd/retainedDataSource.h"
+#include "pxr/imaging/hd/retainedSceneIndex.h"
+#include "pxr/imaging/hdsi/cachingSceneIndex.h"
+
+#include "pxr/base/tf/diagnostic.h"
+
+#include <atomic>
+#include <cstdio>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace
+{
+
+TF_DEFINE_PRIVATE_TOKENS(
+    _tokens,
+    (cheap)
+    (expensive)
+    (nested)
+    (value)
+);
+
+// Container that counts how often its children are pulled, standing in
+// for an expensive upstream computation.
+class _CountingContainerDataSource : public HdContainerDataSource
+{
+public:
+    HD_DECLARE_DATASOURCE(_CountingContainerDataSource);
+
+    TfTokenVector GetNames() override
+    {
+        return { _tokens->expensive, _tokens->cheap, _tokens->nested };
+    }
+
+    HdDataSourceBaseHandle Get(const TfToken &name) override
+    {
+        if (name == _tokens->expensive) {
+            ++numExpensivePulls;
+            return HdRetainedTypedSampledDataSource<int>::New(42);
+        }
+        if (name == _tokens->cheap) {
+            ++numCheapPulls;
+            return HdRetainedTypedSampledDataSource<int>::New(1);
+        }
+        if (name == _tokens->nested) {
+            return HdRetainedContainerDataSource::New(
+                _tokens->value,
+                HdRetainedTypedSampledDataSource<int>::New(
+                    ++numNestedPulls));
+        }
+        return nullptr;
+    }
+
+    std::atomic<int> numExpensivePulls { 0 };
+    std::atomic<int> numCheapPulls { 0 };
+    std::atomic<int> numNestedPulls { 0 };
+
+private:
+    _CountingContainerDataSource() = default;
+};
+
+} // anonymous namespace
+
+// Verify that a cached locator is pulled upstream once across repeated
+// consumer pulls, while uncached locators are forwarded every time.
+static void
+TestMemoization()
+{
+    auto counter = _CountingContainerDataSource::New();
+
+    HdRetainedSceneIndexRefPtr retainedScene = HdRetainedSceneIndex::New();
+    const SdfPath primPath("/Prim");
+    retainedScene->AddPrims(
+        { { primPath, TfToken("mesh"), counter } });
+
+    HdsiCachingSceneIndexRefPtr cachingScene = HdsiCachingSceneIndex::New(
+        retainedScene,
+        { HdDataSourceLocator(_tokens->expensive) });
+
+    for (int i = 0; i < 3; ++i) {
+        HdSceneIndexPrim prim = cachingScene->GetPrim(primPath);
+        TF_AXIOM(prim.dataSource);
+        auto valueDs = HdTypedSampledDataSource<int>::Cast(
+            prim.dataSource->Get(_tokens->expensive));
+        TF_AXIOM(valueDs);
+        TF_AXIOM(valueDs->GetTypedValue(0.0f) == 42);
+        TF_AXIOM(prim.dataSource->Get(_tokens->cheap));
+    }
+
+    TF_AXIOM(counter->numExpensivePulls == 1);
+    TF_AXIOM(counter->numCheapPulls == 3);
+}
+
+// Verify that a dirtied prim entry intersecting the cached locator drops
+// the memoized value, and that unrelated dirtiness leaves it in place.
+static void
+TestInvalidation()
+{
+    auto counter = _CountingContainerDataSource::New();
+
+    HdRetainedSceneIndexRefPtr retainedScene = HdRetainedSceneIndex::New();
+    const SdfPath primPath("/Prim");
+    retainedScene->AddPrims(
+        { { primPath, TfToken("mesh"), counter } });
+
+    HdsiCachingSceneIndexRefPtr cachingScene = HdsiCachingSceneIndex::New(
+        retainedScene,
+        { HdDataSourceLocator(_tokens->expensive) });
+
+    HdSceneIndexPrim prim = cachingScene->GetPrim(primPath);
+    TF_AXIOM(prim.dataSource->Get(_tokens->expensive));
+    TF_AXIOM(counter->numExpensivePulls == 1);
+
+    // Unrelated dirtiness must not invalidate the cached value.
+    retainedScene->DirtyPrims(
+        { { primPath, HdDataSourceLocator(_tokens->cheap) } });
+    TF_AXIOM(cachingScene->GetPrim(primPath).dataSource->Get(
+        _tokens->expensive));
+    TF_AXIOM(counter->numExpensivePulls == 1);
+
+    // Intersecting dirtiness re-pulls upstream exactly once.
+    retainedScene->DirtyPrims(
+        { { primPath, HdDataSourceLocator(_tokens->expensive) } });
+    prim = cachingScene->GetPrim(primPath);
+    TF_AXIOM(prim.dataSource->Get(_tokens->expensive));
+    TF_AXIOM(prim.dataSource->Get(_tokens->expensive));
+    TF_AXIOM(counter->numExpensivePulls == 2);
+}
+
+// Verify that a nested locator memoizes the data source at its full
+// depth.
+static void
+TestNestedLocator()
+{
+    auto counter = _CountingContainerDataSource::New();
+
+    HdRetainedSceneIndexRefPtr retainedScene = HdRetainedSceneIndex::New();
+    const SdfPath primPath("/Prim");
+    retainedScene->AddPrims(
+        { { primPath, TfToken("mesh"), counter } });
+
+    HdsiCachingSceneIndexRefPtr cachingScene = HdsiCachingSceneIndex::New(
+        retainedScene,
+        { HdDataSourceLocator(_tokens->nested, _tokens->value) });
+
+    int firstValue = 0;
+    for (int i = 0; i < 3; ++i) {
+        HdSceneIndexPrim prim = cachingScene->GetPrim(primPath);
+        auto nested = HdContainerDataSource::Cast(
+            prim.dataSource->Get(_tokens->nested));
+        TF_AXIOM(nested);
+        auto valueDs = HdTypedSampledDataSource<int>::Cast(
+            nested->Get(_tokens->value));
+        TF_AXIOM(valueDs);
+        if (i == 0) {
+            firstValue = valueDs->GetTypedValue(0.0f);
+        }
+        // The memoized value is stable across pulls even though the
+        // upstream source produces a new value on every evaluation.
+        TF_AXIOM(valueDs->GetTypedValue(0.0f) == firstValue);
+    }
+}
+
+// Verify that removing a prim drops its cache.
+static void
+TestRemoval()
+{
+    auto counter = _CountingContainerDataSource::New();
+
+    HdRetainedSceneIndexRefPtr retainedScene = HdRetainedSceneIndex::New();
+    const SdfPath primPath("/Parent/Prim");
+    retainedScene->AddPrims(
+        { { primPath, TfToken("mesh"), counter } });
+
+    HdsiCachingSceneIndexRefPtr cachingScene = HdsiCachingSceneIndex::New(
+        retainedScene,
+        { HdDataSourceLocator(_tokens->expensive) });
+
+    TF_AXIOM(cachingScene->GetPrim(primPath).dataSource->Get(
+        _tokens->expensive));
+    TF_AXIOM(counter->numExpensivePulls == 1);
+
+    // Remove the subtree and re-add the prim; the cache must not serve
+    // the stale value.
+    retainedScene->RemovePrims({ { SdfPath("/Parent") } });
+    retainedScene->AddPrims(
+        { { primPath, TfToken("mesh"), counter } });
+
+    TF_AXIOM(cachingScene->GetPrim(primPath).dataSource->Get(
+        _tokens->expensive));
+    TF_AXIOM(counter->numExpensivePulls == 2);
+}
+
+int
+main(int argc, char *argv[])
+{
+    printf("Testing memoization...\n");
+    TestMemoization();
+
+    printf("Testing invalidation...\n");
+    TestInvalidation();
+
+    printf("Testing nested locators...\n");
+    TestNestedLocator();
+
+    printf("Testing removal...\n");
+    TestRemoval();
+
+    printf("OK\n");
+    return 0;
+}
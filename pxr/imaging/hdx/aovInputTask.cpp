@@ -261,6 +261,7 @@ HdxAovInputTask::_UpdateTexture(
         copyOp.cpuSourceBuffer = pixelData;
         copyOp.gpuDestinationTexture = texture;
         HgiBlitCmdsUniquePtr blitCmds = _GetHgi()->CreateBlitCmds();
+        blitCmds->SetSubmissionLabel(TfToken("aovInput"));
         blitCmds->PushDebugGroup("Upload CPU texels");
         blitCmds->CopyTextureCpuToGpu(copyOp);
         blitCmds->PopDebugGroup();
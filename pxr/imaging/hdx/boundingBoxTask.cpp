@@ -399,6 +399,7 @@ HdxBoundingBoxTask::_UpdateShaderConstants(
     transformsBlit.byteSize = 16 * sizeof(float) * _maxTransforms;
 
     HgiBlitCmdsUniquePtr blitCmds = _GetHgi()->CreateBlitCmds();
+    blitCmds->SetSubmissionLabel(TfToken("boundingBox"));
     blitCmds->CopyBufferCpuToGpu(transformsBlit);
     _GetHgi()->SubmitCmds(blitCmds.get());
 
@@ -443,6 +444,7 @@ HdxBoundingBoxTask::_DrawBBoxes(
 
     // Begin rendering
     HgiGraphicsCmdsUniquePtr gfxCmds = _GetHgi()->CreateGraphicsCmds(gfxDesc);
+    gfxCmds->SetSubmissionLabel(TfToken("boundingBox"));
     gfxCmds->PushDebugGroup("BoundingBox");
     gfxCmds->BindPipeline(_pipeline);
     gfxCmds->BindVertexBuffers({{_vertexBuffer, 0, 0}});
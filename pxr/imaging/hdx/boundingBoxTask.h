@@ -73,6 +73,9 @@ public:
     void Prepare(HdTaskContext* ctx,
                  HdRenderIndex* renderIndex) override;
 
+    /// Prepare has no task context dependencies.
+    bool IsParallelPrepareSafe() const override { return true; }
+
     /// Execute the bounding box task
     HDX_API
     void Execute(HdTaskContext* ctx) override;
@@ -34,6 +34,9 @@ public:
     void Prepare(HdTaskContext* ctx,
                  HdRenderIndex* renderIndex) override;
 
+    /// Prepare has no task context dependencies.
+    bool IsParallelPrepareSafe() const override { return true; }
+
     /// Execute the color channel task
     HDX_API
     void Execute(HdTaskContext* ctx) override;
@@ -1053,6 +1053,7 @@ HdxColorCorrectionTask::_ApplyColorCorrection(
 
     // Begin rendering
     HgiGraphicsCmdsUniquePtr gfxCmds = _GetHgi()->CreateGraphicsCmds(gfxDesc);
+    gfxCmds->SetSubmissionLabel(TfToken("colorCorrection"));
     gfxCmds->PushDebugGroup("ColorCorrection");
     gfxCmds->BindResources(_resourceBindings);
     gfxCmds->BindPipeline(_pipeline);
@@ -316,6 +316,7 @@ HdxEffectsShader::_CreateAndSubmitGraphicsCmds(
 
     _gfxCmds = _hgi->CreateGraphicsCmds(gfxDesc);
 
+    _gfxCmds->SetSubmissionLabel(TfToken(_debugName));
     _gfxCmds->PushDebugGroup(_debugName.c_str());
     _gfxCmds->BindPipeline(_pipeline);
     _gfxCmds->SetViewport(viewport);
@@ -0,0 +1,529 @@
+//
+// Copyright 2024 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+#include "pxr/imaging/hdx/occlusionCullTask.h"
+#include "pxr/imaging/hdx/package.h"
+#include "pxr/imaging/hd/aov.h"
+#include "pxr/imaging/hd/renderBuffer.h"
+#include "pxr/imaging/hd/renderIndex.h"
+#include "pxr/imaging/hd/tokens.h"
+#include "pxr/imaging/hio/glslfx.h"
+
+#include "pxr/imaging/hgi/hgi.h"
+#include "pxr/imaging/hgi/tokens.h"
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+TF_DEFINE_PRIVATE_TOKENS(
+    _tokens,
+    // texture identifiers
+    (depthIn)
+
+    // shader mixins
+    ((occlusionCullVertex,             "OcclusionCullVertex"))
+    ((occlusionCullFragmentDownsample, "OcclusionCullFragmentDownsample"))
+);
+
+HdxOcclusionCullTaskParams::HdxOcclusionCullTaskParams()
+  : enabled(false)
+{
+}
+
+HdxOcclusionCullTask::HdxOcclusionCullTask(
+    HdSceneDelegate* delegate,
+    SdfPath const& id)
+  : HdxTask(id)
+  , _depthBuffer(nullptr)
+  , _depthDimensions(0)
+{
+}
+
+HdxOcclusionCullTask::~HdxOcclusionCullTask()
+{
+    _DestroyPyramidResources();
+
+    if (_shaderProgram) {
+        _DestroyShaderProgram();
+    }
+    if (_pipeline) {
+        _GetHgi()->DestroyGraphicsPipeline(&_pipeline);
+    }
+    if (_vertexBuffer) {
+        _GetHgi()->DestroyBuffer(&_vertexBuffer);
+    }
+    if (_indexBuffer) {
+        _GetHgi()->DestroyBuffer(&_indexBuffer);
+    }
+    if (_sampler) {
+        _GetHgi()->DestroySampler(&_sampler);
+    }
+}
+
+bool
+HdxOcclusionCullTask::_CreateShaderResources()
+{
+    if (_shaderProgram) {
+        return true;
+    }
+
+    const HioGlslfx glslfx(
+            HdxPackageOcclusionCullShader(), HioGlslfxTokens->defVal);
+
+    // Setup the vertex shader
+    HgiShaderFunctionHandle vertFn;
+    {
+        std::string vsCode;
+        HgiShaderFunctionDesc vertDesc;
+        vertDesc.debugName = _tokens->occlusionCullVertex.GetString();
+        vertDesc.shaderStage = HgiShaderStageVertex;
+        HgiShaderFunctionAddStageInput(
+            &vertDesc, "position", "vec4");
+        HgiShaderFunctionAddStageInput(
+            &vertDesc, "uvIn", "vec2");
+        HgiShaderFunctionAddStageOutput(
+            &vertDesc, "gl_Position", "vec4", "position");
+        HgiShaderFunctionAddStageOutput(
+            &vertDesc, "uvOut", "vec2");
+        vsCode += glslfx.GetSource(_tokens->occlusionCullVertex);
+        vertDesc.shaderCode = vsCode.c_str();
+
+        vertFn = _GetHgi()->CreateShaderFunction(vertDesc);
+    }
+
+    // Setup the downsample fragment shader
+    HgiShaderFunctionHandle fragFn;
+    {
+        std::string fsCode;
+        HgiShaderFunctionDesc fragDesc;
+        fragDesc.debugName =
+            _tokens->occlusionCullFragmentDownsample.GetString();
+        fragDesc.shaderStage = HgiShaderStageFragment;
+        HgiShaderFunctionAddStageInput(
+            &fragDesc, "uvOut", "vec2");
+        HgiShaderFunctionAddTexture(
+            &fragDesc, _tokens->depthIn.GetString(),
+            /*bindIndex = */0, /*dimensions = */2, HgiFormatFloat32);
+        HgiShaderFunctionAddStageOutput(
+            &fragDesc, "hd_FragColor", "vec4", "color");
+        HgiShaderFunctionAddConstantParam(
+            &fragDesc, "screenSize", "vec2");
+        fsCode += glslfx.GetSource(_tokens->occlusionCullFragmentDownsample);
+        fragDesc.shaderCode = fsCode.c_str();
+
+        fragFn = _GetHgi()->CreateShaderFunction(fragDesc);
+    }
+
+    // Setup the shader program
+    HgiShaderProgramDesc programDesc;
+    programDesc.debugName =
+        _tokens->occlusionCullFragmentDownsample.GetString();
+    programDesc.shaderFunctions.push_back(std::move(vertFn));
+    programDesc.shaderFunctions.push_back(std::move(fragFn));
+    _shaderProgram = _GetHgi()->CreateShaderProgram(programDesc);
+
+    if (!_shaderProgram->IsValid() || !vertFn->IsValid() || !fragFn->IsValid()){
+        TF_CODING_ERROR("Failed to create occlusion cull downsample shader");
+        _PrintCompileErrors();
+        _DestroyShaderProgram();
+        return false;
+    }
+
+    return true;
+}
+
+bool
+HdxOcclusionCullTask::_CreateBufferResources()
+{
+    if (_vertexBuffer && _indexBuffer) {
+        return true;
+    }
+
+    // A larger-than screen triangle made to fit the screen.
+    constexpr float vertData[][6] =
+            { { -1,  3, 0, 1,     0, 2 },
+              { -1, -1, 0, 1,     0, 0 },
+              {  3, -1, 0, 1,     2, 0 } };
+
+    HgiBufferDesc vboDesc;
+    vboDesc.debugName = "HdxOcclusionCullTask VertexBuffer";
+    vboDesc.usage = HgiBufferUsageVertex;
+    vboDesc.initialData = vertData;
+    vboDesc.byteSize = sizeof(vertData);
+    vboDesc.vertexStride = sizeof(vertData[0]);
+    _vertexBuffer = _GetHgi()->CreateBuffer(vboDesc);
+
+    static const int32_t indices[3] = {0,1,2};
+
+    HgiBufferDesc iboDesc;
+    iboDesc.debugName = "HdxOcclusionCullTask IndexBuffer";
+    iboDesc.usage = HgiBufferUsageIndex32;
+    iboDesc.initialData = indices;
+    iboDesc.byteSize = sizeof(indices);
+    _indexBuffer = _GetHgi()->CreateBuffer(iboDesc);
+    return true;
+}
+
+bool
+HdxOcclusionCullTask::_CreateSampler()
+{
+    if (_sampler) {
+        return true;
+    }
+
+    HgiSamplerDesc sampDesc;
+
+    sampDesc.magFilter = HgiSamplerFilterNearest;
+    sampDesc.minFilter = HgiSamplerFilterNearest;
+
+    sampDesc.addressModeU = HgiSamplerAddressModeClampToEdge;
+    sampDesc.addressModeV = HgiSamplerAddressModeClampToEdge;
+
+    _sampler = _GetHgi()->CreateSampler(sampDesc);
+
+    return true;
+}
+
+bool
+HdxOcclusionCullTask::_CreatePyramidTexture(GfVec3i const& depthDimensions)
+{
+    if (_pyramidTexture && _depthDimensions == depthDimensions) {
+        return true;
+    }
+
+    _DestroyPyramidResources();
+    _depthDimensions = depthDimensions;
+
+    // The pyramid starts at half the depth AOV resolution; full resolution
+    // occlusion tests can sample the depth AOV itself.
+    const GfVec3i dimensions(
+        std::max(depthDimensions[0] / 2, 1),
+        std::max(depthDimensions[1] / 2, 1),
+        1);
+
+    uint16_t mipLevels = 1;
+    for (int size = std::max(dimensions[0], dimensions[1]); size > 1;
+         size /= 2) {
+        mipLevels++;
+    }
+
+    HgiTextureDesc texDesc;
+    texDesc.debugName = "Occlusion Cull Hierarchical Depth";
+    texDesc.dimensions = dimensions;
+    texDesc.format = HgiFormatFloat32;
+    texDesc.layerCount = 1;
+    texDesc.mipLevels = mipLevels;
+    texDesc.sampleCount = HgiSampleCount1;
+    texDesc.usage = HgiTextureUsageBitsColorTarget |
+                    HgiTextureUsageBitsShaderRead;
+    _pyramidTexture = _GetHgi()->CreateTexture(texDesc);
+    if (!_pyramidTexture) {
+        return false;
+    }
+
+    // Create a view per mip so each reduction pass can render into one mip
+    // while sampling the previous one.
+    for (uint16_t mip = 0; mip < mipLevels; mip++) {
+        HgiTextureViewDesc viewDesc;
+        viewDesc.debugName = "Occlusion Cull Pyramid Mip View";
+        viewDesc.format = texDesc.format;
+        viewDesc.layerCount = 1;
+        viewDesc.mipLevels = 1;
+        viewDesc.sourceTexture = _pyramidTexture;
+        viewDesc.sourceFirstMip = mip;
+        _mipViews.push_back(_GetHgi()->CreateTextureView(viewDesc));
+    }
+
+    return true;
+}
+
+bool
+HdxOcclusionCullTask::_CreateResourceBindings(
+    HgiTextureHandle const& depthTexture)
+{
+    if (!_resourceBindings.empty() && _lastDepthTexture == depthTexture) {
+        return true;
+    }
+
+    for (HgiResourceBindingsHandle& bindings : _resourceBindings) {
+        _GetHgi()->DestroyResourceBindings(&bindings);
+    }
+    _resourceBindings.clear();
+    _lastDepthTexture = depthTexture;
+
+    for (size_t mip = 0; mip < _mipViews.size(); mip++) {
+        HgiResourceBindingsDesc resourceDesc;
+        resourceDesc.debugName = "HdxOcclusionCullTask resourceDesc";
+
+        HgiTextureBindDesc texBind0;
+        texBind0.bindingIndex = 0;
+        texBind0.stageUsage = HgiShaderStageFragment;
+        texBind0.writable = false;
+        texBind0.textures.push_back(
+            mip == 0
+                ? depthTexture
+                : _mipViews[mip - 1]->GetViewTexture());
+        texBind0.samplers.push_back(_sampler);
+        resourceDesc.textures.push_back(std::move(texBind0));
+
+        _resourceBindings.push_back(
+            _GetHgi()->CreateResourceBindings(resourceDesc));
+    }
+
+    return true;
+}
+
+bool
+HdxOcclusionCullTask::_CreatePipeline()
+{
+    if (_pipeline) {
+        return true;
+    }
+
+    HgiGraphicsPipelineDesc desc;
+    desc.debugName = "Occlusion Cull Downsample Pipeline";
+    desc.shaderProgram = _shaderProgram;
+
+    // Describe the vertex buffer
+    HgiVertexAttributeDesc posAttr;
+    posAttr.format = HgiFormatFloat32Vec3;
+    posAttr.offset = 0;
+    posAttr.shaderBindLocation = 0;
+
+    HgiVertexAttributeDesc uvAttr;
+    uvAttr.format = HgiFormatFloat32Vec2;
+    uvAttr.offset = sizeof(float) * 4; // after posAttr
+    uvAttr.shaderBindLocation = 1;
+
+    HgiVertexBufferDesc vboDesc;
+    vboDesc.bindingIndex = 0;
+    vboDesc.vertexStride = sizeof(float) * 6; // pos, uv
+    vboDesc.vertexAttributes.push_back(posAttr);
+    vboDesc.vertexAttributes.push_back(uvAttr);
+
+    desc.vertexBuffers.push_back(std::move(vboDesc));
+
+    // The reduction writes every pixel of the target mip.
+    desc.depthState.depthTestEnabled = false;
+    desc.depthState.depthWriteEnabled = false;
+    desc.depthState.stencilTestEnabled = false;
+    desc.multiSampleState.alphaToCoverageEnable = false;
+
+    // Setup rasterization state
+    desc.rasterizationState.cullMode = HgiCullModeBack;
+    desc.rasterizationState.polygonMode = HgiPolygonModeFill;
+    desc.rasterizationState.winding = HgiWindingCounterClockwise;
+
+    // Setup attachment descriptor
+    _attachmentDesc.blendEnabled = false;
+    _attachmentDesc.loadOp = HgiAttachmentLoadOpDontCare;
+    _attachmentDesc.storeOp = HgiAttachmentStoreOpStore;
+    _attachmentDesc.format = HgiFormatFloat32;
+    _attachmentDesc.usage = HgiTextureUsageBitsColorTarget |
+                            HgiTextureUsageBitsShaderRead;
+    desc.colorAttachmentDescs.push_back(_attachmentDesc);
+
+    desc.shaderConstantsDesc.stageUsage = HgiShaderStageFragment;
+    desc.shaderConstantsDesc.byteSize = sizeof(float) * 2;
+
+    _pipeline = _GetHgi()->CreateGraphicsPipeline(desc);
+
+    return true;
+}
+
+void
+HdxOcclusionCullTask::_BuildPyramid()
+{
+    GfVec3i const& dimensions = _pyramidTexture->GetDescriptor().dimensions;
+
+    for (size_t mip = 0; mip < _mipViews.size(); mip++) {
+        const GfVec2i mipDimensions(
+            std::max(dimensions[0] >> mip, 1),
+            std::max(dimensions[1] >> mip, 1));
+
+        HgiGraphicsCmdsDesc gfxDesc;
+        gfxDesc.colorAttachmentDescs.push_back(_attachmentDesc);
+        gfxDesc.colorTextures.push_back(_mipViews[mip]->GetViewTexture());
+
+        HgiGraphicsCmdsUniquePtr gfxCmds =
+            _GetHgi()->CreateGraphicsCmds(gfxDesc);
+        gfxCmds->SetSubmissionLabel(TfToken("occlusionCull"));
+        gfxCmds->PushDebugGroup("Occlusion Cull Downsample");
+        gfxCmds->BindResources(_resourceBindings[mip]);
+        gfxCmds->BindPipeline(_pipeline);
+        gfxCmds->BindVertexBuffers({{_vertexBuffer, 0, 0}});
+
+        const float screenSize[2] = {
+            static_cast<float>(mipDimensions[0]),
+            static_cast<float>(mipDimensions[1]) };
+        gfxCmds->SetConstantValues(
+            _pipeline,
+            HgiShaderStageFragment,
+            0,
+            sizeof(screenSize),
+            &screenSize);
+
+        gfxCmds->SetViewport(
+            GfVec4i(0, 0, mipDimensions[0], mipDimensions[1]));
+        gfxCmds->DrawIndexed(_indexBuffer, 3, 0, 0, 1, 0);
+        gfxCmds->PopDebugGroup();
+
+        // Each pass samples the mip written by the previous pass, so the
+        // passes are submitted individually.
+        _GetHgi()->SubmitCmds(gfxCmds.get());
+    }
+}
+
+void
+HdxOcclusionCullTask::_DestroyShaderProgram()
+{
+    if (!_shaderProgram) return;
+
+    for (HgiShaderFunctionHandle fn : _shaderProgram->GetShaderFunctions()) {
+        _GetHgi()->DestroyShaderFunction(&fn);
+    }
+    _GetHgi()->DestroyShaderProgram(&_shaderProgram);
+}
+
+void
+HdxOcclusionCullTask::_DestroyPyramidResources()
+{
+    for (HgiResourceBindingsHandle& bindings : _resourceBindings) {
+        _GetHgi()->DestroyResourceBindings(&bindings);
+    }
+    _resourceBindings.clear();
+    _lastDepthTexture = HgiTextureHandle();
+
+    for (HgiTextureViewHandle& view : _mipViews) {
+        _GetHgi()->DestroyTextureView(&view);
+    }
+    _mipViews.clear();
+
+    if (_pyramidTexture) {
+        _GetHgi()->DestroyTexture(&_pyramidTexture);
+    }
+}
+
+void
+HdxOcclusionCullTask::_PrintCompileErrors()
+{
+    if (!_shaderProgram) return;
+
+    for (HgiShaderFunctionHandle fn : _shaderProgram->GetShaderFunctions()) {
+        std::cout << fn->GetCompileErrors() << std::endl;
+    }
+    std::cout << _shaderProgram->GetCompileErrors() << std::endl;
+}
+
+void
+HdxOcclusionCullTask::_Sync(HdSceneDelegate* delegate,
+                            HdTaskContext* ctx,
+                            HdDirtyBits* dirtyBits)
+{
+    HD_TRACE_FUNCTION();
+    HF_MALLOC_TAG_FUNCTION();
+
+    if ((*dirtyBits) & HdChangeTracker::DirtyParams) {
+        _GetTaskParams(delegate, &_params);
+    }
+
+    *dirtyBits = HdChangeTracker::Clean;
+}
+
+void
+HdxOcclusionCullTask::Prepare(HdTaskContext* ctx,
+                              HdRenderIndex* renderIndex)
+{
+    _depthBuffer = static_cast<HdRenderBuffer*>(
+        renderIndex->GetBprim(HdPrimTypeTokens->renderBuffer,
+                              _params.depthBufferPath));
+}
+
+void
+HdxOcclusionCullTask::Execute(HdTaskContext* ctx)
+{
+    HD_TRACE_FUNCTION();
+    HF_MALLOC_TAG_FUNCTION();
+
+    if (!_params.enabled || !_depthBuffer) {
+        return;
+    }
+
+    // The depth buffer still holds the previous frame's resolved depth
+    // since this task runs before the frame's render tasks.
+    const VtValue depth = _depthBuffer->GetResource(/*multiSampled*/false);
+    if (!depth.IsHolding<HgiTextureHandle>()) {
+        return;
+    }
+    HgiTextureHandle depthTexture = depth.UncheckedGet<HgiTextureHandle>();
+    if (!depthTexture) {
+        return;
+    }
+
+    HgiTextureDesc const& depthDesc = depthTexture->GetDescriptor();
+    if (depthDesc.format != HgiFormatFloat32) {
+        TF_WARN("Non-floating point depth AOVs aren't supported yet.");
+        return;
+    }
+
+    if (!TF_VERIFY(_CreateBufferResources())) {
+        return;
+    }
+    if (!TF_VERIFY(_CreateSampler())) {
+        return;
+    }
+    if (!TF_VERIFY(_CreateShaderResources())) {
+        return;
+    }
+    if (!TF_VERIFY(_CreatePyramidTexture(depthDesc.dimensions))) {
+        return;
+    }
+    if (!TF_VERIFY(_CreateResourceBindings(depthTexture))) {
+        return;
+    }
+    if (!TF_VERIFY(_CreatePipeline())) {
+        return;
+    }
+
+    _BuildPyramid();
+
+    // Publish the pyramid so GPU culling in the render delegate can test
+    // batched prim bounds against it during this frame's draw submission.
+    (*ctx)[HdxTokens->hierarchicalDepth] = VtValue(_pyramidTexture);
+}
+
+// -------------------------------------------------------------------------- //
+// VtValue Requirements
+// -------------------------------------------------------------------------- //
+
+std::ostream& operator<<(
+    std::ostream& out,
+    const HdxOcclusionCullTaskParams& pv)
+{
+    out << "HdxOcclusionCullTaskParams Params: "
+        << pv.enabled << " "
+        << pv.depthBufferPath
+    ;
+    return out;
+}
+
+bool operator==(const HdxOcclusionCullTaskParams& lhs,
+                const HdxOcclusionCullTaskParams& rhs)
+{
+    return lhs.enabled         == rhs.enabled &&
+           lhs.depthBufferPath == rhs.depthBufferPath;
+}
+
+bool operator!=(const HdxOcclusionCullTaskParams& lhs,
+                const HdxOcclusionCullTaskParams& rhs)
+{
+    return !(lhs == rhs);
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
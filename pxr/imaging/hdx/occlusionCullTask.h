@@ -0,0 +1,150 @@
+//
+// Copyright 2024 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+#ifndef PXR_IMAGING_HDX_OCCLUSION_CULL_TASK_H
+#define PXR_IMAGING_HDX_OCCLUSION_CULL_TASK_H
+
+#include "pxr/pxr.h"
+#include "pxr/base/gf/vec3i.h"
+#include "pxr/imaging/hdx/api.h"
+#include "pxr/imaging/hdx/task.h"
+#include "pxr/imaging/hdx/tokens.h"
+#include "pxr/imaging/hgi/attachmentDesc.h"
+#include "pxr/imaging/hgi/buffer.h"
+#include "pxr/imaging/hgi/graphicsPipeline.h"
+#include "pxr/imaging/hgi/resourceBindings.h"
+#include "pxr/imaging/hgi/shaderProgram.h"
+#include "pxr/imaging/hgi/texture.h"
+#include "pxr/usd/sdf/path.h"
+
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+class HdRenderBuffer;
+
+/// \class HdxOcclusionCullTaskParams
+///
+/// `enabled`: Whether the Hi-Z pyramid is built for this frame.
+/// `depthBufferPath`: The render buffer prim holding the depth AOV of the
+///                    previous frame.
+///
+struct HdxOcclusionCullTaskParams
+{
+    HDX_API
+    HdxOcclusionCullTaskParams();
+
+    bool enabled;
+    SdfPath depthBufferPath;
+};
+
+/// \class HdxOcclusionCullTask
+///
+/// A task that builds a hierarchical depth (Hi-Z) pyramid for two-phase
+/// occlusion culling.
+///
+/// The task runs before the frame's draw calls and reduces the depth AOV
+/// written by the previous frame into a mip pyramid holding the farthest
+/// depth per region. The previous frame's visible geometry thereby serves
+/// as the occluder set, so no separate occluder pass is needed.
+///
+/// The pyramid is published on the task context under
+/// HdxTokens->hierarchicalDepth so that the render delegate's GPU culling
+/// can test batched prim bounds against it. Since the pyramid is one frame
+/// stale, consumers must treat a positive occlusion result conservatively
+/// (e.g. re-test or re-draw prims that become visible due to camera motion).
+///
+class HdxOcclusionCullTask : public HdxTask
+{
+public:
+    HDX_API
+    HdxOcclusionCullTask(HdSceneDelegate* delegate, SdfPath const& id);
+
+    HDX_API
+    ~HdxOcclusionCullTask() override;
+
+    HDX_API
+    void Prepare(HdTaskContext* ctx,
+                 HdRenderIndex* renderIndex) override;
+
+    HDX_API
+    void Execute(HdTaskContext* ctx) override;
+
+protected:
+    HDX_API
+    void _Sync(HdSceneDelegate* delegate,
+               HdTaskContext* ctx,
+               HdDirtyBits* dirtyBits) override;
+
+private:
+    HdxOcclusionCullTask() = delete;
+    HdxOcclusionCullTask(const HdxOcclusionCullTask &) = delete;
+    HdxOcclusionCullTask &operator =(const HdxOcclusionCullTask &) = delete;
+
+    // Utility function to create the downsample shader program.
+    bool _CreateShaderResources();
+
+    // Utility function to create buffer resources.
+    bool _CreateBufferResources();
+
+    // Utility to create a texture sampler.
+    bool _CreateSampler();
+
+    // Create the pyramid texture and a view per mip level. The pyramid
+    // starts at half the depth AOV resolution.
+    bool _CreatePyramidTexture(GfVec3i const& depthDimensions);
+
+    // Utility to create the per-mip resource bindings. The first pass
+    // samples the depth AOV; subsequent passes sample the previous mip.
+    bool _CreateResourceBindings(HgiTextureHandle const& depthTexture);
+
+    // Utility to create the reduction pipeline.
+    bool _CreatePipeline();
+
+    // Record and submit one reduction pass per mip level.
+    void _BuildPyramid();
+
+    // Destroy shader program and the shader functions it holds.
+    void _DestroyShaderProgram();
+
+    // Destroy the pyramid texture, its mip views and resource bindings.
+    void _DestroyPyramidResources();
+
+    // Print shader compile errors.
+    void _PrintCompileErrors();
+
+    HdRenderBuffer* _depthBuffer;
+
+    HgiTextureHandle _pyramidTexture;
+    std::vector<HgiTextureViewHandle> _mipViews;
+    std::vector<HgiResourceBindingsHandle> _resourceBindings;
+    GfVec3i _depthDimensions;
+    HgiTextureHandle _lastDepthTexture;
+    HgiAttachmentDesc _attachmentDesc;
+
+    HgiShaderProgramHandle _shaderProgram;
+    HgiGraphicsPipelineHandle _pipeline;
+    HgiBufferHandle _indexBuffer;
+    HgiBufferHandle _vertexBuffer;
+    HgiSamplerHandle _sampler;
+
+    HdxOcclusionCullTaskParams _params;
+};
+
+// VtValue requirements
+HDX_API
+std::ostream& operator<<(std::ostream& out,
+                         const HdxOcclusionCullTaskParams& pv);
+HDX_API
+bool operator==(const HdxOcclusionCullTaskParams& lhs,
+                const HdxOcclusionCullTaskParams& rhs);
+HDX_API
+bool operator!=(const HdxOcclusionCullTaskParams& lhs,
+                const HdxOcclusionCullTaskParams& rhs);
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // PXR_IMAGING_HDX_OCCLUSION_CULL_TASK_H
@@ -151,6 +151,7 @@ HdxOitBufferAccessor::InitializeOitBuffersIfNecessary(Hgi *hgi)
     const uint8_t clearCounter = -1;
 
     HgiBlitCmdsUniquePtr blitCmds = hgi->CreateBlitCmds();
+    blitCmds->SetSubmissionLabel(TfToken("oitClearBuffers"));
     blitCmds->PushDebugGroup("Clear OIT buffers");
     blitCmds->FillBuffer(stCounterResource->GetHandle(), clearCounter);
     blitCmds->PopDebugGroup();
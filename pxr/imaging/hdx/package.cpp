@@ -104,6 +104,13 @@ HdxPackageColorCorrectionShader()
     return shader;
 }
 
+TfToken
+HdxPackageOcclusionCullShader()
+{
+    static TfToken shader = _GetShaderPath("occlusionCull.glslfx");
+    return shader;
+}
+
 TfToken
 HdxPackageVisualizeAovShader()
 {
@@ -23,6 +23,7 @@ TfToken HdxPackageRenderPassPickingShader();
 TfToken HdxPackageRenderPassShadowShader();
 TfToken HdxPackageColorChannelShader();
 TfToken HdxPackageColorCorrectionShader();
+TfToken HdxPackageOcclusionCullShader();
 TfToken HdxPackageVisualizeAovShader();
 TfToken HdxPackageRenderPassOitShader();
 TfToken HdxPackageRenderPassOitOpaqueShader();
@@ -92,6 +92,7 @@ HdxPickTask::HdxPickTask(HdSceneDelegate* delegate, SdfPath const& id)
     , _hgi(nullptr)
     , _pickableDepthIndex(0)
     , _depthToken(HdAovTokens->depthStencil)
+    , _hasPendingPick(false)
 {
 }
 
@@ -301,6 +302,7 @@ HdxPickTask::_ConditionStencilWithGLCallback(
     desc.depthTexture = depthTexture;
 
     HgiGraphicsCmdsUniquePtr gfxCmds = _hgi->CreateGraphicsCmds(desc);
+    gfxCmds->SetSubmissionLabel(TfToken("pick"));
     gfxCmds->PushDebugGroup("PickTask Condition Stencil Buffer");
 
     GfVec2i dimensions = _contextParams.resolution;
@@ -584,6 +586,10 @@ HdxPickTask::Execute(HdTaskContext* ctx)
     // This is important for Hgi garbage collection to run.
     _hgi->StartFrame();
 
+    // Deliver the hits of a previously deferred pick before its id buffers
+    // are overwritten by the render passes below.
+    _DeliverPendingPick();
+
     GfVec2i dimensions = _contextParams.resolution;
     GfVec4i viewport(0, 0, dimensions[0], dimensions[1]);
 
@@ -633,6 +639,28 @@ HdxPickTask::Execute(HdTaskContext* ctx)
             {HdxRenderTagTokens->widget});
     }
 
+    if (_contextParams.resolveCallback) {
+        // Asynchronous mode: defer the GPU->CPU readback to the next pick
+        // execution so this one does not stall on the id render submitted
+        // above. The hits are delivered through the resolve callback by
+        // _DeliverPendingPick() before the id buffers are re-rendered.
+        _pendingPickParams = _contextParams;
+        _hasPendingPick = true;
+    } else {
+        _ResolvePick(_contextParams, _contextParams.outHits);
+    }
+
+    // This is important for Hgi garbage collection to run.
+    _hgi->EndFrame();
+}
+
+void
+HdxPickTask::_ResolvePick(HdxPickTaskContextParams const& params,
+                          HdxPickHitVector* outHits) const
+{
+    GfVec2i dimensions = params.resolution;
+    GfVec4i viewport(0, 0, dimensions[0], dimensions[1]);
+
     // Capture the result buffers and cast to the appropriate types.
     HdStTextureUtils::AlignedBuffer<int> primIds =
         _ReadAovBuffer<int>(HdAovTokens->primId);
@@ -660,29 +688,46 @@ HdxPickTask::Execute(HdTaskContext* ctx)
     HdxPickResult result(
         primIds.get(), instanceIds.get(), elementIds.get(),
         edgeIds.get(), pointIds.get(), neyes.get(), depths.get(),
-        _index, _contextParams.pickTarget, _contextParams.viewMatrix,
-        _contextParams.projectionMatrix, depthRange, dimensions, viewport);
+        _index, params.pickTarget, params.viewMatrix,
+        params.projectionMatrix, depthRange, dimensions, viewport);
 
     // Resolve!
-    if (_contextParams.resolveMode ==
+    if (params.resolveMode ==
             HdxPickTokens->resolveNearestToCenter) {
-        result.ResolveNearestToCenter(_contextParams.outHits);
-    } else if (_contextParams.resolveMode ==
+        result.ResolveNearestToCenter(outHits);
+    } else if (params.resolveMode ==
             HdxPickTokens->resolveNearestToCamera) {
-        result.ResolveNearestToCamera(_contextParams.outHits);
-    } else if (_contextParams.resolveMode ==
+        result.ResolveNearestToCamera(outHits);
+    } else if (params.resolveMode ==
             HdxPickTokens->resolveUnique) {
-        result.ResolveUnique(_contextParams.outHits);
-    } else if (_contextParams.resolveMode ==
+        result.ResolveUnique(outHits);
+    } else if (params.resolveMode ==
             HdxPickTokens->resolveAll) {
-        result.ResolveAll(_contextParams.outHits);
+        result.ResolveAll(outHits);
     } else {
         TF_CODING_ERROR("Unrecognized interesection mode '%s'",
-            _contextParams.resolveMode.GetText());
+            params.resolveMode.GetText());
     }
+}
 
-    // This is important for Hgi garbage collection to run.
-    _hgi->EndFrame();
+void
+HdxPickTask::_DeliverPendingPick()
+{
+    if (!_hasPendingPick) {
+        return;
+    }
+    _hasPendingPick = false;
+
+    HdxPickHitVector hits;
+    // If the pick buffers were resized since the pick was deferred, its id
+    // render is gone; deliver an empty result.
+    if (_pendingPickParams.resolution == _contextParams.resolution) {
+        _ResolvePick(_pendingPickParams, &hits);
+    }
+    _pendingPickParams.resolveCallback(std::move(hits));
+
+    // Drop the snapshotted collection and callback.
+    _pendingPickParams = HdxPickTaskContextParams();
 }
 
 const TfTokenVector &
@@ -1357,6 +1402,16 @@ operator==(HdxPickTaskContextParams const& lhs,
     const RawDepthMaskCallback rhsDepthMask =
         rhsDepthMaskPtr ? *rhsDepthMaskPtr : nullptr;
 
+    using RawResolveCallback = void (*) (HdxPickHitVector);
+    const RawResolveCallback *lhsResolveCallbackPtr =
+        lhs.resolveCallback.target<RawResolveCallback>();
+    const RawResolveCallback *rhsResolveCallbackPtr =
+        rhs.resolveCallback.target<RawResolveCallback>();
+    const RawResolveCallback lhsResolveCallback =
+        lhsResolveCallbackPtr ? *lhsResolveCallbackPtr : nullptr;
+    const RawResolveCallback rhsResolveCallback =
+        rhsResolveCallbackPtr ? *rhsResolveCallbackPtr : nullptr;
+
     return lhs.resolution == rhs.resolution
         && lhs.pickTarget == rhs.pickTarget
         && lhs.resolveMode == rhs.resolveMode
@@ -1366,7 +1421,8 @@ operator==(HdxPickTaskContextParams const& lhs,
         && lhs.clipPlanes == rhs.clipPlanes
         && lhsDepthMask == rhsDepthMask
         && lhs.collection == rhs.collection
-        && lhs.outHits == rhs.outHits;
+        && lhs.outHits == rhs.outHits
+        && lhsResolveCallback == rhsResolveCallback;
 }
 
 bool
@@ -1394,7 +1450,8 @@ operator<<(std::ostream& out, HdxPickTaskContextParams const& p)
         << p.projectionMatrix << " "
         << depthMask << " "
         << p.collection << " "
-        << p.outHits;
+        << p.outHits << " "
+        << static_cast<bool>(p.resolveCallback);
     for (auto const& a : p.clipPlanes) {
         out << a << " ";
     }
@@ -106,6 +106,9 @@ struct HdxPickHit
 
 using HdxPickHitVector = std::vector<HdxPickHit>;
 
+/// Callback invoked with the resolved hits of an asynchronous pick.
+using HdxPickResolveCallback = std::function<void(HdxPickHitVector)>;
+
 /// Information about an instancer instancing a picked object (or an
 /// instancer instancing such an instancer and so on).
 struct HdxInstancerContext
@@ -225,6 +228,14 @@ struct HdxPrimOriginInfo
 ///         or region. The number of hits returned depends on the resolution
 ///         used and may have duplicates.
 ///
+/// 'resolveCallback': When set, the pick is resolved asynchronously: Execute()
+///     renders the id buffers but does not stall on the GPU->CPU readback.
+///     Instead, the readback and resolve run at the start of the next pick
+///     execution (by which time the GPU has consumed the id render) and the
+///     hits are delivered through this callback. 'outHits' is ignored in this
+///     mode. If the pick buffers are resized before the deferred readback
+///     runs, the callback is invoked with an empty hit vector.
+///
 struct HdxPickTaskContextParams
 {
     using DepthMaskCallback = std::function<void(void)>;
@@ -240,6 +251,7 @@ struct HdxPickTaskContextParams
         , depthMaskCallback(nullptr)
         , collection()
         , outHits(nullptr)
+        , resolveCallback(nullptr)
     {}
 
     GfVec2i resolution;
@@ -252,6 +264,7 @@ struct HdxPickTaskContextParams
     DepthMaskCallback depthMaskCallback;
     HdRprimCollection collection;
     HdxPickHitVector *outHits;
+    HdxPickResolveCallback resolveCallback;
 };
 
 /// \class HdxPickTask
@@ -330,7 +343,16 @@ private:
 
     HdRenderBuffer const * _FindAovBuffer(TfToken const & aovName) const;
 
-    // Create a shared render pass each for pickables, unpickables, and 
+    // Read back the id buffers and resolve them into hits using the given
+    // pick parameters.
+    void _ResolvePick(HdxPickTaskContextParams const& params,
+                      HdxPickHitVector* outHits) const;
+
+    // Invoke the resolve callback of a previously deferred pick with its
+    // resolved hits.
+    void _DeliverPendingPick();
+
+    // Create a shared render pass each for pickables, unpickables, and
     // widgets (which may draw on top even when occluded).
     HdRenderPassSharedPtr _pickableRenderPass;
     HdRenderPassSharedPtr _occluderRenderPass;
@@ -352,6 +374,11 @@ private:
     std::unique_ptr<HdStRenderBuffer> _widgetDepthStencilBuffer;
     HdRenderPassAovBindingVector _widgetAovBindings;
 
+    // Parameters of a pick whose readback was deferred to the next pick
+    // execution (asynchronous mode).
+    HdxPickTaskContextParams _pendingPickParams;
+    bool _hasPendingPick;
+
     HdxPickTask() = delete;
     HdxPickTask(const HdxPickTask &) = delete;
     HdxPickTask &operator =(const HdxPickTask &) = delete;
@@ -77,6 +77,9 @@ public:
     void Prepare(HdTaskContext* ctx,
                  HdRenderIndex* renderIndex) override;
 
+    /// Prepare has no task context dependencies.
+    bool IsParallelPrepareSafe() const override { return true; }
+
     HDX_API
     void Execute(HdTaskContext* ctx) override;
 
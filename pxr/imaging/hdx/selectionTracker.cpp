@@ -252,9 +252,8 @@ HdxSelectionTracker::GetSelectionOffsetBuffer(
             // append the offset buffer for the highlight mode
             offsets->resize(output.size() + copyOffset);
 
-            for (size_t i = 0; i < output.size(); i++) {
-                (*offsets)[i + copyOffset] = output[i];
-            }
+            std::copy(output.begin(), output.end(),
+                      offsets->begin() + copyOffset);
 
             copyOffset += output.size();
 
@@ -432,17 +431,27 @@ HdxSelectionTracker::_GetSelectionOffsets(HdSelectionSharedPtr const &selection,
     std::vector<int> ids;
     ids.resize(numPrims);
 
+    // Gather the selection state pointers alongside the prim ids so the
+    // flattening passes below don't pay for a serial hash lookup per prim;
+    // with large (e.g., select-all) selections those lookups dominate.
+    std::vector<HdSelection::PrimSelectionState const *> states;
+    states.resize(numPrims);
+
     size_t const N = 1000;
     WorkParallelForN(numPrims/N + 1,
-       [&ids, index, N, &selectedPrims](size_t begin, size_t end) mutable {
+       [&ids, &states, index, N, &selectedPrims, &selection, mode](
+            size_t begin, size_t end) mutable {
         end = std::min(end*N, ids.size());
         begin = begin*N;
         for (size_t i = begin; i < end; i++) {
             if (auto const& rprim = index->GetRprim(selectedPrims[i])) {
                 ids[i] = rprim->GetPrimId();
+                states[i] =
+                    selection->GetPrimSelectionState(mode, selectedPrims[i]);
             } else {
                 // silently ignore non-existing prim
                 ids[i] = INVALID;
+                states[i] = nullptr;
             }
         }
     });
@@ -530,19 +539,48 @@ HdxSelectionTracker::_GetSelectionOffsets(HdSelectionSharedPtr const &selection,
 
     _DebugPrintArray("prims", *output);
 
+    // Prims without any subprim or instance selection state only write their
+    // own seloffset entry, and those writes are independent; handle them in
+    // bulk in parallel since select-all and marquee style selections rarely
+    // carry subprim state.
+    auto const hasSubprimState =
+        [](HdSelection::PrimSelectionState const *state) {
+            return !(state->instanceIndices.empty() &&
+                     state->elementIndices.empty() &&
+                     state->edgeIndices.empty() &&
+                     state->pointIndices.empty());
+        };
+
+    WorkParallelForN(numPrims/N + 1,
+       [&ids, &states, N, min, &hasSubprimState, output](
+            size_t begin, size_t end) mutable {
+        end = std::min(end*N, ids.size());
+        begin = begin*N;
+        for (size_t i = begin; i < end; i++) {
+            int const id = ids[i];
+            if (id == INVALID || !states[i] || hasSubprimState(states[i])) {
+                continue;
+            }
+            (*output)[id-min+2] = _EncodeSelOffset(/*offset=*/0,
+                states[i]->fullySelected);
+        }
+    });
+
     for (size_t primIndex = 0; primIndex < ids.size(); primIndex++) {
         // TODO: store ID and path in "ids" vector
         int id = ids[primIndex];
         if (id == INVALID) continue;
 
-        SdfPath const& objPath = selectedPrims[primIndex];
-        TF_DEBUG(HDX_SELECTION_SETUP).Msg("Processing: %d - %s\n",
-                id, objPath.GetText());
-
         HdSelection::PrimSelectionState const* primSelState =
-            selection->GetPrimSelectionState(mode, objPath);
+            states[primIndex];
+
+        if (!primSelState || !hasSubprimState(primSelState)) {
+            // written by the parallel pass above
+            continue;
+        }
 
-        if (!primSelState) continue;
+        TF_DEBUG(HDX_SELECTION_SETUP).Msg("Processing: %d - %s\n",
+                id, selectedPrims[primIndex].GetText());
 
         // netSubprimOffset tracks the "net" offset to the start of each
         // subprim's range-offsets encoding; it allows us to handle selection of
@@ -12,6 +12,7 @@
 #include "pxr/imaging/hd/changeTracker.h"
 #include "pxr/imaging/hd/renderBuffer.h"
 #include "pxr/imaging/hd/renderIndex.h"
+#include "pxr/imaging/hd/rprim.h"
 #include "pxr/imaging/hd/sceneDelegate.h"
 
 #include "pxr/imaging/hdSt/hioConversions.h"
@@ -28,10 +29,18 @@
 
 #include "pxr/imaging/hio/image.h"
 #include "pxr/base/arch/fileSystem.h"
+#include "pxr/base/gf/bbox3d.h"
+#include "pxr/base/gf/frustum.h"
+#include "pxr/base/tf/envSetting.h"
 #include "pxr/base/tf/scoped.h"
+#include "pxr/base/work/loops.h"
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+TF_DEFINE_ENV_SETTING(HDX_SHADOW_TASK_REUSE_SHADOW_MAPS, true,
+    "Reuse shadow maps across frames, re-rendering a map only when its "
+    "framing changed or dirty scene geometry intersects its frustum.");
+
 static bool
 _HasDrawItems(HdRenderPassSharedPtr pass,
               const TfTokenVector &renderTags)
@@ -46,6 +55,8 @@ HdxShadowTask::HdxShadowTask(HdSceneDelegate* delegate, SdfPath const& id)
     , _renderPassStates()
     , _params()
     , _renderTags()
+    , _rprimIndexVersion(0)
+    , _instancerIndexVersion(0)
 {
 }
 
@@ -105,7 +116,11 @@ HdxShadowTask::Sync(HdSceneDelegate* delegate,
               HdStMaterialTagTokens->masked };
         _passes.resize( TfArraySize(shadowMaterialTags) * numShadowMaps);
 
-        // Mostly we can populate the renderpasses from shadow info, but the 
+        // Collection hashes per shadow map, used to invalidate cached
+        // shadow maps when a light's shadow collection changes.
+        std::vector<size_t> collectionHashes(numShadowMaps, 0);
+
+        // Mostly we can populate the renderpasses from shadow info, but the
         // lights contain the shadow collection; so we need to loop through the 
         // lights assigning collections to their shadows.
         for (size_t lightId = 0; lightId < glfLights.size(); ++lightId) {
@@ -148,6 +163,8 @@ HdxShadowTask::Sync(HdSceneDelegate* delegate,
             // SetRprimCollection checks for identity changes on the collection
             // and no-ops in that case.
             for (int shadowId = shadowStart; shadowId <= shadowEnd; ++shadowId){
+                collectionHashes[shadowId] = col.ComputeHash();
+
                 // Remember, we have two render passes (one for each collection)
                 // per shadow map. First the "defaultMaterialTag" passes.
                 if (_passes[shadowId]) {
@@ -268,6 +285,15 @@ HdxShadowTask::Sync(HdSceneDelegate* delegate,
 
             _passes[passId]->Sync();
         }
+
+        // Decide which cached shadow maps can be reused this frame. Task
+        // sync runs before rprim sync, so the change tracker still holds
+        // the dirty state of rprims that are about to be updated.
+        const bool dirtyRenderTags =
+            ((*dirtyBits) & HdChangeTracker::DirtyRenderTags) != 0;
+        _UpdateShadowMapValidity(
+            &renderIndex, shadows, collectionHashes,
+            /*forceInvalidate = */ dirtyParams || dirtyRenderTags);
     }
 
     *dirtyBits = HdChangeTracker::Clean;
@@ -280,9 +306,13 @@ HdxShadowTask::Prepare(HdTaskContext* ctx,
     HdResourceRegistrySharedPtr resourceRegistry =
         renderIndex->GetResourceRegistry();
 
-    for(size_t passId = 0; passId < _passes.size(); passId++) {
-        _renderPassStates[passId]->Prepare(resourceRegistry);
-    }
+    // Each shadow map pass has an independent render pass state, and the
+    // resource registry is thread-safe, so prepare the passes concurrently.
+    WorkParallelForEach(
+        _renderPassStates.begin(), _renderPassStates.end(),
+        [&resourceRegistry](HdStRenderPassStateSharedPtr const &state) {
+            state->Prepare(resourceRegistry);
+        });
 }
 
 void
@@ -320,14 +350,16 @@ HdxShadowTask::Execute(HdTaskContext* ctx)
     // GlfSimpleShadowArray's shadow textures to the textures backing the 
     // shadow render buffers.
     std::vector<uint32_t> textureIds;
+    std::vector<uint64_t> rawTextureIds(numShadowMaps, 0);
     for (size_t shadowId = 0; shadowId < numShadowMaps; shadowId++) {
         if (shadowId < shadowAovBindings.size()) {
-            HdRenderBuffer const * renderBuffer = 
+            HdRenderBuffer const * renderBuffer =
                 shadowAovBindings[shadowId].renderBuffer;
             VtValue aov = renderBuffer->GetResource(false);
             if (aov.IsHolding<HgiTextureHandle>()) {
                 HgiTextureHandle texture = aov.UncheckedGet<HgiTextureHandle>();
                 if (texture) {
+                    rawTextureIds[shadowId] = texture->GetRawResource();
                     textureIds.push_back((uint32_t)texture->GetRawResource());
                 }
             }
@@ -339,11 +371,22 @@ HdxShadowTask::Execute(HdTaskContext* ctx)
 
         // Make sure each pass got created. Light shadow indices are supposed
         // to be compact (see simpleLightTask.cpp).
-        if (!TF_VERIFY(_passes[shadowId]) || 
+        if (!TF_VERIFY(_passes[shadowId]) ||
             !TF_VERIFY(_passes[shadowId + numShadowMaps])) {
             continue;
         }
 
+        // Skip shadow maps that Sync found to be reusable, provided the
+        // render buffer still holds the texture they were rendered into.
+        if (shadowId < _shadowMapCache.size()) {
+            _ShadowMapCacheEntry &entry = _shadowMapCache[shadowId];
+            if (entry.valid &&
+                entry.textureId != 0 &&
+                entry.textureId == rawTextureIds[shadowId]) {
+                continue;
+            }
+        }
+
         // Render the actual geometry in the "defaultMaterialTag" collection.
         // Always execute this render pass because it clears the AOVs.
         _passes[shadowId]->Execute(
@@ -356,6 +399,12 @@ HdxShadowTask::Execute(HdTaskContext* ctx)
                _renderPassStates[shadowId + numShadowMaps],
                GetRenderTags());
         }
+
+        if (shadowId < _shadowMapCache.size()) {
+            _ShadowMapCacheEntry &entry = _shadowMapCache[shadowId];
+            entry.valid = true;
+            entry.textureId = rawTextureIds[shadowId];
+        }
     }
 
     if (TfDebug::IsEnabled(HDX_DEBUG_DUMP_SHADOW_TEXTURES)) {
@@ -427,6 +476,140 @@ HdxShadowTask::_UpdateDirtyParams(HdStRenderPassStateSharedPtr &renderPassState,
     }
 }
 
+bool
+HdxShadowTask::_ComputeDirtyRegions(
+    HdRenderIndex *renderIndex,
+    std::vector<GfRange3d> *regions)
+{
+    // Dirty bits that can alter the depth an rprim renders into a shadow
+    // map.
+    static const HdDirtyBits relevantBits =
+        HdChangeTracker::DirtyTransform |
+        HdChangeTracker::DirtyExtent |
+        HdChangeTracker::DirtyPoints |
+        HdChangeTracker::DirtyTopology |
+        HdChangeTracker::DirtyDisplayStyle |
+        HdChangeTracker::DirtyVisibility |
+        HdChangeTracker::DirtyPrimvar |
+        HdChangeTracker::DirtyNormals |
+        HdChangeTracker::DirtyWidths |
+        HdChangeTracker::DirtyInstancer |
+        HdChangeTracker::DirtyInstanceIndex |
+        HdChangeTracker::DirtyRenderTag |
+        HdChangeTracker::DirtyRepr |
+        HdChangeTracker::DirtyMaterialId;
+
+    HdChangeTracker const &tracker = renderIndex->GetChangeTracker();
+
+    for (SdfPath const &id : tracker.GetDirtyRprimIds()) {
+        const HdDirtyBits bits = tracker.GetRprimDirtyBits(id);
+        if ((bits & relevantBits) == 0) {
+            continue;
+        }
+
+        HdRprim const * const rprim = renderIndex->GetRprim(id);
+        HdSceneDelegate * const delegate =
+            renderIndex->GetSceneDelegateForRprim(id);
+        if (!rprim || !delegate) {
+            return false;
+        }
+
+        // Instances may be scattered anywhere; don't try to chase the
+        // instancer transforms.
+        if (!rprim->GetInstancerId().IsEmpty()) {
+            return false;
+        }
+
+        const GfRange3d extent = rprim->GetExtent(delegate);
+        if (extent.IsEmpty()) {
+            // Without an extent the prim's shadow footprint is unknown.
+            return false;
+        }
+        const GfRange3d bounds =
+            GfBBox3d(extent, delegate->GetTransform(id))
+                .ComputeAlignedRange();
+
+        // A moved prim invalidates both where it was and where it is.
+        const auto it = _lastRprimBounds.find(id);
+        if (it != _lastRprimBounds.end()) {
+            GfRange3d region = it->second;
+            region.UnionWith(bounds);
+            regions->push_back(region);
+            it->second = bounds;
+        } else {
+            regions->push_back(bounds);
+            _lastRprimBounds.emplace(id, bounds);
+        }
+    }
+
+    return true;
+}
+
+void
+HdxShadowTask::_UpdateShadowMapValidity(
+    HdRenderIndex *renderIndex,
+    GlfSimpleShadowArrayRefPtr const &shadows,
+    std::vector<size_t> const &collectionHashes,
+    bool forceInvalidate)
+{
+    const size_t numShadowMaps = shadows->GetNumShadowMapPasses();
+
+    if (_shadowMapCache.size() != numShadowMaps) {
+        // The shadow map textures are reallocated when their number
+        // changes, so no previous contents survive.
+        _shadowMapCache.clear();
+        _shadowMapCache.resize(numShadowMaps);
+    }
+
+    HdChangeTracker const &tracker = renderIndex->GetChangeTracker();
+
+    bool invalidateAll = forceInvalidate ||
+        !TfGetEnvSetting(HDX_SHADOW_TASK_REUSE_SHADOW_MAPS);
+
+    // Rprim and instancer insertions or removals can affect any shadow
+    // map; the bounds of removed prims are no longer known.
+    if (_rprimIndexVersion != tracker.GetRprimIndexVersion() ||
+        _instancerIndexVersion != tracker.GetInstancerIndexVersion()) {
+        _rprimIndexVersion = tracker.GetRprimIndexVersion();
+        _instancerIndexVersion = tracker.GetInstancerIndexVersion();
+        _lastRprimBounds.clear();
+        invalidateAll = true;
+    }
+
+    std::vector<GfRange3d> dirtyRegions;
+    if (!invalidateAll) {
+        invalidateAll = !_ComputeDirtyRegions(renderIndex, &dirtyRegions);
+    }
+
+    for (size_t id = 0; id < numShadowMaps; ++id) {
+        _ShadowMapCacheEntry &entry = _shadowMapCache[id];
+
+        const GfMatrix4d viewProj =
+            shadows->GetViewMatrix(id) * shadows->GetProjectionMatrix(id);
+        const GfVec2i resolution = shadows->GetShadowMapSize(id);
+        const size_t collectionHash = collectionHashes[id];
+
+        if (invalidateAll ||
+            entry.viewProjMatrix != viewProj ||
+            entry.resolution != resolution ||
+            entry.collectionHash != collectionHash) {
+            entry.valid = false;
+        } else if (entry.valid) {
+            for (GfRange3d const &region : dirtyRegions) {
+                if (GfFrustum::IntersectsViewVolume(
+                        GfBBox3d(region), viewProj)) {
+                    entry.valid = false;
+                    break;
+                }
+            }
+        }
+
+        entry.viewProjMatrix = viewProj;
+        entry.resolution = resolution;
+        entry.collectionHash = collectionHash;
+    }
+}
+
 // ---------------------------------------------------------------------------//
 // VtValue Requirements
 // ---------------------------------------------------------------------------//
@@ -13,11 +13,15 @@
 #include "pxr/imaging/hd/enums.h"
 #include "pxr/imaging/hd/task.h"
 
+#include "pxr/base/gf/matrix4d.h"
+#include "pxr/base/gf/range3d.h"
+#include "pxr/base/gf/vec2i.h"
 #include "pxr/base/gf/vec4f.h"
 #include "pxr/base/gf/vec4d.h"
 #include "pxr/base/tf/declarePtrs.h"
 
 #include <memory>
+#include <unordered_map>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -101,16 +105,53 @@ public:
     HDX_API
     const TfTokenVector &GetRenderTags() const override;
 
+    /// Prepare only touches the task's own render pass states and the
+    /// thread-safe resource registry.
+    bool IsParallelPrepareSafe() const override { return true; }
 
 private:
-    void _UpdateDirtyParams(HdStRenderPassStateSharedPtr &renderPassState, 
+    void _UpdateDirtyParams(HdStRenderPassStateSharedPtr &renderPassState,
         HdxShadowTaskParams const &params);
 
+    // Computes the world space regions invalidated by dirty rprims since
+    // the last sync. Returns false if a conservative set of regions could
+    // not be determined, in which case all shadow maps must be considered
+    // stale.
+    bool _ComputeDirtyRegions(HdRenderIndex *renderIndex,
+                              std::vector<GfRange3d> *regions);
+
+    // Updates the valid flag of each shadow map cache entry: a shadow map
+    // stays valid if its framing, resolution and collection are unchanged
+    // and no dirty region intersects its frustum. Valid maps are skipped
+    // by Execute.
+    void _UpdateShadowMapValidity(HdRenderIndex *renderIndex,
+                                  GlfSimpleShadowArrayRefPtr const &shadows,
+                                  std::vector<size_t> const &collectionHashes,
+                                  bool forceInvalidate);
+
     HdRenderPassSharedPtrVector _passes;
     HdStRenderPassStateSharedPtrVector _renderPassStates;
     HdxShadowTaskParams _params;
     TfTokenVector       _renderTags;
 
+    // Cached state for reusing shadow maps across frames. A map rendered
+    // by a previous Execute stays valid until scene changes that can
+    // affect its depth contents are detected during Sync.
+    struct _ShadowMapCacheEntry {
+        GfMatrix4d viewProjMatrix;
+        GfVec2i resolution = GfVec2i(0);
+        size_t collectionHash = 0;
+        uint64_t textureId = 0;
+        bool valid = false;
+    };
+    std::vector<_ShadowMapCacheEntry> _shadowMapCache;
+
+    // Last known world space bounds of rprims that have been observed
+    // dirty, used to invalidate the region a prim moved away from.
+    std::unordered_map<SdfPath, GfRange3d, SdfPath::Hash> _lastRprimBounds;
+    unsigned _rprimIndexVersion;
+    unsigned _instancerIndexVersion;
+
 
     HdxShadowTask() = delete;
     HdxShadowTask(const HdxShadowTask &) = delete;
@@ -142,7 +142,10 @@ HdxSkydomeTask::Execute(HdTaskContext* ctx)
     // domelight/skydomeTexture, clear the AOVs
     if (!_skydomeVisibility || !haveColorAOV ||
         !haveDomeLight || !_GetSkydomeTexture(ctx)) {
-        _GetHgi()->SubmitCmds(_GetHgi()->CreateGraphicsCmds(gfxCmdsDesc).get());
+        HgiGraphicsCmdsUniquePtr gfxCmds =
+            _GetHgi()->CreateGraphicsCmds(gfxCmdsDesc);
+        gfxCmds->SetSubmissionLabel(TfToken("skydome"));
+        _GetHgi()->SubmitCmds(gfxCmds.get());
         return;
     }
 
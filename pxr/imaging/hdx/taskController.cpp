@@ -15,6 +15,7 @@
 #include "pxr/imaging/hdx/colorizeSelectionTask.h"
 #include "pxr/imaging/hdx/colorCorrectionTask.h"
 #include "pxr/imaging/hdx/freeCameraSceneDelegate.h"
+#include "pxr/imaging/hdx/occlusionCullTask.h"
 #include "pxr/imaging/hdx/oitRenderTask.h"
 #include "pxr/imaging/hdx/oitResolveTask.h"
 #include "pxr/imaging/hdx/oitVolumeRenderTask.h"
@@ -45,6 +46,7 @@ TF_DEFINE_PRIVATE_TOKENS(
     // tasks
     (simpleLightTask)
     (shadowTask)
+    (occlusionCullTask)
     (aovInputTask)
     (selectionTask)
     (colorizeSelectionTask)
@@ -199,6 +201,7 @@ HdxTaskController::HdxTaskController(HdRenderIndex *renderIndex,
 HdxTaskController::~HdxTaskController()
 {
     SdfPath const tasks[] = {
+        _occlusionCullTaskId,
         _aovInputTaskId,
         _oitResolveTaskId,
         _selectionTaskId,
@@ -262,6 +265,7 @@ HdxTaskController::_CreateRenderGraph()
             HdStMaterialTagTokens->volume));
 
         if (_AovsSupported()) {
+            _CreateOcclusionCullTask();
             _CreateAovInputTask();
             _CreateOitResolveTask();
             _CreateSelectionTask();
@@ -497,8 +501,21 @@ HdxTaskController::_CreateShadowTask()
     _delegate.SetParameter(_shadowTaskId, _tokens->renderTags, renderTags);
 }
 
+void
+HdxTaskController::_CreateOcclusionCullTask()
+{
+    _occlusionCullTaskId = GetControllerId().AppendChild(
+        _tokens->occlusionCullTask);
+
+    GetRenderIndex()->InsertTask<HdxOcclusionCullTask>(&_delegate,
+        _occlusionCullTaskId);
+
+    _delegate.SetParameter(_occlusionCullTaskId, HdTokens->params,
+        HdxOcclusionCullTaskParams());
+}
+
 SdfPath
-HdxTaskController::_CreateSkydomeTask() 
+HdxTaskController::_CreateSkydomeTask()
 {
     SdfPath skydomeTaskId = GetControllerId().AppendChild(_tokens->skydomeTask);
     GetRenderIndex()->InsertTask<HdxSkydomeTask>(&_delegate, skydomeTaskId);
@@ -635,6 +652,19 @@ HdxTaskController::_ShadowsEnabled() const
     return simpleLightParams.enableShadows;
 }
 
+bool
+HdxTaskController::_OcclusionCullEnabled() const
+{
+    if (_occlusionCullTaskId.IsEmpty())
+        return false;
+
+    const HdxOcclusionCullTaskParams& occlusionCullParams =
+        _delegate.GetParameter<HdxOcclusionCullTaskParams>(
+                _occlusionCullTaskId, HdTokens->params);
+
+    return occlusionCullParams.enabled;
+}
+
 bool
 HdxTaskController::_SelectionEnabled() const
 {
@@ -705,6 +735,7 @@ HdxTaskController::GetRenderingTasks() const
     /* The superset of tasks we can run, in order, is:
      * - simpleLightTaskId
      * - shadowTaskId
+     * - occlusionCullTaskId
      * - renderTaskIds (There may be more than one)
      * - aovInputTaskId
      * - boundingBoxTaskId
@@ -729,6 +760,12 @@ HdxTaskController::GetRenderingTasks() const
         tasks.push_back(GetRenderIndex()->GetTask(_shadowTaskId));
     }
 
+    // Build the hierarchical depth pyramid from the previous frame's depth
+    // AOV before any draw calls are submitted.
+    if (!_occlusionCullTaskId.IsEmpty() && _OcclusionCullEnabled()) {
+        tasks.push_back(GetRenderIndex()->GetTask(_occlusionCullTaskId));
+    }
+
     // Perform draw calls
     if (!_renderTaskIds.empty()) {
         SdfPath volumeId = _GetRenderTaskPath(HdStMaterialTagTokens->volume);
@@ -1158,6 +1195,25 @@ HdxTaskController::SetViewportRenderOutput(TfToken const& name)
             _aovInputTaskId, HdChangeTracker::DirtyParams);
     }
 
+    if (!_occlusionCullTaskId.IsEmpty()) {
+        HdxOcclusionCullTaskParams occlusionCullParams =
+            _delegate.GetParameter<HdxOcclusionCullTaskParams>(
+                _occlusionCullTaskId, HdTokens->params);
+
+        // The depth AOV only exists when rendering color.
+        if (name == HdAovTokens->color) {
+            occlusionCullParams.depthBufferPath =
+                _GetAovPath(HdAovTokens->depth);
+        } else {
+            occlusionCullParams.depthBufferPath = SdfPath::EmptyPath();
+        }
+
+        _delegate.SetParameter(_occlusionCullTaskId, HdTokens->params,
+            occlusionCullParams);
+        GetRenderIndex()->GetChangeTracker().MarkTaskDirty(
+            _occlusionCullTaskId, HdChangeTracker::DirtyParams);
+    }
+
     if (!_colorizeSelectionTaskId.IsEmpty()) {
         HdxColorizeSelectionTaskParams selParams =
             _delegate.GetParameter<HdxColorizeSelectionTaskParams>(
@@ -1541,6 +1597,25 @@ HdxTaskController::SetEnableShadows(bool enable)
     }
 }
 
+void
+HdxTaskController::SetEnableOcclusionCulling(bool enable)
+{
+    if (_occlusionCullTaskId.IsEmpty()) {
+        return;
+    }
+
+    HdxOcclusionCullTaskParams params =
+        _delegate.GetParameter<HdxOcclusionCullTaskParams>(
+            _occlusionCullTaskId, HdTokens->params);
+
+    if (params.enabled != enable) {
+        params.enabled = enable;
+        _delegate.SetParameter(_occlusionCullTaskId, HdTokens->params, params);
+        GetRenderIndex()->GetChangeTracker().MarkTaskDirty(
+            _occlusionCullTaskId, HdChangeTracker::DirtyParams);
+    }
+}
+
 void
 HdxTaskController::SetEnableSelection(bool enable)
 {
@@ -216,6 +216,15 @@ public:
     HDX_API
     void SetShadowParams(HdxShadowTaskParams const& params);
 
+    /// -------------------------------------------------------
+    /// Occlusion Culling API
+
+    /// Turns the occlusion culling task on or off. When enabled, a
+    /// hierarchical depth pyramid is built from the previous frame's depth
+    /// AOV and published on the task context for GPU occlusion culling.
+    HDX_API
+    void SetEnableOcclusionCulling(bool enable);
+
     /// -------------------------------------------------------
     /// Progressive Image Generation
 
@@ -263,6 +272,7 @@ private:
 
     void _CreateLightingTask();
     void _CreateShadowTask();
+    void _CreateOcclusionCullTask();
     SdfPath _CreateSkydomeTask();
     SdfPath _CreateRenderTask(TfToken const& materialTag);
     void _CreateOitResolveTask();
@@ -285,6 +295,7 @@ private:
 
     // Render graph topology control.
     bool _ShadowsEnabled() const;
+    bool _OcclusionCullEnabled() const;
     bool _SelectionEnabled() const;
     bool _ColorizeSelectionEnabled() const;
     bool _ColorCorrectionEnabled() const;
@@ -377,6 +388,7 @@ private:
     // Generated tasks.
     SdfPath _simpleLightTaskId;
     SdfPath _shadowTaskId;
+    SdfPath _occlusionCullTaskId;
     SdfPathVector _renderTaskIds;
     SdfPath _aovInputTaskId;
     SdfPath _oitResolveTaskId;
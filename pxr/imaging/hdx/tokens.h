@@ -21,6 +21,7 @@ PXR_NAMESPACE_OPEN_SCOPE
     (hdxOitDepthBuffer)         \
     (hdxOitIndexBuffer)         \
     (hdxSelectionBuffer)        \
+    (hierarchicalDepth)         \
     (imagerVersion)             \
     (lightingContext)           \
     (lightingShader)            \
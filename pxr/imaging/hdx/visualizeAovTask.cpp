@@ -490,6 +490,7 @@ HdxVisualizeAovTask::_ApplyVisualizationKernel(
 
     // Begin rendering
     HgiGraphicsCmdsUniquePtr gfxCmds = _GetHgi()->CreateGraphicsCmds(gfxDesc);
+    gfxCmds->SetSubmissionLabel(TfToken("visualizeAov"));
     gfxCmds->PushDebugGroup("Visualize AOV");
     gfxCmds->BindResources(_resourceBindings);
     gfxCmds->BindPipeline(_pipeline);
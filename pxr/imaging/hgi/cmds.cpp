@@ -20,6 +20,18 @@ HgiCmds::IsSubmitted() const
     return _submitted;
 }
 
+void
+HgiCmds::SetSubmissionLabel(TfToken const& label)
+{
+    _submissionLabel = label;
+}
+
+TfToken const&
+HgiCmds::GetSubmissionLabel() const
+{
+    return _submissionLabel;
+}
+
 bool
 HgiCmds::_Submit(Hgi* hgi, HgiSubmitWaitType wait)
 {
@@ -10,6 +10,7 @@
 #include "pxr/pxr.h"
 #include "pxr/imaging/hgi/api.h"
 #include "pxr/imaging/hgi/enums.h"
+#include "pxr/base/tf/token.h"
 #include <memory>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -34,6 +35,19 @@ public:
     HGI_API
     bool IsSubmitted() const;
 
+    /// Optionally label the work recorded in this cmds object (e.g. with the
+    /// name of the Hydra task that recorded it). When a label is set and the
+    /// backend supports GPU time queries (see Hgi::SupportsGpuTimeQueries),
+    /// submission of this cmds object is bracketed with a timestamp query
+    /// pair and the measured GPU time is reported under this label via
+    /// Hgi::ConsumeGpuTimeQueryResults.
+    HGI_API
+    void SetSubmissionLabel(TfToken const& label);
+
+    /// Returns the submission label, which is empty by default.
+    HGI_API
+    TfToken const& GetSubmissionLabel() const;
+
 protected:
     friend class Hgi;
 
@@ -55,6 +69,7 @@ private:
     HgiCmds(const HgiCmds&) = delete;
 
     bool _submitted;
+    TfToken _submissionLabel;
 };
 
 
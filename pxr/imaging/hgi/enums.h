@@ -58,6 +58,16 @@ using HgiBits = uint32_t;
 ///   The device requires workaround for primitive id</li>
 /// <li>HgiDeviceCapabilitiesBitsIndirectCommandBuffers:
 ///   Indirect command buffers are supported</li>
+/// <li>HgiDeviceCapabilitiesBitsPersistentStagingBuffers:
+///   Staging buffers remain persistently mapped in CPU-visible memory, so
+///   writes through GetCPUStagingAddress reach the GPU without an explicit
+///   CPU to GPU copy</li>
+/// <li>HgiDeviceCapabilitiesBitsIndirectCountDraws:
+///   Multi-draw indirect commands can source their draw count from a
+///   GPU buffer</li>
+/// <li>HgiDeviceCapabilitiesBitsParallelCmdsRecording:
+///   HgiGraphicsCmds::RecordParallel records its segments concurrently
+///   on worker threads rather than falling back to serial recording</li>
 /// </ul>
 ///
 enum HgiDeviceCapabilitiesBits : HgiBits
@@ -80,6 +90,9 @@ enum HgiDeviceCapabilitiesBits : HgiBits
     HgiDeviceCapabilitiesBitsBasePrimitiveOffset     = 1 << 15,
     HgiDeviceCapabilitiesBitsPrimitiveIdEmulation    = 1 << 16,
     HgiDeviceCapabilitiesBitsIndirectCommandBuffers  = 1 << 17,
+    HgiDeviceCapabilitiesBitsPersistentStagingBuffers = 1 << 18,
+    HgiDeviceCapabilitiesBitsIndirectCountDraws      = 1 << 19,
+    HgiDeviceCapabilitiesBitsParallelCmdsRecording   = 1 << 20,
 };
 
 using HgiDeviceCapabilities = HgiBits;
@@ -293,6 +306,9 @@ enum HgiAttachmentStoreOp
 ///   Vertex attributes.</li>
 /// <li>HgiBufferUsageStorage:
 ///   Shader storage buffer / Argument buffer.</li>
+/// <li>HgiBufferUsageStaging:
+///   The buffer stages CPU data for copying into other GPU buffers.
+///   Backends may keep it persistently mapped in CPU-visible memory.</li>
 ///
 /// <li>HgiBufferUsageCustomBitsBegin:
 ///   This bit (and any bit after) can be used to attached custom, backend
@@ -306,8 +322,9 @@ enum HgiBufferUsageBits : HgiBits
     HgiBufferUsageVertex   = 1 << 2,
     HgiBufferUsageStorage  = 1 << 3,
     HgiBufferUsageIndirect = 1 << 4,
+    HgiBufferUsageStaging  = 1 << 5,
 
-    HgiBufferUsageCustomBitsBegin = 1 << 5,
+    HgiBufferUsageCustomBitsBegin = 1 << 6,
 };
 using HgiBufferUsage = HgiBits;
 
@@ -12,4 +12,61 @@ HgiGraphicsCmds::HgiGraphicsCmds() = default;
 
 HgiGraphicsCmds::~HgiGraphicsCmds() = default;
 
+void
+HgiGraphicsCmds::DrawIndirectCount(
+    HgiBufferHandle const& drawParameterBuffer,
+    uint32_t drawBufferByteOffset,
+    HgiBufferHandle const& drawCountBuffer,
+    uint32_t drawCountByteOffset,
+    uint32_t maxDrawCount,
+    uint32_t stride)
+{
+    // Fallback for backends without indirect count draw support: submit
+    // the maximum number of draws and rely on the draw parameters to
+    // describe empty draws for any unused entries.
+    DrawIndirect(
+        drawParameterBuffer,
+        drawBufferByteOffset,
+        maxDrawCount,
+        stride);
+}
+
+void
+HgiGraphicsCmds::DrawIndexedIndirectCount(
+    HgiBufferHandle const& indexBuffer,
+    HgiBufferHandle const& drawParameterBuffer,
+    uint32_t drawBufferByteOffset,
+    HgiBufferHandle const& drawCountBuffer,
+    uint32_t drawCountByteOffset,
+    uint32_t maxDrawCount,
+    uint32_t stride,
+    std::vector<uint32_t> const& drawParameterBufferUInt32,
+    uint32_t patchBaseVertexByteOffset)
+{
+    // Fallback for backends without indirect count draw support: submit
+    // the maximum number of draws and rely on the draw parameters to
+    // describe empty draws for any unused entries.
+    DrawIndexedIndirect(
+        indexBuffer,
+        drawParameterBuffer,
+        drawBufferByteOffset,
+        maxDrawCount,
+        stride,
+        drawParameterBufferUInt32,
+        patchBaseVertexByteOffset);
+}
+
+void
+HgiGraphicsCmds::RecordParallel(
+    uint32_t numSegments,
+    HgiGraphicsCmdsRecordFn const &recordFn)
+{
+    // Fallback for backends without parallel command recording support:
+    // record the segments serially, in segment order, into this cmds
+    // object, which is equivalent by definition.
+    for (uint32_t i = 0; i < numSegments; ++i) {
+        recordFn(i, this);
+    }
+}
+
 PXR_NAMESPACE_CLOSE_SCOPE
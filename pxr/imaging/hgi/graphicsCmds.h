@@ -14,12 +14,19 @@
 #include "pxr/imaging/hgi/graphicsPipeline.h"
 #include "pxr/imaging/hgi/resourceBindings.h"
 #include "pxr/imaging/hgi/cmds.h"
+#include <functional>
 #include <memory>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
 using HgiGraphicsCmdsUniquePtr = std::unique_ptr<class HgiGraphicsCmds>;
 
+/// Records the commands of one segment of a RecordParallel call.
+/// `segmentIndex`: The index of the segment being recorded.
+/// `segmentCmds`: The cmds object to record the segment's commands into.
+using HgiGraphicsCmdsRecordFn =
+    std::function<void(uint32_t segmentIndex, HgiGraphicsCmds *segmentCmds)>;
+
 
 /// \class HgiGraphicsCmds
 ///
@@ -122,6 +129,24 @@ public:
         uint32_t drawCount,
         uint32_t stride) = 0;
 
+    /// Records a multi-draw command like DrawIndirect, except that the
+    /// number of draws to execute is read from `drawCountBuffer` at
+    /// execution time rather than being provided by the CPU.
+    /// Backends that report HgiDeviceCapabilitiesBitsIndirectCountDraws
+    /// read a single uint32_t draw count from `drawCountBuffer` at
+    /// `drawCountByteOffset`, clamped to `maxDrawCount`. The default
+    /// implementation ignores the count buffer and submits `maxDrawCount`
+    /// draws, so callers that populate only the first N draw parameters
+    /// on the GPU must check the capability bit before using this command.
+    HGI_API
+    virtual void DrawIndirectCount(
+        HgiBufferHandle const& drawParameterBuffer,
+        uint32_t drawBufferByteOffset,
+        HgiBufferHandle const& drawCountBuffer,
+        uint32_t drawCountByteOffset,
+        uint32_t maxDrawCount,
+        uint32_t stride);
+
     /// Records a draw command that renders one or more instances of primitives
     /// using an indexBuffer starting from the base vertex.
     /// The 'primitive type' (eg. Lines, Triangles, etc) can be acquired from
@@ -181,11 +206,49 @@ public:
         std::vector<uint32_t> const& drawParameterBufferUInt32,
         uint32_t patchBaseVertexByteOffset) = 0;
 
+    /// Records an indexed multi-draw command like DrawIndexedIndirect,
+    /// except that the number of draws to execute is read from
+    /// `drawCountBuffer` at execution time rather than being provided by
+    /// the CPU.
+    /// Backends that report HgiDeviceCapabilitiesBitsIndirectCountDraws
+    /// read a single uint32_t draw count from `drawCountBuffer` at
+    /// `drawCountByteOffset`, clamped to `maxDrawCount`. The default
+    /// implementation ignores the count buffer and submits `maxDrawCount`
+    /// draws, so callers that populate only the first N draw parameters
+    /// on the GPU must check the capability bit before using this command.
+    HGI_API
+    virtual void DrawIndexedIndirectCount(
+        HgiBufferHandle const& indexBuffer,
+        HgiBufferHandle const& drawParameterBuffer,
+        uint32_t drawBufferByteOffset,
+        HgiBufferHandle const& drawCountBuffer,
+        uint32_t drawCountByteOffset,
+        uint32_t maxDrawCount,
+        uint32_t stride,
+        std::vector<uint32_t> const& drawParameterBufferUInt32,
+        uint32_t patchBaseVertexByteOffset);
+
     /// Inserts a barrier so that data written to memory by commands before
     /// the barrier is available to commands after the barrier.
     HGI_API
     virtual void InsertMemoryBarrier(HgiMemoryBarrier barrier) = 0;
 
+    /// Records `numSegments` segments of commands as if `recordFn` had been
+    /// invoked once per segment, in segment order, against this cmds object.
+    /// Backends that advertise HgiDeviceCapabilitiesBitsParallelCmdsRecording
+    /// invoke `recordFn` concurrently from worker threads, each with its own
+    /// secondary cmds object, and stitch the segments together in segment
+    /// order on submission; other backends fall back to recording the
+    /// segments serially.
+    /// `recordFn` must only invoke command recording functions on the cmds
+    /// object it is handed, and must be safe to invoke concurrently.
+    /// Render pass state recorded before this call (pipeline, resource and
+    /// vertex buffer bindings) is visible to every segment.
+    HGI_API
+    virtual void RecordParallel(
+        uint32_t numSegments,
+        HgiGraphicsCmdsRecordFn const &recordFn);
+
 protected:
     HGI_API
     HgiGraphicsCmds();
@@ -37,11 +37,47 @@ Hgi::SubmitCmds(HgiCmds* cmds, HgiSubmitWaitType wait)
     TRACE_FUNCTION();
 
     if (cmds && TF_VERIFY(!cmds->IsSubmitted())) {
+        TfToken const& label = cmds->GetSubmissionLabel();
+        const bool timed = !label.IsEmpty() && SupportsGpuTimeQueries();
+        if (timed) {
+            _BeginGpuTimeQuery(label);
+        }
         _SubmitCmds(cmds, wait);
+        if (timed) {
+            _EndGpuTimeQuery();
+        }
         cmds->_SetSubmitted();
     }
 }
 
+void
+Hgi::DefragmentMemory()
+{
+    // Backends without sub-allocation have nothing to compact.
+}
+
+bool
+Hgi::SupportsGpuTimeQueries() const
+{
+    return false;
+}
+
+bool
+Hgi::ConsumeGpuTimeQueryResults(HgiGpuTimeQueryResultVector* results)
+{
+    return false;
+}
+
+void
+Hgi::_BeginGpuTimeQuery(TfToken const& name)
+{
+}
+
+void
+Hgi::_EndGpuTimeQuery()
+{
+}
+
 static Hgi*
 _MakeNewPlatformDefaultHgi()
 {
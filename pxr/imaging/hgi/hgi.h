@@ -27,7 +27,9 @@
 #include "pxr/imaging/hgi/types.h"
 
 #include <atomic>
+#include <cstdint>
 #include <memory>
+#include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -36,6 +38,19 @@ class HgiIndirectCommandEncoder;
 
 using HgiUniquePtr = std::unique_ptr<class Hgi>;
 
+/// \struct HgiGpuTimeQueryResult
+///
+/// The measured GPU time of one labeled command submission, harvested via
+/// Hgi::ConsumeGpuTimeQueryResults. The label comes from the submitted cmds
+/// object (see HgiCmds::SetSubmissionLabel).
+struct HgiGpuTimeQueryResult
+{
+    TfToken name;
+    uint64_t nanoseconds = 0;
+};
+
+using HgiGpuTimeQueryResultVector = std::vector<HgiGpuTimeQueryResult>;
+
 
 /// \class Hgi
 ///
@@ -324,6 +339,38 @@ public:
     HGI_API
     virtual void EndFrame() = 0;
 
+    /// Optionally called to compact GPU memory. Backends that sub-allocate
+    /// GPU memory from larger blocks may move idle allocations closer
+    /// together to reduce fragmentation. The work performed by one call is
+    /// bounded, so clients can schedule this during idle frames and call it
+    /// repeatedly to converge. Since allocations may move, any backend
+    /// resource handles cached outside of Hgi (e.g. HgiResourceBindings
+    /// created from buffers) must be recreated after this call.
+    /// The default implementation does nothing.
+    /// Thread safety: Not thread safe. No GPU work may be recorded or in
+    /// flight while this runs.
+    HGI_API
+    virtual void DefragmentMemory();
+
+    /// Returns true if the backend can measure GPU execution time of command
+    /// submissions with timestamp queries. When true, SubmitCmds brackets
+    /// each labeled cmds object (see HgiCmds::SetSubmissionLabel) with a
+    /// timestamp query pair; results are harvested asynchronously with
+    /// ConsumeGpuTimeQueryResults. The default implementation returns false.
+    /// Thread safety: This call is thread safe.
+    HGI_API
+    virtual bool SupportsGpuTimeQueries() const;
+
+    /// Returns completed GPU time query results, appending them to
+    /// \p results, and removes them from the pending set. Queries whose
+    /// results have not landed yet remain pending and are returned by a
+    /// later call; this never blocks on the GPU. Returns false if the
+    /// backend does not support GPU time queries.
+    /// Thread safety: Not thread safe. Should be called on the main thread.
+    HGI_API
+    virtual bool ConsumeGpuTimeQueryResults(
+        HgiGpuTimeQueryResultVector* results);
+
 protected:
     // Returns a unique id for handle creation.
     // Thread safety: Thread-safe atomic increment.
@@ -337,6 +384,17 @@ protected:
     virtual bool _SubmitCmds(
         HgiCmds* cmds, HgiSubmitWaitType wait);
 
+    // Begins a GPU time query labeled \p name around the commands submitted
+    // next. Called by SubmitCmds for labeled cmds objects when the backend
+    // supports GPU time queries. The default implementation does nothing.
+    HGI_API
+    virtual void _BeginGpuTimeQuery(TfToken const& name);
+
+    // Ends the GPU time query begun by the matching _BeginGpuTimeQuery.
+    // The default implementation does nothing.
+    HGI_API
+    virtual void _EndGpuTimeQuery();
+
 private:
     Hgi & operator=(const Hgi&) = delete;
     Hgi(const Hgi&) = delete;
@@ -16,6 +16,7 @@ HgiGLBuffer::HgiGLBuffer(HgiBufferDesc const & desc)
     : HgiBuffer(desc)
     , _bufferId(0)
     , _cpuStaging(nullptr)
+    , _persistentlyMapped(false)
     , _bindlessGPUAddress(0)
 {
 
@@ -29,11 +30,27 @@ HgiGLBuffer::HgiGLBuffer(HgiBufferDesc const & desc)
         HgiGLObjectLabel(GL_BUFFER, _bufferId,  _descriptor.debugName);
     }
 
-    glNamedBufferData(
-        _bufferId,
-        _descriptor.byteSize,
-        _descriptor.initialData,
-        GL_STATIC_DRAW);
+    if (_descriptor.usage & HgiBufferUsageStaging) {
+        // Staging buffers are persistently mapped so that clients write
+        // directly into GPU-visible memory and no separate CPU shadow copy
+        // (and subsequent CPU to GPU upload) is needed.
+        const GLbitfield mapFlags =
+            GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glNamedBufferStorage(
+            _bufferId,
+            _descriptor.byteSize,
+            _descriptor.initialData,
+            mapFlags | GL_DYNAMIC_STORAGE_BIT);
+        _cpuStaging = glMapNamedBufferRange(
+            _bufferId, 0, _descriptor.byteSize, mapFlags);
+        _persistentlyMapped = (_cpuStaging != nullptr);
+    } else {
+        glNamedBufferData(
+            _bufferId,
+            _descriptor.byteSize,
+            _descriptor.initialData,
+            GL_STATIC_DRAW);
+    }
 
     // glBindVertexBuffer (graphics cmds) needs to know the stride of each
     // vertex buffer. Make sure user provides it.
@@ -48,6 +65,11 @@ HgiGLBuffer::HgiGLBuffer(HgiBufferDesc const & desc)
 
 HgiGLBuffer::~HgiGLBuffer()
 {
+    if (_persistentlyMapped && _bufferId > 0) {
+        glUnmapNamedBuffer(_bufferId);
+        _cpuStaging = nullptr;
+    }
+
     if (_bufferId > 0) {
         glDeleteBuffers(1, &_bufferId);
         _bufferId = 0;
@@ -76,13 +98,17 @@ HgiGLBuffer::GetRawResource() const
 void*
 HgiGLBuffer::GetCPUStagingAddress()
 {
+    // Persistently mapped staging buffers hand out the mapped pointer;
+    // writes through it are GPU-visible without an explicit copy because the
+    // mapping is coherent.
     if (!_cpuStaging) {
         _cpuStaging = malloc(_descriptor.byteSize);
     }
 
     // This lets the client code memcpy into the cpu staging buffer directly.
-    // The staging data must be explicitely copied to the GPU buffer
-    // via CopyBufferCpuToGpu cmd by the client.
+    // For non-persistently mapped buffers the staging data must be
+    // explicitely copied to the GPU buffer via CopyBufferCpuToGpu cmd by
+    // the client.
     return _cpuStaging;
 }
 
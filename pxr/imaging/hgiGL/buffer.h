@@ -52,6 +52,7 @@ private:
 
     uint32_t _bufferId;
     void* _cpuStaging;
+    bool _persistentlyMapped;
     uint64_t _bindlessGPUAddress;
 };
 
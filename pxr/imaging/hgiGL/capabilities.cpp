@@ -62,6 +62,7 @@ HgiGLCapabilities::_LoadCapabilities()
     bool builtinBarycentricsEnabled   = false;
     bool shaderDrawParametersEnabled  = false;
     bool conservativeRasterEnabled    = false;
+    bool indirectCountDrawsEnabled    = false;
 
     const char *glVendorStr = (const char*)glGetString(GL_VENDOR);
     const char *glRendererStr = (const char*)glGetString(GL_RENDERER);
@@ -125,6 +126,7 @@ HgiGLCapabilities::_LoadCapabilities()
     }
     if (_glVersion >= 460) {
         shaderDrawParametersEnabled = true;
+        indirectCountDrawsEnabled = true;
     }
 
     // initialize by individual extension.
@@ -146,6 +148,9 @@ HgiGLCapabilities::_LoadCapabilities()
     if (GARCH_GLAPI_HAS(NV_conservative_raster)) {
         conservativeRasterEnabled = true;
     }
+    if (GARCH_GLAPI_HAS(ARB_indirect_parameters)) {
+        indirectCountDrawsEnabled = true;
+    }
 
     // Environment variable overrides (only downgrading is possible)
     if (!TfGetEnvSetting(HGIGL_ENABLE_BINDLESS_TEXTURE)) {
@@ -191,6 +196,15 @@ HgiGLCapabilities::_LoadCapabilities()
         true);
     _SetFlag(HgiDeviceCapabilitiesBitsCustomDepthRange,
         true);
+    // Buffer storage with persistent, coherent mapping is core since 4.4.
+    _SetFlag(HgiDeviceCapabilitiesBitsPersistentStagingBuffers,
+        true);
+    _SetFlag(HgiDeviceCapabilitiesBitsIndirectCountDraws,
+        indirectCountDrawsEnabled);
+    // Command recording captures deferred ops without issuing GL calls, so
+    // segments can be recorded concurrently and spliced on submission.
+    _SetFlag(HgiDeviceCapabilitiesBitsParallelCmdsRecording,
+        true);
 
     if (TfDebug::IsEnabled(HGI_DEBUG_DEVICE_CAPABILITIES)) {
         std::cout
@@ -216,6 +230,8 @@ HgiGLCapabilities::_LoadCapabilities()
             // order alphabetically
             << "  ARB_bindless_texture               = "
             <<    bindlessTextureEnabled << "\n"
+            << "  ARB_indirect_parameters            = "
+            <<    indirectCountDrawsEnabled << "\n"
             << "  ARB_multi_draw_indirect            = "
             <<    multiDrawIndirectEnabled << "\n"
             << "  ARB_shader_draw_parameters         = "
@@ -18,6 +18,10 @@
 #include "pxr/imaging/hgiGL/resourceBindings.h"
 #include "pxr/imaging/hgiGL/scopedStateHolder.h"
 
+#include "pxr/base/work/loops.h"
+
+#include <iterator>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 HgiGLGraphicsCmds::HgiGLGraphicsCmds(
@@ -32,12 +36,25 @@ HgiGLGraphicsCmds::HgiGLGraphicsCmds(
     , _restoreDrawFramebuffer(0)
 {
     if (desc.HasAttachments()) {
-        glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &_restoreReadFramebuffer);    
+        glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &_restoreReadFramebuffer);
         glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &_restoreDrawFramebuffer);
         _ops.push_back( HgiGLOps::BindFramebufferOp(device, desc) );
     }
 }
 
+HgiGLGraphicsCmds::HgiGLGraphicsCmds(HgiGLGraphicsCmds const *primary)
+    : HgiGraphicsCmds()
+    , _recording(true)
+    , _primitiveType(primary->_primitiveType)
+    , _primitiveIndexSize(primary->_primitiveIndexSize)
+    , _pushStack(0)
+    , _restoreReadFramebuffer(0)
+    , _restoreDrawFramebuffer(0)
+{
+    // The empty descriptor means there is no framebuffer state to set up
+    // or restore; the primary cmds object owns that.
+}
+
 static bool
 _IsValidFbo(int32_t id)
 {
@@ -152,6 +169,28 @@ HgiGLGraphicsCmds::DrawIndirect(
         );
 }
 
+void
+HgiGLGraphicsCmds::DrawIndirectCount(
+    HgiBufferHandle const& drawParameterBuffer,
+    uint32_t drawBufferByteOffset,
+    HgiBufferHandle const& drawCountBuffer,
+    uint32_t drawCountByteOffset,
+    uint32_t maxDrawCount,
+    uint32_t stride)
+{
+    _ops.push_back(
+        HgiGLOps::DrawIndirectCount(
+            _primitiveType,
+            _primitiveIndexSize,
+            drawParameterBuffer,
+            drawBufferByteOffset,
+            drawCountBuffer,
+            drawCountByteOffset,
+            maxDrawCount,
+            stride)
+        );
+}
+
 void
 HgiGLGraphicsCmds::DrawIndexed(
     HgiBufferHandle const& indexBuffer,
@@ -196,6 +235,32 @@ HgiGLGraphicsCmds::DrawIndexedIndirect(
         );
 }
 
+void
+HgiGLGraphicsCmds::DrawIndexedIndirectCount(
+    HgiBufferHandle const& indexBuffer,
+    HgiBufferHandle const& drawParameterBuffer,
+    uint32_t drawBufferByteOffset,
+    HgiBufferHandle const& drawCountBuffer,
+    uint32_t drawCountByteOffset,
+    uint32_t maxDrawCount,
+    uint32_t stride,
+    std::vector<uint32_t> const& /*drawParameterBufferUInt32*/,
+    uint32_t /*patchBaseVertexByteOffset*/)
+{
+    _ops.push_back(
+        HgiGLOps::DrawIndexedIndirectCount(
+            _primitiveType,
+            _primitiveIndexSize,
+            indexBuffer,
+            drawParameterBuffer,
+            drawBufferByteOffset,
+            drawCountBuffer,
+            drawCountByteOffset,
+            maxDrawCount,
+            stride)
+        );
+}
+
 void
 HgiGLGraphicsCmds::PushDebugGroup(const char* label)
 {
@@ -220,6 +285,49 @@ HgiGLGraphicsCmds::InsertMemoryBarrier(HgiMemoryBarrier barrier)
     _ops.push_back( HgiGLOps::InsertMemoryBarrier(barrier) );
 }
 
+void
+HgiGLGraphicsCmds::RecordParallel(
+    uint32_t numSegments,
+    HgiGraphicsCmdsRecordFn const &recordFn)
+{
+    if (numSegments <= 1) {
+        // Nothing to parallelize.
+        HgiGraphicsCmds::RecordParallel(numSegments, recordFn);
+        return;
+    }
+
+    // GL executes the deferred op list on submission, so parallel recording
+    // is emulated by letting each worker thread capture its segment's ops
+    // into a secondary cmds object and splicing the op lists together in
+    // segment order afterwards. No GL calls are issued while recording, so
+    // worker threads do not need a current GL context.
+    std::vector<std::unique_ptr<HgiGLGraphicsCmds>> segments;
+    segments.reserve(numSegments);
+    for (uint32_t i = 0; i < numSegments; ++i) {
+        segments.emplace_back(new HgiGLGraphicsCmds(this));
+    }
+
+    WorkParallelForN(
+        numSegments,
+        [&recordFn, &segments](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                recordFn(static_cast<uint32_t>(i), segments[i].get());
+            }
+        });
+
+    for (std::unique_ptr<HgiGLGraphicsCmds> const &segment : segments) {
+        _ops.insert(
+            _ops.end(),
+            std::make_move_iterator(segment->_ops.begin()),
+            std::make_move_iterator(segment->_ops.end()));
+    }
+
+    // Recording state set within the segments (e.g. the primitive type of
+    // the last bound pipeline) carries forward to subsequent commands.
+    _primitiveType = segments.back()->_primitiveType;
+    _primitiveIndexSize = segments.back()->_primitiveIndexSize;
+}
+
 bool
 HgiGLGraphicsCmds::_Submit(Hgi* hgi, HgiSubmitWaitType wait)
 {
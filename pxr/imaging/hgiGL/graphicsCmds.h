@@ -81,6 +81,15 @@ public:
         uint32_t drawCount,
         uint32_t stride) override;
 
+    HGIGL_API
+    void DrawIndirectCount(
+        HgiBufferHandle const& drawParameterBuffer,
+        uint32_t drawBufferByteOffset,
+        HgiBufferHandle const& drawCountBuffer,
+        uint32_t drawCountByteOffset,
+        uint32_t maxDrawCount,
+        uint32_t stride) override;
+
     HGIGL_API
     void DrawIndexed(
         HgiBufferHandle const& indexBuffer,
@@ -100,9 +109,26 @@ public:
         std::vector<uint32_t> const& drawParameterBufferUInt32,
         uint32_t patchBaseVertexByteOffset) override;
 
+    HGIGL_API
+    void DrawIndexedIndirectCount(
+        HgiBufferHandle const& indexBuffer,
+        HgiBufferHandle const& drawParameterBuffer,
+        uint32_t drawBufferByteOffset,
+        HgiBufferHandle const& drawCountBuffer,
+        uint32_t drawCountByteOffset,
+        uint32_t maxDrawCount,
+        uint32_t stride,
+        std::vector<uint32_t> const& drawParameterBufferUInt32,
+        uint32_t patchBaseVertexByteOffset) override;
+
     HGIGL_API
     void InsertMemoryBarrier(HgiMemoryBarrier barrier) override;
 
+    HGIGL_API
+    void RecordParallel(
+        uint32_t numSegments,
+        HgiGraphicsCmdsRecordFn const &recordFn) override;
+
 protected:
     friend class HgiGL;
 
@@ -119,6 +145,12 @@ private:
     HgiGLGraphicsCmds & operator=(const HgiGLGraphicsCmds&) = delete;
     HgiGLGraphicsCmds(const HgiGLGraphicsCmds&) = delete;
 
+    /// Constructs a secondary cmds object used by RecordParallel to record
+    /// one segment's ops on a worker thread. Secondary cmds inherit the
+    /// primary's recording state but no attachments, and are never
+    /// submitted; their ops are spliced into the primary's op list.
+    explicit HgiGLGraphicsCmds(HgiGLGraphicsCmds const *primary);
+
     /// This performs multisample resolve when needed at the end of recording.
     void _AddResolveToOps(HgiGLDevice* device);
 
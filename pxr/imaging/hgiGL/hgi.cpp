@@ -67,6 +67,12 @@ HgiGL::HgiGL()
 
 HgiGL::~HgiGL()
 {
+    for (_GpuTimeQuery const& query : _pendingTimeQueries) {
+        glDeleteQueries(1, &query.beginQuery);
+        if (query.endQuery != 0) {
+            glDeleteQueries(1, &query.endQuery);
+        }
+    }
     _garbageCollector.PerformGarbageCollection();
     delete _device;
 }
@@ -287,6 +293,74 @@ HgiGL::EndFrame()
     }
 }
 
+bool
+HgiGL::SupportsGpuTimeQueries() const
+{
+    // Timer queries are core since OpenGL 3.3 and HgiGL requires 4.5.
+    return true;
+}
+
+bool
+HgiGL::ConsumeGpuTimeQueryResults(HgiGpuTimeQueryResultVector* results)
+{
+    // Harvest completed queries without stalling; queries whose end
+    // timestamp has not landed yet stay pending for a later call.
+    for (auto it = _pendingTimeQueries.begin();
+         it != _pendingTimeQueries.end();) {
+        if (it->endQuery == 0) {
+            ++it;
+            continue;
+        }
+        GLint available = 0;
+        glGetQueryObjectiv(
+            it->endQuery, GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available) {
+            ++it;
+            continue;
+        }
+        GLuint64 beginTime = 0;
+        GLuint64 endTime = 0;
+        glGetQueryObjectui64v(it->beginQuery, GL_QUERY_RESULT, &beginTime);
+        glGetQueryObjectui64v(it->endQuery, GL_QUERY_RESULT, &endTime);
+        if (results) {
+            HgiGpuTimeQueryResult result;
+            result.name = it->name;
+            result.nanoseconds = endTime > beginTime ? endTime - beginTime : 0;
+            results->push_back(std::move(result));
+        }
+        glDeleteQueries(1, &it->beginQuery);
+        glDeleteQueries(1, &it->endQuery);
+        it = _pendingTimeQueries.erase(it);
+    }
+
+    HGIGL_POST_PENDING_GL_ERRORS();
+
+    return true;
+}
+
+void
+HgiGL::_BeginGpuTimeQuery(TfToken const& name)
+{
+    _GpuTimeQuery query;
+    query.name = name;
+    glGenQueries(1, &query.beginQuery);
+    glQueryCounter(query.beginQuery, GL_TIMESTAMP);
+    _pendingTimeQueries.push_back(std::move(query));
+}
+
+void
+HgiGL::_EndGpuTimeQuery()
+{
+    if (_pendingTimeQueries.empty() ||
+        _pendingTimeQueries.back().endQuery != 0) {
+        TF_CODING_ERROR("No open GPU time query");
+        return;
+    }
+    _GpuTimeQuery &query = _pendingTimeQueries.back();
+    glGenQueries(1, &query.endQuery);
+    glQueryCounter(query.endQuery, GL_TIMESTAMP);
+}
+
 HgiGLContextArenaHandle
 HgiGL::CreateContextArena()
 {
@@ -156,6 +156,13 @@ public:
     HGIGL_API
     void EndFrame() override;
 
+    HGIGL_API
+    bool SupportsGpuTimeQueries() const override;
+
+    HGIGL_API
+    bool ConsumeGpuTimeQueryResults(
+        HgiGpuTimeQueryResultVector* results) override;
+
     /// ------------------------------------------------------------------------
     // HgiGL specific API
     /// ------------------------------------------------------------------------
@@ -188,6 +195,12 @@ protected:
     HGIGL_API
     bool _SubmitCmds(HgiCmds* cmds, HgiSubmitWaitType wait) override;
 
+    HGIGL_API
+    void _BeginGpuTimeQuery(TfToken const& name) override;
+
+    HGIGL_API
+    void _EndGpuTimeQuery() override;
+
 private:
     HgiGL & operator=(const HgiGL&) = delete;
     HgiGL(const HgiGL&) = delete;
@@ -202,10 +215,19 @@ private:
         *handle = HgiHandle<T>();
     }
 
+    // One in-flight GPU time query: a pair of GL timestamp queries
+    // bracketing a labeled command submission.
+    struct _GpuTimeQuery {
+        TfToken name;
+        uint32_t beginQuery = 0;
+        uint32_t endQuery = 0;
+    };
+
     HgiGLDevice* _device;
     std::unique_ptr<HgiGLCapabilities> _capabilities;
     HgiGLGarbageCollector _garbageCollector;
     int _frameDepth;
+    std::vector<_GpuTimeQuery> _pendingTimeQueries;
 };
 
 /// ----------------------------------------------------------------------------
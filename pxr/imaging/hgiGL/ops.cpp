@@ -650,6 +650,46 @@ HgiGLOps::DrawIndirect(
     };
 }
 
+HgiGLOpsFn
+HgiGLOps::DrawIndirectCount(
+    HgiPrimitiveType primitiveType,
+    uint32_t primitiveIndexSize,
+    HgiBufferHandle const& drawParameterBuffer,
+    uint32_t drawBufferByteOffset,
+    HgiBufferHandle const& drawCountBuffer,
+    uint32_t drawCountByteOffset,
+    uint32_t maxDrawCount,
+    uint32_t stride)
+{
+    return [primitiveType, primitiveIndexSize,
+            drawParameterBuffer, drawBufferByteOffset,
+            drawCountBuffer, drawCountByteOffset, maxDrawCount, stride] {
+        TRACE_SCOPE("HgiGLOps::DrawIndirectCount");
+
+        HgiGLBuffer* drawBuf =
+            static_cast<HgiGLBuffer*>(drawParameterBuffer.Get());
+        HgiGLBuffer* countBuf =
+            static_cast<HgiGLBuffer*>(drawCountBuffer.Get());
+
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, drawBuf->GetBufferId());
+        glBindBuffer(GL_PARAMETER_BUFFER, countBuf->GetBufferId());
+
+        if (primitiveType == HgiPrimitiveTypePatchList) {
+            glPatchParameteri(GL_PATCH_VERTICES, primitiveIndexSize);
+        }
+
+        glMultiDrawArraysIndirectCount(
+            HgiGLConversions::GetPrimitiveType(primitiveType),
+            reinterpret_cast<const void*>(
+                static_cast<uintptr_t>(drawBufferByteOffset)),
+            static_cast<GLintptr>(drawCountByteOffset),
+            maxDrawCount,
+            stride);
+
+        HGIGL_POST_PENDING_GL_ERRORS();
+    };
+}
+
 HgiGLOpsFn
 HgiGLOps::DrawIndexed(
     HgiPrimitiveType primitiveType,
@@ -728,6 +768,52 @@ HgiGLOps::DrawIndexedIndirect(
     };
 }
 
+HgiGLOpsFn
+HgiGLOps::DrawIndexedIndirectCount(
+    HgiPrimitiveType primitiveType,
+    uint32_t primitiveIndexSize,
+    HgiBufferHandle const& indexBuffer,
+    HgiBufferHandle const& drawParameterBuffer,
+    uint32_t drawBufferByteOffset,
+    HgiBufferHandle const& drawCountBuffer,
+    uint32_t drawCountByteOffset,
+    uint32_t maxDrawCount,
+    uint32_t stride)
+{
+    return [primitiveType, primitiveIndexSize,
+            indexBuffer, drawParameterBuffer, drawBufferByteOffset,
+            drawCountBuffer, drawCountByteOffset, maxDrawCount, stride] {
+        TRACE_SCOPE("HgiGLOps::DrawIndexedIndirectCount");
+
+        HgiGLBuffer* indexBuf = static_cast<HgiGLBuffer*>(indexBuffer.Get());
+
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuf->GetBufferId());
+
+        HgiGLBuffer* drawBuf =
+            static_cast<HgiGLBuffer*>(drawParameterBuffer.Get());
+        HgiGLBuffer* countBuf =
+            static_cast<HgiGLBuffer*>(drawCountBuffer.Get());
+
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, drawBuf->GetBufferId());
+        glBindBuffer(GL_PARAMETER_BUFFER, countBuf->GetBufferId());
+
+        if (primitiveType == HgiPrimitiveTypePatchList) {
+            glPatchParameteri(GL_PATCH_VERTICES, primitiveIndexSize);
+        }
+
+        glMultiDrawElementsIndirectCount(
+            HgiGLConversions::GetPrimitiveType(primitiveType),
+            GL_UNSIGNED_INT,
+            reinterpret_cast<const void*>(
+                static_cast<uintptr_t>(drawBufferByteOffset)),
+            static_cast<GLintptr>(drawCountByteOffset),
+            maxDrawCount,
+            stride);
+
+        HGIGL_POST_PENDING_GL_ERRORS();
+    };
+}
+
 HgiGLOpsFn
 HgiGLOps::Dispatch(int dimX, int dimY)
 {
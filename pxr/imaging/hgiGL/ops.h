@@ -137,6 +137,17 @@ public:
         uint32_t drawCount,
         uint32_t stride);
 
+    HGIGL_API
+    static HgiGLOpsFn DrawIndirectCount(
+        HgiPrimitiveType primitiveType,
+        uint32_t primitiveIndexSize,
+        HgiBufferHandle const& drawParameterBuffer,
+        uint32_t drawBufferByteOffset,
+        HgiBufferHandle const& drawCountBuffer,
+        uint32_t drawCountByteOffset,
+        uint32_t maxDrawCount,
+        uint32_t stride);
+
     HGIGL_API
     static HgiGLOpsFn DrawIndexed(
         HgiPrimitiveType primitiveType,
@@ -158,6 +169,18 @@ public:
         uint32_t drawCount,
         uint32_t stride);
 
+    HGIGL_API
+    static HgiGLOpsFn DrawIndexedIndirectCount(
+        HgiPrimitiveType primitiveType,
+        uint32_t primitiveIndexSize,
+        HgiBufferHandle const& indexBuffer,
+        HgiBufferHandle const& drawParameterBuffer,
+        uint32_t drawBufferByteOffset,
+        HgiBufferHandle const& drawCountBuffer,
+        uint32_t drawCountByteOffset,
+        uint32_t maxDrawCount,
+        uint32_t stride);
+
     HGIGL_API
     static HgiGLOpsFn BindFramebufferOp(
         HgiGLDevice* device,
@@ -10,10 +10,148 @@
 #include "pxr/imaging/hgiGL/shaderProgram.h"
 #include "pxr/imaging/hgiGL/shaderFunction.h"
 
+#include "pxr/base/arch/hash.h"
 #include "pxr/base/tf/diagnostic.h"
+#include "pxr/base/tf/envSetting.h"
+#include "pxr/base/tf/fileUtils.h"
+#include "pxr/base/tf/stringUtils.h"
+
+#include <cstdio>
+#include <fstream>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+TF_DEFINE_ENV_SETTING(HGIGL_PROGRAM_BINARY_CACHE_PATH, "",
+    "Directory used to cache linked GL program binaries between sessions "
+    "so warm sessions skip shader compilation. Empty disables the cache.");
+
+namespace {
+
+std::string const&
+_GetProgramBinaryCacheDir()
+{
+    static std::string const dir =
+        TfGetEnvSetting(HGIGL_PROGRAM_BINARY_CACHE_PATH);
+    return dir;
+}
+
+// Hashes the attached shader sources together with the driver identity,
+// since program binaries are only valid for the driver that produced them.
+uint64_t
+_ComputeProgramHash(HgiShaderFunctionHandleVector const& shaderFunctions)
+{
+    uint64_t hash = 0;
+    for (GLenum name : { GL_VENDOR, GL_RENDERER, GL_VERSION }) {
+        if (const char* str =
+                reinterpret_cast<const char*>(glGetString(name))) {
+            hash = ArchHash64(str, strlen(str), hash);
+        }
+    }
+    std::vector<char> source;
+    for (HgiShaderFunctionHandle const& shd : shaderFunctions) {
+        HgiGLShaderFunction* glShader =
+            static_cast<HgiGLShaderFunction*>(shd.Get());
+        GLint sourceLength = 0;
+        glGetShaderiv(
+            glShader->GetShaderId(), GL_SHADER_SOURCE_LENGTH, &sourceLength);
+        if (sourceLength <= 0) {
+            continue;
+        }
+        source.resize(sourceLength);
+        GLsizei writtenLength = 0;
+        glGetShaderSource(
+            glShader->GetShaderId(), sourceLength,
+            &writtenLength, source.data());
+        hash = ArchHash64(source.data(), writtenLength, hash);
+    }
+    return hash;
+}
+
+std::string
+_GetProgramBinaryFilePath(std::string const& cacheDir, uint64_t hash)
+{
+    return TfStringPrintf(
+        "%s/%016llx.glbin",
+        cacheDir.c_str(), (unsigned long long)hash);
+}
+
+// Attempts to initialize the program from a cached binary; returns false
+// on any mismatch (missing file, stale driver format, etc.) so the caller
+// falls back to a regular link.
+bool
+_LoadProgramBinary(uint32_t programId, std::string const& filePath)
+{
+    std::ifstream in(filePath, std::ios::binary);
+    if (!in) {
+        return false;
+    }
+    uint32_t format = 0;
+    uint64_t byteSize = 0;
+    in.read(reinterpret_cast<char*>(&format), sizeof(format));
+    in.read(reinterpret_cast<char*>(&byteSize), sizeof(byteSize));
+    if (!in || byteSize == 0) {
+        return false;
+    }
+    std::vector<char> binary(byteSize);
+    in.read(binary.data(), byteSize);
+    if (!in) {
+        return false;
+    }
+    glProgramBinary(programId, format, binary.data(), byteSize);
+    GLint status = 0;
+    glGetProgramiv(programId, GL_LINK_STATUS, &status);
+    return status == GL_TRUE;
+}
+
+void
+_SaveProgramBinary(uint32_t programId, std::string const& filePath)
+{
+    GLint byteSize = 0;
+    glGetProgramiv(programId, GL_PROGRAM_BINARY_LENGTH, &byteSize);
+    if (byteSize <= 0) {
+        return;
+    }
+    std::vector<char> binary(byteSize);
+    GLenum format = 0;
+    GLsizei writtenSize = 0;
+    glGetProgramBinary(
+        programId, byteSize, &writtenSize, &format, binary.data());
+    if (writtenSize <= 0) {
+        return;
+    }
+
+    if (!TfMakeDirs(TfGetPathName(filePath), -1, /*existOk=*/true)) {
+        return;
+    }
+
+    // Write to a temporary file and rename so concurrent processes never
+    // observe a partially written cache entry.
+    const std::string tmpFilePath = filePath + ".tmp";
+    {
+        std::ofstream out(tmpFilePath, std::ios::binary);
+        if (!out) {
+            return;
+        }
+        const uint32_t formatValue = format;
+        const uint64_t byteSizeValue = writtenSize;
+        out.write(reinterpret_cast<const char*>(&formatValue),
+                  sizeof(formatValue));
+        out.write(reinterpret_cast<const char*>(&byteSizeValue),
+                  sizeof(byteSizeValue));
+        out.write(binary.data(), writtenSize);
+        if (!out) {
+            out.close();
+            std::remove(tmpFilePath.c_str());
+            return;
+        }
+    }
+    if (std::rename(tmpFilePath.c_str(), filePath.c_str()) != 0) {
+        std::remove(tmpFilePath.c_str());
+    }
+}
+
+} // anonymous namespace
+
 
 HgiGLShaderProgram::HgiGLShaderProgram(HgiShaderProgramDesc const& desc)
     : HgiShaderProgram(desc)
@@ -28,14 +166,32 @@ HgiGLShaderProgram::HgiGLShaderProgram(HgiShaderProgramDesc const& desc)
         HgiGLObjectLabel(GL_PROGRAM, _programId, _descriptor.debugName);
     }
 
-    for (HgiShaderFunctionHandle const& shd : desc.shaderFunctions) {
-        HgiGLShaderFunction* glShader = 
-            static_cast<HgiGLShaderFunction*>(shd.Get());
-        uint32_t id = glShader->GetShaderId();
-        TF_VERIFY(id>0, "Invalid shader provided to program");
-        glAttachShader(_programId, id);
+    // If a program binary cache directory is configured, try to initialize
+    // the program from a previously linked binary before paying for a
+    // compile and link.
+    std::string binaryFilePath;
+    bool loadedFromBinary = false;
+    std::string const& cacheDir = _GetProgramBinaryCacheDir();
+    if (!cacheDir.empty()) {
+        binaryFilePath = _GetProgramBinaryFilePath(
+            cacheDir, _ComputeProgramHash(desc.shaderFunctions));
+        loadedFromBinary = _LoadProgramBinary(_programId, binaryFilePath);
+    }
+
+    if (!loadedFromBinary) {
+        for (HgiShaderFunctionHandle const& shd : desc.shaderFunctions) {
+            HgiGLShaderFunction* glShader =
+                static_cast<HgiGLShaderFunction*>(shd.Get());
+            uint32_t id = glShader->GetShaderId();
+            TF_VERIFY(id>0, "Invalid shader provided to program");
+            glAttachShader(_programId, id);
+        }
+        if (!binaryFilePath.empty()) {
+            glProgramParameteri(
+                _programId, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+        }
+        glLinkProgram(_programId);
     }
-    glLinkProgram(_programId);
 
     // Grab compile errors
     GLint status;
@@ -51,6 +207,10 @@ HgiGLShaderProgram::HgiGLShaderProgram(HgiShaderProgramDesc const& desc)
         GLint size;
         glGetProgramiv(_programId, GL_PROGRAM_BINARY_LENGTH, &size);
         _programByteSize = (size_t)size;
+
+        if (!loadedFromBinary && !binaryFilePath.empty()) {
+            _SaveProgramBinary(_programId, binaryFilePath);
+        }
     }
 
     glCreateBuffers(1, &_uniformBuffer);
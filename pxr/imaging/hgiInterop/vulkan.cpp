@@ -9,11 +9,22 @@
 #include "pxr/pxr.h"
 #include "pxr/imaging/hgi/blitCmdsOps.h"
 #include "pxr/imaging/hgiVulkan/hgi.h"
+#include "pxr/imaging/hgiVulkan/commandBuffer.h"
+#include "pxr/imaging/hgiVulkan/commandQueue.h"
+#include "pxr/imaging/hgiVulkan/conversions.h"
+#include "pxr/imaging/hgiVulkan/device.h"
+#include "pxr/imaging/hgiVulkan/texture.h"
 #include "pxr/imaging/hgiInterop/vulkan.h"
+#include "pxr/base/tf/envSetting.h"
 #include "pxr/base/vt/value.h"
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+TF_DEFINE_ENV_SETTING(HGIINTEROP_VULKAN_ZERO_COPY, true,
+    "Share Vulkan textures with OpenGL through external memory objects "
+    "instead of copying through CPU-visible staging memory, when the "
+    "device and GL driver support it.");
+
 static const char* _vertexFullscreen =
     "#version 120\n"
     "attribute vec4 position;\n"
@@ -87,6 +98,350 @@ _CreateVertexBuffer()
     return vertexBuffer;
 }
 
+static bool
+_GetGLInternalFormat(HgiFormat format, GLenum* glInternalFormat)
+{
+    switch (format) {
+        case HgiFormatFloat32Vec4: *glInternalFormat = GL_RGBA32F; return true;
+        case HgiFormatFloat16Vec4: *glInternalFormat = GL_RGBA16F; return true;
+        case HgiFormatUNorm8Vec4:  *glInternalFormat = GL_RGBA8;   return true;
+        case HgiFormatFloat32:     *glInternalFormat = GL_R32F;    return true;
+        default: return false;
+    }
+}
+
+/// \class HgiInteropVulkanSharedTexture
+///
+/// Owns a Vulkan image whose memory is exported through an opaque native
+/// handle and imported into GL as a memory object, so both APIs address the
+/// same GPU allocation and presentation needs no CPU round trip.
+///
+class HgiInteropVulkanSharedTexture final
+{
+public:
+    HgiInteropVulkanSharedTexture(
+        HgiVulkan* hgiVulkan,
+        HgiTextureDesc const& desc);
+
+    ~HgiInteropVulkanSharedTexture();
+
+    /// Returns false if creation of the shared allocation failed.
+    bool IsValid() const { return _glTexture != 0; }
+
+    /// Returns the GL texture aliasing the Vulkan image's memory.
+    uint32_t GetGLTexture() const { return _glTexture; }
+
+    GfVec3i const& GetDimensions() const { return _dimensions; }
+    HgiFormat GetFormat() const { return _format; }
+
+    /// Record and submit a GPU-GPU copy of \p srcTexture into the shared
+    /// image.
+    void CopyFrom(HgiVulkanTexture* srcTexture);
+
+private:
+    HgiInteropVulkanSharedTexture() = delete;
+    HgiInteropVulkanSharedTexture & operator=(
+        const HgiInteropVulkanSharedTexture&) = delete;
+    HgiInteropVulkanSharedTexture(
+        const HgiInteropVulkanSharedTexture&) = delete;
+
+    void _Destroy();
+
+    HgiVulkan* _hgiVulkan;
+    GfVec3i _dimensions;
+    HgiFormat _format;
+    VkImage _vkImage;
+    VkDeviceMemory _vkMemory;
+    uint32_t _glMemoryObject;
+    uint32_t _glTexture;
+};
+
+HgiInteropVulkanSharedTexture::HgiInteropVulkanSharedTexture(
+    HgiVulkan* hgiVulkan,
+    HgiTextureDesc const& desc)
+    : _hgiVulkan(hgiVulkan)
+    , _dimensions(desc.dimensions)
+    , _format(desc.format)
+    , _vkImage(nullptr)
+    , _vkMemory(nullptr)
+    , _glMemoryObject(0)
+    , _glTexture(0)
+{
+    GLenum glInternalFormat = 0;
+    if (!_GetGLInternalFormat(desc.format, &glInternalFormat)) {
+        TF_WARN("Unsupported texture format for Vulkan-GL interop");
+        return;
+    }
+
+    HgiVulkanDevice* device = hgiVulkan->GetPrimaryDevice();
+    VkDevice vkDevice = device->GetVulkanDevice();
+
+    const VkExternalMemoryHandleTypeFlagBits handleType =
+        #if defined(ARCH_OS_WINDOWS)
+            VK_EXTERNAL_MEMORY_HANDLE_TYPE_OPAQUE_WIN32_BIT;
+        #else
+            VK_EXTERNAL_MEMORY_HANDLE_TYPE_OPAQUE_FD_BIT;
+        #endif
+
+    // Create the image with export of its memory enabled.
+    VkExternalMemoryImageCreateInfo extImageInfo = {};
+    extImageInfo.sType = VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO;
+    extImageInfo.handleTypes = handleType;
+
+    VkImageCreateInfo imageInfo = {};
+    imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+    imageInfo.pNext = &extImageInfo;
+    imageInfo.imageType = VK_IMAGE_TYPE_2D;
+    imageInfo.format = HgiVulkanConversions::GetFormat(desc.format);
+    imageInfo.extent.width = desc.dimensions[0];
+    imageInfo.extent.height = desc.dimensions[1];
+    imageInfo.extent.depth = 1;
+    imageInfo.mipLevels = 1;
+    imageInfo.arrayLayers = 1;
+    imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+    imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+    imageInfo.usage = VK_IMAGE_USAGE_TRANSFER_DST_BIT |
+                      VK_IMAGE_USAGE_SAMPLED_BIT;
+    imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+    if (vkCreateImage(vkDevice, &imageInfo, HgiVulkanAllocator(),
+                      &_vkImage) != VK_SUCCESS) {
+        TF_WARN("Failed to create shared image for Vulkan-GL interop");
+        return;
+    }
+
+    VkMemoryRequirements memReqs = {};
+    vkGetImageMemoryRequirements(vkDevice, _vkImage, &memReqs);
+
+    // Exported allocations are dedicated to the image; find a device-local
+    // memory type for it.
+    VkPhysicalDeviceMemoryProperties memProps = {};
+    vkGetPhysicalDeviceMemoryProperties(
+        device->GetVulkanPhysicalDevice(), &memProps);
+
+    uint32_t memoryTypeIndex = VK_MAX_MEMORY_TYPES;
+    for (uint32_t i = 0; i < memProps.memoryTypeCount; i++) {
+        if ((memReqs.memoryTypeBits & (1u << i)) &&
+            (memProps.memoryTypes[i].propertyFlags &
+                 VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT)) {
+            memoryTypeIndex = i;
+            break;
+        }
+    }
+    if (memoryTypeIndex == VK_MAX_MEMORY_TYPES) {
+        TF_WARN("No device-local memory type for Vulkan-GL interop");
+        _Destroy();
+        return;
+    }
+
+    VkMemoryDedicatedAllocateInfo dedicatedInfo = {};
+    dedicatedInfo.sType = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO;
+    dedicatedInfo.image = _vkImage;
+
+    VkExportMemoryAllocateInfo exportInfo = {};
+    exportInfo.sType = VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO;
+    exportInfo.pNext = &dedicatedInfo;
+    exportInfo.handleTypes = handleType;
+
+    VkMemoryAllocateInfo allocInfo = {};
+    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    allocInfo.pNext = &exportInfo;
+    allocInfo.allocationSize = memReqs.size;
+    allocInfo.memoryTypeIndex = memoryTypeIndex;
+
+    if (vkAllocateMemory(vkDevice, &allocInfo, HgiVulkanAllocator(),
+                         &_vkMemory) != VK_SUCCESS ||
+        vkBindImageMemory(vkDevice, _vkImage, _vkMemory, 0) != VK_SUCCESS) {
+        TF_WARN("Failed to allocate shared memory for Vulkan-GL interop");
+        _Destroy();
+        return;
+    }
+
+    // Export the memory handle and import it into GL. GL takes ownership of
+    // the handle.
+    glCreateMemoryObjectsEXT(1, &_glMemoryObject);
+    static const GLint dedicated = GL_TRUE;
+    glMemoryObjectParameterivEXT(
+        _glMemoryObject, GL_DEDICATED_MEMORY_OBJECT_EXT, &dedicated);
+
+    #if defined(ARCH_OS_WINDOWS)
+        HANDLE handle = nullptr;
+        VkMemoryGetWin32HandleInfoKHR handleInfo = {};
+        handleInfo.sType = VK_STRUCTURE_TYPE_MEMORY_GET_WIN32_HANDLE_INFO_KHR;
+        handleInfo.memory = _vkMemory;
+        handleInfo.handleType = handleType;
+        if (!device->vkGetMemoryWin32HandleKHR ||
+            device->vkGetMemoryWin32HandleKHR(
+                vkDevice, &handleInfo, &handle) != VK_SUCCESS) {
+            TF_WARN("Failed to export memory handle for Vulkan-GL interop");
+            _Destroy();
+            return;
+        }
+        glImportMemoryWin32HandleEXT(
+            _glMemoryObject, memReqs.size,
+            GL_HANDLE_TYPE_OPAQUE_WIN32_EXT, handle);
+    #else
+        int fd = -1;
+        VkMemoryGetFdInfoKHR fdInfo = {};
+        fdInfo.sType = VK_STRUCTURE_TYPE_MEMORY_GET_FD_INFO_KHR;
+        fdInfo.memory = _vkMemory;
+        fdInfo.handleType = handleType;
+        if (!device->vkGetMemoryFdKHR ||
+            device->vkGetMemoryFdKHR(vkDevice, &fdInfo, &fd) != VK_SUCCESS) {
+            TF_WARN("Failed to export memory fd for Vulkan-GL interop");
+            _Destroy();
+            return;
+        }
+        glImportMemoryFdEXT(
+            _glMemoryObject, memReqs.size, GL_HANDLE_TYPE_OPAQUE_FD_EXT, fd);
+    #endif
+
+    glGenTextures(1, &_glTexture);
+    glBindTexture(GL_TEXTURE_2D, _glTexture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_TILING_EXT, GL_OPTIMAL_TILING_EXT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexStorageMem2DEXT(
+        GL_TEXTURE_2D, 1, glInternalFormat,
+        desc.dimensions[0], desc.dimensions[1], _glMemoryObject, 0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    if (glGetError() != GL_NO_ERROR) {
+        TF_WARN("Failed to import shared memory into GL for Vulkan-GL "
+                "interop");
+        _Destroy();
+    }
+}
+
+HgiInteropVulkanSharedTexture::~HgiInteropVulkanSharedTexture()
+{
+    _Destroy();
+}
+
+void
+HgiInteropVulkanSharedTexture::_Destroy()
+{
+    if (_glTexture) {
+        glDeleteTextures(1, &_glTexture);
+        _glTexture = 0;
+    }
+    if (_glMemoryObject) {
+        glDeleteMemoryObjectsEXT(1, &_glMemoryObject);
+        _glMemoryObject = 0;
+    }
+
+    // The copies into the image are always submitted with a CPU wait, so the
+    // device no longer references it. GL keeps the underlying allocation
+    // alive via its imported handle until its own objects are deleted.
+    HgiVulkanDevice* device = _hgiVulkan->GetPrimaryDevice();
+    VkDevice vkDevice = device->GetVulkanDevice();
+    if (_vkImage) {
+        vkDestroyImage(vkDevice, _vkImage, HgiVulkanAllocator());
+        _vkImage = nullptr;
+    }
+    if (_vkMemory) {
+        vkFreeMemory(vkDevice, _vkMemory, HgiVulkanAllocator());
+        _vkMemory = nullptr;
+    }
+}
+
+void
+HgiInteropVulkanSharedTexture::CopyFrom(HgiVulkanTexture* srcTexture)
+{
+    HgiVulkanDevice* device = _hgiVulkan->GetPrimaryDevice();
+    HgiVulkanCommandQueue* queue = device->GetCommandQueue();
+    HgiVulkanCommandBuffer* cb = queue->AcquireCommandBuffer();
+    VkCommandBuffer vkCb = cb->GetVulkanCommandBuffer();
+
+    // Transition source to TRANSFER_READ.
+    const VkImageLayout oldLayout = srcTexture->GetImageLayout();
+    HgiVulkanTexture::TransitionImageBarrier(
+        cb,
+        srcTexture,
+        oldLayout,
+        VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, // transition tex to this layout
+        HgiVulkanTexture::NO_PENDING_WRITES,  // no pending writes
+        VK_ACCESS_TRANSFER_READ_BIT,          // type of access
+        VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,    // producer stage
+        VK_PIPELINE_STAGE_TRANSFER_BIT);      // consumer stage
+
+    // Transition the shared image to TRANSFER_WRITE. The previous frame's
+    // contents are discarded; GL has finished sampling them since each copy
+    // below is submitted with a CPU wait before the GL draw consumes it.
+    VkImageMemoryBarrier barrier[1] = {};
+    barrier[0].sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    barrier[0].srcAccessMask = 0;
+    barrier[0].dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier[0].oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    barrier[0].newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    barrier[0].srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier[0].dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier[0].image = _vkImage;
+    barrier[0].subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    barrier[0].subresourceRange.levelCount = 1;
+    barrier[0].subresourceRange.layerCount = 1;
+
+    vkCmdPipelineBarrier(
+        vkCb,
+        VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+        VK_PIPELINE_STAGE_TRANSFER_BIT,
+        0, 0, nullptr, 0, nullptr,
+        1, barrier);
+
+    // Copy the source into the shared image, entirely on the GPU.
+    VkImageCopy region = {};
+    region.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    region.srcSubresource.layerCount = 1;
+    region.dstSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    region.dstSubresource.layerCount = 1;
+    region.extent.width = _dimensions[0];
+    region.extent.height = _dimensions[1];
+    region.extent.depth = 1;
+
+    vkCmdCopyImage(
+        vkCb,
+        srcTexture->GetImage(),
+        VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+        _vkImage,
+        VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+        1, &region);
+
+    // Transition the shared image to the layout GL samples it in.
+    barrier[0].srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier[0].dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+    barrier[0].oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    barrier[0].newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+
+    vkCmdPipelineBarrier(
+        vkCb,
+        VK_PIPELINE_STAGE_TRANSFER_BIT,
+        VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+        0, 0, nullptr, 0, nullptr,
+        1, barrier);
+
+    // Transition source back to what it was.
+    VkAccessFlags access = HgiVulkanTexture::GetDefaultAccessFlags(
+        srcTexture->GetDescriptor().usage);
+
+    HgiVulkanTexture::TransitionImageBarrier(
+        cb,
+        srcTexture,
+        VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+        oldLayout,                           // transition tex to this layout
+        HgiVulkanTexture::NO_PENDING_WRITES, // no pending writes
+        access,                              // type of access
+        VK_PIPELINE_STAGE_TRANSFER_BIT,      // producer stage
+        VK_PIPELINE_STAGE_ALL_GRAPHICS_BIT); // consumer stage
+
+    // GL samples the shared image without a semaphore handoff, so wait for
+    // the copy to complete before the GL draw consumes it. The texels never
+    // leave the GPU.
+    queue->SubmitToQueue(cb, HgiSubmitWaitTypeWaitUntilCompleted);
+}
+
 static void
 _ConvertVulkanTextureToOpenGL(
     HgiVulkan* hgiVulkan,
@@ -155,6 +510,7 @@ HgiInteropVulkan::HgiInteropVulkan(Hgi* hgiVulkan)
     , _prgNoDepth(0)
     , _prgDepth(0)
     , _vertexBuffer(0)
+    , _zeroCopyFailed(false)
     , _glColorTex(0)
     , _glDepthTex(0)
 {
@@ -185,6 +541,58 @@ HgiInteropVulkan::~HgiInteropVulkan()
     TF_VERIFY(glGetError() == GL_NO_ERROR);
 }
 
+bool
+HgiInteropVulkan::SupportsZeroCopyPresentation() const
+{
+    if (_zeroCopyFailed || !TfGetEnvSetting(HGIINTEROP_VULKAN_ZERO_COPY)) {
+        return false;
+    }
+
+    HgiVulkanDevice* device = _hgiVulkan->GetPrimaryDevice();
+    if (!device || !device->SupportsExternalMemoryExport()) {
+        return false;
+    }
+
+    #if defined(ARCH_OS_WINDOWS)
+        return GARCH_GLAPI_HAS(EXT_memory_object) &&
+               GARCH_GLAPI_HAS(EXT_memory_object_win32);
+    #else
+        return GARCH_GLAPI_HAS(EXT_memory_object) &&
+               GARCH_GLAPI_HAS(EXT_memory_object_fd);
+    #endif
+}
+
+uint32_t
+HgiInteropVulkan::_UpdateSharedTexture(
+    HgiTextureHandle const &src,
+    std::unique_ptr<HgiInteropVulkanSharedTexture> *shared)
+{
+    HgiVulkanTexture* srcTexture = static_cast<HgiVulkanTexture*>(src.Get());
+    if (!srcTexture || !srcTexture->GetImage()) {
+        return 0;
+    }
+
+    HgiTextureDesc const& texDesc = srcTexture->GetDescriptor();
+
+    if (*shared &&
+        ((*shared)->GetDimensions() != texDesc.dimensions ||
+         (*shared)->GetFormat() != texDesc.format)) {
+        shared->reset();
+    }
+
+    if (!*shared) {
+        *shared = std::make_unique<HgiInteropVulkanSharedTexture>(
+            _hgiVulkan, texDesc);
+        if (!(*shared)->IsValid()) {
+            shared->reset();
+            return 0;
+        }
+    }
+
+    (*shared)->CopyFrom(srcTexture);
+    return (*shared)->GetGLTexture();
+}
+
 void
 HgiInteropVulkan::CompositeToInterop(
     HgiTextureHandle const &color,
@@ -216,14 +624,41 @@ HgiInteropVulkan::CompositeToInterop(
         }
     }
 
-    // Convert textures from Vulkan to GL
-    _ConvertVulkanTextureToOpenGL(_hgiVulkan, color, &_glColorTex);
+    // Share or convert textures from Vulkan to GL. When the device and GL
+    // driver support external memory objects, the textures are copied
+    // GPU-to-GPU into shared allocations that GL samples directly;
+    // otherwise fall back to a CPU round trip.
+    uint32_t glColorTex = 0;
+    uint32_t glDepthTex = 0;
+
+    if (SupportsZeroCopyPresentation()) {
+        glColorTex = _UpdateSharedTexture(color, &_sharedColor);
+        if (depth) {
+            glDepthTex = _UpdateSharedTexture(depth, &_sharedDepth);
+        }
+        if (!glColorTex || (depth && !glDepthTex)) {
+            // Creating a shared allocation failed; fall back to the CPU
+            // path and don't retry every frame.
+            _zeroCopyFailed = true;
+            _sharedColor.reset();
+            _sharedDepth.reset();
+            glColorTex = 0;
+            glDepthTex = 0;
+        }
+    }
+
+    if (!glColorTex) {
+        _ConvertVulkanTextureToOpenGL(_hgiVulkan, color, &_glColorTex);
+
+        if (depth) {
+            _ConvertVulkanTextureToOpenGL(_hgiVulkan, depth, &_glDepthTex);
+        }
 
-    if (depth) {
-        _ConvertVulkanTextureToOpenGL(_hgiVulkan, depth, &_glDepthTex);
+        glColorTex = _glColorTex;
+        glDepthTex = depth ? _glDepthTex : 0;
     }
 
-    if (!ARCH_UNLIKELY(_glColorTex)) {
+    if (!ARCH_UNLIKELY(glColorTex)) {
         TF_CODING_ERROR("A valid color texture handle is required.\n");
         return;
     }
@@ -243,15 +678,15 @@ HgiInteropVulkan::CompositeToInterop(
 
     {
         glActiveTexture(GL_TEXTURE0);
-        glBindTexture(GL_TEXTURE_2D, _glColorTex);
+        glBindTexture(GL_TEXTURE_2D, glColorTex);
         const GLint loc = glGetUniformLocation(prg, "colorIn");
         glUniform1i(loc, 0);
     }
 
     // Depth is optional
-    if (_glDepthTex) {
+    if (glDepthTex) {
         glActiveTexture(GL_TEXTURE1);
-        glBindTexture(GL_TEXTURE_2D, _glDepthTex);
+        glBindTexture(GL_TEXTURE_2D, glDepthTex);
         const GLint loc = glGetUniformLocation(prg, "depthIn");
         glUniform1i(loc, 1);
     }
@@ -279,7 +714,7 @@ HgiInteropVulkan::CompositeToInterop(
     glGetBooleanv(GL_DEPTH_WRITEMASK, &restoreDepthMask);
     GLint restoreDepthFunc;
     glGetIntegerv(GL_DEPTH_FUNC, &restoreDepthFunc);
-    if (_glDepthTex) {
+    if (glDepthTex) {
         glEnable(GL_DEPTH_TEST);
         glDepthMask(GL_TRUE);
         // Note: Use LEQUAL and not LESS to ensure that fragments with only
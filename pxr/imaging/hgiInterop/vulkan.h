@@ -12,10 +12,12 @@
 #include "pxr/imaging/hgi/texture.h"
 #include "pxr/imaging/hgiInterop/api.h"
 
+#include <memory>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
 class HgiVulkan;
+class HgiInteropVulkanSharedTexture;
 class VtValue;
 
 /// \class HgiInteropVulkan
@@ -40,9 +42,25 @@ public:
         VtValue const &framebuffer,
         GfVec4i const& viewport);
 
+    /// Returns true if the Vulkan textures are shared with the GL
+    /// application directly on the GPU (via VK_KHR_external_memory and
+    /// GL_EXT_memory_object) rather than copied through CPU-visible
+    /// staging memory. Negotiated automatically from the device and GL
+    /// driver capabilities; can be disabled by setting the env var
+    /// HGIINTEROP_VULKAN_ZERO_COPY to false.
+    HGIINTEROP_API
+    bool SupportsZeroCopyPresentation() const;
+
 private:
     HgiInteropVulkan() = delete;
 
+    // Ensure the shared texture matches the source texture's size and
+    // format, then copy the source into it GPU-to-GPU. Returns the GL
+    // texture name to composite from, or 0 on failure.
+    uint32_t _UpdateSharedTexture(
+        HgiTextureHandle const &src,
+        std::unique_ptr<HgiInteropVulkanSharedTexture> *shared);
+
     HgiVulkan* _hgiVulkan;
     uint32_t _vs;
     uint32_t _fsNoDepth;
@@ -51,8 +69,14 @@ private:
     uint32_t _prgDepth;
     uint32_t _vertexBuffer;
 
-    // XXX We tmp copy Vulkan's GPU texture to CPU and then to GL texture
-    // Once we share GPU memory between Vulkan and GL we can remove this.
+    // GPU-GPU sharing via external memory; used when
+    // SupportsZeroCopyPresentation() is true.
+    std::unique_ptr<HgiInteropVulkanSharedTexture> _sharedColor;
+    std::unique_ptr<HgiInteropVulkanSharedTexture> _sharedDepth;
+    bool _zeroCopyFailed;
+
+    // Fallback: copy Vulkan's GPU texture to CPU and then to a GL texture.
+    // Used when the device or GL driver lacks external memory support.
     uint32_t _glColorTex;
     uint32_t _glDepthTex;
 };
@@ -25,6 +25,7 @@ HgiVulkanBuffer::HgiVulkanBuffer(
     : HgiBuffer(desc)
     , _device(device)
     , _vkBuffer(nullptr)
+    , _pendingVkBuffer(nullptr)
     , _vmaAllocation(nullptr)
     , _inflightBits(0)
     , _stagingBuffer(nullptr)
@@ -56,6 +57,10 @@ HgiVulkanBuffer::HgiVulkanBuffer(
         vmaCreateBuffer(vma,&bi,&ai,&_vkBuffer,&_vmaAllocation,0) == VK_SUCCESS
     );
 
+    // Register this buffer on the allocation so that memory defragmentation
+    // can find the owner of movable allocations.
+    vmaSetAllocationUserData(vma, _vmaAllocation, this);
+
     // Debug label
     if (!_descriptor.debugName.empty()) {
         std::string debugLabel = "Buffer " + _descriptor.debugName;
@@ -103,6 +108,7 @@ HgiVulkanBuffer::HgiVulkanBuffer(
     : HgiBuffer(desc)
     , _device(device)
     , _vkBuffer(vkBuffer)
+    , _pendingVkBuffer(nullptr)
     , _vmaAllocation(vmaAllocation)
     , _inflightBits(0)
     , _stagingBuffer(nullptr)
@@ -200,6 +206,76 @@ HgiVulkanBuffer::GetInflightBits()
     return _inflightBits;
 }
 
+bool
+HgiVulkanBuffer::PrepareMoveAllocation(
+    VmaAllocation dstAllocation,
+    HgiVulkanCommandBuffer* cb)
+{
+    if (!TF_VERIFY(!_pendingVkBuffer)) {
+        return false;
+    }
+
+    VmaAllocator vma = _device->GetVulkanMemoryAllocator();
+
+    // Recreate the buffer with the same creation parameters as the
+    // constructor and bind it at the defragmentation destination.
+    VkBufferCreateInfo bi = {VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO};
+    bi.size = _descriptor.byteSize;
+    bi.usage = HgiVulkanConversions::GetBufferUsage(_descriptor.usage);
+    bi.usage |= VK_BUFFER_USAGE_TRANSFER_SRC_BIT |
+                VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    bi.sharingMode = VK_SHARING_MODE_EXCLUSIVE; // gfx queue only
+
+    VkBuffer newBuffer = nullptr;
+    if (vkCreateBuffer(
+            _device->GetVulkanDevice(),
+            &bi,
+            HgiVulkanAllocator(),
+            &newBuffer) != VK_SUCCESS) {
+        return false;
+    }
+
+    if (vmaBindBufferMemory(vma, dstAllocation, newBuffer) != VK_SUCCESS) {
+        vkDestroyBuffer(
+            _device->GetVulkanDevice(), newBuffer, HgiVulkanAllocator());
+        return false;
+    }
+
+    VkBufferCopy copyRegion = {};
+    copyRegion.size = _descriptor.byteSize;
+    vkCmdCopyBuffer(
+        cb->GetVulkanCommandBuffer(), _vkBuffer, newBuffer, 1, &copyRegion);
+
+    _pendingVkBuffer = newBuffer;
+    return true;
+}
+
+void
+HgiVulkanBuffer::FinalizeMoveAllocation()
+{
+    if (!TF_VERIFY(_pendingVkBuffer)) {
+        return;
+    }
+
+    // The memory of the original buffer is retired by
+    // vmaEndDefragmentationPass, which retargets _vmaAllocation to the
+    // destination memory; only the VkBuffer itself is destroyed here.
+    vkDestroyBuffer(
+        _device->GetVulkanDevice(), _vkBuffer, HgiVulkanAllocator());
+
+    _vkBuffer = _pendingVkBuffer;
+    _pendingVkBuffer = nullptr;
+
+    if (!_descriptor.debugName.empty()) {
+        std::string debugLabel = "Buffer " + _descriptor.debugName;
+        HgiVulkanSetDebugName(
+            _device,
+            (uint64_t)_vkBuffer,
+            VK_OBJECT_TYPE_BUFFER,
+            debugLabel.c_str());
+    }
+}
+
 HgiVulkanBuffer*
 HgiVulkanBuffer::CreateStagingBuffer(
     HgiVulkanDevice* device,
@@ -61,6 +61,24 @@ public:
     HGIVULKAN_API
     uint64_t & GetInflightBits();
 
+    /// Creates a replacement VkBuffer bound to the provided defragmentation
+    /// destination allocation and records a copy of the current contents
+    /// into \p cb. FinalizeMoveAllocation must be called once the copy has
+    /// completed on the device. Returns false (leaving the buffer untouched)
+    /// if the replacement could not be created.
+    /// Used by HgiVulkan::DefragmentMemory.
+    HGIVULKAN_API
+    bool PrepareMoveAllocation(
+        VmaAllocation dstAllocation,
+        HgiVulkanCommandBuffer* cb);
+
+    /// Destroys the original VkBuffer and adopts the replacement created by
+    /// PrepareMoveAllocation. The VmaAllocation handle is unchanged; it is
+    /// retargeted to the destination memory by vmaEndDefragmentationPass.
+    /// Used by HgiVulkan::DefragmentMemory.
+    HGIVULKAN_API
+    void FinalizeMoveAllocation();
+
     /// Creates a staging buffer.
     /// The caller is responsible for the lifetime (destruction) of the buffer.
     HGIVULKAN_API
@@ -93,6 +111,7 @@ private:
 
     HgiVulkanDevice* _device;
     VkBuffer _vkBuffer;
+    VkBuffer _pendingVkBuffer;
     VmaAllocation _vmaAllocation;
     uint64_t _inflightBits;
     HgiVulkanBuffer* _stagingBuffer;
@@ -64,6 +64,7 @@ _DestroyCommandPool(
 HgiVulkanCommandQueue::HgiVulkanCommandQueue(HgiVulkanDevice* device)
     : _device(device)
     , _vkGfxQueue(nullptr)
+    , _vkTransferQueue(nullptr)
     , _inflightBits(0)
     , _inflightCounter(0)
     , _threadId(std::this_thread::get_id())
@@ -76,6 +77,20 @@ HgiVulkanCommandQueue::HgiVulkanCommandQueue(HgiVulkanDevice* device)
         device->GetGfxQueueFamilyIndex(),
         firstQueueInFamily,
         &_vkGfxQueue);
+
+    // Acquire a second queue for resource uploads when the device created one.
+    // Submitting uploads on their own queue lets transfers overlap with
+    // rendering work that is in-flight on the graphics queue.
+    if (device->GetGfxQueueCount() > 1) {
+        const uint32_t secondQueueInFamily = 1;
+        vkGetDeviceQueue(
+            device->GetVulkanDevice(),
+            device->GetGfxQueueFamilyIndex(),
+            secondQueueInFamily,
+            &_vkTransferQueue);
+    } else {
+        _vkTransferQueue = _vkGfxQueue;
+    }
 }
 
 HgiVulkanCommandQueue::~HgiVulkanCommandQueue()
@@ -110,8 +125,13 @@ HgiVulkanCommandQueue::SubmitToQueue(
         resourceInfo.signalSemaphoreCount = 1;
         resourceInfo.pSignalSemaphores = &semaphore;
 
+        // Resource uploads go to the transfer queue so they can overlap with
+        // rendering work still in-flight on the graphics queue. The signal
+        // semaphore below makes the work submission wait for the uploads,
+        // which is valid across queues.
         TF_VERIFY(
-            vkQueueSubmit(_vkGfxQueue, 1, &resourceInfo, rFence) == VK_SUCCESS
+            vkQueueSubmit(
+                _vkTransferQueue, 1, &resourceInfo, rFence) == VK_SUCCESS
         );
 
         _resourceCommandBuffer = nullptr;
@@ -219,6 +239,13 @@ HgiVulkanCommandQueue::GetVulkanGraphicsQueue() const
     return _vkGfxQueue;
 }
 
+/* Multi threaded */
+VkQueue
+HgiVulkanCommandQueue::GetVulkanTransferQueue() const
+{
+    return _vkTransferQueue;
+}
+
 /* Single threaded */
 void
 HgiVulkanCommandQueue::ResetConsumedCommandBuffers(HgiSubmitWaitType wait)
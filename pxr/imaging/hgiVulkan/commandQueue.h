@@ -87,6 +87,13 @@ public:
     HGIVULKAN_API
     VkQueue GetVulkanGraphicsQueue() const;
 
+    /// Returns the vulkan transfer queue used for resource command buffer
+    /// submissions. Falls back to the graphics queue when the device exposes
+    /// only one queue in the graphics queue family.
+    /// Thread safety: This call is thread safe.
+    HGIVULKAN_API
+    VkQueue GetVulkanTransferQueue() const;
+
     /// Loop all pools and reset any command buffers that have been consumed.
     /// Thread safety: This call is not thread safe. This function should be
     /// called once from main thread while no other threads are recording.
@@ -115,6 +122,7 @@ private:
 
     HgiVulkanDevice* _device;
     VkQueue _vkGfxQueue;
+    VkQueue _vkTransferQueue;
     CommandPoolPtrMap _commandPools;
     std::mutex _commandPoolsMutex;
 
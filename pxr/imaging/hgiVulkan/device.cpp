@@ -20,7 +20,9 @@ PXR_NAMESPACE_OPEN_SCOPE
 
 
 static uint32_t
-_GetGraphicsQueueFamilyIndex(VkPhysicalDevice physicalDevice)
+_GetGraphicsQueueFamilyIndex(
+    VkPhysicalDevice physicalDevice,
+    uint32_t * familyQueueCount)
 {
     uint32_t queueCount = 0;
     vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &queueCount, 0);
@@ -33,6 +35,7 @@ _GetGraphicsQueueFamilyIndex(VkPhysicalDevice physicalDevice)
 
     for (uint32_t i = 0; i < queueCount; i++) {
         if (queues[i].queueFlags & VK_QUEUE_GRAPHICS_BIT) {
+            *familyQueueCount = queues[i].queueCount;
             return i;
         }
     }
@@ -67,8 +70,11 @@ HgiVulkanDevice::HgiVulkanDevice(HgiVulkanInstance* instance)
     : _vkPhysicalDevice(nullptr)
     , _vkDevice(nullptr)
     , _vmaAllocator(nullptr)
+    , _vkGfxsQueueFamilyQueueCount(1)
+    , _vkGfxQueueCount(1)
     , _commandQueue(nullptr)
     , _capabilities(nullptr)
+    , _supportsExternalMemoryExport(false)
 {
     //
     // Determine physical device
@@ -88,8 +94,10 @@ HgiVulkanDevice::HgiVulkanDevice(HgiVulkanInstance* instance)
         VkPhysicalDeviceProperties props;
         vkGetPhysicalDeviceProperties(physicalDevices[i], &props);
 
+        uint32_t familyQueueCount = 0;
         uint32_t familyIndex =
-            _GetGraphicsQueueFamilyIndex(physicalDevices[i]);
+            _GetGraphicsQueueFamilyIndex(physicalDevices[i],
+                                         &familyQueueCount);
 
         if (familyIndex == VK_QUEUE_FAMILY_IGNORED) continue;
 
@@ -106,10 +114,12 @@ HgiVulkanDevice::HgiVulkanDevice(HgiVulkanInstance* instance)
         if (props.deviceType==VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU) {
             _vkPhysicalDevice = physicalDevices[i];
             _vkGfxsQueueFamilyIndex = familyIndex;
+            _vkGfxsQueueFamilyQueueCount = familyQueueCount;
             break;
         } else if (!_vkPhysicalDevice) {
             _vkPhysicalDevice = physicalDevices[i];
             _vkGfxsQueueFamilyIndex = familyIndex;
+            _vkGfxsQueueFamilyQueueCount = familyQueueCount;
         }
     }
 
@@ -146,11 +156,16 @@ HgiVulkanDevice::HgiVulkanDevice(HgiVulkanInstance* instance)
     //
     _capabilities = new HgiVulkanCapabilities(this);
 
+    // Create a second queue from the graphics queue family when available.
+    // The command queue uses it to submit resource uploads so transfers can
+    // overlap rendering work on the primary queue.
+    _vkGfxQueueCount = _vkGfxsQueueFamilyQueueCount > 1 ? 2 : 1;
+
     VkDeviceQueueCreateInfo queueInfo =
         {VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO};
-    float queuePriorities[] = {1.0f};
+    float queuePriorities[] = {1.0f, 1.0f};
     queueInfo.queueFamilyIndex = _vkGfxsQueueFamilyIndex;
-    queueInfo.queueCount = 1;
+    queueInfo.queueCount = _vkGfxQueueCount;
     queueInfo.pQueuePriorities = queuePriorities;
 
     std::vector<const char*> extensions = {
@@ -174,6 +189,22 @@ HgiVulkanDevice::HgiVulkanDevice(HgiVulkanInstance* instance)
     {
         extensions.push_back(VK_KHR_EXTERNAL_SEMAPHORE_EXTENSION_NAME);
         extensions.push_back(VK_KHR_EXTERNAL_MEMORY_EXTENSION_NAME);
+
+        // Exporting the underlying memory handle additionally requires the
+        // platform specific external memory extension.
+        #if defined(ARCH_OS_WINDOWS)
+            if (IsSupportedExtension(
+                    VK_KHR_EXTERNAL_MEMORY_WIN32_EXTENSION_NAME)) {
+                extensions.push_back(
+                    VK_KHR_EXTERNAL_MEMORY_WIN32_EXTENSION_NAME);
+                _supportsExternalMemoryExport = true;
+            }
+        #else
+            if (IsSupportedExtension(VK_KHR_EXTERNAL_MEMORY_FD_EXTENSION_NAME)) {
+                extensions.push_back(VK_KHR_EXTERNAL_MEMORY_FD_EXTENSION_NAME);
+                _supportsExternalMemoryExport = true;
+            }
+        #endif
     }
 
     // Memory budget query extension
@@ -299,6 +330,15 @@ HgiVulkanDevice::HgiVulkanDevice(HgiVulkanInstance* instance)
     vkCreateRenderPass2KHR = (PFN_vkCreateRenderPass2KHR)
     vkGetDeviceProcAddr(_vkDevice, "vkCreateRenderPass2KHR");
 
+    if (_supportsExternalMemoryExport) {
+        vkGetMemoryFdKHR = (PFN_vkGetMemoryFdKHR)
+        vkGetDeviceProcAddr(_vkDevice, "vkGetMemoryFdKHR");
+        #if defined(ARCH_OS_WINDOWS)
+            vkGetMemoryWin32HandleKHR = (PFN_vkGetMemoryWin32HandleKHR)
+            vkGetDeviceProcAddr(_vkDevice, "vkGetMemoryWin32HandleKHR");
+        #endif
+    }
+
     //
     // Memory allocator
     //
@@ -374,6 +414,12 @@ HgiVulkanDevice::GetGfxQueueFamilyIndex() const
     return _vkGfxsQueueFamilyIndex;
 }
 
+uint32_t
+HgiVulkanDevice::GetGfxQueueCount() const
+{
+    return _vkGfxQueueCount;
+}
+
 VkPhysicalDevice
 HgiVulkanDevice::GetVulkanPhysicalDevice() const
 {
@@ -406,5 +452,11 @@ HgiVulkanDevice::IsSupportedExtension(const char* extensionName) const
     return false;
 }
 
+bool
+HgiVulkanDevice::SupportsExternalMemoryExport() const
+{
+    return _supportsExternalMemoryExport;
+}
+
 
 PXR_NAMESPACE_CLOSE_SCOPE
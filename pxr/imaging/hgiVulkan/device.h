@@ -55,6 +55,10 @@ public:
     HGIVULKAN_API
     uint32_t GetGfxQueueFamilyIndex() const;
 
+    /// Returns the number of queues created in the graphics queue family.
+    HGIVULKAN_API
+    uint32_t GetGfxQueueCount() const;
+
     /// Returns vulkan physical device
     HGIVULKAN_API
     VkPhysicalDevice GetVulkanPhysicalDevice() const;
@@ -72,8 +76,18 @@ public:
     /// Returns true if the provided extension is supported by the device
     bool IsSupportedExtension(const char* extensionName) const;
 
+    /// Returns true if device memory can be exported through an opaque
+    /// native handle (fd or win32 handle) for sharing with another graphics
+    /// API, such as OpenGL via GL_EXT_memory_object.
+    HGIVULKAN_API
+    bool SupportsExternalMemoryExport() const;
+
     /// Device extension function pointers
     PFN_vkCreateRenderPass2KHR vkCreateRenderPass2KHR = 0;
+    PFN_vkGetMemoryFdKHR vkGetMemoryFdKHR = 0;
+#if defined(ARCH_OS_WINDOWS)
+    PFN_vkGetMemoryWin32HandleKHR vkGetMemoryWin32HandleKHR = 0;
+#endif
     PFN_vkCmdBeginDebugUtilsLabelEXT vkCmdBeginDebugUtilsLabelEXT = 0;
     PFN_vkCmdEndDebugUtilsLabelEXT vkCmdEndDebugUtilsLabelEXT = 0;
     PFN_vkCmdInsertDebugUtilsLabelEXT vkCmdInsertDebugUtilsLabelEXT = 0;
@@ -92,9 +106,12 @@ private:
     std::vector<VkExtensionProperties> _vkExtensions;
     VmaAllocator _vmaAllocator;
     uint32_t _vkGfxsQueueFamilyIndex;
+    uint32_t _vkGfxsQueueFamilyQueueCount;
+    uint32_t _vkGfxQueueCount;
     HgiVulkanCommandQueue* _commandQueue;
     HgiVulkanCapabilities* _capabilities;
     HgiVulkanPipelineCache* _pipelineCache;
+    bool _supportsExternalMemoryExport;
 };
 
 
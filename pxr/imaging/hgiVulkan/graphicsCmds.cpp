@@ -154,12 +154,22 @@ HgiVulkanGraphicsCmds::BindPipeline(HgiGraphicsPipelineHandle pipeline)
 {
     _CreateCommandBuffer();
 
+    if (pipeline == _pipeline) {
+        // Binding the same pipeline again is a no-op. Keep the current
+        // render pass and bound descriptor sets intact.
+        return;
+    }
+
     // End the previous render pass in case we are using the same
     // GfxCmds with multiple pipelines.
     _EndRenderPass();
 
     _pipeline = pipeline;
-    HgiVulkanGraphicsPipeline* pso = 
+
+    // Descriptor sets need to be rebound against the new pipeline layout.
+    _resourceBindings = HgiResourceBindingsHandle();
+
+    HgiVulkanGraphicsPipeline* pso =
         static_cast<HgiVulkanGraphicsPipeline*>(_pipeline.Get());
 
     if (TF_VERIFY(pso)) {
@@ -170,6 +180,13 @@ HgiVulkanGraphicsCmds::BindPipeline(HgiGraphicsPipelineHandle pipeline)
 void
 HgiVulkanGraphicsCmds::BindResources(HgiResourceBindingsHandle res)
 {
+    if (res == _resourceBindings) {
+        // The descriptor sets are still bound from a previous draw batch;
+        // skip the redundant vkCmdBindDescriptorSets.
+        return;
+    }
+    _resourceBindings = res;
+
     // Delay until the pipeline is set and the render pass has begun.
     _pendingUpdates.push_back(
         [this, res] {
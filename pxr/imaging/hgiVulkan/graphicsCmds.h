@@ -130,6 +130,7 @@ private:
     HgiGraphicsCmdsDesc _descriptor;
     HgiVulkanCommandBuffer* _commandBuffer;
     HgiGraphicsPipelineHandle _pipeline;
+    HgiResourceBindingsHandle _resourceBindings;
     bool _renderPassStarted;
     bool _viewportSet;
     bool _scissorSet;
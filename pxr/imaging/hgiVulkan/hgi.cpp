@@ -300,6 +300,73 @@ HgiVulkan::EndFrame()
     }
 }
 
+/* Single threaded */
+void
+HgiVulkan::DefragmentMemory()
+{
+    TRACE_FUNCTION();
+
+    HgiVulkanDevice* device = GetPrimaryDevice();
+    VmaAllocator vma = device->GetVulkanMemoryAllocator();
+
+    // Moving allocations invalidates descriptors that reference them and the
+    // copies below bypass the usual per-frame synchronization, so all
+    // previously submitted GPU work must have completed.
+    device->WaitForIdle();
+
+    VmaDefragmentationInfo info = {};
+    info.flags = VMA_DEFRAGMENTATION_FLAG_ALGORITHM_BALANCED_BIT;
+    // Bound the work performed by a single call so that defragmentation can
+    // be scheduled during idle frames; repeated calls converge.
+    info.maxBytesPerPass = 64 * 1024 * 1024;
+    info.maxAllocationsPerPass = 128;
+
+    VmaDefragmentationContext context = nullptr;
+    if (vmaBeginDefragmentation(vma, &info, &context) != VK_SUCCESS) {
+        return;
+    }
+
+    VmaDefragmentationPassMoveInfo pass = {};
+    if (vmaBeginDefragmentationPass(vma, context, &pass) == VK_INCOMPLETE) {
+        HgiVulkanCommandQueue* queue = device->GetCommandQueue();
+        HgiVulkanCommandBuffer* cb = queue->AcquireCommandBuffer();
+
+        std::vector<HgiVulkanBuffer*> movedBuffers;
+        movedBuffers.reserve(pass.moveCount);
+
+        for (uint32_t i = 0; i < pass.moveCount; ++i) {
+            VmaDefragmentationMove& move = pass.pMoves[i];
+
+            VmaAllocationInfo allocInfo = {};
+            vmaGetAllocationInfo(vma, move.srcAllocation, &allocInfo);
+
+            // Only buffers created through CreateBuffer register themselves
+            // in the allocation's user data; leave all other allocations
+            // (staging buffers, textures) in place.
+            HgiVulkanBuffer* const buffer =
+                static_cast<HgiVulkanBuffer*>(allocInfo.pUserData);
+            if (!buffer ||
+                !buffer->PrepareMoveAllocation(move.dstTmpAllocation, cb)) {
+                move.operation = VMA_DEFRAGMENTATION_MOVE_OPERATION_IGNORE;
+                continue;
+            }
+            movedBuffers.push_back(buffer);
+        }
+
+        // Submit the copies and wait for them to complete before retiring
+        // the source allocations.
+        queue->SubmitToQueue(cb, HgiSubmitWaitTypeWaitUntilCompleted);
+
+        for (HgiVulkanBuffer* buffer : movedBuffers) {
+            buffer->FinalizeMoveAllocation();
+        }
+
+        vmaEndDefragmentationPass(vma, context, &pass);
+    }
+
+    vmaEndDefragmentation(vma, context, nullptr);
+}
+
 /* Multi threaded */
 HgiVulkanInstance*
 HgiVulkan::GetVulkanInstance() const
@@ -5,24 +5,164 @@
 // https://openusd.org/license.
 //
 #include "pxr/base/tf/diagnostic.h"
+#include "pxr/base/tf/envSetting.h"
+#include "pxr/base/tf/errorMark.h"
+#include "pxr/base/tf/safeOutputFile.h"
 
+#include "pxr/imaging/hgiVulkan/capabilities.h"
+#include "pxr/imaging/hgiVulkan/device.h"
 #include "pxr/imaging/hgiVulkan/pipelineCache.h"
 
+#include <cstring>
+#include <fstream>
+#include <vector>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
+TF_DEFINE_ENV_SETTING(HGIVULKAN_PIPELINE_CACHE_PATH, "",
+    "File path used to persist the Vulkan pipeline cache between runs. "
+    "When set, the pipeline cache is seeded from this file at startup and "
+    "written back when the device is destroyed, so pipelines compiled in "
+    "earlier runs do not need to be recompiled on first draw. When empty, "
+    "the pipeline cache is in-memory only.");
+
+namespace {
+
+// Prefix of the pipeline cache data as defined by the Vulkan spec
+// (VkPipelineCacheHeaderVersionOne).  Used to reject cache files written
+// by a different device or driver version before handing the data to
+// vkCreatePipelineCache.
+struct _PipelineCacheHeader
+{
+    uint32_t headerSize;
+    uint32_t headerVersion;
+    uint32_t vendorID;
+    uint32_t deviceID;
+    uint8_t pipelineCacheUUID[VK_UUID_SIZE];
+};
+
+} // anonymous namespace
+
+static bool
+_IsCompatibleCacheData(
+    const std::vector<char> &data,
+    const VkPhysicalDeviceProperties &props)
+{
+    _PipelineCacheHeader header;
+    if (data.size() < sizeof(header)) {
+        return false;
+    }
+    memcpy(&header, data.data(), sizeof(header));
+
+    return header.headerVersion == VK_PIPELINE_CACHE_HEADER_VERSION_ONE &&
+           header.vendorID == props.vendorID &&
+           header.deviceID == props.deviceID &&
+           memcmp(header.pipelineCacheUUID, props.pipelineCacheUUID,
+                  VK_UUID_SIZE) == 0;
+}
+
 HgiVulkanPipelineCache::HgiVulkanPipelineCache(
     HgiVulkanDevice* device)
     : _device(device)
     , _vkPipelineCache(nullptr)
+    , _cacheFilePath(TfGetEnvSetting(HGIVULKAN_PIPELINE_CACHE_PATH))
 {
-    // xxx we need to add a pipeline cache to avoid app having to keep compiling
-    // shader micro-code for every pipeline combination. We except that the
-    // spir-V shader code is not compiled for the target device until this point
-    // where we create the pipeline. So a pipeline cache can be helpful.
+    // Seed the pipeline cache from disk when persistence is enabled, so
+    // pipeline combinations compiled in earlier runs are available
+    // immediately instead of being recompiled on first draw.
+    std::vector<char> initialData;
+    if (!_cacheFilePath.empty()) {
+        std::ifstream file(_cacheFilePath.c_str(),
+                           std::ios::binary | std::ios::ate);
+        if (file) {
+            initialData.resize(file.tellg());
+            file.seekg(0);
+            file.read(initialData.data(), initialData.size());
+            if (!file) {
+                initialData.clear();
+            }
+        }
+
+        if (!initialData.empty() &&
+            !_IsCompatibleCacheData(
+                initialData,
+                _device->GetDeviceCapabilities().vkDeviceProperties)) {
+            // Written by a different device or driver; start fresh.
+            initialData.clear();
+        }
+    }
+
+    VkPipelineCacheCreateInfo createInfo =
+        {VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO};
+    createInfo.initialDataSize = initialData.size();
+    createInfo.pInitialData =
+        initialData.empty() ? nullptr : initialData.data();
+
+    if (vkCreatePipelineCache(
+            _device->GetVulkanDevice(),
+            &createInfo,
+            HgiVulkanAllocator(),
+            &_vkPipelineCache) != VK_SUCCESS && !initialData.empty()) {
+        // The driver rejected the initial data; retry with an empty cache.
+        createInfo.initialDataSize = 0;
+        createInfo.pInitialData = nullptr;
+        TF_VERIFY(
+            vkCreatePipelineCache(
+                _device->GetVulkanDevice(),
+                &createInfo,
+                HgiVulkanAllocator(),
+                &_vkPipelineCache) == VK_SUCCESS
+        );
+    }
 }
 
 HgiVulkanPipelineCache::~HgiVulkanPipelineCache()
 {
+    if (!_vkPipelineCache) {
+        return;
+    }
+
+    if (!_cacheFilePath.empty()) {
+        _Save();
+    }
+
+    vkDestroyPipelineCache(
+        _device->GetVulkanDevice(),
+        _vkPipelineCache,
+        HgiVulkanAllocator());
+}
+
+void
+HgiVulkanPipelineCache::_Save()
+{
+    size_t dataSize = 0;
+    if (vkGetPipelineCacheData(
+            _device->GetVulkanDevice(),
+            _vkPipelineCache,
+            &dataSize,
+            nullptr) != VK_SUCCESS || dataSize == 0) {
+        return;
+    }
+
+    std::vector<char> data(dataSize);
+    if (vkGetPipelineCacheData(
+            _device->GetVulkanDevice(),
+            _vkPipelineCache,
+            &dataSize,
+            data.data()) != VK_SUCCESS) {
+        return;
+    }
+
+    // Write to a temporary file and rename into place so a crash while
+    // writing cannot leave a truncated cache behind.
+    TfErrorMark m;
+    TfSafeOutputFile file = TfSafeOutputFile::Replace(_cacheFilePath);
+    if (!m.IsClean()) {
+        return;
+    }
+
+    fwrite(data.data(), 1, dataSize, file.Get());
+    file.Close();
 }
 
 VkPipelineCache
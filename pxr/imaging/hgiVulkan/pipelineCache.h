@@ -11,6 +11,8 @@
 #include "pxr/imaging/hgiVulkan/api.h"
 #include "pxr/imaging/hgiVulkan/vulkan.h"
 
+#include <string>
+
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -20,6 +22,11 @@ class HgiVulkanDevice;
 ///
 /// Wrapper for Vulkan pipeline cache.
 ///
+/// When the HGIVULKAN_PIPELINE_CACHE_PATH env var is set, the cache is
+/// seeded from that file at startup and written back when the device is
+/// destroyed, so pipelines compiled in earlier runs are served from the
+/// cache instead of being recompiled on first draw.
+///
 class HgiVulkanPipelineCache final
 {
 public:
@@ -38,8 +45,12 @@ private:
     HgiVulkanPipelineCache & operator=(const HgiVulkanPipelineCache&) = delete;
     HgiVulkanPipelineCache(const HgiVulkanPipelineCache&) = delete;
 
+    // Writes the pipeline cache data to the persistence file.
+    void _Save();
+
     HgiVulkanDevice* _device;
     VkPipelineCache _vkPipelineCache;
+    std::string _cacheFilePath;
 };
 
 
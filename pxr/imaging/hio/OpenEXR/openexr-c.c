@@ -852,6 +852,121 @@ exr_result_t nanoexr_read_scanline_exr(exr_context_t exr,
     return rv;
 }
 
+// Decodes the scanline chunks overlapping the band of numRows rows
+// starting at rowStart, counted from the top of the data window, into img,
+// which holds exactly the band.  Chunk boundaries seldom coincide with the
+// requested band, so each chunk is decoded into a chunk-sized scratch
+// buffer and the rows intersecting the band are copied out of it.
+static exr_result_t nanoexr_read_scanline_band_exr(exr_context_t exr,
+                                                   nanoexr_ImageData_t* img,
+                                                   const char* layerName,
+                                                   int partIndex,
+                                                   int* rgbaIndex,
+                                                   int dataWindowMinY,
+                                                   int rowStart,
+                                                   int numRows)
+{
+    exr_decode_pipeline_t decoder = EXR_DECODE_PIPELINE_INITIALIZER;
+    exr_result_t rv = EXR_ERR_SUCCESS;
+    uint8_t* scratch = NULL;
+
+    // use a do/while(false) to allow error handling via a break and
+    // check at the end.
+    do {
+        int scanLinesPerChunk;
+        rv = exr_get_scanlines_per_chunk(exr, partIndex, &scanLinesPerChunk);
+        if (rv != EXR_ERR_SUCCESS)
+            break;
+
+        int bytesPerChannel = nanoexr_getPixelTypeSize(img->pixelType);
+        int pixelbytes = bytesPerChannel * img->channelCount;
+
+        // chunks are aligned to the top of the data window
+        int firstChunkY = dataWindowMinY
+            + (rowStart / scanLinesPerChunk) * scanLinesPerChunk;
+        for (int chunky = firstChunkY;
+             chunky < dataWindowMinY + rowStart + numRows;
+             chunky += scanLinesPerChunk) {
+            exr_chunk_info_t cinfo;
+            rv = exr_read_scanline_chunk_info(exr, partIndex, chunky, &cinfo);
+            if (rv != EXR_ERR_SUCCESS)
+                break;
+
+            if (decoder.channels == NULL) {
+                rv = _nanoexr_rgba_decoding_initialize(exr, img, layerName,
+                                                       partIndex, &cinfo, &decoder, rgbaIndex);
+                if (rv != EXR_ERR_SUCCESS)
+                    break;
+
+                if (decoder.channels == NULL) {
+                    rv = EXR_ERR_INCORRECT_CHUNK;
+                    break;
+                }
+                bytesPerChannel = decoder.channels[0].bytes_per_element;
+                pixelbytes = bytesPerChannel * img->channelCount;
+
+                for (int c = 0; c < decoder.channel_count; ++c) {
+                    decoder.channels[c].user_pixel_stride = pixelbytes;
+                    decoder.channels[c].user_line_stride = pixelbytes * img->width;
+                    decoder.channels[c].user_bytes_per_element = bytesPerChannel;
+                }
+
+                rv = exr_decoding_choose_default_routines(exr, partIndex, &decoder);
+                if (rv != EXR_ERR_SUCCESS)
+                    break;
+
+                scratch = (uint8_t*) malloc(
+                    (size_t) scanLinesPerChunk * img->width * pixelbytes);
+                if (scratch == NULL) {
+                    rv = EXR_ERR_OUT_OF_MEMORY;
+                    break;
+                }
+            }
+            else {
+                // Reuse existing pipeline
+                rv = exr_decoding_update(exr, partIndex, &cinfo, &decoder);
+                if (rv != EXR_ERR_SUCCESS)
+                    break;
+            }
+
+            for (int c = 0; c < decoder.channel_count; ++c) {
+                decoder.channels[c].decode_to_ptr = NULL;
+                for (int i = 0; i < 4; ++i) {
+                    if (rgbaIndex[i] == c) {
+                        decoder.channels[c].decode_to_ptr = scratch + i * bytesPerChannel;
+                        break;
+                    }
+                }
+            }
+
+            rv = exr_decoding_run(exr, partIndex, &decoder);
+            if (rv != EXR_ERR_SUCCESS)
+                break;
+
+            // copy the rows of this chunk that intersect the band
+            int chunkRow0 = chunky - dataWindowMinY;
+            int row0 = chunkRow0 > rowStart ? chunkRow0 : rowStart;
+            int row1 = chunkRow0 + scanLinesPerChunk;
+            if (row1 > rowStart + numRows)
+                row1 = rowStart + numRows;
+            size_t rowbytes = (size_t) img->width * pixelbytes;
+            for (int row = row0; row < row1; ++row) {
+                memcpy(img->data + (size_t) (row - rowStart) * rowbytes,
+                       scratch + (size_t) (row - chunkRow0) * rowbytes,
+                       rowbytes);
+            }
+        }
+    }
+    while (false);
+
+    if (rv != EXR_ERR_SUCCESS)
+        fprintf(stderr, "nanoexr error: %s\n", exr_get_default_error_message(rv));
+
+    free(scratch);
+    nanoexr_cleanup(exr, &decoder);
+    return rv;
+}
+
 void fill_channel_u16(nanoexr_ImageData_t* img, int channel, uint16_t value) {
     for (int y = 0; y < img->height; ++y) {
         for (int x = 0; x < img->width; ++x) {
@@ -929,7 +1044,106 @@ void copy_channel_float(nanoexr_ImageData_t* img, uint8_t* dst_data, uint8_t* sr
     }
 }
 
-exr_result_t nanoexr_read_exr(const char* filename, 
+// if the image has more channels than actually read, and any of the channels
+// is missing, fill them in by propagating the channel to the left if
+// possible. If not, fill with zero or one. Alpha is always filled with one.
+static void _nanoexr_fill_missing_channels(nanoexr_ImageData_t* img,
+                                           const int* rgbaIndex)
+{
+    uint16_t oneValue = float_to_half(1.0f);
+    uint16_t zeroValue = float_to_half(0.0f);
+
+    int readChannelCount = 0;
+    for (int i = 0; i < 4; ++i) {
+        if (rgbaIndex[i] >= 0) {
+            readChannelCount++;
+        }
+    }
+    if (img->channelCount <= readChannelCount) {
+        return;
+    }
+    if (img->channelCount == 4 && rgbaIndex[3] == -1) {
+        // fill the alpha channel with 1.0
+        if (img->pixelType == EXR_PIXEL_HALF) {
+            fill_channel_u16(img, 3, oneValue);
+        }
+        else if (img->pixelType == EXR_PIXEL_FLOAT) {
+            fill_channel_float(img, 3, 1.0f);
+        }
+        else if (img->pixelType == EXR_PIXEL_UINT) {
+            // We're treating uint data as data, not rgba, so fill with zero
+            fill_channel_u32(img, 3, 0);
+        }
+    }
+    if (img->channelCount > 2 && rgbaIndex[2] == -1) {
+        // if G exists, propagate it, else if R exists, propagate it, else fill with zero
+        // note that the data has been de-swizzled already so at this point,
+        // rgbaIndex serves only as a sentinel
+        int srcChannel = rgbaIndex[1] >= 0 ? 1 : (rgbaIndex[0] >= 0 ? 0 : -1);
+        if (srcChannel >= 0) {
+            if (img->pixelType == EXR_PIXEL_HALF) {
+                copy_channel_u16(img, img->data, img->data, 2, srcChannel);
+            }
+            else if (img->pixelType == EXR_PIXEL_FLOAT) {
+                copy_channel_float(img, img->data, img->data, 2, srcChannel);
+            }
+            else if (img->pixelType == EXR_PIXEL_UINT) {
+                copy_channel_u32(img, img->data, img->data, 2, srcChannel);
+            }
+        }
+        else {
+            if (img->pixelType == EXR_PIXEL_HALF) {
+                fill_channel_u16(img, 2, zeroValue);
+            }
+            else if (img->pixelType == EXR_PIXEL_FLOAT) {
+                fill_channel_float(img, 2, 0.0f);
+            }
+            else if (img->pixelType == EXR_PIXEL_UINT) {
+                fill_channel_u32(img, 2, 0);
+            }
+        }
+    }
+    if (img->channelCount > 1 && rgbaIndex[1] == -1) {
+        // if R exists, propagate it, else fill with zero
+        int srcChannel = rgbaIndex[0] >= 0 ? 0 : -1;
+        if (srcChannel >= 0) {
+            if (img->pixelType == EXR_PIXEL_HALF) {
+                copy_channel_u16(img, img->data, img->data, 1, srcChannel);
+            }
+            else if (img->pixelType == EXR_PIXEL_FLOAT) {
+                copy_channel_float(img, img->data, img->data, 1, srcChannel);
+            }
+            else if (img->pixelType == EXR_PIXEL_UINT) {
+                copy_channel_u32(img, img->data, img->data, 1, srcChannel);
+            }
+        }
+        else {
+            if (img->pixelType == EXR_PIXEL_HALF) {
+                fill_channel_u16(img, 1, zeroValue);
+            }
+            else if (img->pixelType == EXR_PIXEL_FLOAT) {
+                fill_channel_float(img, 1, 0.0f);
+            }
+            else if (img->pixelType == EXR_PIXEL_UINT) {
+                fill_channel_u32(img, 1, 0);
+            }
+        }
+    }
+    if (rgbaIndex[0] == -1) {
+        // fill with zero
+        if (img->pixelType == EXR_PIXEL_HALF) {
+            fill_channel_u16(img, 0, zeroValue);
+        }
+        else if (img->pixelType == EXR_PIXEL_FLOAT) {
+            fill_channel_float(img, 0, 0.0f);
+        }
+        else if (img->pixelType == EXR_PIXEL_UINT) {
+            fill_channel_u32(img, 0, 0);
+        }
+    }
+}
+
+exr_result_t nanoexr_read_exr(const char* filename,
                               exr_read_func_ptr_t readfn,
                               void* callback_userData,
                               nanoexr_ImageData_t* img,
@@ -1057,103 +1271,136 @@ exr_result_t nanoexr_read_exr(const char* filename,
         return rv;
     }
 
-    uint16_t oneValue = float_to_half(1.0f);
-    uint16_t zeroValue = float_to_half(0.0f);
-    
-    // if the image has more channels than actually read, and any of the channels 
-    // is missing, fill them in by propagating the channel to the left if 
-    // possible. If not, fill with zero or one. Alpha is always filled with one.
-    int readChannelCount = 0;
-    for (int i = 0; i < 4; ++i) {
-        if (rgbaIndex[i] >= 0) {
-            readChannelCount++;
-        }
+    _nanoexr_fill_missing_channels(img, rgbaIndex);
+
+    rv = exr_finish(&exr);
+    if (rv != EXR_ERR_SUCCESS) {
+        fprintf(stderr, "nanoexr finish error: %s\n",
+                exr_get_default_error_message(rv));
     }
-    if (img->channelCount > readChannelCount) {
-        if (img->channelCount == 4 && rgbaIndex[3] == -1) {
-            // fill the alpha channel with 1.0
-            if (img->pixelType == EXR_PIXEL_HALF) {
-                fill_channel_u16(img, 3, oneValue);
-            }
-            else if (img->pixelType == EXR_PIXEL_FLOAT) {
-                fill_channel_float(img, 3, 1.0f);
-            }
-            else if (img->pixelType == EXR_PIXEL_UINT) {
-                // We're treating uint data as data, not rgba, so fill with zero
-                fill_channel_u32(img, 3, 0);
-            }
-        }
-        if (img->channelCount > 2 && rgbaIndex[2] == -1) {
-            // if G exists, propagate it, else if R exists, propagate it, else fill with zero
-            // note that the data has been de-swizzled already so at this point,
-            // rgbaIndex serves only as a sentinel
-            int srcChannel = rgbaIndex[1] >= 0 ? 1 : (rgbaIndex[0] >= 0 ? 0 : -1);
-            if (srcChannel >= 0) {
-                if (img->pixelType == EXR_PIXEL_HALF) {
-                    copy_channel_u16(img, img->data, img->data, 2, srcChannel);
-                }
-                else if (img->pixelType == EXR_PIXEL_FLOAT) {
-                    copy_channel_float(img, img->data, img->data, 2, srcChannel);
-                }
-                else if (img->pixelType == EXR_PIXEL_UINT) {
-                    copy_channel_u32(img, img->data, img->data, 2, srcChannel);
-                }
-            }
-            else {
-                if (img->pixelType == EXR_PIXEL_HALF) {
-                    fill_channel_u16(img, 2, zeroValue);
-                }
-                else if (img->pixelType == EXR_PIXEL_FLOAT) {
-                    fill_channel_float(img, 2, 0.0f);
-                }
-                else if (img->pixelType == EXR_PIXEL_UINT) {
-                    fill_channel_u32(img, 2, 0);
-                }
-            }
-        }
-        if (img->channelCount > 1 && rgbaIndex[1] == -1) {
-            // if R exists, propagate it, else fill with zero
-            int srcChannel = rgbaIndex[0] >= 0 ? 0 : -1;
-            if (srcChannel >= 0) {
-                if (img->pixelType == EXR_PIXEL_HALF) {
-                    copy_channel_u16(img, img->data, img->data, 1, srcChannel);
-                }
-                else if (img->pixelType == EXR_PIXEL_FLOAT) {
-                    copy_channel_float(img, img->data, img->data, 1, srcChannel);
-                }
-                else if (img->pixelType == EXR_PIXEL_UINT) {
-                    copy_channel_u32(img, img->data, img->data, 1, srcChannel);
-                }
-            }
-            else {
-                if (img->pixelType == EXR_PIXEL_HALF) {
-                    fill_channel_u16(img, 1, zeroValue);
-                }
-                else if (img->pixelType == EXR_PIXEL_FLOAT) {
-                    fill_channel_float(img, 1, 0.0f);
-                }
-                else if (img->pixelType == EXR_PIXEL_UINT) {
-                    fill_channel_u32(img, 1, 0);
-                }
-            }
-        }
-        if (rgbaIndex[0] == -1) {
-            // fill with zero
-            if (img->pixelType == EXR_PIXEL_HALF) {
-                fill_channel_u16(img, 0, zeroValue);
-            }
-            else if (img->pixelType == EXR_PIXEL_FLOAT) {
-                fill_channel_float(img, 0, 0.0f);
-            }
-            else if (img->pixelType == EXR_PIXEL_UINT) {
-                fill_channel_u32(img, 0, 0);
-            }
-        }
+    return rv;
+}
+
+exr_result_t nanoexr_read_exr_scanlines(const char* filename,
+                                        exr_read_func_ptr_t readfn,
+                                        void* callback_userData,
+                                        nanoexr_ImageData_t* img,
+                                        const char* layerName,
+                                        int numChannelsToRead,
+                                        int partIndex,
+                                        int rowStart,
+                                        int numRows) {
+    if (numChannelsToRead == 0) {
+        return EXR_ERR_SUCCESS; // successfully read nothing
     }
-    
+    exr_context_t exr = NULL;
+    exr_result_t rv = EXR_ERR_SUCCESS;
+    exr_context_initializer_t cinit = EXR_DEFAULT_CONTEXT_INITIALIZER;
+    cinit.error_handler_fn = tiled_exr_err_cb;
+    cinit.read_fn = readfn;
+    cinit.user_data = callback_userData;
+    rv = exr_test_file_header(filename, &cinit);
+    if (rv != EXR_ERR_SUCCESS) {
+        fprintf(stderr, "nanoexr header error: %s\n",
+                exr_get_default_error_message(rv));
+        return rv;
+    }
+
+    rv = exr_start_read(&exr, filename, &cinit);
+    if (rv != EXR_ERR_SUCCESS) {
+        fprintf(stderr, "nanoexr start error: %s\n",
+                exr_get_default_error_message(rv));
+        exr_finish(&exr);
+        return rv;
+    }
+    exr_storage_t storage;
+    rv = exr_get_storage(exr, partIndex, &storage);
+    if (rv != EXR_ERR_SUCCESS) {
+        fprintf(stderr, "nanoexr storage error: %s\n",
+                exr_get_default_error_message(rv));
+        exr_finish(&exr);
+        return rv;
+    }
+    if (storage != EXR_STORAGE_SCANLINE) {
+        // only scanline images can be decoded in bands
+        exr_finish(&exr);
+        return EXR_ERR_SCAN_TILE_MIXEDAPI;
+    }
+
+    int num_sub_images = 0;
+    rv = exr_get_count(exr, &num_sub_images);
+    if (rv != EXR_ERR_SUCCESS || partIndex >= num_sub_images) {
+        fprintf(stderr, "nanoexr error: part index %d out of range\n", partIndex);
+        exr_finish(&exr);
+        return rv;
+    }
+
+    exr_attr_box2i_t datawin;
+    rv = exr_get_data_window(exr, partIndex, &datawin);
+    if (rv != EXR_ERR_SUCCESS) {
+        fprintf(stderr, "nanoexr data window error: %s\n",
+                exr_get_default_error_message(rv));
+        exr_finish(&exr);
+        return rv;
+    }
+
+    int width = datawin.max.x - datawin.min.x + 1;
+    int height = datawin.max.y - datawin.min.y + 1;
+    if (rowStart < 0 || numRows <= 0 || rowStart + numRows > height) {
+        fprintf(stderr, "nanoexr error: scanline band (%d, %d) out of range\n",
+                rowStart, numRows);
+        exr_finish(&exr);
+        return EXR_ERR_INVALID_ARGUMENT;
+    }
+
+    const exr_attr_chlist_t* chlist = NULL;
+    rv = exr_get_channels(exr, partIndex, &chlist);
+    if (rv != EXR_ERR_SUCCESS) {
+        fprintf(stderr, "nanoexr channels error: %s\n",
+                exr_get_default_error_message(rv));
+        exr_finish(&exr);
+        return rv;
+    }
+
+    exr_pixel_type_t pixelType = chlist->entries[0].pixel_type;
+    int bytesPerChannel = nanoexr_getPixelTypeSize(pixelType);
+    if (bytesPerChannel == 0) {
+        fprintf(stderr, "nanoexr error: unsupported pixel type\n");
+        exr_finish(&exr);
+        return rv;
+    }
+
+    img->channelCount = numChannelsToRead;
+    img->width = width;
+    img->height = numRows;
+    img->dataSize = (size_t) width * numRows * img->channelCount * bytesPerChannel;
+    img->pixelType = pixelType;
+    img->dataWindowMinY = datawin.min.y + rowStart;
+    img->dataWindowMaxY = datawin.min.y + rowStart + numRows;
+    img->data = (unsigned char*) malloc(img->dataSize);
+    if (img->data == NULL) {
+        fprintf(stderr, "nanoexr error: could not allocate memory for image data\n");
+        exr_finish(&exr);
+        return rv;
+    }
+
+    int rgbaIndex[4] = {-1, -1, -1, -1};
+
+    rv = nanoexr_read_scanline_band_exr(exr, img, layerName, partIndex,
+                                        rgbaIndex, datawin.min.y,
+                                        rowStart, numRows);
+    if (rv != EXR_ERR_SUCCESS) {
+        fprintf(stderr, "nanoexr: failed to read scanline band\n");
+        free(img->data);
+        img->data = NULL;
+        return rv;
+    }
+
+    _nanoexr_fill_missing_channels(img, rgbaIndex);
+
     rv = exr_finish(&exr);
     if (rv != EXR_ERR_SUCCESS) {
-        fprintf(stderr, "nanoexr finish error: %s\n", 
+        fprintf(stderr, "nanoexr finish error: %s\n",
                 exr_get_default_error_message(rv));
     }
     return rv;
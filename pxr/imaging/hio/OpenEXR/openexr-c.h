@@ -118,6 +118,22 @@ exr_result_t nanoexr_read_exr(const char* filename,
                               int partIndex,
                               int level);
 
+// reads the band of numRows scanlines starting at rowStart, counted from
+// the top of the data window, from a scanline image.  Only the chunks
+// overlapping the band are decoded and only the band is allocated, so a
+// large image can be read in bands without ever materializing the whole
+// image.  Returns EXR_ERR_SCAN_TILE_MIXEDAPI for tiled images.  The
+// caller is responsible for freeing img->data as for nanoexr_read_exr.
+exr_result_t nanoexr_read_exr_scanlines(const char* filename,
+                                        exr_read_func_ptr_t readfn,
+                                        void* callback_userData,
+                                        nanoexr_ImageData_t* img,
+                                        const char* layerName,
+                                        int numChannelsToRead,
+                                        int partIndex,
+                                        int rowStart,
+                                        int numRows);
+
 // callback to allow a user to add attributes to a context as desired
 typedef void (*nanoexr_attrsAdd)(void*, exr_context_t);
 
@@ -73,6 +73,13 @@ public:
     bool ReadCropped(int const cropTop,  int const cropBottom,
                      int const cropLeft, int const cropRight,
                      StorageSpec const &storage) override;
+    bool SupportsScanlineReads() const override {
+        // Only scanline images can be decoded in bands; scanline images
+        // have no mip levels, so only mip zero can be served.
+        return _exrReader.isScanline && _mip == 0;
+    }
+    bool ReadScanlines(int rowStart, int numRows,
+                       StorageSpec const &storage) override;
     bool Write(StorageSpec const &storage,
                VtDictionary const &metadata) override;
 
@@ -478,6 +485,104 @@ bool Hio_OpenEXRImage::ReadCropped(
     return true;
 }
 
+bool Hio_OpenEXRImage::ReadScanlines(int rowStart, int numRows,
+                                     StorageSpec const& storage)
+{
+    // not opened for read prior to calling ReadScanlines.
+    if (!_asset) {
+        return false;
+    }
+
+    if (!SupportsScanlineReads()) {
+        TF_CODING_ERROR("Scanline reads are not supported by this image; "
+                        "check SupportsScanlineReads() before calling");
+        return false;
+    }
+
+    int fileWidth =  _exrReader.width;
+    int fileHeight = _exrReader.height;
+    exr_pixel_type_t filePixelType = _exrReader.pixelType;
+
+    int outChannelCount = HioGetComponentCount(storage.format);
+
+    bool inputIsHalf =   filePixelType == EXR_PIXEL_HALF;
+    bool inputIsFloat =  filePixelType == EXR_PIXEL_FLOAT;
+    bool inputIsUInt =   filePixelType == EXR_PIXEL_UINT;
+    bool outputIsFloat = HioGetHioType(storage.format) == HioTypeFloat;
+    bool outputIsHalf =  HioGetHioType(storage.format) == HioTypeHalfFloat;
+    bool outputIsUInt =  HioGetHioType(storage.format) == HioTypeUnsignedInt;
+
+    // the conversion restrictions match ReadCropped
+    if (!(outputIsHalf || outputIsFloat || outputIsUInt)) {
+        return false;
+    }
+    if (outputIsUInt && !inputIsUInt) {
+        return false;
+    }
+    if ((outputIsFloat || outputIsHalf) && !(inputIsFloat || inputIsHalf)) {
+        return false;
+    }
+
+    // the band is read at the image's native resolution; no resizing.
+    if (rowStart < 0 || numRows <= 0 || rowStart + numRows > fileHeight ||
+        storage.width != fileWidth || storage.height != numRows) {
+        TF_CODING_ERROR("Invalid scanline band (%d, %d) for %dx%d image",
+                        rowStart, numRows, fileWidth, fileHeight);
+        return false;
+    }
+
+    // rowStart is expressed in the output orientation, so a flipped band
+    // is read from the opposite end of the image and reversed in place.
+    const int srcRowStart =
+        storage.flipped ? fileHeight - rowStart - numRows : rowStart;
+
+    nanoexr_ImageData_t img;
+    const int partIndex = 0;
+    exr_result_t rv = nanoexr_read_exr_scanlines(_exrReader.filename,
+                                                 exr_AssetRead_Func, this,
+                                                 &img, nullptr,
+                                                 outChannelCount, partIndex,
+                                                 srcRowStart, numRows);
+    if (rv != EXR_ERR_SUCCESS) {
+        return false;
+    }
+
+    if (storage.flipped) {
+        if (img.pixelType == EXR_PIXEL_HALF) {
+            ImageProcessor<GfHalf>::FlipImage(
+                reinterpret_cast<GfHalf*>(img.data),
+                fileWidth, numRows, img.channelCount);
+        }
+        else {
+            // float and uint channels are both four bytes
+            ImageProcessor<float>::FlipImage(
+                reinterpret_cast<float*>(img.data),
+                fileWidth, numRows, img.channelCount);
+        }
+    }
+
+    const size_t outCount =
+        static_cast<size_t>(fileWidth) * numRows * outChannelCount;
+    if (img.pixelType == EXR_PIXEL_HALF && outputIsFloat) {
+        GfHalf* src = reinterpret_cast<GfHalf*>(img.data);
+        float* dst = reinterpret_cast<float*>(storage.data);
+        for (size_t i = 0; i < outCount; ++i)
+            dst[i] = src[i];
+    }
+    else if (img.pixelType == EXR_PIXEL_FLOAT && outputIsHalf) {
+        float* src = reinterpret_cast<float*>(img.data);
+        GfHalf* dst = reinterpret_cast<GfHalf*>(storage.data);
+        for (size_t i = 0; i < outCount; ++i)
+            dst[i] = src[i];
+    }
+    else {
+        memcpy(storage.data, img.data, img.dataSize);
+    }
+
+    nanoexr_release_image_data(&img);
+    return true;
+}
+
 namespace {
     // Note that the alternative names and casing are for historical
     // compatibility. The OpenEXR standard attribute names are worldToNDC and
@@ -7,6 +7,7 @@
 #include "pxr/imaging/hio/image.h"
 #include "pxr/imaging/hio/imageRegistry.h"
 
+#include "pxr/base/tf/diagnostic.h"
 #include "pxr/base/tf/type.h"
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -18,6 +19,23 @@ TF_REGISTRY_FUNCTION(TfType)
 
 HioImage::~HioImage() = default;
 
+/* virtual */
+bool
+HioImage::SupportsScanlineReads() const
+{
+    return false;
+}
+
+/* virtual */
+bool
+HioImage::ReadScanlines(int rowStart, int numRows,
+                        StorageSpec const & storage)
+{
+    TF_CODING_ERROR("Scanline reads are not supported by this image; "
+                    "check SupportsScanlineReads() before calling");
+    return false;
+}
+
 /* static */
 bool
 HioImage::IsSupportedImageFile(std::string const & filename)
@@ -114,6 +114,29 @@ public:
                              int const cropRight,
                              StorageSpec const & storage) = 0;
 
+    /// Returns whether this image supports ReadScanlines.  The default
+    /// implementation returns false.
+    HIO_API
+    virtual bool SupportsScanlineReads() const;
+
+    /// Reads the band of \a numRows scanlines starting at \a rowStart into
+    /// \a storage, allowing callers to process large images in horizontal
+    /// bands without materializing a full-resolution buffer.
+    ///
+    /// The band is read at the image's native resolution: \a storage.width
+    /// must equal GetWidth() and \a storage.height must equal \a numRows;
+    /// no resizing is performed.  \a rowStart is expressed in the
+    /// orientation requested by \a storage.flipped, so reading consecutive
+    /// bands from row 0 to GetHeight() always yields the image top to
+    /// bottom in the output orientation.
+    ///
+    /// Only images for which SupportsScanlineReads() returns true support
+    /// this call; the default implementation issues a coding error and
+    /// returns false.
+    HIO_API
+    virtual bool ReadScanlines(int rowStart, int numRows,
+                               StorageSpec const & storage);
+
     /// }@
 
     /// \name Writing
@@ -0,0 +1,372 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+
+#include "pxr/imaging/hio/image.h"
+#include "pxr/imaging/hio/types.h"
+
+#include "pxr/usd/ar/asset.h"
+#include "pxr/usd/ar/resolvedPath.h"
+#include "pxr/usd/ar/resolver.h"
+
+#include "pxr/base/gf/vec3i.h"
+#include "pxr/base/tf/diagnostic.h"
+#include "pxr/base/tf/type.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+// KTX2 container parsing. We read the fixed-size file header and level
+// index directly; see the Khronos KTX File Format Specification,
+// version 2.0. Only non-supercompressed files holding block-compressed
+// payloads are supported -- the blocks are handed to the caller exactly
+// as stored so they can be uploaded to the GPU without any CPU decode.
+// BasisLZ/Zstd supercompressed files would require the corresponding
+// transcoder libraries and are rejected.
+namespace {
+
+constexpr uint8_t _ktx2Identifier[12] = {
+    0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A
+};
+
+struct _Ktx2Header
+{
+    uint8_t identifier[12];
+    uint32_t vkFormat;
+    uint32_t typeSize;
+    uint32_t pixelWidth;
+    uint32_t pixelHeight;
+    uint32_t pixelDepth;
+    uint32_t layerCount;
+    uint32_t faceCount;
+    uint32_t levelCount;
+    uint32_t supercompressionScheme;
+    uint32_t dfdByteOffset;
+    uint32_t dfdByteLength;
+    uint32_t kvdByteOffset;
+    uint32_t kvdByteLength;
+    uint64_t sgdByteOffset;
+    uint64_t sgdByteLength;
+};
+static_assert(sizeof(_Ktx2Header) == 80, "KTX2 header must be 80 bytes");
+
+struct _Ktx2LevelIndexEntry
+{
+    uint64_t byteOffset;
+    uint64_t byteLength;
+    uint64_t uncompressedByteLength;
+};
+
+// VkFormat values for the block-compressed formats we pass through, from
+// vulkan_core.h; spelled out here so that hio does not depend on the
+// Vulkan headers.
+enum
+{
+    _VkFormatBC1RgbUnormBlock  = 131,
+    _VkFormatBC1RgbaUnormBlock = 133,
+    _VkFormatBC3UnormBlock     = 137,
+    _VkFormatBC6HUfloatBlock   = 143,
+    _VkFormatBC6HSfloatBlock   = 144,
+    _VkFormatBC7UnormBlock     = 145,
+    _VkFormatBC7SrgbBlock      = 146
+};
+
+static HioFormat
+_GetHioFormat(uint32_t vkFormat)
+{
+    switch (vkFormat) {
+    case _VkFormatBC1RgbUnormBlock:
+    case _VkFormatBC1RgbaUnormBlock:
+        return HioFormatBC1UNorm8Vec4;
+    case _VkFormatBC3UnormBlock:
+        return HioFormatBC3UNorm8Vec4;
+    case _VkFormatBC6HUfloatBlock:
+        return HioFormatBC6UFloatVec3;
+    case _VkFormatBC6HSfloatBlock:
+        return HioFormatBC6FloatVec3;
+    case _VkFormatBC7UnormBlock:
+        return HioFormatBC7UNorm8Vec4;
+    case _VkFormatBC7SrgbBlock:
+        return HioFormatBC7UNorm8Vec4srgb;
+    }
+    return HioFormatInvalid;
+}
+
+} // anonymous namespace
+
+/// \class Hio_Ktx2Image
+///
+/// Reads block-compressed (BC1/BC3/BC6H/BC7) texture data from KTX2
+/// containers. The compressed blocks are returned as-is, so they flow
+/// through to the GPU without being decoded on the CPU.
+///
+class Hio_Ktx2Image final : public HioImage
+{
+public:
+    using Base = HioImage;
+
+    Hio_Ktx2Image() = default;
+
+    // HioImage overrides
+    std::string const & GetFilename() const override;
+    int GetWidth() const override;
+    int GetHeight() const override;
+    HioFormat GetFormat() const override;
+    int GetBytesPerPixel() const override;
+    int GetNumMipLevels() const override;
+
+    bool IsColorSpaceSRGB() const override;
+
+    bool GetMetadata(TfToken const & key, VtValue * value) const override;
+    bool GetSamplerMetadata(HioAddressDimension dim,
+                            HioAddressMode * param) const override;
+
+    bool Read(StorageSpec const & storage) override;
+    bool ReadCropped(int const cropTop,
+                     int const cropBottom,
+                     int const cropLeft,
+                     int const cropRight,
+                     StorageSpec const & storage) override;
+
+    bool Write(StorageSpec const & storage,
+               VtDictionary const & metadata) override;
+
+protected:
+    bool _OpenForReading(std::string const & filename, int subimage,
+                         int mip, SourceColorSpace sourceColorSpace,
+                         bool suppressErrors) override;
+    bool _OpenForWriting(std::string const & filename) override;
+
+private:
+    std::string _filename;
+    std::shared_ptr<ArAsset> _asset;
+
+    HioFormat _format = HioFormatInvalid;
+    int _width = 0;
+    int _height = 0;
+    int _levelCount = 0;
+
+    // File range of the opened mip level's image data.
+    uint64_t _levelByteOffset = 0;
+    uint64_t _levelByteLength = 0;
+};
+
+TF_REGISTRY_FUNCTION(TfType)
+{
+    using Image = Hio_Ktx2Image;
+    TfType t = TfType::Define<Image, TfType::Bases<Image::Base> >();
+    t.SetFactory< HioImageFactory<Image> >();
+}
+
+bool
+Hio_Ktx2Image::_OpenForReading(std::string const & filename, int subimage,
+                               int mip, SourceColorSpace sourceColorSpace,
+                               bool suppressErrors)
+{
+    _filename = filename;
+
+    if (subimage != 0) {
+        return false;
+    }
+
+    _asset = ArGetResolver().OpenAsset(ArResolvedPath(filename));
+    if (!_asset) {
+        return false;
+    }
+
+    _Ktx2Header header;
+    if (_asset->Read(&header, sizeof(header), 0) != sizeof(header) ||
+        memcmp(header.identifier, _ktx2Identifier,
+               sizeof(_ktx2Identifier)) != 0) {
+        return false;
+    }
+
+    if (header.supercompressionScheme != 0) {
+        if (!suppressErrors) {
+            TF_WARN("Supercompressed (e.g. BasisLZ or Zstd) KTX2 file "
+                    "'%s' is not supported; re-encode without "
+                    "supercompression.", filename.c_str());
+        }
+        return false;
+    }
+
+    // Only simple 2D textures.
+    if (header.pixelDepth > 1 || header.layerCount > 1 ||
+        header.faceCount != 1 || header.pixelHeight == 0) {
+        if (!suppressErrors) {
+            TF_WARN("KTX2 file '%s' is not a non-array 2D texture.",
+                    filename.c_str());
+        }
+        return false;
+    }
+
+    _format = _GetHioFormat(header.vkFormat);
+    if (_format == HioFormatInvalid) {
+        if (!suppressErrors) {
+            TF_WARN("KTX2 file '%s' uses unsupported vkFormat %u; only "
+                    "BC1, BC3, BC6H and BC7 payloads are supported.",
+                    filename.c_str(), header.vkFormat);
+        }
+        return false;
+    }
+
+    // Honor explicit color space requests where the format permits; the
+    // compressed payload itself is unchanged either way.
+    if (sourceColorSpace == HioImage::SRGB &&
+        _format == HioFormatBC7UNorm8Vec4) {
+        _format = HioFormatBC7UNorm8Vec4srgb;
+    } else if (sourceColorSpace == HioImage::Raw &&
+               _format == HioFormatBC7UNorm8Vec4srgb) {
+        _format = HioFormatBC7UNorm8Vec4;
+    }
+
+    _levelCount = std::max<int>(1, header.levelCount);
+    if (mip < 0 || mip >= _levelCount) {
+        return false;
+    }
+
+    _Ktx2LevelIndexEntry level;
+    const size_t levelIndexOffset =
+        sizeof(_Ktx2Header) + mip * sizeof(_Ktx2LevelIndexEntry);
+    if (_asset->Read(&level, sizeof(level), levelIndexOffset)
+            != sizeof(level)) {
+        return false;
+    }
+
+    _width = std::max<int>(1, header.pixelWidth >> mip);
+    _height = std::max<int>(1, header.pixelHeight >> mip);
+    _levelByteOffset = level.byteOffset;
+    _levelByteLength = level.byteLength;
+
+    const size_t expectedSize =
+        HioGetDataSize(_format, GfVec3i(_width, _height, 1));
+    if (_levelByteLength < expectedSize) {
+        if (!suppressErrors) {
+            TF_WARN("KTX2 file '%s' mip %d holds %zu bytes; expected "
+                    "%zu.", filename.c_str(), mip,
+                    (size_t)_levelByteLength, expectedSize);
+        }
+        return false;
+    }
+
+    return true;
+}
+
+bool
+Hio_Ktx2Image::_OpenForWriting(std::string const & filename)
+{
+    // Writing KTX2 files is not supported.
+    return false;
+}
+
+std::string const &
+Hio_Ktx2Image::GetFilename() const
+{
+    return _filename;
+}
+
+int
+Hio_Ktx2Image::GetWidth() const
+{
+    return _width;
+}
+
+int
+Hio_Ktx2Image::GetHeight() const
+{
+    return _height;
+}
+
+HioFormat
+Hio_Ktx2Image::GetFormat() const
+{
+    return _format;
+}
+
+int
+Hio_Ktx2Image::GetBytesPerPixel() const
+{
+    // For block-compressed formats this is the size of a block, the
+    // smallest addressable unit of the image.
+    return static_cast<int>(HioGetDataSizeOfFormat(_format));
+}
+
+int
+Hio_Ktx2Image::GetNumMipLevels() const
+{
+    return _levelCount;
+}
+
+bool
+Hio_Ktx2Image::IsColorSpaceSRGB() const
+{
+    return _format == HioFormatBC7UNorm8Vec4srgb;
+}
+
+bool
+Hio_Ktx2Image::GetMetadata(TfToken const & key, VtValue * value) const
+{
+    return false;
+}
+
+bool
+Hio_Ktx2Image::GetSamplerMetadata(HioAddressDimension dim,
+                                  HioAddressMode * param) const
+{
+    return false;
+}
+
+bool
+Hio_Ktx2Image::Read(StorageSpec const & storage)
+{
+    if (!_asset) {
+        return false;
+    }
+
+    if (storage.format != _format ||
+        storage.width != _width || storage.height != _height) {
+        TF_CODING_ERROR("Read requires the image's native format and "
+                        "dimensions for compressed file '%s'",
+                        _filename.c_str());
+        return false;
+    }
+
+    // Note that block-compressed data cannot be flipped without
+    // decoding, so storage.flipped is ignored; clients that need a
+    // particular orientation must bake it into the asset.
+
+    const size_t size = HioGetDataSize(_format, GfVec3i(_width, _height, 1));
+    return _asset->Read(storage.data, size, _levelByteOffset) == size;
+}
+
+bool
+Hio_Ktx2Image::ReadCropped(int const cropTop,
+                           int const cropBottom,
+                           int const cropLeft,
+                           int const cropRight,
+                           StorageSpec const & storage)
+{
+    if (cropTop || cropBottom || cropLeft || cropRight) {
+        TF_CODING_ERROR("Cannot crop block-compressed KTX2 file '%s'",
+                        _filename.c_str());
+        return false;
+    }
+    return Read(storage);
+}
+
+bool
+Hio_Ktx2Image::Write(StorageSpec const & storage,
+                     VtDictionary const & metadata)
+{
+    TF_CODING_ERROR("Writing KTX2 files is not supported");
+    return false;
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
@@ -85,6 +85,10 @@ public:
                      int const cropRight,
                      StorageSpec const & storage) override;
 
+    bool SupportsScanlineReads() const override;
+    bool ReadScanlines(int rowStart, int numRows,
+                       StorageSpec const & storage) override;
+
     bool Write(StorageSpec const & storage,
                VtDictionary const & metadata) override;
 
@@ -116,6 +120,12 @@ private:
     HioFormat _format;
 
     SourceColorSpace _sourceColorSpace;
+
+    // Full-image decode cached across successive ReadScanlines calls.  stb
+    // cannot decode partial images, so band reads decode once and copy rows
+    // out; the cache is released once the last row has been delivered.
+    void *_scanlineCache;
+    bool _scanlineCacheFlipped;
 };
 
 TF_REGISTRY_FUNCTION(TfType)
@@ -167,6 +177,8 @@ Hio_StbImage::Hio_StbImage()
     , _nchannels(0)
     , _format(HioFormatInvalid)
     , _sourceColorSpace(Auto)
+    , _scanlineCache(nullptr)
+    , _scanlineCacheFlipped(false)
 {
 }
 
@@ -260,7 +272,12 @@ Hio_StbImage::_CropAndResize(void const *sourceData, int const cropTop,
 }
 
 /* virtual */
-Hio_StbImage::~Hio_StbImage() = default;
+Hio_StbImage::~Hio_StbImage()
+{
+    if (_scanlineCache) {
+        stbi_image_free(_scanlineCache);
+    }
+}
 
 /* virtual */
 std::string const &
@@ -551,6 +568,104 @@ Hio_StbImage::ReadCropped(int const cropTop,
     return true;
 }
 
+/* virtual */
+bool
+Hio_StbImage::SupportsScanlineReads() const
+{
+    return true;
+}
+
+/* virtual */
+/// Reads the band of numRows scanlines starting at rowStart into storage.
+/// stb has no partial decode, so the first band read decodes the whole
+/// image into a cache that subsequent band reads copy from; the cache is
+/// freed once a band including the last row has been read.
+bool
+Hio_StbImage::ReadScanlines(int rowStart, int numRows,
+                            StorageSpec const & storage)
+{
+    if (storage.format != _format) {
+        TF_RUNTIME_ERROR("Image format mismatch");
+        return false;
+    }
+
+    if (rowStart < 0 || numRows <= 0 || rowStart + numRows > _height ||
+        storage.width != _width || storage.height != numRows) {
+        TF_CODING_ERROR("Invalid scanline band (%d, %d) for %dx%d image",
+                        rowStart, numRows, _width, _height);
+        return false;
+    }
+
+    if (_scanlineCache && _scanlineCacheFlipped != storage.flipped) {
+        // The cached decode was flipped for the other orientation;
+        // drop it and decode again.
+        stbi_image_free(_scanlineCache);
+        _scanlineCache = nullptr;
+    }
+
+    if (!_scanlineCache) {
+#if defined(ARCH_OS_IPHONE)
+        stbi_convert_iphone_png_to_rgb(true);
+#endif
+        std::shared_ptr<ArAsset> const asset = ArGetResolver().OpenAsset(
+            ArResolvedPath(_filename));
+        if (!asset) {
+            TF_RUNTIME_ERROR("Cannot open image %s for reading",
+                             _filename.c_str());
+            return false;
+        }
+
+        std::shared_ptr<const char> const buffer = asset->GetBuffer();
+        if (!buffer) {
+            TF_RUNTIME_ERROR("Cannot open image %s for reading",
+                             _filename.c_str());
+            return false;
+        }
+
+        size_t bufferSize = asset->GetSize();
+        if (_outputType == HioTypeFloat) {
+            _scanlineCache = stbi_loadf_from_memory(
+                reinterpret_cast<stbi_uc const *>(buffer.get()), bufferSize,
+                &_width, &_height, &_nchannels, 0);
+            if (_scanlineCache && storage.flipped) {
+                stbi__vertical_flip(
+                    _scanlineCache, _width, _height,
+                    _nchannels * sizeof(float));
+            }
+        }
+        else {
+            _scanlineCache = stbi_load_from_memory(
+                reinterpret_cast<stbi_uc const *>(buffer.get()), bufferSize,
+                &_width, &_height, &_nchannels, 0);
+            if (_scanlineCache && storage.flipped) {
+                stbi__vertical_flip(
+                    _scanlineCache, _width, _height,
+                    _nchannels * sizeof(stbi_uc));
+            }
+        }
+
+        if (!_scanlineCache) {
+            TF_RUNTIME_ERROR("unable to get_pixels");
+            return false;
+        }
+        _scanlineCacheFlipped = storage.flipped;
+    }
+
+    const size_t rowBytes = static_cast<size_t>(_width) * GetBytesPerPixel();
+    memcpy(storage.data,
+           static_cast<unsigned char *>(_scanlineCache) + rowStart * rowBytes,
+           numRows * rowBytes);
+
+    // A band including the last row ends a top-to-bottom sweep; release
+    // the cached decode.
+    if (rowStart + numRows == _height) {
+        stbi_image_free(_scanlineCache);
+        _scanlineCache = nullptr;
+    }
+
+    return true;
+}
+
 /* virtual */
 bool
 Hio_StbImage::_OpenForWriting(std::string const & filename)
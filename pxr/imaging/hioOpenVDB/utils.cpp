@@ -7,11 +7,13 @@
 
 #include "pxr/imaging/hioOpenVDB/utils.h"
 #include "pxr/imaging/hioOpenVDB/vdbAssetInterface.h"
+#include "pxr/base/tf/fileUtils.h"
 #include "pxr/base/trace/trace.h"
 #include "pxr/usd/ar/asset.h"
 #include "pxr/usd/ar/resolver.h"
 #include "pxr/usd/ar/resolvedPath.h"
 
+#include "openvdb/io/File.h"
 #include "openvdb/io/Stream.h"
 
 #include <istream>
@@ -67,6 +69,26 @@ private:
     _CharBuf _buffer;
 };
 
+/// Open the OpenVDB file at \p filePath with delayed loading enabled, so
+/// that leaf voxel data is memory-mapped and paged in on demand rather than
+/// read up front. Returns false on failure.
+bool
+_OpenVDBFile(openvdb::io::File* file)
+{
+    TRACE_FUNCTION_SCOPE("Opening VDB file");
+    try {
+        file->open(/* delayLoad = */ true);
+    } catch (openvdb::IoError const &e) {
+        TF_WARN("Could not open OpenVDB file: %s", e.what());
+        return false;
+    } catch (openvdb::LookupError const &e) {
+        // Occurs, e.g., when there is an unknown grid type in VDB file
+        TF_WARN("Could not parse OpenVDB file: %s", e.what());
+        return false;
+    }
+    return true;
+}
+
 openvdb::GridPtrVecPtr
 _ReadVDBGridsFromAssetBuffer(const std::shared_ptr<ArAsset>& asset)
 {
@@ -91,6 +113,21 @@ _ReadVDBGridsFromAssetBuffer(const std::shared_ptr<ArAsset>& asset)
 openvdb::GridBase::Ptr
 HioOpenVDBGridFromAsset(const std::string& name, const std::string& assetPath)
 {
+    // If the asset resolves to a file on disk, read just the named grid from
+    // it with delayed loading, rather than pulling the whole asset into
+    // memory and decoding every grid it contains.
+    if (TfIsFile(assetPath)) {
+        TRACE_FUNCTION_SCOPE("Reading VDB grid from file.");
+        openvdb::initialize();
+        openvdb::io::File file(assetPath);
+        if (_OpenVDBFile(&file)) {
+            if (file.hasGrid(name)) {
+                return file.readGrid(name);
+            }
+        }
+        return nullptr;
+    }
+
     std::shared_ptr<ArAsset> asset =
         ArGetResolver().OpenAsset(ArResolvedPath(assetPath));
 
@@ -123,6 +160,18 @@ HioOpenVDBGridFromAsset(const std::string& name, const std::string& assetPath)
 openvdb::GridPtrVecPtr
 HioOpenVDBGridsFromAsset(const std::string& assetPath)
 {
+    // See comment in HioOpenVDBGridFromAsset; delayed loading defers reading
+    // each grid's voxel data until it is actually sampled.
+    if (TfIsFile(assetPath)) {
+        TRACE_FUNCTION_SCOPE("Reading VDB grids from file.");
+        openvdb::initialize();
+        openvdb::io::File file(assetPath);
+        if (_OpenVDBFile(&file)) {
+            return file.getGrids();
+        }
+        return nullptr;
+    }
+
     std::shared_ptr<ArAsset> asset =
         ArGetResolver().OpenAsset(ArResolvedPath(assetPath));
 
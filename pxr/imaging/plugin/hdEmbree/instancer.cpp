@@ -16,6 +16,9 @@
 #include "pxr/base/gf/rotation.h"
 #include "pxr/base/gf/quaternion.h"
 #include "pxr/base/tf/staticTokens.h"
+#include "pxr/base/work/loops.h"
+
+#include <memory>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -94,63 +97,83 @@ HdEmbreeInstancer::ComputeInstanceTransforms(SdfPath const &prototypeId)
         GetDelegate()->GetInstanceIndices(GetId(), prototypeId);
 
     VtMatrix4dArray transforms(instanceIndices.size());
-    for (size_t i = 0; i < instanceIndices.size(); ++i) {
-        transforms[i] = instancerTransform;
-    }
 
+    // Hoist a sampler per TRS primvar so the composition below can run as a
+    // single fused loop over the instances instead of one pass per primvar.
+    //
     // "hydra:instanceTranslations" holds a translation vector for each index.
+    std::unique_ptr<HdEmbreeBufferSampler> translateSampler;
     if (_primvarMap.count(HdInstancerTokens->instanceTranslations) > 0) {
-        HdEmbreeBufferSampler
-                sampler(*_primvarMap[HdInstancerTokens->instanceTranslations]);
-        for (size_t i = 0; i < instanceIndices.size(); ++i) {
-            GfVec3f translate;
-            if (sampler.Sample(instanceIndices[i], &translate)) {
-                GfMatrix4d translateMat(1);
-                translateMat.SetTranslate(GfVec3d(translate));
-                transforms[i] = translateMat * transforms[i];
-            }
-        }
+        translateSampler = std::make_unique<HdEmbreeBufferSampler>(
+            *_primvarMap[HdInstancerTokens->instanceTranslations]);
     }
 
     // "hydra:instanceRotations" holds a quaternion in <real, i, j, k>
     // format for each index.
+    std::unique_ptr<HdEmbreeBufferSampler> rotateSampler;
     if (_primvarMap.count(HdInstancerTokens->instanceRotations) > 0) {
-        HdEmbreeBufferSampler sampler(*_primvarMap[HdInstancerTokens->instanceRotations]);
-        for (size_t i = 0; i < instanceIndices.size(); ++i) {
+        rotateSampler = std::make_unique<HdEmbreeBufferSampler>(
+            *_primvarMap[HdInstancerTokens->instanceRotations]);
+    }
+
+    // "hydra:instanceScales" holds an axis-aligned scale vector for each index.
+    std::unique_ptr<HdEmbreeBufferSampler> scaleSampler;
+    if (_primvarMap.count(HdInstancerTokens->instanceScales) > 0) {
+        scaleSampler = std::make_unique<HdEmbreeBufferSampler>(
+            *_primvarMap[HdInstancerTokens->instanceScales]);
+    }
+
+    // "hydra:instanceTransforms" holds a 4x4 transform matrix for each index.
+    std::unique_ptr<HdEmbreeBufferSampler> transformSampler;
+    if (_primvarMap.count(HdInstancerTokens->instanceTransforms) > 0) {
+        transformSampler = std::make_unique<HdEmbreeBufferSampler>(
+            *_primvarMap[HdInstancerTokens->instanceTransforms]);
+    }
+
+    // Each instance composes independently, so large instance counts
+    // (e.g. animated crowds) are spread across threads.  Grab the array
+    // pointer up front so the workers don't race on copy-on-write checks.
+    GfMatrix4d * const transformsData = transforms.data();
+    WorkParallelForN(instanceIndices.size(),
+        [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            GfMatrix4d transform = instancerTransform;
+
+            GfVec3f translate;
+            if (translateSampler &&
+                translateSampler->Sample(instanceIndices[i], &translate)) {
+                GfMatrix4d translateMat(1);
+                translateMat.SetTranslate(GfVec3d(translate));
+                transform = translateMat * transform;
+            }
+
             GfVec4f quat;
-            if (sampler.Sample(instanceIndices[i], &quat)) {
+            if (rotateSampler &&
+                rotateSampler->Sample(instanceIndices[i], &quat)) {
                 GfMatrix4d rotateMat(1);
                 rotateMat.SetRotate(GfQuatd(
                     quat[0], quat[1], quat[2], quat[3]));
-                transforms[i] = rotateMat * transforms[i];
+                transform = rotateMat * transform;
             }
-        }
-    }
 
-    // "hydra:instanceScales" holds an axis-aligned scale vector for each index.
-    if (_primvarMap.count(HdInstancerTokens->instanceScales) > 0) {
-        HdEmbreeBufferSampler sampler(*_primvarMap[HdInstancerTokens->instanceScales]);
-        for (size_t i = 0; i < instanceIndices.size(); ++i) {
             GfVec3f scale;
-            if (sampler.Sample(instanceIndices[i], &scale)) {
+            if (scaleSampler &&
+                scaleSampler->Sample(instanceIndices[i], &scale)) {
                 GfMatrix4d scaleMat(1);
                 scaleMat.SetScale(GfVec3d(scale));
-                transforms[i] = scaleMat * transforms[i];
+                transform = scaleMat * transform;
             }
-        }
-    }
 
-    // "hydra:instanceTransforms" holds a 4x4 transform matrix for each index.
-    if (_primvarMap.count(HdInstancerTokens->instanceTransforms) > 0) {
-        HdEmbreeBufferSampler
-                sampler(*_primvarMap[HdInstancerTokens->instanceTransforms]);
-        for (size_t i = 0; i < instanceIndices.size(); ++i) {
             GfMatrix4d instanceTransform;
-            if (sampler.Sample(instanceIndices[i], &instanceTransform)) {
-                transforms[i] = instanceTransform * transforms[i];
+            if (transformSampler &&
+                transformSampler->Sample(
+                    instanceIndices[i], &instanceTransform)) {
+                transform = instanceTransform * transform;
             }
+
+            transformsData[i] = transform;
         }
-    }
+    });
 
     if (GetParentId().IsEmpty()) {
         return transforms;
@@ -172,12 +195,16 @@ HdEmbreeInstancer::ComputeInstanceTransforms(SdfPath const &prototypeId)
             ComputeInstanceTransforms(GetId());
 
     VtMatrix4dArray final(parentTransforms.size() * transforms.size());
-    for (size_t i = 0; i < parentTransforms.size(); ++i) {
-        for (size_t j = 0; j < transforms.size(); ++j) {
-            final[i * transforms.size() + j] = transforms[j] *
-                                               parentTransforms[i];
+    GfMatrix4d * const finalData = final.data();
+    WorkParallelForN(parentTransforms.size(),
+        [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            for (size_t j = 0; j < transforms.size(); ++j) {
+                finalData[i * transforms.size() + j] = transforms[j] *
+                                                       parentTransforms[i];
+            }
         }
-    }
+    });
     return final;
 }
 
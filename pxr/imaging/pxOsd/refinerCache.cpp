@@ -0,0 +1,134 @@
+//
+// Copyright 2026 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+///
+/// \file pxOsd/refinerCache.cpp
+///
+
+#include "pxr/imaging/pxOsd/refinerCache.h"
+
+#include "pxr/base/arch/hash.h"
+#include "pxr/base/tf/instantiateSingleton.h"
+#include "pxr/base/trace/trace.h"
+
+#include <opensubdiv/far/patchTableFactory.h>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+TF_INSTANTIATE_SINGLETON(PxOsdRefinerCache);
+
+PxOsdRefinerCache&
+PxOsdRefinerCache::GetInstance()
+{
+    return TfSingleton<PxOsdRefinerCache>::GetInstance();
+}
+
+static uint64_t
+_ComputeCacheKey(
+    PxOsdMeshTopology const &topology,
+    std::vector<VtIntArray> const &fvarTopologies,
+    int refineLevel,
+    bool adaptive)
+{
+    uint64_t hash = topology.ComputeHash();
+    for (VtIntArray const &fvarIndices : fvarTopologies) {
+        hash = ArchHash64((const char*)fvarIndices.cdata(),
+                          fvarIndices.size() * sizeof(int), hash);
+    }
+    hash = ArchHash64((const char*)&refineLevel, sizeof(refineLevel), hash);
+    hash = ArchHash64((const char*)&adaptive, sizeof(adaptive), hash);
+    return hash;
+}
+
+PxOsdRefinerCache::RefinedTopologySharedPtr
+PxOsdRefinerCache::GetOrCreateRefinedTopology(
+    PxOsdMeshTopology const &topology,
+    std::vector<VtIntArray> const &fvarTopologies,
+    int refineLevel,
+    bool adaptive,
+    TfToken name)
+{
+    TRACE_FUNCTION();
+
+    using namespace OpenSubdiv;
+
+    const uint64_t key =
+        _ComputeCacheKey(topology, fvarTopologies, refineLevel, adaptive);
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        const auto it = _entries.find(key);
+        if (it != _entries.end()) {
+            if (RefinedTopologySharedPtr entry = it->second.lock()) {
+                return entry;
+            }
+        }
+    }
+
+    // Refine outside the lock; concurrent requests for the same topology may
+    // race to create, with the first published entry winning below.
+    PxOsdTopologyRefinerSharedPtr refiner =
+        PxOsdRefinerFactory::Create(topology, fvarTopologies, name);
+    if (!refiner) {
+        return nullptr;
+    }
+
+    const int numFvarChannels = refiner->GetNumFVarChannels();
+
+    Far::PatchTableFactory::Options patchOptions(refineLevel);
+    if (numFvarChannels > 0) {
+        patchOptions.generateFVarTables = true;
+        patchOptions.includeFVarBaseLevelIndices = true;
+        patchOptions.generateFVarLegacyLinearPatches = !adaptive;
+    }
+    if (adaptive) {
+        patchOptions.endCapType =
+            Far::PatchTableFactory::Options::ENDCAP_BSPLINE_BASIS;
+#if OPENSUBDIV_VERSION_NUMBER >= 30400
+        // Improve fidelity when refining to limit surface patches
+        // These options supported since v3.1.0 and v3.2.0 respectively.
+        patchOptions.useInfSharpPatch = true;
+        patchOptions.generateLegacySharpCornerPatches = false;
+#endif
+    }
+
+    {
+        TRACE_SCOPE("refine");
+        if (adaptive) {
+            Far::TopologyRefiner::AdaptiveOptions adaptiveOptions(refineLevel);
+#if OPENSUBDIV_VERSION_NUMBER >= 30400
+            adaptiveOptions = patchOptions.GetRefineAdaptiveOptions();
+#endif
+            refiner->RefineAdaptive(adaptiveOptions);
+        } else {
+            refiner->RefineUniform(refineLevel);
+        }
+    }
+
+    std::shared_ptr<RefinedTopology> result =
+        std::make_shared<RefinedTopology>();
+    result->refiner = refiner;
+    {
+        TRACE_SCOPE("patch factory");
+        result->patchTable.reset(
+            Far::PatchTableFactory::Create(*refiner, patchOptions));
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    const auto it = _entries.find(key);
+    if (it != _entries.end()) {
+        if (RefinedTopologySharedPtr entry = it->second.lock()) {
+            // another thread published the same topology first; discard ours
+            return entry;
+        }
+        it->second = result;
+    } else {
+        _entries[key] = result;
+    }
+    return result;
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
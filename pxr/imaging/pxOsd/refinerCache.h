@@ -0,0 +1,81 @@
+//
+// Copyright 2026 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+#ifndef PXR_IMAGING_PX_OSD_REFINER_CACHE_H
+#define PXR_IMAGING_PX_OSD_REFINER_CACHE_H
+
+/// \file pxOsd/refinerCache.h
+
+#include "pxr/pxr.h"
+#include "pxr/imaging/pxOsd/api.h"
+#include "pxr/imaging/pxOsd/refinerFactory.h"
+#include "pxr/base/tf/singleton.h"
+
+#include <opensubdiv/far/patchTable.h>
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// \class PxOsdRefinerCache
+///
+/// A process-wide cache of refined topology refiners and their patch tables,
+/// keyed by PxOsdMeshTopology::ComputeHash, letting render delegates which
+/// perform their own subdivision share one Far precompute per unique
+/// topology rather than each repeating the refinement.
+///
+/// Entries are immutable once published: the refiner held by an entry has
+/// already been refined to the requested level, and consumers may build
+/// stencil tables or evaluators against it but must not refine it further.
+/// The cache holds weak references, so an entry persists only while at
+/// least one consumer retains the returned shared pointer.
+///
+class PxOsdRefinerCache : public TfSingleton<PxOsdRefinerCache>
+{
+public:
+    PXOSD_API
+    static PxOsdRefinerCache& GetInstance();
+
+    /// A refined topology refiner and the patch table built from it.
+    struct RefinedTopology
+    {
+        PxOsdTopologyRefinerSharedPtr refiner;
+        std::shared_ptr<OpenSubdiv::Far::PatchTable const> patchTable;
+    };
+
+    using RefinedTopologySharedPtr = std::shared_ptr<RefinedTopology const>;
+
+    /// Returns the shared refined topology for \p topology with the given
+    /// face-varying channels, refinement level and mode, creating and
+    /// publishing it if no equivalent entry exists.
+    ///
+    /// The patch table is built with B-spline basis end caps for adaptive
+    /// refinement and with legacy linear face-varying patches for uniform
+    /// refinement, matching the options Storm uses. Returns null if the
+    /// refiner could not be created.
+    PXOSD_API
+    RefinedTopologySharedPtr GetOrCreateRefinedTopology(
+        PxOsdMeshTopology const &topology,
+        std::vector<VtIntArray> const &fvarTopologies,
+        int refineLevel,
+        bool adaptive,
+        TfToken name = TfToken());
+
+private:
+    friend class TfSingleton<PxOsdRefinerCache>;
+    PxOsdRefinerCache() = default;
+
+    std::mutex _mutex;
+    std::unordered_map<uint64_t, std::weak_ptr<RefinedTopology const>>
+        _entries;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // PXR_IMAGING_PX_OSD_REFINER_CACHE_H
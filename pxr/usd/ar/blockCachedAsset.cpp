@@ -0,0 +1,133 @@
+//
+// Copyright 2022 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+
+#include "pxr/usd/ar/blockCachedAsset.h"
+
+#include "pxr/base/tf/diagnostic.h"
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+std::shared_ptr<ArBlockCachedAsset>
+ArBlockCachedAsset::FromAsset(
+    const std::shared_ptr<ArAsset>& srcAsset,
+    size_t blockSize)
+{
+    if (!srcAsset) {
+        TF_CODING_ERROR("Invalid source asset");
+        return nullptr;
+    }
+    if (blockSize == 0) {
+        TF_CODING_ERROR("Invalid block size of 0");
+        return nullptr;
+    }
+
+    return std::make_shared<ArBlockCachedAsset>(
+        srcAsset, blockSize, PrivateCtorTag());
+}
+
+ArBlockCachedAsset::ArBlockCachedAsset(
+    const std::shared_ptr<ArAsset>& srcAsset,
+    size_t blockSize,
+    PrivateCtorTag)
+    : _srcAsset(srcAsset)
+    , _size(srcAsset->GetSize())
+    , _blockSize(blockSize)
+{
+    const size_t numBlocks = (_size + _blockSize - 1) / _blockSize;
+    _blocks.reset(new _Block[numBlocks]);
+}
+
+ArBlockCachedAsset::~ArBlockCachedAsset() = default;
+
+size_t
+ArBlockCachedAsset::GetSize() const
+{
+    return _size;
+}
+
+const char*
+ArBlockCachedAsset::_GetBlock(size_t blockIndex) const
+{
+    _Block& block = _blocks[blockIndex];
+    std::call_once(block.onceFlag, [this, blockIndex, &block]() {
+        const size_t offset = blockIndex * _blockSize;
+        const size_t numBytes = std::min(_blockSize, _size - offset);
+        std::unique_ptr<char[]> data;
+        try {
+            data.reset(new char[numBytes]);
+        }
+        catch (const std::bad_alloc&) {
+            TF_RUNTIME_ERROR(
+                "Failed to allocate block of %zu bytes for asset.", numBytes);
+            return;
+        }
+        if (_srcAsset->Read(data.get(), numBytes, offset) != numBytes) {
+            TF_RUNTIME_ERROR(
+                "Failed to read %zu bytes at offset %zu from source asset.",
+                numBytes, offset);
+            return;
+        }
+        block.data.reset(data.release());
+    });
+    return block.data.get();
+}
+
+std::shared_ptr<const char>
+ArBlockCachedAsset::GetBuffer() const
+{
+    std::shared_ptr<char> buffer;
+    try {
+        buffer.reset(new char[_size], std::default_delete<char[]>());
+    }
+    catch (const std::bad_alloc&) {
+        TF_RUNTIME_ERROR(
+            "Failed to allocate buffer of %zu bytes for asset.", _size);
+        return nullptr;
+    }
+
+    if (Read(buffer.get(), _size, 0) != _size) {
+        return nullptr;
+    }
+    return buffer;
+}
+
+size_t
+ArBlockCachedAsset::Read(
+    void* buffer, size_t count, size_t offset) const
+{
+    if (count == 0 || offset + count > _size) {
+        return 0;
+    }
+
+    char* dest = static_cast<char*>(buffer);
+    size_t cur = offset;
+    const size_t end = offset + count;
+    while (cur != end) {
+        const size_t blockIndex = cur / _blockSize;
+        const size_t blockOffset = cur - (blockIndex * _blockSize);
+        const size_t numBytes = std::min(_blockSize - blockOffset, end - cur);
+        const char* block = _GetBlock(blockIndex);
+        if (!block) {
+            return 0;
+        }
+        memcpy(dest, block + blockOffset, numBytes);
+        dest += numBytes;
+        cur += numBytes;
+    }
+    return count;
+}
+
+std::pair<FILE*, size_t>
+ArBlockCachedAsset::GetFileUnsafe() const
+{
+    return { nullptr, 0 };
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
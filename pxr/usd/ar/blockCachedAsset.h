@@ -0,0 +1,107 @@
+//
+// Copyright 2022 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+#ifndef PXR_USD_AR_BLOCK_CACHED_ASSET_H
+#define PXR_USD_AR_BLOCK_CACHED_ASSET_H
+
+#include "pxr/pxr.h"
+#include "pxr/usd/ar/api.h"
+#include "pxr/usd/ar/asset.h"
+
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// \class ArBlockCachedAsset
+///
+/// ArAsset implementation that wraps another ArAsset and serves Read()
+/// calls from a cache of fixed-size blocks, fetching each block from the
+/// source asset at most once.
+///
+/// This is intended for source assets where each Read() is expensive --
+/// for example, an asset backed by ranged network requests.  Reads are
+/// widened to block granularity, so many small reads that land in the
+/// same region of the asset cost a single source fetch, while regions
+/// that are never read are never fetched.  Cached blocks are retained
+/// for the lifetime of this object.
+///
+/// All members are thread-safe.  Blocks are fetched from the source asset
+/// under per-block locks, so concurrent reads of distinct blocks proceed
+/// in parallel.
+class ArBlockCachedAsset
+    : public ArAsset
+{
+public:
+    /// Default block size for FromAsset, 512 KB.
+    static constexpr size_t DefaultBlockSize = 512 * 1024;
+
+    /// Constructs a new instance serving the contents of \p srcAsset from
+    /// a cache of \p blockSize byte blocks.
+    ///
+    /// Returns nullptr if \p srcAsset is invalid or \p blockSize is zero.
+    AR_API
+    static std::shared_ptr<ArBlockCachedAsset> FromAsset(
+        const std::shared_ptr<ArAsset>& srcAsset,
+        size_t blockSize = DefaultBlockSize);
+
+    AR_API
+    ~ArBlockCachedAsset() override;
+
+    /// Returns the size of the source asset.
+    AR_API
+    size_t GetSize() const override;
+
+    /// Returns a buffer with the entire contents of the asset, assembled
+    /// by reading every block through the cache.
+    AR_API
+    std::shared_ptr<const char> GetBuffer() const override;
+
+    /// Reads \p count bytes at \p offset into \p buffer from the cached
+    /// blocks, fetching any blocks in range that have not been fetched
+    /// from the source asset yet.  Returns the number of bytes read, or 0
+    /// if the range is out of bounds or a source fetch failed.
+    AR_API
+    size_t Read(void* buffer, size_t count, size_t offset) const override;
+
+    /// Returns { nullptr, 0 }.  The source asset's file handle, if any, is
+    /// deliberately not exposed, since reading from it would bypass the
+    /// cache.
+    AR_API
+    std::pair<FILE*, size_t> GetFileUnsafe() const override;
+
+private:
+    struct PrivateCtorTag {};
+public:
+    // "Private" c'tor. Must actually be public for std::make_shared,
+    // but the PrivateCtorTag prevents other code from using this.
+    ArBlockCachedAsset(
+        const std::shared_ptr<ArAsset>& srcAsset,
+        size_t blockSize,
+        PrivateCtorTag);
+
+private:
+    // Fetched lazily and at most once; data remains null if the source
+    // read failed.
+    struct _Block {
+        std::once_flag onceFlag;
+        std::unique_ptr<const char[]> data;
+    };
+
+    // Return the block at \p blockIndex, fetching it from the source
+    // asset if needed, or nullptr if the fetch failed.
+    const char* _GetBlock(size_t blockIndex) const;
+
+    std::shared_ptr<ArAsset> _srcAsset;
+    size_t _size;
+    size_t _blockSize;
+    std::unique_ptr<_Block[]> _blocks;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif
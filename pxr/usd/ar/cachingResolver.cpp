@@ -0,0 +1,396 @@
+//
+// Copyright 2026 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+#include "pxr/pxr.h"
+#include "pxr/usd/ar/cachingResolver.h"
+
+#include "pxr/usd/ar/asset.h"
+#include "pxr/usd/ar/assetInfo.h"
+#include "pxr/usd/ar/filesystemAsset.h"
+#include "pxr/usd/ar/resolverContext.h"
+#include "pxr/usd/ar/timestamp.h"
+#include "pxr/usd/ar/writableAsset.h"
+
+#include "pxr/base/arch/fileSystem.h"
+#include "pxr/base/arch/hash.h"
+#include "pxr/base/tf/diagnostic.h"
+#include "pxr/base/tf/envSetting.h"
+#include "pxr/base/tf/errorMark.h"
+#include "pxr/base/tf/fileUtils.h"
+#include "pxr/base/tf/registryManager.h"
+#include "pxr/base/tf/safeOutputFile.h"
+#include "pxr/base/tf/stringUtils.h"
+#include "pxr/base/tf/type.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <ctime>
+#include <utility>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+TF_DEFINE_ENV_SETTING(
+    PXR_AR_DISK_CACHE_PATH, "",
+    "Directory used by ArCachingResolver to cache asset content on local "
+    "disk. If empty, caching is disabled.");
+
+TF_DEFINE_ENV_SETTING(
+    PXR_AR_DISK_CACHE_MAX_MB, 4096,
+    "Approximate size limit of the ArCachingResolver disk cache in "
+    "megabytes. Least-recently-populated entries are evicted first.");
+
+TF_DEFINE_ENV_SETTING(
+    PXR_AR_DISK_CACHE_TTL_SECONDS, 0,
+    "If greater than zero, ArCachingResolver disk cache entries older than "
+    "this many seconds are evicted regardless of the cache size.");
+
+TF_REGISTRY_FUNCTION(TfType)
+{
+    TfType::Define<ArCachingResolver, TfType::Bases<ArResolver>>();
+}
+
+ArCachingResolver::ArCachingResolver(std::unique_ptr<ArResolver> underlying)
+    : _underlying(std::move(underlying))
+{
+    if (!_underlying) {
+        TF_CODING_ERROR("ArCachingResolver requires an underlying resolver");
+    }
+}
+
+ArCachingResolver::~ArCachingResolver() = default;
+
+/* static */
+const std::string&
+ArCachingResolver::GetCachePath()
+{
+    static const std::string cachePath =
+        TfGetEnvSetting(PXR_AR_DISK_CACHE_PATH);
+    return cachePath;
+}
+
+std::string
+ArCachingResolver::_CreateIdentifier(
+    const std::string& assetPath,
+    const ArResolvedPath& anchorAssetPath) const
+{
+    return _underlying->CreateIdentifier(assetPath, anchorAssetPath);
+}
+
+std::string
+ArCachingResolver::_CreateIdentifierForNewAsset(
+    const std::string& assetPath,
+    const ArResolvedPath& anchorAssetPath) const
+{
+    return _underlying->CreateIdentifierForNewAsset(
+        assetPath, anchorAssetPath);
+}
+
+ArResolvedPath
+ArCachingResolver::_Resolve(
+    const std::string& assetPath) const
+{
+    return _underlying->Resolve(assetPath);
+}
+
+ArResolvedPath
+ArCachingResolver::_ResolveForNewAsset(
+    const std::string& assetPath) const
+{
+    return _underlying->ResolveForNewAsset(assetPath);
+}
+
+std::vector<ArResolvedPath>
+ArCachingResolver::_ResolveBatch(
+    const std::vector<std::string>& assetPaths) const
+{
+    return _underlying->ResolveBatch(assetPaths);
+}
+
+void
+ArCachingResolver::_BindContext(
+    const ArResolverContext& context,
+    VtValue* bindingData)
+{
+    _underlying->BindContext(context, bindingData);
+}
+
+void
+ArCachingResolver::_UnbindContext(
+    const ArResolverContext& context,
+    VtValue* bindingData)
+{
+    _underlying->UnbindContext(context, bindingData);
+}
+
+ArResolverContext
+ArCachingResolver::_CreateDefaultContext() const
+{
+    return _underlying->CreateDefaultContext();
+}
+
+ArResolverContext
+ArCachingResolver::_CreateDefaultContextForAsset(
+    const std::string& assetPath) const
+{
+    return _underlying->CreateDefaultContextForAsset(assetPath);
+}
+
+ArResolverContext
+ArCachingResolver::_CreateContextFromString(
+    const std::string& contextStr) const
+{
+    return _underlying->CreateContextFromString(contextStr);
+}
+
+void
+ArCachingResolver::_RefreshContext(
+    const ArResolverContext& context)
+{
+    _underlying->RefreshContext(context);
+}
+
+ArResolverContext
+ArCachingResolver::_GetCurrentContext() const
+{
+    return _underlying->GetCurrentContext();
+}
+
+bool
+ArCachingResolver::_IsContextDependentPath(
+    const std::string& assetPath) const
+{
+    return _underlying->IsContextDependentPath(assetPath);
+}
+
+std::string
+ArCachingResolver::_GetExtension(
+    const std::string& assetPath) const
+{
+    return _underlying->GetExtension(assetPath);
+}
+
+ArAssetInfo
+ArCachingResolver::_GetAssetInfo(
+    const std::string& assetPath,
+    const ArResolvedPath& resolvedPath) const
+{
+    return _underlying->GetAssetInfo(assetPath, resolvedPath);
+}
+
+ArTimestamp
+ArCachingResolver::_GetModificationTimestamp(
+    const std::string& assetPath,
+    const ArResolvedPath& resolvedPath) const
+{
+    return _underlying->GetModificationTimestamp(assetPath, resolvedPath);
+}
+
+std::shared_ptr<ArAsset>
+ArCachingResolver::_OpenAsset(
+    const ArResolvedPath& resolvedPath) const
+{
+    const std::string cacheFilePath = _GetCacheFilePath(resolvedPath);
+    if (cacheFilePath.empty()) {
+        return _underlying->OpenAsset(resolvedPath);
+    }
+
+    std::call_once(_evictionOnceFlag,
+                   [this]() { _EvictCacheEntries(); });
+
+    if (TfIsFile(cacheFilePath)) {
+        if (std::shared_ptr<ArAsset> asset = ArFilesystemAsset::Open(
+                ArResolvedPath(cacheFilePath))) {
+            return asset;
+        }
+    }
+
+    std::shared_ptr<ArAsset> asset = _underlying->OpenAsset(resolvedPath);
+    if (asset) {
+        // Serve this open from the asset we already have in hand; later
+        // opens in this process and others will hit the cache file.
+        _PopulateCacheFile(asset, cacheFilePath);
+    }
+    return asset;
+}
+
+bool
+ArCachingResolver::_CanWriteAssetToPath(
+    const ArResolvedPath& resolvedPath,
+    std::string* whyNot) const
+{
+    return _underlying->CanWriteAssetToPath(resolvedPath, whyNot);
+}
+
+std::shared_ptr<ArWritableAsset>
+ArCachingResolver::_OpenAssetForWrite(
+    const ArResolvedPath& resolvedPath,
+    WriteMode writeMode) const
+{
+    return _underlying->OpenAssetForWrite(resolvedPath, writeMode);
+}
+
+void
+ArCachingResolver::_BeginCacheScope(
+    VtValue* cacheScopeData)
+{
+    _underlying->BeginCacheScope(cacheScopeData);
+}
+
+void
+ArCachingResolver::_EndCacheScope(
+    VtValue* cacheScopeData)
+{
+    _underlying->EndCacheScope(cacheScopeData);
+}
+
+bool
+ArCachingResolver::_IsRepositoryPath(
+    const std::string& path) const
+{
+    return _underlying->IsRepositoryPath(path);
+}
+
+std::string
+ArCachingResolver::_GetCacheFilePath(
+    const ArResolvedPath& resolvedPath) const
+{
+    const std::string& cachePath = GetCachePath();
+    if (cachePath.empty() || !resolvedPath) {
+        return std::string();
+    }
+
+    // Assets that already live on the local filesystem gain nothing from
+    // being copied into the cache.
+    const std::string& path = resolvedPath.GetPathString();
+    if (TfIsFile(path)) {
+        return std::string();
+    }
+
+    // Key the entry on the resolved path and the asset's version so that
+    // an updated asset is fetched anew rather than served stale.
+    const uint64_t pathHash = ArchHash64(path.c_str(), path.size());
+
+    uint64_t versionHash = 0;
+    const ArTimestamp timestamp =
+        _underlying->GetModificationTimestamp(path, resolvedPath);
+    if (timestamp.IsValid()) {
+        const double time = timestamp.GetTime();
+        versionHash = ArchHash64(
+            reinterpret_cast<const char*>(&time), sizeof(time));
+    }
+
+    // Fan entries out into 256 subdirectories to keep directory sizes
+    // reasonable for large caches.
+    return TfStringPrintf(
+        "%s/%02x/%016" PRIx64 "-%016" PRIx64 ".arcache",
+        cachePath.c_str(), static_cast<unsigned>(pathHash >> 56),
+        pathHash, versionHash);
+}
+
+bool
+ArCachingResolver::_PopulateCacheFile(
+    const std::shared_ptr<ArAsset>& asset,
+    const std::string& cacheFilePath) const
+{
+    std::shared_ptr<const char> buffer = asset->GetBuffer();
+    if (!buffer) {
+        return false;
+    }
+
+    if (!TfMakeDirs(TfGetPathName(cacheFilePath), -1, /* existOk = */ true)) {
+        return false;
+    }
+
+    // TfSafeOutputFile writes to a temporary file in the destination
+    // directory and renames it over the target on Close, so concurrent
+    // readers and writers never observe partial content.
+    TfErrorMark m;
+    TfSafeOutputFile cacheFile = TfSafeOutputFile::Replace(cacheFilePath);
+    if (!m.IsClean() || !cacheFile.Get()) {
+        m.Clear();
+        return false;
+    }
+
+    const size_t size = asset->GetSize();
+    if (fwrite(buffer.get(), 1, size, cacheFile.Get()) != size) {
+        cacheFile.Discard();
+        return false;
+    }
+
+    cacheFile.Close();
+    if (!m.IsClean()) {
+        m.Clear();
+        return false;
+    }
+    return true;
+}
+
+void
+ArCachingResolver::_EvictCacheEntries() const
+{
+    const std::string& cachePath = GetCachePath();
+
+    const int64_t maxCacheBytes =
+        int64_t(TfGetEnvSetting(PXR_AR_DISK_CACHE_MAX_MB)) * 1024 * 1024;
+    const int ttlSeconds = TfGetEnvSetting(PXR_AR_DISK_CACHE_TTL_SECONDS);
+    const double now = double(time(nullptr));
+
+    // Gather cache entries with their population time and size.
+    struct _Entry {
+        std::string path;
+        double mtime;
+        int64_t size;
+    };
+    std::vector<_Entry> entries;
+    int64_t totalBytes = 0;
+
+    for (const std::string& path :
+             TfListDir(cachePath, /* recursive = */ true)) {
+        if (!TfStringEndsWith(path, ".arcache")) {
+            continue;
+        }
+
+        double mtime = 0;
+        if (!ArchGetModificationTime(path.c_str(), &mtime)) {
+            continue;
+        }
+
+        if (ttlSeconds > 0 && now - mtime > double(ttlSeconds)) {
+            TfDeleteFile(path);
+            continue;
+        }
+
+        const int64_t size = ArchGetFileLength(path.c_str());
+        if (size < 0) {
+            continue;
+        }
+
+        entries.push_back({path, mtime, size});
+        totalBytes += size;
+    }
+
+    if (totalBytes <= maxCacheBytes) {
+        return;
+    }
+
+    // Evict least-recently-populated entries until under the size limit.
+    std::sort(entries.begin(), entries.end(),
+              [](const _Entry& a, const _Entry& b) {
+                  return a.mtime < b.mtime;
+              });
+
+    for (const _Entry& entry : entries) {
+        if (totalBytes <= maxCacheBytes) {
+            break;
+        }
+        if (TfDeleteFile(entry.path)) {
+            totalBytes -= entry.size;
+        }
+    }
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,196 @@
+//
+// Copyright 2026 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+#ifndef PXR_USD_AR_CACHING_RESOLVER_H
+#define PXR_USD_AR_CACHING_RESOLVER_H
+
+/// \file ar/cachingResolver.h
+
+#include "pxr/pxr.h"
+#include "pxr/usd/ar/api.h"
+#include "pxr/usd/ar/resolvedPath.h"
+#include "pxr/usd/ar/resolver.h"
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// \class ArCachingResolver
+///
+/// An ArResolver that wraps another ArResolver implementation and caches
+/// the content of opened assets in a local on-disk cache.
+///
+/// All operations are forwarded to the underlying resolver. When an asset
+/// is opened and its resolved path does not refer to a local file, the
+/// asset's content is additionally written into a cache directory keyed by
+/// the resolved path and the asset's modification timestamp; subsequent
+/// opens of the same version of the asset, including opens from other
+/// processes sharing the cache directory, are served from the cached file
+/// via memory-mapped ArFilesystemAsset reads without consulting the
+/// underlying resolver's data source. Cache files are populated atomically
+/// so concurrent processes never observe partial content.
+///
+/// A resolver implementation is composed with the cache by deriving a
+/// registered resolver from this class and passing the wrapped resolver
+/// to the ArCachingResolver constructor:
+///
+/// \code
+/// class MyCachedResolver : public ArCachingResolver {
+/// public:
+///     MyCachedResolver() : ArCachingResolver(
+///         ArCreateResolver(TfType::FindByName("MyResolver"))) { }
+/// };
+/// AR_DEFINE_RESOLVER(MyCachedResolver, ArCachingResolver)
+/// \endcode
+///
+/// The cache is configured by environment variables:
+///
+///    - PXR_AR_DISK_CACHE_PATH: the cache directory. If empty (the
+///      default), caching is disabled and this class is a pass-through.
+///    - PXR_AR_DISK_CACHE_MAX_MB: approximate cache size limit in
+///      megabytes. Least-recently-populated entries are evicted first.
+///    - PXR_AR_DISK_CACHE_TTL_SECONDS: if greater than zero, entries
+///      older than this many seconds are evicted regardless of size.
+///
+/// Eviction runs once per process on first use of the cache.
+class ArCachingResolver
+    : public ArResolver
+{
+public:
+    /// Constructs a resolver that forwards all operations to
+    /// \p underlying and caches opened asset content on disk.
+    AR_API
+    explicit ArCachingResolver(std::unique_ptr<ArResolver> underlying);
+
+    AR_API
+    virtual ~ArCachingResolver();
+
+    /// Returns the cache directory, or an empty string if caching is
+    /// disabled.
+    AR_API
+    static const std::string& GetCachePath();
+
+protected:
+    AR_API
+    std::string _CreateIdentifier(
+        const std::string& assetPath,
+        const ArResolvedPath& anchorAssetPath) const override;
+
+    AR_API
+    std::string _CreateIdentifierForNewAsset(
+        const std::string& assetPath,
+        const ArResolvedPath& anchorAssetPath) const override;
+
+    AR_API
+    ArResolvedPath _Resolve(
+        const std::string& assetPath) const override;
+
+    AR_API
+    ArResolvedPath _ResolveForNewAsset(
+        const std::string& assetPath) const override;
+
+    AR_API
+    std::vector<ArResolvedPath> _ResolveBatch(
+        const std::vector<std::string>& assetPaths) const override;
+
+    AR_API
+    void _BindContext(
+        const ArResolverContext& context,
+        VtValue* bindingData) override;
+
+    AR_API
+    void _UnbindContext(
+        const ArResolverContext& context,
+        VtValue* bindingData) override;
+
+    AR_API
+    ArResolverContext _CreateDefaultContext() const override;
+
+    AR_API
+    ArResolverContext _CreateDefaultContextForAsset(
+        const std::string& assetPath) const override;
+
+    AR_API
+    ArResolverContext _CreateContextFromString(
+        const std::string& contextStr) const override;
+
+    AR_API
+    void _RefreshContext(
+        const ArResolverContext& context) override;
+
+    AR_API
+    ArResolverContext _GetCurrentContext() const override;
+
+    AR_API
+    bool _IsContextDependentPath(
+        const std::string& assetPath) const override;
+
+    AR_API
+    std::string _GetExtension(
+        const std::string& assetPath) const override;
+
+    AR_API
+    ArAssetInfo _GetAssetInfo(
+        const std::string& assetPath,
+        const ArResolvedPath& resolvedPath) const override;
+
+    AR_API
+    ArTimestamp _GetModificationTimestamp(
+        const std::string& assetPath,
+        const ArResolvedPath& resolvedPath) const override;
+
+    /// Opens the asset at \p resolvedPath, serving and populating the
+    /// disk cache as described in the class documentation.
+    AR_API
+    std::shared_ptr<ArAsset> _OpenAsset(
+        const ArResolvedPath& resolvedPath) const override;
+
+    AR_API
+    bool _CanWriteAssetToPath(
+        const ArResolvedPath& resolvedPath,
+        std::string* whyNot) const override;
+
+    AR_API
+    std::shared_ptr<ArWritableAsset> _OpenAssetForWrite(
+        const ArResolvedPath& resolvedPath,
+        WriteMode writeMode) const override;
+
+    AR_API
+    void _BeginCacheScope(
+        VtValue* cacheScopeData) override;
+
+    AR_API
+    void _EndCacheScope(
+        VtValue* cacheScopeData) override;
+
+    AR_API
+    bool _IsRepositoryPath(
+        const std::string& path) const override;
+
+private:
+    // Returns the cache file path for the given resolved path, or an
+    // empty string if the asset should not be cached.
+    std::string _GetCacheFilePath(const ArResolvedPath& resolvedPath) const;
+
+    // Writes the content of the given asset to cacheFilePath, replacing
+    // any existing file atomically.
+    bool _PopulateCacheFile(
+        const std::shared_ptr<ArAsset>& asset,
+        const std::string& cacheFilePath) const;
+
+    // Removes expired and excess cache entries.
+    void _EvictCacheEntries() const;
+
+    std::unique_ptr<ArResolver> _underlying;
+    mutable std::once_flag _evictionOnceFlag;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // PXR_USD_AR_CACHING_RESOLVER_H
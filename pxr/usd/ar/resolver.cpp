@@ -7,6 +7,7 @@
 #include "pxr/pxr.h"
 #include "pxr/usd/ar/asset.h"
 #include "pxr/usd/ar/assetInfo.h"
+#include "pxr/usd/ar/cachingResolver.h"
 #include "pxr/usd/ar/debugCodes.h"
 #include "pxr/usd/ar/defaultResolver.h"
 #include "pxr/usd/ar/definePackageResolver.h"
@@ -15,6 +16,7 @@
 #include "pxr/usd/ar/packageUtils.h"
 #include "pxr/usd/ar/resolvedPath.h"
 #include "pxr/usd/ar/resolver.h"
+#include "pxr/usd/ar/resolverContextBinder.h"
 #include "pxr/usd/ar/threadLocalScopedCache.h"
 
 #include "pxr/base/vt/value.h"
@@ -34,6 +36,10 @@
 #include "pxr/base/tf/type.h"
 #include "pxr/base/tf/unicodeUtils.h"
 
+#include "pxr/base/work/detachedTask.h"
+#include "pxr/base/work/loops.h"
+#include "pxr/base/work/withScopedParallelism.h"
+
 #include <tbb/concurrent_hash_map.h>
 
 #include <memory>
@@ -234,7 +240,15 @@ _GetAvailableResolvers()
     resolvers.reserve(sortedResolverTypes.size());
 
     // Fill in the URI/IRI schemes associated with each available resolver.
+    const TfType cachingResolverType = TfType::Find<ArCachingResolver>();
     for (const TfType& resolverType : sortedResolverTypes) {
+        // ArCachingResolver is a base class for resolver implementations
+        // and cannot be instantiated directly; only its subclasses are
+        // available resolvers.
+        if (resolverType == cachingResolverType) {
+            continue;
+        }
+
         const PlugPluginPtr plugin = _GetPluginForType(resolverType);
         if (!plugin) {
             continue;
@@ -1541,6 +1555,52 @@ ArResolver::ResolveForNewAsset(
     return _ResolveForNewAsset(assetPath);
 }
 
+std::vector<ArResolvedPath>
+ArResolver::ResolveBatch(
+    const std::vector<std::string>& assetPaths) const
+{
+    return _ResolveBatch(assetPaths);
+}
+
+std::future<ArResolvedPath>
+ArResolver::ResolveAsync(
+    const std::string& assetPath) const
+{
+    // Context bindings are thread-specific, so capture the caller's bound
+    // context and rebind it on whatever thread services the request.  The
+    // promise is held by shared_ptr because the task must be copyable.
+    auto promise = std::make_shared<std::promise<ArResolvedPath>>();
+    std::future<ArResolvedPath> future = promise->get_future();
+    WorkRunDetachedTask(
+        [this, assetPath, context = GetCurrentContext(), promise]() {
+            ArResolverContextBinder binder(context);
+            promise->set_value(Resolve(assetPath));
+        });
+    return future;
+}
+
+std::vector<ArResolvedPath>
+ArResolver::_ResolveBatch(
+    const std::vector<std::string>& assetPaths) const
+{
+    std::vector<ArResolvedPath> result(assetPaths.size());
+    const ArResolverContext context = GetCurrentContext();
+    WorkWithScopedParallelism([&]() {
+        // Use a grain size of 1 since each resolve may block on I/O; the
+        // point of the batch API is to overlap those round trips.
+        WorkParallelForN(
+            assetPaths.size(),
+            [this, &assetPaths, &result, &context](size_t begin, size_t end) {
+                ArResolverContextBinder binder(context);
+                for (size_t i = begin; i != end; ++i) {
+                    result[i] = Resolve(assetPaths[i]);
+                }
+            },
+            /*grainSize=*/1);
+    });
+    return result;
+}
+
 void
 ArResolver::BindContext(
     const ArResolverContext& context,
@@ -16,6 +16,7 @@
 #include "pxr/usd/ar/resolverContext.h"
 #include "pxr/usd/ar/timestamp.h"
 
+#include <future>
 #include <memory>
 #include <string>
 #include <vector>
@@ -114,6 +115,28 @@ public:
     ArResolvedPath ResolveForNewAsset(
         const std::string& assetPath) const;
 
+    /// Resolves every path in \p assetPaths, returning the resolved paths
+    /// in the corresponding elements of the returned vector.
+    ///
+    /// The paths are resolved with the context that is bound when this
+    /// function is called.  The default implementation resolves the paths
+    /// concurrently, so resolver implementations that block on I/O (e.g.
+    /// network round trips) have their requests overlapped; implementations
+    /// that can service many paths in a single round trip may override
+    /// _ResolveBatch to do so.
+    AR_API
+    std::vector<ArResolvedPath> ResolveBatch(
+        const std::vector<std::string>& assetPaths) const;
+
+    /// Begins resolving the asset identified by \p assetPath without
+    /// blocking and returns a future that yields the resolved path.
+    ///
+    /// The path is resolved with the context that is bound when this
+    /// function is called, regardless of which thread services the request.
+    AR_API
+    std::future<ArResolvedPath> ResolveAsync(
+        const std::string& assetPath) const;
+
     /// @}
 
     // --------------------------------------------------------------------- //
@@ -483,6 +506,17 @@ protected:
     virtual ArResolvedPath _ResolveForNewAsset(
         const std::string& assetPath) const = 0;
 
+    /// Return the resolved paths for all paths in \p assetPaths.
+    ///
+    /// The default implementation invokes Resolve on each path concurrently,
+    /// binding the context that is bound when this function is called on
+    /// each thread that resolves paths.  Implementations that can resolve
+    /// many paths more efficiently than one call at a time (e.g. in a single
+    /// request to a remote service) may override this function.
+    AR_API
+    virtual std::vector<ArResolvedPath> _ResolveBatch(
+        const std::vector<std::string>& assetPaths) const;
+
     /// @}
 
     // --------------------------------------------------------------------- //
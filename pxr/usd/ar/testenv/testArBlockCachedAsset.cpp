@@ -0,0 +1,176 @@
+//
+// Copyright 2023 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+#include "pxr/pxr.h"
+
+#include "pxr/usd/ar/asset.h"
+#include "pxr/usd/ar/blockCachedAsset.h"
+#include "pxr/base/tf/diagnostic.h"
+#include "pxr/base/tf/errorMark.h"
+
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE;
+
+// Asset implementation that counts every Read issued against it, so the
+// tests can verify that ArBlockCachedAsset fetches each block at most once.
+class _CountingAsset
+    : public ArAsset
+{
+public:
+    explicit _CountingAsset(std::string contents)
+        : _contents(std::move(contents))
+    {
+    }
+
+    size_t GetSize() const override
+    {
+        return _contents.size();
+    }
+
+    std::shared_ptr<const char> GetBuffer() const override
+    {
+        return { _contents.data(), [](const char*) {} };
+    }
+
+    size_t Read(void* buffer, size_t count, size_t offset) const override
+    {
+        ++numReads;
+        if (offset + count > _contents.size()) {
+            return 0;
+        }
+        memcpy(buffer, _contents.data() + offset, count);
+        return count;
+    }
+
+    std::pair<FILE*, size_t> GetFileUnsafe() const override
+    {
+        return { nullptr, 0 };
+    }
+
+    mutable std::atomic<size_t> numReads { 0 };
+
+private:
+    std::string _contents;
+};
+
+static std::string
+_MakeContents(size_t numBytes)
+{
+    std::string contents;
+    contents.reserve(numBytes);
+    for (size_t i = 0; i != numBytes; ++i) {
+        contents.push_back(static_cast<char>('A' + (i % 23)));
+    }
+    return contents;
+}
+
+static void
+TestReads()
+{
+    const size_t blockSize = 64;
+    const std::string contents = _MakeContents(10 * blockSize + 17);
+    auto srcAsset = std::make_shared<_CountingAsset>(contents);
+    auto asset = ArBlockCachedAsset::FromAsset(srcAsset, blockSize);
+    TF_AXIOM(asset);
+    TF_AXIOM(asset->GetSize() == contents.size());
+    TF_AXIOM(asset->GetFileUnsafe().first == nullptr);
+
+    // A small read fetches exactly one block from the source.
+    char buf[256];
+    TF_AXIOM(asset->Read(buf, 16, 8) == 16);
+    TF_AXIOM(memcmp(buf, contents.data() + 8, 16) == 0);
+    TF_AXIOM(srcAsset->numReads == 1);
+
+    // Repeated reads in the same block are served from the cache.
+    TF_AXIOM(asset->Read(buf, 32, 0) == 32);
+    TF_AXIOM(memcmp(buf, contents.data(), 32) == 0);
+    TF_AXIOM(srcAsset->numReads == 1);
+
+    // A read spanning a block boundary fetches only the uncached block.
+    TF_AXIOM(asset->Read(buf, blockSize, blockSize / 2) == blockSize);
+    TF_AXIOM(memcmp(buf, contents.data() + blockSize / 2, blockSize) == 0);
+    TF_AXIOM(srcAsset->numReads == 2);
+
+    // A read into the short final block stops at the asset's size.
+    const size_t tailOffset = 10 * blockSize;
+    TF_AXIOM(asset->Read(buf, 17, tailOffset) == 17);
+    TF_AXIOM(memcmp(buf, contents.data() + tailOffset, 17) == 0);
+    TF_AXIOM(srcAsset->numReads == 3);
+
+    // Out-of-bounds reads fail without touching the source.
+    TF_AXIOM(asset->Read(buf, 18, tailOffset) == 0);
+    TF_AXIOM(asset->Read(buf, 1, contents.size()) == 0);
+    TF_AXIOM(srcAsset->numReads == 3);
+
+    // GetBuffer assembles the whole asset; every block is fetched exactly
+    // once across all of the reads above and this one.
+    std::shared_ptr<const char> buffer = asset->GetBuffer();
+    TF_AXIOM(buffer);
+    TF_AXIOM(memcmp(buffer.get(), contents.data(), contents.size()) == 0);
+    TF_AXIOM(srcAsset->numReads == 11);
+}
+
+static void
+TestConcurrentReads()
+{
+    const size_t blockSize = 64;
+    const std::string contents = _MakeContents(64 * blockSize);
+    auto srcAsset = std::make_shared<_CountingAsset>(contents);
+    auto asset = ArBlockCachedAsset::FromAsset(srcAsset, blockSize);
+    TF_AXIOM(asset);
+
+    // Many threads reading overlapping ranges still fetch each block from
+    // the source exactly once.
+    std::vector<std::thread> threads;
+    std::atomic<bool> failed { false };
+    for (size_t t = 0; t != 8; ++t) {
+        threads.emplace_back([&asset, &contents, &failed, t]() {
+            std::string buf(contents.size(), '\0');
+            const size_t offset = t * 32;
+            const size_t count = contents.size() - offset;
+            if (asset->Read(&buf[0], count, offset) != count ||
+                memcmp(buf.data(), contents.data() + offset, count) != 0) {
+                failed = true;
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    TF_AXIOM(!failed);
+    TF_AXIOM(srcAsset->numReads == 64);
+}
+
+static void
+TestInvalidArguments()
+{
+    TfErrorMark m;
+    TF_AXIOM(!ArBlockCachedAsset::FromAsset(nullptr));
+    TF_AXIOM(!m.IsClean());
+    m.Clear();
+
+    auto srcAsset = std::make_shared<_CountingAsset>(_MakeContents(16));
+    TF_AXIOM(!ArBlockCachedAsset::FromAsset(srcAsset, 0));
+    TF_AXIOM(!m.IsClean());
+    m.Clear();
+}
+
+int
+main(int argc, char** argv)
+{
+    TestReads();
+    TestConcurrentReads();
+    TestInvalidArguments();
+
+    printf("Passed!\n");
+    return 0;
+}
@@ -0,0 +1,129 @@
+//
+// Copyright 2026 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+#include "pxr/pxr.h"
+
+#include "pxr/usd/ar/defaultResolverContext.h"
+#include "pxr/usd/ar/resolvedPath.h"
+#include "pxr/usd/ar/resolver.h"
+#include "pxr/usd/ar/resolverContextBinder.h"
+#include "pxr/base/tf/diagnostic.h"
+#include "pxr/base/tf/fileUtils.h"
+#include "pxr/base/tf/stringUtils.h"
+#include "pxr/base/arch/systemInfo.h"
+
+#include <fstream>
+#include <future>
+#include <string>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE;
+
+static void
+_WriteFile(const std::string &path)
+{
+    std::ofstream f(path);
+    f << "Test file generated by testArResolveBatch\n";
+    TF_AXIOM(f.good());
+}
+
+static void
+TestResolveBatch()
+{
+    ArResolver &resolver = ArGetResolver();
+
+    // An empty batch yields an empty result.
+    TF_AXIOM(resolver.ResolveBatch({}).empty());
+
+    // Resolve a batch mixing existing and nonexistent assets; every
+    // element must match what a serial Resolve returns.
+    std::vector<std::string> paths;
+    for (size_t i = 0; i != 64; ++i) {
+        const std::string path = TfStringPrintf("batchAsset_%zu.txt", i);
+        if (i % 2 == 0) {
+            _WriteFile(path);
+        }
+        paths.push_back(path);
+    }
+
+    const std::vector<ArResolvedPath> resolved = resolver.ResolveBatch(paths);
+    TF_AXIOM(resolved.size() == paths.size());
+    for (size_t i = 0; i != paths.size(); ++i) {
+        TF_AXIOM(resolved[i] == resolver.Resolve(paths[i]));
+        TF_AXIOM(static_cast<bool>(resolved[i]) == (i % 2 == 0));
+    }
+}
+
+static void
+TestResolveAsync()
+{
+    ArResolver &resolver = ArGetResolver();
+
+    _WriteFile("asyncAsset.txt");
+
+    // An existing asset resolves to the same path as a serial Resolve.
+    TF_AXIOM(resolver.ResolveAsync("asyncAsset.txt").get() ==
+             resolver.Resolve("asyncAsset.txt"));
+
+    // A nonexistent asset yields an empty resolved path.
+    TF_AXIOM(!resolver.ResolveAsync("noSuchAsset.txt").get());
+
+    // Several requests may be in flight at once.
+    std::vector<std::future<ArResolvedPath>> futures;
+    for (size_t i = 0; i != 16; ++i) {
+        futures.push_back(resolver.ResolveAsync("asyncAsset.txt"));
+    }
+    const ArResolvedPath expected = resolver.Resolve("asyncAsset.txt");
+    for (std::future<ArResolvedPath> &future : futures) {
+        TF_AXIOM(future.get() == expected);
+    }
+}
+
+static void
+TestAsyncContextCapture()
+{
+    ArResolver &resolver = ArGetResolver();
+
+    // The asset is only findable through a search path supplied by a
+    // bound context.
+    TF_AXIOM(TfMakeDirs("searchDir", -1, /* exists_ok = */ true));
+    _WriteFile("searchDir/inSearch.txt");
+    TF_AXIOM(!resolver.Resolve("inSearch.txt"));
+
+    const ArDefaultResolverContext context(
+        { ArchGetCwd() + "/searchDir" });
+
+    // A request begun while the context is bound must be serviced with
+    // that context, no matter which thread runs it or when it completes.
+    ArResolvedPath serial;
+    std::future<ArResolvedPath> future;
+    {
+        ArResolverContextBinder binder(context);
+        serial = resolver.Resolve("inSearch.txt");
+        future = resolver.ResolveAsync("inSearch.txt");
+    }
+    TF_AXIOM(serial);
+    TF_AXIOM(future.get() == serial);
+}
+
+int
+main(int argc, char **argv)
+{
+    ArSetPreferredResolver("ArDefaultResolver");
+
+    printf("TestResolveBatch...\n");
+    TestResolveBatch();
+
+    printf("TestResolveAsync...\n");
+    TestResolveAsync();
+
+    printf("TestAsyncContextCapture...\n");
+    TestAsyncContextCapture();
+
+    printf("Passed!\n");
+
+    return EXIT_SUCCESS;
+}
@@ -11,6 +11,7 @@
 #include "pxr/base/tf/pathUtils.h"
 #include "pxr/base/tf/pxrCLI11/CLI11.h"
 #include "pxr/base/tf/stringUtils.h"
+#include "pxr/base/work/loops.h"
 #include "pxr/usd/sdf/fileFormat.h"
 #include "pxr/usd/sdf/layer.h"
 #include "pxr/usd/usd/stage.h"
@@ -19,8 +20,10 @@
 #include "pxr/usd/usdUtils/authoring.h"
 #include "pxr/usd/usdUtils/flattenLayerStack.h"
 
+#include <atomic>
 #include <iomanip>
 #include <iostream>
+#include <map>
 #include <vector>
 #include <string>
 
@@ -33,6 +36,8 @@ struct Args {
     std::string output;
     std::string usdFormat;
     std::string mask;
+    std::string batchDir;
+    std::string batchFormat = "usdc";
     bool loadOnly = false;
     bool flatten = false;
     bool flattenLayerStack = false;
@@ -99,6 +104,23 @@ static void Configure(CLI::App *app, Args &args) {
         "Load only layer metadata in the USD file.\n"
         "This option cannot be combined with either --flatten or\n"
         "--flattenLayerStack.");
+
+    app->add_option(
+        "--batch", args.batchDir,
+        "Convert all input files in parallel within this process,\n"
+        "writing each one to this directory under its own base name\n"
+        "with the extension given by --batchFormat. Unless --flatten\n"
+        "or --flattenLayerStack is specified, each input is written\n"
+        "through as a single layer without composing a stage. Cannot\n"
+        "be combined with -o/--out or --loadOnly.")
+        ->option_text("dir");
+
+    app->add_option(
+        "--batchFormat", args.batchFormat,
+        "The file format to write batch outputs in; defaults to 'usdc'.\n"
+        "Only used with --batch.")
+        ->check(CLI::IsMember({"usda", "usdc"}, CLI::ignore_case))
+        ->option_text("usda|usdc");
 }
 
 static void Quarantine(const std::string &filepath) {
@@ -117,6 +139,131 @@ static void Quarantine(const std::string &filepath) {
     std::cerr << "Possibly corrupt output file renamed to " << newName << "\n";
 }
 
+// Opens one input as either a layer or a stage, depending on the flatten
+// options. On failure, neither output is set and an error will have been
+// emitted to the caller's TfErrorMark.
+static void OpenInput(
+    const Args &args,
+    const std::string &input,
+    SdfLayerRefPtr *layer,
+    UsdStageRefPtr *stage) {
+    if (args.flatten) {
+        if (args.mask.empty()) {
+            *stage = UsdStage::Open(input);
+        } else {
+            // Mask can be provided as a comma or space delimited string
+            auto mask = UsdStagePopulationMask();
+            for (const auto &path : TfStringTokenize(args.mask, ", ")) {
+                mask.Add(SdfPath(path));
+            }
+            *stage = UsdStage::OpenMasked(input, mask);
+        }
+    } else if (args.flattenLayerStack) {
+        *stage = UsdStage::Open(input, UsdStage::LoadNone);
+        if (*stage) {
+            *layer = UsdUtilsFlattenLayerStack(*stage);
+        }
+    } else if (args.layerMetadata) {
+        auto srcLayer = SdfLayer::OpenAsAnonymous(
+            input, /* metadataOnly = */ true);
+        // Not all file format plugins support metadata-only parsing.
+        // Create a new anonymous layer and copy just the layer metadata.
+        *layer = SdfLayer::CreateAnonymous(".usda");
+        UsdUtilsCopyLayerMetadata(srcLayer, *layer);
+    } else {
+        *layer = SdfLayer::FindOrOpen(input);
+    }
+}
+
+static int UsdCatBatch(const Args &args) {
+    if (!TfIsDir(args.batchDir) && !TfMakeDirs(args.batchDir)) {
+        std::cerr << "error: could not create batch output directory "
+                  << std::quoted(args.batchDir, '\'') << "\n";
+        return 1;
+    }
+
+    // Compute the output path for each input up front so basename
+    // collisions are reported before any conversion work begins.
+    const std::string batchFormat = TfStringToLowerAscii(args.batchFormat);
+    std::vector<std::string> outputFiles;
+    outputFiles.reserve(args.inputFiles.size());
+    std::map<std::string, std::string> seenBasenames;
+    for (const auto &input : args.inputFiles) {
+        std::string basename = TfGetBaseName(input);
+        const std::string ext = TfGetExtension(basename);
+        if (ext.empty()) {
+            basename += ".";
+        } else {
+            basename = basename.substr(0, basename.size() - ext.size());
+        }
+        const auto inserted = seenBasenames.emplace(basename, input);
+        if (!inserted.second) {
+            std::cerr << "error: inputs " << std::quoted(inserted.first->second)
+                      << " and " << std::quoted(input) << " would both write "
+                      << "to '" << basename << batchFormat << "' in the "
+                      << "batch output directory.\n";
+            return 1;
+        }
+        outputFiles.push_back(
+            TfStringCatPaths(args.batchDir, basename + batchFormat));
+    }
+
+    // Convert the inputs in parallel; plugin and schema registries are
+    // shared and warmed up once for the whole batch. Each conversion
+    // collects its diagnostics into a per-input message printed in input
+    // order below.
+    std::vector<std::string> failures(args.inputFiles.size());
+    std::atomic<bool> anyFailed(false);
+    WorkParallelForN(
+        args.inputFiles.size(),
+        [&args, &outputFiles, &failures, &anyFailed](size_t begin, size_t end) {
+            for (size_t i = begin; i != end; ++i) {
+                const std::string &input = args.inputFiles[i];
+                SdfLayerRefPtr layer;
+                UsdStageRefPtr stage;
+
+                TfErrorMark errMark;
+                OpenInput(args, input, &layer, &stage);
+
+                if (!layer && !stage) {
+                    if (errMark.IsClean()) {
+                        TF_RUNTIME_ERROR("Could not open layer");
+                    }
+                } else if (layer) {
+                    layer->Export(outputFiles[i]);
+                } else {
+                    stage->Export(
+                        outputFiles[i], !args.skipSourceFileComment);
+                }
+
+                if (!errMark.IsClean()) {
+                    std::string message;
+                    for (const auto &err : errMark) {
+                        message += "\t" + err.GetCommentary() + "\n";
+                    }
+                    errMark.Clear();
+                    Quarantine(outputFiles[i]);
+                    failures[i] = message;
+                    anyFailed = true;
+                }
+            }
+        },
+        /* grainSize = */ 1);
+
+    if (anyFailed) {
+        for (size_t i = 0; i != args.inputFiles.size(); ++i) {
+            if (!failures[i].empty()) {
+                std::cerr << "Failed to convert "
+                          << std::quoted(args.inputFiles[i]) << " - \n"
+                          << failures[i];
+            }
+        }
+        return 1;
+    }
+
+    return 0;
+}
+
 static int UsdCat(const Args &args) {
     // If --out was specified, it must either not exist or must be writable, the
     // extension must correspond to a known Sdf file format, and we must have
@@ -145,10 +292,11 @@ static int UsdCat(const Args &args) {
             std::cerr << "error: unknown output file extension.\n";
             return 1;
         }
-    } 
+    }
     // If --out was not specified, then --usdFormat must be unspecified or must
     // be 'usda'.
-    else if (!args.usdFormat.empty() && args.usdFormat != "usda") {
+    else if (args.batchDir.empty() &&
+             !args.usdFormat.empty() && args.usdFormat != "usda") {
         std::cerr << "error: --usdFormat must be unspecified or 'usda' if "
                   << "writing to stdout; specify an output file with -o/--out "
                   << "to write other formats.\n";
@@ -164,12 +312,26 @@ static int UsdCat(const Args &args) {
     if (args.layerMetadata && (args.flatten || args.flattenLayerStack)) {
         // Cannot parse only metadata when flattening.
         std::cerr << "error: --layerMetadata cannot be used together "
-                  << "with " 
+                  << "with "
                   << (args.flatten ? "--flatten" : "--flattenLayerStack")
                   << "\n";
         return 1;
     }
 
+    if (!args.batchDir.empty()) {
+        if (!args.output.empty()) {
+            std::cerr << "error: --batch cannot be combined with "
+                      << "-o/--out.\n";
+            return 1;
+        }
+        if (args.loadOnly) {
+            std::cerr << "error: --batch cannot be combined with "
+                      << "--loadOnly.\n";
+            return 1;
+        }
+        return UsdCatBatch(args);
+    }
+
     int exitCode = 0;
 
     std::map<std::string, std::string> formatArgs;
@@ -186,32 +348,7 @@ static int UsdCat(const Args &args) {
 
         // Either open a layer or compose a stage, depending on whether or not
         // --flatten was specified.
-        if (args.flatten) {
-            if (args.mask.empty()) {
-                stage = UsdStage::Open(input);
-            } else {
-                // Mask can be provided as a comma or space delimited string
-                auto mask = UsdStagePopulationMask();
-                for (const auto &path : TfStringTokenize(args.mask, ", ")) {
-                    mask.Add(SdfPath(path));
-                }
-                stage = UsdStage::OpenMasked(input, mask);
-            }
-        } else if (args.flattenLayerStack) {
-            stage = UsdStage::Open(input, UsdStage::LoadNone);
-            if (stage) {
-                layer = UsdUtilsFlattenLayerStack(stage);
-            }
-        } else if (args.layerMetadata) {
-            auto srcLayer = SdfLayer::OpenAsAnonymous(
-                input, /* metadataOnly = */ true);
-            // Not all file format plugins support metadata-only parsing.
-            // Create a new anonymous layer and copy just the layer metadata.
-            layer = SdfLayer::CreateAnonymous(".usda");
-            UsdUtilsCopyLayerMetadata(srcLayer, layer);
-        } else {
-            layer = SdfLayer::FindOrOpen(input);
-        }
+        OpenInput(args, input, &layer, &stage);
 
         if (!layer && !stage) {
             // If we failed to open a layer or stage, generate a generic
@@ -0,0 +1,404 @@
+#!/pxrpythonsubst
+#
+# Copyright 2025 Pixar
+#
+# Licensed under the terms set forth in the LICENSE.txt file available at
+# https://openusd.org/license.
+#
+"""Macro benchmark driver for common USD stage operations.
+
+Runs reproducible scenarios (open, mask-open, recompose, flatten,
+value-scrub) against the given assets and emits machine readable timings
+as JSON, optionally alongside Trace and TfMallocTag captures per
+scenario. Synthetic stages scaling prim count, namespace depth and
+variant count can be generated to measure scaling curves.
+"""
+
+from __future__ import print_function
+
+import argparse
+import gc
+import os
+import platform
+import statistics
+import sys
+import time
+
+ERROR_EXIT_CODE = 2
+
+SCENARIOS = ('open', 'mask-open', 'recompose', 'flatten', 'value-scrub')
+
+
+def _Err(msg):
+    sys.stderr.write(msg + '\n')
+
+
+# ---------------------------------------------------------------------------
+# Scenarios.
+#
+# Each scenario callable performs one iteration against the given asset
+# and returns the elapsed wall clock seconds of the operation of
+# interest; setup and teardown are excluded from the measurement. Only
+# the 'open' scenario measures cold layer caches (stages and layers are
+# dropped between iterations); the other scenarios deliberately measure
+# warm behavior on an open stage.
+# ---------------------------------------------------------------------------
+
+def _TimeOpen(assetPath, args):
+    from pxr import Usd
+    gc.collect()
+    t0 = time.perf_counter()
+    stage = Usd.Stage.Open(assetPath)
+    elapsed = time.perf_counter() - t0
+    if not stage:
+        raise RuntimeError("Could not open %s" % assetPath)
+    del stage
+    # Drop the layers from the registry so the next iteration re-reads.
+    gc.collect()
+    return elapsed
+
+
+def _GetMaskPath(assetPath, args):
+    if args.mask:
+        return args.mask
+    from pxr import Sdf
+    layer = Sdf.Layer.FindOrOpen(assetPath)
+    if layer and len(layer.rootPrims):
+        return str(layer.rootPrims[0].path)
+    return '/'
+
+
+def _TimeMaskOpen(assetPath, args):
+    from pxr import Usd
+    maskPath = _GetMaskPath(assetPath, args)
+    mask = Usd.StagePopulationMask([maskPath])
+    gc.collect()
+    t0 = time.perf_counter()
+    stage = Usd.Stage.OpenMasked(assetPath, mask)
+    elapsed = time.perf_counter() - t0
+    if not stage:
+        raise RuntimeError("Could not mask-open %s" % assetPath)
+    del stage
+    gc.collect()
+    return elapsed
+
+
+def _TimeRecompose(assetPath, args):
+    from pxr import Usd, Sdf
+    stage = Usd.Stage.Open(assetPath)
+    if not stage:
+        raise RuntimeError("Could not open %s" % assetPath)
+    # Inserting a session sublayer changes the layer stack, which forces
+    # the stage to recompose everything beneath the pseudo-root.
+    sub = Sdf.Layer.CreateAnonymous('.usda')
+    t0 = time.perf_counter()
+    stage.GetSessionLayer().subLayerPaths.insert(0, sub.identifier)
+    elapsed = time.perf_counter() - t0
+    del stage
+    gc.collect()
+    return elapsed
+
+
+def _TimeFlatten(assetPath, args):
+    from pxr import Usd
+    stage = Usd.Stage.Open(assetPath)
+    if not stage:
+        raise RuntimeError("Could not open %s" % assetPath)
+    t0 = time.perf_counter()
+    layer = stage.Flatten()
+    elapsed = time.perf_counter() - t0
+    del layer
+    del stage
+    gc.collect()
+    return elapsed
+
+
+def _TimeValueScrub(assetPath, args):
+    from pxr import Usd
+    stage = Usd.Stage.Open(assetPath)
+    if not stage:
+        raise RuntimeError("Could not open %s" % assetPath)
+
+    # Sample every attribute at evenly spaced times across the stage's
+    # time range, emulating a playback scrub.
+    start = stage.GetStartTimeCode()
+    end = stage.GetEndTimeCode()
+    numSamples = max(1, args.scrubSamples)
+    if end > start:
+        times = [start + (end - start) * i / (numSamples - 1)
+                 for i in range(numSamples)] if numSamples > 1 else [start]
+    else:
+        times = [Usd.TimeCode.Default()]
+
+    t0 = time.perf_counter()
+    for prim in stage.Traverse():
+        for attr in prim.GetAttributes():
+            for t in times:
+                attr.Get(t)
+    elapsed = time.perf_counter() - t0
+    del stage
+    gc.collect()
+    return elapsed
+
+
+_SCENARIO_FUNCS = {
+    'open': _TimeOpen,
+    'mask-open': _TimeMaskOpen,
+    'recompose': _TimeRecompose,
+    'flatten': _TimeFlatten,
+    'value-scrub': _TimeValueScrub,
+}
+
+
+# ---------------------------------------------------------------------------
+# Synthetic stage generation.
+# ---------------------------------------------------------------------------
+
+def _GenerateSyntheticStage(args):
+    """Writes a synthetic stage with roughly args.genPrims prims arranged
+    in a tree of depth args.genDepth. Leaves are spheres with a time
+    sampled radius; each leaf carries a 'lod' variant set with
+    args.genVariants variants overriding the radius."""
+    from pxr import Sdf, Usd
+
+    numPrims = max(1, args.genPrims)
+    depth = max(1, args.genDepth)
+    variants = max(0, args.genVariants)
+
+    stage = Usd.Stage.CreateNew(args.generate)
+    if not stage:
+        raise RuntimeError("Could not create %s" % args.generate)
+    stage.SetStartTimeCode(0)
+    stage.SetEndTimeCode(24)
+
+    # Branching factor so a full tree of the requested depth holds
+    # roughly the requested number of prims.
+    branching = max(1, int(round(numPrims ** (1.0 / depth))))
+
+    created = 0
+
+    def _MakeLeaf(path):
+        prim = stage.DefinePrim(path, 'Sphere')
+        attr = prim.CreateAttribute('radius', Sdf.ValueTypeNames.Double)
+        attr.Set(1.0)
+        attr.Set(0.5, 0)
+        attr.Set(2.0, 24)
+        if variants:
+            vset = prim.GetVariantSets().AddVariantSet('lod')
+            for v in range(variants):
+                name = 'lod%d' % v
+                vset.AddVariant(name)
+                vset.SetVariantSelection(name)
+                with vset.GetVariantEditContext():
+                    attr.Set(1.0 + v)
+            vset.SetVariantSelection('lod0')
+        return prim
+
+    frontier = ['/World']
+    stage.DefinePrim('/World', 'Xform')
+    created += 1
+    for level in range(1, depth + 1):
+        nextFrontier = []
+        isLeafLevel = (level == depth)
+        for parentPath in frontier:
+            for i in range(branching):
+                if created >= numPrims:
+                    break
+                path = '%s/c%d' % (parentPath, i)
+                if isLeafLevel:
+                    _MakeLeaf(path)
+                else:
+                    stage.DefinePrim(path, 'Xform')
+                    nextFrontier.append(path)
+                created += 1
+        frontier = nextFrontier
+        if created >= numPrims or not frontier:
+            break
+
+    stage.GetRootLayer().Save()
+    del stage
+    gc.collect()
+    return created
+
+
+# ---------------------------------------------------------------------------
+# Driver.
+# ---------------------------------------------------------------------------
+
+def _Stats(times):
+    timesMs = [t * 1000.0 for t in times]
+    return {
+        'timesMs': timesMs,
+        'minMs': min(timesMs),
+        'meanMs': statistics.mean(timesMs),
+        'medianMs': statistics.median(timesMs),
+        'maxMs': max(timesMs),
+    }
+
+
+def _CaptureFileName(directory, assetPath, scenario, suffix):
+    stem = os.path.splitext(os.path.basename(assetPath))[0]
+    return os.path.join(directory, '%s.%s.%s' % (stem, scenario, suffix))
+
+
+def _RunScenario(assetPath, scenario, args):
+    from pxr import Tf, Trace
+
+    func = _SCENARIO_FUNCS[scenario]
+
+    for _ in range(args.warmup):
+        func(assetPath, args)
+
+    collector = None
+    if args.trace:
+        collector = Trace.Collector()
+        collector.Clear()
+        collector.enabled = True
+
+    times = [func(assetPath, args) for _ in range(args.iterations)]
+
+    if collector:
+        collector.enabled = False
+        reporter = Trace.Reporter.globalReporter
+        reporter.UpdateTraceTrees()
+        reporter.Report(
+            _CaptureFileName(args.trace, assetPath, scenario, 'trace'))
+        reporter.ClearTree()
+        collector.Clear()
+
+    if args.mallocTag:
+        Tf.MallocTag.GetCallTree().Report(
+            _CaptureFileName(args.mallocTag, assetPath, scenario, 'mallocTag'))
+
+    return _Stats(times)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        prog=os.path.basename(sys.argv[0]),
+        description='Runs reproducible performance scenarios against USD '
+                    'assets and reports machine readable timings.')
+    parser.add_argument('assets', nargs='*', type=str,
+                        help='USD asset(s) to benchmark.')
+    parser.add_argument('--scenarios', type=str,
+                        default=','.join(SCENARIOS),
+                        help='Comma separated list of scenarios to run; '
+                             'one or more of: %s.' % ', '.join(SCENARIOS))
+    parser.add_argument('--iterations', type=int, default=3,
+                        help='Timed iterations per scenario (default: 3).')
+    parser.add_argument('--warmup', type=int, default=0,
+                        help='Untimed warmup iterations per scenario '
+                             '(default: 0).')
+    parser.add_argument('--mask', type=str, default=None,
+                        help='Prim path for the mask-open scenario; '
+                             'defaults to the first root prim.')
+    parser.add_argument('--scrub-samples', dest='scrubSamples', type=int,
+                        default=5,
+                        help='Time samples per attribute for the '
+                             'value-scrub scenario (default: 5).')
+    parser.add_argument('--output', type=str, default='-',
+                        help="File to write the JSON report to; '-' for "
+                             'stdout (default).')
+    parser.add_argument('--trace', type=str, default=None, metavar='DIR',
+                        help='Write a Trace report per asset and scenario '
+                             'into this directory.')
+    parser.add_argument('--malloc-tag', dest='mallocTag', type=str,
+                        default=None, metavar='DIR',
+                        help='Initialize TfMallocTag and write a call tree '
+                             'report per asset and scenario into this '
+                             'directory.')
+    parser.add_argument('--generate', type=str, default=None, metavar='FILE',
+                        help='Write a synthetic stage to FILE and append it '
+                             'to the assets to benchmark.')
+    parser.add_argument('--gen-prims', dest='genPrims', type=int,
+                        default=1000,
+                        help='Approximate prim count for --generate '
+                             '(default: 1000).')
+    parser.add_argument('--gen-depth', dest='genDepth', type=int, default=4,
+                        help='Namespace depth for --generate (default: 4).')
+    parser.add_argument('--gen-variants', dest='genVariants', type=int,
+                        default=0,
+                        help='Variants per leaf prim for --generate '
+                             '(default: 0).')
+
+    args = parser.parse_args()
+
+    scenarios = [s for s in args.scenarios.split(',') if s]
+    for scenario in scenarios:
+        if scenario not in _SCENARIO_FUNCS:
+            _Err("Error: Unknown scenario '%s'. Expected one of: %s."
+                 % (scenario, ', '.join(SCENARIOS)))
+            return ERROR_EXIT_CODE
+
+    # Malloc tagging must be enabled before the workload allocates;
+    # allocations made before this point are not tracked.
+    if args.mallocTag:
+        from pxr import Tf
+        ok, err = Tf.MallocTag.Initialize()
+        if not ok:
+            _Err('Error: Could not initialize TfMallocTag: %s' % err)
+            return ERROR_EXIT_CODE
+        if not os.path.isdir(args.mallocTag):
+            os.makedirs(args.mallocTag)
+
+    if args.trace and not os.path.isdir(args.trace):
+        os.makedirs(args.trace)
+
+    assets = list(args.assets)
+    if args.generate:
+        try:
+            numPrims = _GenerateSyntheticStage(args)
+        except Exception as e:
+            _Err('Error: Failed to generate %s: %s' % (args.generate, e))
+            return ERROR_EXIT_CODE
+        print('Generated %s with %d prims.' % (args.generate, numPrims),
+              file=sys.stderr)
+        assets.append(args.generate)
+
+    if not assets:
+        _Err('Error: No assets to benchmark. Provide asset paths or '
+             '--generate.')
+        return ERROR_EXIT_CODE
+
+    if args.iterations < 1:
+        _Err('Error: --iterations must be at least 1.')
+        return ERROR_EXIT_CODE
+
+    from pxr import Usd
+
+    report = {
+        'host': {
+            'platform': platform.platform(),
+            'python': platform.python_version(),
+            'usdVersion': '.'.join(str(v) for v in Usd.GetVersion()),
+        },
+        'iterations': args.iterations,
+        'warmup': args.warmup,
+        'results': [],
+    }
+
+    for assetPath in assets:
+        result = {'asset': assetPath, 'scenarios': {}}
+        for scenario in scenarios:
+            try:
+                result['scenarios'][scenario] = _RunScenario(
+                    assetPath, scenario, args)
+            except Exception as e:
+                _Err("Error: Scenario '%s' failed for %s: %s"
+                     % (scenario, assetPath, e))
+                return ERROR_EXIT_CODE
+        report['results'].append(result)
+
+    import json
+    if args.output == '-':
+        json.dump(report, sys.stdout, indent=2)
+        print()
+    else:
+        with open(args.output, 'w') as f:
+            json.dump(report, f, indent=2)
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -6,8 +6,12 @@
 //
 
 #include "pxr/pxr.h"
+#include "pxr/base/arch/fileSystem.h"
+#include "pxr/base/js/json.h"
+#include "pxr/base/tf/errorMark.h"
 #include "pxr/base/tf/hash.h"
 #include "pxr/base/tf/pathUtils.h"
+#include "pxr/base/tf/safeOutputFile.h"
 #include "pxr/base/tf/stringUtils.h"
 #include "pxr/base/tf/type.h"
 #include "pxr/base/trace/trace.h"
@@ -25,6 +29,9 @@
 #include "pxr/base/plug/registry.h"
 #include "pxr/base/tf/envSetting.h"
 
+#include <fstream>
+#include <sstream>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 TF_DEFINE_ENV_SETTING(
@@ -42,6 +49,14 @@ TF_DEFINE_ENV_SETTING(
     "Comma separated list of Ndr plugins to disable.  Note that disabling plugins may cause "
     "shaders in your scenes to malfunction.");
 
+TF_DEFINE_ENV_SETTING(
+    PXR_NDR_DISCOVERY_CACHE_PATH, "",
+    "If set to a file path, the results of node discovery are written to "
+    "that file and reloaded on subsequent startups, skipping the discovery "
+    "plugins' search-path walk.  The cache is ignored and rewritten when "
+    "the discovery plugins, their search URIs, or the modification times "
+    "of the searched directories change.");
+
 // This function is used for property validation. It explictly is validating 
 // that the sdfType and sdfTypeDefaultValue have the same type. Note how it is
 // calling the methods GetTypeAsSdfType() and GetDefaultValueAsSdfType() 
@@ -264,12 +279,43 @@ private:
     const NdrRegistry& _registry;
 };
 
+// Computes a key identifying the current discovery configuration: the set
+// of discovery plugins, the URIs they search, and the modification times of
+// the searched directories.  A stale discovery cache is detected by a key
+// mismatch.
+static size_t
+_ComputeDiscoveryCacheKey(const NdrRegistry::DiscoveryPluginRefPtrVec& plugins)
+{
+    size_t key = 0;
+    for (const NdrDiscoveryPluginRefPtr& plugin : plugins) {
+        key = TfHash::Combine(key, TfType::Find(*plugin).GetTypeName());
+        for (const std::string& uri : plugin->GetSearchURIs()) {
+            double mtime = 0.0;
+            ArchGetModificationTime(uri.c_str(), &mtime);
+            key = TfHash::Combine(key, uri, mtime);
+        }
+    }
+    return key;
+}
+
 NdrRegistry::NdrRegistry()
 {
     TRACE_FUNCTION();
     _FindAndInstantiateParserPlugins();
     _FindAndInstantiateDiscoveryPlugins();
-    _RunDiscoveryPlugins(_discoveryPlugins);
+
+    const std::string cachePath =
+        TfGetEnvSetting(PXR_NDR_DISCOVERY_CACHE_PATH);
+    if (cachePath.empty()) {
+        _RunDiscoveryPlugins(_discoveryPlugins);
+        return;
+    }
+
+    const size_t cacheKey = _ComputeDiscoveryCacheKey(_discoveryPlugins);
+    if (!_LoadDiscoveryCache(cachePath, cacheKey)) {
+        _RunDiscoveryPlugins(_discoveryPlugins);
+        _SaveDiscoveryCache(cachePath, cacheKey);
+    }
 }
 
 NdrRegistry::~NdrRegistry()
@@ -1017,7 +1063,177 @@ NdrRegistry::_AddDiscoveryResultNoLock(NdrNodeDiscoveryResult&& drMoved)
 
 }
 
-NdrNodeConstPtr 
+// Bumped when the discovery cache layout below changes, so that caches
+// written by older builds are rediscovered rather than misread.
+static const int _discoveryCacheFormatVersion = 1;
+
+bool
+NdrRegistry::_LoadDiscoveryCache(
+    const std::string& cachePath, size_t cacheKey)
+{
+    TRACE_FUNCTION();
+
+    std::ifstream stream(cachePath);
+    if (!stream) {
+        return false;
+    }
+
+    JsParseError error;
+    const JsValue parsed = JsParseStream(stream, &error);
+    if (!parsed.IsObject()) {
+        TF_WARN("Ignoring malformed discovery cache '%s': %s",
+                cachePath.c_str(), error.reason.c_str());
+        return false;
+    }
+
+    const auto getString = [](const JsObject& obj, const char* field) {
+        const auto it = obj.find(field);
+        return (it != obj.end() && it->second.IsString())
+            ? it->second.GetString() : std::string();
+    };
+    const auto getInt = [](const JsObject& obj, const char* field) {
+        const auto it = obj.find(field);
+        return (it != obj.end() && it->second.IsInt())
+            ? it->second.GetInt() : 0;
+    };
+    const auto getBool = [](const JsObject& obj, const char* field) {
+        const auto it = obj.find(field);
+        return it != obj.end() && it->second.IsBool() &&
+            it->second.GetBool();
+    };
+
+    const JsObject& header = parsed.GetJsObject();
+    if (getInt(header, "formatVersion") != _discoveryCacheFormatVersion ||
+        getString(header, "cacheKey") != TfStringify(cacheKey)) {
+        // Written by an incompatible build, or the plugins or their search
+        // paths have changed since the cache was written; rediscover.
+        return false;
+    }
+
+    const auto resultsIt = header.find("results");
+    if (resultsIt == header.end() || !resultsIt->second.IsArray()) {
+        return false;
+    }
+
+    // Reconstruct into a local vector first, so that a malformed entry
+    // rejects the whole cache rather than leaving the registry partially
+    // populated.
+    const JsArray& results = resultsIt->second.GetJsArray();
+    NdrNodeDiscoveryResultVec loaded;
+    loaded.reserve(results.size());
+    for (const JsValue& result : results) {
+        if (!result.IsObject()) {
+            return false;
+        }
+        const JsObject& obj = result.GetJsObject();
+
+        const NdrIdentifier identifier(getString(obj, "identifier"));
+        if (identifier.IsEmpty()) {
+            return false;
+        }
+
+        const int major = getInt(obj, "versionMajor");
+        const int minor = getInt(obj, "versionMinor");
+        NdrVersion version =
+            (major || minor) ? NdrVersion(major, minor) : NdrVersion();
+        if (getBool(obj, "versionIsDefault")) {
+            version = version.GetAsDefault();
+        }
+
+        NdrTokenMap metadata;
+        const auto metadataIt = obj.find("metadata");
+        if (metadataIt != obj.end() && metadataIt->second.IsObject()) {
+            for (const auto& meta : metadataIt->second.GetJsObject()) {
+                if (meta.second.IsString()) {
+                    metadata.emplace(TfToken(meta.first),
+                                     meta.second.GetString());
+                }
+            }
+        }
+
+        loaded.emplace_back(
+            identifier,
+            version,
+            getString(obj, "name"),
+            TfToken(getString(obj, "family")),
+            TfToken(getString(obj, "discoveryType")),
+            TfToken(getString(obj, "sourceType")),
+            getString(obj, "uri"),
+            getString(obj, "resolvedUri"),
+            getString(obj, "sourceCode"),
+            metadata,
+            getString(obj, "blindData"),
+            TfToken(getString(obj, "subIdentifier")));
+    }
+
+    std::lock_guard<std::mutex> drLock(_discoveryResultMutex);
+    for (NdrNodeDiscoveryResult& dr : loaded) {
+        _AddDiscoveryResultNoLock(std::move(dr));
+    }
+
+    TF_DEBUG(NDR_DISCOVERY).Msg(
+        "Loaded %zu discovery results from cache '%s'\n",
+        results.size(), cachePath.c_str());
+    return true;
+}
+
+void
+NdrRegistry::_SaveDiscoveryCache(
+    const std::string& cachePath, size_t cacheKey)
+{
+    TRACE_FUNCTION();
+
+    JsArray results;
+    {
+        std::lock_guard<std::mutex> drLock(_discoveryResultMutex);
+        results.reserve(_discoveryResultsByIdentifier.size());
+        for (const auto& entry : _discoveryResultsByIdentifier) {
+            const NdrNodeDiscoveryResult& dr = entry.second;
+            JsObject obj;
+            obj["identifier"] = JsValue(dr.identifier.GetString());
+            obj["versionMajor"] = JsValue(dr.version.GetMajor());
+            obj["versionMinor"] = JsValue(dr.version.GetMinor());
+            obj["versionIsDefault"] = JsValue(dr.version.IsDefault());
+            obj["name"] = JsValue(dr.name);
+            obj["family"] = JsValue(dr.family.GetString());
+            obj["discoveryType"] = JsValue(dr.discoveryType.GetString());
+            obj["sourceType"] = JsValue(dr.sourceType.GetString());
+            obj["uri"] = JsValue(dr.uri);
+            obj["resolvedUri"] = JsValue(dr.resolvedUri);
+            obj["sourceCode"] = JsValue(dr.sourceCode);
+            JsObject metadata;
+            for (const auto& meta : dr.metadata) {
+                metadata[meta.first.GetString()] = JsValue(meta.second);
+            }
+            obj["metadata"] = JsValue(std::move(metadata));
+            obj["blindData"] = JsValue(dr.blindData);
+            obj["subIdentifier"] = JsValue(dr.subIdentifier.GetString());
+            results.push_back(JsValue(std::move(obj)));
+        }
+    }
+
+    JsObject header;
+    header["formatVersion"] = JsValue(_discoveryCacheFormatVersion);
+    header["cacheKey"] = JsValue(TfStringify(cacheKey));
+    header["results"] = JsValue(std::move(results));
+
+    std::ostringstream buffer;
+    JsWriteToStream(JsValue(std::move(header)), buffer);
+    const std::string contents = buffer.str();
+
+    // The cache is only an optimization, so failure to write it is not an
+    // error; Replace() reports the reason, and the next startup simply
+    // rediscovers.
+    TfErrorMark mark;
+    TfSafeOutputFile file = TfSafeOutputFile::Replace(cachePath);
+    if (!mark.IsClean()) {
+        return;
+    }
+    fwrite(contents.data(), 1, contents.size(), file.Get());
+    file.Close();
+}
+
+NdrNodeConstPtr
 NdrRegistry::_FindNodeInCache(const _NodeMapKey &key) const
 {
     // Return an existing node in the node map if there's one that matches the
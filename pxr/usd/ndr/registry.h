@@ -325,6 +325,15 @@ private:
     // keeping them in sync.
     void _AddDiscoveryResultNoLock(NdrNodeDiscoveryResult&& dr);
 
+    // Attempts to populate the discovery result maps from the discovery
+    // cache file at cachePath, returning false if the file is missing,
+    // unreadable, or was written for a different cache key.
+    bool _LoadDiscoveryCache(const std::string& cachePath, size_t cacheKey);
+
+    // Writes the current discovery results to the discovery cache file at
+    // cachePath, tagged with the given cache key.
+    void _SaveDiscoveryCache(const std::string& cachePath, size_t cacheKey);
+
     // Finds and instantiates the discovery plugins
     void _FindAndInstantiateDiscoveryPlugins();
 
@@ -18,6 +18,7 @@
 #include "pxr/usd/pcp/node_Iterator.h"
 #include "pxr/usd/pcp/pathTranslation.h"
 #include "pxr/usd/pcp/primIndex.h"
+#include "pxr/usd/pcp/primIndex_DiskCache.h"
 #include "pxr/usd/pcp/propertyIndex.h"
 #include "pxr/usd/pcp/statistics.h"
 #include "pxr/usd/pcp/targetIndex.h"
@@ -383,6 +384,18 @@ PcpCache::GetPrimIndexInputs()
         .FileFormatTarget(_fileFormatTarget);
 }
 
+bool
+PcpCache::SavePrimIndexCacheFile(const std::string &filePath) const
+{
+    return Pcp_PrimIndexDiskCache::Write(*this, filePath);
+}
+
+bool
+PcpCache::LoadPrimIndexCacheFile(const std::string &filePath)
+{
+    return Pcp_PrimIndexDiskCache::Read(this, filePath);
+}
+
 PcpLayerStackRefPtr
 PcpCache::ComputeLayerStack(const PcpLayerStackIdentifier &id,
                             PcpErrorVector *allErrors)
@@ -237,10 +237,29 @@ public:
                           = nullptr) const;
 
     /// Returns parameter object containing all inputs for the prim index
-    /// computation used by this cache. 
+    /// computation used by this cache.
     PCP_API
     PcpPrimIndexInputs GetPrimIndexInputs();
 
+    /// Save all computed prim indexes in this cache to the file at
+    /// \p filePath so that a future cache with the same composition
+    /// parameters can reload them via LoadPrimIndexCacheFile without
+    /// recomputing composition.  The file records the identity and
+    /// modification timestamp of every contributing layer; it will be
+    /// rejected on load if any of those layers has changed.  Returns
+    /// false and issues a warning if the file cannot be written.
+    PCP_API
+    bool SavePrimIndexCacheFile(const std::string &filePath) const;
+
+    /// Populate this cache with the prim indexes previously saved to
+    /// \p filePath via SavePrimIndexCacheFile.  The file is rejected --
+    /// and this cache left unmodified -- if it was written with different
+    /// composition parameters (USD mode, variant fallbacks, muted layers)
+    /// or if any contributing layer has changed since it was written.
+    /// Returns true if the cache was populated from the file.
+    PCP_API
+    bool LoadPrimIndexCacheFile(const std::string &filePath);
+
     /// @}
 
     /// \name Computations
@@ -641,6 +660,7 @@ public:
 private:
     friend class PcpChanges;
     friend class Pcp_Dependencies;
+    friend class Pcp_PrimIndexDiskCache;
     friend class Pcp_Statistics;
 
     struct _ParallelIndexer;
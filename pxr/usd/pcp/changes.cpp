@@ -114,9 +114,25 @@ PcpChanges::~PcpChanges()
 enum Pcp_ChangesLayerStackChange {
     Pcp_ChangesLayerStackChangeNone,
     Pcp_ChangesLayerStackChangeSignificant,
-    Pcp_ChangesLayerStackChangeMaybeSignificant
+    Pcp_ChangesLayerStackChangeMaybeSignificant,
+    Pcp_ChangesLayerStackChangeMaybeSignificantOwners
 };
 
+// Returns true if \p layerStack contains a layer whose sublayers are
+// owner-managed. Owner metadata can only affect the composed layer order
+// of such layer stacks.
+static
+bool
+Pcp_LayerStackUsesOwnedSublayers(const PcpLayerStackPtr& layerStack)
+{
+    for (const SdfLayerHandle& layer : layerStack->GetLayers()) {
+        if (layer && layer->GetHasOwnedSubLayers()) {
+            return true;
+        }
+    }
+    return false;
+}
+
 static
 Pcp_ChangesLayerStackChange
 Pcp_EntryRequiresLayerStackChange(const SdfChangeList::Entry& entry)
@@ -133,28 +149,48 @@ Pcp_EntryRequiresLayerStackChange(const SdfChangeList::Entry& entry)
         return Pcp_ChangesLayerStackChangeSignificant;
     }
 
-    // Order of layers in layer stack probably changed.
-    // XXX: Don't return true if these changes don't affect the
-    //      layer tree order.
+    // Order of layers in layer stack may have changed.
+    bool maybeOwners = false;
     for (auto const &p: entry.infoChanged) {
-        if (p.first == SdfFieldKeys->Owner ||
-            p.first == SdfFieldKeys->SessionOwner ||
-            p.first == SdfFieldKeys->HasOwnedSubLayers) {
+        if (p.first == SdfFieldKeys->HasOwnedSubLayers) {
+            // Turning owned sublayers on or off reorders the layer tree
+            // wherever an owner is in effect.
             return Pcp_ChangesLayerStackChangeSignificant;
         }
+        if (p.first == SdfFieldKeys->Owner ||
+            p.first == SdfFieldKeys->SessionOwner) {
+            // These affect layer order only in layer stacks that contain
+            // owned sublayers; the caller checks each layer stack.
+            maybeOwners = true;
+        }
     }
 
     // Layer was added or removed.
+    bool maybeSublayers = false;
     TF_FOR_ALL(i, entry.subLayerChanges) {
         if (i->second == SdfChangeList::SubLayerAdded ||
             i->second == SdfChangeList::SubLayerRemoved) {
             // Whether the change is significant depends on whether any
             // added/removed layer is significant.  To check that we need
             // the help of each cache using this layer.
-            return Pcp_ChangesLayerStackChangeMaybeSignificant;
+            maybeSublayers = true;
+            break;
         }
     }
 
+    // If both owner metadata and the sublayer list changed in the same
+    // batch, be conservative rather than merging the two per-layer-stack
+    // analyses.
+    if (maybeOwners && maybeSublayers) {
+        return Pcp_ChangesLayerStackChangeSignificant;
+    }
+    if (maybeSublayers) {
+        return Pcp_ChangesLayerStackChangeMaybeSignificant;
+    }
+    if (maybeOwners) {
+        return Pcp_ChangesLayerStackChangeMaybeSignificantOwners;
+    }
+
     return Pcp_ChangesLayerStackChangeNone;
 }
 
@@ -780,6 +816,16 @@ PcpChanges::DidChange(const PcpCache* cache,
             continue;
         }
 
+        // Changes to the layer's contents may introduce composition arcs
+        // that were absent when these layer stacks computed their arc
+        // capabilities. Layer stacks are not recomputed for content
+        // changes, so conservatively widen the capabilities here; they
+        // will be narrowed again the next time the layer stack is
+        // recomputed.
+        for (const PcpLayerStackPtr &layerStack : layerStacks) {
+            layerStack->_WidenArcCapabilities();
+        }
+
         PCP_APPEND_DEBUG("  Changes to layer %s:\n%s",
                          layer->GetIdentifier().c_str(),
                          TfStringify(changeList).c_str());
@@ -894,6 +940,44 @@ PcpChanges::DidChange(const PcpCache* cache,
                                      layer->GetIdentifier().c_str());
                     break;
 
+                case Pcp_ChangesLayerStackChangeMaybeSignificantOwners:
+                    // Owner metadata affects the composed layer order only
+                    // in layer stacks that contain owned sublayers; other
+                    // layer stacks using this layer are unaffected.
+                    for (auto const &layerStack: layerStacks) {
+                        if (!Pcp_LayerStackUsesOwnedSublayers(layerStack)) {
+                            continue;
+                        }
+
+                        PCP_APPEND_DEBUG(
+                            "  Layer @%s@ changed:  owner (significant "
+                            "for layer stack %s)\n",
+                            layer->GetIdentifier().c_str(),
+                            TfStringify(layerStack->GetIdentifier()).c_str());
+                        layerStackChangesMap[layerStack] |=
+                            LayerStackLayersChange |
+                            LayerStackSignificantChange;
+
+                        // Register significant changes for all prims using
+                        // this layer stack.  Like sublayer changes, we only
+                        // do this for prims; properties are implicitly
+                        // invalidated by significant prim resyncs.
+                        PcpDependencyVector deps =
+                            cache->FindSiteDependencies(
+                                layerStack,
+                                SdfPath::AbsoluteRootPath(),
+                                PcpDependencyTypeAnyIncludingVirtual,
+                                /* recurseOnSite */ true,
+                                /* recurseOnIndex */ false,
+                                /* filter */ true);
+                        for (const auto &dep: deps) {
+                            if (dep.indexPath.IsAbsoluteRootOrPrimPath()) {
+                                DidChangeSignificantly(cache, dep.indexPath);
+                            }
+                        }
+                    }
+                    break;
+
                 case Pcp_ChangesLayerStackChangeNone:
                     // Layer stack is okay.   Handle changes that require
                     // blowing the layer stack offsets.
@@ -1815,11 +1899,15 @@ PcpChanges::_Optimize(PcpCacheChanges* changes)
     // Subsume changes implied by ancestors.
     Pcp_SubsumeDescendants(&changes->didChangeSignificantly);
 
+    // Subsume changes implied by ancestors.
+    Pcp_SubsumeDescendants(&changes->didChangeSpecsAndChildren);
+
     // Subsume changes implied by prim graph changes.
     TF_FOR_ALL(i, changes->didChangeSignificantly) {
         Pcp_SubsumeDescendants(&changes->didChangePrims, *i);
         Pcp_SubsumeDescendants(&changes->didChangeSpecs, *i);
         Pcp_SubsumeDescendants(&changes->_didChangeSpecsInternal, *i);
+        Pcp_SubsumeDescendants(&changes->didChangeSpecsAndChildren, *i);
     }
 
     // Subsume spec changes for prims whose indexes will be rebuilt.
@@ -2067,6 +2155,93 @@ PcpChanges::_DidAddOrRemoveSublayer(
     }
 }
 
+// Return true if the given layer authors only value opinions -- that is,
+// no fields that could affect the topology of any prim index composed from
+// a layer stack that includes the layer.  Adding or removing such a layer
+// (e.g. via muting) changes the specs that contribute to dependent prim
+// indexes, but not the indexes' node graphs, so the indexes can be patched
+// in place rather than rebuilt.
+//
+// Value opinions are not topology-neutral if any prim index in \p cache
+// composes dynamic file format arguments from attribute default values or
+// metadata fields: an opinion on such an attribute or field can change the
+// arguments and thus the dependent payload arcs, so those opinions
+// disqualify the layer.
+static bool
+_SublayerContributesOnlyValueOpinions(const PcpCache* cache,
+                                      const SdfLayerHandle& sublayer)
+{
+    // Layer-level fields that structurally affect composition.
+    static const TfToken* layerFields[] = {
+        &SdfFieldKeys->SubLayers,
+        &SdfFieldKeys->LayerRelocates,
+        &SdfFieldKeys->ExpressionVariables,
+        &SdfFieldKeys->SessionOwner,
+        &SdfFieldKeys->HasOwnedSubLayers
+    };
+    for (const TfToken* field : layerFields) {
+        if (sublayer->HasField(SdfPath::AbsoluteRootPath(), *field)) {
+            return false;
+        }
+    }
+
+    // Prim-level fields that introduce composition arcs or otherwise
+    // affect prim index structure.
+    static const TfToken* primFields[] = {
+        &SdfFieldKeys->References,
+        &SdfFieldKeys->Payload,
+        &SdfFieldKeys->InheritPaths,
+        &SdfFieldKeys->Specializes,
+        &SdfFieldKeys->VariantSetNames,
+        &SdfFieldKeys->VariantSelection,
+        &SdfChildrenKeys->VariantSetChildren,
+        &SdfFieldKeys->Relocates,
+        &SdfFieldKeys->Active,
+        &SdfFieldKeys->Instanceable,
+        &SdfFieldKeys->Permission
+    };
+
+    const bool checkDynamicArgFields =
+        cache->HasAnyDynamicFileFormatArgumentFieldDependencies();
+    const bool checkDynamicArgAttributes =
+        cache->HasAnyDynamicFileFormatArgumentAttributeDependencies();
+
+    bool onlyValueOpinions = true;
+    sublayer->Traverse(
+        SdfPath::AbsoluteRootPath(),
+        [&, cache](const SdfPath& path) {
+            if (!onlyValueOpinions) {
+                return;
+            }
+            if (path.IsPrimPath()) {
+                for (const TfToken* field : primFields) {
+                    if (sublayer->HasField(path, *field)) {
+                        onlyValueOpinions = false;
+                        return;
+                    }
+                }
+                if (checkDynamicArgFields) {
+                    for (const TfToken& field : sublayer->ListFields(path)) {
+                        if (cache->IsPossibleDynamicFileFormatArgumentField(
+                                field)) {
+                            onlyValueOpinions = false;
+                            return;
+                        }
+                    }
+                }
+            }
+            else if (path.IsPrimPropertyPath()) {
+                if (checkDynamicArgAttributes &&
+                    cache->IsPossibleDynamicFileFormatArgumentAttribute(
+                        path.GetNameToken())) {
+                    onlyValueOpinions = false;
+                }
+            }
+        });
+
+    return onlyValueOpinions;
+}
+
 void
 PcpChanges::_DidChangeSublayer(
     const PcpCache* cache,
@@ -2079,14 +2254,27 @@ PcpChanges::_DidChangeSublayer(
 {
     *significant = (sublayer && !sublayer->IsEmpty());
 
+    // If this is a USD cache and the layer authors no fields that affect
+    // prim index topology, we can avoid rebuilding dependent prim indexes
+    // entirely: their prim stacks are patched in place and clients
+    // recompose the affected subtrees against the patched indexes.  This
+    // makes muting and unmuting value-only layers (e.g. department
+    // override layers) far cheaper than a significant resync.
+    const bool valueOnly = *significant && cache->IsUsd() &&
+        _SublayerContributesOnlyValueOpinions(cache, sublayer);
+    if (valueOnly) {
+        *significant = false;
+    }
+
     PCP_APPEND_DEBUG("  %s sublayer @%s@ %s\n",
                      sublayer ? (*significant ? "significant"
-                                              : "insignificant")
+                                 : valueOnly ? "value-only"
+                                             : "insignificant")
                               : "invalid",
                      sublayerPath.c_str(),
                      sublayerChange == _SublayerAdded ? "added" : "removed");
 
-    if (!sublayer || (!*significant && cache->IsUsd())) {
+    if (!sublayer || (!*significant && !valueOnly && cache->IsUsd())) {
         // If the added or removed sublayer is invalid, or if it is
         // insignificant and this cache is a USD cache, then it has no effect on
         // composed results so we don't need to register any changes.
@@ -2152,6 +2340,13 @@ PcpChanges::_DidChangeSublayer(
                 DidChangeSignificantly(cache, dep.indexPath);
             } else {
                 _DidChangeSpecStackInternal(cache, dep.indexPath);
+                if (valueOnly) {
+                    // The spec stack rescan keeps the prim index correct,
+                    // but clients still need to recompose the affected
+                    // subtrees to pick up the changed opinions.
+                    _GetCacheChanges(cache).didChangeSpecsAndChildren.insert(
+                        dep.indexPath);
+                }
             }
         }
     }
@@ -112,6 +112,13 @@ public:
     /// Must rebuild the prim/property stacks at each path.
     SdfPathSet didChangeSpecs;
 
+    /// Must rebuild the prim/property stacks at each path and recompose
+    /// the composed objects in the subtrees rooted there, but the prim
+    /// indexes themselves are patched in place rather than rebuilt.
+    /// Populated when a muted or unmuted layer contributes only value
+    /// opinions to the composed scene.
+    SdfPathSet didChangeSpecsAndChildren;
+
     /// Must rebuild the prim indexes at each path.  This implies rebuilding
     /// the prim stack at each path.
     SdfPathSet didChangePrims;
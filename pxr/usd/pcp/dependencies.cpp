@@ -84,7 +84,7 @@ Pcp_Dependencies::Add(
         const SdfPath& path)
     {
         auto iresult = _deps.emplace(layerStack, _SiteDepMap());
-        _SiteDepMap &siteDepMap = iresult.first->second;
+        _SiteDepMap &siteDepMap = iresult.first.value();
         if (iresult.second) {
             // If we inserted a new entry, bump the revision count.
             ++_layerStacksRevision;
@@ -173,7 +173,7 @@ Pcp_Dependencies::Add(
         {
             for (const TfToken &name : names) {
                 auto it = depMap.emplace(name, 0);
-                it.first->second++;
+                it.first.value()++;
             }
         };
         addNamesToDepMapFn(_possibleDynamicFileFormatArgumentFields,
@@ -340,7 +340,7 @@ Pcp_Dependencies::Remove(const PcpPrimIndex &primIndex, PcpLifeboat *lifeboat)
                         if (depMapIt->second <= 1) {
                             depMap.erase(depMapIt);
                         } else {
-                            depMapIt->second--;
+                            depMapIt.value()--;
                         }
                     }
                 }
@@ -18,6 +18,7 @@
 #include "pxr/usd/pcp/cache.h"
 #include "pxr/usd/sdf/layer.h"
 #include "pxr/usd/sdf/path.h"
+#include "pxr/base/tf/flatHashMap.h"
 
 #include <tbb/spin_mutex.h>
 
@@ -236,8 +237,10 @@ private:
     // Map of layer stacks to dependencies on that layerStack.
     // Retains references to those layer stacks, which in turn
     // retain references to their constituent layers.
-    using _LayerStackDepMap = 
-        std::unordered_map<PcpLayerStackRefPtr, _SiteDepMap, TfHash>;
+    // This map is on the hot path of every dependency query, so it uses a
+    // flat table; references into it are never held across mutations.
+    using _LayerStackDepMap =
+        TfFlatHashMap<PcpLayerStackRefPtr, _SiteDepMap, TfHash>;
     _LayerStackDepMap _deps;
 
     // A revision number that's incremented when the set of layer stacks that
@@ -261,9 +264,10 @@ private:
 
     // Map of field name to the number of cached prim indices that depend on
     // the field for dynamic file format arguments. This for quick lookup of
-    // possible file format argument relevant field changes.
-    using _FileFormatArgumentFieldDepMap = 
-        std::unordered_map<TfToken, int, TfToken::HashFunctor>;
+    // possible file format argument relevant field changes. Queried for
+    // every changed field during change processing, so it uses a flat table.
+    using _FileFormatArgumentFieldDepMap =
+        TfFlatHashMap<TfToken, int, TfToken::HashFunctor>;
     _FileFormatArgumentFieldDepMap _possibleDynamicFileFormatArgumentFields; 
     _FileFormatArgumentFieldDepMap _possibleDynamicFileFormatArgumentAttributes; 
 
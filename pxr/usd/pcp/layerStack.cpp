@@ -26,6 +26,7 @@
 #include <algorithm>
 #include <iterator>
 #include <map>
+#include <mutex>
 #include <unordered_set>
 
 using std::string;
@@ -49,6 +50,13 @@ TF_DEFINE_ENV_SETTING(
     "Disables automatic layer offset scaling from time codes per second "
     "metadata in layers.");
 
+TF_DEFINE_ENV_SETTING(
+    PCP_ENABLE_LAYER_STACK_ARC_CAPABILITIES, true,
+    "Enables scanning the layers of each layer stack for the kinds of "
+    "composition arcs they can introduce, allowing prim indexing to skip "
+    "evaluation of entire arc categories for layer stacks that cannot "
+    "contribute them.");
+
 TF_DEFINE_ENV_SETTING(
     PCP_ENABLE_LEGACY_RELOCATES_BEHAVIOR, true,
     "Enables the legacy behavior of ignoring composition errors that would "
@@ -1110,6 +1118,7 @@ PcpLayerStack::PcpLayerStack(
                 std::move(composedExpressionVars));
 
         }())
+    , _arcCapabilities(PcpArcCapabilitiesAll)
     , _isUsd(registry._IsUsd())
 
     // Note that we do not set the _registry member here. This will be
@@ -1509,6 +1518,229 @@ PcpLayerStack::_BlowRelocations()
     _relocatesPrimPaths.clear();
 }
 
+namespace {
+
+// Best-effort parallel prefetch of an entire sublayer tree.
+//
+// _BuildLayerStack opens the sublayers of a single layer in parallel, but
+// recurses into each sublayer's subtree serially, so fetches in different
+// levels of the tree are serialized against each other. This prefetcher
+// walks the whole tree with a WorkDispatcher, spawning opens for deeper
+// levels as soon as their parent layers are available, and retains the
+// opened layers so the subsequent build pass finds them in the layer
+// registry. It records no state on the layer stack and discards all
+// errors; the build pass re-applies expression evaluation, muting, and
+// error reporting authoritatively.
+class _SublayerTreePrefetcher
+{
+public:
+    _SublayerTreePrefetcher(
+        const ArResolverContext &resolverContext,
+        const SdfLayer::FileFormatArguments &defaultLayerArgs,
+        const Pcp_MutedLayers &mutedLayers,
+        const PcpExpressionVariables &expressionVariables)
+        : _resolverContext(resolverContext)
+        , _defaultLayerArgs(defaultLayerArgs)
+        , _mutedLayers(mutedLayers)
+        , _expressionVariables(expressionVariables)
+    {
+    }
+
+    // Opens all sublayers beneath \p layer, returning when the entire
+    // subtree has been visited.
+    void Prefetch(const SdfLayerHandle &layer)
+    {
+        WorkWithScopedDispatcher([&](WorkDispatcher &wd) {
+            _PrefetchSublayers(wd, layer);
+        });
+    }
+
+    // Takes the opened layers; the caller must keep these alive for as
+    // long as it wants the prefetched layers to remain in the registry.
+    std::vector<SdfLayerRefPtr> TakeRetainedLayers()
+    {
+        return std::move(_retained);
+    }
+
+private:
+    void _PrefetchSublayers(WorkDispatcher &wd, const SdfLayerHandle &layer)
+    {
+        for (std::string sublayer : layer->GetSubLayerPaths()) {
+            if (Pcp_IsVariableExpression(sublayer)) {
+                // Evaluate without recording dependencies; the build pass
+                // re-evaluates and records them on the layer stack.
+                sublayer = Pcp_EvaluateVariableExpression(
+                    sublayer, _expressionVariables);
+            }
+            if (sublayer.empty()) {
+                continue;
+            }
+
+            std::string canonicalMutedPath;
+            if (_mutedLayers.IsLayerMuted(
+                    layer, sublayer, &canonicalMutedPath)) {
+                continue;
+            }
+
+            wd.Run([this, &wd, layer, sublayer = std::move(sublayer)]() {
+                _OpenSublayer(wd, layer, sublayer);
+            });
+        }
+    }
+
+    void _OpenSublayer(
+        WorkDispatcher &wd,
+        const SdfLayerHandle &layer,
+        const std::string &sublayer)
+    {
+        // Context binding is thread-specific, so bind here.
+        ArResolverContextBinder binder(_resolverContext);
+
+        // This pass is purely a cache warmer; errors are reported by the
+        // build pass when it opens the same layers.
+        TfErrorMark m;
+
+        SdfLayer::FileFormatArguments localArgs;
+        const SdfLayer::FileFormatArguments &layerArgs =
+            Pcp_GetArgumentsForFileFormatTarget(
+                sublayer, &_defaultLayerArgs, &localArgs);
+
+        const std::string sublayerPath =
+            SdfComputeAssetPathRelativeToLayer(layer, sublayer);
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            // Skipping already-seen paths also terminates sublayer cycles,
+            // which the build pass will diagnose.
+            if (!_seenPaths.insert(sublayerPath).second) {
+                m.Clear();
+                return;
+            }
+        }
+
+        SdfLayerRefPtr sublayerRef =
+            SdfLayer::FindOrOpen(sublayerPath, layerArgs);
+        m.Clear();
+
+        if (!sublayerRef) {
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _retained.push_back(sublayerRef);
+        }
+
+        _PrefetchSublayers(wd, SdfLayerHandle(sublayerRef));
+    }
+
+    const ArResolverContext &_resolverContext;
+    const SdfLayer::FileFormatArguments &_defaultLayerArgs;
+    const Pcp_MutedLayers &_mutedLayers;
+    const PcpExpressionVariables &_expressionVariables;
+
+    std::mutex _mutex;
+    std::unordered_set<std::string> _seenPaths;
+    std::vector<SdfLayerRefPtr> _retained;
+};
+
+} // anonymous namespace
+
+// Scan the prim specs in \p layer for the presence of fields describing
+// composition arcs and return a bitmask of the PcpArcCapabilities found.
+// This descends into variants, since prim specs nested inside variants
+// may author arbitrary arcs.  Scanning stops as soon as every capability
+// has been found.
+static size_t
+_ScanLayerArcCapabilities(const SdfLayerRefPtr &layer)
+{
+    TRACE_FUNCTION();
+
+    size_t arcs = 0;
+
+    SdfPathVector pathStack;
+
+    auto addChildrenToPathStack = [&](const SdfPath &primPath) {
+        TfTokenVector childNames;
+        if (layer->HasField(
+                primPath, SdfChildrenKeys->PrimChildren, &childNames)) {
+            for (const TfToken &childName : childNames) {
+                pathStack.push_back(primPath.AppendChild(childName));
+            }
+        }
+        if (layer->HasField(
+                primPath, SdfChildrenKeys->VariantSetChildren, &childNames)) {
+            for (const TfToken &vsetName : childNames) {
+                const SdfPath vsetPath =
+                    primPath.AppendVariantSelection(vsetName.GetString(), "");
+                TfTokenVector variantNames;
+                if (layer->HasField(
+                        vsetPath, SdfChildrenKeys->VariantChildren,
+                        &variantNames)) {
+                    for (const TfToken &variantName : variantNames) {
+                        pathStack.push_back(primPath.AppendVariantSelection(
+                            vsetName.GetString(), variantName.GetString()));
+                    }
+                }
+            }
+        }
+    };
+
+    addChildrenToPathStack(SdfPath::AbsoluteRootPath());
+
+    while (!pathStack.empty()) {
+
+        SdfPath primPath = pathStack.back();
+        pathStack.pop_back();
+
+        if (layer->HasField(primPath, SdfFieldKeys->InheritPaths)) {
+            arcs |= PcpArcCapabilityInherits;
+        }
+        if (layer->HasField(primPath, SdfFieldKeys->VariantSetNames)) {
+            arcs |= PcpArcCapabilityVariants;
+        }
+        if (layer->HasField(primPath, SdfFieldKeys->References)) {
+            arcs |= PcpArcCapabilityReferences;
+        }
+        if (layer->HasField(primPath, SdfFieldKeys->Payload)) {
+            arcs |= PcpArcCapabilityPayloads;
+        }
+        if (layer->HasField(primPath, SdfFieldKeys->Specializes)) {
+            arcs |= PcpArcCapabilitySpecializes;
+        }
+
+        if (arcs == PcpArcCapabilitiesAll) {
+            return arcs;
+        }
+
+        // Push back any children.
+        addChildrenToPathStack(primPath);
+    }
+
+    return arcs;
+}
+
+void
+PcpLayerStack::_ComputeArcCapabilities()
+{
+    TRACE_FUNCTION();
+
+    // If the scan is disabled, conservatively report that every layer
+    // stack may introduce every kind of arc.
+    if (!TfGetEnvSetting(PCP_ENABLE_LAYER_STACK_ARC_CAPABILITIES)) {
+        _arcCapabilities = PcpArcCapabilitiesAll;
+        return;
+    }
+
+    _arcCapabilities = 0;
+    for (const SdfLayerRefPtr &layer : _layers) {
+        _arcCapabilities |= _ScanLayerArcCapabilities(layer);
+        if (_arcCapabilities == PcpArcCapabilitiesAll) {
+            break;
+        }
+    }
+}
+
 void
 PcpLayerStack::_Compute(const std::string &fileFormatTarget,
                         const Pcp_MutedLayers &mutedLayers)
@@ -1534,6 +1766,24 @@ PcpLayerStack::_Compute(const std::string &fileFormatTarget,
     const SdfLayer::FileFormatArguments layerArgs =
         Pcp_GetArgumentsForFileFormatTarget(fileFormatTarget);
 
+    // Warm the layer registry by opening the entire sublayer tree in
+    // parallel before the depth-first build below, so that fetches in
+    // different levels of the tree overlap. The prefetched layers are
+    // retained until the end of this function; the build pass finds them
+    // already open and its ordering is unaffected.
+    std::vector<SdfLayerRefPtr> prefetchedSublayers;
+    if (_isUsd && TfGetEnvSetting(PCP_ENABLE_PARALLEL_LAYER_PREFETCH)) {
+        TRACE_FUNCTION_SCOPE("prefetching sublayer tree");
+        _SublayerTreePrefetcher prefetcher(
+            _identifier.pathResolverContext, layerArgs, mutedLayers,
+            *_expressionVariables);
+        if (_identifier.sessionLayer) {
+            prefetcher.Prefetch(_identifier.sessionLayer);
+        }
+        prefetcher.Prefetch(_identifier.rootLayer);
+        prefetchedSublayers = prefetcher.TakeRetainedLayers();
+    }
+
     // The session owner.  This will be empty if there is no session owner
     // in the session layer.
     std::string sessionOwner;
@@ -1646,6 +1896,11 @@ PcpLayerStack::_Compute(const std::string &fileFormatTarget,
                                         &_relocatesPrimPaths,
                                         &errors);
 
+    // Compute the kinds of composition arcs that specs in this layer
+    // stack's layers may introduce, so that prim indexing can skip
+    // evaluation of arc categories that no layer can contribute.
+    _ComputeArcCapabilities();
+
     if (errors.empty()) {
         _localErrors.reset();
     } else {
@@ -33,10 +33,26 @@ TF_DECLARE_WEAK_AND_REF_PTRS(Pcp_LayerStackRegistry);
 class ArResolverContext;
 class Pcp_LayerStackRegistry;
 class Pcp_MutedLayers;
+class PcpChanges;
 class PcpExpressionVariables;
 class PcpLayerStackChanges;
 class PcpLifeboat;
 
+/// \enum PcpArcCapabilities
+///
+/// Bitfield identifying the kinds of composition arcs that prim specs in
+/// a layer stack's layers may introduce.  See
+/// PcpLayerStack::GetArcCapabilities().
+enum PcpArcCapabilities : size_t {
+    PcpArcCapabilityInherits    = 1 << 0,
+    PcpArcCapabilityVariants    = 1 << 1,
+    PcpArcCapabilityReferences  = 1 << 2,
+    PcpArcCapabilityPayloads    = 1 << 3,
+    PcpArcCapabilitySpecializes = 1 << 4,
+
+    PcpArcCapabilitiesAll = (PcpArcCapabilitySpecializes << 1) - 1
+};
+
 /// \class PcpLayerStack
 ///
 /// Represents a stack of layers that contribute opinions to composition.
@@ -210,11 +226,29 @@ public:
     PCP_API
     bool HasRelocates() const;
 
+    /// Return a conservative bitmask of PcpArcCapabilities identifying
+    /// the kinds of composition arcs that prim specs in this layer
+    /// stack's layers may introduce.  A clear bit guarantees that no prim
+    /// spec in any layer in this layer stack authors the corresponding
+    /// arc field; a set bit makes no such guarantee.  Prim indexing uses
+    /// this to skip evaluation of entire arc categories at sites in layer
+    /// stacks that cannot contribute them.
+    ///
+    /// The mask is computed when the layer stack is computed and is
+    /// conservatively widened to all capabilities when the contents of a
+    /// member layer change, since content changes do not otherwise cause
+    /// the layer stack to be recomputed.
+    size_t GetArcCapabilities() const {
+        return _arcCapabilities;
+    }
+
 private:
     // Only a registry can create a layer stack.
     friend class Pcp_LayerStackRegistry;
     // PcpCache needs access to check the _registry.
     friend class PcpCache;
+    // PcpChanges needs access to _WidenArcCapabilities.
+    friend class PcpChanges;
     // Needs access to _sublayerSourceInfo
     friend bool Pcp_NeedToRecomputeDueToAssetPathChange(const PcpLayerStackPtr&);
 
@@ -230,6 +264,16 @@ private:
     void _Compute(const std::string &fileFormatTarget,
                   const Pcp_MutedLayers &mutedLayers);
 
+    // Compute _arcCapabilities by scanning the layers in this layer stack.
+    void _ComputeArcCapabilities();
+
+    // Conservatively widen the arc capabilities to include all arc types.
+    // Called when the contents of a member layer change; the mask is
+    // recomputed the next time the layer stack itself is recomputed.
+    void _WidenArcCapabilities() {
+        _arcCapabilities = PcpArcCapabilitiesAll;
+    }
+
     SdfLayerTreeHandle _BuildLayerStack(
         const SdfLayerHandle & layer,
         const SdfLayerOffset & offset,
@@ -330,6 +374,10 @@ private:
     /// Set of expression variables this layer stack depends on.
     std::unordered_set<std::string> _expressionVariableDependencies;
 
+    /// Bitmask of PcpArcCapabilities describing the kinds of composition
+    /// arcs that prim specs in this layer stack's layers may introduce.
+    size_t _arcCapabilities;
+
     bool _isUsd;
 };
 
@@ -168,6 +168,12 @@ private:
     friend class Pcp_Statistics;
     friend struct Pcp_VariableImpl;
 
+    // Allow PcpPrimIndex_Graph to compare expressions by structural
+    // identity when sharing node pools between identical graphs.
+    // Non-variable expression nodes are interned, so two expressions
+    // with the same structure share the same node.
+    friend class PcpPrimIndex_Graph;
+
     class _Node;
     using _NodeRefPtr = TfDelegatedCountPtr<_Node>;
 
@@ -31,18 +31,24 @@
 #include "pxr/usd/ar/resolverContextBinder.h"
 #include "pxr/usd/sdf/fileFormat.h"
 #include "pxr/usd/sdf/layer.h"
+#include "pxr/usd/sdf/layerUtils.h"
 #include "pxr/base/trace/trace.h"
 #include "pxr/base/tf/debug.h"
 #include "pxr/base/tf/enum.h"
+#include "pxr/base/tf/errorMark.h"
 #include "pxr/base/tf/hash.h"
 #include "pxr/base/tf/pxrTslRobinMap/robin_set.h"
 #include "pxr/base/tf/diagnostic.h"
 #include "pxr/base/tf/envSetting.h"
 #include "pxr/base/tf/mallocTag.h"
+#include "pxr/base/work/dispatcher.h"
 
 #include <algorithm>
 #include <functional>
 #include <iostream>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 // Un-comment for extra runtime validation.
@@ -57,6 +63,13 @@ TF_DEFINE_ENV_SETTING(
     MENV30_ENABLE_NEW_DEFAULT_STANDIN_BEHAVIOR, true,
     "If enabled then standin preference is weakest opinion.");
 
+TF_DEFINE_ENV_SETTING(
+    PCP_ENABLE_DYNAMIC_FILE_FORMAT_ARGUMENT_CACHE, false,
+    "Caches dynamic file format argument computation keyed by the file "
+    "format, asset path, and composed input values, so that prim indexes "
+    "whose dynamic payloads have identical inputs invoke the file format "
+    "only once per distinct input set.");
+
 static inline PcpPrimIndex const *
 _GetOriginatingIndex(PcpPrimIndex_StackFrame *previousFrame,
                      PcpPrimIndexOutputs *outputs) {
@@ -70,6 +83,157 @@ PcpIsNewDefaultStandinBehaviorEnabled()
     return TfGetEnvSetting(MENV30_ENABLE_NEW_DEFAULT_STANDIN_BEHAVIOR);
 }
 
+TF_DEFINE_ENV_SETTING(
+    PCP_ENABLE_SPECULATIVE_LAYER_PREFETCH, false,
+    "Speculatively opens the composition dependencies (sublayers, "
+    "references, and payloads) of each layer opened for a reference or "
+    "payload arc on background threads, ahead of the serial arc "
+    "evaluation wavefront. This can hide storage latency when composing "
+    "deep reference chains from high-latency (e.g. network) storage, at "
+    "the cost of potentially opening layers that composition never needs.");
+
+namespace {
+
+// Speculative layer prefetcher. As arc evaluation opens a layer for a
+// reference or payload, this scans the layer's composition asset
+// dependencies and opens them on background threads so that the serial
+// opens further down the chain find the layers already in the layer
+// registry. Prefetched layers that themselves open successfully have
+// their own dependencies prefetched in turn, up to a fixed depth, which
+// lets the prefetch run ahead of the wavefront down deep chains.
+//
+// Speculatively opened layers are retained in a fixed-size ring so they
+// stay registered until composition has (most likely) picked them up;
+// layers composition actually uses are kept alive by their layer stacks,
+// so eviction from the ring only closes layers that turned out to be
+// unneeded.
+class Pcp_LayerPrefetcher
+{
+public:
+    void PrefetchDependencies(
+        const SdfLayerRefPtr& layer, const std::string& fileFormatTarget)
+    {
+        _EnqueueDependencies(
+            layer, fileFormatTarget, ArGetResolver().GetCurrentContext(),
+            /* depth = */ 0);
+    }
+
+private:
+    // Bound how far ahead of the wavefront speculation may run; without
+    // a limit a single prefetch could pull in an entire asset's closure,
+    // including subtrees under payloads that are never loaded.
+    static constexpr size_t _maxDepth = 8;
+    static constexpr size_t _retainedLayersCapacity = 256;
+
+    void _EnqueueDependencies(
+        const SdfLayerRefPtr& layer,
+        const std::string& fileFormatTarget,
+        const ArResolverContext& resolverContext,
+        size_t depth)
+    {
+        if (depth >= _maxDepth) {
+            return;
+        }
+
+        for (const std::string& dep :
+                 layer->GetCompositionAssetDependencies()) {
+            if (dep.empty()) {
+                continue;
+            }
+
+            // Anchor the authored path to the layer that introduced it,
+            // matching the opens performed by layer stack computation and
+            // arc evaluation.
+            std::string path =
+                SdfComputeAssetPathRelativeToLayer(layer, dep);
+            if (path.empty()) {
+                continue;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (!_visited.insert(path).second) {
+                    continue;
+                }
+            }
+
+            _dispatcher.Run(
+                [this, path = std::move(path), fileFormatTarget,
+                 resolverContext, depth]() {
+                    _OpenAndRecurse(
+                        path, fileFormatTarget, resolverContext, depth);
+                });
+        }
+    }
+
+    void _OpenAndRecurse(
+        const std::string& path,
+        const std::string& fileFormatTarget,
+        const ArResolverContext& resolverContext,
+        size_t depth)
+    {
+        // The resolver context is bound per-thread, so rebind the
+        // context that was active when the prefetch was requested.
+        ArResolverContextBinder binder(resolverContext);
+
+        // Failures encountered by speculative opens are not real errors;
+        // if composition actually needs this layer it will open it itself
+        // and report them then.
+        TfErrorMark m;
+
+        SdfLayer::FileFormatArguments args;
+        Pcp_GetArgumentsForFileFormatTarget(path, fileFormatTarget, &args);
+        SdfLayerRefPtr layer = SdfLayer::FindOrOpen(path, args);
+
+        m.Clear();
+
+        if (!layer) {
+            return;
+        }
+
+        _RetainLayer(layer);
+        _EnqueueDependencies(layer, fileFormatTarget, resolverContext,
+                             depth + 1);
+    }
+
+    void _RetainLayer(const SdfLayerRefPtr& layer)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_retainedLayers.size() < _retainedLayersCapacity) {
+            _retainedLayers.push_back(layer);
+        }
+        else {
+            _retainedLayers[_nextRetainedIndex] = layer;
+        }
+        _nextRetainedIndex =
+            (_nextRetainedIndex + 1) % _retainedLayersCapacity;
+    }
+
+    WorkDispatcher _dispatcher;
+    std::mutex _mutex;
+    pxr_tsl::robin_set<std::string, TfHash> _visited;
+    std::vector<SdfLayerRefPtr> _retainedLayers;
+    size_t _nextRetainedIndex = 0;
+};
+
+} // anonymous namespace
+
+static void
+_SpeculativelyPrefetchDependencies(
+    const SdfLayerRefPtr& layer, const std::string& fileFormatTarget)
+{
+    static const bool enabled =
+        TfGetEnvSetting(PCP_ENABLE_SPECULATIVE_LAYER_PREFETCH);
+    if (!enabled) {
+        return;
+    }
+
+    // Deliberately leaked so that in-flight prefetch tasks are never
+    // waited on; composition never blocks on speculative work.
+    static Pcp_LayerPrefetcher& prefetcher = *new Pcp_LayerPrefetcher;
+    prefetcher.PrefetchDependencies(layer, fileFormatTarget);
+}
+
 ////////////////////////////////////////////////////////////////////////
 
 PcpPrimIndex::PcpPrimIndex()
@@ -663,14 +827,16 @@ _CreateMapExpressionForArc(const SdfPath &sourcePath,
     return arcExpr;
 }
 
-// Bitfield of composition arc types
+// Bitfield of composition arc types. The spec-field-driven flags share
+// bit values with PcpArcCapabilities so that a layer stack's capability
+// mask can be applied to these flags directly.
 enum _ArcFlags {
-    _ArcFlagInherits    = 1<<0,
-    _ArcFlagVariants    = 1<<1,
-    _ArcFlagReferences  = 1<<2,
-    _ArcFlagPayloads    = 1<<3,
-    _ArcFlagSpecializes = 1<<4,
-    _ArcFlagRelocates   = 1<<5
+    _ArcFlagInherits    = PcpArcCapabilityInherits,
+    _ArcFlagVariants    = PcpArcCapabilityVariants,
+    _ArcFlagReferences  = PcpArcCapabilityReferences,
+    _ArcFlagPayloads    = PcpArcCapabilityPayloads,
+    _ArcFlagSpecializes = PcpArcCapabilitySpecializes,
+    _ArcFlagRelocates   = PcpArcCapabilitySpecializes << 1
 };
 
 // Scan a node's specs for presence of fields describing composition arcs.
@@ -696,25 +862,38 @@ _ScanArcs(PcpNodeRef const& node)
         return arcs;
     }
 
+    // The layer stack tracks which kinds of arcs specs in its layers may
+    // introduce, letting us skip scanning for entire arc categories that
+    // no layer can contribute.
+    const size_t capabilities = node.GetLayerStack()->GetArcCapabilities();
+    if (capabilities == 0) {
+        return arcs;
+    }
+
     SdfPath const& path = node.GetPath();
     for (SdfLayerRefPtr const& layer: node.GetLayerStack()->GetLayers()) {
         SdfLayer const *layerPtr = get_pointer(layer);
         if (!layerPtr->HasSpec(path)) {
             continue;
         }
-        if (layerPtr->HasField(path, SdfFieldKeys->InheritPaths)) {
+        if ((capabilities & _ArcFlagInherits) &&
+            layerPtr->HasField(path, SdfFieldKeys->InheritPaths)) {
             arcs |= _ArcFlagInherits;
         }
-        if (layerPtr->HasField(path, SdfFieldKeys->VariantSetNames)) {
+        if ((capabilities & _ArcFlagVariants) &&
+            layerPtr->HasField(path, SdfFieldKeys->VariantSetNames)) {
             arcs |= _ArcFlagVariants;
         }
-        if (layerPtr->HasField(path, SdfFieldKeys->References)) {
+        if ((capabilities & _ArcFlagReferences) &&
+            layerPtr->HasField(path, SdfFieldKeys->References)) {
             arcs |= _ArcFlagReferences;
         }
-        if (layerPtr->HasField(path, SdfFieldKeys->Payload)) {
+        if ((capabilities & _ArcFlagPayloads) &&
+            layerPtr->HasField(path, SdfFieldKeys->Payload)) {
             arcs |= _ArcFlagPayloads;
         }
-        if (layerPtr->HasField(path, SdfFieldKeys->Specializes)) {
+        if ((capabilities & _ArcFlagSpecializes) &&
+            layerPtr->HasField(path, SdfFieldKeys->Specializes)) {
             arcs |= _ArcFlagSpecializes;
         }
     }
@@ -749,20 +928,31 @@ _ScanAncestralArcs(PcpNodeRef const& node)
 
     size_t arcs = 0;
     PcpLayerStackRefPtr const& layerStack = node.GetLayerStack();
+
+    // Skip the ancestral scan entirely if no layer in the layer stack can
+    // contribute payload or variant arcs.
+    const size_t capabilities = layerStack->GetArcCapabilities() &
+        (_ArcFlagPayloads | _ArcFlagVariants);
+    if (capabilities == 0) {
+        return arcs;
+    }
+
     for (; !path.IsAbsoluteRootPath(); path = path.GetParentPath()) {
         for (SdfLayerRefPtr const& layer : layerStack->GetLayers()) {
-            if (layer->HasField(path, SdfFieldKeys->Payload)) {
+            if ((capabilities & _ArcFlagPayloads) &&
+                layer->HasField(path, SdfFieldKeys->Payload)) {
                 arcs |= _ArcFlagPayloads;
             }
 
-            if (layer->HasField(path, SdfFieldKeys->VariantSetNames)) {
+            if ((capabilities & _ArcFlagVariants) &&
+                layer->HasField(path, SdfFieldKeys->VariantSetNames)) {
                 arcs |= _ArcFlagVariants;
             }
         }
     }
 
     return arcs;
-}  
+}
 
 ////////////////////////////////////////////////////////////////////////
 
@@ -2054,7 +2244,203 @@ static PcpDynamicFileFormatInterface* _GetDynamicFileFormat(
     return dynamicFileFormat;
 }
 
-// Generates dynamic file format arguments for a payload's asset path if the 
+namespace {
+
+// Memoizes dynamic file format argument computation.
+//
+// ComposeFieldsForFileFormatArguments is required to be a deterministic
+// function of the asset path and the field and attribute values it
+// composes -- change processing already relies on this to invalidate
+// prim indexes when those values change. So its results can be cached
+// keyed by the file format, asset path, and the composed input values.
+// Scenes with many dynamic payloads sharing the same inputs then invoke
+// the file format once per distinct input set rather than once per prim,
+// and because the key holds the input values themselves, a recomputation
+// after a change only misses when the inputs actually differ.
+class _DynamicFormatArgsCache
+{
+public:
+    // Equivalent to fileFormat->ComposeFieldsForFileFormatArguments(...),
+    // but serves repeated computations with identical inputs from a cache.
+    // Composed field and attribute names are recorded through \p context
+    // into the caller's name sets as usual.
+    void ComposeFieldsForFileFormatArguments(
+        const PcpDynamicFileFormatInterface *fileFormat,
+        const std::string &assetPath,
+        const PcpDynamicFileFormatContext &context,
+        const TfToken::Set &composedFieldNames,
+        const TfToken::Set &composedAttributeNames,
+        SdfLayer::FileFormatArguments *args,
+        VtValue *dependencyContextData)
+    {
+        // Look up the input names recorded by previous computations for
+        // this file format and asset path. Without them we cannot build
+        // a key without running the file format.
+        _InputNames inputNames;
+        bool haveInputNames = false;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            const auto it = _inputNames.find({fileFormat, assetPath});
+            if (it != _inputNames.end()) {
+                inputNames = it->second;
+                haveInputNames = true;
+            }
+        }
+
+        if (haveInputNames) {
+            const _Key key =
+                _MakeKey(fileFormat, assetPath, inputNames, context);
+            std::lock_guard<std::mutex> lock(_mutex);
+            const auto it = _entries.find(key);
+            if (it != _entries.end()) {
+                args->insert(it->second.args.begin(), it->second.args.end());
+                *dependencyContextData = it->second.dependencyContextData;
+                return;
+            }
+        }
+
+        // Run the file format with a scratch argument dictionary so the
+        // cache entry holds only the arguments it generated.
+        SdfLayer::FileFormatArguments generatedArgs;
+        fileFormat->ComposeFieldsForFileFormatArguments(
+            assetPath, context, &generatedArgs, dependencyContextData);
+
+        // The file format may have composed inputs we did not probe, e.g.
+        // on the first computation or when changed values steer it to
+        // different fields. Record the union of input names and key the
+        // result on the values of the union; re-composing already-composed
+        // names is idempotent, so this does not widen the dependency sets.
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _InputNames &recorded = _inputNames[{fileFormat, assetPath}];
+            recorded.fieldNames.insert(
+                composedFieldNames.begin(), composedFieldNames.end());
+            recorded.attributeNames.insert(
+                composedAttributeNames.begin(),
+                composedAttributeNames.end());
+            inputNames = recorded;
+        }
+
+        _Key key = _MakeKey(fileFormat, assetPath, inputNames, context);
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            // Guard against unbounded growth; distinct input sets should
+            // be few, but a misbehaving format could defeat the cache.
+            if (_entries.size() >= _maxEntries) {
+                _entries.clear();
+            }
+            _entries.emplace(
+                std::move(key),
+                _Entry{generatedArgs, *dependencyContextData});
+        }
+
+        args->insert(generatedArgs.begin(), generatedArgs.end());
+    }
+
+private:
+    struct _InputNames {
+        TfToken::Set fieldNames;
+        TfToken::Set attributeNames;
+    };
+
+    struct _NamesKey {
+        const PcpDynamicFileFormatInterface *fileFormat;
+        std::string assetPath;
+
+        bool operator==(const _NamesKey &rhs) const {
+            return fileFormat == rhs.fileFormat &&
+                assetPath == rhs.assetPath;
+        }
+    };
+
+    struct _NamesKeyHash {
+        size_t operator()(const _NamesKey &key) const {
+            return TfHash::Combine(key.fileFormat, key.assetPath);
+        }
+    };
+
+    struct _Key {
+        const PcpDynamicFileFormatInterface *fileFormat = nullptr;
+        std::string assetPath;
+        // Composed opinions for each input, strongest to weakest; the
+        // full stacks are needed because file formats may consume more
+        // than the strongest opinion via ComposeValueStack.
+        std::vector<std::pair<
+            TfToken, PcpDynamicFileFormatContext::VtValueVector>> fields;
+        std::vector<std::pair<TfToken, VtValue>> attributes;
+
+        bool operator==(const _Key &rhs) const {
+            return fileFormat == rhs.fileFormat &&
+                assetPath == rhs.assetPath &&
+                fields == rhs.fields &&
+                attributes == rhs.attributes;
+        }
+    };
+
+    struct _KeyHash {
+        size_t operator()(const _Key &key) const {
+            size_t hash = TfHash::Combine(key.fileFormat, key.assetPath);
+            for (const auto &field : key.fields) {
+                hash = TfHash::Combine(hash, field.first);
+                for (const VtValue &value : field.second) {
+                    hash = TfHash::Combine(hash, value.GetHash());
+                }
+            }
+            for (const auto &attr : key.attributes) {
+                hash = TfHash::Combine(
+                    hash, attr.first, attr.second.GetHash());
+            }
+            return hash;
+        }
+    };
+
+    struct _Entry {
+        SdfLayer::FileFormatArguments args;
+        VtValue dependencyContextData;
+    };
+
+    static _Key _MakeKey(
+        const PcpDynamicFileFormatInterface *fileFormat,
+        const std::string &assetPath,
+        const _InputNames &inputNames,
+        const PcpDynamicFileFormatContext &context)
+    {
+        _Key key;
+        key.fileFormat = fileFormat;
+        key.assetPath = assetPath;
+        key.fields.reserve(inputNames.fieldNames.size());
+        for (const TfToken &field : inputNames.fieldNames) {
+            PcpDynamicFileFormatContext::VtValueVector values;
+            context.ComposeValueStack(field, &values);
+            key.fields.emplace_back(field, std::move(values));
+        }
+        key.attributes.reserve(inputNames.attributeNames.size());
+        for (const TfToken &attr : inputNames.attributeNames) {
+            VtValue value;
+            context.ComposeAttributeDefaultValue(attr, &value);
+            key.attributes.emplace_back(attr, std::move(value));
+        }
+        return key;
+    }
+
+    static constexpr size_t _maxEntries = 16384;
+
+    std::mutex _mutex;
+    std::unordered_map<_NamesKey, _InputNames, _NamesKeyHash> _inputNames;
+    std::unordered_map<_Key, _Entry, _KeyHash> _entries;
+};
+
+_DynamicFormatArgsCache&
+_GetDynamicFormatArgsCache()
+{
+    static _DynamicFormatArgsCache cache;
+    return cache;
+}
+
+} // anonymous namespace
+
+// Generates dynamic file format arguments for a payload's asset path if the
 // asset's file format supports it.
 static void
 _ComposeFieldsForFileFormatArguments(const PcpNodeRef &node,
@@ -2079,11 +2465,19 @@ _ComposeFieldsForFileFormatArguments(const PcpNodeRef &node,
     PcpDynamicFileFormatContext context = Pcp_CreateDynamicFileFormatContext(
         node, nodePathAtIntroduction, arcNum, indexer.previousFrame, 
         &composedFieldNames, &composedAttributeNames);
-    // Ask the file format to generate dynamic file format arguments for 
+    // Ask the file format to generate dynamic file format arguments for
     // the asset in this context.
     VtValue dependencyContextData;
-    dynamicFileFormat->ComposeFieldsForFileFormatArguments(
-        payload.GetAssetPath(), context, args, &dependencyContextData);
+    if (TfGetEnvSetting(PCP_ENABLE_DYNAMIC_FILE_FORMAT_ARGUMENT_CACHE)) {
+        _GetDynamicFormatArgsCache().ComposeFieldsForFileFormatArguments(
+            dynamicFileFormat, payload.GetAssetPath(), context,
+            composedFieldNames, composedAttributeNames, args,
+            &dependencyContextData);
+    }
+    else {
+        dynamicFileFormat->ComposeFieldsForFileFormatArguments(
+            payload.GetAssetPath(), context, args, &dependencyContextData);
+    }
 
     // Add this dependency context to dynamic file format dependency object.
     indexer.outputs->dynamicFileFormatDependency.AddDependencyContext(
@@ -2238,6 +2632,13 @@ _EvalRefOrPayloadArcs(PcpNodeRef node,
                 continue;
             }
 
+            // Speculatively open this layer's own composition dependencies
+            // in the background so that arc evaluation further down the
+            // chain finds them already open. See
+            // PCP_ENABLE_SPECULATIVE_LAYER_PREFETCH.
+            _SpeculativelyPrefetchDependencies(
+                layer, indexer->inputs.fileFormatTarget);
+
             const ArResolverContext& pathResolverContext =
                 node.GetLayerStack()->GetIdentifier().pathResolverContext;
             
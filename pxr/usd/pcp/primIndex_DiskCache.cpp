@@ -0,0 +1,641 @@
+//
+// Copyright 2026 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+#include "pxr/pxr.h"
+#include "pxr/usd/pcp/primIndex_DiskCache.h"
+
+#include "pxr/usd/pcp/arc.h"
+#include "pxr/usd/pcp/cache.h"
+#include "pxr/usd/pcp/dependencies.h"
+#include "pxr/usd/pcp/layerStack.h"
+#include "pxr/usd/pcp/layerStackIdentifier.h"
+#include "pxr/usd/pcp/mapExpression.h"
+#include "pxr/usd/pcp/mapFunction.h"
+#include "pxr/usd/pcp/node.h"
+#include "pxr/usd/pcp/primIndex.h"
+#include "pxr/usd/pcp/primIndex_Graph.h"
+#include "pxr/usd/pcp/site.h"
+#include "pxr/usd/pcp/types.h"
+
+#include "pxr/usd/ar/resolver.h"
+#include "pxr/usd/ar/resolvedPath.h"
+#include "pxr/usd/ar/timestamp.h"
+#include "pxr/usd/sdf/layer.h"
+#include "pxr/usd/sdf/layerOffset.h"
+#include "pxr/usd/sdf/path.h"
+
+#include "pxr/base/tf/diagnostic.h"
+#include "pxr/base/tf/hash.h"
+#include "pxr/base/trace/trace.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+namespace {
+
+constexpr uint32_t _FileMagic = 0x50637043; // 'PcpC'
+constexpr uint32_t _FileVersion = 2;
+
+// ------------------------------------------------------------------------
+// Low-level binary I/O helpers.
+
+template <class T>
+void _Write(std::ostream &out, const T &value)
+{
+    static_assert(std::is_trivially_copyable<T>::value, "");
+    out.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+void _WriteString(std::ostream &out, const std::string &s)
+{
+    _Write<uint64_t>(out, s.size());
+    out.write(s.data(), s.size());
+}
+
+template <class T>
+bool _Read(std::istream &in, T *value)
+{
+    static_assert(std::is_trivially_copyable<T>::value, "");
+    in.read(reinterpret_cast<char *>(value), sizeof(T));
+    return static_cast<bool>(in);
+}
+
+bool _ReadString(std::istream &in, std::string *s)
+{
+    uint64_t size = 0;
+    if (!_Read(in, &size)) {
+        return false;
+    }
+    s->resize(size);
+    in.read(&(*s)[0], size);
+    return static_cast<bool>(in);
+}
+
+// ------------------------------------------------------------------------
+// Validation entries for contributing layers.  Anonymous layers have no
+// resolved path or timestamp; they can only be revalidated by checking
+// that a layer with the same identifier is still registered.
+
+struct _LayerRecord
+{
+    std::string identifier;
+    std::string resolvedPath;
+    double timestamp;
+    bool anonymous;
+};
+
+_LayerRecord
+_MakeLayerRecord(const SdfLayerHandle &layer)
+{
+    _LayerRecord rec;
+    rec.identifier = layer->GetIdentifier();
+    rec.anonymous = layer->IsAnonymous();
+    rec.timestamp = 0.0;
+    if (!rec.anonymous) {
+        rec.resolvedPath = layer->GetResolvedPath().GetPathString();
+        const ArTimestamp stamp = ArGetResolver().GetModificationTimestamp(
+            rec.identifier, ArResolvedPath(rec.resolvedPath));
+        if (stamp.IsValid()) {
+            rec.timestamp = stamp.GetTime();
+        }
+    }
+    return rec;
+}
+
+bool
+_ValidateLayerRecord(const _LayerRecord &rec)
+{
+    if (rec.anonymous) {
+        // We cannot validate the contents of an anonymous layer; require
+        // that a layer with the same identifier is still registered and
+        // assume the caller has kept it alive unmodified.
+        return bool(SdfLayer::Find(rec.identifier));
+    }
+    const ArResolvedPath resolvedPath =
+        ArGetResolver().Resolve(rec.identifier);
+    if (resolvedPath.GetPathString() != rec.resolvedPath) {
+        return false;
+    }
+    const ArTimestamp stamp = ArGetResolver().GetModificationTimestamp(
+        rec.identifier, resolvedPath);
+    return stamp.IsValid() && stamp.GetTime() == rec.timestamp;
+}
+
+// ------------------------------------------------------------------------
+// Map function serialization.
+
+void
+_WriteMapFunction(std::ostream &out, const PcpMapFunction &fn)
+{
+    const PcpMapFunction::PathMap pathMap = fn.GetSourceToTargetMap();
+    _Write<uint32_t>(out, pathMap.size());
+    for (const auto &entry : pathMap) {
+        _WriteString(out, entry.first.GetAsString());
+        _WriteString(out, entry.second.GetAsString());
+    }
+    _Write<double>(out, fn.GetTimeOffset().GetOffset());
+    _Write<double>(out, fn.GetTimeOffset().GetScale());
+}
+
+bool
+_ReadMapFunction(std::istream &in, PcpMapFunction *fn)
+{
+    uint32_t numPairs = 0;
+    if (!_Read(in, &numPairs)) {
+        return false;
+    }
+    PcpMapFunction::PathMap pathMap;
+    for (uint32_t i = 0; i != numPairs; ++i) {
+        std::string source, target;
+        if (!_ReadString(in, &source) || !_ReadString(in, &target)) {
+            return false;
+        }
+        pathMap[SdfPath(source)] = SdfPath(target);
+    }
+    double offset = 0.0, scale = 1.0;
+    if (!_Read(in, &offset) || !_Read(in, &scale)) {
+        return false;
+    }
+    *fn = PcpMapFunction::Create(pathMap, SdfLayerOffset(offset, scale));
+    return true;
+}
+
+// Per-node flags, packed into a byte.
+enum _NodeFlags : uint8_t {
+    _FlagInert         = 1 << 0,
+    _FlagCulled        = 1 << 1,
+    _FlagRestricted    = 1 << 2,
+    _FlagHasSpecs      = 1 << 3,
+    _FlagHasSymmetry   = 1 << 4,
+    _FlagDueToAncestor = 1 << 5
+};
+
+uint8_t
+_PackNodeFlags(const PcpNodeRef &node)
+{
+    uint8_t flags = 0;
+    if (node.IsInert())        { flags |= _FlagInert; }
+    if (node.IsCulled())       { flags |= _FlagCulled; }
+    if (node.IsRestricted())   { flags |= _FlagRestricted; }
+    if (node.HasSpecs())       { flags |= _FlagHasSpecs; }
+    if (node.HasSymmetry())    { flags |= _FlagHasSymmetry; }
+    if (node.IsDueToAncestor()){ flags |= _FlagDueToAncestor; }
+    return flags;
+}
+
+void
+_ApplyNodeFlags(PcpNodeRef node, uint8_t flags, uint8_t permission)
+{
+    node.SetInert(flags & _FlagInert);
+    node.SetCulled(flags & _FlagCulled);
+    node.SetRestricted(flags & _FlagRestricted);
+    node.SetHasSpecs(flags & _FlagHasSpecs);
+    node.SetHasSymmetry(flags & _FlagHasSymmetry);
+    node.SetIsDueToAncestor(flags & _FlagDueToAncestor);
+    node.SetPermission(static_cast<SdfPermission>(permission));
+}
+
+} // anonymous namespace
+
+bool
+Pcp_PrimIndexDiskCache::Write(
+    const PcpCache &cache, const std::string &filePath)
+{
+    TRACE_FUNCTION();
+
+    // Gather the layer stacks and layers used by all valid prim indexes,
+    // assigning each a stable table index.
+    std::map<PcpLayerStackRefPtr, uint32_t> layerStackIndexes;
+    std::vector<PcpLayerStackRefPtr> layerStacks;
+    std::map<SdfLayerHandle, uint32_t> layerIndexes;
+    std::vector<_LayerRecord> layerRecords;
+
+    const auto getLayerIndex = [&](const SdfLayerHandle &layer) {
+        auto inserted = layerIndexes.emplace(layer, layerIndexes.size());
+        if (inserted.second) {
+            layerRecords.push_back(_MakeLayerRecord(layer));
+        }
+        return inserted.first->second;
+    };
+
+    const auto getLayerStackIndex = [&](const PcpLayerStackRefPtr &stack) {
+        auto inserted =
+            layerStackIndexes.emplace(stack, layerStackIndexes.size());
+        if (inserted.second) {
+            layerStacks.push_back(stack);
+            for (const SdfLayerHandle &layer : stack->GetLayers()) {
+                getLayerIndex(layer);
+            }
+        }
+        return inserted.first->second;
+    };
+
+    // Serialize prim indexes into a memory buffer first so that the
+    // layer and layer stack tables, which are discovered along the way,
+    // can be written ahead of them in the file.
+    std::ostringstream indexData;
+    uint64_t numIndexes = 0;
+
+    for (const auto &entry : cache._primIndexCache) {
+        const SdfPath &path = entry.first;
+        const PcpPrimIndex &index = entry.second;
+        if (!index.IsValid()) {
+            continue;
+        }
+
+        // Indexes carrying side-band dependency state that this format
+        // does not serialize -- culled-node dependencies and dynamic
+        // file format argument dependencies -- are skipped; restoring
+        // them with empty dependency data would silently drop the
+        // invalidation those dependencies provide.  Skipped indexes are
+        // recomputed on demand after load.
+        if (!cache._primDependencies->GetCulledDependencies(path).empty() ||
+            !cache._primDependencies->
+                GetDynamicFileFormatArgumentDependencyData(path).IsEmpty()) {
+            continue;
+        }
+
+        // Collect nodes in strength order and map them to serial indexes.
+        std::vector<PcpNodeRef> nodes;
+        std::unordered_map<PcpNodeRef, int32_t, PcpNodeRef::Hash> nodeIndexes;
+        for (const PcpNodeRef &node : index.GetNodeRange()) {
+            nodeIndexes[node] = static_cast<int32_t>(nodes.size());
+            nodes.push_back(node);
+        }
+
+        // Likewise skip indexes that depend on expression variables from
+        // any of their layer stacks.
+        const bool hasExprVarDeps = std::any_of(
+            nodes.begin(), nodes.end(), [&](const PcpNodeRef &node) {
+                return !cache._primDependencies->
+                    GetExpressionVariablesFromLayerStackUsedByPrim(
+                        path, node.GetLayerStack()).empty();
+            });
+        if (hasExprVarDeps) {
+            continue;
+        }
+
+        _WriteString(indexData, path.GetAsString());
+        const PcpPrimIndex_GraphRefPtr &graph = index.GetGraph();
+        _Write<uint8_t>(indexData, graph->HasPayloads() ? 1 : 0);
+        _Write<uint8_t>(indexData, graph->IsInstanceable() ? 1 : 0);
+        _Write<uint32_t>(indexData, nodes.size());
+
+        for (const PcpNodeRef &node : nodes) {
+            int32_t parentIdx = -1, originIdx = -1;
+            if (const PcpNodeRef parent = node.GetParentNode()) {
+                parentIdx = nodeIndexes[parent];
+            }
+            if (const PcpNodeRef origin = node.GetOriginNode()) {
+                if (origin != node.GetParentNode()) {
+                    originIdx = nodeIndexes[origin];
+                }
+            }
+            _Write<int32_t>(indexData, parentIdx);
+            _Write<int32_t>(indexData, originIdx);
+            _Write<uint8_t>(indexData, node.GetArcType());
+            _Write<uint32_t>(
+                indexData, getLayerStackIndex(node.GetLayerStack()));
+            _WriteString(indexData, node.GetPath().GetAsString());
+            _WriteMapFunction(indexData, node.GetMapToParent().Evaluate());
+            _Write<int32_t>(indexData, node.GetSiblingNumAtOrigin());
+            _Write<int32_t>(indexData, node.GetNamespaceDepth());
+            _Write<uint8_t>(indexData, _PackNodeFlags(node));
+            _Write<uint8_t>(indexData, node.GetPermission());
+        }
+        ++numIndexes;
+    }
+
+    std::ofstream out(filePath, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        TF_WARN("Unable to open prim index cache file <%s> for writing",
+                filePath.c_str());
+        return false;
+    }
+
+    _Write(out, _FileMagic);
+    _Write(out, _FileVersion);
+
+    // Composition parameters that must match on load.
+    _Write<uint8_t>(out, cache.IsUsd() ? 1 : 0);
+    const PcpVariantFallbackMap fallbacks = cache.GetVariantFallbacks();
+    _Write<uint32_t>(out, fallbacks.size());
+    for (const auto &fallback : fallbacks) {
+        _WriteString(out, fallback.first);
+        _Write<uint32_t>(out, fallback.second.size());
+        for (const std::string &value : fallback.second) {
+            _WriteString(out, value);
+        }
+    }
+    const std::vector<std::string> &mutedLayers = cache.GetMutedLayers();
+    _Write<uint32_t>(out, mutedLayers.size());
+    for (const std::string &muted : mutedLayers) {
+        _WriteString(out, muted);
+    }
+
+    // The included-payloads set is an evaluation parameter like variant
+    // fallbacks and muted layers: indexes were computed against it, so
+    // it must match on load.  Written sorted for determinism.
+    const PcpCache::PayloadSet &includedPayloads = cache.GetIncludedPayloads();
+    SdfPathVector payloadPaths(
+        includedPayloads.begin(), includedPayloads.end());
+    std::sort(payloadPaths.begin(), payloadPaths.end());
+    _Write<uint32_t>(out, payloadPaths.size());
+    for (const SdfPath &payloadPath : payloadPaths) {
+        _WriteString(out, payloadPath.GetAsString());
+    }
+
+    // Layer validation table.
+    _Write<uint32_t>(out, layerRecords.size());
+    for (const _LayerRecord &rec : layerRecords) {
+        _WriteString(out, rec.identifier);
+        _WriteString(out, rec.resolvedPath);
+        _Write(out, rec.timestamp);
+        _Write<uint8_t>(out, rec.anonymous ? 1 : 0);
+    }
+
+    // Layer stack table: each stack is identified by its root and
+    // (optional) session layer; the resolver context is taken from the
+    // cache at load time.
+    _Write<uint32_t>(out, layerStacks.size());
+    for (const PcpLayerStackRefPtr &stack : layerStacks) {
+        const PcpLayerStackIdentifier &id = stack->GetIdentifier();
+        _Write<int32_t>(out, getLayerIndex(id.rootLayer));
+        _Write<int32_t>(out, id.sessionLayer
+                        ? static_cast<int32_t>(getLayerIndex(id.sessionLayer))
+                        : -1);
+    }
+
+    _Write(out, numIndexes);
+    const std::string data = indexData.str();
+    out.write(data.data(), data.size());
+
+    if (!out) {
+        TF_WARN("Error writing prim index cache file <%s>",
+                filePath.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool
+Pcp_PrimIndexDiskCache::Read(PcpCache *cache, const std::string &filePath)
+{
+    TRACE_FUNCTION();
+
+    std::ifstream in(filePath, std::ios::binary);
+    if (!in) {
+        return false;
+    }
+
+    uint32_t magic = 0, version = 0;
+    if (!_Read(in, &magic) || !_Read(in, &version) ||
+        magic != _FileMagic || version != _FileVersion) {
+        return false;
+    }
+
+    // Composition parameters must match the current cache exactly.
+    uint8_t usd = 0;
+    if (!_Read(in, &usd) || bool(usd) != cache->IsUsd()) {
+        return false;
+    }
+    uint32_t numFallbacks = 0;
+    if (!_Read(in, &numFallbacks)) {
+        return false;
+    }
+    PcpVariantFallbackMap fallbacks;
+    for (uint32_t i = 0; i != numFallbacks; ++i) {
+        std::string name;
+        uint32_t numValues = 0;
+        if (!_ReadString(in, &name) || !_Read(in, &numValues)) {
+            return false;
+        }
+        std::vector<std::string> &values = fallbacks[name];
+        values.resize(numValues);
+        for (std::string &value : values) {
+            if (!_ReadString(in, &value)) {
+                return false;
+            }
+        }
+    }
+    if (fallbacks != cache->GetVariantFallbacks()) {
+        return false;
+    }
+    uint32_t numMuted = 0;
+    if (!_Read(in, &numMuted)) {
+        return false;
+    }
+    std::vector<std::string> mutedLayers(numMuted);
+    for (std::string &muted : mutedLayers) {
+        if (!_ReadString(in, &muted)) {
+            return false;
+        }
+    }
+    if (mutedLayers != cache->GetMutedLayers()) {
+        return false;
+    }
+    uint32_t numPayloads = 0;
+    if (!_Read(in, &numPayloads)) {
+        return false;
+    }
+    PcpCache::PayloadSet includedPayloads;
+    for (uint32_t i = 0; i != numPayloads; ++i) {
+        std::string payloadPath;
+        if (!_ReadString(in, &payloadPath)) {
+            return false;
+        }
+        includedPayloads.insert(SdfPath(payloadPath));
+    }
+    if (includedPayloads != cache->GetIncludedPayloads()) {
+        return false;
+    }
+
+    // Revalidate every contributing layer before touching the cache.
+    uint32_t numLayers = 0;
+    if (!_Read(in, &numLayers)) {
+        return false;
+    }
+    std::vector<_LayerRecord> layerRecords(numLayers);
+    for (_LayerRecord &rec : layerRecords) {
+        uint8_t anonymous = 0;
+        if (!_ReadString(in, &rec.identifier) ||
+            !_ReadString(in, &rec.resolvedPath) ||
+            !_Read(in, &rec.timestamp) ||
+            !_Read(in, &anonymous)) {
+            return false;
+        }
+        rec.anonymous = anonymous;
+        if (!_ValidateLayerRecord(rec)) {
+            return false;
+        }
+    }
+
+    // Recreate layer stacks through the cache so they are registered
+    // with its layer stack registry and dependency tracking.
+    uint32_t numLayerStacks = 0;
+    if (!_Read(in, &numLayerStacks)) {
+        return false;
+    }
+    const PcpLayerStackIdentifier &cacheId = cache->GetLayerStackIdentifier();
+    std::vector<PcpLayerStackRefPtr> layerStacks(numLayerStacks);
+    for (PcpLayerStackRefPtr &stack : layerStacks) {
+        int32_t rootIdx = -1, sessionIdx = -1;
+        if (!_Read(in, &rootIdx) || !_Read(in, &sessionIdx) ||
+            rootIdx < 0 || static_cast<uint32_t>(rootIdx) >= numLayers ||
+            sessionIdx >= static_cast<int32_t>(numLayers)) {
+            return false;
+        }
+        const SdfLayerRefPtr rootLayer =
+            SdfLayer::FindOrOpen(layerRecords[rootIdx].identifier);
+        if (!rootLayer) {
+            return false;
+        }
+        SdfLayerRefPtr sessionLayer;
+        if (sessionIdx >= 0) {
+            sessionLayer =
+                SdfLayer::FindOrOpen(layerRecords[sessionIdx].identifier);
+            if (!sessionLayer) {
+                return false;
+            }
+        }
+        PcpErrorVector errors;
+        stack = cache->ComputeLayerStack(
+            PcpLayerStackIdentifier(
+                rootLayer, sessionLayer, cacheId.pathResolverContext,
+                cacheId.expressionVariablesOverrideSource),
+            &errors);
+        if (!stack || !errors.empty()) {
+            return false;
+        }
+    }
+
+    // Reconstruct prim indexes.  Build everything up front so a
+    // malformed file cannot leave the cache partially populated.
+    uint64_t numIndexes = 0;
+    if (!_Read(in, &numIndexes)) {
+        return false;
+    }
+    std::vector<std::pair<SdfPath, PcpPrimIndex>> indexes;
+    indexes.reserve(numIndexes);
+
+    for (uint64_t i = 0; i != numIndexes; ++i) {
+        std::string pathStr;
+        uint8_t hasPayloads = 0, instanceable = 0;
+        uint32_t numNodes = 0;
+        if (!_ReadString(in, &pathStr) ||
+            !_Read(in, &hasPayloads) ||
+            !_Read(in, &instanceable) ||
+            !_Read(in, &numNodes) ||
+            numNodes == 0) {
+            return false;
+        }
+        const SdfPath path(pathStr);
+        if (path.IsEmpty()) {
+            return false;
+        }
+
+        PcpPrimIndex_GraphRefPtr graph;
+        std::vector<PcpNodeRef> nodes;
+        nodes.reserve(numNodes);
+
+        for (uint32_t n = 0; n != numNodes; ++n) {
+            int32_t parentIdx = -1, originIdx = -1;
+            uint8_t arcType = 0, flags = 0, permission = 0;
+            uint32_t layerStackIdx = 0;
+            std::string sitePathStr;
+            PcpMapFunction mapToParent;
+            int32_t siblingNum = 0, namespaceDepth = 0;
+            if (!_Read(in, &parentIdx) ||
+                !_Read(in, &originIdx) ||
+                !_Read(in, &arcType) ||
+                !_Read(in, &layerStackIdx) ||
+                !_ReadString(in, &sitePathStr) ||
+                !_ReadMapFunction(in, &mapToParent) ||
+                !_Read(in, &siblingNum) ||
+                !_Read(in, &namespaceDepth) ||
+                !_Read(in, &flags) ||
+                !_Read(in, &permission) ||
+                layerStackIdx >= layerStacks.size()) {
+                return false;
+            }
+            const PcpLayerStackSite site(
+                layerStacks[layerStackIdx], SdfPath(sitePathStr));
+
+            if (n == 0) {
+                // Root node; parent must be unset.
+                if (parentIdx != -1) {
+                    return false;
+                }
+                graph = PcpPrimIndex_Graph::New(site, cache->IsUsd());
+                nodes.push_back(graph->GetRootNode());
+            }
+            else {
+                if (parentIdx < 0 ||
+                    static_cast<uint32_t>(parentIdx) >= nodes.size() ||
+                    originIdx >= static_cast<int32_t>(nodes.size())) {
+                    return false;
+                }
+                PcpArc arc;
+                arc.type = static_cast<PcpArcType>(arcType);
+                arc.parent = nodes[parentIdx];
+                arc.origin =
+                    originIdx >= 0 ? nodes[originIdx] : nodes[parentIdx];
+                arc.mapToParent = PcpMapExpression::Constant(mapToParent);
+                arc.siblingNumAtOrigin = siblingNum;
+                arc.namespaceDepth = namespaceDepth;
+
+                PcpErrorBasePtr error;
+                const PcpNodeRef node =
+                    graph->InsertChildNode(arc.parent, site, arc, &error);
+                if (!node || error) {
+                    return false;
+                }
+                nodes.push_back(node);
+            }
+            _ApplyNodeFlags(nodes.back(), flags, permission);
+        }
+
+        graph->SetHasPayloads(hasPayloads);
+        graph->SetIsInstanceable(instanceable);
+        graph->Finalize();
+
+        PcpPrimIndex index;
+        index.SetGraph(graph);
+
+        // Rebuild the prim stack and per-node spec info by scanning the
+        // reconstructed sites; this avoids serializing spec tables that
+        // can be derived from the (already validated) layers.
+        Pcp_RescanForSpecs(&index, cache->IsUsd(),
+                           /* updateHasSpecs */ true);
+
+        indexes.emplace_back(path, PcpPrimIndex());
+        indexes.back().second.Swap(index);
+    }
+
+    // Commit: insert the restored indexes and register dependencies so
+    // change processing treats them like freshly computed indexes.  The
+    // side-band dependency data registered here is genuinely empty:
+    // indexes with culled, dynamic file format, or expression variable
+    // dependencies are never written to the file.
+    for (auto &entry : indexes) {
+        cache->_primDependencies->Add(
+            entry.second,
+            PcpCulledDependencyVector(),
+            PcpDynamicFileFormatDependencyData(),
+            PcpExpressionVariablesDependencyData());
+        cache->_primIndexCache[entry.first].Swap(entry.second);
+    }
+    return true;
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,62 @@
+//
+// Copyright 2026 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+#ifndef PXR_USD_PCP_PRIM_INDEX_DISK_CACHE_H
+#define PXR_USD_PCP_PRIM_INDEX_DISK_CACHE_H
+
+#include "pxr/pxr.h"
+
+#include <string>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+class PcpCache;
+
+/// \class Pcp_PrimIndexDiskCache
+///
+/// Serialization of a PcpCache's computed prim indexes to and from a
+/// cache file on disk.
+///
+/// The cache file records the structure of every valid prim index in the
+/// cache -- the node graph, arcs, map functions and layer stack sites --
+/// along with a validation table describing the layers that contributed
+/// to those indexes.  On load, every recorded layer is revalidated
+/// against its current resolved path and modification timestamp; if any
+/// layer has changed (or any anonymous layer is no longer present), the
+/// entire file is rejected and the caller falls back to normal
+/// composition.  The cache's composition parameters (USD mode, variant
+/// fallbacks, muted layers, included payloads) are also recorded and
+/// must match on load.
+///
+/// Prim indexes restored from disk are indistinguishable from freshly
+/// computed ones: they are inserted into the cache's prim index table
+/// and registered with its dependency tracker, so subsequent change
+/// processing behaves normally.  Indexes with side-band dependency
+/// state that the format does not serialize -- culled-node
+/// dependencies, dynamic file format argument dependencies, and
+/// expression variable dependencies -- are omitted from the file and
+/// simply recomputed on demand after load.
+///
+class Pcp_PrimIndexDiskCache
+{
+public:
+    /// Write all valid prim indexes in \p cache to \p filePath.
+    /// Returns false and issues a warning if the file cannot be written
+    /// or if the cache's contents cannot be validated on a future load
+    /// (e.g., a contributing layer has no resolvable identity).
+    static bool Write(const PcpCache &cache, const std::string &filePath);
+
+    /// Populate \p cache with the prim indexes recorded in \p filePath.
+    /// Returns false if the file is missing, malformed, was written with
+    /// different composition parameters, or if any contributing layer
+    /// has changed since the file was written.  On failure \p cache is
+    /// left unmodified.
+    static bool Read(PcpCache *cache, const std::string &filePath);
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // PXR_USD_PCP_PRIM_INDEX_DISK_CACHE_H
@@ -15,10 +15,25 @@
 #include "pxr/usd/pcp/types.h"
 
 #include "pxr/base/trace/trace.h"
+#include "pxr/base/tf/envSetting.h"
+#include "pxr/base/tf/hash.h"
 #include "pxr/base/tf/mallocTag.h"
 
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
+TF_DEFINE_ENV_SETTING(
+    PCP_SHARE_IDENTICAL_NODE_POOLS, false,
+    "Share node pools between finalized prim index graphs with identical "
+    "structure. Prim indexes that compose the same arcs from the same "
+    "layer stacks -- e.g. many non-instanced prims referencing the same "
+    "asset -- then share a single node pool flyweight-style, which can "
+    "substantially reduce composition memory. Shared pools are copied "
+    "on write, so subsequent edits to one graph do not affect others.");
+
 const size_t PcpPrimIndex_Graph::_Node::_invalidNodeIndex;
 
 ////////////////////////////////////////////////////////////
@@ -313,28 +328,147 @@ PcpPrimIndex_Graph::Finalize()
         return;
     }
 
-    // We want to store the nodes in the node pool in strong-to-weak order.
-    // In particular, this allows strength-order iteration over the nodes in 
-    // the graph to be a simple traversal of the pool. So, we compute the
-    // strength ordering of our nodes and reorder the pool if needed.
-    std::vector<size_t> nodeIndexToStrengthOrder;
-    const bool nodeOrderMatchesStrengthOrder = 
-        _ComputeStrengthOrderIndexMapping(&nodeIndexToStrengthOrder);
-    if (!nodeOrderMatchesStrengthOrder) {
-        _ApplyNodeIndexMapping(nodeIndexToStrengthOrder);
+    // A single-node graph with nothing to cull is trivially in strength
+    // order. Skip the index mapping computations and their scratch
+    // allocations in that case -- leaf prims with no composition arcs
+    // make this very common.
+    if (_GetNumNodes() > 1 || _unshared.front().culled) {
+        // We want to store the nodes in the node pool in strong-to-weak
+        // order. In particular, this allows strength-order iteration over the
+        // nodes in the graph to be a simple traversal of the pool. So, we
+        // compute the strength ordering of our nodes and reorder the pool if
+        // needed.
+        std::vector<size_t> nodeIndexToStrengthOrder;
+        const bool nodeOrderMatchesStrengthOrder =
+            _ComputeStrengthOrderIndexMapping(&nodeIndexToStrengthOrder);
+        if (!nodeOrderMatchesStrengthOrder) {
+            _ApplyNodeIndexMapping(nodeIndexToStrengthOrder);
+        }
+
+        // There may be nodes in the pool that have been marked for culling
+        // that can be erased from the node pool. Compute and apply the
+        // necessary transformation.
+        std::vector<size_t> culledNodeMapping;
+        const bool hasNodesToCull =
+            _ComputeEraseCulledNodeIndexMapping(&culledNodeMapping);
+        if (hasNodesToCull) {
+            _ApplyNodeIndexMapping(culledNodeMapping);
+        }
     }
 
-    // There may be nodes in the pool that have been marked for culling that
-    // can be erased from the node pool. Compute and apply the necessary
-    // transformation.
-    std::vector<size_t> culledNodeMapping;
-    const bool hasNodesToCull =
-        _ComputeEraseCulledNodeIndexMapping(&culledNodeMapping);
-    if (hasNodesToCull) {
-        _ApplyNodeIndexMapping(culledNodeMapping);
+    // Finalized graphs typically persist for the lifetime of the stage, so
+    // release any extra capacity the pools accumulated while the graph was
+    // being built. If the mappings above were applied, the pools were
+    // rebuilt at exact size already. A shared node pool is left alone, since
+    // shrinking it would detach a copy, costing more memory than it saves.
+    if (_nodes.unique() && _nodes->capacity() > _nodes->size()) {
+        _nodes->shrink_to_fit();
+    }
+    if (_unshared.capacity() > _unshared.size()) {
+        _unshared.shrink_to_fit();
     }
 
     _finalized = true;
+
+    if (TfGetEnvSetting(PCP_SHARE_IDENTICAL_NODE_POOLS)) {
+        _ShareIdenticalNodePool();
+    }
+}
+
+void
+PcpPrimIndex_Graph::_ShareIdenticalNodePool()
+{
+    TRACE_FUNCTION();
+
+    // Registry of node pools from finalized graphs, keyed by a hash of
+    // their structure. Entries hold weak references so that the registry
+    // does not keep pools alive beyond the graphs that use them; expired
+    // entries are swept out of a bucket as it is probed.
+    using _PoolRegistry =
+        std::unordered_multimap<size_t, std::weak_ptr<_NodePool>>;
+    static _PoolRegistry& registry = *new _PoolRegistry;
+    static std::mutex& registryMutex = *new std::mutex;
+
+    // Node site paths live in _unshared and deliberately do not
+    // participate in the hash or comparison: graphs for structurally
+    // identical prims differing only in namespace path compare equal.
+    // Map expressions are compared by node identity; non-variable
+    // expression nodes are interned, so expressions with identical
+    // structure share the same node.
+    const _NodePool& nodes = *_nodes;
+
+    size_t hash = nodes.size();
+    for (const _Node& node : nodes) {
+        hash = TfHash::Combine(
+            hash,
+            get_pointer(node.layerStack),
+            node.mapToRoot._node.get(),
+            node.mapToParent._node.get(),
+            size_t(node.indexes.arcParentIndex),
+            size_t(node.indexes.arcOriginIndex),
+            size_t(node.indexes.firstChildIndex),
+            size_t(node.indexes.lastChildIndex),
+            size_t(node.indexes.prevSiblingIndex),
+            size_t(node.indexes.nextSiblingIndex),
+            size_t(node.smallInts.arcSiblingNumAtOrigin),
+            size_t(node.smallInts.arcNamespaceDepth),
+            int(node.smallInts.arcType),
+            int(node.smallInts.permission),
+            bool(node.smallInts.hasSymmetry),
+            bool(node.smallInts.inert),
+            bool(node.smallInts.permissionDenied));
+    }
+
+    auto poolsAreIdentical = [](const _NodePool& a, const _NodePool& b) {
+        if (a.size() != b.size()) {
+            return false;
+        }
+        for (size_t i = 0, n = a.size(); i != n; ++i) {
+            const _Node& x = a[i];
+            const _Node& y = b[i];
+            if (x.layerStack != y.layerStack ||
+                x.mapToRoot._node.get() != y.mapToRoot._node.get() ||
+                x.mapToParent._node.get() != y.mapToParent._node.get() ||
+                memcmp(&x.indexes, &y.indexes, sizeof(x.indexes)) != 0 ||
+                x.smallInts.arcSiblingNumAtOrigin !=
+                    y.smallInts.arcSiblingNumAtOrigin ||
+                x.smallInts.arcNamespaceDepth !=
+                    y.smallInts.arcNamespaceDepth ||
+                x.smallInts.arcType != y.smallInts.arcType ||
+                x.smallInts.permission != y.smallInts.permission ||
+                x.smallInts.hasSymmetry != y.smallInts.hasSymmetry ||
+                x.smallInts.inert != y.smallInts.inert ||
+                x.smallInts.permissionDenied !=
+                    y.smallInts.permissionDenied) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    std::lock_guard<std::mutex> lock(registryMutex);
+
+    const auto range = registry.equal_range(hash);
+    for (auto it = range.first; it != range.second; ) {
+        if (std::shared_ptr<_NodePool> pool = it->second.lock()) {
+            if (pool == _nodes) {
+                // This pool is already registered; this can happen when a
+                // graph sharing a registered pool is cloned and finalized
+                // without changes.
+                return;
+            }
+            if (poolsAreIdentical(*pool, nodes)) {
+                _nodes = std::move(pool);
+                return;
+            }
+            ++it;
+        }
+        else {
+            it = registry.erase(it);
+        }
+    }
+
+    registry.emplace(hash, _nodes);
 }
 
 // Several helper macros to make it easier to access indexes for other
@@ -171,6 +171,14 @@ private:
     void _DetachSharedNodePool();
     void _DetachSharedNodePoolForNewNodes(size_t numAddedNodes = -1);
 
+    // If another finalized graph with an identical node pool exists,
+    // discards this graph's pool and shares the other graph's pool
+    // instead; otherwise makes this graph's pool available for sharing.
+    // Node site paths are unshared data and do not participate, so
+    // structurally identical graphs differing only in namespace path
+    // share a single pool.
+    void _ShareIdenticalNodePool();
+
     // Iterates through the immediate children of the root node looking
     // for the first node for which p(node) is true and the first subsequent
     // node where p(node) is false. Returns the indexes of the resulting 
@@ -0,0 +1,127 @@
+#!/pxrpythonsubst
+#
+# Copyright 2026 Pixar
+#
+# Licensed under the terms set forth in the LICENSE.txt file available at
+# https://openusd.org/license.
+
+from pxr import Sdf, Pcp
+import os, unittest
+
+CACHE_FILE = 'primIndexCache.pcpc'
+
+def _CreateCache():
+    layer = Sdf.Layer.FindOrOpen('root.sdf')
+    assert layer
+    return Pcp.Cache(Pcp.LayerStackIdentifier(layer))
+
+class TestPcpPrimIndexCacheFile(unittest.TestCase):
+
+    def test_RoundTrip(self):
+        """Save and reload prim indexes and verify the restored indexes
+           and their change-processing behavior match freshly computed
+           ones."""
+        paths = ['/Model', '/Model/Child', '/Simple']
+
+        cache1 = _CreateCache()
+        for path in paths:
+            (pi, errors) = cache1.ComputePrimIndex(path)
+            self.assertTrue(pi.IsValid())
+            self.assertEqual(errors, [])
+        self.assertTrue(cache1.SavePrimIndexCacheFile(CACHE_FILE))
+
+        cache2 = _CreateCache()
+        self.assertTrue(cache2.LoadPrimIndexCacheFile(CACHE_FILE))
+
+        # The restored indexes must be present without recomputation and
+        # have identical graphs.
+        for path in paths:
+            restored = cache2.FindPrimIndex(path)
+            self.assertTrue(restored)
+            self.assertEqual(restored.DumpToString(),
+                             cache1.FindPrimIndex(path).DumpToString())
+
+        # Change processing must treat the restored indexes like
+        # freshly computed ones: an edit to the referenced layer
+        # invalidates the dependent indexes in both caches.
+        refLayer = Sdf.Layer.FindOrOpen('ref.sdf')
+        with Pcp._TestChangeProcessor(cache1), \
+             Pcp._TestChangeProcessor(cache2):
+            Sdf.PrimSpec(refLayer.GetPrimAtPath('/Ref'),
+                         'NewChild', Sdf.SpecifierDef)
+        self.assertFalse(cache1.FindPrimIndex('/Model'))
+        self.assertFalse(cache2.FindPrimIndex('/Model'))
+        self.assertTrue(cache2.FindPrimIndex('/Simple'))
+
+    def test_StaleLayerRejected(self):
+        """A cache file must be rejected if a contributing layer has
+           been modified on disk since the file was written."""
+        cache1 = _CreateCache()
+        (pi, _) = cache1.ComputePrimIndex('/Model')
+        self.assertTrue(pi.IsValid())
+        self.assertTrue(cache1.SavePrimIndexCacheFile(CACHE_FILE))
+
+        # Bump the referenced layer's modification timestamp.
+        stat = os.stat('ref.sdf')
+        os.utime('ref.sdf', (stat.st_atime, stat.st_mtime + 1))
+
+        cache2 = _CreateCache()
+        self.assertFalse(cache2.LoadPrimIndexCacheFile(CACHE_FILE))
+        self.assertFalse(cache2.FindPrimIndex('/Model'))
+
+        # Restoring the timestamp makes the file loadable again.
+        os.utime('ref.sdf', (stat.st_atime, stat.st_mtime))
+        self.assertTrue(cache2.LoadPrimIndexCacheFile(CACHE_FILE))
+        self.assertTrue(cache2.FindPrimIndex('/Model'))
+
+    def test_ParameterMismatchRejected(self):
+        """A cache file must be rejected if the loading cache's
+           composition parameters differ from the saving cache's."""
+        cache1 = _CreateCache()
+        cache1.ComputePrimIndex('/Simple')
+        self.assertTrue(cache1.SavePrimIndexCacheFile(CACHE_FILE))
+
+        # Different muted layers.
+        cache2 = _CreateCache()
+        refLayer = Sdf.Layer.FindOrOpen('ref.sdf')
+        cache2.RequestLayerMuting([refLayer.identifier], [])
+        self.assertFalse(cache2.LoadPrimIndexCacheFile(CACHE_FILE))
+
+        # Different variant fallbacks.
+        cache3 = _CreateCache()
+        cache3.SetVariantFallbacks({'standin': ['render']})
+        self.assertFalse(cache3.LoadPrimIndexCacheFile(CACHE_FILE))
+
+        # A garbage file is rejected without touching the cache.
+        with open(CACHE_FILE, 'wb') as f:
+            f.write(b'not a prim index cache file')
+        cache4 = _CreateCache()
+        self.assertFalse(cache4.LoadPrimIndexCacheFile(CACHE_FILE))
+        self.assertFalse(cache4.FindPrimIndex('/Simple'))
+
+    def test_IncludedPayloadsValidated(self):
+        """The included-payloads set is an evaluation parameter and must
+           match between the saving and loading caches."""
+        cache1 = _CreateCache()
+        cache1.RequestPayloads(['/PayloadModel'], [])
+        (pi, errors) = cache1.ComputePrimIndex('/PayloadModel')
+        self.assertTrue(pi.IsValid())
+        self.assertEqual(errors, [])
+        self.assertTrue(cache1.SavePrimIndexCacheFile(CACHE_FILE))
+
+        # A cache without the payload request must reject the file.
+        cache2 = _CreateCache()
+        self.assertFalse(cache2.LoadPrimIndexCacheFile(CACHE_FILE))
+
+        # A cache with the same payload request restores the index,
+        # including its payload arc.
+        cache3 = _CreateCache()
+        cache3.RequestPayloads(['/PayloadModel'], [])
+        self.assertTrue(cache3.LoadPrimIndexCacheFile(CACHE_FILE))
+        restored = cache3.FindPrimIndex('/PayloadModel')
+        self.assertTrue(restored)
+        self.assertEqual(restored.DumpToString(),
+                         cache1.FindPrimIndex('/PayloadModel').DumpToString())
+
+if __name__ == "__main__":
+    unittest.main()
@@ -258,6 +258,8 @@ wrapCache()
         .def("FindPrimIndex", &_FindPrimIndex)
         .def("ComputePropertyIndex", &_ComputePropertyIndex)
         .def("FindPropertyIndex", &_FindPropertyIndex)
+        .def("SavePrimIndexCacheFile", &PcpCache::SavePrimIndexCacheFile)
+        .def("LoadPrimIndexCacheFile", &PcpCache::LoadPrimIndexCacheFile)
 
         .def("ComputeRelationshipTargetPaths", 
              &_ComputeRelationshipTargetPaths,
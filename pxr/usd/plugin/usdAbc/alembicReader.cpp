@@ -13,9 +13,11 @@
 #include "pxr/usd/usdGeom/tokens.h"
 #include "pxr/usd/usdGeom/xformable.h"
 #include "pxr/usd/sdf/schema.h"
+#include "pxr/base/work/dispatcher.h"
 #include "pxr/base/work/threadLimits.h"
 #include "pxr/base/trace/trace.h"
 #include "pxr/base/tf/envSetting.h"
+#include "pxr/base/tf/hash.h"
 #include "pxr/base/tf/staticData.h"
 #include "pxr/base/tf/staticTokens.h"
 #include "pxr/base/tf/ostreamMethods.h"
@@ -37,8 +39,10 @@
 #include <Alembic/AbcGeom/Visibility.h>
 #include <optional>
 #include <functional>
+#include <list>
 #include <memory>
 #include <mutex>
+#include <unordered_map>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -70,6 +74,13 @@ TF_DEFINE_ENV_SETTING(
     USD_ABC_XFORM_PRIM_COLLAPSE, true,
     "Collapse Xforms containing a single geometry into a single geom Prim in USD");
 
+TF_DEFINE_ENV_SETTING(
+    USD_ABC_NUM_READAHEAD_SAMPLES, 0,
+    "If greater than zero, querying a time sample on a property also "
+    "prefetches this many subsequent samples on background threads into a "
+    "bounded cache, accelerating sequential playback of Alembic-backed "
+    "layers.");
+
 #if ALEMBIC_LIBRARY_VERSION >= 10709
 TF_DEFINE_ENV_SETTING(
     USD_ABC_READ_ARCHIVE_USE_MMAP, true,
@@ -801,6 +812,20 @@ private:
                    const ISampleSelector& selector,
                    const UsdAbc_AlembicDataAny& value) const;
 
+    // Serve a time-sample query through the read-ahead cache, scheduling
+    // background fetches of the samples following \p index.
+    bool _GetSampleWithReadAhead(const Property* property,
+                                 Index index,
+                                 const UsdAbc_AlembicDataAny& value) const;
+
+    // Convert the sample at \p index and store it in the read-ahead cache.
+    void _FetchSample(const Property* property, Index index) const;
+
+    // Store a converted sample in the read-ahead cache, evicting the least
+    // recently used entries to stay within capacity.
+    void _InsertSample(const Property* property, Index index,
+                       const VtValue& sample) const;
+
     // Custom auto-lock that safely ignores a NULL pointer.
     class _Lock {
     public:
@@ -853,6 +878,37 @@ private:
     _PrimMap _prims;
     Prim* _pseudoRoot;
     UsdAbc_TimeSamples _allTimeSamples;
+
+    // Read-ahead sample cache, keyed by property and sample index.  The
+    // Property pointers are stable; they point into _prims, which doesn't
+    // change between Open() and Close().  An empty VtValue marks a sample
+    // with a fetch in flight.  See USD_ABC_NUM_READAHEAD_SAMPLES.
+    struct _SampleKey {
+        const Property* property;
+        Index index;
+        bool operator==(const _SampleKey& rhs) const {
+            return property == rhs.property && index == rhs.index;
+        }
+    };
+    struct _SampleKeyHash {
+        size_t operator()(const _SampleKey& key) const {
+            return TfHash::Combine(key.property, key.index);
+        }
+    };
+    struct _CachedSample {
+        VtValue value;
+        std::list<_SampleKey>::iterator lruIter;
+    };
+    size_t _numReadAheadSamples;
+    size_t _sampleCacheCapacity;
+    mutable std::mutex _sampleCacheMutex;
+    mutable std::list<_SampleKey> _sampleLru;    // Most recent first.
+    mutable std::unordered_map<_SampleKey, _CachedSample, _SampleKeyHash>
+        _sampleCache;
+
+    // Runs the background fetches.  Declared last so its destructor waits
+    // for outstanding fetches before the caches above are destroyed.
+    mutable WorkDispatcher _readAheadDispatcher;
 };
 
 static
@@ -867,7 +923,11 @@ _ReaderContext::_ReaderContext() :
     _mutex(NULL),
     _timeScale(24.0),               // Usd is frames, Alembic is seconds.
     _timeOffset(0.0),               // Time 0.0 to frame 0.
-    _schema(NULL)
+    _schema(NULL),
+    _numReadAheadSamples(
+        std::max(TfGetEnvSetting(USD_ABC_NUM_READAHEAD_SAMPLES), 0)),
+    _sampleCacheCapacity(
+        std::max<size_t>(1024, 64 * _numReadAheadSamples))
 {
     // Do nothing
 }
@@ -1261,6 +1321,10 @@ _ReaderContext::HasValue(
     if (const Prim* prim = _GetPrim(path)) {
         if (!path.IsAbsoluteRootOrPrimPath()) {
             if (const Property* property = _GetProperty(*prim, path)) {
+                if (_numReadAheadSamples > 0 &&
+                    property->timeSampled && !value.IsEmpty()) {
+                    return _GetSampleWithReadAhead(property, index, value);
+                }
                 return _HasValue(property, ISampleSelector(index), value);
             }
         }
@@ -1502,6 +1566,15 @@ _ReaderContext::_SetupInstancing(
 void
 _ReaderContext::_Clear()
 {
+    // Wait for outstanding read-ahead fetches; they reference the prim and
+    // property caches cleared below.
+    _readAheadDispatcher.Wait();
+    {
+        std::lock_guard<std::mutex> lock(_sampleCacheMutex);
+        _sampleCache.clear();
+        _sampleLru.clear();
+    }
+
     _prims.clear();
     _pseudoRoot = NULL;
     _allTimeSamples.clear();
@@ -1677,6 +1750,98 @@ _ReaderContext::_HasValue(
     return property->converter(value, selector);
 }
 
+bool
+_ReaderContext::_GetSampleWithReadAhead(
+    const Property* property,
+    Index index,
+    const UsdAbc_AlembicDataAny& value) const
+{
+    // Check if no conversion available.
+    if (!property->converter) {
+        return false;
+    }
+
+    // Serve from the cache if we already have this sample.
+    {
+        std::lock_guard<std::mutex> lock(_sampleCacheMutex);
+        auto i = _sampleCache.find(_SampleKey{property, index});
+        if (i != _sampleCache.end() && !i->second.value.IsEmpty()) {
+            _sampleLru.splice(
+                _sampleLru.begin(), _sampleLru, i->second.lruIter);
+            return value.Set(i->second.value);
+        }
+    }
+
+    // Convert the requested sample now.
+    VtValue sample;
+    {
+        TRACE_SCOPE("UsdAbc_AlembicDataReader::_HasValue:Conversion");
+        _Lock lock(_mutex);
+        if (!property->converter(UsdAbc_AlembicDataAny(&sample),
+                                 ISampleSelector(index))) {
+            return false;
+        }
+    }
+    _InsertSample(property, index, sample);
+
+    // Schedule background fetches for the samples that playback will
+    // typically query next.
+    const Index numSamples =
+        static_cast<Index>(property->sampleTimes.GetSize());
+    const Index end = std::min(
+        numSamples, index + 1 + static_cast<Index>(_numReadAheadSamples));
+    for (Index i = index + 1; i < end; ++i) {
+        {
+            std::lock_guard<std::mutex> lock(_sampleCacheMutex);
+            const _SampleKey key{property, i};
+            if (_sampleCache.count(key)) {
+                // Already cached or being fetched.
+                continue;
+            }
+            // Insert an empty placeholder so other queries don't schedule
+            // a duplicate fetch.
+            _sampleLru.push_front(key);
+            _sampleCache.emplace(
+                key, _CachedSample{VtValue(), _sampleLru.begin()});
+        }
+        _readAheadDispatcher.Run(
+            [this, property, i]() { _FetchSample(property, i); });
+    }
+
+    return value.Set(sample);
+}
+
+void
+_ReaderContext::_FetchSample(const Property* property, Index index) const
+{
+    VtValue sample;
+    _Lock lock(_mutex);
+    if (property->converter(UsdAbc_AlembicDataAny(&sample),
+                            ISampleSelector(index))) {
+        _InsertSample(property, index, sample);
+    }
+}
+
+void
+_ReaderContext::_InsertSample(
+    const Property* property,
+    Index index,
+    const VtValue& sample) const
+{
+    std::lock_guard<std::mutex> lock(_sampleCacheMutex);
+    const _SampleKey key{property, index};
+    auto insertion = _sampleCache.emplace(key, _CachedSample());
+    if (insertion.second) {
+        _sampleLru.push_front(key);
+        insertion.first->second.lruIter = _sampleLru.begin();
+    }
+    insertion.first->second.value = sample;
+    while (_sampleCache.size() > _sampleCacheCapacity) {
+        _sampleCache.erase(_sampleLru.back());
+        _sampleLru.pop_back();
+    }
+}
+
 //
 // Utilities
 //
@@ -135,6 +135,15 @@ SdfChangeList::operator=(SdfChangeList const &o)
     return *this;
 }
 
+void
+SdfChangeList::Clear()
+{
+    _entries.clear();
+    if (_entriesAccel) {
+        _entriesAccel->clear();
+    }
+}
+
 SdfChangeList::Entry const &
 SdfChangeList::GetEntry( const SdfPath & path ) const
 {
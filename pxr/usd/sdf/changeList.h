@@ -42,6 +42,10 @@ public:
     SDF_API SdfChangeList &operator=(SdfChangeList const &);
     SdfChangeList &operator=(SdfChangeList &&) = default;
 
+    /// Clears all recorded changes, retaining allocated entry storage so
+    /// that this change list can be reused without reallocating it.
+    SDF_API void Clear();
+
     enum SubLayerChangeType {
         SubLayerAdded,
         SubLayerRemoved,
@@ -188,6 +188,19 @@ Sdf_ChangeManager::_SendNotices(_Data *data)
         n.Send(lc.first);
     }
 
+    // Recycle the change list storage now that the changes have been
+    // delivered.  Clearing a change list destroys its recorded entries but
+    // retains its allocated entry storage, so pooling the cleared lists lets
+    // subsequent rounds of bulk edits avoid reallocating that storage.
+    constexpr size_t poolLimit = 16;
+    for (auto &lc: changes) {
+        if (data->changeListPool.size() >= poolLimit) {
+            break;
+        }
+        lc.second.Clear();
+        data->changeListPool.push_back(std::move(lc.second));
+    }
+
     // If no new changes have been queued in the meantime then move the changes
     // vector back and clear it.  This is a performance optimization: it lets us
     // reuse the existing capacity in the changes vector, so we can potentially
@@ -203,7 +216,7 @@ Sdf_ChangeManager::DidReplaceLayerContent(const SdfLayerHandle &layer)
 {
     if (!layer->_ShouldNotify())
         return;
-    _GetListFor(_data.local().changes, layer).DidReplaceLayerContent();
+    _GetListFor(_data.local(), layer).DidReplaceLayerContent();
 }
 
 void
@@ -211,7 +224,7 @@ Sdf_ChangeManager::DidReloadLayerContent(const SdfLayerHandle &layer)
 {
     if (!layer->_ShouldNotify())
         return;
-    _GetListFor(_data.local().changes, layer).DidReloadLayerContent();
+    _GetListFor(_data.local(), layer).DidReloadLayerContent();
 }
 
 void 
@@ -220,7 +233,7 @@ Sdf_ChangeManager::DidChangeLayerIdentifier(const SdfLayerHandle &layer,
 {
     if (!layer->_ShouldNotify())
         return;
-    _GetListFor(_data.local().changes, layer)
+    _GetListFor(_data.local(), layer)
         .DidChangeLayerIdentifier(oldIdentifier);
 }
 
@@ -229,7 +242,7 @@ Sdf_ChangeManager::DidChangeLayerResolvedPath(const SdfLayerHandle &layer)
 {
     if (!layer->_ShouldNotify())
         return;
-    _GetListFor(_data.local().changes, layer).DidChangeLayerResolvedPath();
+    _GetListFor(_data.local(), layer).DidChangeLayerResolvedPath();
 }
 
 static bool
@@ -266,7 +279,7 @@ Sdf_ChangeManager::DidChangeField(
     auto FieldKeys = SdfFieldKeys.Get();
     auto ChildrenKeys = SdfChildrenKeys.Get();
     
-    SdfLayerChangeListVec &changes = _data.local().changes;
+    _Data &data = _data.local();
 
     // Note:  We intend to change the SdfChangeList protocol to provide a
     // sequence of (layer, path, field, oldValue, newValue) tuples.
@@ -280,7 +293,7 @@ Sdf_ChangeManager::DidChangeField(
         sendInfoChange = true;
     }
     else if (field == FieldKeys->PrimOrder) {
-        _GetListFor(changes, layer).DidReorderPrims(path);
+        _GetListFor(data, layer).DidReorderPrims(path);
         sendInfoChange = true;
     }
     else if (field == ChildrenKeys->PrimChildren) {
@@ -293,45 +306,45 @@ Sdf_ChangeManager::DidChangeField(
         // and new children lists and only send an "order changed"
         // message if this is a pure order change.
         if (_IsOrderChangeOnly(oldVal, newVal)) {
-            _GetListFor(changes, layer).DidReorderPrims(path);
+            _GetListFor(data, layer).DidReorderPrims(path);
         }
     }
     else if (field == FieldKeys->PropertyOrder) {
-        _GetListFor(changes, layer).DidReorderProperties(path);
+        _GetListFor(data, layer).DidReorderProperties(path);
     }
     else if (field == ChildrenKeys->PropertyChildren) {
         // XXX:OrderNotification: See above.
         if (_IsOrderChangeOnly(oldVal, newVal)) {
-            _GetListFor(changes, layer).DidReorderProperties(path);
+            _GetListFor(data, layer).DidReorderProperties(path);
         }
     }
     else if (field == FieldKeys->VariantSetNames ||
              field == ChildrenKeys->VariantSetChildren) {
-        _GetListFor(changes, layer).DidChangePrimVariantSets(path);
+        _GetListFor(data, layer).DidChangePrimVariantSets(path);
         sendInfoChange = true;
     }
     else if (field == FieldKeys->InheritPaths) {
-        _GetListFor(changes, layer).DidChangePrimInheritPaths(path);
+        _GetListFor(data, layer).DidChangePrimInheritPaths(path);
         sendInfoChange = true;
     }
     else if (field == FieldKeys->Specializes) {
-        _GetListFor(changes, layer).DidChangePrimSpecializes(path);
+        _GetListFor(data, layer).DidChangePrimSpecializes(path);
         sendInfoChange = true;
     }
     else if (field == FieldKeys->References) {
-        _GetListFor(changes, layer).DidChangePrimReferences(path);
+        _GetListFor(data, layer).DidChangePrimReferences(path);
         sendInfoChange = true;
     }
     else if (field == FieldKeys->TimeSamples) {
-        _GetListFor(changes, layer).DidChangeAttributeTimeSamples(path);
+        _GetListFor(data, layer).DidChangeAttributeTimeSamples(path);
         sendInfoChange = true;
     }
     else if (field == FieldKeys->ConnectionPaths) {
-        _GetListFor(changes, layer).DidChangeAttributeConnection(path);
+        _GetListFor(data, layer).DidChangeAttributeConnection(path);
         sendInfoChange = true;
     }
     else if (field == FieldKeys->TargetPaths) {
-        _GetListFor(changes, layer).DidChangeRelationshipTargets(path);
+        _GetListFor(data, layer).DidChangeRelationshipTargets(path);
         sendInfoChange = true;
     }
     else if (field == FieldKeys->SubLayers) {
@@ -368,12 +381,12 @@ Sdf_ChangeManager::DidChangeField(
         }
 
         TF_FOR_ALL(it, addedLayers) {
-            _GetListFor(changes, layer)
+            _GetListFor(data, layer)
                 .DidChangeSublayerPaths(*it, SdfChangeList::SubLayerAdded);
         }
 
         TF_FOR_ALL(it, removedLayers) {
-            _GetListFor(changes, layer)
+            _GetListFor(data, layer)
                 .DidChangeSublayerPaths(*it, SdfChangeList::SubLayerRemoved);
         }
 
@@ -394,7 +407,7 @@ Sdf_ChangeManager::DidChangeField(
             if (TF_VERIFY(newOffsets.size() == subLayers.size())) {
                 for (size_t i = 0; i < newOffsets.size(); ++i) {
                     if (oldOffsets[i] != newOffsets[i]) {
-                        _GetListFor(changes, layer)
+                        _GetListFor(data, layer)
                             .DidChangeSublayerPaths(
                                 subLayers[i], SdfChangeList::SubLayerOffset);
                     }
@@ -408,7 +421,7 @@ Sdf_ChangeManager::DidChangeField(
         if (path.IsMapperPath() || path.IsExpressionPath()) {
             // Mapper and expression typename changes are treated as changes on
             // the owning attribute connection.
-            _GetListFor(changes, layer)
+            _GetListFor(data, layer)
                 .DidChangeAttributeConnection(path.GetParentPath());
         }
         else {
@@ -427,13 +440,13 @@ Sdf_ChangeManager::DidChangeField(
             !newVal.IsEmpty() ? newVal :
             layer->GetField(path, FieldKeys->FramesPerSecond));
 
-        _GetListFor(changes, layer).DidChangeInfo(
+        _GetListFor(data, layer).DidChangeInfo(
             path, FieldKeys->TimeCodesPerSecond, std::move(oldTcps), newTcps);
     }
     else if (field == FieldKeys->FramesPerSecond &&
             TF_VERIFY(path == SdfPath::AbsoluteRootPath())) {
         // Announce the change to FPS itself.
-        SdfChangeList &list = _GetListFor(changes, layer);
+        SdfChangeList &list = _GetListFor(data, layer);
         list.DidChangeInfo(
             path, FieldKeys->FramesPerSecond, VtValue(oldVal), newVal);
 
@@ -466,7 +479,7 @@ Sdf_ChangeManager::DidChangeField(
     }
 
     if (sendInfoChange) {
-        _GetListFor(changes, layer)
+        _GetListFor(data, layer)
             .DidChangeInfo(path, field, std::move(oldVal), newVal);
     }
 }
@@ -475,7 +488,7 @@ void
 Sdf_ChangeManager::DidChangeAttributeTimeSamples(const SdfLayerHandle &layer,
                                                  const SdfPath &attrPath)
 {
-    _GetListFor(_data.local().changes, layer)
+    _GetListFor(_data.local(), layer)
         .DidChangeAttributeTimeSamples(attrPath);
 }
 
@@ -486,49 +499,49 @@ Sdf_ChangeManager::DidMoveSpec(const SdfLayerHandle &layer,
     if (!layer->_ShouldNotify())
         return;
 
-    SdfLayerChangeListVec &changes = _data.local().changes;
+    _Data &data = _data.local();
 
     if (oldPath.GetParentPath() == newPath.GetParentPath()) {
         // Rename
         if (oldPath.IsPrimPath()) {
-            _GetListFor(changes, layer).DidChangePrimName(oldPath, newPath);
+            _GetListFor(data, layer).DidChangePrimName(oldPath, newPath);
         } else if (oldPath.IsPropertyPath()) {
-            _GetListFor(changes, layer).DidChangePropertyName(oldPath, newPath);
+            _GetListFor(data, layer).DidChangePropertyName(oldPath, newPath);
         } else if (oldPath.IsTargetPath()) {
             const SdfPath& parentPropPath = oldPath.GetParentPath();
             const SdfSpecType specType = layer->GetSpecType(parentPropPath);
             if (specType == SdfSpecTypeAttribute) {
-                _GetListFor(changes, layer)
+                _GetListFor(data, layer)
                     .DidChangeAttributeConnection(parentPropPath);
             }
             else if (specType == SdfSpecTypeRelationship) {
-                _GetListFor(changes, layer)
+                _GetListFor(data, layer)
                     .DidChangeRelationshipTargets(parentPropPath);
             }
         }
     } else {
         // Reparent
         if (oldPath.IsPrimPath()) {
-            _GetListFor(changes, layer).DidMovePrim(oldPath, newPath);
+            _GetListFor(data, layer).DidMovePrim(oldPath, newPath);
         } else if (oldPath.IsPropertyPath()) {
-            _GetListFor(changes, layer).DidRemoveProperty(oldPath, 
+            _GetListFor(data, layer).DidRemoveProperty(oldPath, 
                 /* hasOnlyRequiredFields = */ false);
-            _GetListFor(changes, layer).DidAddProperty(newPath, 
+            _GetListFor(data, layer).DidAddProperty(newPath, 
                 /* hasOnlyRequiredFields = */ false);
         } else if (oldPath.IsTargetPath()) {
             const SdfPath& oldParentPropPath = oldPath.GetParentPath();
             const SdfPath& newParentPropPath = newPath.GetParentPath();
             const SdfSpecType specType = layer->GetSpecType(oldParentPropPath);
             if (specType == SdfSpecTypeAttribute) {
-                _GetListFor(changes, layer)
+                _GetListFor(data, layer)
                     .DidChangeAttributeConnection(oldParentPropPath);
-                _GetListFor(changes, layer)
+                _GetListFor(data, layer)
                     .DidChangeAttributeConnection(newParentPropPath);
             }
             else if (specType == SdfSpecTypeRelationship) {
-                _GetListFor(changes, layer)
+                _GetListFor(data, layer)
                     .DidChangeRelationshipTargets(oldParentPropPath);
-                _GetListFor(changes, layer)
+                _GetListFor(data, layer)
                     .DidChangeRelationshipTargets(newParentPropPath);
             }
         }
@@ -542,23 +555,23 @@ Sdf_ChangeManager::DidAddSpec(const SdfLayerHandle &layer, const SdfPath &path,
     if (!layer->_ShouldNotify())
         return;
 
-    SdfLayerChangeListVec &changes = _data.local().changes;
+    _Data &data = _data.local();
 
     if (path.IsPrimPath() || path.IsPrimVariantSelectionPath()) {
-        _GetListFor(changes, layer).DidAddPrim(path, /* inert = */ inert);
+        _GetListFor(data, layer).DidAddPrim(path, /* inert = */ inert);
     } 
     else if (path.IsPropertyPath()) {
-        _GetListFor(changes, layer).DidAddProperty(path, 
+        _GetListFor(data, layer).DidAddProperty(path, 
                                        /* hasOnlyRequiredFields = */ inert);
     } 
     else if (path.IsTargetPath()) {
-        _GetListFor(changes, layer).DidAddTarget(path);
+        _GetListFor(data, layer).DidAddTarget(path);
     }
     else if (path.IsMapperPath() || path.IsMapperArgPath()) {
         // This is handled when the field on the parent changes
     } 
     else if (path.IsExpressionPath()) {
-        _GetListFor(changes, layer)
+        _GetListFor(data, layer)
             .DidChangeAttributeConnection(path.GetParentPath());
     } 
     else {
@@ -573,23 +586,23 @@ Sdf_ChangeManager::DidRemoveSpec(const SdfLayerHandle &layer, const SdfPath &pat
     if (!layer->_ShouldNotify())
         return;
 
-    SdfLayerChangeListVec &changes = _data.local().changes;
+    _Data &data = _data.local();
 
     if (path.IsPrimPath() || path.IsPrimVariantSelectionPath()) {
-        _GetListFor(changes, layer).DidRemovePrim(path, /* inert = */ inert);
+        _GetListFor(data, layer).DidRemovePrim(path, /* inert = */ inert);
     } 
     else if (path.IsPropertyPath()) {
-        _GetListFor(changes, layer).DidRemoveProperty(path, 
+        _GetListFor(data, layer).DidRemoveProperty(path, 
                                           /* hasOnlyRequiredFields = */ inert);
     } 
     else if (path.IsTargetPath()) {
-        _GetListFor(changes, layer).DidRemoveTarget(path);
+        _GetListFor(data, layer).DidRemoveTarget(path);
     }
     else if (path.IsMapperPath() || path.IsMapperArgPath()) {
         // This is handled when the field on the parent changes
     } 
     else if (path.IsExpressionPath()) {
-        _GetListFor(changes, layer)
+        _GetListFor(data, layer)
             .DidChangeAttributeConnection(path.GetParentPath());
     } 
     else {
@@ -598,9 +611,9 @@ Sdf_ChangeManager::DidRemoveSpec(const SdfLayerHandle &layer, const SdfPath &pat
 }
 
 SdfChangeList &
-Sdf_ChangeManager::_GetListFor(SdfLayerChangeListVec &theList,
-                               SdfLayerHandle const &layer)
+Sdf_ChangeManager::_GetListFor(_Data &data, SdfLayerHandle const &layer)
 {
+    SdfLayerChangeListVec &theList = data.changes;
     auto iter = std::find_if(
         theList.begin(), theList.end(),
         [&layer](SdfLayerChangeListVec::value_type const &p) {
@@ -609,8 +622,16 @@ Sdf_ChangeManager::_GetListFor(SdfLayerChangeListVec &theList,
     if (iter != theList.end()) {
         return iter->second;
     }
-    theList.emplace_back(std::piecewise_construct,
-                         std::tie(layer), std::tuple<>());
+    // Reuse a pooled change list from a prior round of change processing if
+    // one is available; its entry storage is already allocated.
+    if (!data.changeListPool.empty()) {
+        theList.emplace_back(layer, std::move(data.changeListPool.back()));
+        data.changeListPool.pop_back();
+    }
+    else {
+        theList.emplace_back(std::piecewise_construct,
+                             std::tie(layer), std::tuple<>());
+    }
     return theList.back().second;
 }
 
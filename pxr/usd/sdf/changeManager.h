@@ -74,6 +74,10 @@ private:
         SdfLayerChangeListVec changes;
         SdfChangeBlock const *outermostBlock;
         std::vector<SdfSpec> removeIfInert;
+        // Cleared change lists retained from prior rounds of change
+        // processing, whose already-allocated entry storage is reused for
+        // new change lists.
+        std::vector<SdfChangeList> changeListPool;
     };
 
     Sdf_ChangeManager();
@@ -93,8 +97,7 @@ private:
 
     void _ProcessRemoveIfInert(_Data *data);
 
-    SdfChangeList &_GetListFor(SdfLayerChangeListVec &changeList,
-                               SdfLayerHandle const &layer);
+    SdfChangeList &_GetListFor(_Data &data, SdfLayerHandle const &layer);
 
 private:
 
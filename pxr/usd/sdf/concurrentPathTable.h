@@ -0,0 +1,309 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+#ifndef PXR_USD_SDF_CONCURRENT_PATH_TABLE_H
+#define PXR_USD_SDF_CONCURRENT_PATH_TABLE_H
+
+#include "pxr/pxr.h"
+#include "pxr/usd/sdf/api.h"
+#include "pxr/usd/sdf/path.h"
+#include "pxr/usd/sdf/pathTable.h"
+
+#include <tbb/spin_rw_mutex.h>
+
+#include <utility>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// \class SdfConcurrentPathTable
+///
+/// A concurrent mapping from SdfPath to \a MappedType with SdfPathTable's
+/// prefix-tree semantics: inserting a path implicitly inserts its ancestors,
+/// erasing a path erases its descendants, and subtrees may be visited as
+/// contiguous ranges.
+///
+/// Entries are sharded by their top-level path element, so a path and all of
+/// its descendants always land in the same shard.  This keeps subtree
+/// visitation and prefix erase single-shard operations.  Each shard is an
+/// SdfPathTable guarded by a reader-writer spin mutex: lookups and subtree
+/// visits take a shared lock and run concurrently, while inserts and erases
+/// take an exclusive lock on just their shard, so writers populating
+/// different top-level subtrees proceed in parallel.
+///
+/// Thread safety: Find(), count(), size(), empty(), and the visitation
+/// members may run concurrently with each other and with insert() and
+/// erase().  Pointers and references returned by Find(), insert(), and
+/// operator[]() remain stable across further inserts (entries are
+/// node-based), but must not be used concurrently with an erase() that could
+/// remove the entry.  Visitation callbacks are invoked with a shard lock
+/// held and must not call back into the table.
+///
+/// Like SdfPathTable, this table works exclusively with absolute paths.  The
+/// entry for the absolute root path exists whenever the table is non-empty,
+/// but as an implementation artifact of the sharding it may be replicated
+/// internally; it is visited exactly once, though its mapped value is not
+/// well supported and should not be used to store data.  This table is
+/// intended for data keyed on prim and property paths.
+///
+template <class MappedType>
+class SdfConcurrentPathTable
+{
+public:
+
+    typedef SdfPath key_type;
+    typedef MappedType mapped_type;
+    typedef std::pair<key_type, mapped_type> value_type;
+
+    SdfConcurrentPathTable() = default;
+
+    SdfConcurrentPathTable(SdfConcurrentPathTable const &) = delete;
+    SdfConcurrentPathTable &operator=(SdfConcurrentPathTable const &) = delete;
+
+    /// Return true if this table is empty.
+    bool empty() const {
+        for (_Shard const &shard : _shards) {
+            _ScopedLock lock(shard.mutex, /* write = */ false);
+            if (!shard.table.empty()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// Return the number of elements in the table.  The entry for the
+    /// absolute root path is counted once.
+    size_t size() const {
+        size_t sum = 0, populated = 0;
+        for (_Shard const &shard : _shards) {
+            _ScopedLock lock(shard.mutex, /* write = */ false);
+            if (size_t const shardSize = shard.table.size()) {
+                sum += shardSize;
+                ++populated;
+            }
+        }
+        // Every populated shard holds its own entry for the absolute root
+        // path; count it once.
+        return populated ? sum - (populated - 1) : 0;
+    }
+
+    /// Insert \a value into the table, and additionally insert default
+    /// entries for all ancestral paths of \a value.first that do not already
+    /// exist in the table.
+    ///
+    /// Return a pair of pointer and bool.  The pointer points to the mapped
+    /// object for \a value.first, the bool indicates whether insertion was
+    /// successful.  The bool is true if \a value was successfully inserted
+    /// and false if an element with path \a value.first was already present.
+    std::pair<mapped_type *, bool> insert(value_type const &value) {
+        _Shard &shard = _GetShard(value.first);
+        _ScopedLock lock(shard.mutex, /* write = */ true);
+        auto result = shard.table.insert(value);
+        return { &result.first->second, result.second };
+    }
+
+    /// Shorthand for the following, where \a t is an SdfConcurrentPathTable.
+    /// \code
+    ///     *t.insert(value_type(path, mapped_type())).first
+    /// \endcode
+    mapped_type &operator[](SdfPath const &path) {
+        return *insert(value_type(path, mapped_type())).first;
+    }
+
+    /// Return a pointer to the mapped object for \a path if one exists,
+    /// nullptr otherwise.
+    mapped_type *Find(SdfPath const &path) {
+        return _FindImpl(*this, path);
+    }
+
+    /// \overload
+    mapped_type const *Find(SdfPath const &path) const {
+        return _FindImpl(*this, path);
+    }
+
+    /// Return 1 if there is an element for \a path in the table, otherwise 0.
+    size_t count(SdfPath const &path) const {
+        return Find(path) ? 1 : 0;
+    }
+
+    /// Remove the element with path \a path from the table as well as all
+    /// elements whose paths are prefixed by \a path.  Return true if any
+    /// elements were removed, false otherwise.
+    bool erase(SdfPath const &path) {
+        if (path == SdfPath::AbsoluteRootPath()) {
+            // Erasing the root erases everything, across all shards.
+            bool erasedAny = false;
+            for (_Shard &shard : _shards) {
+                _ScopedLock lock(shard.mutex, /* write = */ true);
+                erasedAny |= !shard.table.empty();
+                shard.table.clear();
+            }
+            return erasedAny;
+        }
+        _Shard &shard = _GetShard(path);
+        _ScopedLock lock(shard.mutex, /* write = */ true);
+        return shard.table.erase(path);
+    }
+
+    /// Invoke \a visitFn, a callable taking (SdfPath const &, mapped_type &),
+    /// for the element with path \a path and every element whose path is
+    /// prefixed by \a path.  The shard lock is held for the duration, so
+    /// \a visitFn must not call back into the table.
+    template <class Callback>
+    void VisitSubtree(SdfPath const &path, Callback const &visitFn) {
+        _VisitSubtreeImpl(*this, path, visitFn);
+    }
+
+    /// \overload taking (SdfPath const &, mapped_type const &) on a const
+    /// table.
+    template <class Callback>
+    void VisitSubtree(SdfPath const &path, Callback const &visitFn) const {
+        _VisitSubtreeImpl(*this, path, visitFn);
+    }
+
+    /// Invoke \a visitFn, a callable taking (SdfPath const &, mapped_type &),
+    /// for every element in the table, in arbitrary order and in parallel
+    /// within each shard.  Since this runs in parallel, \a visitFn is
+    /// responsible for synchronizing access to any non-table state, and must
+    /// not call back into the table.
+    template <class Callback>
+    void ParallelForEach(Callback const &visitFn) {
+        _ParallelForEachImpl(*this, visitFn);
+    }
+
+    /// \overload taking (SdfPath const &, mapped_type const &) on a const
+    /// table.
+    template <class Callback>
+    void ParallelForEach(Callback const &visitFn) const {
+        _ParallelForEachImpl(*this, visitFn);
+    }
+
+    /// Remove all elements from the table, leaving size() == 0.
+    void clear() {
+        for (_Shard &shard : _shards) {
+            _ScopedLock lock(shard.mutex, /* write = */ true);
+            shard.table.clear();
+        }
+    }
+
+private:
+
+    static constexpr size_t _NumShards = 16;
+    static_assert((_NumShards & (_NumShards - 1)) == 0,
+                  "_NumShards must be a power of two");
+
+    typedef tbb::spin_rw_mutex::scoped_lock _ScopedLock;
+
+    struct _Shard {
+        mutable tbb::spin_rw_mutex mutex;
+        SdfPathTable<MappedType> table;
+    };
+
+    // Shard by the top-level path element so that a path and all of its
+    // descendants land in the same shard.
+    static size_t _ShardIndex(SdfPath const &path) {
+        SdfPath top = path;
+        while (top.GetPathElementCount() > 1) {
+            top = top.GetParentPath();
+        }
+        return top.GetHash() & (_NumShards - 1);
+    }
+
+    _Shard &_GetShard(SdfPath const &path) {
+        return _shards[_ShardIndex(path)];
+    }
+
+    _Shard const &_GetShard(SdfPath const &path) const {
+        return _shards[_ShardIndex(path)];
+    }
+
+    // Templated over Self to share the implementation between the const and
+    // non-const members.
+    template <class Self>
+    static auto _FindImpl(Self &self, SdfPath const &path)
+        -> decltype(&self._shards[0].table.find(path)->second)
+    {
+        if (path == SdfPath::AbsoluteRootPath()) {
+            // The root entry lives in every populated shard; return the
+            // first one found.
+            for (auto &shard : self._shards) {
+                _ScopedLock lock(shard.mutex, /* write = */ false);
+                auto i = shard.table.find(path);
+                if (i != shard.table.end()) {
+                    return &i->second;
+                }
+            }
+            return nullptr;
+        }
+        auto &shard = self._GetShard(path);
+        _ScopedLock lock(shard.mutex, /* write = */ false);
+        auto i = shard.table.find(path);
+        return i != shard.table.end() ? &i->second : nullptr;
+    }
+
+    template <class Self, class Callback>
+    static void _VisitSubtreeImpl(Self &self, SdfPath const &path,
+                                  Callback const &visitFn)
+    {
+        if (path == SdfPath::AbsoluteRootPath()) {
+            // The whole table; visit every shard, but visit the replicated
+            // root entry only once.
+            bool visitedRoot = false;
+            for (auto &shard : self._shards) {
+                _ScopedLock lock(shard.mutex, /* write = */ false);
+                auto range = shard.table.FindSubtreeRange(path);
+                for (auto i = range.first; i != range.second; ++i) {
+                    if (i->first == path) {
+                        if (visitedRoot) {
+                            continue;
+                        }
+                        visitedRoot = true;
+                    }
+                    visitFn(i->first, i->second);
+                }
+            }
+            return;
+        }
+        auto &shard = self._GetShard(path);
+        _ScopedLock lock(shard.mutex, /* write = */ false);
+        auto range = shard.table.FindSubtreeRange(path);
+        for (auto i = range.first; i != range.second; ++i) {
+            visitFn(i->first, i->second);
+        }
+    }
+
+    template <class Self, class Callback>
+    static void _ParallelForEachImpl(Self &self, Callback const &visitFn) {
+        SdfPath const &root = SdfPath::AbsoluteRootPath();
+        // Visit the replicated root entry only from the first populated
+        // shard.
+        size_t rootShard = 0;
+        for (size_t s = 0; s != _NumShards; ++s) {
+            _ScopedLock lock(self._shards[s].mutex, /* write = */ false);
+            if (!self._shards[s].table.empty()) {
+                rootShard = s;
+                break;
+            }
+        }
+        for (size_t s = 0; s != _NumShards; ++s) {
+            auto &shard = self._shards[s];
+            _ScopedLock lock(shard.mutex, /* write = */ false);
+            shard.table.ParallelForEach(
+                [&visitFn, &root, s, rootShard](
+                    SdfPath const &p, auto mapped) {
+                    if (p == root && s != rootShard) {
+                        return;
+                    }
+                    visitFn(p, mapped.get());
+                });
+        }
+    }
+
+    _Shard _shards[_NumShards];
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // PXR_USD_SDF_CONCURRENT_PATH_TABLE_H
@@ -10,6 +10,7 @@
 #include "pxr/usd/sdf/changeBlock.h"
 #include "pxr/usd/sdf/childrenPolicies.h"
 #include "pxr/usd/sdf/childrenUtils.h"
+#include "pxr/usd/sdf/data.h"
 #include "pxr/usd/sdf/layer.h"
 #include "pxr/usd/sdf/path.h"
 #include "pxr/usd/sdf/payload.h"
@@ -813,9 +814,76 @@ SdfCopySpec(
         /* shouldCopyChildrenFn = */ std::bind(
             SdfShouldCopyChildren,
             std::cref(srcPath), std::cref(dstPath),
-            ph::_1, ph::_2, ph::_3, ph::_4, ph::_5, ph::_6, ph::_7, ph::_8, 
+            ph::_1, ph::_2, ph::_3, ph::_4, ph::_5, ph::_6, ph::_7, ph::_8,
             ph::_9)
         );
 }
 
+bool
+SdfCopySpecBulk(
+    const SdfLayerHandle& srcLayer, const SdfPath& srcPath,
+    const SdfLayerHandle& dstLayer, const SdfPath& dstPath)
+{
+    if (!srcLayer || !dstLayer) {
+        TF_CODING_ERROR("Invalid layer handle");
+        return false;
+    }
+
+    if (!srcPath.IsPrimPath() || !dstPath.IsPrimPath()) {
+        TF_CODING_ERROR(
+            "Bulk copies require prim source and destination paths");
+        return false;
+    }
+
+    if (srcLayer->GetSpecType(srcPath) != SdfSpecTypePrim) {
+        TF_CODING_ERROR("No prim spec at source path <%s>",
+                        srcPath.GetText());
+        return false;
+    }
+
+    // Stage the subtree into a standalone SdfData, which performs no change
+    // processing, applying the same fix-ups as the simple SdfCopySpec:
+    // specs are staged at their destination paths, and values that refer
+    // into the source subtree are remapped to the destination subtree.
+    // The splice below copies the staged fields verbatim.
+    SdfAbstractDataRefPtr stagedData = TfCreateRefPtr(new SdfData);
+
+    srcLayer->Traverse(srcPath,
+        [&](const SdfPath& path) {
+            const SdfPath stagedPath = path.ReplacePrefix(srcPath, dstPath);
+            const SdfSpecType specType = srcLayer->GetSpecType(path);
+            stagedData->CreateSpec(stagedPath, specType);
+
+            for (const TfToken& field : srcLayer->ListFields(path)) {
+                std::optional<VtValue> valueToCopy;
+                if (field == SdfChildrenKeys->ConnectionChildren ||
+                    field == SdfChildrenKeys->RelationshipTargetChildren ||
+                    field == SdfChildrenKeys->MapperChildren) {
+                    // These children fields hold target paths that must be
+                    // remapped along with the specs they identify.
+                    std::optional<VtValue> srcChildren;
+                    SdfShouldCopyChildren(
+                        srcPath, dstPath, field,
+                        srcLayer, path, /* fieldInSrc = */ true,
+                        dstLayer, stagedPath, /* fieldInDst = */ false,
+                        &srcChildren, &valueToCopy);
+                }
+                else {
+                    SdfShouldCopyValue(
+                        srcPath, dstPath, specType, field,
+                        srcLayer, path, /* fieldInSrc = */ true,
+                        dstLayer, stagedPath, /* fieldInDst = */ false,
+                        &valueToCopy);
+                }
+
+                stagedData->Set(
+                    stagedPath, field,
+                    valueToCopy ? *valueToCopy
+                                : srcLayer->GetField(path, field));
+            }
+        });
+
+    return dstLayer->SpliceSubtree(*get_pointer(stagedData), dstPath, dstPath);
+}
+
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -59,6 +59,30 @@ SdfCopySpec(
     const SdfLayerHandle& srcLayer, const SdfPath& srcPath,
     const SdfLayerHandle& dstLayer, const SdfPath& dstPath);
 
+/// Copy the prim subtree rooted at \p srcPath in \p srcLayer to \p dstPath
+/// in \p dstLayer in one bulk operation.
+///
+/// This is a restricted, faster form of SdfCopySpec for duplicating large
+/// prim subtrees.  The source subtree is staged into a standalone SdfData
+/// with the same path fix-ups that SdfCopySpec performs, then spliced into
+/// the destination layer via SdfLayer::SpliceSubtree: the specs and fields
+/// are written directly into the destination layer's data and a single
+/// coalesced change entry is emitted for the whole subtree, rather than
+/// per-field change processing.  Field values are shared with the source
+/// layer where the value types allow, rather than deep-copied.
+///
+/// Unlike SdfCopySpec, \p srcPath and \p dstPath must be prim paths, a spec
+/// must not already exist at \p dstPath, the parent of \p dstPath must be
+/// an existing prim or the pseudo-root in \p dstLayer, and custom copy
+/// policies may not be supplied.  Returns true on success, false and raises
+/// a coding error otherwise.
+///
+SDF_API
+bool
+SdfCopySpecBulk(
+    const SdfLayerHandle& srcLayer, const SdfPath& srcPath,
+    const SdfLayerHandle& dstLayer, const SdfPath& dstPath);
+
 /// @}
 
 /// \name Advanced Spec Copying API
@@ -10,10 +10,57 @@
 #include "pxr/base/trace/trace.h"
 #include "pxr/base/work/utils.h"
 
+#include <algorithm>
 #include <iostream>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+// Columnar time-sample storage: a sorted array of times with a parallel
+// array of values.  This is what the TimeSamples field value holds for an
+// SdfData constructed with columnar storage enabled; it is converted to
+// and from SdfTimeSampleMap at the field-level access API boundary.
+struct Sdf_ColumnarTimeSamples
+{
+    std::vector<double> times;
+    std::vector<VtValue> values;
+
+    bool operator==(const Sdf_ColumnarTimeSamples &other) const {
+        return times == other.times && values == other.values;
+    }
+    bool operator!=(const Sdf_ColumnarTimeSamples &other) const {
+        return !(*this == other);
+    }
+};
+
+static VtValue
+_MakeTimeSampleMap(const Sdf_ColumnarTimeSamples &samples)
+{
+    SdfTimeSampleMap result;
+    auto hint = result.end();
+    for (size_t i = 0, n = samples.times.size(); i != n; ++i) {
+        hint = result.emplace_hint(hint, samples.times[i], samples.values[i]);
+    }
+    return VtValue::Take(result);
+}
+
+static VtValue
+_MakeColumnarTimeSamples(const SdfTimeSampleMap &tsmap)
+{
+    Sdf_ColumnarTimeSamples result;
+    result.times.reserve(tsmap.size());
+    result.values.reserve(tsmap.size());
+    for (auto const &sample: tsmap) {
+        result.times.push_back(sample.first);
+        result.values.push_back(sample.second);
+    }
+    return VtValue::Take(result);
+}
+
+SdfData::SdfData(bool columnarTimeSamples)
+    : _columnarTimeSamples(columnarTimeSamples)
+{
+}
+
 SdfData::~SdfData()
 {
     // Clear out _data in parallel, since it can get big.
@@ -100,6 +147,11 @@ SdfData::Has(const SdfPath &path, const TfToken &field,
 {
     if (const VtValue* fieldValue = _GetFieldValue(path, field)) {
         if (value) {
+            if (fieldValue->IsHolding<Sdf_ColumnarTimeSamples>()) {
+                return value->StoreValue(
+                    _MakeTimeSampleMap(
+                        fieldValue->UncheckedGet<Sdf_ColumnarTimeSamples>()));
+            }
             return value->StoreValue(*fieldValue);
         }
         return true;
@@ -107,13 +159,18 @@ SdfData::Has(const SdfPath &path, const TfToken &field,
     return false;
 }
 
-bool 
-SdfData::Has(const SdfPath &path, const TfToken & field, 
+bool
+SdfData::Has(const SdfPath &path, const TfToken & field,
              VtValue *value) const
 {
     if (const VtValue* fieldValue = _GetFieldValue(path, field)) {
         if (value) {
-            *value = *fieldValue;
+            if (fieldValue->IsHolding<Sdf_ColumnarTimeSamples>()) {
+                *value = _MakeTimeSampleMap(
+                    fieldValue->UncheckedGet<Sdf_ColumnarTimeSamples>());
+            } else {
+                *value = *fieldValue;
+            }
         }
         return true;
     }
@@ -127,6 +184,10 @@ SdfData::HasSpecAndField(
 {
     if (VtValue const *v =
         _GetSpecTypeAndFieldValue(path, fieldName, specType)) {
+        if (value && v->IsHolding<Sdf_ColumnarTimeSamples>()) {
+            return value->StoreValue(
+                _MakeTimeSampleMap(v->UncheckedGet<Sdf_ColumnarTimeSamples>()));
+        }
         return !value || value->StoreValue(*v);
     }
     return false;
@@ -140,7 +201,12 @@ SdfData::HasSpecAndField(
     if (VtValue const *v =
         _GetSpecTypeAndFieldValue(path, fieldName, specType)) {
         if (value) {
-            *value = *v;
+            if (v->IsHolding<Sdf_ColumnarTimeSamples>()) {
+                *value = _MakeTimeSampleMap(
+                    v->UncheckedGet<Sdf_ColumnarTimeSamples>());
+            } else {
+                *value = *v;
+            }
         }
         return true;
     }
@@ -204,6 +270,10 @@ VtValue
 SdfData::Get(const SdfPath &path, const TfToken & field) const
 {
     if (const VtValue *value = _GetFieldValue(path, field)) {
+        if (value->IsHolding<Sdf_ColumnarTimeSamples>()) {
+            return _MakeTimeSampleMap(
+                value->UncheckedGet<Sdf_ColumnarTimeSamples>());
+        }
         return *value;
     }
     return VtValue();
@@ -222,7 +292,14 @@ SdfData::Set(const SdfPath &path, const TfToken & field,
 
     VtValue* newValue = _GetOrCreateFieldValue(path, field);
     if (newValue) {
-        *newValue = value;
+        if (_columnarTimeSamples &&
+            field == SdfDataTokens->TimeSamples &&
+            value.IsHolding<SdfTimeSampleMap>()) {
+            *newValue = _MakeColumnarTimeSamples(
+                value.UncheckedGet<SdfTimeSampleMap>());
+        } else {
+            *newValue = value;
+        }
     }
 }
 
@@ -232,6 +309,15 @@ SdfData::Set(const SdfPath &path, const TfToken &field,
 {
     TfAutoMallocTag2 tag("Sdf", "SdfData::Set");
 
+    if (_columnarTimeSamples && field == SdfDataTokens->TimeSamples) {
+        // Route through the VtValue overload so time-sample maps are
+        // converted to columnar storage.
+        VtValue mapValue;
+        value.GetValue(&mapValue);
+        Set(path, field, mapValue);
+        return;
+    }
+
     VtValue* newValue = _GetOrCreateFieldValue(path, field);
     if (newValue) {
         value.GetValue(newValue);
@@ -320,7 +406,17 @@ std::set<double>
 SdfData::ListTimeSamplesForPath(const SdfPath &path) const
 {
     std::set<double> times;
-    
+
+    if (const VtValue *fval =
+        _GetFieldValue(path, SdfDataTokens->TimeSamples)) {
+        if (fval->IsHolding<Sdf_ColumnarTimeSamples>()) {
+            auto const &sampleTimes =
+                fval->UncheckedGet<Sdf_ColumnarTimeSamples>().times;
+            times.insert(sampleTimes.begin(), sampleTimes.end());
+            return times;
+        }
+    }
+
     VtValue value = Get(path, SdfDataTokens->TimeSamples);
     if (value.IsHolding<SdfTimeSampleMap>()) {
         const SdfTimeSampleMap & timeSampleMap =
@@ -380,6 +476,33 @@ _GetBracketingTimeSamples(const SdfTimeSampleMap &samples, double time,
         time, tLower, tUpper);
 }
 
+static bool
+_GetBracketingTimeSamples(const std::vector<double> &samples, double time,
+                          double *tLower, double *tUpper)
+{
+    if (samples.empty()) {
+        // No samples.
+        return false;
+    } else if (time <= samples.front()) {
+        // Time is at-or-before the first sample.
+        *tLower = *tUpper = samples.front();
+    } else if (time >= samples.back()) {
+        // Time is at-or-after the last sample.
+        *tLower = *tUpper = samples.back();
+    } else {
+        auto iter = std::lower_bound(samples.begin(), samples.end(), time);
+        if (*iter == time) {
+            // Time is exactly on a sample.
+            *tLower = *tUpper = time;
+        } else {
+            // Time is in-between samples; return the bracketing times.
+            *tUpper = *iter;
+            *tLower = *(iter - 1);
+        }
+    }
+    return true;
+}
+
 bool
 SdfData::GetBracketingTimeSamples(
     double time, double* tLower, double* tUpper) const
@@ -395,6 +518,9 @@ SdfData::GetNumTimeSamplesForPath(const SdfPath &path) const
         if (fval->IsHolding<SdfTimeSampleMap>()) {
             return fval->UncheckedGet<SdfTimeSampleMap>().size();
         }
+        if (fval->IsHolding<Sdf_ColumnarTimeSamples>()) {
+            return fval->UncheckedGet<Sdf_ColumnarTimeSamples>().times.size();
+        }
     }
     return 0;
 }
@@ -409,6 +535,10 @@ SdfData::GetBracketingTimeSamplesForPath(
         auto const &tsmap = fval->UncheckedGet<SdfTimeSampleMap>();
         return _GetBracketingTimeSamples(tsmap, time, tLower, tUpper);
     }
+    if (fval && fval->IsHolding<Sdf_ColumnarTimeSamples>()) {
+        auto const &samples = fval->UncheckedGet<Sdf_ColumnarTimeSamples>();
+        return _GetBracketingTimeSamples(samples.times, time, tLower, tUpper);
+    }
     return false;
 }
 
@@ -426,6 +556,16 @@ SdfData::QueryTimeSample(const SdfPath &path, double time,
             return true;
         }
     }
+    if (fval && fval->IsHolding<Sdf_ColumnarTimeSamples>()) {
+        auto const &samples = fval->UncheckedGet<Sdf_ColumnarTimeSamples>();
+        auto iter = std::lower_bound(
+            samples.times.begin(), samples.times.end(), time);
+        if (iter != samples.times.end() && *iter == time) {
+            if (value)
+                *value = samples.values[iter - samples.times.begin()];
+            return true;
+        }
+    }
     return false;
 }
 
@@ -441,6 +581,15 @@ SdfData::QueryTimeSample(const SdfPath &path, double time,
             return !value || value->StoreValue(iter->second);
         }
     }
+    if (fval && fval->IsHolding<Sdf_ColumnarTimeSamples>()) {
+        auto const &samples = fval->UncheckedGet<Sdf_ColumnarTimeSamples>();
+        auto iter = std::lower_bound(
+            samples.times.begin(), samples.times.end(), time);
+        if (iter != samples.times.end() && *iter == time) {
+            return !value ||
+                value->StoreValue(samples.values[iter - samples.times.begin()]);
+        }
+    }
     return false;
 }
 
@@ -453,17 +602,46 @@ SdfData::SetTimeSample(const SdfPath &path, double time,
         return;
     }
 
-    SdfTimeSampleMap newSamples;
-
     // Attempt to get a pointer to an existing timeSamples field.
     VtValue *fieldValue =
         _GetMutableFieldValue(path, SdfDataTokens->TimeSamples);
 
-    // If we have one, swap it out so we can modify it.
+    if (_columnarTimeSamples) {
+        Sdf_ColumnarTimeSamples newSamples;
+
+        // If we have an existing field, swap it out so we can modify it.
+        if (fieldValue && fieldValue->IsHolding<Sdf_ColumnarTimeSamples>()) {
+            fieldValue->UncheckedSwap(newSamples);
+        }
+
+        // Insert or overwrite, keeping the times sorted.
+        auto iter = std::lower_bound(
+            newSamples.times.begin(), newSamples.times.end(), time);
+        const size_t index = iter - newSamples.times.begin();
+        if (iter != newSamples.times.end() && *iter == time) {
+            newSamples.values[index] = value;
+        } else {
+            newSamples.times.insert(iter, time);
+            newSamples.values.insert(newSamples.values.begin() + index, value);
+        }
+
+        // Set back into the field.
+        if (fieldValue) {
+            fieldValue->Swap(newSamples);
+        } else if (VtValue *newValue = _GetOrCreateFieldValue(
+                       path, SdfDataTokens->TimeSamples)) {
+            *newValue = VtValue::Take(newSamples);
+        }
+        return;
+    }
+
+    SdfTimeSampleMap newSamples;
+
+    // If we have an existing field, swap it out so we can modify it.
     if (fieldValue && fieldValue->IsHolding<SdfTimeSampleMap>()) {
         fieldValue->UncheckedSwap(newSamples);
     }
-    
+
     // Insert or overwrite into newSamples.
     newSamples[time] = value;
 
@@ -478,20 +656,42 @@ SdfData::SetTimeSample(const SdfPath &path, double time,
 void
 SdfData::EraseTimeSample(const SdfPath &path, double time)
 {
-    SdfTimeSampleMap newSamples;
-
     // Attempt to get a pointer to an existing timeSamples field.
     VtValue *fieldValue =
         _GetMutableFieldValue(path, SdfDataTokens->TimeSamples);
 
-    // If we have one, swap it out so we can modify it.  If we do not have one,
-    // there's nothing to erase so we're done.
+    if (fieldValue && fieldValue->IsHolding<Sdf_ColumnarTimeSamples>()) {
+        Sdf_ColumnarTimeSamples newSamples;
+        fieldValue->UncheckedSwap(newSamples);
+
+        auto iter = std::lower_bound(
+            newSamples.times.begin(), newSamples.times.end(), time);
+        if (iter != newSamples.times.end() && *iter == time) {
+            newSamples.values.erase(
+                newSamples.values.begin() + (iter - newSamples.times.begin()));
+            newSamples.times.erase(iter);
+        }
+
+        // Check to see if the result is empty.  In that case we remove the
+        // field.
+        if (newSamples.times.empty()) {
+            Erase(path, SdfDataTokens->TimeSamples);
+        } else {
+            fieldValue->UncheckedSwap(newSamples);
+        }
+        return;
+    }
+
+    SdfTimeSampleMap newSamples;
+
+    // If we have a map-valued field, swap it out so we can modify it.  If we
+    // do not have one, there's nothing to erase so we're done.
     if (fieldValue && fieldValue->IsHolding<SdfTimeSampleMap>()) {
         fieldValue->UncheckedSwap(newSamples);
     } else {
         return;
     }
-    
+
     // Erase from newSamples.
     newSamples.erase(time);
 
@@ -29,10 +29,24 @@ TF_DECLARE_WEAK_AND_REF_PTRS(SdfData);
 /// An SdfData is an implementation of SdfAbstractData that simply
 /// stores specs and fields in a map keyed by path.
 ///
+/// When constructed with columnar time-sample storage enabled, each spec's
+/// time samples are held as a sorted array of times with a parallel array
+/// of values rather than as an SdfTimeSampleMap.  This is denser in memory
+/// and faster to query for sample-heavy layers, such as in-memory layers
+/// recorded from a simulation.  The representation is internal: the
+/// field-level access API still presents the TimeSamples field as an
+/// SdfTimeSampleMap.
+///
 class SdfData : public SdfAbstractData
 {
 public:
     SdfData() {}
+
+    /// Constructs an SdfData that stores each spec's time samples in
+    /// sorted columnar arrays instead of an SdfTimeSampleMap.
+    SDF_API
+    explicit SdfData(bool columnarTimeSamples);
+
     SDF_API
     virtual ~SdfData();
 
@@ -163,6 +177,10 @@ private:
     typedef TfHashMap<_Key, _SpecData, _KeyHash> _HashTable;
 
     _HashTable _data;
+
+    // Whether time samples are stored as sorted columnar arrays rather
+    // than as SdfTimeSampleMap.
+    bool _columnarTimeSamples = false;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -17,6 +17,7 @@
 #include "pxr/usd/sdf/childrenUtils.h"
 #include "pxr/usd/sdf/debugCodes.h"
 #include "pxr/usd/sdf/fileFormat.h"
+#include "pxr/usd/sdf/layerIOStats.h"
 #include "pxr/usd/sdf/layerRegistry.h"
 #include "pxr/usd/sdf/layerStateDelegate.h"
 #include "pxr/usd/sdf/layerUtils.h"
@@ -38,6 +39,7 @@
 #include "pxr/usd/ar/resolverScopedCache.h"
 #include "pxr/base/arch/fileSystem.h"
 #include "pxr/base/arch/errno.h"
+#include "pxr/base/arch/timing.h"
 #include "pxr/base/trace/trace.h"
 #include "pxr/base/tf/debug.h"
 #include "pxr/base/tf/envSetting.h"
@@ -696,8 +698,15 @@ SdfLayer::_ComputeInfoToFindOrOpenLayer(
     const bool isAnonymous = IsAnonymousLayerIdentifier(layerPath);
     if (!isAnonymous) {
         layerPath = ArGetResolver().CreateIdentifier(layerPath);
+        ArchIntervalTimer resolveTimer(
+            /* start = */ SdfLayerIOStatsRegistry::IsEnabled());
         resolvedLayerPath = Sdf_ResolvePath(
             layerPath, computeAssetInfo ? &assetInfo : nullptr);
+        if (resolveTimer.IsStarted()) {
+            SdfLayerIOStatsRegistry::GetInstance().AddResolveSample(
+                layerPath,
+                ArchTicksToSeconds(resolveTimer.GetElapsedTicks()));
+        }
     }
 
     // Merge explicitly-specified arguments over any arguments
@@ -1113,9 +1122,23 @@ SdfLayer::_Read(
                         format->GetFormatId().GetText());
         return false;
     }
-    return IsIncludedByDetachedLayerRules(identifier) ?
+    ArchIntervalTimer readTimer(
+        /* start = */ SdfLayerIOStatsRegistry::IsEnabled());
+
+    const bool success = IsIncludedByDetachedLayerRules(identifier) ?
         format->ReadDetached(this, resolvedPath, metadataOnly) :
         format->Read(this, resolvedPath, metadataOnly);
+
+    // Only full reads are attributed; metadata-only reads would skew the
+    // per-layer parse cost.
+    if (readTimer.IsStarted() && success && !metadataOnly) {
+        const int64_t fileSize = resolvedPath.empty() ?
+            0 : ArchGetFileLength(resolvedPath.c_str());
+        SdfLayerIOStatsRegistry::GetInstance().AddReadSample(
+            identifier, resolvedPath, fileSize > 0 ? fileSize : 0,
+            ArchTicksToSeconds(readTimer.GetElapsedTicks()));
+    }
+    return success;
 }
 
 /*static*/
@@ -3129,6 +3152,220 @@ SdfLayer::TransferContent(const SdfLayerHandle& layer)
     }
 }
 
+// Copies the subtree of specs rooted at sourceRoot in sourceData into
+// data at targetPath, bypassing per-spec change processing.
+static void
+_SpliceCopySubtree(
+    SdfAbstractData *data,
+    const SdfAbstractData &sourceData,
+    const SdfPath &sourceRoot,
+    const SdfPath &targetPath)
+{
+    // Gather the source paths first; visiting is unordered and we want to
+    // copy fields without re-entering the visitor.
+    struct _CollectSubtreeVisitor : public SdfAbstractDataSpecVisitor {
+        explicit _CollectSubtreeVisitor(const SdfPath &root) : root(root) { }
+        bool VisitSpec(
+            const SdfAbstractData &, const SdfPath &path) override {
+            if (path.HasPrefix(root)) {
+                paths.push_back(path);
+            }
+            return true;
+        }
+        void Done(const SdfAbstractData &) override { }
+        const SdfPath &root;
+        SdfPathVector paths;
+    };
+    _CollectSubtreeVisitor visitor(sourceRoot);
+    sourceData.VisitSpecs(&visitor);
+
+    for (const SdfPath &path : visitor.paths) {
+        const SdfPath dstPath = path.ReplacePrefix(sourceRoot, targetPath);
+        data->CreateSpec(dstPath, sourceData.GetSpecType(path));
+        for (const TfToken &field : sourceData.List(path)) {
+            data->Set(dstPath, field, sourceData.Get(path, field));
+        }
+    }
+}
+
+bool
+SdfLayer::SpliceSubtree(
+    const SdfAbstractData &sourceData,
+    const SdfPath &sourceRoot,
+    const SdfPath &targetPath)
+{
+    TRACE_FUNCTION();
+
+    if (!PermissionToEdit()) {
+        TF_CODING_ERROR("SpliceSubtree of '%s': Permission denied.",
+                        GetDisplayName().c_str());
+        return false;
+    }
+    if (!sourceRoot.IsPrimPath() || !targetPath.IsPrimPath()) {
+        TF_CODING_ERROR("SpliceSubtree of '%s': <%s> and <%s> must both "
+                        "be prim paths.",
+                        GetDisplayName().c_str(),
+                        sourceRoot.GetText(), targetPath.GetText());
+        return false;
+    }
+    if (!sourceData.HasSpec(sourceRoot)) {
+        TF_CODING_ERROR("SpliceSubtree of '%s': no spec at source path <%s>.",
+                        GetDisplayName().c_str(), sourceRoot.GetText());
+        return false;
+    }
+    if (HasSpec(targetPath)) {
+        TF_CODING_ERROR("SpliceSubtree of '%s': spec already exists at <%s>.",
+                        GetDisplayName().c_str(), targetPath.GetText());
+        return false;
+    }
+    const SdfPath parentPath = targetPath.GetParentPath();
+    const SdfSpecType parentSpecType = GetSpecType(parentPath);
+    if (parentSpecType != SdfSpecTypePrim &&
+        parentSpecType != SdfSpecTypePseudoRoot) {
+        TF_CODING_ERROR("SpliceSubtree of '%s': parent path <%s> is not an "
+                        "existing prim or the pseudo-root.",
+                        GetDisplayName().c_str(), parentPath.GetText());
+        return false;
+    }
+
+    // Emit one coalesced change entry for the whole splice: the parent's
+    // updated children list plus the added subtree root.
+    SdfChangeBlock block;
+
+    _SpliceCopySubtree(get_pointer(_data), sourceData, sourceRoot, targetPath);
+
+    // Add the new subtree root to its parent's children list.
+    VtValue oldChildren =
+        _data->Get(parentPath, SdfChildrenKeys->PrimChildren);
+    TfTokenVector children;
+    if (oldChildren.IsHolding<TfTokenVector>()) {
+        children = oldChildren.UncheckedGet<TfTokenVector>();
+    }
+    children.push_back(targetPath.GetNameToken());
+    const VtValue newChildren(children);
+    _data->Set(parentPath, SdfChildrenKeys->PrimChildren, newChildren);
+
+    Sdf_ChangeManager &changeManager = Sdf_ChangeManager::Get();
+    changeManager.DidChangeField(
+        _self, parentPath, SdfChildrenKeys->PrimChildren,
+        std::move(oldChildren), newChildren);
+    changeManager.DidAddSpec(_self, targetPath, /* inert = */ false);
+
+    // We wrote past the state delegate, so mark the layer dirty explicitly.
+    _stateDelegate->_MarkCurrentStateAsDirty();
+
+    return true;
+}
+
+bool
+SdfLayer::SpliceSubtrees(const std::vector<SubtreeSplice> &splices)
+{
+    TRACE_FUNCTION();
+
+    if (splices.empty()) {
+        return true;
+    }
+    if (!PermissionToEdit()) {
+        TF_CODING_ERROR("SpliceSubtrees of '%s': Permission denied.",
+                        GetDisplayName().c_str());
+        return false;
+    }
+
+    // Validate every splice up front so that a failure makes no changes.
+    SdfPathSet targetPaths;
+    for (const SubtreeSplice &splice : splices) {
+        if (!splice.sourceData) {
+            TF_CODING_ERROR("SpliceSubtrees of '%s': null source data for "
+                            "target <%s>.",
+                            GetDisplayName().c_str(),
+                            splice.targetPath.GetText());
+            return false;
+        }
+        if (!splice.sourceRoot.IsPrimPath() ||
+            !splice.targetPath.IsPrimPath()) {
+            TF_CODING_ERROR("SpliceSubtrees of '%s': <%s> and <%s> must "
+                            "both be prim paths.",
+                            GetDisplayName().c_str(),
+                            splice.sourceRoot.GetText(),
+                            splice.targetPath.GetText());
+            return false;
+        }
+        if (!splice.sourceData->HasSpec(splice.sourceRoot)) {
+            TF_CODING_ERROR("SpliceSubtrees of '%s': no spec at source "
+                            "path <%s>.",
+                            GetDisplayName().c_str(),
+                            splice.sourceRoot.GetText());
+            return false;
+        }
+        if (HasSpec(splice.targetPath)) {
+            TF_CODING_ERROR("SpliceSubtrees of '%s': spec already exists "
+                            "at <%s>.",
+                            GetDisplayName().c_str(),
+                            splice.targetPath.GetText());
+            return false;
+        }
+        if (!targetPaths.insert(splice.targetPath).second) {
+            TF_CODING_ERROR("SpliceSubtrees of '%s': multiple splices "
+                            "target <%s>.",
+                            GetDisplayName().c_str(),
+                            splice.targetPath.GetText());
+            return false;
+        }
+        const SdfPath parentPath = splice.targetPath.GetParentPath();
+        const SdfSpecType parentSpecType = GetSpecType(parentPath);
+        if (parentSpecType != SdfSpecTypePrim &&
+            parentSpecType != SdfSpecTypePseudoRoot) {
+            TF_CODING_ERROR("SpliceSubtrees of '%s': parent path <%s> is "
+                            "not an existing prim or the pseudo-root.",
+                            GetDisplayName().c_str(), parentPath.GetText());
+            return false;
+        }
+    }
+
+    // Emit one coalesced change batch for all splices.
+    SdfChangeBlock block;
+
+    // Copy all subtrees, accumulating children additions so that each
+    // affected parent's children list is rewritten only once.
+    std::map<SdfPath, TfTokenVector> childrenToAdd;
+    for (const SubtreeSplice &splice : splices) {
+        _SpliceCopySubtree(get_pointer(_data), *splice.sourceData,
+                           splice.sourceRoot, splice.targetPath);
+        childrenToAdd[splice.targetPath.GetParentPath()].push_back(
+            splice.targetPath.GetNameToken());
+    }
+
+    Sdf_ChangeManager &changeManager = Sdf_ChangeManager::Get();
+    for (auto &parentAndNames : childrenToAdd) {
+        const SdfPath &parentPath = parentAndNames.first;
+
+        VtValue oldChildren =
+            _data->Get(parentPath, SdfChildrenKeys->PrimChildren);
+        TfTokenVector children;
+        if (oldChildren.IsHolding<TfTokenVector>()) {
+            children = oldChildren.UncheckedGet<TfTokenVector>();
+        }
+        children.insert(children.end(),
+                        parentAndNames.second.begin(),
+                        parentAndNames.second.end());
+        const VtValue newChildren(children);
+        _data->Set(parentPath, SdfChildrenKeys->PrimChildren, newChildren);
+
+        changeManager.DidChangeField(
+            _self, parentPath, SdfChildrenKeys->PrimChildren,
+            std::move(oldChildren), newChildren);
+    }
+    for (const SubtreeSplice &splice : splices) {
+        changeManager.DidAddSpec(
+            _self, splice.targetPath, /* inert = */ false);
+    }
+
+    // We wrote past the state delegate, so mark the layer dirty explicitly.
+    _stateDelegate->_MarkCurrentStateAsDirty();
+
+    return true;
+}
+
 static void
 _GatherPrimCompositionDependencies(const SdfPrimSpecHandle &prim,
                                    set<string> *assetReferences)
@@ -259,6 +259,58 @@ public:
     SDF_API
     void TransferContent(const SdfLayerHandle& layer);
 
+    /// Splices the subtree of specs rooted at \p sourceRoot in
+    /// \p sourceData into this layer at \p targetPath in one bulk
+    /// operation.
+    ///
+    /// This is a bulk-authoring facility for procedurally generating large
+    /// numbers of specs: callers build the subtree into a standalone
+    /// SdfData -- which performs no change processing -- and splice it into
+    /// the layer in a single operation that emits one coalesced change
+    /// entry for the whole subtree, rather than per-spec notifications.
+    ///
+    /// \p sourceRoot and \p targetPath must be prim paths, a spec must not
+    /// already exist at \p targetPath, and the parent of \p targetPath must
+    /// exist in this layer.  The caller is responsible for ensuring that
+    /// the specs and fields in \p sourceData are valid scene description;
+    /// unlike spec-level authoring, no schema validation is performed here.
+    /// Returns true on success, false and raises a coding error otherwise.
+    SDF_API
+    bool SpliceSubtree(
+        const SdfAbstractData &sourceData,
+        const SdfPath &sourceRoot,
+        const SdfPath &targetPath);
+
+    /// \struct SubtreeSplice
+    /// Describes one splice for SpliceSubtrees(): the subtree of specs
+    /// rooted at \p sourceRoot in \p sourceData is spliced into the
+    /// layer at \p targetPath.
+    struct SubtreeSplice {
+        const SdfAbstractData *sourceData = nullptr;
+        SdfPath sourceRoot;
+        SdfPath targetPath;
+    };
+
+    /// Splices multiple subtrees into this layer in one bulk operation.
+    ///
+    /// This is the multi-producer form of SpliceSubtree(): producer
+    /// threads each populate a private staging SdfData shard concurrently
+    /// -- SdfData performs no change processing, so a shard confined to
+    /// one thread needs no locking -- and the single thread that owns the
+    /// layer splices all shards at once.  All splices are applied under a
+    /// single change block, so listeners see one coalesced change batch,
+    /// and the children list of each affected parent is updated once
+    /// rather than once per splice.
+    ///
+    /// Every splice must satisfy the preconditions of SpliceSubtree();
+    /// additionally, no two splices may target the same path and each
+    /// target's parent must already exist in this layer (it may not be
+    /// created by another splice in the same call).  If any splice fails
+    /// validation, no changes are made, a coding error is raised, and
+    /// false is returned.
+    SDF_API
+    bool SpliceSubtrees(const std::vector<SubtreeSplice> &splices);
+
     /// Creates a new \e anonymous layer with an optional \p tag. An anonymous
     /// layer is a layer with a system assigned identifier, that cannot be
     /// saved to disk via Save(). Anonymous layers have an identifier, but no
@@ -0,0 +1,116 @@
+//
+// Copyright 2025 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+#include "pxr/pxr.h"
+#include "pxr/usd/sdf/layerIOStats.h"
+
+#include "pxr/base/js/json.h"
+#include "pxr/base/tf/envSetting.h"
+#include "pxr/base/tf/instantiateSingleton.h"
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+TF_INSTANTIATE_SINGLETON(SdfLayerIOStatsRegistry);
+
+TF_DEFINE_ENV_SETTING(
+    SDF_ENABLE_LAYER_IO_STATS, false,
+    "Record per-layer resolve time, read time and file size as layers "
+    "are opened; query with SdfLayerIOStatsRegistry.");
+
+SdfLayerIOStatsRegistry::SdfLayerIOStatsRegistry() = default;
+
+/* static */
+SdfLayerIOStatsRegistry&
+SdfLayerIOStatsRegistry::GetInstance()
+{
+    return TfSingleton<SdfLayerIOStatsRegistry>::GetInstance();
+}
+
+/* static */
+bool
+SdfLayerIOStatsRegistry::IsEnabled()
+{
+    static const bool enabled =
+        TfGetEnvSetting(SDF_ENABLE_LAYER_IO_STATS);
+    return enabled;
+}
+
+bool
+SdfLayerIOStatsRegistry::GetStats(const std::string& identifier,
+                                  SdfLayerIOStats* stats) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    const auto it = _stats.find(identifier);
+    if (it == _stats.end()) {
+        return false;
+    }
+    if (stats) {
+        *stats = it->second;
+    }
+    return true;
+}
+
+std::vector<SdfLayerIOStats>
+SdfLayerIOStatsRegistry::GetAllStats() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    std::vector<SdfLayerIOStats> result;
+    result.reserve(_stats.size());
+    for (const auto& entry : _stats) {
+        result.push_back(entry.second);
+    }
+    return result;
+}
+
+std::string
+SdfLayerIOStatsRegistry::ExportAsJsonString() const
+{
+    JsObject layers;
+    for (const SdfLayerIOStats& stats : GetAllStats()) {
+        JsObject entry;
+        entry["resolvedPath"] = JsValue(stats.resolvedPath);
+        entry["numReads"] = JsValue(uint64_t(stats.numReads));
+        entry["resolveSeconds"] = JsValue(stats.resolveSeconds);
+        entry["readSeconds"] = JsValue(stats.readSeconds);
+        entry["fileSizeBytes"] = JsValue(int64_t(stats.fileSizeBytes));
+        layers[stats.identifier] = JsValue(std::move(entry));
+    }
+    return JsWriteToString(JsValue(std::move(layers)));
+}
+
+void
+SdfLayerIOStatsRegistry::Clear()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stats.clear();
+}
+
+void
+SdfLayerIOStatsRegistry::AddResolveSample(const std::string& identifier,
+                                          double seconds)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    SdfLayerIOStats& stats = _stats[identifier];
+    stats.identifier = identifier;
+    stats.resolveSeconds += seconds;
+}
+
+void
+SdfLayerIOStatsRegistry::AddReadSample(const std::string& identifier,
+                                       const std::string& resolvedPath,
+                                       int64_t fileSizeBytes,
+                                       double seconds)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    SdfLayerIOStats& stats = _stats[identifier];
+    stats.identifier = identifier;
+    stats.resolvedPath = resolvedPath;
+    ++stats.numReads;
+    stats.readSeconds += seconds;
+    stats.fileSizeBytes = fileSizeBytes;
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
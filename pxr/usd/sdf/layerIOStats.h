@@ -0,0 +1,118 @@
+//
+// Copyright 2025 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+#ifndef PXR_USD_SDF_LAYER_IO_STATS_H
+#define PXR_USD_SDF_LAYER_IO_STATS_H
+
+#include "pxr/pxr.h"
+#include "pxr/usd/sdf/api.h"
+#include "pxr/base/tf/singleton.h"
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// \struct SdfLayerIOStats
+///
+/// Accumulated I/O and parse metrics for a single layer, recorded by
+/// SdfLayer as the layer is opened.  Times accumulate across repeated
+/// opens of the same identifier (e.g. after Reload).
+struct SdfLayerIOStats
+{
+    /// The layer's identifier, as passed to SdfLayer::FindOrOpen.
+    std::string identifier;
+
+    /// The resolved path the layer was last read from.
+    std::string resolvedPath;
+
+    /// Number of times the layer's data has been read.
+    size_t numReads = 0;
+
+    /// Total seconds spent resolving the identifier.
+    double resolveSeconds = 0.0;
+
+    /// Total seconds spent fetching and parsing the layer's data.
+    double readSeconds = 0.0;
+
+    /// Size in bytes of the resolved file at the last read, or zero if
+    /// unknown (e.g. anonymous layers).
+    int64_t fileSizeBytes = 0;
+};
+
+/// \class SdfLayerIOStatsRegistry
+///
+/// Process-wide registry of per-layer open metrics: resolve time, read
+/// (fetch + parse) time and file size.  Recording is enabled by setting
+/// the SDF_ENABLE_LAYER_IO_STATS environment variable before layers are
+/// opened; it is off by default.  The recorded metrics can be queried by
+/// layer identifier or exported as JSON for pipeline dashboards to
+/// attribute slow opens to specific assets.
+class SdfLayerIOStatsRegistry
+{
+    SdfLayerIOStatsRegistry(const SdfLayerIOStatsRegistry&) = delete;
+    SdfLayerIOStatsRegistry& operator=(
+        const SdfLayerIOStatsRegistry&) = delete;
+
+public:
+    /// Returns the single registry instance.
+    SDF_API
+    static SdfLayerIOStatsRegistry& GetInstance();
+
+    /// Returns true if recording is enabled via the
+    /// SDF_ENABLE_LAYER_IO_STATS environment variable.
+    SDF_API
+    static bool IsEnabled();
+
+    /// Fills \p stats with the metrics recorded for \p identifier and
+    /// returns true, or returns false if nothing has been recorded for it.
+    SDF_API
+    bool GetStats(const std::string& identifier,
+                  SdfLayerIOStats* stats) const;
+
+    /// Returns the metrics recorded for all layers.
+    SDF_API
+    std::vector<SdfLayerIOStats> GetAllStats() const;
+
+    /// Returns the recorded metrics as a JSON string: an object keyed by
+    /// layer identifier whose values hold the fields of SdfLayerIOStats.
+    SDF_API
+    std::string ExportAsJsonString() const;
+
+    /// Discards all recorded metrics.
+    SDF_API
+    void Clear();
+
+    /// Records \p seconds spent resolving \p identifier.  Called by
+    /// SdfLayer when recording is enabled.
+    SDF_API
+    void AddResolveSample(const std::string& identifier, double seconds);
+
+    /// Records a read of \p identifier from \p resolvedPath taking
+    /// \p seconds for \p fileSizeBytes bytes.  Called by SdfLayer when
+    /// recording is enabled.
+    SDF_API
+    void AddReadSample(const std::string& identifier,
+                       const std::string& resolvedPath,
+                       int64_t fileSizeBytes,
+                       double seconds);
+
+private:
+    friend class TfSingleton<SdfLayerIOStatsRegistry>;
+    SdfLayerIOStatsRegistry();
+
+    mutable std::mutex _mutex;
+    std::unordered_map<std::string, SdfLayerIOStats> _stats;
+};
+
+SDF_API_TEMPLATE_CLASS(TfSingleton<SdfLayerIOStatsRegistry>);
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // PXR_USD_SDF_LAYER_IO_STATS_H
@@ -77,7 +77,7 @@ Sdf_LayerRegistry::Sdf_LayerRegistry()
 // or warn if an expected key is missing.
 static bool
 _TryToRemove(const std::string& key, const SdfLayerHandle& layer,
-             std::unordered_map<std::string, SdfLayerHandle, TfHash>* map) {
+             TfFlatHashMap<std::string, SdfLayerHandle, TfHash>* map) {
     if (!key.empty()) {
         if (const auto it = map->find(key);
             it != std::end(*map) && it->second == layer) {
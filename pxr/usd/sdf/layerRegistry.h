@@ -12,6 +12,7 @@
 #include "pxr/pxr.h"
 #include "pxr/usd/sdf/assetPathResolver.h"
 #include "pxr/usd/sdf/declareHandles.h"
+#include "pxr/base/tf/flatHashMap.h"
 #include "pxr/base/tf/hash.h"
 
 #include <string>
@@ -82,8 +83,11 @@ private:
     class _Layers final {
     public:
         _Layers() = default;
+        // The real path index is consulted on every SdfLayer::Find/FindOrOpen,
+        // so it uses a flat table. The multimap indices below remain
+        // node-based since there is no flat multimap counterpart.
         using LayersByRealPath =
-            std::unordered_map<std::string, SdfLayerHandle, TfHash>;
+            TfFlatHashMap<std::string, SdfLayerHandle, TfHash>;
         using LayersByIdentifier =
             std::unordered_multimap<std::string, SdfLayerHandle, TfHash>;
         using LayersByRepositoryPath =
@@ -15,10 +15,12 @@
 #include "pxr/base/tf/diagnostic.h"
 #include "pxr/base/tf/iterator.h"
 #include "pxr/base/tf/registryManager.h"
+#include "pxr/base/tf/smallVector.h"
 #include "pxr/base/tf/type.h"
 #include "pxr/base/tf/token.h"
 #include "pxr/base/trace/trace.h"
 
+#include <algorithm>
 #include <ostream>
 
 using std::string;
@@ -269,8 +271,85 @@ SdfListOp<T>::ClearAndMakeExplicit()
     _SetExplicit(true);
 }
 
+// Attempt to apply a non-explicit list-op consisting only of deleted,
+// prepended and appended items to \p vec in a single pass over vectors,
+// without building the node-based list and map that the general path
+// below requires.  This is the dominant case for composition: modern
+// list edits (references, payloads, inherits, etc.) are authored as
+// prepend/append/delete, and op application is hot when composing
+// reference-heavy scenes.
+//
+// TfDenseHashSet does a linear scan while small and switches to a hash
+// table beyond its threshold, so membership tests stay cheap for both
+// the typical few-item ops and pathological thousand-item ops.
+//
+// Returns false, leaving \p vec untouched, if the input contains
+// duplicate items; the general path has subtle (and unlikely to be
+// relied upon) semantics for duplicates that are not worth replicating
+// here.
 template <typename T>
-void 
+static bool
+_TryApplyOperationsFast(const SdfListOp<T> &op, std::vector<T> *vec)
+{
+    const std::vector<T> &deleted = op.GetDeletedItems();
+    const std::vector<T> &prepended = op.GetPrependedItems();
+    const std::vector<T> &appended = op.GetAppendedItems();
+
+    using _Set = TfDenseHashSet<T, TfHash>;
+
+    const _Set deletedSet(deleted.begin(), deleted.end());
+    const _Set appendedSet(appended.begin(), appended.end());
+
+    // The appended items form the tail of the result, deduplicated
+    // keeping the last occurrence; an appended item is moved to the
+    // tail even if it is also prepended or already in the input.
+    TfSmallVector<T, 8> appendTail;
+    appendTail.reserve(appended.size());
+    {
+        _Set seen;
+        for (auto i = appended.rbegin(), e = appended.rend(); i != e; ++i) {
+            if (seen.insert(*i).second) {
+                appendTail.push_back(*i);
+            }
+        }
+        std::reverse(appendTail.begin(), appendTail.end());
+    }
+
+    std::vector<T> result;
+    result.reserve(prepended.size() + vec->size() + appendTail.size());
+
+    // The prepended items form the head of the result, deduplicated
+    // keeping the first occurrence; a prepended item that is also
+    // appended winds up in the tail instead.
+    _Set prependedSet;
+    for (const T &item : prepended) {
+        if (prependedSet.insert(item).second && !appendedSet.count(item)) {
+            result.push_back(item);
+        }
+    }
+
+    // Input items stay in place, in order, unless deleted or moved
+    // into the head or tail.
+    _Set inputSet;
+    for (const T &item : *vec) {
+        if (!inputSet.insert(item).second) {
+            // Duplicate input item; fall back to the general path.
+            return false;
+        }
+        if (!deletedSet.count(item) &&
+            !prependedSet.count(item) &&
+            !appendedSet.count(item)) {
+            result.push_back(item);
+        }
+    }
+
+    result.insert(result.end(), appendTail.begin(), appendTail.end());
+    vec->swap(result);
+    return true;
+}
+
+template <typename T>
+void
 SdfListOp<T>::ApplyOperations(ItemVector* vec, const ApplyCallback& cb) const
 {
     if (!vec) {
@@ -300,6 +379,11 @@ SdfListOp<T>::ApplyOperations(ItemVector* vec, const ApplyCallback& cb) const
             return;
         }
 
+        if (!cb && numToAdd == 0 && numToOrder == 0 &&
+            _TryApplyOperationsFast(*this, vec)) {
+            return;
+        }
+
         // Make a list of the inputs.  We can efficiently (O(1)) splice
         // these elements later.
         result.insert(result.end(), vec->begin(), vec->end());
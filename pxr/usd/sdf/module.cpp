@@ -21,6 +21,7 @@ TF_WRAP_MODULE
     TF_WRAP( CopyUtils );
     TF_WRAP( FileFormat );
     TF_WRAP( Layer );
+    TF_WRAP( LayerIOStats );
     TF_WRAP( LayerOffset );
     TF_WRAP( LayerTree );
     TF_WRAP( NamespaceEdit );
@@ -239,6 +239,47 @@ public:
         return _EvalExpr(evalPattern);
     }
 
+    /// Evaluate this expression over the sorted range of paths [\p begin,
+    /// \p end) and return all matching paths.  The iterators' value_type must
+    /// be SdfPath, and the range must be sorted according to
+    /// SdfPath::operator<(), so that the descendants of any path form a
+    /// contiguous subrange following it.
+    ///
+    /// This is substantially faster than calling Match() on each path
+    /// individually: whenever the expression evaluates with a result that is
+    /// constant over descendants, the entire prefixed subrange is either
+    /// accepted or rejected wholesale without further evaluation.  For
+    /// expressions anchored under a small number of prefixes, which is
+    /// typical, this skips the bulk of a large namespace.
+    template <class ForwardIterator, class PathToObject>
+    SdfPathVector
+    MatchAll(ForwardIterator begin, ForwardIterator end,
+             PathToObject const &pathToObj) const {
+        SdfPathVector result;
+        if (IsEmpty()) {
+            return result;
+        }
+        for (ForwardIterator iter = begin; iter != end;) {
+            SdfPath const &path = *iter;
+            SdfPredicateFunctionResult matchResult = Match(path, pathToObj);
+            if (matchResult) {
+                result.push_back(path);
+            }
+            ++iter;
+            if (matchResult.IsConstant()) {
+                // The result holds for all descendants, so consume the
+                // whole prefixed subrange without evaluating it.
+                ForwardIterator subtreeEnd =
+                    SdfPathFindPrefixedRange(iter, end, path).second;
+                if (matchResult) {
+                    result.insert(result.end(), iter, subtreeEnd);
+                }
+                iter = subtreeEnd;
+            }
+        }
+        return result;
+    }
+
     /// \class IncrementalSearcher
     ///
     /// This class implements stateful incremental search over DomainType
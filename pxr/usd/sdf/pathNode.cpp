@@ -22,6 +22,7 @@
 
 #include <tbb/concurrent_hash_map.h>
 #include <tbb/spin_mutex.h>
+#include <tbb/spin_rw_mutex.h>
 
 #include <atomic>
 #include <memory>
@@ -186,7 +187,7 @@ struct _PrimTable {
 
     struct _MapAndMutex {
         pxr_tsl::robin_map<_ParentAnd<T>, PoolHandle, TfHash> map;
-        mutable tbb::spin_mutex mutex;
+        mutable tbb::spin_rw_mutex mutex;
     };
 
     _MapAndMutex &GetMapAndMutexFor(_ParentAndRef<T> const &pat) {
@@ -206,7 +207,7 @@ struct _PropTable {
 
     struct _MapAndMutex {
         pxr_tsl::robin_map<_ParentAnd<T>, PoolHandle, TfHash> map;
-        mutable tbb::spin_mutex mutex;
+        mutable tbb::spin_rw_mutex mutex;
     };
 
     _MapAndMutex &GetMapAndMutexFor(_ParentAndRef<T> const &pat) {
@@ -233,7 +234,33 @@ _FindOrCreate(Table &table,
     std::pair<_ParentAndRef<Args...>, typename Table::PoolHandle>
         newItem { { parent, args... }, {} };
     auto &mapAndMutex = table.GetMapAndMutexFor(newItem.first);
-    tbb::spin_mutex::scoped_lock lock(mapAndMutex.mutex);
+
+    {
+        // Fast path.  Existing nodes are by far the common case, and finding
+        // one requires only a shared lock plus an atomic refcount bump, so
+        // concurrent path creation over existing nodes does not serialize on
+        // the shard.
+        tbb::spin_rw_mutex::scoped_lock
+            lock(mapAndMutex.mutex, /*write=*/false);
+        auto iter = mapAndMutex.map.find(newItem.first);
+        if (iter != mapAndMutex.map.end()) {
+            if (!Table::NodeHandle::IsCounted) {
+                return typename Table::NodeHandle(
+                    iter->second, /* add_ref = */ false);
+            }
+            auto &refCount = Access::GetRefCount(iter->second);
+            if ((refCount.fetch_add(1) & Sdf_PathNode::RefCountMask) != 0) {
+                return typename Table::NodeHandle(
+                    iter->second, /* add_ref = */ false);
+            }
+            // The node had begun dying (another client dropped its refcount
+            // to 0).  Undo the speculative increment and fall through to the
+            // exclusive path, which will install a new node.
+            refCount.fetch_sub(1);
+        }
+    }
+
+    tbb::spin_rw_mutex::scoped_lock lock(mapAndMutex.mutex);
 
     auto iresult = mapAndMutex.map.insert(newItem);
     if (iresult.second) {
@@ -273,7 +300,7 @@ _Remove(const Sdf_PathNode *pathNode,
     // destroyed.  If it is this node, we remove it.
     _ParentAndRef<Args...> pat { parent.get(), args... };
     auto &mapAndMutex = table.GetMapAndMutexFor(pat);
-    tbb::spin_mutex::scoped_lock lock(mapAndMutex.mutex);
+    tbb::spin_rw_mutex::scoped_lock lock(mapAndMutex.mutex);
 
     auto iter = mapAndMutex.map.find(pat);
     if (iter != mapAndMutex.map.end() &&
@@ -869,7 +896,8 @@ _GatherChildrenFrom(Sdf_PathNode const *parent,
 {
     for (size_t outerIndex = 0; outerIndex != NumNodeMaps; ++outerIndex) {
         auto &mapAndMutex = table._mapsAndMutexes[outerIndex];
-        tbb::spin_mutex::scoped_lock lock(mapAndMutex.mutex);
+        tbb::spin_rw_mutex::scoped_lock
+            lock(mapAndMutex.mutex, /*write=*/false);
         TF_FOR_ALL(i, mapAndMutex.map) {
             if (i->first.parent == parent)
                 result->emplace_back(
@@ -0,0 +1,177 @@
+//
+// Copyright 2017 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+#include "pxr/pxr.h"
+#include "pxr/usd/sdf/concurrentPathTable.h"
+#include "pxr/usd/sdf/path.h"
+
+#include "pxr/base/tf/diagnostic.h"
+#include "pxr/base/tf/stringUtils.h"
+#include "pxr/base/work/loops.h"
+
+#include <atomic>
+#include <cstdio>
+#include <string>
+
+using std::string;
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+static void TestBasics()
+{
+    typedef SdfConcurrentPathTable<string> Table;
+
+    Table table;
+
+    // Begins empty.
+    TF_AXIOM(table.empty());
+    TF_AXIOM(table.size() == 0);
+
+    // Inserting a path implicitly inserts all ancestors.
+    TF_AXIOM(table.insert(Table::value_type(SdfPath("/a/b/c"), "c")).second);
+    TF_AXIOM(!table.empty());
+    TF_AXIOM(table.size() == 4);
+    TF_AXIOM(table.count(SdfPath("/a/b/c")));
+    TF_AXIOM(table.count(SdfPath("/a/b")));
+    TF_AXIOM(table.count(SdfPath("/a")));
+    TF_AXIOM(table.count(SdfPath("/")));
+    TF_AXIOM(!table.count(SdfPath("/x")));
+
+    // Duplicate insertion fails and preserves the existing value.
+    std::pair<string *, bool> result =
+        table.insert(Table::value_type(SdfPath("/a/b/c"), "dupe"));
+    TF_AXIOM(!result.second);
+    TF_AXIOM(*result.first == "c");
+
+    // Find returns stable pointers to mapped values.
+    string *mapped = table.Find(SdfPath("/a/b/c"));
+    TF_AXIOM(mapped && *mapped == "c");
+    TF_AXIOM(!table.Find(SdfPath("/no/such/path")));
+
+    // Insert using the subscript operator.
+    table[SdfPath("/x/y")] = "y";
+    TF_AXIOM(table.size() == 6);
+    TF_AXIOM(table.Find(SdfPath("/x/y")) && *table.Find(SdfPath("/x/y")) == "y");
+    TF_AXIOM(mapped == table.Find(SdfPath("/a/b/c")));
+
+    // Subtree visitation covers the subtree root and all descendants.
+    {
+        std::atomic_int count(0);
+        table.VisitSubtree(SdfPath("/a"),
+                           [&count](SdfPath const &, string const &) {
+                               ++count;
+                           });
+        TF_AXIOM(count.load() == 3);
+
+        // Visiting from the absolute root visits everything, with the root
+        // entry visited exactly once.
+        count = 0;
+        std::atomic_int rootCount(0);
+        Table const &ctable = table;
+        ctable.VisitSubtree(SdfPath("/"),
+                            [&count, &rootCount](
+                                SdfPath const &p, string const &) {
+                                ++count;
+                                if (p == SdfPath("/")) {
+                                    ++rootCount;
+                                }
+                            });
+        TF_AXIOM(static_cast<size_t>(count.load()) == table.size());
+        TF_AXIOM(rootCount.load() == 1);
+    }
+
+    // ParallelForEach visits every entry once, including the root.
+    {
+        std::atomic_int count(0), rootCount(0);
+        table.ParallelForEach([&count, &rootCount](
+                                  SdfPath const &p, string &v) {
+            ++count;
+            if (p == SdfPath("/")) {
+                ++rootCount;
+            }
+            if (p == SdfPath("/x/y")) {
+                v = "visited";
+            }
+        });
+        TF_AXIOM(static_cast<size_t>(count.load()) == table.size());
+        TF_AXIOM(rootCount.load() == 1);
+        TF_AXIOM(*table.Find(SdfPath("/x/y")) == "visited");
+    }
+
+    // Erasing a path erases its descendants.
+    TF_AXIOM(table.erase(SdfPath("/a")));
+    TF_AXIOM(!table.erase(SdfPath("/a")));
+    TF_AXIOM(!table.count(SdfPath("/a/b/c")));
+    TF_AXIOM(table.count(SdfPath("/x/y")));
+    TF_AXIOM(table.count(SdfPath("/")));
+
+    // Erasing the root erases everything.
+    TF_AXIOM(table.erase(SdfPath("/")));
+    TF_AXIOM(table.empty());
+    TF_AXIOM(table.size() == 0);
+}
+
+static void TestParallelPopulation()
+{
+    typedef SdfConcurrentPathTable<int> Table;
+
+    Table table;
+
+    // Concurrently populate children beneath a handful of top-level prims,
+    // with concurrent readers mixed in.
+    constexpr size_t numTops = 8;
+    constexpr size_t numItems = 1024;
+    WorkParallelForN(
+        numItems,
+        [&table](size_t i, size_t end) {
+            for (; i != end; ++i) {
+                const SdfPath path(
+                    TfStringPrintf("/top%zu/child%zu", i % numTops, i));
+                table[path] = static_cast<int>(i);
+                // Read back through the concurrent interface.
+                int *mapped = table.Find(path);
+                TF_AXIOM(mapped && *mapped == static_cast<int>(i));
+            }
+        });
+
+    // All entries are present: one root, the tops, and the children.
+    TF_AXIOM(table.size() == 1 + numTops + numItems);
+    for (size_t i = 0; i != numItems; ++i) {
+        const SdfPath path(
+            TfStringPrintf("/top%zu/child%zu", i % numTops, i));
+        int *mapped = table.Find(path);
+        TF_AXIOM(mapped && *mapped == static_cast<int>(i));
+    }
+
+    // Concurrently erase half the subtrees while reading the others.
+    WorkParallelForN(
+        numTops,
+        [&table](size_t i, size_t end) {
+            for (; i != end; ++i) {
+                if (i % 2 == 0) {
+                    TF_AXIOM(table.erase(
+                                 SdfPath(TfStringPrintf("/top%zu", i))));
+                } else {
+                    TF_AXIOM(table.count(
+                                 SdfPath(TfStringPrintf("/top%zu", i))));
+                }
+            }
+        });
+    TF_AXIOM(table.size() == 1 + numTops / 2 + numItems / 2);
+
+    table.clear();
+    TF_AXIOM(table.empty());
+}
+
+int
+main(int argc, char **argv)
+{
+    TestBasics();
+    TestParallelPopulation();
+
+    printf(">>> Test SUCCEEDED\n");
+    return 0;
+}
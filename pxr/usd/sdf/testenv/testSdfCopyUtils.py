@@ -5,7 +5,7 @@
 # Licensed under the terms set forth in the LICENSE.txt file available at
 # https://openusd.org/license.
 
-from pxr import Sdf
+from pxr import Sdf, Tf
 import textwrap, unittest
 
 class TestSdfCopyUtils(unittest.TestCase):
@@ -134,6 +134,53 @@ class TestSdfCopyUtils(unittest.TestCase):
                 },
             })
 
+    def test_BulkCopy(self):
+        """Tests bulk subtree copying via Sdf.CopySpecBulk"""
+        srcLayer = Sdf.Layer.CreateAnonymous()
+        primSpec = Sdf.CreatePrimInLayer(srcLayer, "/Test/Child")
+        primSpec.specifier = Sdf.SpecifierDef
+        attrSpec = Sdf.AttributeSpec(primSpec, "attr", Sdf.ValueTypeNames.Float)
+        attrSpec.default = 1.0
+        attrSpec.connectionPathList.explicitItems = \
+            [ "/Test/Child.attr2", "/Test/Sibling.attr" ]
+        relSpec = Sdf.RelationshipSpec(primSpec, "rel")
+        relSpec.targetPathList.explicitItems = [ "/Test/Child" ]
+
+        dstLayer = Sdf.Layer.CreateAnonymous()
+        self.assertTrue(
+            Sdf.CopySpecBulk(srcLayer, "/Test", dstLayer, "/TestCopy"))
+
+        self.assertTrue(dstLayer.GetPrimAtPath("/TestCopy"))
+        self.assertTrue(dstLayer.GetPrimAtPath("/TestCopy/Child"))
+
+        dstAttrSpec = dstLayer.GetAttributeAtPath("/TestCopy/Child.attr")
+        self.assertTrue(dstAttrSpec)
+        self.assertEqual(dstAttrSpec.default, 1.0)
+
+        # Paths that point into the copied subtree are remapped to the
+        # destination, exactly as with Sdf.CopySpec.
+        expectedListOp = Sdf.PathListOp()
+        expectedListOp.explicitItems = \
+            [ "/TestCopy/Child.attr2", "/Test/Sibling.attr" ]
+        self.assertEqual(
+            dstAttrSpec.GetInfo("connectionPaths"), expectedListOp)
+
+        dstRelSpec = dstLayer.GetRelationshipAtPath("/TestCopy/Child.rel")
+        self.assertTrue(dstRelSpec)
+        self.assertEqual(
+            list(dstRelSpec.targetPathList.explicitItems),
+            [ Sdf.Path("/TestCopy/Child") ])
+
+        # Unlike Sdf.CopySpec, bulk copies never overwrite an existing
+        # destination spec.
+        with self.assertRaises(Tf.ErrorException):
+            Sdf.CopySpecBulk(srcLayer, "/Test", dstLayer, "/TestCopy")
+
+        # Only prim-to-prim copies are supported.
+        with self.assertRaises(Tf.ErrorException):
+            Sdf.CopySpecBulk(
+                srcLayer, "/Test/Child.attr", dstLayer, "/TestCopy2.attr")
+
     def test_Overwrite(self):
         """Tests that copying a spec will overwrite a pre-existing spec
         completely."""
@@ -0,0 +1,134 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+#include "pxr/pxr.h"
+#include "pxr/usd/sdf/data.h"
+#include "pxr/usd/sdf/abstractData.h"
+#include "pxr/usd/sdf/path.h"
+#include "pxr/usd/sdf/types.h"
+#include "pxr/base/tf/diagnostic.h"
+#include "pxr/base/vt/value.h"
+
+#include <cstdio>
+#include <set>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+static SdfDataRefPtr
+_MakeColumnarData(const SdfPath &attrPath)
+{
+    SdfDataRefPtr data =
+        TfCreateRefPtr(new SdfData(/* columnarTimeSamples = */ true));
+    data->CreateSpec(SdfPath::AbsoluteRootPath(), SdfSpecTypePseudoRoot);
+    data->CreateSpec(attrPath.GetPrimPath(), SdfSpecTypePrim);
+    data->CreateSpec(attrPath, SdfSpecTypeAttribute);
+    return data;
+}
+
+static void
+_TestTimeSampleAccess()
+{
+    const SdfPath attrPath("/Prim.attr");
+    SdfDataRefPtr data = _MakeColumnarData(attrPath);
+
+    // Author samples out of order; queries must see them sorted.
+    data->SetTimeSample(attrPath, 3.0, VtValue(30.0));
+    data->SetTimeSample(attrPath, 1.0, VtValue(10.0));
+    data->SetTimeSample(attrPath, 2.0, VtValue(20.0));
+
+    TF_AXIOM(data->GetNumTimeSamplesForPath(attrPath) == 3);
+    TF_AXIOM(data->ListTimeSamplesForPath(attrPath) ==
+             std::set<double>({1.0, 2.0, 3.0}));
+    TF_AXIOM(data->ListAllTimeSamples() ==
+             std::set<double>({1.0, 2.0, 3.0}));
+
+    VtValue value;
+    TF_AXIOM(data->QueryTimeSample(attrPath, 2.0, &value));
+    TF_AXIOM(value.Get<double>() == 20.0);
+    TF_AXIOM(!data->QueryTimeSample(attrPath, 2.5, &value));
+
+    // Overwriting an existing time must not add a sample.
+    data->SetTimeSample(attrPath, 2.0, VtValue(25.0));
+    TF_AXIOM(data->GetNumTimeSamplesForPath(attrPath) == 3);
+    TF_AXIOM(data->QueryTimeSample(attrPath, 2.0, &value));
+    TF_AXIOM(value.Get<double>() == 25.0);
+
+    // Bracketing queries: before, between, on, and after samples.
+    double tLower = 0, tUpper = 0;
+    TF_AXIOM(data->GetBracketingTimeSamplesForPath(
+                 attrPath, 0.0, &tLower, &tUpper));
+    TF_AXIOM(tLower == 1.0 && tUpper == 1.0);
+    TF_AXIOM(data->GetBracketingTimeSamplesForPath(
+                 attrPath, 1.5, &tLower, &tUpper));
+    TF_AXIOM(tLower == 1.0 && tUpper == 2.0);
+    TF_AXIOM(data->GetBracketingTimeSamplesForPath(
+                 attrPath, 2.0, &tLower, &tUpper));
+    TF_AXIOM(tLower == 2.0 && tUpper == 2.0);
+    TF_AXIOM(data->GetBracketingTimeSamplesForPath(
+                 attrPath, 4.0, &tLower, &tUpper));
+    TF_AXIOM(tLower == 3.0 && tUpper == 3.0);
+
+    // Erasing samples one by one removes the field with the last one.
+    data->EraseTimeSample(attrPath, 1.0);
+    data->EraseTimeSample(attrPath, 2.0);
+    TF_AXIOM(data->GetNumTimeSamplesForPath(attrPath) == 1);
+    data->EraseTimeSample(attrPath, 3.0);
+    TF_AXIOM(!data->Has(attrPath, SdfDataTokens->TimeSamples));
+}
+
+static void
+_TestFieldBoundary()
+{
+    const SdfPath attrPath("/Prim.attr");
+    SdfDataRefPtr data = _MakeColumnarData(attrPath);
+
+    // The field-level API presents the TimeSamples field as an
+    // SdfTimeSampleMap regardless of the internal representation.
+    data->SetTimeSample(attrPath, 1.0, VtValue(10.0));
+    data->SetTimeSample(attrPath, 2.0, VtValue(20.0));
+
+    VtValue fieldValue = data->Get(attrPath, SdfDataTokens->TimeSamples);
+    TF_AXIOM(fieldValue.IsHolding<SdfTimeSampleMap>());
+    SdfTimeSampleMap tsmap = fieldValue.UncheckedGet<SdfTimeSampleMap>();
+    TF_AXIOM(tsmap.size() == 2);
+    TF_AXIOM(tsmap[1.0].Get<double>() == 10.0);
+    TF_AXIOM(tsmap[2.0].Get<double>() == 20.0);
+
+    VtValue hasValue;
+    SdfSpecType specType = SdfSpecTypeUnknown;
+    TF_AXIOM(data->Has(attrPath, SdfDataTokens->TimeSamples, &hasValue));
+    TF_AXIOM(hasValue.IsHolding<SdfTimeSampleMap>());
+    TF_AXIOM(data->HasSpecAndField(attrPath, SdfDataTokens->TimeSamples,
+                                   &hasValue, &specType));
+    TF_AXIOM(specType == SdfSpecTypeAttribute);
+    TF_AXIOM(hasValue.IsHolding<SdfTimeSampleMap>());
+
+    // Setting a map through the field API converts it back to columnar
+    // storage, so sample queries keep working.
+    tsmap[3.0] = VtValue(30.0);
+    data->Set(attrPath, SdfDataTokens->TimeSamples, VtValue(tsmap));
+    TF_AXIOM(data->GetNumTimeSamplesForPath(attrPath) == 3);
+    VtValue value;
+    TF_AXIOM(data->QueryTimeSample(attrPath, 3.0, &value));
+    TF_AXIOM(value.Get<double>() == 30.0);
+
+    // Copying into a map-based SdfData via the abstract API round-trips.
+    SdfDataRefPtr mapData = TfCreateRefPtr(new SdfData);
+    mapData->CopyFrom(SdfAbstractDataConstPtr(data));
+    TF_AXIOM(mapData->Equals(SdfAbstractDataRefPtr(data)));
+    TF_AXIOM(mapData->QueryTimeSample(attrPath, 3.0, &value));
+    TF_AXIOM(value.Get<double>() == 30.0);
+}
+
+int
+main(int argc, char **argv)
+{
+    _TestTimeSampleAccess();
+    _TestFieldBoundary();
+
+    printf("Passed!\n");
+    return 0;
+}
@@ -142,6 +142,39 @@ class TestSdfListOp(unittest.TestCase):
             .ApplyOperations([0,2,4,1,5,3]),
             [0,1,5,2,4,3])
 
+    def test_CombinedSemantics(self):
+        # Combined delete/prepend/append ops, including overlapping
+        # items, which exercise the single-pass application path.
+        self.assertEqual(
+            Sdf.IntListOp.Create(
+                prependedItems=[1,2], appendedItems=[5,6], deletedItems=[3])
+            .ApplyOperations([2,3,4,5]),
+            [1,2,4,5,6])
+        # An item that is both prepended and appended lands at the end.
+        self.assertEqual(
+            Sdf.IntListOp.Create(prependedItems=[1,2], appendedItems=[1])
+            .ApplyOperations([0]),
+            [2,0,1])
+        # Deleting an item doesn't prevent it from being re-added by a
+        # prepend or append in the same op.
+        self.assertEqual(
+            Sdf.IntListOp.Create(
+                prependedItems=[1], appendedItems=[2], deletedItems=[1,2,3])
+            .ApplyOperations([1,2,3,4]),
+            [1,4,2])
+        # Duplicated prepended/appended items are deduplicated, keeping
+        # the first prepend and the last append.
+        self.assertEqual(
+            Sdf.IntListOp.Create(
+                prependedItems=[1,2,1], appendedItems=[3,4,3])
+            .ApplyOperations([0]),
+            [1,2,0,4,3])
+        # Duplicate items in the input list are preserved.
+        self.assertEqual(
+            Sdf.IntListOp.Create(prependedItems=[1], appendedItems=[2])
+            .ApplyOperations([0,3,0]),
+            [1,0,3,0,2])
+
     def test_Compose(self):
         # Confirm that listops using add or reorder are not composable.
         self.assertEqual(
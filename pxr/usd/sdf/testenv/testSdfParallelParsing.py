@@ -0,0 +1,107 @@
+#!/pxrpythonsubst
+#
+# Copyright 2026 Pixar
+#
+# Licensed under the terms set forth in the LICENSE.txt file available at
+# https://openusd.org/license.
+
+from pxr import Sdf, Tf
+import re, unittest
+
+# This test is registered twice: once with default settings, where the
+# generated files are far below SDF_TEXTFILE_PARALLEL_PARSING_MIN_MB and
+# parse serially, and once with the setting forced to 0, where reading
+# from disk goes through the chunked parallel path.  The assertions are
+# identical, so any divergence between the two paths fails the forced run.
+
+def _MakeLayerText(numPrims):
+    lines = ['#sdf 1.4.32',
+             '(',
+             '    documentation = "parallel parsing test layer"',
+             ')',
+             '']
+    for i in range(numPrims):
+        lines += ['def Scope "Prim%d"' % i,
+                  '{',
+                  '    custom double size = %d.5' % i,
+                  '    custom string note = "prim %d"' % i,
+                  '',
+                  '    def Scope "Child"',
+                  '    {',
+                  '        custom int index = %d' % i,
+                  '    }',
+                  '}',
+                  '']
+    return '\n'.join(lines)
+
+class TestSdfParallelParsing(unittest.TestCase):
+
+    def test_ContentsMatchSerialParse(self):
+        '''Reading a multi-prim file from disk must produce the same
+           layer content as the always-serial string parser.'''
+        numPrims = 8
+        text = _MakeLayerText(numPrims)
+        with open('good.sdf', 'w') as f:
+            f.write(text)
+
+        layer = Sdf.Layer.FindOrOpen('good.sdf')
+        self.assertTrue(layer)
+        self.assertEqual(layer.documentation, 'parallel parsing test layer')
+        self.assertEqual([p.name for p in layer.rootPrims],
+                         ['Prim%d' % i for i in range(numPrims)])
+        for i, prim in enumerate(layer.rootPrims):
+            self.assertEqual(prim.attributes['size'].default, i + 0.5)
+            self.assertEqual(prim.attributes['note'].default, 'prim %d' % i)
+            self.assertEqual(
+                prim.nameChildren['Child'].attributes['index'].default, i)
+
+        serialLayer = Sdf.Layer.CreateAnonymous('.sdf')
+        self.assertTrue(serialLayer.ImportFromString(text))
+        self.assertEqual(layer.ExportToString(),
+                         serialLayer.ExportToString())
+
+    def test_CrossChunkDuplicatePrim(self):
+        '''A prim defined twice at top level must fail to parse even
+           when the two definitions land in different chunks, matching
+           the serial parser's "Duplicate prim" error.'''
+        text = _MakeLayerText(8).replace('def Scope "Prim6"',
+                                         'def Scope "Prim1"')
+        with open('duplicate.sdf', 'w') as f:
+            f.write(text)
+
+        with self.assertRaises(Tf.ErrorException) as cm:
+            Sdf.Layer.FindOrOpen('duplicate.sdf')
+        self.assertFalse(Sdf.Layer.Find('duplicate.sdf'))
+        self.assertTrue(any("Duplicate prim '/Prim1'" in err.commentary
+                            for err in cm.exception.args))
+
+    def test_MalformedChunkDiagnostics(self):
+        '''A syntax error in a later chunk must be reported against its
+           line number in the original file, not its line within the
+           chunk.'''
+        lines = _MakeLayerText(8).split('\n')
+        # Corrupt a line in the body of the second-to-last prim, well
+        # past the first chunk boundary.
+        errorIndex = len(lines) - 20
+        self.assertTrue(lines[errorIndex].lstrip().startswith('custom'))
+        lines[errorIndex] = '    custom double size = bogus'
+        with open('bad.sdf', 'w') as f:
+            f.write('\n'.join(lines))
+
+        with self.assertRaises(Tf.ErrorException) as cm:
+            Sdf.Layer.FindOrOpen('bad.sdf')
+        self.assertFalse(Sdf.Layer.Find('bad.sdf'))
+
+        # Every reported parse error must cite the erroneous line.
+        # When chunked parsing is active the failing chunk posts its own
+        # diagnostic before the serial fallback reparses the file, so an
+        # unadjusted chunk-local line number would show up here.
+        reportedLines = set()
+        for err in cm.exception.args:
+            reportedLines.update(
+                int(m) for m in re.findall(r'on line (\d+)',
+                                           err.commentary))
+        self.assertEqual(reportedLines, {errorIndex + 1})
+
+if __name__ == "__main__":
+    unittest.main()
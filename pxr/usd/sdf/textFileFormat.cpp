@@ -12,6 +12,8 @@
 #include "pxr/usd/sdf/fileIO.h"
 #include "pxr/usd/sdf/fileIO_Common.h"
 #include "pxr/usd/sdf/layer.h"
+#include "pxr/usd/sdf/data.h"
+#include "pxr/usd/sdf/schema.h"
 #include "pxr/usd/ar/asset.h"
 #include "pxr/usd/ar/resolvedPath.h"
 #include "pxr/usd/ar/resolver.h"
@@ -23,7 +25,10 @@
 #include "pxr/base/tf/registryManager.h"
 #include "pxr/base/tf/staticData.h"
 #include "pxr/base/arch/fileSystem.h"
+#include "pxr/base/work/loops.h"
+#include "pxr/base/work/threadLimits.h"
 
+#include <cstring>
 #include <ostream>
 
 using std::string;
@@ -37,6 +42,20 @@ TF_DEFINE_ENV_SETTING(
     "Warn when reading a text file larger than this number of MB "
     "(no warnings if set to 0)");
 
+TF_DEFINE_ENV_SETTING(
+    SDF_TEXTFILE_PARALLEL_PARSING, true,
+    "Parse large text layers by splitting them at top-level prim "
+    "boundaries and running the parser over the resulting chunks "
+    "concurrently, merging the results afterwards.  Set to false to always "
+    "parse serially.");
+
+TF_DEFINE_ENV_SETTING(
+    SDF_TEXTFILE_PARALLEL_PARSING_MIN_MB, 8,
+    "Minimum text layer size, in MB, for parallel parsing to be "
+    "considered.  Smaller layers are always parsed serially.  Set to 0 "
+    "to consider layers of any size; this is chiefly useful for "
+    "exercising the chunked path on small test files.");
+
 PXR_NAMESPACE_CLOSE_SCOPE
 
 // Our interface to the YACC layer parser for parsing to SdfData.
@@ -56,6 +75,15 @@ extern bool Sdf_ParseLayerFromString(
     PXR_NS::SdfDataRefPtr data,
     PXR_NS::SdfLayerHints *hints);
 
+extern bool Sdf_ParseLayerChunk(
+    const string& fileContext,
+    const char *chunk, size_t chunkSize,
+    const string& token,
+    const string& version,
+    unsigned int lineNumberOffset,
+    PXR_NS::SdfDataRefPtr data,
+    PXR_NS::SdfLayerHints *hints);
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 TF_REGISTRY_FUNCTION(TfType)
@@ -135,6 +163,374 @@ SdfTextFileFormat::_CanReadFromAsset(
     return _CanReadImpl(asset, GetFileCookie());
 }
 
+namespace {
+
+// Minimum layer size, in bytes, for the chunked parallel parsing path.
+// Values of SDF_TEXTFILE_PARALLEL_PARSING_MIN_MB at or below zero remove
+// the minimum entirely.
+size_t
+_GetParallelParsingMinBytes()
+{
+    return size_t(std::max(
+        0, TfGetEnvSetting(SDF_TEXTFILE_PARALLEL_PARSING_MIN_MB))) * 1048576;
+}
+
+// A place in a text layer where a new top-level prim statement begins.
+struct _ChunkBoundary
+{
+    size_t offset;
+    // 1-based line number of the line beginning at offset.
+    unsigned int lineNumber;
+};
+
+// Return true if the text beginning at \p p starts a top-level prim
+// statement keyword ('def', 'over' or 'class') followed by a delimiter.
+static bool
+_StartsPrimStatement(const char *p, const char *end)
+{
+    static const char *kw[] = { "def", "over", "class" };
+    for (const char *k : kw) {
+        const size_t n = strlen(k);
+        if (size_t(end - p) > n && strncmp(p, k, n) == 0) {
+            const char c = p[n];
+            if (c == ' ' || c == '\t' || c == '"' || c == '\r' || c == '\n') {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// Scan .usda text for the offsets at which top-level prim statements
+// begin.  This runs a small lexical state machine that tracks strings
+// (single, triple-quoted and escapes), comments, and bracket nesting so
+// that boundaries are only recognized at true top-level scope.  Returns
+// false if the text ends inside a string or comment, indicating the scan
+// (and likely the file) is not well formed.
+static bool
+_FindTopLevelPrimBoundaries(
+    const char *buf, size_t size, std::vector<_ChunkBoundary> *boundaries)
+{
+    TRACE_FUNCTION();
+
+    const char *p = buf;
+    const char *end = buf + size;
+    unsigned int line = 1;
+    int depth = 0;           // combined (), {}, [] nesting.
+    bool atLineStart = true; // only blanks seen since last newline.
+
+    while (p != end) {
+        const char c = *p;
+        switch (c) {
+        case '\n':
+            ++line;
+            atLineStart = true;
+            ++p;
+            continue;
+        case '\r':
+            if (p + 1 == end || p[1] != '\n') {
+                ++line;
+            }
+            atLineStart = true;
+            ++p;
+            continue;
+        case ' ': case '\t':
+            ++p;
+            continue;
+        case '#':
+            // Comment to end of line.
+            p = static_cast<const char *>(memchr(p, '\n', end - p));
+            if (!p) {
+                p = end;
+            }
+            continue;
+        case '/':
+            if (p + 1 != end && p[1] == '/') {
+                p = static_cast<const char *>(memchr(p, '\n', end - p));
+                if (!p) {
+                    p = end;
+                }
+                continue;
+            }
+            if (p + 1 != end && p[1] == '*') {
+                // Block comment; scan for terminator, counting lines.
+                p += 2;
+                for (;;) {
+                    const char *star = static_cast<const char *>(
+                        memchr(p, '*', end - p));
+                    if (!star) {
+                        line += std::count(p, end, '\n');
+                        return false;
+                    }
+                    line += std::count(p, star, '\n');
+                    p = star + 1;
+                    if (p != end && *p == '/') {
+                        ++p;
+                        break;
+                    }
+                }
+                atLineStart = false;
+                continue;
+            }
+            atLineStart = false;
+            ++p;
+            continue;
+        case '"': case '\'': {
+            // Single or triple-delimited string; scan for the closing
+            // delimiter, honoring escapes and counting embedded newlines.
+            const char quote = c;
+            const bool triple =
+                (end - p) >= 3 && p[1] == quote && p[2] == quote;
+            p += triple ? 3 : 1;
+            for (;;) {
+                if (p == end) {
+                    return false;
+                }
+                const char d = *p;
+                if (d == '\\') {
+                    p += (p + 1 == end) ? 1 : 2;
+                    continue;
+                }
+                if (d == '\n') {
+                    if (!triple) {
+                        // Unterminated single-quoted string; the parser
+                        // will report the error.
+                        break;
+                    }
+                    ++line;
+                    ++p;
+                    continue;
+                }
+                if (d == quote) {
+                    if (!triple) {
+                        ++p;
+                        break;
+                    }
+                    if ((end - p) >= 3 &&
+                        p[1] == quote && p[2] == quote) {
+                        p += 3;
+                        break;
+                    }
+                }
+                ++p;
+            }
+            atLineStart = false;
+            continue;
+        }
+        case '(': case '{': case '[':
+            ++depth;
+            atLineStart = false;
+            ++p;
+            continue;
+        case ')': case '}': case ']':
+            --depth;
+            atLineStart = false;
+            ++p;
+            continue;
+        default:
+            if (atLineStart && depth == 0 && _StartsPrimStatement(p, end)) {
+                // Record the start of the line; leading blanks belong to
+                // the chunk but do not affect parsing.
+                boundaries->push_back({ size_t(p - buf), line });
+            }
+            atLineStart = false;
+            ++p;
+            continue;
+        }
+    }
+    return depth == 0;
+}
+
+// Merges the contents of a chunk's SdfData into the destination data.
+// Pseudo-root fields require special handling: the chunk's top-level prim
+// order is appended to the destination's, and other layer-level fields
+// are only copied if the destination does not already have them.  A spec
+// that already exists in the destination means the file defines the same
+// object in more than one chunk; the merge stops and reports it so the
+// caller can fall back to the serial parser, which rejects such files
+// with a proper diagnostic, rather than silently overwriting.
+class _MergeChunkDataVisitor : public SdfAbstractDataSpecVisitor
+{
+public:
+    explicit _MergeChunkDataVisitor(SdfAbstractData *dst) : _dst(dst) { }
+
+    bool FoundExistingSpec() const { return _foundExistingSpec; }
+
+    bool VisitSpec(
+        const SdfAbstractData &src, const SdfPath &path) override
+    {
+        if (path == SdfPath::AbsoluteRootPath()) {
+            for (const TfToken &field : src.List(path)) {
+                if (field == SdfChildrenKeys->PrimChildren) {
+                    TfTokenVector children;
+                    VtValue dstChildren = _dst->Get(path, field);
+                    if (dstChildren.IsHolding<TfTokenVector>()) {
+                        children =
+                            dstChildren.UncheckedRemove<TfTokenVector>();
+                    }
+                    const VtValue srcChildren = src.Get(path, field);
+                    if (srcChildren.IsHolding<TfTokenVector>()) {
+                        for (const TfToken &child :
+                                 srcChildren.UncheckedGet<TfTokenVector>()) {
+                            children.push_back(child);
+                        }
+                    }
+                    _dst->Set(path, field, VtValue::Take(children));
+                }
+                else if (!_dst->Has(path, field)) {
+                    _dst->Set(path, field, src.Get(path, field));
+                }
+            }
+            return true;
+        }
+
+        if (_dst->HasSpec(path)) {
+            _foundExistingSpec = true;
+            return false;
+        }
+        _dst->CreateSpec(path, src.GetSpecType(path));
+        for (const TfToken &field : src.List(path)) {
+            _dst->Set(path, field, src.Get(path, field));
+        }
+        return true;
+    }
+
+    void Done(const SdfAbstractData &) override { }
+
+private:
+    SdfAbstractData *_dst;
+    bool _foundExistingSpec = false;
+};
+
+// Parse \p asset by splitting it at top-level prim boundaries and running
+// the parser over the chunks concurrently, merging the per-chunk data into
+// \p data afterwards.  Returns false -- possibly leaving partial results
+// in \p data -- if the layer cannot be chunked or any chunk fails to
+// parse; callers fall back to the serial parser with fresh data.
+static bool
+_ParseLayerChunksInParallel(
+    const SdfTextFileFormat *format,
+    const SdfLayer *layer,
+    const string &resolvedPath,
+    const std::shared_ptr<ArAsset> &asset,
+    SdfDataRefPtr data,
+    SdfLayerHints *hints)
+{
+    TRACE_FUNCTION();
+
+    std::shared_ptr<const char> buffer = asset->GetBuffer();
+    const size_t size = asset->GetSize();
+    if (!buffer || size == 0) {
+        return false;
+    }
+    const char *buf = buffer.get();
+
+    std::vector<_ChunkBoundary> boundaries;
+    if (!_FindTopLevelPrimBoundaries(buf, size, &boundaries) ||
+        boundaries.empty()) {
+        return false;
+    }
+
+    // Coalesce boundaries into chunks large enough to amortize per-chunk
+    // parser setup and the serial merge that follows.  The floor shrinks
+    // along with the configured minimum layer size so that lowering
+    // SDF_TEXTFILE_PARALLEL_PARSING_MIN_MB forces chunking on small files.
+    struct _Chunk { size_t begin, end; unsigned int lineNumber; };
+    const size_t minChunkBytes = std::max<size_t>(
+        size / (4 * WorkGetConcurrencyLimit()),
+        std::min<size_t>(
+            std::max<size_t>(_GetParallelParsingMinBytes(), 1), 1048576));
+    std::vector<_Chunk> chunks;
+    size_t cur = 0;
+    unsigned int curLine = 1;
+    for (const _ChunkBoundary &b : boundaries) {
+        if (b.offset != 0 && b.offset - cur >= minChunkBytes) {
+            chunks.push_back({ cur, b.offset, curLine });
+            cur = b.offset;
+            curLine = b.lineNumber;
+        }
+    }
+    chunks.push_back({ cur, size, curLine });
+    if (chunks.size() < 2) {
+        return false;
+    }
+
+    // Chunks after the first are prefixed with the layer's header line so
+    // that each parses as a self-contained layer.
+    const char *firstNewline =
+        static_cast<const char *>(memchr(buf, '\n', size));
+    if (!firstNewline) {
+        return false;
+    }
+    const string headerLine(buf, firstNewline - buf + 1);
+
+    const string magicId = format->GetFormatId();
+    const string version = format->GetVersionString();
+
+    // The first chunk, which carries the layer metadata, parses directly
+    // into the destination data; later chunks get their own data to merge.
+    std::vector<SdfDataRefPtr> chunkData(chunks.size());
+    std::vector<SdfLayerHints> chunkHints(chunks.size());
+    chunkData[0] = data;
+    for (size_t i = 1; i != chunks.size(); ++i) {
+        chunkData[i] = TfDynamic_cast<SdfDataRefPtr>(
+            format->InitData(layer->GetFileFormatArguments()));
+        if (!chunkData[i]) {
+            // The format produced a non-SdfData implementation that we
+            // don't know how to merge.
+            return false;
+        }
+    }
+
+    std::atomic<bool> ok(true);
+    WorkParallelForN(
+        chunks.size(),
+        [&](size_t begin, size_t end) {
+            for (size_t i = begin; i != end; ++i) {
+                const _Chunk &c = chunks[i];
+                bool result;
+                if (i == 0) {
+                    result = Sdf_ParseLayerChunk(
+                        resolvedPath, buf + c.begin, c.end - c.begin,
+                        magicId, version, /*lineNumberOffset=*/0,
+                        chunkData[i], &chunkHints[i]);
+                }
+                else {
+                    string text = headerLine;
+                    text.append(buf + c.begin, c.end - c.begin);
+                    // Line 2 of the chunk text (the line after the
+                    // prepended header) is line c.lineNumber of the file.
+                    result = Sdf_ParseLayerChunk(
+                        resolvedPath, text.data(), text.size(),
+                        magicId, version,
+                        c.lineNumber >= 2 ? c.lineNumber - 2 : 0,
+                        chunkData[i], &chunkHints[i]);
+                }
+                if (!result) {
+                    ok = false;
+                }
+            }
+        });
+
+    if (!ok) {
+        return false;
+    }
+
+    TRACE_SCOPE("SdfTextFileFormat::_ReadFromAsset (merge chunks)");
+    *hints = chunkHints[0];
+    for (size_t i = 1; i != chunks.size(); ++i) {
+        _MergeChunkDataVisitor merger(get_pointer(data));
+        chunkData[i]->VisitSpecs(&merger);
+        if (merger.FoundExistingSpec()) {
+            return false;
+        }
+        hints->mightHaveRelocates |= chunkHints[i].mightHaveRelocates;
+    }
+    return true;
+}
+
+} // anonymous namespace
+
 bool
 SdfTextFileFormat::Read(
     SdfLayer* layer,
@@ -179,8 +575,28 @@ SdfTextFileFormat::_ReadFromAsset(
 
     SdfLayerHints hints;
     SdfAbstractDataRefPtr data = InitData(layer->GetFileFormatArguments());
-    if (!Sdf_ParseLayer(
-            resolvedPath, asset, GetFormatId(), GetVersionString(), 
+
+    // For large layers, try splitting at top-level prim boundaries and
+    // parsing the chunks concurrently.  On any failure we fall back to the
+    // serial parser with fresh data, which will produce the authoritative
+    // diagnostics if the file is malformed.
+    bool parsed = false;
+    if (!metadataOnly &&
+        TfGetEnvSetting(SDF_TEXTFILE_PARALLEL_PARSING) &&
+        WorkHasConcurrency() &&
+        asset->GetSize() >= _GetParallelParsingMinBytes()) {
+        if (SdfDataRefPtr sdfData = TfDynamic_cast<SdfDataRefPtr>(data)) {
+            parsed = _ParseLayerChunksInParallel(
+                this, layer, resolvedPath, asset, sdfData, &hints);
+            if (!parsed) {
+                data = InitData(layer->GetFileFormatArguments());
+            }
+        }
+    }
+
+    if (!parsed &&
+        !Sdf_ParseLayer(
+            resolvedPath, asset, GetFormatId(), GetVersionString(),
             metadataOnly, TfDynamic_cast<SdfDataRefPtr>(data), &hints)) {
         return false;
     }
@@ -5578,7 +5578,7 @@ YY_RULE_SETUP
         if (outOfRange) {
            TF_WARN("Integer literal '%s' on line %d%s%s out of range, parsing "
                    "as double.  Consider exponential notation for large "
-                   "floating point values.", yytext, yyextra->sdfLineNo,
+                   "floating point values.", yytext, yyextra->sdfLineNo + yyextra->sdfLineNoOffset,
                    yyextra->fileContext.empty() ? "" : " in file ",
                    yyextra->fileContext.empty() ? "" :
                    yyextra->fileContext.c_str());
@@ -5597,7 +5597,7 @@ YY_RULE_SETUP
         if (outOfRange) {
            TF_WARN("Integer literal '%s' on line %d%s%s out of range, parsing "
                    "as double.  Consider exponential notation for large "
-                   "floating point values.", yytext, yyextra->sdfLineNo,
+                   "floating point values.", yytext, yyextra->sdfLineNo + yyextra->sdfLineNoOffset,
                    yyextra->fileContext.empty() ? "" : " in file ",
                    yyextra->fileContext.empty() ? "" :
                    yyextra->fileContext.c_str());
@@ -270,7 +270,7 @@ UTF8UDB     {UTF8UD}|{BAR}
         if (outOfRange) {
            TF_WARN("Integer literal '%s' on line %d%s%s out of range, parsing "
                    "as double.  Consider exponential notation for large "
-                   "floating point values.", yytext, yyextra->sdfLineNo,
+                   "floating point values.", yytext, yyextra->sdfLineNo + yyextra->sdfLineNoOffset,
                    yyextra->fileContext.empty() ? "" : " in file ",
                    yyextra->fileContext.empty() ? "" :
                    yyextra->fileContext.c_str());
@@ -286,7 +286,7 @@ UTF8UDB     {UTF8UD}|{BAR}
         if (outOfRange) {
            TF_WARN("Integer literal '%s' on line %d%s%s out of range, parsing "
                    "as double.  Consider exponential notation for large "
-                   "floating point values.", yytext, yyextra->sdfLineNo,
+                   "floating point values.", yytext, yyextra->sdfLineNo + yyextra->sdfLineNoOffset,
                    yyextra->fileContext.empty() ? "" : " in file ",
                    yyextra->fileContext.empty() ? "" :
                    yyextra->fileContext.c_str());
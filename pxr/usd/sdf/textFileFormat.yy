@@ -664,7 +664,7 @@ _AttributeAppendConnectionPath(Sdf_TextParserContext *context)
                 "using <%s> instead.  Resaving the file will fix this issue.",
                 absPath.GetText(),
                 context->fileContext.c_str(),
-                context->sdfLineNo,
+                context->sdfLineNo + context->sdfLineNoOffset,
                 absPath.StripAllVariantSelections().GetText());
         absPath = absPath.StripAllVariantSelections();
     }
@@ -3149,7 +3149,7 @@ void textFileFormatYyerror(Sdf_TextParserContext *context, const char *msg)
     const bool isNewlineToken = 
         (nextToken.length() == 1 && nextToken[0] == '\n');
 
-    int errLineNumber = context->sdfLineNo;
+    int errLineNumber = context->sdfLineNo + context->sdfLineNoOffset;
 
     // By this time, sdfLineNo has already been updated to account for
     // nextToken. So, if nextToken is a newline, the error really occurred on
@@ -3369,3 +3369,58 @@ Sdf_ParseLayerFromString(
 
     return status == 0;
 }
+
+/// Parse a chunk of layer text into an SdfData.  This is used by the
+/// parallel text-parsing path in SdfTextFileFormat, which splits a layer
+/// into independent top-level prim blocks.  \p lineNumberOffset gives the
+/// number of lines preceding the chunk in the original file, so that
+/// diagnostics are reported against the right location in \p fileContext.
+bool
+Sdf_ParseLayerChunk(
+    const std::string & fileContext,
+    const char *chunk, size_t chunkSize,
+    const std::string & magicId,
+    const std::string & versionString,
+    unsigned int lineNumberOffset,
+    SdfDataRefPtr data,
+    SdfLayerHints *hints)
+{
+    TfAutoMallocTag2 tag("Sdf", "Sdf_ParseLayerChunk");
+
+    TRACE_FUNCTION();
+
+    // Configure for input chunk.
+    Sdf_TextParserContext context;
+
+    context.data = data;
+    context.fileContext = fileContext;
+    context.magicIdentifierToken = magicId;
+    context.versionString = versionString;
+    context.sdfLineNoOffset = lineNumberOffset;
+    context.values.errorReporter =
+        std::bind(_ReportParseError, &context, std::placeholders::_1);
+
+    // Initialize the scanner, allowing it to be reentrant.
+    textFileFormatYylex_init(&context.scanner);
+    textFileFormatYyset_extra(&context, context.scanner);
+
+    // Run parser.
+    yy_buffer_state *buf = textFileFormatYy_scan_bytes(
+        chunk, chunkSize, context.scanner);
+    int status = -1;
+    try {
+        TRACE_SCOPE("textFileFormatYyParse");
+        status = textFileFormatYyparse(&context);
+        *hints = context.layerHints;
+    } catch (std::bad_variant_access const &) {
+        TF_CODING_ERROR("Bad variant access in layer parser.");
+        Err(&context, "Internal layer parser error.");
+    }
+
+    // Clean up.
+    textFileFormatYy_delete_buffer(buf, context.scanner);
+    textFileFormatYylex_destroy(context.scanner);
+
+    return status == 0;
+}
+
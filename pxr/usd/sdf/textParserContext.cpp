@@ -20,6 +20,7 @@ Sdf_TextParserContext::Sdf_TextParserContext() :
     // it to true if it encounters a relocates field.
     layerHints{/*.mightHaveRelocates =*/ false},
     sdfLineNo(1),
+    sdfLineNoOffset(0),
     scanner(NULL)
 {
 }
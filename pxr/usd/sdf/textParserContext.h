@@ -140,6 +140,12 @@ public:
 
     unsigned int sdfLineNo;
 
+    // Offset added to sdfLineNo when reporting errors and warnings.  This
+    // is nonzero when parsing a chunk of a larger file via
+    // Sdf_ParseLayerChunk, so that diagnostics refer to lines in the
+    // original file.
+    unsigned int sdfLineNoOffset;
+
     // Used by flex for reentrant parsing
     yyscan_t scanner;
 };
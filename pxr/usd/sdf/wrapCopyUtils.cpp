@@ -163,4 +163,7 @@ wrapCopyUtils()
     def("CopySpec", &Py_SdfCopySpec,
         (arg("srcLayer"), arg("srcPath"), arg("dstLayer"), arg("dstPath"),
          arg("shouldCopyValueFn"), arg("shouldCopyChildrenFn")));
+
+    def("CopySpecBulk", &SdfCopySpecBulk,
+        (arg("srcLayer"), arg("srcPath"), arg("dstLayer"), arg("dstPath")));
 }
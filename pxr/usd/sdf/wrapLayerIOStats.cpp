@@ -0,0 +1,56 @@
+//
+// Copyright 2025 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+#include "pxr/pxr.h"
+#include "pxr/usd/sdf/layerIOStats.h"
+#include "pxr/base/tf/pyResultConversions.h"
+#include <boost/python.hpp>
+
+using namespace boost::python;
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+static object
+_GetStats(const SdfLayerIOStatsRegistry& registry,
+          const std::string& identifier)
+{
+    SdfLayerIOStats stats;
+    if (!registry.GetStats(identifier, &stats)) {
+        return object();
+    }
+    return object(stats);
+}
+
+} // anonymous namespace
+
+void wrapLayerIOStats()
+{
+    class_<SdfLayerIOStats>("LayerIOStats")
+        .def_readonly("identifier", &SdfLayerIOStats::identifier)
+        .def_readonly("resolvedPath", &SdfLayerIOStats::resolvedPath)
+        .def_readonly("numReads", &SdfLayerIOStats::numReads)
+        .def_readonly("resolveSeconds", &SdfLayerIOStats::resolveSeconds)
+        .def_readonly("readSeconds", &SdfLayerIOStats::readSeconds)
+        .def_readonly("fileSizeBytes", &SdfLayerIOStats::fileSizeBytes)
+        ;
+
+    class_<SdfLayerIOStatsRegistry, noncopyable>(
+        "LayerIOStatsRegistry", no_init)
+        .def("GetInstance", &SdfLayerIOStatsRegistry::GetInstance,
+             return_value_policy<reference_existing_object>())
+        .staticmethod("GetInstance")
+        .def("IsEnabled", &SdfLayerIOStatsRegistry::IsEnabled)
+        .staticmethod("IsEnabled")
+        .def("GetStats", &_GetStats)
+        .def("GetAllStats", &SdfLayerIOStatsRegistry::GetAllStats,
+             return_value_policy<TfPySequenceToList>())
+        .def("ExportAsJsonString",
+             &SdfLayerIOStatsRegistry::ExportAsJsonString)
+        .def("Clear", &SdfLayerIOStatsRegistry::Clear)
+        ;
+}
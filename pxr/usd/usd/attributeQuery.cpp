@@ -155,12 +155,93 @@ UsdAttributeQuery::_Get(T* value, UsdTimeCode time) const
         _resolveInfo, time, _attr, value);
 }
 
-bool 
+bool
 UsdAttributeQuery::Get(VtValue* value, UsdTimeCode time) const
 {
     return _Get(value, time);
 }
 
+template <typename T>
+USD_API
+bool
+UsdAttributeQuery::_GetValues(
+    std::vector<T>* values, const std::vector<UsdTimeCode>& times) const
+{
+    values->clear();
+    values->resize(times.size());
+    if (times.empty()) {
+        return true;
+    }
+
+    // If the value source does not vary over time, resolve once and
+    // replicate. Note that numeric times and default time resolve to the
+    // same value in this case, so any requested time may be used.
+    if (_resolveInfo.GetSource() != UsdResolveInfoSourceTimeSamples &&
+        _resolveInfo.GetSource() != UsdResolveInfoSourceValueClips) {
+        T value;
+        if (!_Get(&value, times.front())) {
+            return false;
+        }
+        std::fill(values->begin(), values->end(), value);
+        return true;
+    }
+
+    bool success = true;
+
+    // Under held interpolation every requested time maps to the value of
+    // its lower bracketing sample, so times that share a bracketing sample
+    // only need to fetch that sample once.
+    if (_attr._GetStage()->GetInterpolationType() ==
+            UsdInterpolationTypeHeld) {
+        bool haveCachedSample = false;
+        double cachedSampleTime = 0.0;
+        T cachedValue;
+        bool cachedResult = false;
+
+        for (size_t i = 0; i != times.size(); ++i) {
+            const UsdTimeCode time = times[i];
+
+            double lower = 0.0, upper = 0.0;
+            bool hasTimeSamples = false;
+            if (time.IsDefault() ||
+                !GetBracketingTimeSamples(
+                    time.GetValue(), &lower, &upper, &hasTimeSamples) ||
+                !hasTimeSamples) {
+                T value;
+                success = _Get(&value, time) && success;
+                (*values)[i] = value;
+                continue;
+            }
+
+            if (!haveCachedSample || cachedSampleTime != lower) {
+                cachedResult = _Get(&cachedValue, UsdTimeCode(lower));
+                cachedSampleTime = lower;
+                haveCachedSample = true;
+            }
+            (*values)[i] = cachedValue;
+            success = cachedResult && success;
+        }
+        return success;
+    }
+
+    // Linearly interpolated values depend on both bracketing samples, so
+    // resolve each time individually, still sharing this query's cached
+    // resolve info.
+    for (size_t i = 0; i != times.size(); ++i) {
+        T value;
+        success = _Get(&value, times[i]) && success;
+        (*values)[i] = value;
+    }
+    return success;
+}
+
+bool
+UsdAttributeQuery::GetValues(
+    std::vector<VtValue>* values, const std::vector<UsdTimeCode>& times) const
+{
+    return _GetValues(values, times);
+}
+
 bool 
 UsdAttributeQuery::GetTimeSamples(std::vector<double>* times) const
 {
@@ -284,7 +365,13 @@ ARCH_PRAGMA_INSTANTIATION_AFTER_SPECIALIZATION
     template USD_API bool UsdAttributeQuery::_Get(                      \
         SDF_VALUE_CPP_TYPE(elem)*, UsdTimeCode) const;                  \
     template USD_API bool UsdAttributeQuery::_Get(                      \
-        SDF_VALUE_CPP_ARRAY_TYPE(elem)*, UsdTimeCode) const;
+        SDF_VALUE_CPP_ARRAY_TYPE(elem)*, UsdTimeCode) const;            \
+    template USD_API bool UsdAttributeQuery::_GetValues(                \
+        std::vector<SDF_VALUE_CPP_TYPE(elem)>*,                         \
+        const std::vector<UsdTimeCode>&) const;                         \
+    template USD_API bool UsdAttributeQuery::_GetValues(                \
+        std::vector<SDF_VALUE_CPP_ARRAY_TYPE(elem)>*,                   \
+        const std::vector<UsdTimeCode>&) const;
 
 TF_PP_SEQ_FOR_EACH(_INSTANTIATE_GET, ~, SDF_VALUE_TYPES)
 #undef _INSTANTIATE_GET
@@ -148,7 +148,36 @@ public:
     /// Type-erased access, often not as efficient as typed access.
     USD_API
     bool Get(VtValue* value, UsdTimeCode time = UsdTimeCode::Default()) const;
-    
+
+    /// Perform value resolution to fetch the values of the attribute
+    /// associated with this query at each of the requested \p times, writing
+    /// the resolved values in order to \p values.
+    ///
+    /// This is equivalent to calling Get() once per time, but shares the
+    /// resolved value source across the whole batch: when the value does not
+    /// come from time samples or value clips it is resolved once and
+    /// replicated, and when values are held, requested times that resolve to
+    /// the same sample fetch that sample only once. Consumers that sample an
+    /// attribute at several nearby times, e.g. for motion blur, should
+    /// prefer this over repeated Get() calls.
+    ///
+    /// On return \p values has the same size as \p times; entries for which
+    /// no value could be resolved are left default-constructed. Returns true
+    /// if a value was successfully resolved at every requested time, false
+    /// otherwise.
+    template <typename T>
+    bool GetValues(std::vector<T>* values,
+                   const std::vector<UsdTimeCode>& times) const {
+        static_assert(SdfValueTypeTraits<T>::IsValueType,
+                      "T must be an SdfValueType.");
+        return _GetValues(values, times);
+    }
+    /// \overload
+    /// Type-erased access, often not as efficient as typed access.
+    USD_API
+    bool GetValues(std::vector<VtValue>* values,
+                   const std::vector<UsdTimeCode>& times) const;
+
     /// Populates a vector with authored sample times. 
     /// Returns false only on error. 
     //
@@ -268,6 +297,11 @@ private:
     USD_API
     bool _Get(T* value, UsdTimeCode time) const;
 
+    template <typename T>
+    USD_API
+    bool _GetValues(std::vector<T>* values,
+                    const std::vector<UsdTimeCode>& times) const;
+
 private:
     UsdAttribute _attr;
     UsdResolveInfo _resolveInfo;
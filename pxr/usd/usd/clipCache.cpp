@@ -21,15 +21,22 @@
 #include "pxr/base/gf/vec2d.h"
 #include "pxr/base/trace/trace.h"
 #include "pxr/base/tf/diagnostic.h"
+#include "pxr/base/tf/envSetting.h"
 #include "pxr/base/tf/hash.h"
 #include "pxr/base/tf/mallocTag.h"
 #include "pxr/base/tf/ostreamMethods.h"
+#include "pxr/base/work/loops.h"
 
 #include <string>
 #include <unordered_map>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+TF_DEFINE_ENV_SETTING(
+    PXR_USD_PREOPEN_CLIP_LAYERS, false,
+    "If enabled, all value clip layers are opened in parallel after stage "
+    "population instead of being opened lazily during value resolution.");
+
 Usd_ClipCache::
 ConcurrentPopulationContext::ConcurrentPopulationContext(Usd_ClipCache &cache)
     : _cache(cache)
@@ -320,6 +327,51 @@ Usd_ClipCache::Reload()
     }
 }
 
+bool
+Usd_ClipCache::IsPreOpeningClipLayersEnabled()
+{
+    return TfGetEnvSetting(PXR_USD_PREOPEN_CLIP_LAYERS);
+}
+
+void
+Usd_ClipCache::OpenClipLayers()
+{
+    TRACE_FUNCTION();
+
+    // Collect the clips whose layers have not been opened yet. Clip sets
+    // appear in the table once per descendant prim entry (see
+    // PopulateClipsForPrim), so de-duplicate them first.
+    std::vector<Usd_ClipRefPtr> clipsToOpen;
+    {
+        std::unique_lock<std::mutex> lock = (_concurrentPopulationContext) ?
+            std::unique_lock<std::mutex>(_concurrentPopulationContext->_mutex) :
+            std::unique_lock<std::mutex>();
+
+        std::unordered_set<Usd_ClipSetRefPtr> clipSets;
+        for (auto it = _table.begin(), end = _table.end(); it != end; ++it) {
+            clipSets.insert(it->second.begin(), it->second.end());
+        }
+
+        for (const Usd_ClipSetRefPtr& clipSet : clipSets) {
+            for (const Usd_ClipRefPtr& clip : clipSet->valueClips) {
+                if (!clip->GetLayerIfOpen()) {
+                    clipsToOpen.push_back(clip);
+                }
+            }
+        }
+    }
+
+    // Opening a clip layer is dominated by I/O and parsing, so open the
+    // layers in parallel; Usd_Clip::GetLayer is thread-safe.
+    WorkParallelForN(
+        clipsToOpen.size(),
+        [&clipsToOpen](size_t begin, size_t end) {
+            for (size_t i = begin; i != end; ++i) {
+                clipsToOpen[i]->GetLayer();
+            }
+        });
+}
+
 const std::vector<Usd_ClipSetRefPtr>&
 Usd_ClipCache::GetClipsForPrim(const SdfPath& path) const
 {
@@ -66,6 +66,17 @@ public:
     /// Reload all clip layers that have been opened. Generated clip manifests
     /// will also be regenerated.
     void Reload();
+
+    /// Returns true if clip layers should be opened eagerly after stage
+    /// population rather than lazily on first value resolution, as
+    /// controlled by the PXR_USD_PREOPEN_CLIP_LAYERS environment setting.
+    static bool IsPreOpeningClipLayersEnabled();
+
+    /// Open the layers for all clips currently in this cache that have
+    /// not been opened yet, in parallel. This front-loads the layer opens
+    /// that would otherwise occur serially as playback first touches each
+    /// clip's active time range.
+    void OpenClipLayers();
     
     /// Get all clips that may contribute opinions to attributes on the
     /// prim at \p path, including clips that were authored on ancestral prims.
@@ -414,6 +414,12 @@ Usd_ClipSet::Usd_ClipSet(
         valueClips.push_back(clip);
     }
 
+    // Build the time-to-clip table used by _FindClipIndexForTime.
+    _clipStartTimes.reserve(valueClips.size());
+    for (const Usd_ClipRefPtr& clip : valueClips) {
+        _clipStartTimes.push_back(clip->startTime);
+    }
+
     if (clipDef.interpolateMissingClipValues) {
         interpolateMissingClipValues = *clipDef.interpolateMissingClipValues;
     }
@@ -657,27 +663,20 @@ Usd_ClipSet::_FindClipIndexForTime(double time) const
 
     // If there was only one clip, it must be active over all time so
     // we don't need to search any further.
-    if (valueClips.size() > 1) {
+    if (_clipStartTimes.size() > 1) {
         // Find the first clip whose start time is greater than the given
-        // time.
+        // time. The first entry is skipped since its start time is set to
+        // -inf, so it can never be greater than any time that is given.
         auto it = std::upper_bound(
-            valueClips.begin(), valueClips.end(), time,
-            [](double time, const Usd_ClipRefPtr& clip) {
-                return time < clip->startTime;
-            });
-
-        // The upper bound should never be the first clip. Since its
-        // startTime is set to -inf, it should never be greater than any
-        // time that is given.
-        if (TF_VERIFY(it != valueClips.begin())) {
-            // The clip before the upper bound must have time in its
-            // [startTime, endTime) range. This is true even if
-            // it points to valueClips.end(); if this were the case,
-            // then the given time is greater than the last clip's
-            // startTime, but the last clip is active until +inf so
-            // time must fall into its range.
-            clipIndex = std::distance(valueClips.begin(), it) - 1;
-        }
+            _clipStartTimes.begin() + 1, _clipStartTimes.end(), time);
+
+        // The clip before the upper bound must have time in its
+        // [startTime, endTime) range. This is true even if
+        // it points to _clipStartTimes.end(); if this were the case,
+        // then the given time is greater than the last clip's
+        // startTime, but the last clip is active until +inf so
+        // time must fall into its range.
+        clipIndex = std::distance(_clipStartTimes.begin(), it) - 1;
     }
 
     return TF_VERIFY(
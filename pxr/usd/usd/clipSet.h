@@ -105,6 +105,11 @@ private:
     // to this clip set for the attribute at \p path.
     bool _ClipContributesValue(
         const Usd_ClipRefPtr& clip, const SdfPath& path) const;
+
+    // Start time of each clip in valueClips, precomputed at construction
+    // so that the per-query search for the active clip runs over a flat
+    // sorted array instead of dereferencing each clip.
+    std::vector<double> _clipStartTimes;
 };
 
 // ------------------------------------------------------------
@@ -351,6 +351,14 @@ Usd_CollectionMembershipQueryBase::Usd_CollectionMembershipQueryBase(
             break;
         }
     }
+
+    // Compile the rule map into lexicographically sorted entries, so that
+    // ancestor paths precede descendant paths and subtrees are contiguous.
+    // This form supports bulk classification of sorted path vectors and
+    // gives us a history-independent order to hash.
+    _sortedRuleEntries.assign(_pathExpansionRuleMap.begin(),
+                              _pathExpansionRuleMap.end());
+    std::sort(_sortedRuleEntries.begin(), _sortedRuleEntries.end());
 }
 
 bool
@@ -477,6 +485,88 @@ Usd_CollectionMembershipQueryBase::_HasEmptyRuleMap() const
     return _pathExpansionRuleMap.empty();
 }
 
+std::vector<bool>
+Usd_CollectionMembershipQueryBase::_ComputeSortedPathInclusionsByRuleMap(
+    const SdfPathVector &sortedPaths) const
+{
+    TRACE_FUNCTION();
+
+    std::vector<bool> result(sortedPaths.size(), false);
+
+    if (!std::is_sorted(sortedPaths.begin(), sortedPaths.end())) {
+        TF_CODING_ERROR("Paths must be sorted in lexicographic order");
+        return result;
+    }
+
+    // Sweep the sorted rule entries alongside the sorted paths, maintaining
+    // a stack of the entries that are ancestors of (or equal to) the current
+    // path, ordered shallowest to deepest.  Because subtrees are contiguous
+    // in lexicographic order, an entry that has been passed over without
+    // prefixing the current path cannot prefix any later path, so each rule
+    // entry is visited exactly once.
+    const RuleEntryVector &entries = _sortedRuleEntries;
+    std::vector<const RuleEntryVector::value_type *> ancestorEntries;
+    size_t entryIndex = 0;
+
+    for (size_t i = 0; i < sortedPaths.size(); ++i) {
+        const SdfPath &path = sortedPaths[i];
+
+        if (!path.IsAbsolutePath()) {
+            TF_CODING_ERROR("Relative paths are not allowed");
+            continue;
+        }
+
+        // Only prims and properties can belong to a collection.
+        if (!path.IsPrimPath() && !path.IsPropertyPath()) {
+            continue;
+        }
+
+        // Pop entries that are not ancestors of this path.
+        while (!ancestorEntries.empty() &&
+               !path.HasPrefix(ancestorEntries.back()->first)) {
+            ancestorEntries.pop_back();
+        }
+
+        // Push rule entries up to this path that are its ancestors.
+        for (; entryIndex != entries.size() &&
+                 entries[entryIndex].first <= path; ++entryIndex) {
+            if (path.HasPrefix(entries[entryIndex].first)) {
+                ancestorEntries.push_back(&entries[entryIndex]);
+            }
+        }
+
+        // Evaluate the nearest applicable ancestor rule, mirroring
+        // _IsPathIncludedByRuleMap().
+        bool included = false;
+        for (auto it = ancestorEntries.rbegin();
+             it != ancestorEntries.rend(); ++it) {
+            const SdfPath &entryPath = (*it)->first;
+            const TfToken &rule = (*it)->second;
+
+            if (rule == UsdTokens->exclude) {
+                break;
+            }
+            if (path.IsPrimPath()) {
+                if (rule != UsdTokens->explicitOnly || entryPath == path) {
+                    included = true;
+                    break;
+                }
+            } else {
+                // If there is a property path directly in the map, then it is
+                // considered included even if the rule is expandPrims.
+                if (entryPath.IsPropertyPath() ||
+                    (rule == UsdTokens->expandPrimsAndProperties) ||
+                    (rule == UsdTokens->explicitOnly && entryPath == path)) {
+                    included = true;
+                    break;
+                }
+            }
+        }
+        result[i] = included;
+    }
+    return result;
+}
+
 size_t
 Usd_CollectionMembershipQueryBase::_Hash::operator()(
     Usd_CollectionMembershipQueryBase const& q) const
@@ -485,20 +575,13 @@ Usd_CollectionMembershipQueryBase::_Hash::operator()(
 
     // Hashing unordered maps is costly because two maps holding the
     // same (key,value) pairs may store them in a different layout,
-    // due to population history.  We must use a history-independent
-    // order to compute a consistent hash value.
+    // due to population history.  We hash the lexicographically sorted
+    // rule entries computed at construction, which provide the required
+    // history-independent order.
     //
-    // If the runtime cost becomes problematic, we should consider
-    // computing the hash once and storing it in the MembershipQuery,
-    // as a finalization step in _ComputeMembershipQueryImpl().
-    typedef std::pair<SdfPath, TfToken> _Entry;
-    std::vector<_Entry> entries(q._pathExpansionRuleMap.begin(),
-                                q._pathExpansionRuleMap.end());
-    std::sort(entries.begin(), entries.end());
-
     // Don't hash _hasExcludes because it is derived from
     // the contents of _pathExpansionRuleMap.
-    return TfHash::Combine(entries, q._topExpansionRule);
+    return TfHash::Combine(q._sortedRuleEntries, q._topExpansionRule);
 }
 
 
@@ -113,6 +113,19 @@ public:
         return _topExpansionRule;
     }
 
+    /// Holds the entries of the path expansion rule map in lexicographic
+    /// path order, so that ancestor paths precede descendant paths and
+    /// subtrees are contiguous.  This compiled form is built once when the
+    /// query is computed and supports bulk classification of sorted path
+    /// vectors; see Usd_CollectionMembershipQuery::ComputePathInclusions().
+    using RuleEntryVector = std::vector<std::pair<SdfPath, TfToken>>;
+
+    /// Returns the entries of the path expansion rule map in lexicographic
+    /// path order.
+    const RuleEntryVector& GetAsSortedRuleEntries() const {
+        return _sortedRuleEntries;
+    }
+
 protected:
 
     /// Hash functor
@@ -140,12 +153,25 @@ protected:
     USD_API
     bool _HasEmptyRuleMap() const;
 
+    // Classify each path in the lexicographically sorted \p sortedPaths as
+    // included or excluded by sweeping the sorted rule entries alongside the
+    // paths with a stack of ancestor rules, rather than walking the rule map
+    // once per path.
+    USD_API
+    std::vector<bool> _ComputeSortedPathInclusionsByRuleMap(
+        const SdfPathVector &sortedPaths) const;
+
     TfToken _topExpansionRule;
     
     PathExpansionRuleMap _pathExpansionRuleMap;
 
     SdfPathSet _includedCollections;
 
+    // The entries of _pathExpansionRuleMap in lexicographic path order,
+    // computed once at construction.  This is the compiled form used for
+    // bulk classification and for hashing.
+    RuleEntryVector _sortedRuleEntries;
+
     // A cached flag indicating whether _pathExpansionRuleMap contains
     // any exclude rules.
     bool _hasExcludes=false;
@@ -264,6 +290,31 @@ public:
         return res;
     }
 
+    /// Classify each path in \p sortedPaths as included or excluded,
+    /// returning one result per path.  The paths must be absolute and sorted
+    /// in lexicographic order (as by SdfPath::operator<()); an error is
+    /// issued otherwise.
+    ///
+    /// Each result is equivalent to the boolean result of IsPathIncluded()
+    /// for the corresponding path, but for queries that use the path
+    /// expansion rule map the classification is done in a single sweep over
+    /// the sorted rule entries, maintaining a stack of ancestor rules, so
+    /// the per-path cost does not grow with the size of the rule map.  Use
+    /// this when classifying many paths at once, e.g. when resolving
+    /// membership for every prim in a render index.
+    std::vector<bool>
+    ComputePathInclusions(const SdfPathVector &sortedPaths) const {
+        // If we have a rule map, go that way.  Otherwise try the expression.
+        if (UsesPathExpansionRuleMap()) {
+            return _ComputeSortedPathInclusionsByRuleMap(sortedPaths);
+        }
+        std::vector<bool> result(sortedPaths.size(), false);
+        for (size_t i = 0; i < sortedPaths.size(); ++i) {
+            result[i] = bool(GetExpressionEvaluator().Match(sortedPaths[i]));
+        }
+        return result;
+    }
+
     /// Return true if this query uses the explicit path-expansion rule method
     /// to determine collection membership.  Otherwise, return false if it uses
     /// the pattern-based membership expression to determine membership.
@@ -0,0 +1,52 @@
+//
+// Copyright 2025 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+#ifndef PXR_USD_USD_COMPOSITION_STATS_H
+#define PXR_USD_USD_COMPOSITION_STATS_H
+
+#include "pxr/pxr.h"
+#include "pxr/usd/usd/api.h"
+#include "pxr/usd/sdf/path.h"
+
+#include <cstdint>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// \struct UsdCompositionStats
+///
+/// Composition cost recorded for a single prim, or aggregated over a
+/// subtree when returned from
+/// UsdStage::GetMostExpensiveCompositionSubtrees().
+///
+/// Recording is enabled by setting the USD_RECORD_COMPOSITION_STATS
+/// environment variable before stages are opened; see
+/// UsdStage::IsRecordingCompositionStats().
+struct UsdCompositionStats
+{
+    /// Path of the prim (or root of the subtree) these statistics
+    /// describe.
+    SdfPath primPath;
+
+    /// Time spent composing the prim, excluding descendants, in
+    /// nanoseconds.  This covers resolving the prim's flags, type info
+    /// and value clips from its prim index; it does not include the prim
+    /// index computation itself, which Pcp performs in bulk.
+    uint64_t timeNanos = 0;
+
+    /// Number of composition arcs (non-root nodes) in the prim's index.
+    size_t numCompositionArcs = 0;
+
+    /// Number of layers contributing to the prim's index, summed over
+    /// the distinct layer stacks its nodes reference.
+    size_t numContributingLayers = 0;
+};
+
+using UsdCompositionStatsVector = std::vector<UsdCompositionStats>;
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // PXR_USD_USD_COMPOSITION_STATS_H
@@ -27,6 +27,7 @@
 #include "pxr/usd/sdf/payload.h"
 #include "pxr/usd/sdf/schema.h"
 
+#include <tbb/concurrent_unordered_map.h>
 #include <tbb/parallel_for.h>
 #include <tbb/parallel_sort.h>
 
@@ -104,19 +105,11 @@ public:
 
     string const &GetAssetPath() const { return _crateFile->GetAssetPath(); }
 
-    bool Save(string const &fileName) {
-        TfAutoMallocTag tag("Usd_CrateDataImpl::Save");
-
-        TF_DESCRIBE_SCOPE("Saving usd binary file @%s@", fileName.c_str());
-        
-        // Sort by path for better namespace-grouped data layout.
-        vector<SdfPath> sortedPaths;
-        sortedPaths.reserve(_data.size());
-        for (auto const &p: _data) {
-            sortedPaths.push_back(p.first);
-        }
+    // Sort paths by namespace for better namespace-grouped data layout in
+    // the packed file.
+    static void _SortPathsForPacking(vector<SdfPath> *paths) {
         tbb::parallel_sort(
-            sortedPaths.begin(), sortedPaths.end(),
+            paths->begin(), paths->end(),
             [](SdfPath const &p1, SdfPath const &p2) {
                 // Prim paths before property paths, then property paths grouped
                 // by property name.
@@ -135,6 +128,20 @@ public:
                     return p1 < p2;
                 }
             });
+    }
+
+    bool Save(string const &fileName) {
+        TfAutoMallocTag tag("Usd_CrateDataImpl::Save");
+
+        TF_DESCRIBE_SCOPE("Saving usd binary file @%s@", fileName.c_str());
+
+        // Sort by path for better namespace-grouped data layout.
+        vector<SdfPath> sortedPaths;
+        sortedPaths.reserve(_data.size());
+        for (auto const &p: _data) {
+            sortedPaths.push_back(p.first);
+        }
+        _SortPathsForPacking(&sortedPaths);
 
         // Now pack all the specs.
         if (CrateFile::Packer packer = _crateFile->StartPacking(fileName)) {
@@ -151,6 +158,67 @@ public:
         return false;
     }
 
+    // Pack the contents of an arbitrary SdfAbstractData object to a new
+    // crate file, one spec at a time. Unlike copying the data into a
+    // Usd_CrateData and saving that, this never materializes a second
+    // copy of the whole document; additional memory is bounded by the
+    // fields of the single spec being packed (plus the packer's output
+    // buffering).
+    static bool PackData(SdfAbstractDataConstPtr const &data,
+                         string const &fileName) {
+        TfAutoMallocTag tag("Usd_CrateDataImpl::PackData");
+
+        TF_DESCRIBE_SCOPE("Writing usd binary file @%s@", fileName.c_str());
+
+        // Collect and sort the spec paths, using the same layout policy
+        // as Save().
+        struct _PathCollector : SdfAbstractDataSpecVisitor {
+            bool VisitSpec(SdfAbstractData const &,
+                           SdfPath const &path) override {
+                // Crate files do not store target or connection specs;
+                // they are synthesized from the owning property's list op.
+                if (!path.IsTargetPath()) {
+                    paths.push_back(path);
+                }
+                return true;
+            }
+            void Done(SdfAbstractData const &) override {}
+            vector<SdfPath> paths;
+        };
+        _PathCollector collector;
+        data->VisitSpecs(&collector);
+        vector<SdfPath> &sortedPaths = collector.paths;
+        _SortPathsForPacking(&sortedPaths);
+
+        auto crateFile = CrateFile::CreateNew(/* detached = */ false);
+        if (CrateFile::Packer packer = crateFile->StartPacking(fileName)) {
+            _FieldValuePairVector fields;
+            for (auto const &p: sortedPaths) {
+                const SdfSpecType specType = data->GetSpecType(p);
+                fields.clear();
+                for (auto const &fieldName: data->List(p)) {
+                    if (fieldName == SdfChildrenKeys->ConnectionChildren ||
+                        fieldName ==
+                            SdfChildrenKeys->RelationshipTargetChildren) {
+                        // Synthesized from the list ops; not stored.
+                        continue;
+                    }
+                    VtValue val = data->Get(p, fieldName);
+                    if (fieldName == SdfDataTokens->TimeSamples) {
+                        val = _Make_TimeSamples(val);
+                    } else if (fieldName == SdfFieldKeys->Payload) {
+                        val = _FromPayloadListOpValue(val);
+                    }
+                    fields.emplace_back(fieldName, std::move(val));
+                }
+                packer.PackSpec(p, specType, fields);
+            }
+            return packer.Close();
+        }
+
+        return false;
+    }
+
     template <class ...Args>
     bool Open(string const& assetPath, Args&&... args) {
         TfAutoMallocTag tag("Usd_CrateDataImpl::Open");
@@ -890,7 +958,7 @@ private:
         return val;
     }
 
-    inline VtValue _Make_TimeSamples(VtValue const &val) const {
+    static inline VtValue _Make_TimeSamples(VtValue const &val) {
         if (val.IsHolding<SdfTimeSampleMap>()) {
             TimeSamples result;
             auto const &tsm = val.UncheckedGet<SdfTimeSampleMap>();
@@ -932,7 +1000,7 @@ private:
 
     // Converts the value from a SdfPayloadListOp value to an SdfPayload only
     // if it can be semantically represented as a single SdfPayload
-    inline VtValue _FromPayloadListOpValue(VtValue const &val) const {
+    static inline VtValue _FromPayloadListOpValue(VtValue const &val) {
         if (val.IsHolding<SdfPayloadListOp>()) {
             const SdfPayloadListOp &listOp = val.UncheckedGet<SdfPayloadListOp>();
             // The list must be explicit to be represented as a single 
@@ -1009,12 +1077,47 @@ private:
     }
 
     inline VtValue _DetachValue(VtValue const &val) const {
-        return val.IsHolding<ValueRep>() ?
-            _crateFile->UnpackValue(val.UncheckedGet<ValueRep>()) : val;
+        if (!val.IsHolding<ValueRep>()) {
+            return val;
+        }
+        ValueRep const rep = val.UncheckedGet<ValueRep>();
+        return _IsFlyweightableRep(rep) ?
+            _UnpackValueShared(rep) : _crateFile->UnpackValue(rep);
+    }
+
+    // Crate files dedupe equal values to a single rep on disk, so repeated
+    // metadata (identical assetInfo/customData dictionaries across
+    // thousands of prims, say) is stored once; hydrating each occurrence
+    // into its own VtValue copy would reinflate that duplication in
+    // memory.  Flyweight the heavy non-inlined scalar reps instead: unpack
+    // each rep once and hand out copies of the cached VtValue, which share
+    // the held object's storage.  VtValue detaches shared storage on
+    // mutation, so the sharing is invisible to clients.  Arrays are
+    // excluded; they are commonly zero-copy mapped from the file and
+    // already share storage per rep.
+    inline bool _IsFlyweightableRep(ValueRep rep) const {
+        return !rep.IsInlined() && !rep.IsArray() &&
+            rep.GetType() != TypeEnum::TimeSamples &&
+            rep.GetType() != TypeEnum::TokenVector;
+    }
+
+    inline VtValue _UnpackValueShared(ValueRep rep) const {
+        auto it = _flyweightValues.find(rep);
+        if (it != _flyweightValues.end()) {
+            return it->second;
+        }
+        // Unpack fully before publishing the entry so concurrent readers
+        // never observe a partially constructed value.  If we lose an
+        // insertion race the winner's entry is returned and our copy is
+        // simply discarded.
+        VtValue unpacked = _crateFile->UnpackValue(rep);
+        return _flyweightValues.insert(
+            { rep, std::move(unpacked) }).first->second;
     }
 
     inline void _ClearSpecData() {
         TfReset(_data);
+        _flyweightValues.clear();
         _lastSet = _data.end();
     }
 
@@ -1046,6 +1149,15 @@ private:
     _HashMap _data;
     _HashMap::iterator _lastSet; // cached last authored spec.
 
+    // Shared immutable storage for values hydrated from non-inlined
+    // scalar reps, keyed by rep.  See _UnpackValueShared().  Reads run
+    // concurrently, so this must be a concurrent container.
+    struct _ValueRepHash {
+        size_t operator()(ValueRep rep) const { return hash_value(rep); }
+    };
+    mutable tbb::concurrent_unordered_map<
+        ValueRep, VtValue, _ValueRepHash> _flyweightValues;
+
     // Underlying file.
     std::unique_ptr<CrateFile> _crateFile;
 };
@@ -1116,6 +1228,24 @@ Usd_CrateData::Export(string const &fileName)
     return tmp.Save(fileName);
 }
 
+/* static */
+bool
+Usd_CrateData::PackDataToFile(const SdfAbstractDataConstPtr &data,
+                              const std::string &fileName)
+{
+    if (!data) {
+        TF_CODING_ERROR("Tried to pack invalid data to @%s@",
+                        fileName.c_str());
+        return false;
+    }
+    if (fileName.empty()) {
+        TF_CODING_ERROR("Tried to save to empty fileName");
+        return false;
+    }
+
+    return Usd_CrateDataImpl::PackData(data, fileName);
+}
+
 bool
 Usd_CrateData::Open(const std::string &assetPath,
                     bool detached)
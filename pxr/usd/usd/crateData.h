@@ -41,6 +41,15 @@ public:
 
     bool Export(const std::string &fileName);
 
+    /// Write the contents of \p data to \p fileName as a usd crate file,
+    /// packing one spec at a time. Unlike copying \p data into a
+    /// Usd_CrateData and saving that, this never materializes a second
+    /// copy of the whole document, so the additional memory needed for
+    /// the write is bounded by the largest single spec. This is the
+    /// preferred way to transcode large non-crate layers to crate.
+    static bool PackDataToFile(const SdfAbstractDataConstPtr &data,
+                               const std::string &fileName);
+
     bool Open(const std::string &assetPath,
               bool detached);
     bool Open(const std::string &assetPath, 
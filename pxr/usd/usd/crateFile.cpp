@@ -57,6 +57,7 @@
 #include "pxr/base/work/utils.h"
 #include "pxr/base/work/withScopedParallelism.h"
 #include "pxr/usd/ar/asset.h"
+#include "pxr/usd/ar/blockCachedAsset.h"
 #include "pxr/usd/ar/resolvedPath.h"
 #include "pxr/usd/ar/resolver.h"
 #include "pxr/usd/sdf/assetPath.h"
@@ -116,12 +117,34 @@ TF_DEFINE_ENV_SETTING(
     "rounded up to the next whole multiple of the system's page size "
     "(typically 4 KB).");
 
+TF_DEFINE_ENV_SETTING(
+    USDC_READAHEAD_VALUES, false,
+    "If set, begin streaming a Crate file's value data into memory as soon "
+    "as its structural sections have been read.  Crate exposes the prim "
+    "hierarchy from the structural sections and unpacks values lazily, so "
+    "clients can begin composing a layer immediately while the kernel reads "
+    "value blocks in the background instead of demand-paging each first "
+    "access.  Most useful for large layers on high-latency storage when "
+    "most of the layer's values will eventually be read.");
+
 TF_DEFINE_ENV_SETTING(
     USDC_ENABLE_ZERO_COPY_ARRAYS, true,
     "Enable the zero-copy optimization for numeric array values whose in-file "
     "representation matches the in-memory representation.  With this "
     "optimization, we create VtArrays that point directly into the memory "
-    "mapped region rather than copying the data to heap buffers.");
+    "mapped region rather than copying the data to heap buffers.  Since the "
+    "mapping is a read-only file mapping, the physical pages behind these "
+    "arrays are shared machine-wide: every process with the same Crate file "
+    "open references one copy in the page cache rather than making its own "
+    "heap copy.");
+
+TF_DEFINE_ENV_SETTING(
+    USDC_ZERO_COPY_ARRAY_MIN_BYTES, 2048,
+    "Minimum in-file array size, in bytes, for the zero-copy optimization "
+    "to apply.  Arrays smaller than this are copied to heap buffers on "
+    "read.  Lowering this value makes more arrays alias the memory-mapped "
+    "file at the cost of keeping the mapping referenced while those arrays "
+    "are alive.");
 
 TF_DEFINE_ENV_SETTING(
     USDC_USE_ASSET, false,
@@ -130,6 +153,16 @@ TF_DEFINE_ENV_SETTING(
     "files on disk, but these functions may be used indirectly by ArAsset "
     "implementations.");
 
+TF_DEFINE_ENV_SETTING(
+    USDC_ASSET_BLOCK_CACHE_KB, 512,
+    "Block size, in KB, used to cache reads from Crate files backed by "
+    "ArAsset implementations with no local file handle (e.g. network "
+    "streams).  Reads are widened to aligned blocks of this size and each "
+    "block is fetched from the asset at most once, so reading the "
+    "structural sections and a masked subset of values fetches only the "
+    "byte ranges they touch rather than the whole asset.  Set to 0 to "
+    "read from such assets directly.");
+
 static int _GetMMapPrefetchKB()
 {
     auto getKB = []() {
@@ -324,6 +357,9 @@ using std::unordered_map;
 using std::vector;
 
 // Version history:
+// 0.12.0: Tokens section compressed with a shared dictionary chained
+//         across chunks, improving the compression ratio of large
+//         token-heavy files.
 // 0.11.0: Added support for relocates in layer metadata.
 // 0.10.0: Added support for the pathExpression value type.
 //  0.9.0: Added support for the timecode and timecode[] value types.
@@ -340,7 +376,7 @@ using std::vector;
 //         See _PathItemHeader_0_0_1.
 //  0.0.1: Initial release.
 constexpr uint8_t USDC_MAJOR = 0;
-constexpr uint8_t USDC_MINOR = 11;
+constexpr uint8_t USDC_MINOR = 12;
 constexpr uint8_t USDC_PATCH = 0;
 
 CrateFile::Version
@@ -1880,9 +1916,10 @@ _ReadUncompressedArray(
     // Check size and alignment -- the standard requires that alignments
     // are power-of-two.
     size_t numBytes = sizeof(T) * size;
-    static constexpr size_t MinZeroCopyArrayBytes = 2048; // Half a page?
+    static const size_t minZeroCopyArrayBytes = std::max(
+        0, TfGetEnvSetting(USDC_ZERO_COPY_ARRAY_MIN_BYTES));
     if (zeroCopyEnabled &&
-        /* size reasonable? */numBytes >= MinZeroCopyArrayBytes &&
+        /* size reasonable? */numBytes >= minZeroCopyArrayBytes &&
         /*    alignment ok? */
         (reinterpret_cast<uintptr_t>(
             reader.src.TellMemoryAddress()) & (alignof(T)-1)) == 0) {
@@ -2105,6 +2142,15 @@ CrateFile::CreateNew(bool detached)
     return std::unique_ptr<CrateFile>(new CrateFile(opt));
 }
 
+// Note on cross-process memory sharing: the mappings established below are
+// read-only file mappings, so the kernel backs them with page-cache pages
+// shared by every process that maps the same file.  Together with the
+// zero-copy array optimization, which hands out VtArrays aliasing the
+// mapping, this means the raw file bytes and qualifying array value storage
+// exist once per workstation no matter how many processes have the layer
+// open.  Unpacked structural indexes (tokens, paths, specs) are necessarily
+// per-process: they hold pointers into process-local intern tables and
+// cannot live in a shared segment.
 /* static */
 CrateFile::_FileMapping
 CrateFile::_MmapAsset(char const *assetPath, ArAssetSharedPtr const &asset)
@@ -2293,6 +2339,20 @@ CrateFile::_InitMMap() {
             ArchMemAdvise(
                 _mmapSrc.GetMapStart(), mapSize, ArchMemAdviceNormal);
         }
+
+        // If requested, start streaming the rest of the file into memory.
+        // The advice is asynchronous, so callers can begin composing from
+        // the structural sections while value blocks arrive.  Mark the
+        // mapping sequential first so the kernel uses its widest readahead
+        // window for the streaming.
+        if (!_assetPath.empty() &&
+            TfGetEnvSetting(USDC_READAHEAD_VALUES)) {
+            ArchMemAdvise(
+                _mmapSrc.GetMapStart(), mapSize,
+                ArchMemAdviceSequentialAccess);
+            ArchMemAdvise(
+                _mmapSrc.GetMapStart(), mapSize, ArchMemAdviceWillNeed);
+        }
     } else {
         _assetPath.clear();
     }
@@ -2329,6 +2389,15 @@ CrateFile::_InitPread()
     // Restore default prefetch behavior.
     ArchFileAdvise(_preadSrc.file, _preadSrc.startOffset,
                    rangeLength, ArchFileAdviceNormal);
+
+    // If requested, start streaming the rest of the file into the page
+    // cache; see the corresponding advice in _InitMMap.
+    if (!_assetPath.empty() && TfGetEnvSetting(USDC_READAHEAD_VALUES)) {
+        ArchFileAdvise(_preadSrc.file, _preadSrc.startOffset,
+                       rangeLength, ArchFileAdviceSequentialAccess);
+        ArchFileAdvise(_preadSrc.file, _preadSrc.startOffset,
+                       rangeLength, ArchFileAdviceWillNeed);
+    }
 }
 
 CrateFile::CrateFile(string const &assetPath, ArAssetSharedPtr const &asset,
@@ -2345,6 +2414,18 @@ CrateFile::CrateFile(string const &assetPath, ArAssetSharedPtr const &asset,
 void
 CrateFile::_InitAsset()
 {
+    // If the asset has no local file backing (e.g. it streams over a network
+    // protocol), route reads through a block cache so that the structural
+    // sections here, and any lazy value reads later, fetch only the aligned
+    // byte ranges they touch, each at most once.  Detached assets already
+    // hold their contents in memory, so they read directly.
+    const int blockCacheKB = TfGetEnvSetting(USDC_ASSET_BLOCK_CACHE_KB);
+    if (!_detached && blockCacheKB > 0 && !_assetSrc->GetFileUnsafe().first) {
+        if (auto cachedAsset = ArBlockCachedAsset::FromAsset(
+                _assetSrc, size_t(blockCacheKB) * 1024)) {
+            _assetSrc = cachedAsset;
+        }
+    }
     auto reader = _MakeReader(_AssetStream(_assetSrc));
     TfErrorMark m;
     _ReadStructuralSections(reader, _assetSrc->GetSize());
@@ -2582,6 +2663,13 @@ CrateFile::_WriteSection(
 void
 CrateFile::_AddDeferredSpecs()
 {
+    // Pack deferred time-sample values grouped by sample time, walking the
+    // times in increasing order.  This gives newly written sample data a
+    // column-oriented physical layout: all the values for a given frame,
+    // across all attributes, land in one contiguous region of the file, so
+    // per-frame playback reads are sequential rather than scattered across
+    // per-attribute value streams.
+
     // A map from sample time to VtValues within TimeSamples instances in
     // _deferredSpecs.
     pxr_tsl::robin_map<double, vector<VtValue *>> allValuesAtAllTimes;
@@ -3175,8 +3263,15 @@ CrateFile::_WriteTokens(_Writer &w) {
         w.WriteAs<uint64_t>(tokenData.size());
         std::unique_ptr<char[]> compressed(
             new char[TfFastCompression::GetCompressedBufferSize(tokenData.size())]);
-        uint64_t compressedSize = TfFastCompression::CompressToBuffer(
-            tokenData.data(), compressed.get(), tokenData.size());
+        // Version 0.12.0 chains large token data chunks through a shared
+        // dictionary for a better ratio; older versions compress chunks
+        // independently.
+        uint64_t compressedSize =
+            _packCtx->writeVersion >= Version(0,12,0) ?
+            TfFastCompression::CompressToBufferChained(
+                tokenData.data(), compressed.get(), tokenData.size()) :
+            TfFastCompression::CompressToBuffer(
+                tokenData.data(), compressed.get(), tokenData.size());
         w.WriteAs<uint64_t>(compressedSize);
         w.WriteContiguous(compressed.get(), compressedSize);
     }
@@ -3291,18 +3386,24 @@ template <class Reader>
 void
 CrateFile::_PrefetchStructuralSections(Reader reader) const
 {
-    // Go through the _toc and find its maximal range, then ask the reader to
-    // prefetch that range.
-    int64_t min = -1, max = -1;
+    // Prefetch each section's range, coalescing sections that touch or
+    // overlap.  Prefetching the sections individually rather than the maximal
+    // range spanning all of them avoids faulting in any value data that
+    // happens to lie between structural sections in the file.
+    std::vector<std::pair<int64_t, int64_t>> ranges;
+    ranges.reserve(_toc.sections.size());
     for (_Section const &sec: _toc.sections) {
-        if (min == -1 || (sec.start < min))
-            min = sec.start;
-        int64_t end = sec.start + sec.size;
-        if (max == -1 || (end > max))
-            max = end;
-    }
-    if (min != -1 && max != -1)
-        reader.Prefetch(min, max-min);
+        ranges.emplace_back(sec.start, sec.start + sec.size);
+    }
+    std::sort(ranges.begin(), ranges.end());
+    for (size_t i = 0; i != ranges.size(); ++i) {
+        int64_t start = ranges[i].first, end = ranges[i].second;
+        while (i + 1 != ranges.size() && ranges[i + 1].first <= end) {
+            end = std::max(end, ranges[i + 1].second);
+            ++i;
+        }
+        reader.Prefetch(start, end - start);
+    }
 }
 
 template <class Reader>
@@ -3545,25 +3646,33 @@ CrateFile::_ReadTokens(Reader reader)
     _tokens.clear();
     _tokens.resize(numTokens);
 
-    WorkDispatcher wd;
-    struct MakeToken {
-        void operator()() const { (*tokens)[index] = TfToken(str); }
-        vector<TfToken> *tokens;
-        size_t index;
-        char const *str;
-    };
+    // Collect the string starts, then intern in parallel chunks.
+    // TfToken::BulkIntern groups each chunk by token-table shard and
+    // takes each shard's lock once, rather than once per token.
+    vector<char const *> strs;
+    strs.reserve(numTokens);
     size_t i = 0;
     for (; p < charsEnd && i != numTokens; ++i) {
-        MakeToken mt { &_tokens, i, p };
-        wd.Run(mt);
+        strs.push_back(p);
         p += strlen(p) + 1;
     }
-    wd.Wait();
     if (i != numTokens) {
         TF_RUNTIME_ERROR("Crate file claims %zu tokens, found %zu",
                          numTokens, i);
     }
 
+    static constexpr size_t chunkSize = 4096;
+    WorkDispatcher wd;
+    for (size_t start = 0; start < strs.size(); start += chunkSize) {
+        const size_t n = std::min(chunkSize, strs.size() - start);
+        char const *const *chunkStrs = strs.data() + start;
+        TfToken *chunkOut = _tokens.data() + start;
+        wd.Run([chunkStrs, chunkOut, n]() {
+            TfToken::BulkIntern(chunkStrs, n, chunkOut);
+        });
+    }
+    wd.Wait();
+
     WorkSwapDestroyAsync(chars);
 }
 
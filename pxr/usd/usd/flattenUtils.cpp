@@ -10,6 +10,7 @@
 #include "pxr/usd/sdf/layer.h"
 #include "pxr/usd/sdf/assetPath.h"
 #include "pxr/usd/sdf/changeBlock.h"
+#include "pxr/usd/sdf/copyUtils.h"
 #include "pxr/usd/sdf/layerUtils.h"
 #include "pxr/usd/sdf/primSpec.h"
 #include "pxr/usd/sdf/attributeSpec.h"
@@ -31,6 +32,9 @@
 #include "pxr/usd/ar/resolverContextBinder.h"
 #include "pxr/base/tf/staticData.h"
 #include "pxr/base/tf/pathUtils.h"
+#include "pxr/base/work/loops.h"
+#include "pxr/base/work/threadLimits.h"
+#include "pxr/base/work/withScopedParallelism.h"
 
 #include <algorithm>
 #include <functional>
@@ -701,6 +705,52 @@ _FlattenSpec(const PcpLayerStackRefPtr &layerStack,
     }
 }
 
+// Flatten the root prims of the layer stack, named by nameOrder, in parallel.
+// Root prims compose independently of one another, so each worker flattens
+// one root subtree into its own anonymous layer; the per-prim layers are then
+// merged into the output layer in namespace order.  The merge shares field
+// values with the per-prim layers rather than deep-copying them.
+static void
+_FlattenRootPrimsInParallel(const PcpLayerStackRefPtr &layerStack,
+                            const SdfLayerRefPtr &outputLayer,
+                            const TfTokenVector &nameOrder,
+                            const _ResolveAssetPathFn &resolveAssetPathFn)
+{
+    const ArResolverContext &resolverContext =
+        layerStack->GetIdentifier().pathResolverContext;
+    std::vector<SdfLayerRefPtr> primLayers(nameOrder.size());
+    WorkWithScopedParallelism([&]() {
+        WorkParallelForN(
+            nameOrder.size(),
+            [&](size_t begin, size_t end) {
+                // Bind the resolver context on this worker thread, and batch
+                // change processing for the layers it authors.
+                ArResolverContextBinder arBinder(resolverContext);
+                SdfChangeBlock changeBlock;
+                for (size_t i = begin; i != end; ++i) {
+                    SdfLayerRefPtr primLayer =
+                        SdfLayer::CreateAnonymous(".usda");
+                    // Use SdfSpecifierDef as a placeholder specifier; it
+                    // will be fixed up when we _FlattenFields().
+                    if (SdfPrimSpecHandle prim = SdfPrimSpec::New(
+                            primLayer->GetPseudoRoot(), nameOrder[i],
+                            SdfSpecifierDef)) {
+                        _FlattenFields(layerStack, prim, resolveAssetPathFn);
+                        _FlattenSpec(layerStack, prim, resolveAssetPathFn);
+                        primLayers[i] = primLayer;
+                    }
+                }
+            });
+    });
+    for (size_t i = 0; i != nameOrder.size(); ++i) {
+        if (primLayers[i]) {
+            const SdfPath primPath =
+                SdfPath::AbsoluteRootPath().AppendChild(nameOrder[i]);
+            SdfCopySpecBulk(primLayers[i], primPath, outputLayer, primPath);
+        }
+    }
+}
+
 static std::string
 _EvaluateAssetPathExpression(
     const std::string& expression,
@@ -761,7 +811,23 @@ UsdFlattenLayerStack(
     const bool hasExtension = !TfGetExtension(tag).empty();
     SdfLayerRefPtr outputLayer = SdfLayer::CreateAnonymous(hasExtension ? tag : tag+".usda");
     _FlattenFields(layerStack, outputLayer->GetPseudoRoot(), resolveFnWrapper);
-    _FlattenSpec(layerStack, outputLayer->GetPseudoRoot(), resolveFnWrapper);
+
+    // Root prims compose independently, so when there is more than one we
+    // flatten each root subtree in parallel and merge the results, rather
+    // than recursing serially from the pseudo-root.
+    TfTokenVector nameOrder;
+    PcpTokenSet nameSet;
+    PcpComposeSiteChildNames(layerStack->GetLayers(),
+                             SdfPath::AbsoluteRootPath(),
+                             SdfChildrenKeys->PrimChildren,
+                             &nameOrder, &nameSet,
+                             &SdfFieldKeys->PrimOrder);
+    if (nameOrder.size() > 1 && WorkHasConcurrency()) {
+        _FlattenRootPrimsInParallel(
+            layerStack, outputLayer, nameOrder, resolveFnWrapper);
+    } else {
+        _FlattenSpec(layerStack, outputLayer->GetPseudoRoot(), resolveFnWrapper);
+    }
     return outputLayer;
 }
 
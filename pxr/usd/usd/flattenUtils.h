@@ -95,6 +95,10 @@ using UsdFlattenResolveAssetPathFn = std::function<std::string(
 /// evaluated asset path will be passed to the \p resolveAssetPathFn callback
 /// instead of the original asset path.
 /// \sa UsdFlattenLayerStackResolveAssetPath.
+///
+/// When the layer stack contains more than one root prim, the root subtrees
+/// are flattened in parallel, so \p resolveAssetPathFn may be invoked
+/// concurrently from multiple threads and must be thread-safe.
 USD_API
 SdfLayerRefPtr
 UsdFlattenLayerStack(const PcpLayerStackRefPtr &layerStack,
@@ -147,6 +151,10 @@ using UsdFlattenResolveAssetPathAdvancedFn = std::function<
 /// relative asset paths instead of resolving them to absolute form. As
 /// another example, the callback might maintain stage variable expressions
 /// in their unevaluated form.
+///
+/// When the layer stack contains more than one root prim, the root subtrees
+/// are flattened in parallel, so \p resolveAssetPathFn may be invoked
+/// concurrently from multiple threads and must be thread-safe.
 USD_API
 SdfLayerRefPtr
 UsdFlattenLayerStack(
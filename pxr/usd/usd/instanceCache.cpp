@@ -11,8 +11,10 @@
 #include "pxr/usd/pcp/primIndex.h"
 
 #include "pxr/base/tf/envSetting.h"
+#include "pxr/base/tf/stringUtils.h"
 #include "pxr/base/trace/trace.h"
 
+#include <algorithm>
 #include <utility>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -476,12 +478,51 @@ Usd_InstanceCache::GetAllPrototypes() const
     return paths;
 }
 
-size_t 
+size_t
 Usd_InstanceCache::GetNumPrototypes() const
 {
     return _prototypeToInstanceKeyMap.size();
 }
 
+std::string
+Usd_InstanceCache::GetPrototypeSharingDiagnostics() const
+{
+    // Sort the prototypes by path so that the report is stable from
+    // run to run.
+    vector<pair<SdfPath, const Usd_InstanceKey*>> prototypes;
+    prototypes.reserve(_prototypeToInstanceKeyMap.size());
+    for (const _PrototypeToInstanceKeyMap::value_type& v:
+             _prototypeToInstanceKeyMap) {
+        prototypes.push_back(make_pair(v.first, &v.second));
+    }
+    std::sort(prototypes.begin(), prototypes.end());
+
+    std::string report;
+    for (size_t i = 0; i < prototypes.size(); ++i) {
+        for (size_t j = i + 1; j < prototypes.size(); ++j) {
+            const std::vector<std::string> differingComponents =
+                prototypes[i].second->GetDifferingComponentNames(
+                    *prototypes[j].second);
+            // Prototypes whose keys differ in every component aren't
+            // candidates for sharing, so reporting them would just be
+            // noise.
+            static const size_t numComponents = 4;
+            if (differingComponents.empty() ||
+                differingComponents.size() == numComponents) {
+                continue;
+            }
+            report += TfStringPrintf(
+                "Prototype <%s> is not shared with otherwise-identical "
+                "prototype <%s> because these instancing key components "
+                "differ: %s\n",
+                prototypes[i].first.GetText(),
+                prototypes[j].first.GetText(),
+                TfStringJoin(differingComponents, ", ").c_str());
+        }
+    }
+    return report;
+}
+
 SdfPath 
 Usd_InstanceCache::GetPrototypeUsingPrimIndexPath(
     const SdfPath& primIndexPath) const
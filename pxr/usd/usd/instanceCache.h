@@ -15,6 +15,7 @@
 
 #include <tbb/spin_mutex.h>
 #include <map>
+#include <string>
 #include <unordered_map>
 #include <vector>
 
@@ -154,6 +155,13 @@ public:
     /// prim indexes registered with this cache.
     size_t GetNumPrototypes() const;
 
+    /// Returns a human-readable report describing, for each prototype prim,
+    /// which instancing key components prevented it from being shared with
+    /// otherwise-similar prototypes.  Pairs of prototypes whose keys differ
+    /// in every component are not reported, since they are not candidates
+    /// for sharing.  Returns an empty string if no such pairs exist.
+    std::string GetPrototypeSharingDiagnostics() const;
+
     /// Return the path of the prototype root prim using the prim index at
     /// \p primIndexPath as its source prim index, or the empty path if no such
     /// prototype exists.
@@ -8,12 +8,60 @@
 #include "pxr/usd/usd/instanceKey.h"
 #include "pxr/usd/usd/resolver.h"
 #include "pxr/usd/pcp/primIndex.h"
+#include "pxr/base/tf/envSetting.h"
 #include "pxr/base/tf/hash.h"
+#include "pxr/base/tf/stringUtils.h"
 
 #include <iostream>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+TF_DEFINE_ENV_SETTING(
+    USD_INSTANCING_RELAXED_KEY_COMPONENTS, "",
+    "Comma-separated list of instancing key components to exclude when "
+    "grouping instanceable prims into prototypes.  Valid component names "
+    "are 'clipSets', 'populationMask' and 'loadRules'.  Excluding a "
+    "component allows instances that differ only in that data to share a "
+    "prototype, increasing sharing at the cost of exact per-instance "
+    "behavior for the excluded data, so this is opt-in and off by default.");
+
+namespace {
+struct _RelaxedComponents {
+    bool clipSets = false;
+    bool populationMask = false;
+    bool loadRules = false;
+};
+} // anon
+
+static const _RelaxedComponents &
+_GetRelaxedComponents()
+{
+    static const _RelaxedComponents relaxed = []() {
+        _RelaxedComponents r;
+        for (const std::string &name : TfStringTokenize(
+                 TfGetEnvSetting(USD_INSTANCING_RELAXED_KEY_COMPONENTS),
+                 ", ")) {
+            if (name == "clipSets") {
+                r.clipSets = true;
+            }
+            else if (name == "populationMask") {
+                r.populationMask = true;
+            }
+            else if (name == "loadRules") {
+                r.loadRules = true;
+            }
+            else {
+                TF_WARN("Unknown instancing key component '%s' in "
+                        "USD_INSTANCING_RELAXED_KEY_COMPONENTS; valid "
+                        "components are 'clipSets', 'populationMask' and "
+                        "'loadRules'.", name.c_str());
+            }
+        }
+        return r;
+    }();
+    return relaxed;
+}
+
 Usd_InstanceKey::Usd_InstanceKey()
     : _hash(_ComputeHash())
 {
@@ -86,7 +134,14 @@ Usd_InstanceKey::Usd_InstanceKey(const PcpPrimIndex& instance,
                                  const UsdStageLoadRules &loadRules)
     : _pcpInstanceKey(instance)
 {
-    Usd_ComputeClipSetDefinitionsForPrimIndex(instance, &_clipDefs);
+    // Components named in USD_INSTANCING_RELAXED_KEY_COMPONENTS are left in
+    // their default states so that instances differing only in that data
+    // still share a prototype.
+    const _RelaxedComponents &relaxed = _GetRelaxedComponents();
+
+    if (!relaxed.clipSets) {
+        Usd_ComputeClipSetDefinitionsForPrimIndex(instance, &_clipDefs);
+    }
 
     // Make the population mask "relative" to this prim index by removing the
     // index's path prefix from all paths in the mask that it prefixes.  So for
@@ -95,7 +150,7 @@ Usd_InstanceKey::Usd_InstanceKey(const PcpPrimIndex& instance,
     // want the resulting mask to be [/table].  The special cases where the mask
     // includes the whole subtree or excludes the whole subtree are easy to deal
     // with.
-    if (!mask) {
+    if (!mask || relaxed.populationMask) {
         _mask = UsdStagePopulationMask::All();
     }
     else {
@@ -103,7 +158,9 @@ Usd_InstanceKey::Usd_InstanceKey(const PcpPrimIndex& instance,
     }
 
     // Do the same with the load rules.
-    _loadRules = _MakeLoadRulesRelativeTo(instance.GetPath(), loadRules);
+    if (!relaxed.loadRules) {
+        _loadRules = _MakeLoadRulesRelativeTo(instance.GetPath(), loadRules);
+    }
 
     // Compute and cache the hash code.
     _hash = _ComputeHash();
@@ -119,6 +176,25 @@ Usd_InstanceKey::operator==(const Usd_InstanceKey& rhs) const
         _loadRules == rhs._loadRules;
 }
 
+std::vector<std::string>
+Usd_InstanceKey::GetDifferingComponentNames(const Usd_InstanceKey& rhs) const
+{
+    std::vector<std::string> names;
+    if (!(_pcpInstanceKey == rhs._pcpInstanceKey)) {
+        names.push_back("pcpInstanceKey");
+    }
+    if (_clipDefs != rhs._clipDefs) {
+        names.push_back("clipSets");
+    }
+    if (!(_mask == rhs._mask)) {
+        names.push_back("populationMask");
+    }
+    if (!(_loadRules == rhs._loadRules)) {
+        names.push_back("loadRules");
+    }
+    return names;
+}
+
 size_t
 Usd_InstanceKey::_ComputeHash() const
 {
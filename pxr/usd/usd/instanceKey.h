@@ -45,6 +45,12 @@ public:
         return !(*this == rhs);
     }
 
+    /// Returns the names of the key components whose values differ between
+    /// this key and \p rhs.  The component names are "pcpInstanceKey",
+    /// "clipSets", "populationMask" and "loadRules".
+    std::vector<std::string> GetDifferingComponentNames(
+        const Usd_InstanceKey& rhs) const;
+
 private:
     friend size_t hash_value(const Usd_InstanceKey& key);
 
@@ -12,6 +12,7 @@ PXR_NAMESPACE_USING_DIRECTIVE
 TF_WRAP_MODULE
 {
     TF_WRAP(UsdCommon);
+    TF_WRAP(UsdCompositionStats);
     TF_WRAP(UsdNotice);
     TF_WRAP(UsdTimeCode);
     TF_WRAP(UsdTokens);
@@ -63,6 +64,7 @@ TF_WRAP_MODULE
     TF_WRAP(UsdFileFormat);
     TF_WRAP(UsdNamespaceEditor);
     TF_WRAP(UsdResolveInfo);
+    TF_WRAP(UsdValueCache);
     TF_WRAP(Version);
     TF_WRAP(UsdZipFile);
     TF_WRAP(UsdPrimCompositionQueryArc);
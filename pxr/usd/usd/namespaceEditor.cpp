@@ -28,6 +28,9 @@
 #include "pxr/base/work/utils.h"
 #include "pxr/base/work/withScopedParallelism.h"
 
+#include <map>
+#include <utility>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 namespace {
@@ -378,31 +381,66 @@ UsdNamespaceEditor::ReparentProperty(
         property.GetPath(), newParent.GetPrimPath().AppendProperty(newName));
 }
 
-bool 
+bool
 UsdNamespaceEditor::ApplyEdits()
 {
     _ProcessEditsIfNeeded();
-    if (!_processedEdit) {
+    if (!_processedEdits) {
         TF_CODING_ERROR("Failed to process edits");
         return false;
     }
-    const bool success = _processedEdit->Apply();
 
-    // Always clear the processed edits after applying them.
+    // Check that every edit in the batch can be applied before we start
+    // editing any layers so that an invalid edit late in the batch doesn't
+    // leave the earlier edits partially applied.
+    bool success = true;
+    if (std::string errorMsg; !CanApplyEdits(&errorMsg)) {
+        TF_CODING_ERROR(TfStringPrintf("Failed to apply edits to the stage "
+            "because of the following errors: %s", errorMsg.c_str()));
+        success = false;
+    } else {
+        // Apply all the processed edits inside a single change block so that
+        // the stage recomposes just once for the entire batch rather than once
+        // per edit.
+        SdfChangeBlock changeBlock;
+        for (_ProcessedEdit &processedEdit : *_processedEdits) {
+            if (!processedEdit.Apply()) {
+                success = false;
+                break;
+            }
+        }
+    }
+
+    // Applying always consumes the added edits, whether or not it succeeded,
+    // leaving the editor ready for a new batch of edits.
+    _editDescriptions.clear();
     _ClearProcessedEdits();
     return success;
 }
 
-bool 
+bool
 UsdNamespaceEditor::CanApplyEdits(std::string *whyNot) const
 {
     _ProcessEditsIfNeeded();
-    if (!_processedEdit) {
+    if (!_processedEdits) {
         TF_CODING_ERROR("Failed to process edits");
         return false;
     }
 
-    return _processedEdit->CanApply(whyNot);
+    if (_processedEdits->empty()) {
+        if (whyNot) {
+            *whyNot = "There are no valid edits to perform";
+        }
+        return false;
+    }
+
+    for (const _ProcessedEdit &processedEdit : *_processedEdits) {
+        if (!processedEdit.CanApply(whyNot)) {
+            return false;
+        }
+    }
+
+    return true;
 }
 
 static bool 
@@ -419,124 +457,124 @@ _IsValidPropertyEditPath(const SdfPath &path)
         !path.ContainsPrimVariantSelection();
 }
 
-bool 
-UsdNamespaceEditor::_AddPrimDelete(const SdfPath &oldPath) 
+bool
+UsdNamespaceEditor::_AddPrimDelete(const SdfPath &oldPath)
 {
     // We always clear the processed edits when a new edit is added.
     _ClearProcessedEdits();
 
-    // Prim delete is described as moving from the old path to the empty path.
-    _editDescription.oldPath = oldPath;
-    _editDescription.newPath = SdfPath();
-
-    // The path must be an absolute path to a prim.
+    // The path must be an absolute path to a prim. Invalid edits are not
+    // retained so that they don't poison the rest of the batch.
     if (!_IsValidPrimEditPath(oldPath)) {
         TF_CODING_ERROR("Invalid path '%s' provided as the source for "
             "a prim namespace edit.", oldPath.GetText());
-        _editDescription.editType = _EditType::Invalid;
         return false;
     }
-    
-    _editDescription.editType = _EditType::Delete;
+
+    // Prim delete is described as moving from the old path to the empty path.
+    _EditDescription &editDescription = _editDescriptions.emplace_back();
+    editDescription.oldPath = oldPath;
+    editDescription.newPath = SdfPath();
+    editDescription.editType = _EditType::Delete;
     return true;
 }
 
-bool 
-UsdNamespaceEditor::_AddPrimMove(const SdfPath &oldPath, const SdfPath &newPath) 
+bool
+UsdNamespaceEditor::_AddPrimMove(const SdfPath &oldPath, const SdfPath &newPath)
 {
     // We always clear the processed edits when a new edit is added.
     _ClearProcessedEdits();
 
-    _editDescription.oldPath = oldPath;
-    _editDescription.newPath = newPath;
-
-    // Both paths must be an absolute paths to a prim.
+    // Both paths must be an absolute paths to a prim. Invalid edits are not
+    // retained so that they don't poison the rest of the batch.
     if (!_IsValidPrimEditPath(oldPath)) {
         TF_CODING_ERROR("Invalid path '%s' provided as the source for "
             "a prim namespace edit.", oldPath.GetText());
-        _editDescription.editType = _EditType::Invalid;
         return false;
     }
 
     if (!_IsValidPrimEditPath(newPath)) {
         TF_CODING_ERROR("Invalid path '%s' provided as the destination for a "
             "prim namespace edit.", newPath.GetText());
-        _editDescription.editType = _EditType::Invalid;
         return false;
     }
 
+    _EditDescription &editDescription = _editDescriptions.emplace_back();
+    editDescription.oldPath = oldPath;
+    editDescription.newPath = newPath;
+
     // Determine whether the paths represent a rename or a reparent.
     if (oldPath.GetParentPath() == newPath.GetParentPath()) {
-        _editDescription.editType = _EditType::Rename;
+        editDescription.editType = _EditType::Rename;
     } else {
-        _editDescription.editType = _EditType::Reparent;
+        editDescription.editType = _EditType::Reparent;
     }
 
     return true;
 }
 
-bool 
-UsdNamespaceEditor::_AddPropertyDelete(const SdfPath &oldPath) 
+bool
+UsdNamespaceEditor::_AddPropertyDelete(const SdfPath &oldPath)
 {
     // We always clear the processed edits when a new edit is added.
     _ClearProcessedEdits();
 
-    // Property delete is described as moving from the old path to the empty path.
-    _editDescription.oldPath = oldPath;
-    _editDescription.newPath = SdfPath();
-
-    // The path must be an absolute path to a property.
+    // The path must be an absolute path to a property. Invalid edits are not
+    // retained so that they don't poison the rest of the batch.
     if (!_IsValidPropertyEditPath(oldPath)) {
         TF_CODING_ERROR("Invalid path '%s' provided as the source for "
             "a property namespace edit.", oldPath.GetText());
-        _editDescription.editType = _EditType::Invalid;
         return false;
     }
-    
-    _editDescription.editType = _EditType::Delete;
+
+    // Property delete is described as moving from the old path to the empty path.
+    _EditDescription &editDescription = _editDescriptions.emplace_back();
+    editDescription.oldPath = oldPath;
+    editDescription.newPath = SdfPath();
+    editDescription.editType = _EditType::Delete;
     return true;
 }
 
-bool 
+bool
 UsdNamespaceEditor::_AddPropertyMove(
-    const SdfPath &oldPath, const SdfPath &newPath) 
+    const SdfPath &oldPath, const SdfPath &newPath)
 {
     // We always clear the processed edits when a new edit is added.
     _ClearProcessedEdits();
 
-    _editDescription.oldPath = oldPath;
-    _editDescription.newPath = newPath;
-
-    // Both paths must be an absolute paths to a property.
+    // Both paths must be an absolute paths to a property. Invalid edits are
+    // not retained so that they don't poison the rest of the batch.
     if (!_IsValidPropertyEditPath(oldPath)) {
         TF_CODING_ERROR("Invalid path '%s' provided as the source for "
             "a property namespace edit.", oldPath.GetText());
-        _editDescription.editType = _EditType::Invalid;
         return false;
     }
 
     if (!_IsValidPropertyEditPath(newPath)) {
         TF_CODING_ERROR("Invalid path '%s' provided as the destination for a "
             "property namespace edit.", newPath.GetText());
-        _editDescription.editType = _EditType::Invalid;
         return false;
     }
 
+    _EditDescription &editDescription = _editDescriptions.emplace_back();
+    editDescription.oldPath = oldPath;
+    editDescription.newPath = newPath;
+
     // Determine whether the paths represent a rename or a reparent.
     if (oldPath.GetPrimPath() == newPath.GetPrimPath()) {
-        _editDescription.editType = _EditType::Rename;
+        editDescription.editType = _EditType::Rename;
     } else {
-        _editDescription.editType = _EditType::Reparent;
+        editDescription.editType = _EditType::Reparent;
     }
 
     return true;
 }
 
-void 
+void
 UsdNamespaceEditor::_ClearProcessedEdits()
 {
-    _processedEdit.reset();
-} 
+    _processedEdits.reset();
+}
 
 class UsdNamespaceEditor::_EditProcessor {
 
@@ -571,17 +609,83 @@ private:
         _ProcessedEdit *processedEdit);
 };
 
-void 
+void
 UsdNamespaceEditor::_ProcessEditsIfNeeded() const
 {
     // We can skip processing the edits if they've already been processed so
     // we don't have to repeat the same work between calls to CanApplyEdits and
     // ApplyEdits.
-    if (_processedEdit) {
+    if (_processedEdits) {
         return;
     }
-    _processedEdit = UsdNamespaceEditor::_EditProcessor::ProcessEdit(
-        _stage, _editDescription);
+
+    _processedEdits.emplace();
+    _processedEdits->reserve(_editDescriptions.size());
+
+    // The whole batch of edits is processed against the current composed stage
+    // and applied without recomposing between the individual edits, so each
+    // edit must be namespace independent of every edit that precedes it.
+    auto pathsOverlap = [](const SdfPath &lhs, const SdfPath &rhs) {
+        return !lhs.IsEmpty() && !rhs.IsEmpty() &&
+            (lhs.HasPrefix(rhs) || rhs.HasPrefix(lhs));
+    };
+
+    // A property spec's target list op may need fixups from more than one edit
+    // in the batch. Each processed edit computes its new list op value from
+    // the spec's current value, so a later edit's fixup would clobber an
+    // earlier edit's fixup to the same field; to handle this we chain the
+    // fixups by recomputing the later edit's value from the earlier edit's
+    // already updated value.
+    std::map<std::pair<SdfPropertySpecHandle, TfToken>, SdfPathListOp>
+        chainedTargetListOpValues;
+
+    for (size_t i = 0; i < _editDescriptions.size(); ++i) {
+        const _EditDescription &editDesc = _editDescriptions[i];
+        _ProcessedEdit &processedEdit = _processedEdits->emplace_back(
+            UsdNamespaceEditor::_EditProcessor::ProcessEdit(_stage, editDesc));
+
+        for (size_t j = 0; j < i; ++j) {
+            const _EditDescription &otherDesc = _editDescriptions[j];
+            if (pathsOverlap(editDesc.oldPath, otherDesc.oldPath) ||
+                pathsOverlap(editDesc.oldPath, otherDesc.newPath) ||
+                pathsOverlap(editDesc.newPath, otherDesc.oldPath) ||
+                pathsOverlap(editDesc.newPath, otherDesc.newPath)) {
+                processedEdit.errors.push_back(TfStringPrintf(
+                    "The edit of '%s' overlaps in namespace with the "
+                    "previously added edit of '%s'; the edits in a batch are "
+                    "applied without recomposing between the individual edits "
+                    "and must be independent of each other",
+                    editDesc.oldPath.GetText(), otherDesc.oldPath.GetText()));
+            }
+        }
+
+        for (_ProcessedEdit::TargetPathListOpEdit &listOpEdit :
+                processedEdit.targetPathListOpEdits) {
+            const auto [it, inserted] = chainedTargetListOpValues.emplace(
+                std::make_pair(listOpEdit.propertySpec, listOpEdit.fieldName),
+                listOpEdit.newFieldValue);
+            if (inserted) {
+                continue;
+            }
+            // An earlier edit in the batch also fixes up this field, so
+            // recompute this edit's fixup from that edit's updated value
+            // instead of the spec's current value.
+            SdfPathListOp chainedListOp = it->second;
+            chainedListOp.ModifyOperations(
+                [&](const SdfPath &path) {
+                    if (!path.HasPrefix(editDesc.oldPath)) {
+                        return std::optional<SdfPath>(path);
+                    }
+                    if (editDesc.newPath.IsEmpty()) {
+                        return std::optional<SdfPath>();
+                    }
+                    return std::optional<SdfPath>(
+                        path.ReplacePrefix(editDesc.oldPath, editDesc.newPath));
+                });
+            listOpEdit.newFieldValue = chainedListOp;
+            it->second = std::move(chainedListOp);
+        }
+    }
 }
 
 static 
@@ -165,20 +165,30 @@ public:
         const TfToken &newName);
 
     /// Applies all the added namespace edits stored in this to namespace editor
-    /// to its stage by authoring all scene description in the layer stack of 
-    /// the current edit target necessary to move or delete the composed 
+    /// to its stage by authoring all scene description in the layer stack of
+    /// the current edit target necessary to move or delete the composed
     /// objects that the edit paths refer to..
     ///
-    /// Returns true if all the necessary edits are successfully performed; 
-    /// returns false and emits a coding error otherwise. 
+    /// All of the added edits are validated and processed against the current
+    /// composed stage and are then applied in the order they were added within
+    /// a single change block so that the stage only recomposes once for the
+    /// entire batch. Because no recomposition occurs between the individual
+    /// edits, each added edit must be namespace independent of every other
+    /// edit in the batch; an edit whose paths overlap the paths of a
+    /// previously added edit cannot be applied.
+    ///
+    /// Returns true if all the necessary edits are successfully performed;
+    /// returns false and emits a coding error otherwise. The added edits are
+    /// always cleared after attempting to apply them, whether or not applying
+    /// succeeded, leaving this editor ready for a new batch of edits.
     USD_API
     bool ApplyEdits();
 
-    /// Returns whether all the added namespace edits stored in this to 
-    /// namespace editor can be applied to its stage. 
+    /// Returns whether all the added namespace edits stored in this to
+    /// namespace editor can be applied to its stage.
     ///
     /// In other words, this returns whether ApplyEdits should be successful if
-    /// it were called right now. If this would return false and \p whyNot is 
+    /// it were called right now. If this would return false and \p whyNot is
     /// provided, the reasons ApplyEdits would fail will be copied to whyNot.
     USD_API
     bool CanApplyEdits(std::string *whyNot = nullptr) const;
@@ -287,8 +297,8 @@ private:
     // Clears the current procesed edits.
     void _ClearProcessedEdits();
 
-    // Processes and caches the layer edits necessary for the current edit 
-    // operation if there is no cached processecd edit.
+    // Processes and caches the layer edits necessary for all the added edit
+    // operations if there are no cached processecd edits.
     void _ProcessEditsIfNeeded() const;
 
     // Helper class for _ProcessEditsIfNeeded. Defined entirely in 
@@ -297,8 +307,8 @@ private:
     class _EditProcessor;
 
     UsdStageRefPtr _stage;
-    _EditDescription _editDescription;
-    mutable std::optional<_ProcessedEdit> _processedEdit;   
+    std::vector<_EditDescription> _editDescriptions;
+    mutable std::optional<std::vector<_ProcessedEdit>> _processedEdits;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,141 @@
+//
+// Copyright 2026 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+#include "pxr/pxr.h"
+#include "pxr/usd/usd/payloadPrefetcher.h"
+#include "pxr/usd/usd/prim.h"
+#include "pxr/usd/usd/stage.h"
+
+#include "pxr/usd/sdf/layer.h"
+#include "pxr/usd/sdf/layerUtils.h"
+#include "pxr/usd/sdf/payload.h"
+#include "pxr/usd/sdf/primSpec.h"
+
+#include "pxr/base/trace/trace.h"
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+UsdPayloadPrefetcher::UsdPayloadPrefetcher(const UsdStageWeakPtr &stage)
+    : _stage(stage)
+{
+}
+
+UsdPayloadPrefetcher::~UsdPayloadPrefetcher()
+{
+    _dispatcher.Wait();
+}
+
+void
+UsdPayloadPrefetcher::Prefetch(const SdfPath &primPath, int priority)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _queue.push({ primPath, priority });
+    }
+    _dispatcher.Run([this]() { _RunOne(); });
+}
+
+void
+UsdPayloadPrefetcher::Prefetch(const SdfPathVector &primPaths, int priority)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (const SdfPath &path : primPaths) {
+            _queue.push({ path, priority });
+        }
+    }
+    for (size_t i = 0; i != primPaths.size(); ++i) {
+        _dispatcher.Run([this]() { _RunOne(); });
+    }
+}
+
+void
+UsdPayloadPrefetcher::WaitForPrefetches()
+{
+    _dispatcher.Wait();
+}
+
+SdfPathSet
+UsdPayloadPrefetcher::CommitLoads()
+{
+    TRACE_FUNCTION();
+
+    SdfPathSet toLoad;
+    SdfLayerRefPtrVector retained;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        toLoad.swap(_readyPaths);
+        retained.swap(_retainedLayers);
+    }
+    if (toLoad.empty()) {
+        return toLoad;
+    }
+    if (UsdStagePtr stage = _stage) {
+        // One LoadAndUnload call per batch yields a single coalesced
+        // ObjectsChanged notice for all newly loaded prims.
+        stage->LoadAndUnload(toLoad, SdfPathSet(), UsdLoadWithDescendants);
+    }
+    // The prefetched layers are released here; any that were composed by
+    // the load above are now retained by the stage.
+    return toLoad;
+}
+
+void
+UsdPayloadPrefetcher::_RunOne()
+{
+    TRACE_FUNCTION();
+
+    _Entry entry;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_queue.empty()) {
+            return;
+        }
+        entry = _queue.top();
+        _queue.pop();
+    }
+
+    UsdStagePtr stage = _stage;
+    if (!stage) {
+        return;
+    }
+    const UsdPrim prim = stage->GetPrimAtPath(entry.path);
+    if (!prim) {
+        return;
+    }
+
+    // Open the layers targeted by each payload arc authored in the prim's
+    // prim stack.  FindOrOpen goes through the thread-safe layer registry,
+    // so this both warms the registry for the subsequent load and
+    // deduplicates concurrent opens of the same layer.  The returned
+    // references are retained until CommitLoads; the registry alone would
+    // let the layers expire as soon as this task returns.
+    SdfLayerRefPtrVector opened;
+    for (const SdfPrimSpecHandle &spec : prim.GetPrimStack()) {
+        const SdfLayerHandle specLayer = spec->GetLayer();
+        for (const SdfPayload &payload :
+                 spec->GetPayloadList().GetAddedOrExplicitItems()) {
+            if (payload.GetAssetPath().empty()) {
+                // Internal payload; nothing to open.
+                continue;
+            }
+            if (SdfLayerRefPtr layer = SdfLayer::FindOrOpen(
+                    SdfComputeAssetPathRelativeToLayer(
+                        specLayer, payload.GetAssetPath()))) {
+                opened.push_back(std::move(layer));
+            }
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _readyPaths.insert(entry.path);
+    _retainedLayers.insert(
+        _retainedLayers.end(),
+        std::make_move_iterator(opened.begin()),
+        std::make_move_iterator(opened.end()));
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
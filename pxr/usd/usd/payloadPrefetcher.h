@@ -0,0 +1,107 @@
+//
+// Copyright 2026 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+#ifndef PXR_USD_USD_PAYLOAD_PREFETCHER_H
+#define PXR_USD_USD_PAYLOAD_PREFETCHER_H
+
+#include "pxr/pxr.h"
+#include "pxr/usd/usd/api.h"
+#include "pxr/usd/usd/common.h"
+#include "pxr/usd/sdf/declareHandles.h"
+#include "pxr/usd/sdf/path.h"
+#include "pxr/base/work/dispatcher.h"
+
+#include <mutex>
+#include <queue>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+SDF_DECLARE_HANDLES(SdfLayer);
+
+/// \class UsdPayloadPrefetcher
+///
+/// Asynchronous, priority-ordered prefetching of payloads on a UsdStage.
+///
+/// Interactive clients (e.g. viewers doing camera-frustum-driven loading)
+/// can enqueue payload prim paths with priorities.  Background threads
+/// resolve and open the layers targeted by each prim's payload arcs in
+/// priority order, warming the layer registry so that the subsequent
+/// synchronous load is dominated by composition rather than I/O.  Calling
+/// CommitLoads() then loads all prefetched paths through a single
+/// UsdStage::LoadAndUnload call, so listeners receive one ObjectsChanged
+/// notice per batch instead of one per payload.
+///
+/// Prefetching only performs thread-safe read operations on the stage and
+/// opens layers through the thread-safe layer registry.  However, callers
+/// must not mutate the stage's composition (editing layers, changing load
+/// rules) while prefetch tasks are in flight; call WaitForPrefetches()
+/// first.  CommitLoads() must be called from a thread that is allowed to
+/// mutate the stage, like any other call to LoadAndUnload.
+///
+class UsdPayloadPrefetcher
+{
+public:
+    USD_API
+    explicit UsdPayloadPrefetcher(const UsdStageWeakPtr &stage);
+
+    /// Waits for any outstanding prefetch tasks to complete.  Does not
+    /// load any prims; prefetched paths that were never committed are
+    /// discarded.
+    USD_API
+    ~UsdPayloadPrefetcher();
+
+    UsdPayloadPrefetcher(const UsdPayloadPrefetcher &) = delete;
+    UsdPayloadPrefetcher &operator=(const UsdPayloadPrefetcher &) = delete;
+
+    /// Enqueue \p primPath for payload prefetching.  Higher \p priority
+    /// entries are processed first.
+    USD_API
+    void Prefetch(const SdfPath &primPath, int priority = 0);
+
+    /// Enqueue all paths in \p primPaths with the same \p priority.
+    USD_API
+    void Prefetch(const SdfPathVector &primPaths, int priority = 0);
+
+    /// Block until all currently enqueued prefetch tasks have completed.
+    USD_API
+    void WaitForPrefetches();
+
+    /// Load every path whose prefetch has completed, in one
+    /// UsdStage::LoadAndUnload batch that produces a single ObjectsChanged
+    /// notice.  Returns the set of paths that were loaded.  Paths still
+    /// being prefetched remain queued for a later commit.
+    USD_API
+    SdfPathSet CommitLoads();
+
+private:
+    void _RunOne();
+
+    UsdStageWeakPtr _stage;
+    WorkDispatcher _dispatcher;
+
+    struct _Entry {
+        SdfPath path;
+        int priority;
+        bool operator<(const _Entry &rhs) const {
+            return priority < rhs.priority;
+        }
+    };
+
+    std::mutex _mutex;
+    std::priority_queue<_Entry> _queue;
+    SdfPathSet _readyPaths;
+
+    // Layers opened by prefetch tasks.  The layer registry only holds
+    // weak references, so these must be retained here until the
+    // corresponding loads are committed (at which point the stage holds
+    // them) or the prefetcher is destroyed.
+    SdfLayerRefPtrVector _retainedLayers;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // PXR_USD_USD_PAYLOAD_PREFETCHER_H
@@ -0,0 +1,150 @@
+//
+// Copyright 2026 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+#include "pxr/pxr.h"
+#include "pxr/usd/usd/payloadResidencyManager.h"
+#include "pxr/usd/usd/stage.h"
+
+#include "pxr/base/tf/diagnostic.h"
+#include "pxr/base/trace/trace.h"
+
+#include <algorithm>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+UsdPayloadResidencyManager::UsdPayloadResidencyManager(
+    const UsdStageWeakPtr &stage)
+    : _stage(stage)
+{
+}
+
+void
+UsdPayloadResidencyManager::SetBudget(size_t maxLoadedPrims)
+{
+    _budget = maxLoadedPrims;
+}
+
+void
+UsdPayloadResidencyManager::SetScoringFunction(ScoringFn fn)
+{
+    _scoringFn = std::move(fn);
+}
+
+void
+UsdPayloadResidencyManager::SetHysteresisFraction(double fraction)
+{
+    if (fraction < 0.0) {
+        TF_CODING_ERROR("Hysteresis fraction must be non-negative "
+                        "(got %f)", fraction);
+        return;
+    }
+    _hysteresisFraction = fraction;
+}
+
+void
+UsdPayloadResidencyManager::SetMaxOperationsPerUpdate(size_t maxOps)
+{
+    _maxOpsPerUpdate = maxOps;
+}
+
+std::pair<SdfPathSet, SdfPathSet>
+UsdPayloadResidencyManager::Update()
+{
+    TRACE_FUNCTION();
+
+    std::pair<SdfPathSet, SdfPathSet> result;
+    SdfPathSet &toLoad = result.first;
+    SdfPathSet &toUnload = result.second;
+
+    UsdStagePtr stage = _stage;
+    if (!stage || !_scoringFn) {
+        return result;
+    }
+
+    const SdfPathSet loadable = stage->FindLoadable();
+    if (loadable.empty()) {
+        return result;
+    }
+    const SdfPathSet loadSet = stage->GetLoadSet();
+
+    struct _Candidate {
+        SdfPath path;
+        double score;
+        bool isLoaded;
+    };
+    std::vector<_Candidate> candidates;
+    candidates.reserve(loadable.size());
+    for (const SdfPath &path : loadable) {
+        candidates.push_back(
+            { path, _scoringFn(path), loadSet.count(path) > 0 });
+    }
+
+    // Rank by descending score; break ties by path so that updates with
+    // identical scores are deterministic.
+    std::sort(candidates.begin(), candidates.end(),
+              [](const _Candidate &lhs, const _Candidate &rhs) {
+                  return lhs.score != rhs.score ?
+                      lhs.score > rhs.score : lhs.path < rhs.path;
+              });
+
+    // Prims ranked within the budget are loaded; loaded prims ranked
+    // within the hysteresis margin beyond the budget stay resident so
+    // that small score fluctuations at the boundary do not cause
+    // load/unload churn.
+    const size_t keepLimit =
+        _budget + size_t(double(_budget) * _hysteresisFraction);
+
+    // Collected worst-rank-first so that capped updates release the least
+    // important prims before anything else.
+    std::vector<SdfPath> unloadsByRank;
+    for (size_t rank = 0; rank != candidates.size(); ++rank) {
+        const _Candidate &candidate = candidates[rank];
+        if (rank < _budget) {
+            if (!candidate.isLoaded) {
+                toLoad.insert(candidate.path);
+            }
+        } else if (rank >= keepLimit && candidate.isLoaded) {
+            unloadsByRank.push_back(candidate.path);
+        }
+    }
+    std::reverse(unloadsByRank.begin(), unloadsByRank.end());
+
+    if (_maxOpsPerUpdate != 0) {
+        // Apply unloads before loads so a capped update never carries the
+        // working set above budget; skipped work converges over
+        // subsequent updates.
+        if (unloadsByRank.size() > _maxOpsPerUpdate) {
+            unloadsByRank.resize(_maxOpsPerUpdate);
+        }
+        const size_t loadAllowance = _maxOpsPerUpdate - unloadsByRank.size();
+        if (toLoad.size() > loadAllowance) {
+            // toLoad was gathered in rank order; keep the highest-ranked
+            // (i.e. first-gathered) entries.
+            SdfPathSet capped;
+            for (size_t rank = 0;
+                 rank != candidates.size() && capped.size() != loadAllowance;
+                 ++rank) {
+                if (toLoad.count(candidates[rank].path)) {
+                    capped.insert(candidates[rank].path);
+                }
+            }
+            toLoad.swap(capped);
+        }
+    }
+    toUnload.insert(unloadsByRank.begin(), unloadsByRank.end());
+
+    if (toLoad.empty() && toUnload.empty()) {
+        return result;
+    }
+
+    // One LoadAndUnload call per update yields a single coalesced
+    // ObjectsChanged notice and one recomposition for the whole batch.
+    stage->LoadAndUnload(toLoad, toUnload, UsdLoadWithDescendants);
+    return result;
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,104 @@
+//
+// Copyright 2026 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+#ifndef PXR_USD_USD_PAYLOAD_RESIDENCY_MANAGER_H
+#define PXR_USD_USD_PAYLOAD_RESIDENCY_MANAGER_H
+
+#include "pxr/pxr.h"
+#include "pxr/usd/usd/api.h"
+#include "pxr/usd/usd/common.h"
+#include "pxr/usd/sdf/path.h"
+
+#include <functional>
+#include <utility>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// \class UsdPayloadResidencyManager
+///
+/// Budget-driven working-set management for payloads on a UsdStage.
+///
+/// Clients with scenes too large to load in full (e.g. city-scale
+/// walkthroughs) register a budget -- the maximum number of loadable prims
+/// to keep loaded -- and a scoring function that ranks loadable prims by
+/// importance (typically proximity to the camera, supplied by the
+/// application).  Each call to Update() re-scores the stage's loadable
+/// prims and loads or unloads payloads so that the highest-scoring prims
+/// are resident, staying within budget.  All changes in an Update() are
+/// applied through a single UsdStage::LoadAndUnload call so listeners
+/// receive one coalesced ObjectsChanged notice and the stage recomposes
+/// once per batch.
+///
+/// To avoid thrashing when scores fluctuate near the budget boundary
+/// (e.g. as the camera pans), a hysteresis margin keeps already-loaded
+/// prims resident while their rank stays within the margin beyond the
+/// budget; only prims that fall clearly out of rank are unloaded, and
+/// only prims that rank strictly within budget are newly loaded.
+///
+/// The amount of load/unload work per Update() may additionally be capped
+/// with SetMaxOperationsPerUpdate() to spread recomposition cost across
+/// frames; the working set then converges toward the budgeted target over
+/// successive updates.
+///
+/// Update() mutates the stage's load rules and must be called from a
+/// thread that is allowed to mutate the stage, like any other call to
+/// LoadAndUnload.  The scoring function is invoked serially during
+/// Update() and must not itself mutate the stage.
+///
+class UsdPayloadResidencyManager
+{
+public:
+    /// Ranks the loadable prim at \p primPath; higher scores are more
+    /// important and are kept resident in preference to lower scores.
+    using ScoringFn = std::function<double (const SdfPath &primPath)>;
+
+    USD_API
+    explicit UsdPayloadResidencyManager(const UsdStageWeakPtr &stage);
+
+    /// Set the maximum number of loadable prims to keep loaded.  A budget
+    /// of 0 (the default) unloads all payloads on the next Update().
+    USD_API
+    void SetBudget(size_t maxLoadedPrims);
+
+    /// Return the current budget.
+    size_t GetBudget() const { return _budget; }
+
+    /// Set the scoring function used to rank loadable prims.  Update()
+    /// does nothing until a scoring function has been set.
+    USD_API
+    void SetScoringFunction(ScoringFn fn);
+
+    /// Set the hysteresis margin as a fraction of the budget.  An
+    /// already-loaded prim is kept resident while it ranks within
+    /// budget * (1 + \p fraction); the default is 0.25.  Pass 0 to make
+    /// residency track the budgeted ranking exactly.
+    USD_API
+    void SetHysteresisFraction(double fraction);
+
+    /// Cap the number of load plus unload operations performed by a
+    /// single Update() call.  0 (the default) means unlimited.
+    USD_API
+    void SetMaxOperationsPerUpdate(size_t maxOps);
+
+    /// Re-score the stage's loadable prims and apply the load/unload
+    /// delta required to bring the working set within budget, as a single
+    /// batched UsdStage::LoadAndUnload call.  Returns the paths that were
+    /// loaded and unloaded, respectively.  Does nothing and returns empty
+    /// sets if the stage has expired or no scoring function is set.
+    USD_API
+    std::pair<SdfPathSet, SdfPathSet> Update();
+
+private:
+    UsdStageWeakPtr _stage;
+    ScoringFn _scoringFn;
+    size_t _budget = 0;
+    double _hysteresisFraction = 0.25;
+    size_t _maxOpsPerUpdate = 0;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // PXR_USD_USD_PAYLOAD_RESIDENCY_MANAGER_H
@@ -18,9 +18,13 @@
 #include "pxr/usd/kind/registry.h"
 
 #include "pxr/base/tf/exception.h"
+#include "pxr/base/tf/mallocTag.h"
 #include "pxr/base/tf/stringUtils.h"
 
+#include <tbb/spin_mutex.h>
+
 #include <algorithm>
+#include <memory>
 #include <sstream>
 #include <vector>
 
@@ -31,6 +35,87 @@ PXR_NAMESPACE_OPEN_SCOPE
 static_assert(sizeof(Usd_PrimData) == 64,
               "Expected sizeof(Usd_PrimData) == 64");
 
+namespace {
+
+// Chunked fixed-size allocator backing Usd_PrimData::operator new.  Prim
+// data objects are small (see the static assertion above) and allocated in
+// large numbers when composing a stage; carving them out of big chunks cuts
+// per-object allocator overhead, and since children are instantiated
+// back-to-back during composition they typically land contiguously, which
+// helps traversal cache behavior.  Freed slots are recycled through a free
+// list.  The pool is process-wide and intentionally immortal: prim data
+// lifetimes extend past stage teardown while UsdObject handles remain, and
+// possibly into static destruction.
+class Usd_PrimDataPool
+{
+    static constexpr size_t SlotBytes = sizeof(Usd_PrimData);
+    static constexpr size_t SlotsPerChunk = 1024;
+    static constexpr size_t ChunkBytes = SlotBytes * SlotsPerChunk;
+
+public:
+    static Usd_PrimDataPool &GetInstance() {
+        static Usd_PrimDataPool *pool = new Usd_PrimDataPool;
+        return *pool;
+    }
+
+    void *Allocate() {
+        tbb::spin_mutex::scoped_lock lock(_mutex);
+        if (_freeList) {
+            void *result = _freeList;
+            _freeList = *static_cast<void **>(_freeList);
+            return result;
+        }
+        if (_next == _end) {
+            TfAutoMallocTag2 tag("Usd", "Usd_PrimData pool");
+            _chunks.push_back(std::unique_ptr<char[]>(new char[ChunkBytes]));
+            _next = _chunks.back().get();
+            _end = _next + ChunkBytes;
+        }
+        void *result = _next;
+        _next += SlotBytes;
+        return result;
+    }
+
+    void Deallocate(void *ptr) {
+        tbb::spin_mutex::scoped_lock lock(_mutex);
+        *static_cast<void **>(ptr) = _freeList;
+        _freeList = ptr;
+    }
+
+private:
+    Usd_PrimDataPool() = default;
+
+    tbb::spin_mutex _mutex;
+    std::vector<std::unique_ptr<char[]>> _chunks;
+    void *_freeList = nullptr;
+    char *_next = nullptr;
+    char *_end = nullptr;
+};
+
+} // anonymous namespace
+
+void *
+Usd_PrimData::operator new(size_t size)
+{
+    if (ARCH_UNLIKELY(size != sizeof(Usd_PrimData))) {
+        return ::operator new(size);
+    }
+    return Usd_PrimDataPool::GetInstance().Allocate();
+}
+
+void
+Usd_PrimData::operator delete(void *ptr, size_t size) noexcept
+{
+    if (!ptr) {
+        return;
+    }
+    if (ARCH_UNLIKELY(size != sizeof(Usd_PrimData))) {
+        ::operator delete(ptr);
+        return;
+    }
+    Usd_PrimDataPool::GetInstance().Deallocate(ptr);
+}
+
 // Usd_PrimData need to be always initialized with a valid type info pointer
 static const UsdPrimTypeInfo *_GetEmptyPrimTypeInfo() 
 {
@@ -248,6 +248,15 @@ private:
     USD_API
     ~Usd_PrimData();
 
+    // Usd_PrimData objects are carved out of a process-wide chunked pool
+    // (see primData.cpp) to cut per-prim allocator overhead and improve
+    // locality during traversal: children instantiated back-to-back during
+    // composition typically land contiguously in a chunk.
+    USD_API
+    static void *operator new(size_t size);
+    USD_API
+    static void operator delete(void *ptr, size_t size) noexcept;
+
     // Compute and store type info and cached flags.
     void _ComposeAndCacheFlags(
         Usd_PrimDataConstPtr parent, bool isPrototypePrim);
@@ -12,7 +12,13 @@
 #include "pxr/usd/usd/common.h"
 #include "pxr/usd/usd/prim.h"
 #include "pxr/usd/usd/primFlags.h"
+#include "pxr/base/tf/pyLock.h"
+#include "pxr/base/work/dispatcher.h"
+#include "pxr/base/work/withScopedParallelism.h"
 
+#include <tbb/enumerable_thread_specific.h>
+
+#include <utility>
 #include <vector>
 #include <iterator>
 
@@ -419,6 +425,95 @@ private:
     bool _postOrder;
 };
 
+/// Invokes \p visitor on every prim in the subtree rooted at \p root that
+/// passes \p predicate, traversing sibling subtrees in parallel.
+///
+/// The set of prims visited is the same as that of
+/// UsdPrimRange(root, predicate): prims that fail \p predicate are pruned
+/// along with their entire subtrees, and instance proxies are visited when
+/// \p predicate includes UsdTraverseInstanceProxies().  Unlike UsdPrimRange,
+/// no visitation order is guaranteed; sibling subtrees are split into tasks
+/// and executed by a work-stealing scheduler so that full-stage scans scale
+/// with the number of cores.
+///
+/// \p visitor must be callable as visitor(const UsdPrim &, ThreadState *).
+/// Each thread that participates in the traversal receives its own
+/// ThreadState copy-constructed from \p identity, so visitors may freely
+/// mutate their state without synchronization.  After the traversal
+/// completes, the per-thread states are combined serially by calling
+/// result = reducer(std::move(result), std::move(threadState)) for each
+/// state, starting with \p identity, and the combined result is returned.
+///
+/// Any errors raised by \p visitor are transported back to the calling
+/// thread.
+template <class ThreadState, class Visitor, class Reducer>
+ThreadState
+UsdTraverseInParallel(
+    const UsdPrim &root,
+    const Usd_PrimFlagsPredicate &predicate,
+    const ThreadState &identity,
+    const Visitor &visitor,
+    const Reducer &reducer)
+{
+    TF_PY_ALLOW_THREADS_IN_SCOPE();
+
+    // UsdPrimRange prunes the entire traversal when the root itself fails
+    // the predicate.
+    if (!root || UsdPrimRange(root, predicate).empty()) {
+        return identity;
+    }
+
+    tbb::enumerable_thread_specific<ThreadState> threadStates(identity);
+
+    WorkWithScopedParallelism([&]() {
+        WorkDispatcher dispatcher;
+        // Visits a prim and its filtered subtree, descending into the first
+        // child inline and splitting the remaining sibling subtrees into
+        // tasks that the scheduler can steal.
+        auto visitSubtree = [&](UsdPrim prim, auto const &self) -> void {
+            while (true) {
+                visitor(prim, &threadStates.local());
+                auto children = prim.GetFilteredChildren(predicate);
+                auto childIt = children.begin();
+                if (childIt == children.end()) {
+                    return;
+                }
+                UsdPrim firstChild = *childIt;
+                for (++childIt; childIt != children.end(); ++childIt) {
+                    dispatcher.Run(
+                        [&self, child = *childIt]() { self(child, self); });
+                }
+                prim = std::move(firstChild);
+            }
+        };
+        visitSubtree(root, visitSubtree);
+        dispatcher.Wait();
+    });
+
+    ThreadState result = identity;
+    for (ThreadState &threadState : threadStates) {
+        result = reducer(std::move(result), std::move(threadState));
+    }
+    return result;
+}
+
+/// \overload
+///
+/// This simpler form takes no per-thread state; \p visitor must be callable
+/// as visitor(const UsdPrim &) and must be safe to invoke concurrently from
+/// multiple threads.
+template <class Visitor>
+void
+UsdTraverseInParallel(
+    const UsdPrim &root,
+    const Usd_PrimFlagsPredicate &predicate,
+    const Visitor &visitor)
+{
+    UsdTraverseInParallel<int>(
+        root, predicate, 0,
+        [&visitor](const UsdPrim &prim, int *) { visitor(prim); },
+        [](int, int) { return 0; });
+}
 
 PXR_NAMESPACE_CLOSE_SCOPE
 
@@ -24,11 +24,14 @@
 #include "pxr/usd/sdf/relationshipSpec.h"
 #include "pxr/usd/sdf/schema.h"
 
+#include "pxr/base/arch/fileSystem.h"
 #include "pxr/base/tf/envSetting.h"
 #include "pxr/base/tf/fileUtils.h"
+#include "pxr/base/tf/hash.h"
 #include "pxr/base/tf/instantiateSingleton.h"
 #include "pxr/base/tf/pyLock.h"
 #include "pxr/base/tf/registryManager.h"
+#include "pxr/base/tf/stringUtils.h"
 #include "pxr/base/tf/token.h"
 #include "pxr/base/tf/type.h"
 #include "pxr/base/work/loops.h"
@@ -58,6 +61,14 @@ TF_DEFINE_ENV_SETTING(
     USD_DISABLE_AUTO_APPLY_API_SCHEMAS, false,
     "Set to true to disable the application of all auto-apply API schemas.");
 
+TF_DEFINE_ENV_SETTING(
+    USD_SCHEMA_CACHE_DIR, "",
+    "If set to a writable directory, each plugin's generatedSchema.usda is "
+    "cached there in binary (usdc) form and the cached copy is read on "
+    "subsequent runs in place of parsing the text file. Cache entries are "
+    "keyed by the source file's path, size, and modification time, so stale "
+    "entries are ignored and regenerated automatically.");
+
 TF_INSTANTIATE_SINGLETON(UsdSchemaRegistry);
 
 TF_DEFINE_PRIVATE_TOKENS(
@@ -746,14 +757,65 @@ UsdSchemaRegistry::IsMultipleApplyNameTemplate(
     return _FindInstanceNamePlaceholder(nameTemplate) != std::string::npos;
 }
 
+// Returns the path at which a binary cache of the generated schema at
+// \p fname may be stored, or the empty string if schema caching is
+// disabled. The path incorporates a hash of the source file's identity
+// and timestamp so that an out-of-date cache entry is simply never found.
+static string
+_GetGeneratedSchemaCachePath(const string &fname)
+{
+    static const string cacheDir = TfGetEnvSetting(USD_SCHEMA_CACHE_DIR);
+    if (cacheDir.empty()) {
+        return string();
+    }
+
+    double mtime = 0.0;
+    if (!ArchGetModificationTime(fname.c_str(), &mtime)) {
+        return string();
+    }
+    const int64_t length = ArchGetFileLength(fname.c_str());
+    if (length < 0) {
+        return string();
+    }
+
+    return TfStringCatPaths(
+        cacheDir,
+        TfStringPrintf("%zx.usdc",
+                       TfHash::Combine(fname, mtime, length)));
+}
+
 static SdfLayerRefPtr
 _GetGeneratedSchema(const PlugPluginPtr &plugin)
 {
     // Look for generatedSchema in Resources.
     const string fname = TfStringCatPaths(plugin->GetResourcePath(),
                                           "generatedSchema.usda");
+
+    // If schema caching is enabled, prefer a previously cached binary copy
+    // of the generated schema; opening a crate file avoids parsing the
+    // text file on every process startup.
+    const string cachePath = _GetGeneratedSchemaCachePath(fname);
+    if (!cachePath.empty() && TfPathExists(cachePath)) {
+        if (SdfLayerRefPtr cached = SdfLayer::OpenAsAnonymous(cachePath)) {
+            TF_DEBUG(USD_SCHEMA_REGISTRATION).Msg(
+                "Read cached generated schema for plugin %s from %s.\n",
+                plugin->GetName().c_str(), cachePath.c_str());
+            return cached;
+        }
+        // An unreadable cache entry (e.g. a torn write from a concurrent
+        // process) is treated as a miss and overwritten below.
+    }
+
     SdfLayerRefPtr layer = SdfLayer::OpenAsAnonymous(fname);
 
+    if (layer && !cachePath.empty()) {
+        static const string cacheDir =
+            TfGetEnvSetting(USD_SCHEMA_CACHE_DIR);
+        if (TfMakeDirs(cacheDir, -1, /*existOk=*/true)) {
+            layer->Export(cachePath);
+        }
+    }
+
     TF_DEBUG(USD_SCHEMA_REGISTRATION).Msg(
        "Looking up generated schema for plugin %s at path %s. "
        "Generated schema %s.\n",
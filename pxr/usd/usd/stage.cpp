@@ -41,6 +41,7 @@
 
 #include "pxr/usd/sdf/attributeSpec.h"
 #include "pxr/usd/sdf/changeBlock.h"
+#include "pxr/usd/sdf/copyUtils.h"
 #include "pxr/usd/sdf/layerUtils.h"
 #include "pxr/usd/sdf/primSpec.h"
 #include "pxr/usd/sdf/relationshipSpec.h"
@@ -59,7 +60,9 @@
 #include "pxr/base/gf/multiInterval.h"
 
 #include "pxr/base/arch/demangle.h"
+#include "pxr/base/arch/fileSystem.h"
 #include "pxr/base/arch/pragmas.h"
+#include "pxr/base/arch/timing.h"
 
 #include "pxr/base/plug/plugin.h"
 #include "pxr/base/plug/registry.h"
@@ -75,8 +78,10 @@
 #include "pxr/base/tf/span.h"
 #include "pxr/base/tf/stl.h"
 #include "pxr/base/tf/stringUtils.h"
+#include "pxr/base/vt/dictionary.h"
 #include "pxr/base/work/dispatcher.h"
 #include "pxr/base/work/loops.h"
+#include "pxr/base/work/threadLimits.h"
 #include "pxr/base/work/utils.h"
 #include "pxr/base/work/withScopedParallelism.h"
 
@@ -84,10 +89,13 @@
 #include <tbb/spin_mutex.h>
 
 #include <algorithm>
+#include <deque>
 #include <functional>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <set>
 #include <string>
 #include <utility>
 #include <vector>
@@ -100,6 +108,19 @@ using std::map;
 using std::string;
 using std::vector;
 
+TF_DEFINE_ENV_SETTING(
+    USD_RECORD_COMPOSITION_STATS, false,
+    "Record per-prim composition statistics (time, arc and layer counts) "
+    "on every UsdStage; query them with "
+    "UsdStage::GetMostExpensiveCompositionSubtrees().");
+
+TF_DEFINE_ENV_SETTING(
+    USD_BYPASS_PCP_ANALYSIS_FOR_VALUE_CHANGES, true,
+    "Skip Pcp dependency analysis when a round of layer changes consists "
+    "entirely of property value edits, which cannot affect composition "
+    "structure. Set to false to restore the previous behavior of always "
+    "running the analysis.");
+
 // ------------------------------------------------------------------------- //
 // UsdStage Helpers
 // ------------------------------------------------------------------------- //
@@ -376,6 +397,76 @@ public:
     PathsToChangesMap primTypeInfoChanges, assetPathResyncChanges;
 };
 
+// Defined later in this file; used by _NoticeBatch::Merge.
+template <class ChangedPaths>
+static void _RemoveDescendentEntries(ChangedPaths *changedPaths);
+template <class ChangedPaths>
+static void _MergeAndRemoveDescendentEntries(ChangedPaths *stronger,
+                                             ChangedPaths *weaker);
+
+// Accumulated change notification state for a notice batch; see
+// UsdStage::BeginNoticeBatching.
+class UsdStage::_NoticeBatch
+{
+public:
+    using PathsToChangesMap = UsdNotice::ObjectsChanged::_PathsToChangesMap;
+
+    int depth = 0;
+
+    PathsToChangesMap resyncChanges, infoChanges, assetPathChanges;
+
+    // Merge one round of change processing into the batch.  The entries
+    // referenced by the incoming maps point into change lists that do not
+    // outlive the round, so they are copied into storage owned by the
+    // batch before being recorded.
+    void Merge(PathsToChangesMap *resyncs,
+               PathsToChangesMap *infos,
+               PathsToChangesMap *assetPaths)
+    {
+        _CopyEntries(resyncs);
+        _CopyEntries(infos);
+        _CopyEntries(assetPaths);
+
+        _MergeInto(&resyncChanges, resyncs);
+        _MergeInto(&infoChanges, infos);
+        _MergeInto(&assetPathChanges, assetPaths);
+
+        // Resyncs subsume changes to descendant objects recorded in any
+        // earlier or later round.
+        _RemoveDescendentEntries(&resyncChanges);
+        _MergeAndRemoveDescendentEntries(&resyncChanges, &infoChanges);
+        _MergeAndRemoveDescendentEntries(&resyncChanges, &assetPathChanges);
+    }
+
+private:
+    void _CopyEntries(PathsToChangesMap *changes)
+    {
+        for (auto &entry : *changes) {
+            for (const SdfChangeList::Entry *&changeEntry : entry.second) {
+                _entries.push_back(*changeEntry);
+                changeEntry = &_entries.back();
+            }
+        }
+    }
+
+    static void _MergeInto(PathsToChangesMap *batched,
+                           PathsToChangesMap *incoming)
+    {
+        if (batched->empty()) {
+            batched->swap(*incoming);
+            return;
+        }
+        for (auto &entry : *incoming) {
+            auto &batchedEntries = (*batched)[entry.first];
+            batchedEntries.insert(batchedEntries.end(),
+                                  entry.second.begin(), entry.second.end());
+        }
+    }
+
+    // Deque for pointer stability of copied entries.
+    std::deque<SdfChangeList::Entry> _entries;
+};
+
 // Object containing information used when resolving an asset path value.
 class Usd_AssetPathContext
 {
@@ -661,6 +752,8 @@ UsdStage::UsdStage(const SdfLayerRefPtr& rootLayer,
     , _interpolationType(UsdInterpolationTypeLinear)
     , _lastChangeSerialNumber(0)
     , _pendingChanges(nullptr)
+    , _recordCompositionStats(
+        TfGetEnvSetting(USD_RECORD_COMPOSITION_STATS))
     , _initialLoadSet(load)
     , _populationMask(mask)
     , _isClosingStage(false)
@@ -867,6 +960,12 @@ UsdStage::_InstantiateStage(const SdfLayerRefPtr &rootLayer,
     stage->_ComposeSubtreesInParallel(
         subtreesToCompose, &primIndexPathsForSubtrees);
 
+    // If requested, open all clip layers now, in parallel, rather than
+    // serially on first value resolution during playback.
+    if (Usd_ClipCache::IsPreOpeningClipLayersEnabled()) {
+        stage->_clipCache->OpenClipLayers();
+    }
+
     stage->_RegisterPerLayerNotices();
     stage->_RegisterResolverChangeNotice();
 
@@ -1167,6 +1266,9 @@ public:
             UsdStagePopulationMask::All(),
             _initialLoadSet);
     }
+    virtual SdfLayerHandle GetRootLayer() const {
+        return _rootLayer;
+    }
 
 private:
     SdfLayerHandle _rootLayer;
@@ -2523,15 +2625,11 @@ UsdStage::LoadAndUnload(const SdfPathSet &loadSet,
     UsdNotice::ObjectsChanged::_PathsToChangesMap resyncChanges;
     _Recompose(changes, &resyncChanges);
 
-    UsdStageWeakPtr self(this);
-
     for (SdfPath const &p: recomposePaths) {
         resyncChanges[p];
     }
 
-    UsdNotice::ObjectsChanged(self, &resyncChanges).Send(self);
-
-    UsdNotice::StageContentsChanged(self).Send(self);
+    _SendObjectsChanged(&resyncChanges);
 }
 
 SdfPathSet
@@ -2585,11 +2683,9 @@ UsdStage::SetLoadRules(UsdStageLoadRules const &rules)
     _Recompose(changes);
 
     // Notify.
-    UsdStageWeakPtr self(this);
     UsdNotice::ObjectsChanged::_PathsToChangesMap resyncChanges;
     resyncChanges[SdfPath::AbsoluteRootPath()];
-    UsdNotice::ObjectsChanged(self, &resyncChanges).Send(self);
-    UsdNotice::StageContentsChanged(self).Send(self);
+    _SendObjectsChanged(&resyncChanges);
 }
 
 void
@@ -2603,11 +2699,9 @@ UsdStage::SetPopulationMask(UsdStagePopulationMask const &mask)
     _Recompose(changes);
 
     // Notify.
-    UsdStageWeakPtr self(this);
     UsdNotice::ObjectsChanged::_PathsToChangesMap resyncChanges;
     resyncChanges[SdfPath::AbsoluteRootPath()];
-    UsdNotice::ObjectsChanged(self, &resyncChanges).Send(self);
-    UsdNotice::StageContentsChanged(self).Send(self);
+    _SendObjectsChanged(&resyncChanges);
 }
 
 void
@@ -2683,11 +2777,17 @@ UsdStage::GetPrototypes() const
         if (TF_VERIFY(p, "Failed to find prim at prototype path <%s>.\n",
                       path.GetText())) {
             prototypePrims.push_back(p);
-        }                   
+        }
     }
     return prototypePrims;
 }
 
+std::string
+UsdStage::GetPrototypeSharingDiagnostics() const
+{
+    return _instanceCache->GetPrototypeSharingDiagnostics();
+}
+
 vector<UsdPrim>
 UsdStage::_GetInstancesForPrototype(const UsdPrim& prototypePrim) const
 {
@@ -3298,7 +3398,10 @@ UsdStage::_ComposeSubtreeImpl(
 {
     TfAutoMallocTag tag("Usd", _GetMallocTagId());
 
-    const SdfPath primIndexPath = 
+    ArchIntervalTimer statsTimer(
+        /* start = */ ARCH_UNLIKELY(_recordCompositionStats));
+
+    const SdfPath primIndexPath =
         (inPrimIndexPath.IsEmpty() ? prim->GetPath() : inPrimIndexPath);
 
     // Find the prim's PcpPrimIndex. This should have already been
@@ -3350,6 +3453,13 @@ UsdStage::_ComposeSubtreeImpl(
         }
     }
 
+    // Record before recursing so the entry reflects only this prim's
+    // cost; subtree totals are aggregated at query time.
+    if (ARCH_UNLIKELY(_recordCompositionStats)) {
+        _RecordCompositionStats(
+            prim, ArchTicksToNanoseconds(statsTimer.GetElapsedTicks()));
+    }
+
     // Compose the set of children on this prim.
     _ComposeChildren(prim, mask, /*recurse=*/true);
 }
@@ -3993,11 +4103,7 @@ UsdStage::MuteAndUnmuteLayers(const std::vector<std::string> &muteLayers,
 
     {
         TRACE_FUNCTION_SCOPE("sending UsdNotice::ObjectsChanged");
-        UsdNotice::ObjectsChanged(self, &resyncChanges).Send(self);
-    }
-    {
-        TRACE_FUNCTION_SCOPE("sending UsdNotice::StageContentsChanged");
-        UsdNotice::StageContentsChanged(self).Send(self);
+        _SendObjectsChanged(&resyncChanges);
     }
 }
 
@@ -4252,6 +4358,54 @@ _MergeAndRemoveDescendentEntries(ChangedPaths *stronger, ChangedPaths *weaker)
     }
 }
 
+// Returns true if the changelist entry at \p sdfPath can only affect
+// resolved property values, not composition structure. Pcp (in USD mode)
+// ignores property value changes except where an attribute may be an input
+// to a dynamic file format's arguments, so when an entire round of changes
+// is made up of such entries the Pcp dependency analysis can be skipped
+// and only value-dirty notices need to be delivered. This is the common
+// case for session layer opinion toggles (visibility, draw mode) authored
+// by viewers.
+static bool
+_IsPureValueChange(const PcpCache &cache,
+                   const SdfPath &sdfPath,
+                   const SdfChangeList::Entry &entry)
+{
+    if (!sdfPath.IsPrimPropertyPath()) {
+        return false;
+    }
+
+    const auto &flags = entry.flags;
+    if (flags.didAddProperty ||
+        flags.didAddPropertyWithOnlyRequiredFields ||
+        flags.didRemoveProperty ||
+        flags.didRemovePropertyWithOnlyRequiredFields ||
+        flags.didRename ||
+        flags.didChangeAttributeConnection ||
+        flags.didChangeRelationshipTargets ||
+        flags.didAddTarget ||
+        flags.didRemoveTarget) {
+        return false;
+    }
+
+    for (const auto& info : entry.infoChanged) {
+        if (info.first != SdfFieldKeys->Default &&
+            info.first != SdfFieldKeys->TimeSamples) {
+            return false;
+        }
+    }
+
+    // A default value change on an attribute that is a potential input to a
+    // dynamic file format's arguments may invalidate payloads, so it must
+    // still go through full dependency analysis.
+    if (cache.IsPossibleDynamicFileFormatArgumentAttribute(
+            sdfPath.GetNameToken())) {
+        return false;
+    }
+
+    return true;
+}
+
 void
 UsdStage::_HandleLayersDidChange(
     const SdfNotice::LayersDidChangeSentPerLayer &n)
@@ -4301,6 +4455,11 @@ UsdStage::_HandleLayersDidChange(
 
     SdfPathVector changedActivePaths;
 
+    // Track whether every change in this round is a pure property value
+    // change; if so, Pcp dependency analysis below can be skipped.
+    bool allChangesAreValueOnly =
+        TfGetEnvSetting(USD_BYPASS_PCP_ANALYSIS_FOR_VALUE_CHANGES);
+
     // A fallback prim types change occurs when the fallbackPrimTypes metadata
     // changes on the root or session layer. 
     // Note that we never process these changes while writing the schema 
@@ -4343,6 +4502,9 @@ UsdStage::_HandleLayersDidChange(
             const SdfPath &sdfPath = entryList.first;
             const SdfChangeList::Entry &entry = entryList.second;
 
+            allChangesAreValueOnly = allChangesAreValueOnly &&
+                _IsPureValueChange(*_cache, sdfPath, entry);
+
             // Skip target paths entirely -- we do not create target objects in
             // USD.
             if (sdfPath.IsTargetPath())
@@ -4439,9 +4601,21 @@ UsdStage::_HandleLayersDidChange(
     // changedActivePaths.  Push changes through Pcp to determine further
     // invalidation based on composition metadata (reference, inherits, variant
     // selections, etc).
+    //
+    // If every change in this round was a pure property value change, the
+    // analysis cannot produce any prim index invalidation, so skip it and
+    // deliver only the value-dirty notices collected above. This keeps
+    // e.g. session layer visibility toggles from paying for a full
+    // dependency walk.
     PcpChanges& changes = _pendingChanges->pcpChanges;
     const PcpCache *cache = _cache.get();
-    changes.DidChange(cache, n.GetChangeListVec());
+    if (allChangesAreValueOnly) {
+        TF_DEBUG(USD_CHANGES).Msg(
+            "All changes are pure value changes; skipping Pcp dependency "
+            "analysis\n");
+    } else {
+        changes.DidChange(cache, n.GetChangeListVec());
+    }
 
     // Pcp does not consider activation changes to be significant since
     // it doesn't look at activation during composition. However, UsdStage
@@ -4618,19 +4792,267 @@ UsdStage::_ProcessPendingChanges()
     // alive, so the references we took above are still valid.
     _pendingChanges = nullptr;
 
-    if (!recomposeChanges.empty() 
+    if (!recomposeChanges.empty()
         || !otherInfoChanges.empty()
         || !assetPathResyncChanges.empty()) {
-        UsdStageWeakPtr self(this);
+        // Notify about changed objects, or accumulate into the current
+        // notice batch.
+        _SendObjectsChanged(
+            &recomposeChanges, &otherInfoChanges, &assetPathResyncChanges);
+    }
+}
 
-        // Notify about changed objects.
-        UsdNotice::ObjectsChanged(
-            self, &recomposeChanges, &otherInfoChanges, &assetPathResyncChanges)
-            .Send(self);
+template <class PathsToChangesMap>
+void
+UsdStage::_SendObjectsChanged(PathsToChangesMap *resyncChanges,
+                              PathsToChangesMap *infoChanges,
+                              PathsToChangesMap *assetPathChanges)
+{
+    if (_noticeBatch) {
+        _noticeBatch->Merge(resyncChanges, infoChanges, assetPathChanges);
+        return;
+    }
+
+    UsdStageWeakPtr self(this);
+
+    // Notify about changed objects.
+    UsdNotice::ObjectsChanged(
+        self, resyncChanges, infoChanges, assetPathChanges).Send(self);
+
+    // Receivers can now refresh their caches... or just dirty them
+    UsdNotice::StageContentsChanged(self).Send(self);
+}
+
+template <class PathsToChangesMap>
+void
+UsdStage::_SendObjectsChanged(PathsToChangesMap *resyncChanges)
+{
+    PathsToChangesMap infoChanges, assetPathChanges;
+    _SendObjectsChanged(resyncChanges, &infoChanges, &assetPathChanges);
+}
+
+void
+UsdStage::BeginNoticeBatching()
+{
+    if (!_noticeBatch) {
+        _noticeBatch = std::make_unique<_NoticeBatch>();
+    }
+    ++_noticeBatch->depth;
+}
+
+void
+UsdStage::EndNoticeBatching()
+{
+    if (!TF_VERIFY(_noticeBatch && _noticeBatch->depth > 0,
+                   "EndNoticeBatching() called without a matching "
+                   "BeginNoticeBatching()")) {
+        return;
+    }
+    if (--_noticeBatch->depth > 0) {
+        return;
+    }
+
+    // Take the batch off the stage before sending so that listeners that
+    // make further edits in response get normal (or freshly batched)
+    // delivery rather than appending to a batch that has already flushed.
+    std::unique_ptr<_NoticeBatch> batch = std::move(_noticeBatch);
+    if (batch->resyncChanges.empty()
+        && batch->infoChanges.empty()
+        && batch->assetPathChanges.empty()) {
+        return;
+    }
+
+    UsdStageWeakPtr self(this);
+    UsdNotice::ObjectsChanged(
+        self, &batch->resyncChanges, &batch->infoChanges,
+        &batch->assetPathChanges).Send(self);
+    UsdNotice::StageContentsChanged(self).Send(self);
+}
+
+bool
+UsdStage::IsBatchingNotices() const
+{
+    return static_cast<bool>(_noticeBatch);
+}
+
+bool
+UsdStage::IsRecordingCompositionStats() const
+{
+    return _recordCompositionStats;
+}
 
-        // Receivers can now refresh their caches... or just dirty them
-        UsdNotice::StageContentsChanged(self).Send(self);
+void
+UsdStage::_RecordCompositionStats(
+    Usd_PrimDataConstPtr prim, uint64_t timeNanos)
+{
+    UsdCompositionStats stats;
+    stats.primPath = prim->GetPath();
+    stats.timeNanos = timeNanos;
+
+    // Prim indexes for prims in the same layer stack share layer stack
+    // objects, so sum layer counts over the distinct stacks only.
+    std::set<const PcpLayerStack *> layerStacks;
+    for (const PcpNodeRef &node : prim->GetPrimIndex().GetNodeRange()) {
+        if (!node.IsRootNode()) {
+            ++stats.numCompositionArcs;
+        }
+        if (const PcpLayerStackRefPtr &layerStack = node.GetLayerStack()) {
+            if (layerStacks.insert(get_pointer(layerStack)).second) {
+                stats.numContributingLayers +=
+                    layerStack->GetLayers().size();
+            }
+        }
+    }
+
+    _compositionStats.push_back(std::move(stats));
+}
+
+UsdCompositionStatsVector
+UsdStage::GetMostExpensiveCompositionSubtrees(size_t maxResults) const
+{
+    // Later entries supersede earlier ones for the same path, so that a
+    // recomposed prim is counted once with its latest cost.
+    std::map<SdfPath, UsdCompositionStats> latest;
+    for (const UsdCompositionStats &stats : _compositionStats) {
+        latest[stats.primPath] = stats;
+    }
+
+    // Accumulate each prim's cost into all of its ancestors to obtain
+    // subtree-inclusive totals.
+    std::map<SdfPath, UsdCompositionStats> subtrees = latest;
+    for (const auto &entry : latest) {
+        for (SdfPath path = entry.first.GetParentPath();
+             !path.IsEmpty(); path = path.GetParentPath()) {
+            UsdCompositionStats &stats = subtrees[path];
+            stats.primPath = path;
+            stats.timeNanos += entry.second.timeNanos;
+            stats.numCompositionArcs += entry.second.numCompositionArcs;
+            stats.numContributingLayers +=
+                entry.second.numContributingLayers;
+        }
+    }
+    // The pseudo-root's total spans the whole stage and would always win.
+    subtrees.erase(SdfPath::AbsoluteRootPath());
+
+    UsdCompositionStatsVector sorted;
+    sorted.reserve(subtrees.size());
+    for (auto &entry : subtrees) {
+        sorted.push_back(std::move(entry.second));
+    }
+    std::sort(sorted.begin(), sorted.end(),
+              [](const UsdCompositionStats &lhs,
+                 const UsdCompositionStats &rhs) {
+                  return lhs.timeNanos > rhs.timeNanos;
+              });
+
+    // Report only the roots of expensive subtrees; descendants of a
+    // reported subtree are already covered by its totals.
+    UsdCompositionStatsVector result;
+    for (UsdCompositionStats &stats : sorted) {
+        if (result.size() >= maxResults) {
+            break;
+        }
+        const bool coveredByResult =
+            std::any_of(result.begin(), result.end(),
+                        [&stats](const UsdCompositionStats &picked) {
+                            return stats.primPath.HasPrefix(picked.primPath);
+                        });
+        if (!coveredByResult) {
+            result.push_back(std::move(stats));
+        }
+    }
+    return result;
+}
+
+// Sum the bytes of every call tree subtree tagged with \p siteName.
+static size_t
+_SumMallocTagSubtrees(TfMallocTag::CallTree::PathNode const &node,
+                     std::string const &siteName)
+{
+    if (node.siteName == siteName) {
+        return node.nBytes;
+    }
+    size_t bytes = 0;
+    for (TfMallocTag::CallTree::PathNode const &child : node.children) {
+        bytes += _SumMallocTagSubtrees(child, siteName);
+    }
+    return bytes;
+}
+
+VtDictionary
+UsdStage::GetMemoryReport() const
+{
+    TRACE_FUNCTION();
+
+    VtDictionary report;
+
+    const uint64_t numPrims = _primMap.size();
+
+    VtDictionary counters;
+    counters["numPrims"] = numPrims;
+    counters["numPrototypes"] =
+        uint64_t(_instanceCache->GetNumPrototypes());
+    counters["estimatedPrimDataBytes"] =
+        numPrims * uint64_t(sizeof(Usd_PrimData));
+
+    // Count the prims beneath each root-level subtree for per-subtree
+    // attribution.
+    std::map<SdfPath, uint64_t> subtreeCounts;
+    for (const auto &entry : _primMap) {
+        SdfPath path = entry.first;
+        if (path == SdfPath::AbsoluteRootPath()) {
+            continue;
+        }
+        while (path.GetPathElementCount() > 1) {
+            path = path.GetParentPath();
+        }
+        ++subtreeCounts[path];
+    }
+    VtDictionary subtrees;
+    for (const auto &entry : subtreeCounts) {
+        VtDictionary subtree;
+        subtree["numPrims"] = entry.second;
+        subtree["estimatedPrimDataBytes"] =
+            entry.second * uint64_t(sizeof(Usd_PrimData));
+        subtrees[entry.first.GetString()] = subtree;
+    }
+    report["subtrees"] = subtrees;
+
+    // Report the on-disk size of each used layer; heap use of layer data
+    // is only attributable in aggregate, via the malloc tags below.
+    const SdfLayerHandleVector usedLayers = GetUsedLayers();
+    counters["numUsedLayers"] = uint64_t(usedLayers.size());
+    VtDictionary layers;
+    for (const SdfLayerHandle &layer : usedLayers) {
+        const std::string realPath = layer->GetRealPath();
+        const int64_t fileSize =
+            realPath.empty() ? 0 : ArchGetFileLength(realPath.c_str());
+        layers[layer->GetIdentifier()] =
+            uint64_t(fileSize > 0 ? fileSize : 0);
+    }
+    report["layers"] = layers;
+    report["counters"] = counters;
+
+    VtDictionary mallocTags;
+    const bool tagsInitialized = TfMallocTag::IsInitialized();
+    mallocTags["initialized"] = tagsInitialized;
+    if (tagsInitialized) {
+        TfMallocTag::CallTree tree;
+        if (TfMallocTag::GetCallTree(&tree)) {
+            mallocTags["totalBytes"] = uint64_t(tree.root.nBytes);
+            mallocTags["stageBytes"] = uint64_t(
+                _SumMallocTagSubtrees(tree.root, _GetMallocTagId()));
+            VtDictionary subsystems;
+            for (TfMallocTag::CallTree::PathNode const &child :
+                     tree.root.children) {
+                subsystems[child.siteName] = uint64_t(child.nBytes);
+            }
+            mallocTags["subsystems"] = subsystems;
+        }
     }
+    report["mallocTags"] = mallocTags;
+
+    return report;
 }
 
 void
@@ -4740,6 +5162,16 @@ UsdStage::_Recompose(const PcpChanges &changes,
             TF_DEBUG(USD_CHANGES).Msg("Did Change Prim: %s\n", path.GetText());
         }
 
+        // These paths have changed prim stacks but their prim indexes have
+        // been patched in place rather than rebuilt; we still must
+        // recompose the subtrees to pick up changed opinions and any
+        // namespace children that appeared or disappeared.
+        for (const auto& path : ourChanges.didChangeSpecsAndChildren) {
+            (*pathsToRecompose)[path];
+            TF_DEBUG(USD_CHANGES).Msg("Did Change Specs And Children: %s\n",
+                                      path.GetText());
+        }
+
     } else {
         TF_DEBUG(USD_CHANGES).Msg("No cache changes\n");
     }
@@ -4869,9 +5301,6 @@ UsdStage::_RecomposePrims(T *pathsToRecompose)
         _RemoveDescendentEntries(pathsToRecompose);
     }
 
-    // XXX: If the call chain here ever starts composing prims in parallel,
-    // we'll have to add a Usd_ClipCache::ConcurrentPopulationContext object
-    // around this.
     std::vector<Usd_PrimDataPtr> subtreesToRecompose;
     _ComputeSubtreesToRecompose(
         pathsToRecompose->begin(), pathsToRecompose->end(),
@@ -4903,17 +5332,27 @@ UsdStage::_RecomposePrims(T *pathsToRecompose)
 
 
 template <class Iter>
-void 
+void
 UsdStage::_ComputeSubtreesToRecompose(
     Iter i, Iter end,
     std::vector<Usd_PrimDataPtr>* subtreesToRecompose)
 {
-    // XXX: If this function ever winds up composing prims in parallel, callers
-    // will have to ensure that a Usd_ClipCache::ConcurrentPopulationContext
-    // object is alive during the call.
-    
-    subtreesToRecompose->reserve(
-        subtreesToRecompose->size() + std::distance(i, end));
+    // Scan the input range and partition it into independent work items:
+    // individual prototype prims, and runs of siblings that share a parent.
+    // Since our input range contains no descendant paths, siblings must
+    // appear consecutively; we process all siblings that have changed
+    // together in order to only recompose the parent's list of children
+    // once.  Work items touch disjoint parents, so the expensive work for
+    // each -- recomposing the parent's list of children and looking up or
+    // instantiating prims -- is dispatched across threads below.
+    struct _WorkItem {
+        // Empty for prototype prims, which are parented beneath the
+        // pseudo-root but are not children of it.
+        SdfPath parentPath;
+        SdfPathVector paths;
+    };
+    std::vector<_WorkItem> workItems;
+    bool foundPseudoRoot = false;
 
     while (i != end) {
         TF_DEBUG(USD_CHANGES).Msg("Recomposing: %s\n", i->first.GetText());
@@ -4928,65 +5367,111 @@ UsdStage::_ComputeSubtreesToRecompose(
             continue;
         }
 
-        // Add prototypes to list of subtrees to recompose and instantiate any 
-        // new prototype not present in the primMap from before
-        PathToNodeMap::const_accessor acc;
         if (_instanceCache->IsPrototypePath(i->first)) {
-            Usd_PrimDataPtr prototypePrim;
-            if (_primMap.find(acc, i->first)) {
-                // should be a changed prototype if already in the primMap
-                prototypePrim = acc->second.get();
-                acc.release();
-            } else {
-                // newPrototype should be absent from the primMap, instantiate
-                // these now to be added to subtreesToRecompose
-                prototypePrim = _InstantiatePrototypePrim(i->first);
-            }
-            subtreesToRecompose->push_back(prototypePrim);
+            workItems.push_back({ SdfPath(), { i->first } });
             ++i;
             continue;
         }
 
-        // Collect all non-prototype prims (including descendants of prototypes)
-        // to be added to subtreesToRecompute
         SdfPath const &parentPath = i->first.GetParentPath();
-        if (_primMap.find(acc, parentPath)) {
-
-            // Since our input range contains no descendant paths, siblings
-            // must appear consecutively.  We want to process all siblings that
-            // have changed together in order to only recompose the parent's
-            // list of children once.  We scan forward while the paths share a
-            // parent to find the range of siblings.
-
-            // Recompose parent's list of children.
-            auto parent = acc->second.get();
-            acc.release();
-            _ComposeChildren(
-                parent, parent->IsInPrototype() ? nullptr : &_populationMask,
-                /*recurse=*/false);
-
-            // Recompose the subtree for each affected sibling.
-            do {
-                if (_primMap.find(acc, i->first)) {
-                    subtreesToRecompose->push_back(acc->second.get());
-                    acc.release();
-                } else if (_instanceCache->IsPrototypePath(i->first)) {
-                    // If this path is a prototype path and is not present in
-                    // the primMap, then this must be a new prototype added
-                    // during this processing, instantiate and add it.
-                    Usd_PrimDataPtr protoPrim = _InstantiatePrototypePrim(i->first);
-                    subtreesToRecompose->push_back(protoPrim);
-                }
-                ++i;
-            } while (i != end && i->first.GetParentPath() == parentPath);
-        } else if (parentPath.IsEmpty()) {
+        if (parentPath.IsEmpty()) {
             // This is the pseudo root, so we need to blow and rebuild
             // everything.
-            subtreesToRecompose->push_back(_pseudoRoot);
+            foundPseudoRoot = true;
             ++i;
-        } else {
+            continue;
+        }
+
+        // Scan forward while the paths share a parent to find the range
+        // of siblings.
+        _WorkItem item;
+        item.parentPath = parentPath;
+        do {
+            item.paths.push_back(i->first);
             ++i;
+        } while (i != end && i->first.GetParentPath() == parentPath);
+        workItems.push_back(std::move(item));
+    }
+
+    if (foundPseudoRoot) {
+        subtreesToRecompose->push_back(_pseudoRoot);
+    }
+
+    // Process work items in parallel, collecting each item's subtrees
+    // into its own result vector to avoid synchronizing on the output.
+    std::vector<std::vector<Usd_PrimDataPtr>> results(workItems.size());
+
+    WorkWithScopedParallelism([&]() {
+        // We may populate the clip cache concurrently while composing
+        // children, so we need to enable concurrent population here.
+        Usd_ClipCache::ConcurrentPopulationContext
+            clipConcurrentPopContext(*_clipCache);
+        WorkDispatcher dispatcher;
+        for (size_t w = 0; w != workItems.size(); ++w) {
+            dispatcher.Run([this, &workItems, &results, w]() {
+                const _WorkItem &item = workItems[w];
+                std::vector<Usd_PrimDataPtr> &result = results[w];
+                PathToNodeMap::const_accessor acc;
+
+                if (item.parentPath.IsEmpty()) {
+                    // Add prototypes to list of subtrees to recompose and
+                    // instantiate any new prototype not present in the
+                    // primMap from before.
+                    const SdfPath &protoPath = item.paths.front();
+                    if (_primMap.find(acc, protoPath)) {
+                        // should be a changed prototype if already in the
+                        // primMap
+                        result.push_back(acc->second.get());
+                        acc.release();
+                    } else {
+                        // newPrototype should be absent from the primMap,
+                        // instantiate these now to be added to
+                        // subtreesToRecompose
+                        result.push_back(
+                            _InstantiatePrototypePrim(protoPath));
+                    }
+                    return;
+                }
+
+                // Collect all non-prototype prims (including descendants
+                // of prototypes) to be added to subtreesToRecompose.
+                if (!_primMap.find(acc, item.parentPath)) {
+                    return;
+                }
+
+                // Recompose parent's list of children.
+                auto parent = acc->second.get();
+                acc.release();
+                _ComposeChildren(
+                    parent,
+                    parent->IsInPrototype() ? nullptr : &_populationMask,
+                    /*recurse=*/false);
+
+                // Recompose the subtree for each affected sibling.
+                for (const SdfPath &path : item.paths) {
+                    if (_primMap.find(acc, path)) {
+                        result.push_back(acc->second.get());
+                        acc.release();
+                    } else if (_instanceCache->IsPrototypePath(path)) {
+                        // If this path is a prototype path and is not
+                        // present in the primMap, then this must be a new
+                        // prototype added during this processing,
+                        // instantiate and add it.
+                        result.push_back(_InstantiatePrototypePrim(path));
+                    }
+                }
+            });
         }
+    });
+
+    size_t numSubtrees = subtreesToRecompose->size();
+    for (const auto &result : results) {
+        numSubtrees += result.size();
+    }
+    subtreesToRecompose->reserve(numSubtrees);
+    for (const auto &result : results) {
+        subtreesToRecompose->insert(
+            subtreesToRecompose->end(), result.begin(), result.end());
     }
 }
 
@@ -5492,21 +5977,49 @@ _CopyPrim(const UsdPrim &usdPrim,
     }
 }
 
+// Copy the subtree rooted at subtreeRoots[i] to the root-level path
+// dstPaths[i] in its own anonymous layer, in parallel across subtrees, then
+// merge the per-subtree layers into flatLayer in order.  Prototype and root
+// subtrees flatten independently of one another, so the workers never write
+// to a common layer; the merge shares field values with the per-subtree
+// layers rather than deep-copying them.
 void
-_CopyPrototypePrim(const UsdPrim &prototypePrim,
-                   const SdfLayerHandle &destinationLayer,
-                   const _PathRemapping &prototypeToFlattened)
+_CopySubtreesInParallel(
+    const std::vector<UsdPrim>& subtreeRoots,
+    const std::vector<SdfPath>& dstPaths,
+    const SdfLayerRefPtr& flatLayer,
+    const _PathRemapping& prototypeToFlattened)
 {
-    const auto& flattenedPrototypePath 
-        = prototypeToFlattened.at(prototypePrim.GetPath());
-
-    for (UsdPrim child: UsdPrimRange::AllPrims(prototypePrim)) {
-        // We need to update the child path to use the Flatten name.
-        const auto flattenedChildPath = child.GetPath().ReplacePrefix(
-            prototypePrim.GetPath(), flattenedPrototypePath);
-
-        _CopyPrim(child, destinationLayer, flattenedChildPath, 
-                  prototypeToFlattened);
+    std::vector<SdfLayerRefPtr> subtreeLayers(subtreeRoots.size());
+    WorkWithScopedParallelism([&]() {
+        WorkParallelForN(
+            subtreeRoots.size(),
+            [&](size_t begin, size_t end) {
+                // Batch change processing for the layers this worker authors.
+                SdfChangeBlock changeBlock;
+                for (size_t i = begin; i != end; ++i) {
+                    SdfLayerRefPtr subtreeLayer =
+                        SdfLayer::CreateAnonymous(".usda");
+                    const SdfPath& srcRootPath = subtreeRoots[i].GetPath();
+                    for (UsdPrim prim:
+                             UsdPrimRange::AllPrims(subtreeRoots[i])) {
+                        // We need to update the path to use the
+                        // destination name.
+                        _CopyPrim(prim, subtreeLayer,
+                                  prim.GetPath().ReplacePrefix(
+                                      srcRootPath, dstPaths[i]),
+                                  prototypeToFlattened);
+                    }
+                    subtreeLayers[i] = subtreeLayer;
+                }
+            });
+    });
+    for (size_t i = 0; i != subtreeRoots.size(); ++i) {
+        // The subtree layer is empty if the subtree root was inactive.
+        if (subtreeLayers[i]->GetPrimAtPath(dstPaths[i])) {
+            SdfCopySpecBulk(subtreeLayers[i], dstPaths[i],
+                            flatLayer, dstPaths[i]);
+        }
     }
 }
 
@@ -5619,17 +6132,45 @@ UsdStage::Flatten(bool addSourceFileComment) const
 
     // Preemptively populate our mapping. This allows us to populate
     // nested instances in the destination layer much more simply.
+    const std::vector<UsdPrim> prototypes = GetPrototypes();
     const auto prototypeToFlattened =
-        _GenerateFlattenedPrototypePath(GetPrototypes());
+        _GenerateFlattenedPrototypePath(prototypes);
 
-    // We author the prototype overs first to produce simpler 
-    // assets which have them grouped at the top of the file.
-    for (auto const& prototype : GetPrototypes()) {
-        _CopyPrototypePrim(prototype, flatLayer, prototypeToFlattened);
-    }
+    // Copy the stage metadata onto the pseudo-root first.
+    _CopyPrim(GetPseudoRoot(), flatLayer, SdfPath::AbsoluteRootPath(),
+              prototypeToFlattened);
 
-    for (UsdPrim prim: UsdPrimRange::AllPrims(GetPseudoRoot())) {
-        _CopyPrim(prim, flatLayer, prim.GetPath(), prototypeToFlattened);
+    // We author the prototype overs first to produce simpler
+    // assets which have them grouped at the top of the file.
+    std::vector<UsdPrim> subtreeRoots;
+    std::vector<SdfPath> subtreeDstPaths;
+    for (auto const& prototype : prototypes) {
+        subtreeRoots.push_back(prototype);
+        subtreeDstPaths.push_back(
+            prototypeToFlattened.at(prototype.GetPath()));
+    }
+    for (UsdPrim rootPrim: GetPseudoRoot().GetAllChildren()) {
+        subtreeRoots.push_back(rootPrim);
+        subtreeDstPaths.push_back(rootPrim.GetPath());
+    }
+
+    // Each prototype and root subtree flattens independently of the others,
+    // so when there is more than one we copy each into its own layer in
+    // parallel and merge the results; otherwise copy directly into the
+    // destination layer.
+    if (subtreeRoots.size() > 1 && WorkHasConcurrency()) {
+        _CopySubtreesInParallel(
+            subtreeRoots, subtreeDstPaths, flatLayer, prototypeToFlattened);
+    } else {
+        for (size_t i = 0; i != subtreeRoots.size(); ++i) {
+            const SdfPath& srcRootPath = subtreeRoots[i].GetPath();
+            for (UsdPrim prim: UsdPrimRange::AllPrims(subtreeRoots[i])) {
+                _CopyPrim(prim, flatLayer,
+                          prim.GetPath().ReplacePrefix(
+                              srcRootPath, subtreeDstPaths[i]),
+                          prototypeToFlattened);
+            }
+        }
     }
 
     if (addSourceFileComment) {
@@ -9584,6 +10125,88 @@ UsdStage::SetFramesPerSecond(double framesPerSecond) const
     SetMetadata(SdfFieldKeys->FramesPerSecond, framesPerSecond);
 }
 
+void
+UsdStage::PrefetchTimeInterval(
+    const SdfPathVector &paths, const GfInterval &interval) const
+{
+    TRACE_FUNCTION();
+
+    // Expand the requested paths to the set of attributes to prefetch.
+    std::vector<UsdAttribute> attrs;
+    for (const SdfPath &path : paths) {
+        if (path.IsPrimPropertyPath()) {
+            if (UsdPrim prim = GetPrimAtPath(path.GetPrimPath())) {
+                if (UsdAttribute attr =
+                        prim.GetAttribute(path.GetNameToken())) {
+                    attrs.push_back(attr);
+                }
+            }
+        } else if (path.IsAbsoluteRootOrPrimPath()) {
+            if (UsdPrim root = GetPrimAtPath(path)) {
+                for (const UsdPrim &prim : UsdPrimRange(root)) {
+                    for (const UsdAttribute &attr : prim.GetAttributes()) {
+                        attrs.push_back(attr);
+                    }
+                }
+            }
+        }
+    }
+
+    // One work item per contributing (layer, spec path) pair with time
+    // samples, plus one per value clip active in the interval.  Reading a
+    // time sample through the layer faults the crate value block in;
+    // opening a clip's layer reads the clip file.
+    struct _WorkItem {
+        SdfLayerHandle layer;
+        SdfPath specPath;
+        Usd_ClipRefPtr clip;
+    };
+    std::vector<_WorkItem> workItems;
+
+    std::set<SdfPath> clipPrimPaths;
+    for (const UsdAttribute &attr : attrs) {
+        for (const SdfPropertySpecHandle &spec : attr.GetPropertyStack(
+                 UsdTimeCode::Default())) {
+            SdfLayerHandle const layer = spec->GetLayer();
+            if (layer->GetNumTimeSamplesForPath(spec->GetPath()) > 0) {
+                workItems.push_back({ layer, spec->GetPath(), nullptr });
+            }
+        }
+        clipPrimPaths.insert(attr.GetPrimPath());
+    }
+    for (const SdfPath &primPath : clipPrimPaths) {
+        for (const Usd_ClipSetRefPtr &clipSet :
+                 _clipCache->GetClipsForPrim(primPath)) {
+            for (const Usd_ClipRefPtr &clip : clipSet->valueClips) {
+                // A clip is active in [startTime, endTime).
+                if (clip->startTime < interval.GetMax() &&
+                    clip->endTime > interval.GetMin()) {
+                    workItems.push_back({ SdfLayerHandle(), SdfPath(),
+                                          clip });
+                }
+            }
+        }
+    }
+
+    WorkParallelForEach(
+        workItems.begin(), workItems.end(),
+        [&interval](const _WorkItem &item) {
+            if (item.clip) {
+                // Forces the clip's layer open, reading the clip file.
+                item.clip->GetLayer();
+                return;
+            }
+            VtValue value;
+            for (const double time :
+                     item.layer->ListTimeSamplesForPath(item.specPath)) {
+                if (interval.Contains(time)) {
+                    item.layer->QueryTimeSample(
+                        item.specPath, time, &value);
+                }
+            }
+        });
+}
+
 void 
 UsdStage::SetColorConfiguration(const SdfAssetPath &colorConfig) const
 {
@@ -9683,11 +10306,9 @@ UsdStage::SetInterpolationType(UsdInterpolationType interpolationType)
         _interpolationType = interpolationType;
 
         // Notify, as interpolated attributes values have likely changed.
-        UsdStageWeakPtr self(this);
         UsdNotice::ObjectsChanged::_PathsToChangesMap resyncChanges;
         resyncChanges[SdfPath::AbsoluteRootPath()];
-        UsdNotice::ObjectsChanged(self, &resyncChanges).Send(self);
-        UsdNotice::StageContentsChanged(self).Send(self);
+        _SendObjectsChanged(&resyncChanges);
     }
 }
 
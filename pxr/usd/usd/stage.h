@@ -12,6 +12,7 @@
 #include "pxr/pxr.h"
 #include "pxr/usd/usd/api.h"
 #include "pxr/usd/usd/common.h"
+#include "pxr/usd/usd/compositionStats.h"
 #include "pxr/usd/usd/editTarget.h"
 #include "pxr/usd/usd/interpolation.h"
 #include "pxr/usd/usd/schemaRegistry.h"
@@ -1455,7 +1456,28 @@ public:
     /// \sa GetFramesPerSecond()
     USD_API
     void SetFramesPerSecond(double framesPerSecond) const;
-    
+
+    /// Prefetch the time-sample data needed to resolve values on the given
+    /// \p paths over \p interval.
+    ///
+    /// Layers fault value blocks in on demand, so the first playback pass
+    /// through an interval pays for I/O at the playhead.  This call reads
+    /// every authored time sample within \p interval for the affected
+    /// attributes from their contributing layers, and opens the value
+    /// clips active in \p interval, warming layer data and the OS page
+    /// cache so that subsequent resolves hit memory.  The reads are fanned
+    /// out across worker threads; the call returns once all prefetching
+    /// has completed.
+    ///
+    /// Each path may be an attribute path or a prim path; a prim path
+    /// prefetches every attribute in the prim's subtree.  This performs
+    /// only thread-safe reads, so it may be called from a background
+    /// thread running ahead of the playhead and may run concurrently with
+    /// value resolution, but not with stage mutation.
+    USD_API
+    void PrefetchTimeInterval(
+        const SdfPathVector &paths, const GfInterval &interval) const;
+
     /// @}
 
     // --------------------------------------------------------------------- //
@@ -1604,6 +1626,101 @@ public:
     USD_API
     std::vector<UsdPrim> GetPrototypes() const;
 
+    /// Returns a human-readable report describing, for each prototype prim,
+    /// which instancing key components prevented it from being shared with
+    /// otherwise-similar prototypes.  This is intended as a diagnostic aid
+    /// when a stage produces more prototypes than expected.  Returns an
+    /// empty string if no such prototype pairs exist.
+    USD_API
+    std::string GetPrototypeSharingDiagnostics() const;
+
+    /// @}
+
+    // --------------------------------------------------------------------- //
+    /// \anchor Usd_noticeBatching
+    /// \name Notice Batching
+    /// @{
+    // --------------------------------------------------------------------- //
+
+    /// Begin batching change notification on this stage.
+    ///
+    /// Normally each round of change processing -- one per SdfChangeBlock,
+    /// load/unload call, or layer muting change -- sends its own
+    /// UsdNotice::ObjectsChanged and UsdNotice::StageContentsChanged
+    /// notices.  While batching is active those notices are withheld and
+    /// their changed paths accumulate on the stage; the matching call to
+    /// EndNoticeBatching() delivers a single merged ObjectsChanged notice
+    /// covering everything that changed during the batch, followed by one
+    /// StageContentsChanged.  Listeners that re-examine the scene in
+    /// response to each notice thus do so once per batch instead of once
+    /// per edit, which can dominate the cost of bulk scripted edits.
+    ///
+    /// Calls may be nested; only the outermost EndNoticeBatching()
+    /// delivers notices.  Note that while a batch is open, listeners will
+    /// not observe intermediate changes, so queries they make against the
+    /// stage may reflect edits they have not yet been notified about.
+    USD_API
+    void BeginNoticeBatching();
+
+    /// End a batch begun with BeginNoticeBatching(), delivering the merged
+    /// notices if this call closes the outermost batch.  It is a coding
+    /// error to call this function without a matching
+    /// BeginNoticeBatching().
+    USD_API
+    void EndNoticeBatching();
+
+    /// Return true if notice batching is currently active on this stage.
+    /// \sa BeginNoticeBatching
+    USD_API
+    bool IsBatchingNotices() const;
+
+    /// @}
+
+    // --------------------------------------------------------------------- //
+    /// \name Diagnostics
+    /// @{
+    // --------------------------------------------------------------------- //
+
+    /// Return true if this stage is recording per-prim composition
+    /// statistics.  Recording is enabled for all stages by setting the
+    /// USD_RECORD_COMPOSITION_STATS environment variable before stages
+    /// are created, and covers both the initial open and subsequent
+    /// recomposition; when a prim is recomposed its statistics replace
+    /// the previously recorded values.  Recording adds a small per-prim
+    /// cost to composition, so it is off by default.
+    USD_API
+    bool IsRecordingCompositionStats() const;
+
+    /// Return composition statistics aggregated over subtrees, sorted by
+    /// descending time and truncated to the \p maxResults most expensive
+    /// entries.  Each returned entry sums the recorded cost of a prim and
+    /// all of its descendants; descendants of a reported subtree are not
+    /// reported separately, so the results identify the distinct hot
+    /// spots of the last open or recomposition.  Returns an empty vector
+    /// if recording is not enabled.
+    /// \sa IsRecordingCompositionStats
+    USD_API
+    UsdCompositionStatsVector
+    GetMostExpensiveCompositionSubtrees(size_t maxResults = 10) const;
+
+    /// Return a structured report attributing this stage's memory use,
+    /// suitable for serialization to telemetry.  The returned dictionary
+    /// holds:
+    ///
+    /// \li "counters" -- prim, prototype and used-layer counts, plus the
+    ///     estimated bytes of the stage's prim data.
+    /// \li "subtrees" -- per root-level subtree, the prim count and
+    ///     estimated prim data bytes beneath it.
+    /// \li "layers" -- per used layer, the size of its backing file on
+    ///     disk (zero for anonymous layers).
+    /// \li "mallocTags" -- when TfMallocTag is initialized, the total
+    ///     tracked bytes, the bytes attributed to this stage's malloc
+    ///     tag, and a per-subsystem breakdown from the top-level tags
+    ///     (Sdf, Pcp, Usd, ...).  Heap attribution requires running with
+    ///     tagging enabled, e.g. via TF_MALLOC_TAG=1.
+    USD_API
+    VtDictionary GetMemoryReport() const;
+
     /// @}
 
 private:
@@ -1844,6 +1961,11 @@ private:
     // and applied API schemas.
     void _ComposePrimTypeInfoImpl(Usd_PrimDataPtr prim);
 
+    // Record composition statistics for \p prim; helper for
+    // _ComposeSubtreeImpl, only called when recording is enabled.
+    void _RecordCompositionStats(
+        Usd_PrimDataConstPtr prim, uint64_t timeNanos);
+
     // Compose subtree rooted at \p prim under \p parent.  This function
     // ensures that the appropriate prim index is specified for \p prim if
     // \p parent is in a prototype.
@@ -1905,6 +2027,16 @@ private:
     // _pendingChanges will be set to nullptr by the end of the function.
     void _ProcessPendingChanges();
 
+    // Send UsdNotice::ObjectsChanged followed by StageContentsChanged for
+    // the given changed-path maps or, if notice batching is active, fold
+    // the changes into the current batch instead.
+    template <class PathsToChangesMap>
+    void _SendObjectsChanged(PathsToChangesMap *resyncChanges,
+                             PathsToChangesMap *infoChanges,
+                             PathsToChangesMap *assetPathChanges);
+    template <class PathsToChangesMap>
+    void _SendObjectsChanged(PathsToChangesMap *resyncChanges);
+
     // Remove scene description for the prim at \p fullPath in the current edit
     // target.
     bool _RemovePrim(const SdfPath& fullPath);
@@ -2327,6 +2459,17 @@ private:
     class _PendingChanges;
     _PendingChanges* _pendingChanges;
 
+    // Accumulated changes while notice batching is active; see
+    // BeginNoticeBatching().
+    class _NoticeBatch;
+    std::unique_ptr<_NoticeBatch> _noticeBatch;
+
+    // Per-prim composition statistics, appended concurrently during
+    // composition when recording is enabled; later entries for a path
+    // supersede earlier ones.  See GetMostExpensiveCompositionSubtrees().
+    tbb::concurrent_vector<UsdCompositionStats> _compositionStats;
+    const bool _recordCompositionStats;
+
     std::optional<WorkDispatcher> _dispatcher;
 
     // To provide useful aggregation of malloc stats, we bill everything
@@ -363,8 +363,23 @@ UsdStageCache::RequestStage(UsdStageCacheRequest &&request)
     UsdStageCacheRequest::_Mailbox mailbox;
 
     { LockGuard lock(_mutex);
-        // Does the cache currently have a match?  If so, done.
-        {
+        // Does the cache currently have a match?  If so, done.  If the
+        // request identifies the root layer its stage must have, we need
+        // only consider cached stages with that root layer; this keeps
+        // requests cheap when a cache holds many stages sharing a few
+        // root layers, e.g. per-session variations of a common asset.
+        if (SdfLayerHandle rootLayer = request.GetRootLayer()) {
+            const StagesByRootLayer &byRootLayer =
+                _impl->stages.ByRootLayer();
+            const auto range = byRootLayer.equal_range(rootLayer);
+            for (auto entryIt = range.first; entryIt != range.second;
+                 ++entryIt) {
+                if (request.IsSatisfiedBy(entryIt->second)) {
+                    return std::make_pair(entryIt->second, false);
+                }
+            }
+        }
+        else {
             const IdsByStage &byStage = _impl->stages.ByStage();
             for (auto const &element: byStage) {
                 if (request.IsSatisfiedBy(element.first)) {
@@ -768,6 +783,12 @@ UsdStageCacheRequest::~UsdStageCacheRequest()
 {
 }
 
+SdfLayerHandle
+UsdStageCacheRequest::GetRootLayer() const
+{
+    return SdfLayerHandle();
+}
+
 void
 UsdStageCacheRequest::_Subscribe(_Mailbox *mailbox)
 {
@@ -384,6 +384,18 @@ public:
     // IsSatisfiedBy() must return true for the resulting stage.
     virtual UsdStageRefPtr Manufacture() = 0;
 
+    // Return the root layer that any stage satisfying this request must
+    // have, or null if this request cannot identify one.  This is an
+    // optimization hint: when non-null, UsdStageCache::RequestStage()
+    // considers only cached stages with this root layer rather than
+    // scanning the entire cache, which keeps requests cheap when a cache
+    // holds many stages sharing a few root layers, e.g. per-session
+    // variations of a common asset.  If this returns a non-null layer,
+    // IsSatisfiedBy() must return false for any stage with a different
+    // root layer.  The default implementation returns null.
+    USD_API
+    virtual SdfLayerHandle GetRootLayer() const;
+
 private:
     friend class UsdStageCache;
 
@@ -83,5 +83,54 @@ def "Prim"
         with _Validate():
             rootLayer.subLayerPaths.remove(emptySublayerAfter.identifier)
 
+    def test_GetValues(self):
+        """Test that batched value resolution matches per-time Get() for
+        default-only, time-sampled and held-interpolated attributes."""
+
+        rootLayer = Sdf.Layer.CreateAnonymous("root.usda")
+        rootLayer.ImportFromString('''
+#usda 1.0
+
+def "Prim"
+{
+    double defaultOnly = 5.0
+    double sampled = 1.0
+    double sampled.timeSamples = {
+        0.0: 0.0,
+        10.0: 10.0
+    }
+}
+'''
+        .strip())
+
+        stage = Usd.Stage.Open(rootLayer)
+
+        times = [Usd.TimeCode.Default(), 0.0, 2.5, 5.0, 10.0, 20.0]
+
+        # An attribute whose value does not come from time samples is
+        # resolved once and replicated across all requested times.
+        query = Usd.AttributeQuery(
+            stage.GetAttributeAtPath("/Prim.defaultOnly"))
+        self.assertEqual(query.GetValues(times), [5.0] * len(times))
+
+        # A time-sampled attribute must produce the same values as
+        # individual Get() calls, including interpolated times and the
+        # default-time special case.
+        query = Usd.AttributeQuery(stage.GetAttributeAtPath("/Prim.sampled"))
+        self.assertEqual(query.GetValues(times),
+                         [query.Get(t) for t in times])
+        self.assertEqual(query.GetValues(times),
+                         [1.0, 0.0, 2.5, 5.0, 10.0, 10.0])
+
+        # Same again under held interpolation, which exercises the
+        # shared-bracketing-sample path.
+        stage.SetInterpolationType(Usd.InterpolationTypeHeld)
+        self.assertEqual(query.GetValues(times),
+                         [query.Get(t) for t in times])
+        self.assertEqual(query.GetValues(times),
+                         [1.0, 0.0, 0.0, 0.0, 10.0, 10.0])
+
+        self.assertEqual(query.GetValues([]), [])
+
 if __name__ == "__main__":
     unittest.main()
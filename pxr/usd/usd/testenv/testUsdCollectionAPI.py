@@ -64,6 +64,15 @@ class TestUsdCollectionAPI(unittest.TestCase):
                 self.assertFalse(mquery.IsPathIncluded(path),
                                  msg='query should exclude {}'.format(path))
 
+        # Check bulk classification of sorted paths against the
+        # per-path API.
+        sortedPaths = sorted(allPaths)
+        inclusions = mquery.ComputePathInclusions(sortedPaths)
+        for path, included in zip(sortedPaths, inclusions):
+            self.assertEqual(
+                included, path in includes,
+                msg='bulk classification mismatch for {}'.format(path))
+
         # Get path expression.
         pathExpr = \
             Usd.ComputePathExpressionFromCollectionMembershipQueryRuleMap(
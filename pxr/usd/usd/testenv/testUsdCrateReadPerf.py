@@ -0,0 +1,79 @@
+#!/pxrpythonsubst
+#
+# Copyright 2025 Pixar
+#
+# Licensed under the terms set forth in the LICENSE.txt file available at
+# https://openusd.org/license.
+#
+# Performance test for crate file read throughput. Authors a crate layer
+# holding large array time samples once per run, then measures opening the
+# layer and pulling every sample back through UsdAttribute::Get, reporting
+# the timings via perfstats.raw for perfTestWrapper.py.
+
+import gc
+import time
+
+from pxr import Gf, Sdf, Usd, Vt
+
+NUM_PRIMS = 100
+POINTS_PER_PRIM = 5000
+TIME_SAMPLES = (0.0, 12.0, 24.0)
+
+
+def _AuthorCrateLayer(fileName):
+    stage = Usd.Stage.CreateNew(fileName)
+    for i in range(NUM_PRIMS):
+        prim = stage.DefinePrim('/World/prim_%d' % i, 'Scope')
+        attr = prim.CreateAttribute(
+            'points', Sdf.ValueTypeNames.Point3fArray)
+        for t in TIME_SAMPLES:
+            points = Vt.Vec3fArray(
+                POINTS_PER_PRIM, Gf.Vec3f(i, t, 0))
+            attr.Set(points, t)
+    stage.GetRootLayer().Save()
+    del stage
+    gc.collect()
+
+
+def main():
+    metrics = []
+
+    _AuthorCrateLayer('crate.usdc')
+
+    gc.collect()
+    t0 = time.perf_counter()
+    stage = Usd.Stage.Open('crate.usdc')
+    assert stage
+    metrics.append(
+        ('crate_open', int((time.perf_counter() - t0) * 1e9)))
+
+    # Crate reads values lazily, so this sweep measures the actual
+    # deserialization throughput of the array data.
+    t0 = time.perf_counter()
+    numValues = 0
+    for prim in stage.Traverse():
+        attr = prim.GetAttribute('points')
+        if not attr:
+            continue
+        for t in TIME_SAMPLES:
+            value = attr.Get(t)
+            numValues += len(value)
+    elapsed = time.perf_counter() - t0
+    metrics.append(('crate_read_values', int(elapsed * 1e9)))
+
+    assert numValues == NUM_PRIMS * POINTS_PER_PRIM * len(TIME_SAMPLES)
+    del stage
+    gc.collect()
+
+    with open('perfstats.raw', 'w') as statsFile:
+        for name, ns in metrics:
+            statsFile.write(
+                "{'profile':'%s','metric':'time','value':%d,'samples':1}\n"
+                % (name, ns))
+            print('%s : %d ns' % (name, ns))
+
+    print('OK')
+
+
+if __name__ == '__main__':
+    main()
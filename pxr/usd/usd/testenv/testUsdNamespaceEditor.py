@@ -637,11 +637,70 @@ class TestUsdNamespaceEditor(unittest.TestCase):
                 subLayer1.GetPrimAtPath("/NewA/NewB"),
                 subLayer2.GetPrimAtPath("/NewA/NewB")])
 
-        # Run reparent and rename tests using both ReparentPrim and 
+        # Run reparent and rename tests using both ReparentPrim and
         # MovePrimAtPath
         _TestReparentAndRenamePrim(useMovePrimAtPath=False)
         _TestReparentAndRenamePrim(useMovePrimAtPath=True)
 
+    def test_BasicBatchEdits(self):
+        """Tests adding multiple independent edits to the namespace editor and
+        applying them all as a single batch.
+        """
+
+        # Load the basic stage and get its layers and prims
+        stage, rootLayer, subLayer1, subLayer2, primA, primB, primC = \
+            self._SetupBasicStage()
+
+        editor = Usd.NamespaceEditor(stage)
+
+        # Add three independent edits: delete /C/B/A, rename /C/B/B_Root_Prim,
+        # and reparent /C/C_Root_Prim to be a root prim.
+        self.assertTrue(editor.DeletePrimAtPath("/C/B/A"))
+        self.assertTrue(
+            editor.MovePrimAtPath("/C/B/B_Root_Prim", "/C/B/NewBRootPrim"))
+        self.assertTrue(editor.MovePrimAtPath("/C/C_Root_Prim", "/CRootPrim"))
+
+        # All the added edits are applied together as a single batch.
+        self.assertTrue(editor.CanApplyEdits())
+        self.assertTrue(editor.ApplyEdits())
+        self.assertFalse(stage.GetPrimAtPath("/C/B/A"))
+        self.assertFalse(stage.GetPrimAtPath("/C/B/B_Root_Prim"))
+        self.assertTrue(stage.GetPrimAtPath("/C/B/NewBRootPrim"))
+        self.assertFalse(stage.GetPrimAtPath("/C/C_Root_Prim"))
+        self.assertTrue(stage.GetPrimAtPath("/CRootPrim"))
+
+        # Applying the edits clears the batch so there are no longer any edits
+        # to apply.
+        self._VerifyFalseResult(editor.CanApplyEdits(),
+            "There are no valid edits to perform")
+
+        # The edits in a batch must be namespace independent of each other; an
+        # edit whose paths overlap the paths of a previously added edit cannot
+        # be applied.
+        self.assertTrue(editor.MovePrimAtPath("/C/B", "/C/NewB"))
+        self.assertTrue(editor.DeletePrimAtPath("/C/B/NewBRootPrim"))
+        self._VerifyFalseResult(editor.CanApplyEdits(),
+            "The edit of '/C/B/NewBRootPrim' overlaps in namespace with the "
+            "previously added edit of '/C/B'; the edits in a batch are "
+            "applied without recomposing between the individual edits and "
+            "must be independent of each other")
+        with self.assertRaises(Tf.ErrorException):
+            editor.ApplyEdits()
+        self.assertTrue(stage.GetPrimAtPath("/C/B"))
+        self.assertTrue(stage.GetPrimAtPath("/C/B/NewBRootPrim"))
+
+        # A failed apply also clears the batch, so a new independent edit can
+        # be added and applied on its own.
+        self.assertTrue(editor.MovePrimAtPath("/C/B", "/C/NewB"))
+        self.assertTrue(editor.CanApplyEdits())
+        self.assertTrue(editor.ApplyEdits())
+        self.assertTrue(stage.GetPrimAtPath("/C/NewB"))
+
+        # Reset the layers for the next test case.
+        rootLayer.Reload()
+        subLayer1.Reload()
+        subLayer2.Reload()
+
     def test_BasicCanEditPrim(self):
         """Tests the basic usage of the CanApplyEdits in cases where namespace
         editing should fail. Also tests that calling ApplyEdits in cases where
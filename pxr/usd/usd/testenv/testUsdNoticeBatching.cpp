@@ -0,0 +1,176 @@
+//
+// Copyright 2026 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+
+#include "pxr/pxr.h"
+#include "pxr/usd/usd/notice.h"
+#include "pxr/usd/usd/prim.h"
+#include "pxr/usd/usd/stage.h"
+#include "pxr/usd/sdf/path.h"
+#include "pxr/usd/sdf/schema.h"
+
+#include "pxr/base/tf/errorMark.h"
+#include "pxr/base/tf/notice.h"
+#include "pxr/base/tf/weakBase.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+// Records every ObjectsChanged and StageContentsChanged notice delivered
+// for a stage, along with the changed paths of the most recent
+// ObjectsChanged.
+struct _Listener : public TfWeakBase
+{
+    explicit _Listener(const UsdStageWeakPtr &stage) {
+        TfNotice::Register(
+            TfCreateWeakPtr(this), &_Listener::_HandleObjectsChanged, stage);
+        TfNotice::Register(
+            TfCreateWeakPtr(this), &_Listener::_HandleContentsChanged, stage);
+    }
+
+    void _HandleObjectsChanged(const UsdNotice::ObjectsChanged &n,
+                               const UsdStageWeakPtr &sender) {
+        ++objectsChangedCount;
+        lastResyncedPaths.clear();
+        for (const SdfPath &path : n.GetResyncedPaths()) {
+            lastResyncedPaths.push_back(path);
+        }
+        lastInfoChangedPaths.clear();
+        for (const SdfPath &path : n.GetChangedInfoOnlyPaths()) {
+            lastInfoChangedPaths.push_back(path);
+        }
+    }
+
+    void _HandleContentsChanged(const UsdNotice::StageContentsChanged &n,
+                                const UsdStageWeakPtr &sender) {
+        ++contentsChangedCount;
+    }
+
+    size_t objectsChangedCount = 0;
+    size_t contentsChangedCount = 0;
+    SdfPathVector lastResyncedPaths;
+    SdfPathVector lastInfoChangedPaths;
+};
+
+static bool
+_Contains(const SdfPathVector &paths, const SdfPath &path)
+{
+    return std::find(paths.begin(), paths.end(), path) != paths.end();
+}
+
+static void
+TestMergedDelivery()
+{
+    printf("TestMergedDelivery...\n");
+
+    UsdStageRefPtr stage = UsdStage::CreateInMemory();
+    UsdPrim primA = stage->DefinePrim(SdfPath("/A"));
+
+    _Listener listener(stage);
+
+    // Without batching, each edit delivers its own notices.
+    primA.SetMetadata(SdfFieldKeys->Documentation, std::string("one"));
+    stage->DefinePrim(SdfPath("/B"));
+    TF_AXIOM(listener.objectsChangedCount == 2);
+    TF_AXIOM(listener.contentsChangedCount == 2);
+
+    // Inside a batch, multiple change rounds are withheld and delivered
+    // as one merged notice at EndNoticeBatching().
+    TF_AXIOM(!stage->IsBatchingNotices());
+    stage->BeginNoticeBatching();
+    TF_AXIOM(stage->IsBatchingNotices());
+
+    primA.SetMetadata(SdfFieldKeys->Documentation, std::string("two"));
+    stage->DefinePrim(SdfPath("/C"));
+    TF_AXIOM(listener.objectsChangedCount == 2);
+    TF_AXIOM(listener.contentsChangedCount == 2);
+
+    stage->EndNoticeBatching();
+    TF_AXIOM(!stage->IsBatchingNotices());
+    TF_AXIOM(listener.objectsChangedCount == 3);
+    TF_AXIOM(listener.contentsChangedCount == 3);
+    TF_AXIOM(_Contains(listener.lastInfoChangedPaths, SdfPath("/A")));
+    TF_AXIOM(_Contains(listener.lastResyncedPaths, SdfPath("/C")));
+}
+
+static void
+TestResyncSubsumesEarlierInfoChange()
+{
+    printf("TestResyncSubsumesEarlierInfoChange...\n");
+
+    UsdStageRefPtr stage = UsdStage::CreateInMemory();
+    stage->DefinePrim(SdfPath("/C"));
+    UsdPrim child = stage->DefinePrim(SdfPath("/C/Child"));
+
+    _Listener listener(stage);
+    stage->BeginNoticeBatching();
+
+    // Round 1: an info-only change on the descendant.
+    child.SetMetadata(SdfFieldKeys->Documentation, std::string("doc"));
+    // Round 2: a resync of the ancestor.
+    stage->GetPrimAtPath(SdfPath("/C")).SetActive(false);
+
+    stage->EndNoticeBatching();
+
+    // The ancestor resync must subsume the earlier info change: the
+    // merged notice resyncs /C and reports no info-only change for the
+    // descendant.
+    TF_AXIOM(listener.objectsChangedCount == 1);
+    TF_AXIOM(_Contains(listener.lastResyncedPaths, SdfPath("/C")));
+    TF_AXIOM(!_Contains(listener.lastInfoChangedPaths, SdfPath("/C/Child")));
+}
+
+static void
+TestNestingAndEmptyBatch()
+{
+    printf("TestNestingAndEmptyBatch...\n");
+
+    UsdStageRefPtr stage = UsdStage::CreateInMemory();
+    _Listener listener(stage);
+
+    // Only the outermost EndNoticeBatching() delivers notices.
+    stage->BeginNoticeBatching();
+    stage->BeginNoticeBatching();
+    stage->DefinePrim(SdfPath("/Inner"));
+    stage->EndNoticeBatching();
+    TF_AXIOM(stage->IsBatchingNotices());
+    TF_AXIOM(listener.objectsChangedCount == 0);
+    stage->DefinePrim(SdfPath("/Outer"));
+    stage->EndNoticeBatching();
+    TF_AXIOM(!stage->IsBatchingNotices());
+    TF_AXIOM(listener.objectsChangedCount == 1);
+    TF_AXIOM(_Contains(listener.lastResyncedPaths, SdfPath("/Inner")));
+    TF_AXIOM(_Contains(listener.lastResyncedPaths, SdfPath("/Outer")));
+
+    // A batch with no changes delivers nothing.
+    stage->BeginNoticeBatching();
+    stage->EndNoticeBatching();
+    TF_AXIOM(listener.objectsChangedCount == 1);
+    TF_AXIOM(listener.contentsChangedCount == 1);
+
+    // Unmatched EndNoticeBatching() is a coding error and a no-op.
+    {
+        TfErrorMark m;
+        stage->EndNoticeBatching();
+        TF_AXIOM(!m.IsClean());
+        m.Clear();
+        TF_AXIOM(listener.objectsChangedCount == 1);
+    }
+}
+
+int
+main()
+{
+    TestMergedDelivery();
+    TestResyncSubsumesEarlierInfoChange();
+    TestNestingAndEmptyBatch();
+
+    printf("OK\n");
+    return 0;
+}
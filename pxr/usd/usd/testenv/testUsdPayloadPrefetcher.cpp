@@ -0,0 +1,116 @@
+//
+// Copyright 2026 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+
+#include "pxr/pxr.h"
+#include "pxr/usd/usd/notice.h"
+#include "pxr/usd/usd/payloadPrefetcher.h"
+#include "pxr/usd/usd/payloads.h"
+#include "pxr/usd/usd/prim.h"
+#include "pxr/usd/usd/stage.h"
+#include "pxr/usd/sdf/layer.h"
+#include "pxr/usd/sdf/path.h"
+
+#include "pxr/base/tf/notice.h"
+#include "pxr/base/tf/weakBase.h"
+
+#include <cstdio>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+struct _NoticeCounter : public TfWeakBase
+{
+    explicit _NoticeCounter(const UsdStageWeakPtr &stage) {
+        TfNotice::Register(
+            TfCreateWeakPtr(this), &_NoticeCounter::_Handle, stage);
+    }
+
+    void _Handle(const UsdNotice::ObjectsChanged &n,
+                 const UsdStageWeakPtr &sender) {
+        ++count;
+    }
+
+    size_t count = 0;
+};
+
+// Writes a payload layer holding /<primName> with one child prim.
+static void
+_WritePayloadLayer(const std::string &fileName, const std::string &primName)
+{
+    UsdStageRefPtr stage = UsdStage::CreateNew(fileName);
+    const SdfPath primPath =
+        SdfPath::AbsoluteRootPath().AppendChild(TfToken(primName));
+    stage->DefinePrim(primPath);
+    stage->DefinePrim(primPath.AppendChild(TfToken("Child")));
+    stage->GetRootLayer()->Save();
+}
+
+int
+main()
+{
+    // Author a root layer with two payload prims, each targeting its own
+    // layer, then drop everything so the payload layers are closed.
+    _WritePayloadLayer("prefetchPayload1.usda", "Payload1");
+    _WritePayloadLayer("prefetchPayload2.usda", "Payload2");
+    {
+        UsdStageRefPtr authoring = UsdStage::CreateNew("prefetchRoot.usda");
+        authoring->DefinePrim(SdfPath("/P1")).GetPayloads().AddPayload(
+            "./prefetchPayload1.usda", SdfPath("/Payload1"));
+        authoring->DefinePrim(SdfPath("/P2")).GetPayloads().AddPayload(
+            "./prefetchPayload2.usda", SdfPath("/Payload2"));
+        authoring->GetRootLayer()->Save();
+    }
+    TF_AXIOM(!SdfLayer::Find("prefetchPayload1.usda"));
+    TF_AXIOM(!SdfLayer::Find("prefetchPayload2.usda"));
+
+    // Open the stage without loading any payloads.
+    UsdStageRefPtr stage =
+        UsdStage::Open("prefetchRoot.usda", UsdStage::LoadNone);
+    TF_AXIOM(stage);
+    TF_AXIOM(!stage->GetPrimAtPath(SdfPath("/P1")).IsLoaded());
+
+    {
+        UsdPayloadPrefetcher prefetcher(stage);
+        _NoticeCounter counter(stage);
+
+        // Prefetching opens the payload layers but loads nothing.
+        prefetcher.Prefetch(SdfPath("/P1"), /* priority = */ 1);
+        prefetcher.Prefetch(SdfPathVector{ SdfPath("/P2") });
+        prefetcher.WaitForPrefetches();
+        TF_AXIOM(SdfLayer::Find("prefetchPayload1.usda"));
+        TF_AXIOM(SdfLayer::Find("prefetchPayload2.usda"));
+        TF_AXIOM(!stage->GetPrimAtPath(SdfPath("/P1")).IsLoaded());
+        TF_AXIOM(!stage->GetPrimAtPath(SdfPath("/P1/Child")));
+        TF_AXIOM(counter.count == 0);
+
+        // Committing loads both paths in one batch: a single notice, and
+        // the payload contents are composed afterwards.
+        const SdfPathSet loaded = prefetcher.CommitLoads();
+        TF_AXIOM(loaded ==
+                 (SdfPathSet{ SdfPath("/P1"), SdfPath("/P2") }));
+        TF_AXIOM(counter.count == 1);
+        TF_AXIOM(stage->GetPrimAtPath(SdfPath("/P1")).IsLoaded());
+        TF_AXIOM(stage->GetPrimAtPath(SdfPath("/P1/Child")));
+        TF_AXIOM(stage->GetPrimAtPath(SdfPath("/P2/Child")));
+
+        // A commit with nothing prefetched is a no-op.
+        TF_AXIOM(prefetcher.CommitLoads().empty());
+        TF_AXIOM(counter.count == 1);
+
+        // Paths that do not name a prim on the stage are discarded.
+        prefetcher.Prefetch(SdfPath("/DoesNotExist"));
+        prefetcher.WaitForPrefetches();
+        TF_AXIOM(prefetcher.CommitLoads().empty());
+        TF_AXIOM(counter.count == 1);
+
+        // Destruction with an uncommitted prefetch in flight must simply
+        // wait and discard.
+        prefetcher.Prefetch(SdfPath("/P1"));
+    }
+
+    printf("OK\n");
+    return 0;
+}
@@ -0,0 +1,239 @@
+//
+// Copyright 2026 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+
+#include "pxr/pxr.h"
+#include "pxr/usd/usd/attribute.h"
+#include "pxr/usd/usd/notice.h"
+#include "pxr/usd/usd/prim.h"
+#include "pxr/usd/usd/stage.h"
+#include "pxr/usd/sdf/data.h"
+#include "pxr/usd/sdf/layer.h"
+#include "pxr/usd/sdf/path.h"
+#include "pxr/usd/sdf/schema.h"
+#include "pxr/usd/sdf/types.h"
+
+#include "pxr/base/tf/errorMark.h"
+#include "pxr/base/tf/notice.h"
+#include "pxr/base/tf/weakBase.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+// Listens for ObjectsChanged on a stage, recording how many notices were
+// sent and which paths were resynced.
+struct _ResyncListener : public TfWeakBase
+{
+    explicit _ResyncListener(const UsdStageWeakPtr &stage) {
+        TfNotice::Register(
+            TfCreateWeakPtr(this), &_ResyncListener::_Handle, stage);
+    }
+
+    void _Handle(const UsdNotice::ObjectsChanged &n,
+                 const UsdStageWeakPtr &sender) {
+        ++noticeCount;
+        for (const SdfPath &path : n.GetResyncedPaths()) {
+            resyncedPaths.push_back(path);
+        }
+    }
+
+    size_t noticeCount = 0;
+    SdfPathVector resyncedPaths;
+};
+
+// Builds a standalone SdfData holding the subtree
+//
+//     def "Src" { custom double attr = 42; def "Child" { } }
+//
+// the way a bulk producer would: raw specs and fields, no change
+// processing.
+static SdfDataRefPtr
+_BuildSourceSubtree()
+{
+    SdfDataRefPtr data = TfCreateRefPtr(new SdfData);
+
+    const SdfPath srcPath("/Src");
+    data->CreateSpec(srcPath, SdfSpecTypePrim);
+    data->Set(srcPath, SdfFieldKeys->Specifier,
+              VtValue(SdfSpecifierDef));
+    data->Set(srcPath, SdfChildrenKeys->PrimChildren,
+              VtValue(TfTokenVector{TfToken("Child")}));
+    data->Set(srcPath, SdfChildrenKeys->PropertyChildren,
+              VtValue(TfTokenVector{TfToken("attr")}));
+
+    const SdfPath attrPath = srcPath.AppendProperty(TfToken("attr"));
+    data->CreateSpec(attrPath, SdfSpecTypeAttribute);
+    data->Set(attrPath, SdfFieldKeys->Custom, VtValue(true));
+    data->Set(attrPath, SdfFieldKeys->TypeName, VtValue(TfToken("double")));
+    data->Set(attrPath, SdfFieldKeys->Variability,
+              VtValue(SdfVariabilityVarying));
+    data->Set(attrPath, SdfFieldKeys->Default, VtValue(42.0));
+
+    const SdfPath childPath = srcPath.AppendChild(TfToken("Child"));
+    data->CreateSpec(childPath, SdfSpecTypePrim);
+    data->Set(childPath, SdfFieldKeys->Specifier,
+              VtValue(SdfSpecifierDef));
+
+    return data;
+}
+
+static void
+TestSpliceSubtree()
+{
+    printf("TestSpliceSubtree...\n");
+
+    UsdStageRefPtr stage = UsdStage::CreateInMemory();
+    SdfLayerHandle rootLayer = stage->GetRootLayer();
+    stage->DefinePrim(SdfPath("/Parent"));
+
+    SdfDataRefPtr source = _BuildSourceSubtree();
+
+    // Splicing must resync the new prim on the stage in one notice.
+    _ResyncListener listener(stage);
+    TF_AXIOM(rootLayer->SpliceSubtree(
+                 *source, SdfPath("/Src"), SdfPath("/Parent/Spliced")));
+    TF_AXIOM(listener.noticeCount == 1);
+    TF_AXIOM(std::count(listener.resyncedPaths.begin(),
+                        listener.resyncedPaths.end(),
+                        SdfPath("/Parent/Spliced")) == 1);
+
+    // The stage must have recomposed the spliced subtree.
+    UsdPrim spliced = stage->GetPrimAtPath(SdfPath("/Parent/Spliced"));
+    TF_AXIOM(spliced);
+    TF_AXIOM(stage->GetPrimAtPath(SdfPath("/Parent/Spliced/Child")));
+    double value = 0;
+    TF_AXIOM(spliced.GetAttribute(TfToken("attr")).Get(&value));
+    TF_AXIOM(value == 42.0);
+
+    // The layer must report the new specs and be dirty.
+    TF_AXIOM(rootLayer->GetPrimAtPath(SdfPath("/Parent/Spliced")));
+    TF_AXIOM(rootLayer->IsDirty());
+}
+
+static void
+TestSpliceSubtreePreconditions()
+{
+    printf("TestSpliceSubtreePreconditions...\n");
+
+    UsdStageRefPtr stage = UsdStage::CreateInMemory();
+    SdfLayerHandle rootLayer = stage->GetRootLayer();
+    stage->DefinePrim(SdfPath("/Parent"));
+
+    SdfDataRefPtr source = _BuildSourceSubtree();
+    _ResyncListener listener(stage);
+
+    // Non-prim source and target paths.
+    {
+        TfErrorMark m;
+        TF_AXIOM(!rootLayer->SpliceSubtree(
+                     *source, SdfPath("/Src.attr"), SdfPath("/Parent/New")));
+        TF_AXIOM(!m.IsClean());
+        m.Clear();
+        TF_AXIOM(!rootLayer->SpliceSubtree(
+                     *source, SdfPath("/Src"), SdfPath("/Parent.attr")));
+        TF_AXIOM(!m.IsClean());
+        m.Clear();
+    }
+
+    // No spec at the source path.
+    {
+        TfErrorMark m;
+        TF_AXIOM(!rootLayer->SpliceSubtree(
+                     *source, SdfPath("/Nonexistent"), SdfPath("/Parent/New")));
+        TF_AXIOM(!m.IsClean());
+        m.Clear();
+    }
+
+    // A spec already exists at the target path.
+    {
+        TfErrorMark m;
+        TF_AXIOM(!rootLayer->SpliceSubtree(
+                     *source, SdfPath("/Src"), SdfPath("/Parent")));
+        TF_AXIOM(!m.IsClean());
+        m.Clear();
+    }
+
+    // The target's parent does not exist.
+    {
+        TfErrorMark m;
+        TF_AXIOM(!rootLayer->SpliceSubtree(
+                     *source, SdfPath("/Src"), SdfPath("/Missing/New")));
+        TF_AXIOM(!m.IsClean());
+        m.Clear();
+    }
+
+    // None of the failed calls may have changed the layer or the stage.
+    TF_AXIOM(listener.noticeCount == 0);
+    TF_AXIOM(!rootLayer->GetPrimAtPath(SdfPath("/Parent/New")));
+    TF_AXIOM(!stage->GetPrimAtPath(SdfPath("/Parent/New")));
+}
+
+static void
+TestSpliceSubtrees()
+{
+    printf("TestSpliceSubtrees...\n");
+
+    UsdStageRefPtr stage = UsdStage::CreateInMemory();
+    SdfLayerHandle rootLayer = stage->GetRootLayer();
+    stage->DefinePrim(SdfPath("/Parent"));
+
+    // Two producer shards spliced under different parents in one call.
+    SdfDataRefPtr sourceA = _BuildSourceSubtree();
+    SdfDataRefPtr sourceB = _BuildSourceSubtree();
+
+    _ResyncListener listener(stage);
+    std::vector<SdfLayer::SubtreeSplice> splices = {
+        { get_pointer(sourceA), SdfPath("/Src"), SdfPath("/Parent/A") },
+        { get_pointer(sourceB), SdfPath("/Src"), SdfPath("/B") },
+    };
+    TF_AXIOM(rootLayer->SpliceSubtrees(splices));
+
+    // Both splices must arrive on the stage in a single coalesced notice.
+    TF_AXIOM(listener.noticeCount == 1);
+    TF_AXIOM(std::count(listener.resyncedPaths.begin(),
+                        listener.resyncedPaths.end(),
+                        SdfPath("/Parent/A")) == 1);
+    TF_AXIOM(std::count(listener.resyncedPaths.begin(),
+                        listener.resyncedPaths.end(),
+                        SdfPath("/B")) == 1);
+    double value = 0;
+    TF_AXIOM(stage->GetPrimAtPath(SdfPath("/Parent/A/Child")));
+    TF_AXIOM(stage->GetAttributeAtPath(SdfPath("/B.attr")).Get(&value));
+    TF_AXIOM(value == 42.0);
+
+    // A failed validation must make no changes at all: here the second
+    // splice targets a path the first one also targets.
+    {
+        TfErrorMark m;
+        std::vector<SdfLayer::SubtreeSplice> badSplices = {
+            { get_pointer(sourceA), SdfPath("/Src"), SdfPath("/Parent/C") },
+            { get_pointer(sourceB), SdfPath("/Src"), SdfPath("/Parent/C") },
+        };
+        TF_AXIOM(!rootLayer->SpliceSubtrees(badSplices));
+        TF_AXIOM(!m.IsClean());
+        m.Clear();
+        TF_AXIOM(listener.noticeCount == 1);
+        TF_AXIOM(!rootLayer->GetPrimAtPath(SdfPath("/Parent/C")));
+    }
+
+    // An empty splice list is a no-op success.
+    TF_AXIOM(rootLayer->SpliceSubtrees({}));
+    TF_AXIOM(listener.noticeCount == 1);
+}
+
+int
+main()
+{
+    TestSpliceSubtree();
+    TestSpliceSubtreePreconditions();
+    TestSpliceSubtrees();
+
+    printf("OK\n");
+    return 0;
+}
@@ -0,0 +1,84 @@
+#!/pxrpythonsubst
+#
+# Copyright 2025 Pixar
+#
+# Licensed under the terms set forth in the LICENSE.txt file available at
+# https://openusd.org/license.
+#
+# Performance test for UsdStage::Open. Authors a synthetic stage once per
+# run, then measures cold opens of the text and crate encodings of the same
+# scene, reporting the timings via perfstats.raw for perfTestWrapper.py.
+
+import gc
+import time
+
+from pxr import Sdf, Usd
+
+NUM_PRIMS = 5000
+FANOUT = 8
+
+
+def _AuthorStage(fileName):
+    layer = Sdf.Layer.CreateNew(fileName)
+    stage = Usd.Stage.Open(layer)
+    with Sdf.ChangeBlock():
+        frontier = [Sdf.Path('/World')]
+        Sdf.CreatePrimInLayer(layer, frontier[0]).specifier = Sdf.SpecifierDef
+        created = 1
+        while created < NUM_PRIMS:
+            nextFrontier = []
+            for parent in frontier:
+                for i in range(FANOUT):
+                    if created >= NUM_PRIMS:
+                        break
+                    path = parent.AppendChild('c%d' % i)
+                    spec = Sdf.CreatePrimInLayer(layer, path)
+                    spec.specifier = Sdf.SpecifierDef
+                    spec.typeName = 'Scope'
+                    attrSpec = Sdf.AttributeSpec(
+                        spec, 'x', Sdf.ValueTypeNames.Double)
+                    attrSpec.default = float(created)
+                    nextFrontier.append(path)
+                    created += 1
+            frontier = nextFrontier
+    layer.Save()
+    del stage
+    del layer
+    gc.collect()
+
+
+def _TimeOpen(fileName):
+    gc.collect()
+    t0 = time.perf_counter()
+    stage = Usd.Stage.Open(fileName)
+    elapsed = time.perf_counter() - t0
+    assert stage
+    del stage
+    gc.collect()
+    return int(elapsed * 1e9)
+
+
+def main():
+    metrics = []
+
+    _AuthorStage('perf.usda')
+    metrics.append(('open_usda', _TimeOpen('perf.usda')))
+
+    layer = Sdf.Layer.FindOrOpen('perf.usda')
+    layer.Export('perf.usdc')
+    del layer
+    gc.collect()
+    metrics.append(('open_usdc', _TimeOpen('perf.usdc')))
+
+    with open('perfstats.raw', 'w') as statsFile:
+        for name, ns in metrics:
+            statsFile.write(
+                "{'profile':'%s','metric':'time','value':%d,'samples':1}\n"
+                % (name, ns))
+            print('%s : %d ns' % (name, ns))
+
+    print('OK')
+
+
+if __name__ == '__main__':
+    main()
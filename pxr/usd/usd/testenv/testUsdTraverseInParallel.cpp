@@ -0,0 +1,153 @@
+//
+// Copyright 2026 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+
+#include "pxr/pxr.h"
+#include "pxr/usd/usd/prim.h"
+#include "pxr/usd/usd/primRange.h"
+#include "pxr/usd/usd/stage.h"
+#include "pxr/usd/sdf/path.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+// Creates a stage with several levels of sibling subtrees so the parallel
+// traversal has work to split. The subtree rooted at /B is deactivated so
+// that predicates have something to prune.
+static UsdStageRefPtr
+_CreateTestStage()
+{
+    UsdStageRefPtr stage = UsdStage::CreateInMemory();
+    TF_AXIOM(stage);
+
+    for (const char *rootName : {"A", "B", "C", "D"}) {
+        const SdfPath rootPath =
+            SdfPath::AbsoluteRootPath().AppendChild(TfToken(rootName));
+        TF_AXIOM(stage->DefinePrim(rootPath));
+        for (int i = 0; i < 4; ++i) {
+            const SdfPath childPath =
+                rootPath.AppendChild(TfToken("Child" + std::to_string(i)));
+            TF_AXIOM(stage->DefinePrim(childPath));
+            for (int j = 0; j < 4; ++j) {
+                TF_AXIOM(stage->DefinePrim(
+                    childPath.AppendChild(TfToken("Leaf" + std::to_string(j)))));
+            }
+        }
+    }
+
+    TF_AXIOM(stage->GetPrimAtPath(SdfPath("/B")).SetActive(false));
+    return stage;
+}
+
+// Returns the sorted paths of the prims that UsdPrimRange(root, predicate)
+// visits, which is the visitation set UsdTraverseInParallel must match.
+static SdfPathVector
+_GetExpectedPaths(
+    const UsdPrim &root, const Usd_PrimFlagsPredicate &predicate)
+{
+    SdfPathVector paths;
+    for (const UsdPrim &prim : UsdPrimRange(root, predicate)) {
+        paths.push_back(prim.GetPath());
+    }
+    std::sort(paths.begin(), paths.end());
+    return paths;
+}
+
+// Traverses in parallel collecting visited paths into per-thread vectors
+// that are concatenated by the reducer, and returns the sorted result.
+static SdfPathVector
+_GetParallelVisitedPaths(
+    const UsdPrim &root, const Usd_PrimFlagsPredicate &predicate)
+{
+    SdfPathVector paths = UsdTraverseInParallel(
+        root, predicate, SdfPathVector(),
+        [](const UsdPrim &prim, SdfPathVector *threadPaths) {
+            threadPaths->push_back(prim.GetPath());
+        },
+        [](SdfPathVector lhs, SdfPathVector rhs) {
+            lhs.insert(lhs.end(),
+                       std::make_move_iterator(rhs.begin()),
+                       std::make_move_iterator(rhs.end()));
+            return lhs;
+        });
+    std::sort(paths.begin(), paths.end());
+    return paths;
+}
+
+static void
+TestVisitsSamePrimsAsPrimRange()
+{
+    UsdStageRefPtr stage = _CreateTestStage();
+
+    // The parallel traversal must visit exactly the prims that UsdPrimRange
+    // visits for the same root and predicate, both with the default predicate
+    // (which prunes the deactivated /B subtree) and with the unfiltered
+    // predicate.
+    for (const Usd_PrimFlagsPredicate &predicate :
+            {Usd_PrimFlagsPredicate(UsdPrimDefaultPredicate),
+             Usd_PrimFlagsPredicate(UsdPrimAllPrimsPredicate)}) {
+        const UsdPrim root = stage->GetPrimAtPath(SdfPath("/A"));
+        TF_AXIOM(_GetParallelVisitedPaths(root, predicate) ==
+                 _GetExpectedPaths(root, predicate));
+
+        const UsdPrim prunedRoot = stage->GetPrimAtPath(SdfPath("/B"));
+        TF_AXIOM(_GetParallelVisitedPaths(prunedRoot, predicate) ==
+                 _GetExpectedPaths(prunedRoot, predicate));
+    }
+
+    // A root that fails the predicate prunes the entire traversal, just as
+    // it produces an empty UsdPrimRange.
+    const UsdPrim inactiveRoot = stage->GetPrimAtPath(SdfPath("/B"));
+    TF_AXIOM(_GetParallelVisitedPaths(
+        inactiveRoot, UsdPrimDefaultPredicate).empty());
+}
+
+static void
+TestReduction()
+{
+    UsdStageRefPtr stage = _CreateTestStage();
+    const UsdPrim root = stage->GetPrimAtPath(SdfPath("/A"));
+
+    // A simple counting reduction must match the size of the equivalent
+    // UsdPrimRange.
+    const size_t count = UsdTraverseInParallel(
+        root, UsdPrimDefaultPredicate, size_t(0),
+        [](const UsdPrim &, size_t *threadCount) { ++(*threadCount); },
+        [](size_t lhs, size_t rhs) { return lhs + rhs; });
+    TF_AXIOM(count ==
+             _GetExpectedPaths(root, UsdPrimDefaultPredicate).size());
+}
+
+static void
+TestStatelessOverload()
+{
+    UsdStageRefPtr stage = _CreateTestStage();
+    const UsdPrim root = stage->GetPseudoRoot();
+
+    // The stateless overload requires a thread-safe visitor.
+    std::atomic<size_t> count(0);
+    UsdTraverseInParallel(
+        root, UsdPrimAllPrimsPredicate,
+        [&count](const UsdPrim &) { ++count; });
+    TF_AXIOM(count.load() ==
+             _GetExpectedPaths(root, UsdPrimAllPrimsPredicate).size());
+}
+
+int
+main(int argc, char** argv)
+{
+    TestVisitsSamePrimsAsPrimRange();
+    TestReduction();
+    TestStatelessOverload();
+
+    std::cout << "OK\n";
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,139 @@
+//
+// Copyright 2024 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+
+#include "pxr/pxr.h"
+#include "pxr/base/tf/stringUtils.h"
+#include "pxr/usd/sdf/layer.h"
+#include "pxr/usd/usd/prim.h"
+#include "pxr/usd/usd/primRange.h"
+#include "pxr/usd/usd/validationContext.h"
+#include "pxr/usd/usd/validationError.h"
+#include "pxr/usd/usd/validator.h"
+
+#include <algorithm>
+#include <iostream>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+static
+void TestValidationContext()
+{
+    // Note that these are just to test the context -> validators -> Error
+    // pipeline, validators should ideally be registered with the
+    // UsdValidationRegistry.
+    //
+    UsdValidateLayerTaskFn validateLayerTaskFn =
+        [](const SdfLayerHandle& layer) {
+        return UsdValidationErrorVector{
+            UsdValidationError(UsdValidationErrorType::Error,
+                               {UsdValidationErrorSite(layer,
+                                                       SdfPath("/"))},
+                               "This is an error on a layer")};
+    };
+    UsdValidatorMetadata metadata;
+    metadata.name = TfToken("TestContextLayerValidator");
+    metadata.doc = "This is a test.";
+    UsdValidator layerValidator = UsdValidator(metadata, validateLayerTaskFn);
+
+    UsdValidateStageTaskFn validateStageTaskFn =
+        [](const UsdStagePtr &usdStage) {
+            return UsdValidationErrorVector{
+                UsdValidationError(UsdValidationErrorType::Error,
+                                   {UsdValidationErrorSite(usdStage,
+                                                           SdfPath("/"))},
+                                   "This is an error on the stage")};
+    };
+    metadata.name = TfToken("TestContextStageValidator");
+    UsdValidator stageValidator = UsdValidator(metadata, validateStageTaskFn);
+
+    // Errors on every prim whose name starts with "Bad".
+    UsdValidatePrimTaskFn validatePrimTaskFn = [](const UsdPrim &usdPrim) {
+        if (!TfStringStartsWith(usdPrim.GetName().GetString(), "Bad")) {
+            return UsdValidationErrorVector();
+        }
+        return UsdValidationErrorVector{
+            UsdValidationError(UsdValidationErrorType::Error,
+                               {UsdValidationErrorSite(usdPrim.GetStage(),
+                                                       usdPrim.GetPath())},
+                               "This is an error on a prim")};
+    };
+    metadata.name = TfToken("TestContextPrimValidator");
+    UsdValidator primValidator = UsdValidator(metadata, validatePrimTaskFn);
+
+    UsdValidationContext context = UsdValidationContext(
+        {&layerValidator, &stageValidator, &primValidator});
+
+    UsdStageRefPtr usdStage = UsdStage::CreateInMemory();
+    usdStage->DefinePrim(SdfPath("/World"));
+    usdStage->DefinePrim(SdfPath("/World/GoodPrim"));
+    usdStage->DefinePrim(SdfPath("/World/BadPrim"));
+    usdStage->DefinePrim(SdfPath("/World/BadPrim/BadChild"));
+
+    // Validating the stage runs the layer validator on every used layer,
+    // the stage validator once, and the prim validator on every prim.
+    // CreateInMemory stages have a root layer and a session layer.
+    {
+        UsdValidationErrorVector errors = context.Validate(usdStage);
+        TF_AXIOM(errors.size() == 5);
+        size_t numLayerErrors = 0;
+        size_t numStageErrors = 0;
+        size_t numPrimErrors = 0;
+        for (const UsdValidationError &error : errors) {
+            TF_AXIOM(!error.HasNoError());
+            if (error.GetMessage() == "This is an error on a layer") {
+                ++numLayerErrors;
+            } else if (error.GetMessage() == "This is an error on the stage") {
+                ++numStageErrors;
+            } else if (error.GetMessage() == "This is an error on a prim") {
+                ++numPrimErrors;
+            }
+        }
+        TF_AXIOM(numLayerErrors == 2);
+        TF_AXIOM(numStageErrors == 1);
+        TF_AXIOM(numPrimErrors == 2);
+    }
+
+    // Validating a single layer runs only the layer validator.
+    {
+        UsdValidationErrorVector errors =
+            context.Validate(usdStage->GetRootLayer());
+        TF_AXIOM(errors.size() == 1);
+        TF_AXIOM(errors[0].GetMessage() == "This is an error on a layer");
+    }
+
+    // Incremental validation: re-validate just one subtree.
+    {
+        std::vector<UsdPrim> prims;
+        for (const UsdPrim &prim : UsdPrimRange(
+                 usdStage->GetPrimAtPath(SdfPath("/World/BadPrim")))) {
+            prims.push_back(prim);
+        }
+        TF_AXIOM(prims.size() == 2);
+        UsdValidationErrorVector errors = context.ValidatePrims(prims);
+        TF_AXIOM(errors.size() == 2);
+        for (const UsdValidationError &error : errors) {
+            TF_AXIOM(error.GetMessage() == "This is an error on a prim");
+        }
+    }
+
+    // A context holding no prim validators reports no prim errors.
+    {
+        UsdValidationContext stageOnlyContext =
+            UsdValidationContext({&stageValidator});
+        UsdValidationErrorVector errors = stageOnlyContext.Validate(usdStage);
+        TF_AXIOM(errors.size() == 1);
+        TF_AXIOM(errors[0].GetMessage() == "This is an error on the stage");
+    }
+}
+
+int
+main()
+{
+    TestValidationContext();
+
+    std::cout << "OK\n";
+}
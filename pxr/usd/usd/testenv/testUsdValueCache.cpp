@@ -0,0 +1,126 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+#include "pxr/pxr.h"
+#include "pxr/usd/usd/attribute.h"
+#include "pxr/usd/usd/prim.h"
+#include "pxr/usd/usd/stage.h"
+#include "pxr/usd/usd/valueCache.h"
+#include "pxr/usd/sdf/valueTypeName.h"
+#include "pxr/base/tf/diagnostic.h"
+#include "pxr/base/vt/value.h"
+
+#include <cstdio>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+static void
+TestCachedResolution()
+{
+    UsdStageRefPtr stage = UsdStage::CreateInMemory();
+    UsdPrim prim = stage->DefinePrim(SdfPath("/Prim"));
+    UsdAttribute attr = prim.CreateAttribute(
+        TfToken("size"), SdfValueTypeNames->Double);
+    TF_AXIOM(attr.Set(1.0));
+    TF_AXIOM(attr.Set(10.0, UsdTimeCode(1.0)));
+    TF_AXIOM(attr.Set(20.0, UsdTimeCode(2.0)));
+
+    UsdValueCache cache(stage);
+    TF_AXIOM(cache.GetStage() == stage);
+    TF_AXIOM(cache.GetNumCachedValues() == 0);
+
+    // Default and per-time buckets populate independently.
+    VtValue val;
+    TF_AXIOM(cache.Get(attr, &val));
+    TF_AXIOM(val.Get<double>() == 1.0);
+    TF_AXIOM(cache.GetNumCachedValues() == 1);
+
+    TF_AXIOM(cache.Get(attr, &val, UsdTimeCode(1.0)));
+    TF_AXIOM(val.Get<double>() == 10.0);
+    TF_AXIOM(cache.Get(attr, &val, UsdTimeCode(2.0)));
+    TF_AXIOM(val.Get<double>() == 20.0);
+    TF_AXIOM(cache.GetNumCachedValues() == 3);
+
+    // Hits do not grow the cache.
+    TF_AXIOM(cache.Get(attr, &val));
+    TF_AXIOM(val.Get<double>() == 1.0);
+    TF_AXIOM(cache.GetNumCachedValues() == 3);
+
+    // Typed access; a mismatched type fails.
+    double size = 0;
+    TF_AXIOM(cache.Get(attr, &size));
+    TF_AXIOM(size == 1.0);
+    int wrongType = 0;
+    TF_AXIOM(!cache.Get(attr, &wrongType));
+
+    cache.Clear();
+    TF_AXIOM(cache.GetNumCachedValues() == 0);
+}
+
+static void
+TestInvalidation()
+{
+    UsdStageRefPtr stage = UsdStage::CreateInMemory();
+    UsdPrim primA = stage->DefinePrim(SdfPath("/A"));
+    UsdPrim primB = stage->DefinePrim(SdfPath("/B"));
+    UsdAttribute attrA = primA.CreateAttribute(
+        TfToken("x"), SdfValueTypeNames->Double);
+    UsdAttribute attrB = primB.CreateAttribute(
+        TfToken("y"), SdfValueTypeNames->Double);
+    TF_AXIOM(attrA.Set(1.0));
+    TF_AXIOM(attrB.Set(2.0));
+
+    UsdValueCache cache(stage);
+    VtValue val;
+    TF_AXIOM(cache.Get(attrA, &val) && val.Get<double>() == 1.0);
+    TF_AXIOM(cache.Get(attrB, &val) && val.Get<double>() == 2.0);
+    TF_AXIOM(cache.GetNumCachedValues() == 2);
+
+    // Authoring attrB invalidates its bucket but leaves attrA's cached
+    // value in place, and the next Get sees the new value.
+    TF_AXIOM(attrB.Set(3.0));
+    TF_AXIOM(cache.GetNumCachedValues() == 1);
+    TF_AXIOM(cache.Get(attrB, &val) && val.Get<double>() == 3.0);
+    TF_AXIOM(cache.Get(attrA, &val) && val.Get<double>() == 1.0);
+
+    // A resync of an ancestor drops the whole subtree.
+    TF_AXIOM(cache.GetNumCachedValues() == 2);
+    stage->RemovePrim(SdfPath("/B"));
+    TF_AXIOM(cache.GetNumCachedValues() == 1);
+    TF_AXIOM(cache.Get(attrA, &val) && val.Get<double>() == 1.0);
+}
+
+static void
+TestFailedResolution()
+{
+    UsdStageRefPtr stage = UsdStage::CreateInMemory();
+    UsdPrim prim = stage->DefinePrim(SdfPath("/Prim"));
+    UsdAttribute attr = prim.CreateAttribute(
+        TfToken("opt"), SdfValueTypeNames->Double);
+
+    UsdValueCache cache(stage);
+
+    // No authored value and no fallback: the failure itself is cached.
+    VtValue val;
+    TF_AXIOM(!cache.Get(attr, &val));
+    TF_AXIOM(cache.GetNumCachedValues() == 1);
+    TF_AXIOM(!cache.Get(attr, &val));
+
+    // Authoring a value invalidates the cached failure.
+    TF_AXIOM(attr.Set(4.0));
+    TF_AXIOM(cache.Get(attr, &val) && val.Get<double>() == 4.0);
+}
+
+int
+main(int argc, char** argv)
+{
+    TestCachedResolution();
+    TestInvalidation();
+    TestFailedResolution();
+
+    printf("Passed!\n");
+    return 0;
+}
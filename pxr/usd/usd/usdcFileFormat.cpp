@@ -150,14 +150,12 @@ UsdUsdcFileFormat::WriteToFile(const SdfLayer& layer,
         return crateData->Export(filePath);
     }
 
-    // Otherwise we're dealing with some arbitrary data object, just copy the
-    // contents into the binary data.
-    if (auto dataDest = 
-        TfDynamic_cast<Usd_CrateDataRefPtr>(InitData(FileFormatArguments()))) {
-        dataDest->CopyFrom(dataSource);
-        return dataDest->Export(filePath);
-    }
-    return false;
+    // Otherwise we're dealing with some arbitrary data object; pack its
+    // contents directly into the output file one spec at a time. This avoids
+    // materializing a second full copy of the document, which matters when
+    // transcoding large text layers (e.g. via usdcat) on memory-constrained
+    // machines.
+    return Usd_CrateData::PackDataToFile(dataSource, filePath);
 }
 
 bool
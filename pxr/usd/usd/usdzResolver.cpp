@@ -14,6 +14,8 @@
 #include "pxr/usd/ar/resolvedPath.h"
 #include "pxr/usd/ar/resolver.h"
 
+#include "pxr/base/arch/fileSystem.h"
+
 #include <tbb/concurrent_hash_map.h>
 
 #include <memory>
@@ -228,6 +230,12 @@ Usd_UsdzResolver::OpenAsset(
         return nullptr;
     }
 
+    // Hint to the kernel that we're about to read this member's data so
+    // that, on a cold cache, readahead proceeds asynchronously while the
+    // caller goes on to parse it.  Members are opened in parallel during
+    // stage composition, so these reads overlap composition work.
+    ArchMemAdvise(iter.GetFile(), info.size, ArchMemAdviceWillNeed);
+
     return std::shared_ptr<ArAsset>(
         new _Asset(
             std::move(asset), std::move(zipFile),
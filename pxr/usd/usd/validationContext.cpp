@@ -0,0 +1,160 @@
+//
+// Copyright 2024 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+
+#include "pxr/usd/usd/validationContext.h"
+#include "pxr/usd/usd/primRange.h"
+#include "pxr/usd/usd/validationError.h"
+#include "pxr/base/tf/diagnostic.h"
+#include "pxr/base/work/dispatcher.h"
+#include "pxr/base/work/loops.h"
+#include "pxr/base/work/withScopedParallelism.h"
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+UsdValidationContext::UsdValidationContext(
+    const std::vector<const UsdValidator*> &validators)
+{
+    for (const UsdValidator *validator : validators) {
+        if (!validator) {
+            TF_CODING_ERROR("Null validator provided to "
+                            "UsdValidationContext.");
+            continue;
+        }
+        if (validator->_GetValidateLayerTask()) {
+            _layerValidators.push_back(validator);
+        } else if (validator->_GetValidateStageTask()) {
+            _stageValidators.push_back(validator);
+        } else if (validator->_GetValidatePrimTask()) {
+            _primValidators.push_back(validator);
+        }
+    }
+}
+
+static void
+_AppendErrors(UsdValidationErrorVector &&taskErrors,
+              UsdValidationErrorVector *errors,
+              std::mutex *errorsMutex)
+{
+    if (taskErrors.empty()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(*errorsMutex);
+    errors->insert(errors->end(),
+                   std::make_move_iterator(taskErrors.begin()),
+                   std::make_move_iterator(taskErrors.end()));
+}
+
+void
+UsdValidationContext::_ValidatePrims(
+    const std::vector<UsdPrim> &prims,
+    UsdValidationErrorVector *errors,
+    std::mutex *errorsMutex) const
+{
+    if (_primValidators.empty() || prims.empty()) {
+        return;
+    }
+    WorkParallelForN(
+        prims.size(),
+        [this, &prims, errors, errorsMutex](size_t begin, size_t end) {
+            // Accumulate locally and take the lock once per chunk rather
+            // than once per error.
+            UsdValidationErrorVector chunkErrors;
+            for (size_t i = begin; i != end; ++i) {
+                for (const UsdValidator *validator : _primValidators) {
+                    UsdValidationErrorVector taskErrors =
+                        validator->Validate(prims[i]);
+                    chunkErrors.insert(
+                        chunkErrors.end(),
+                        std::make_move_iterator(taskErrors.begin()),
+                        std::make_move_iterator(taskErrors.end()));
+                }
+            }
+            _AppendErrors(std::move(chunkErrors), errors, errorsMutex);
+        });
+}
+
+UsdValidationErrorVector
+UsdValidationContext::Validate(const SdfLayerHandle &layer) const
+{
+    if (!layer) {
+        TF_CODING_ERROR("Invalid layer provided to "
+                        "UsdValidationContext::Validate.");
+        return {};
+    }
+    UsdValidationErrorVector errors;
+    std::mutex errorsMutex;
+    WorkWithScopedParallelism([&]() {
+        WorkDispatcher dispatcher;
+        for (const UsdValidator *validator : _layerValidators) {
+            dispatcher.Run([&, validator]() {
+                _AppendErrors(validator->Validate(layer),
+                              &errors, &errorsMutex);
+            });
+        }
+    });
+    return errors;
+}
+
+UsdValidationErrorVector
+UsdValidationContext::Validate(const UsdStagePtr &usdStage) const
+{
+    if (!usdStage) {
+        TF_CODING_ERROR("Invalid stage provided to "
+                        "UsdValidationContext::Validate.");
+        return {};
+    }
+
+    // Gather the prims up front so that a single traversal feeds every
+    // prim validator; instance proxies are included so that validators see
+    // the fully expanded scene.
+    std::vector<UsdPrim> prims;
+    if (!_primValidators.empty()) {
+        for (const UsdPrim &prim :
+                 usdStage->Traverse(UsdTraverseInstanceProxies())) {
+            prims.push_back(prim);
+        }
+    }
+
+    const SdfLayerHandleVector usedLayers = usdStage->GetUsedLayers();
+
+    UsdValidationErrorVector errors;
+    std::mutex errorsMutex;
+    WorkWithScopedParallelism([&]() {
+        WorkDispatcher dispatcher;
+        for (const UsdValidator *validator : _layerValidators) {
+            for (const SdfLayerHandle &layer : usedLayers) {
+                dispatcher.Run([&, validator, layer]() {
+                    _AppendErrors(validator->Validate(layer),
+                                  &errors, &errorsMutex);
+                });
+            }
+        }
+        for (const UsdValidator *validator : _stageValidators) {
+            dispatcher.Run([&, validator]() {
+                _AppendErrors(validator->Validate(usdStage),
+                              &errors, &errorsMutex);
+            });
+        }
+        dispatcher.Run([&]() {
+            _ValidatePrims(prims, &errors, &errorsMutex);
+        });
+    });
+    return errors;
+}
+
+UsdValidationErrorVector
+UsdValidationContext::ValidatePrims(const std::vector<UsdPrim> &prims) const
+{
+    UsdValidationErrorVector errors;
+    std::mutex errorsMutex;
+    WorkWithScopedParallelism([&]() {
+        _ValidatePrims(prims, &errors, &errorsMutex);
+    });
+    return errors;
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
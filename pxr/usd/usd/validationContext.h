@@ -0,0 +1,92 @@
+//
+// Copyright 2024 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+#ifndef PXR_USD_USD_VALIDATION_CONTEXT_H
+#define PXR_USD_USD_VALIDATION_CONTEXT_H
+
+/// \file
+
+#include "pxr/pxr.h"
+#include "pxr/usd/usd/api.h"
+#include "pxr/usd/usd/validator.h"
+
+#include <mutex>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// \class UsdValidationContext
+///
+/// UsdValidationContext drives the execution of a set of UsdValidators.
+///
+/// Rather than each validator traversing the stage independently, a
+/// UsdValidationContext partitions its validators by task type when
+/// constructed and performs a single prim traversal feeding every
+/// prim-level validator, with layer-level and stage-level validators
+/// dispatched concurrently alongside it. Validation tasks run in parallel
+/// and their errors are accumulated into a single
+/// UsdValidationErrorVector, so the task functions provided by the
+/// validators must be thread-safe.
+///
+/// UsdValidationContext does not own the validators it runs; validator
+/// lifetime is managed by the UsdValidationRegistry, which has a higher
+/// scope than any context.
+///
+class UsdValidationContext
+{
+public:
+    /// Construct a UsdValidationContext which runs the given \p validators.
+    ///
+    /// The validators are partitioned by the task type each provides, so
+    /// that the appropriate subset is run for each of the Validate
+    /// overloads below.
+    USD_API
+    explicit UsdValidationContext(
+        const std::vector<const UsdValidator*> &validators);
+
+    /// Run all layer validators held by this context on the given \p layer,
+    /// in parallel, and return the accumulated errors.
+    ///
+    /// Validators which do not provide a UsdValidateLayerTaskFn do not
+    /// participate.
+    USD_API
+    UsdValidationErrorVector Validate(const SdfLayerHandle &layer) const;
+
+    /// Run all validators held by this context against the given
+    /// \p usdStage and return the accumulated errors.
+    ///
+    /// Layer validators are run on every layer reported by
+    /// UsdStage::GetUsedLayers, stage validators on the stage itself, and
+    /// prim validators on every prim reachable from a single traversal of
+    /// the stage (including instance proxies). All tasks run in parallel.
+    USD_API
+    UsdValidationErrorVector Validate(const UsdStagePtr &usdStage) const;
+
+    /// Run all prim validators held by this context on the given \p prims,
+    /// in parallel, and return the accumulated errors.
+    ///
+    /// This is the entry point for incremental validation: clients tracking
+    /// which subtrees were affected by layer changes can re-validate just
+    /// the affected prims rather than the entire stage.
+    USD_API
+    UsdValidationErrorVector ValidatePrims(
+        const std::vector<UsdPrim> &prims) const;
+
+private:
+    // Run the prim validators over \p prims, appending errors to \p errors
+    // under \p errorsMutex.
+    void _ValidatePrims(const std::vector<UsdPrim> &prims,
+                        UsdValidationErrorVector *errors,
+                        std::mutex *errorsMutex) const;
+
+    std::vector<const UsdValidator*> _layerValidators;
+    std::vector<const UsdValidator*> _stageValidators;
+    std::vector<const UsdValidator*> _primValidators;
+}; // UsdValidationContext
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // PXR_USD_USD_VALIDATION_CONTEXT_H
@@ -188,6 +188,10 @@ private:
     // are compliant.
     friend class UsdValidationRegistry;
 
+    // Context partitions validators by the task type each provides, so that
+    // one traversal can feed all prim validators.
+    friend class UsdValidationContext;
+
     UsdValidatorMetadata _metadata;
     std::variant<UsdValidateLayerTaskFn, 
                  UsdValidateStageTaskFn,
@@ -9,7 +9,7 @@
 
 PXR_NAMESPACE_OPEN_SCOPE
 
-TF_DEFINE_PUBLIC_TOKENS(UsdValidatorNameTokens, USD_VALIDATOR_NAMES_TOKENS);
+TF_DEFINE_PUBLIC_TOKENS(UsdValidatorNameTokens, USD_VALIDATOR_NAME_TOKENS);
 TF_DEFINE_PUBLIC_TOKENS(UsdValidatorKeywordTokens, 
                         USD_VALIDATOR_KEYWORD_TOKENS);
 
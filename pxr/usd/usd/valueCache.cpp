@@ -0,0 +1,128 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+#include "pxr/pxr.h"
+#include "pxr/usd/usd/valueCache.h"
+
+#include "pxr/usd/usd/stage.h"
+#include "pxr/base/arch/hints.h"
+#include "pxr/base/tf/diagnostic.h"
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+using _RWLock = tbb::spin_rw_mutex::scoped_lock;
+
+UsdValueCache::UsdValueCache(const UsdStageWeakPtr &stage)
+    : _stage(stage)
+{
+    if (stage) {
+        _noticeKey = TfNotice::Register(
+            TfCreateWeakPtr(this), &UsdValueCache::_OnObjectsChanged, stage);
+    } else {
+        TF_CODING_ERROR("Invalid stage");
+    }
+}
+
+UsdValueCache::~UsdValueCache()
+{
+    TfNotice::Revoke(_noticeKey);
+}
+
+bool
+UsdValueCache::Get(const UsdAttribute &attr, VtValue *value, UsdTimeCode time)
+{
+    if (!attr) {
+        return false;
+    }
+    if (ARCH_UNLIKELY(attr.GetStage() != _stage)) {
+        TF_CODING_ERROR("Attribute <%s> does not belong to this cache's "
+                        "stage; resolving uncached",
+                        attr.GetPath().GetText());
+        return attr.Get(value, time);
+    }
+
+    const SdfPath &path = attr.GetPath();
+    {
+        _RWLock lock(_mutex, /* write = */ false);
+        auto it = _cache.find(path);
+        if (it != _cache.end()) {
+            _Entry const &entry = it->second;
+            if (time.IsDefault()) {
+                if (entry.defaultValue) {
+                    *value = entry.defaultValue->first;
+                    return entry.defaultValue->second;
+                }
+            } else {
+                auto bucket = entry.timeValues.find(time);
+                if (bucket != entry.timeValues.end()) {
+                    *value = bucket->second.first;
+                    return bucket->second.second;
+                }
+            }
+        }
+    }
+
+    // Miss; resolve outside the lock, then publish the result.  If a
+    // concurrent Get for the same bucket races us, both resolve the same
+    // unchanged scene description, so either result is fine.
+    VtValue resolved;
+    const bool success = attr.Get(&resolved, time);
+    {
+        _RWLock lock(_mutex, /* write = */ true);
+        _Entry &entry = _cache[path];
+        if (time.IsDefault()) {
+            entry.defaultValue.emplace(resolved, success);
+        } else {
+            entry.timeValues[time] = std::make_pair(resolved, success);
+        }
+    }
+    *value = std::move(resolved);
+    return success;
+}
+
+void
+UsdValueCache::Clear()
+{
+    _RWLock lock(_mutex, /* write = */ true);
+    _cache.clear();
+}
+
+size_t
+UsdValueCache::GetNumCachedValues() const
+{
+    _RWLock lock(_mutex, /* write = */ false);
+    size_t numValues = 0;
+    for (auto const &entry : _cache) {
+        numValues += (entry.second.defaultValue ? 1 : 0) +
+            entry.second.timeValues.size();
+    }
+    return numValues;
+}
+
+void
+UsdValueCache::_OnObjectsChanged(const UsdNotice::ObjectsChanged &notice,
+                                 const UsdStageWeakPtr &sender)
+{
+    if (sender != _stage) {
+        return;
+    }
+    // Discard cached values at and beneath every changed path.  Info-only
+    // changes on a prim (e.g. time-related metadata) can affect resolved
+    // values on descendant properties, so subtree erasure applies to those
+    // as well.
+    _RWLock lock(_mutex, /* write = */ true);
+    for (const SdfPath &path : notice.GetResyncedPaths()) {
+        _cache.erase(path);
+    }
+    for (const SdfPath &path : notice.GetChangedInfoOnlyPaths()) {
+        _cache.erase(path);
+    }
+    for (const SdfPath &path : notice.GetResolvedAssetPathsResyncedPaths()) {
+        _cache.erase(path);
+    }
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
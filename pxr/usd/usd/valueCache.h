@@ -0,0 +1,126 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+#ifndef PXR_USD_USD_VALUE_CACHE_H
+#define PXR_USD_USD_VALUE_CACHE_H
+
+#include "pxr/pxr.h"
+#include "pxr/usd/usd/api.h"
+#include "pxr/usd/usd/attribute.h"
+#include "pxr/usd/usd/common.h"
+#include "pxr/usd/usd/notice.h"
+#include "pxr/usd/usd/timeCode.h"
+#include "pxr/usd/sdf/pathTable.h"
+#include "pxr/base/tf/weakBase.h"
+#include "pxr/base/vt/value.h"
+
+#include <tbb/spin_rw_mutex.h>
+
+#include <map>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// \class UsdValueCache
+///
+/// An opt-in cache of resolved attribute values with notice-driven
+/// invalidation.
+///
+/// UsdAttribute::Get() re-runs value resolution on every call.  Clients that
+/// repeatedly poll the same attributes -- settings panels, per-frame option
+/// queries -- can route those reads through a UsdValueCache instead.  The
+/// first Get() for an attribute at a given time resolves the value and
+/// caches it; subsequent Gets for the same attribute and time return the
+/// cached value.  The cache listens for UsdNotice::ObjectsChanged notices
+/// from its stage and discards the cached values at and beneath every
+/// resynced or changed path, so it does not return stale values, and
+/// entries untouched by an edit survive it.
+///
+/// Values are cached per attribute, bucketed by the exact UsdTimeCode
+/// queried; querying an attribute at many distinct times populates one
+/// bucket per time, so this cache is best suited to default values and
+/// values queried at a small number of recurring times.  Failed
+/// resolutions are cached as failures.
+///
+/// Get() may be called concurrently from multiple threads.  Invalidation
+/// runs during stage change processing, so the usual Usd rule applies:
+/// do not read from the cache concurrently with edits to its stage.
+///
+class UsdValueCache : public TfWeakBase
+{
+public:
+    /// Construct a cache for resolved values of attributes on \p stage.
+    USD_API
+    explicit UsdValueCache(const UsdStageWeakPtr &stage);
+
+    USD_API
+    ~UsdValueCache();
+
+    UsdValueCache(UsdValueCache const &) = delete;
+    UsdValueCache &operator=(UsdValueCache const &) = delete;
+
+    /// Resolve the value of \p attr at \p time as UsdAttribute::Get()
+    /// would, consulting and populating the cache.  Return true and fill
+    /// \p value on success, return false otherwise.  Note that failure to
+    /// resolve a value is also cached.
+    ///
+    /// \p attr must belong to this cache's stage; attributes on other
+    /// stages resolve uncached and raise a coding error.
+    USD_API
+    bool Get(const UsdAttribute &attr, VtValue *value,
+             UsdTimeCode time = UsdTimeCode::Default());
+
+    /// \overload
+    /// Typed access; returns false if the resolved value is not holding
+    /// exactly type \p T.
+    template <class T>
+    bool Get(const UsdAttribute &attr, T *value,
+             UsdTimeCode time = UsdTimeCode::Default()) {
+        static_assert(!std::is_same<T, VtValue>::value, "");
+        VtValue val;
+        if (Get(attr, &val, time) && val.IsHolding<T>()) {
+            *value = val.UncheckedGet<T>();
+            return true;
+        }
+        return false;
+    }
+
+    /// Discard every cached value.
+    USD_API
+    void Clear();
+
+    /// Return the number of cached value buckets, counting each cached
+    /// (attribute, time) pair once.  Primarily useful for measuring cache
+    /// behavior in tests and diagnostics.
+    USD_API
+    size_t GetNumCachedValues() const;
+
+    /// Return this cache's stage.
+    UsdStageWeakPtr GetStage() const { return _stage; }
+
+private:
+    // Cached resolution results for one attribute: a bucket for the
+    // default time and one per numeric time queried.  Each bucket holds
+    // the resolved value and whether resolution succeeded.
+    struct _Entry {
+        std::optional<std::pair<VtValue, bool>> defaultValue;
+        std::map<UsdTimeCode, std::pair<VtValue, bool>> timeValues;
+    };
+
+    void _OnObjectsChanged(const UsdNotice::ObjectsChanged &notice,
+                           const UsdStageWeakPtr &sender);
+
+    UsdStageWeakPtr _stage;
+    TfNotice::Key _noticeKey;
+    mutable tbb::spin_rw_mutex _mutex;
+    SdfPathTable<_Entry> _cache;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // PXR_USD_USD_VALUE_CACHE_H
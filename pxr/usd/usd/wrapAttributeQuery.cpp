@@ -14,6 +14,7 @@
 #include "pxr/base/tf/makePyConstructor.h"
 
 #include <boost/python/class.hpp>
+#include <boost/python/list.hpp>
 #include <boost/python/operators.hpp>
 #include <boost/python/tuple.hpp>
 
@@ -76,13 +77,33 @@ _GetBracketingTimeSamples(const UsdAttributeQuery& self, double desiredTime)
 }
 
 static TfPyObjWrapper
-_Get(const UsdAttributeQuery& self, UsdTimeCode time) 
+_Get(const UsdAttributeQuery& self, UsdTimeCode time)
 {
     VtValue val;
     self.Get(&val, time);
     return UsdVtValueToPython(val);
 }
 
+static list
+_GetValues(const UsdAttributeQuery& self, object times)
+{
+    vector<UsdTimeCode> timeCodes;
+    const size_t numTimes = len(times);
+    timeCodes.reserve(numTimes);
+    for (size_t i = 0; i != numTimes; ++i) {
+        timeCodes.push_back(extract<UsdTimeCode>(times[i]));
+    }
+
+    vector<VtValue> values;
+    self.GetValues(&values, timeCodes);
+
+    list result;
+    for (const VtValue& value : values) {
+        result.append(UsdVtValueToPython(value));
+    }
+    return result;
+}
+
 } // anonymous namespace 
 
 void wrapUsdAttributeQuery()
@@ -142,7 +163,9 @@ void wrapUsdAttributeQuery()
              &UsdAttributeQuery::ValueMightBeTimeVarying)
 
         .def("Get", _Get, arg("time")=UsdTimeCode::Default())
-         
+
+        .def("GetValues", _GetValues, arg("times"))
+
         ;
 
     TfPyRegisterStlSequencesFromPython<UsdAttributeQuery>();
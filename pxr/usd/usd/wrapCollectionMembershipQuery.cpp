@@ -25,6 +25,17 @@ static bool _WrapIsPathIncluded_1(
     return query.IsPathIncluded(path);
 }
 
+static boost::python::list _WrapComputePathInclusions(
+    const UsdCollectionMembershipQuery &query,
+    const SdfPathVector &sortedPaths)
+{
+    boost::python::list result;
+    for (const bool included : query.ComputePathInclusions(sortedPaths)) {
+        result.append(included);
+    }
+    return result;
+}
+
 static bool _WrapIsPathIncluded_2(
     const UsdCollectionMembershipQuery &query,
     const SdfPath &path,
@@ -100,8 +111,10 @@ wrapUsdCollectionMembershipQuery()
 
     class_<UsdCollectionMembershipQuery>("UsdCollectionMembershipQuery")
         .def("IsPathIncluded", _WrapIsPathIncluded_1, arg("path"))
-        .def("IsPathIncluded", _WrapIsPathIncluded_2, 
+        .def("IsPathIncluded", _WrapIsPathIncluded_2,
              (arg("path"), arg("parentExpansionRule")))
+        .def("ComputePathInclusions", _WrapComputePathInclusions,
+             arg("sortedPaths"))
         .def("HasExcludes", &UsdCollectionMembershipQuery::HasExcludes)
         .def("GetAsPathExpansionRuleMap",
              &UsdCollectionMembershipQuery::GetAsPathExpansionRuleMap,
@@ -0,0 +1,27 @@
+//
+// Copyright 2025 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+
+#include "pxr/pxr.h"
+#include "pxr/usd/usd/compositionStats.h"
+
+#include <boost/python/class.hpp>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+using namespace boost::python;
+
+void wrapUsdCompositionStats()
+{
+    class_<UsdCompositionStats>("CompositionStats")
+        .def_readonly("primPath", &UsdCompositionStats::primPath)
+        .def_readonly("timeNanos", &UsdCompositionStats::timeNanos)
+        .def_readonly("numCompositionArcs",
+                      &UsdCompositionStats::numCompositionArcs)
+        .def_readonly("numContributingLayers",
+                      &UsdCompositionStats::numContributingLayers)
+        ;
+}
@@ -557,6 +557,18 @@ void wrapUsdStage()
         .def("GetPrototypes", &UsdStage::GetPrototypes,
              return_value_policy<TfPySequenceToList>())
 
+        .def("GetPrototypeSharingDiagnostics",
+             &UsdStage::GetPrototypeSharingDiagnostics)
+
+        .def("IsRecordingCompositionStats",
+             &UsdStage::IsRecordingCompositionStats)
+        .def("GetMostExpensiveCompositionSubtrees",
+             &UsdStage::GetMostExpensiveCompositionSubtrees,
+             (arg("maxResults")=10),
+             return_value_policy<TfPySequenceToList>())
+
+        .def("GetMemoryReport", &UsdStage::GetMemoryReport)
+
         .def("_GetPcpCache", &Usd_PcpCacheAccess::GetPcpCache,
              return_internal_reference<>())
         ;
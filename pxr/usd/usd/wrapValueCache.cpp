@@ -0,0 +1,41 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+#include "pxr/pxr.h"
+#include "pxr/usd/usd/valueCache.h"
+
+#include "pxr/usd/usd/pyConversions.h"
+#include "pxr/base/tf/pyPtrHelpers.h"
+
+#include <boost/python/class.hpp>
+
+using namespace boost::python;
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+static object
+_Get(UsdValueCache &self, const UsdAttribute &attr, UsdTimeCode time)
+{
+    VtValue val;
+    self.Get(attr, &val, time);
+    return UsdVtValueToPython(val);
+}
+
+} // anonymous namespace
+
+void wrapUsdValueCache()
+{
+    class_<UsdValueCache, boost::noncopyable>(
+        "ValueCache", init<UsdStagePtr>(arg("stage")))
+        .def("Get", _Get,
+             (arg("attribute"), arg("time")=UsdTimeCode::Default()))
+        .def("Clear", &UsdValueCache::Clear)
+        .def("GetNumCachedValues", &UsdValueCache::GetNumCachedValues)
+        .def("GetStage", &UsdValueCache::GetStage)
+        ;
+}
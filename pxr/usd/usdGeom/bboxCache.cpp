@@ -20,6 +20,7 @@
 
 #include "pxr/base/trace/trace.h"
 
+#include "pxr/base/work/loops.h"
 #include "pxr/base/work/withScopedParallelism.h"
 
 #include "pxr/base/tf/hash.h"
@@ -586,21 +587,43 @@ UsdGeomBBoxCache::_ComputePointInstanceBoundsHelper(
     VtMatrix4dArray const &cinstanceTransforms = instanceTransforms;
 
     const UsdStagePtr stage = instancer.GetPrim().GetStage();
-    
+
+    // Resolve the untransformed bound of each prototype referenced by the
+    // requested instances up front. The per-instance work below is then
+    // pure arithmetic, which we can distribute across threads.
+    std::vector<bool> protoNeeded(protoPaths.size(), false);
     for (int64_t const *iid = instanceIdBegin, * const iend = iid + numIds;
          iid != iend; ++iid) {
+        protoNeeded[cprotoIndices[*iid]] = true;
+    }
 
-        const int protoIndex = cprotoIndices[*iid];
-        const SdfPath& protoPath = protoPaths[protoIndex];
-        const UsdPrim& protoPrim = stage->GetPrimAtPath(protoPath);
+    std::vector<GfBBox3d> protoBounds(protoPaths.size());
+    for (size_t i = 0; i < protoPaths.size(); ++i) {
+        if (protoNeeded[i]) {
+            protoBounds[i] = ComputeUntransformedBound(
+                stage->GetPrimAtPath(protoPaths[i]));
+        }
+    }
 
-        // Get the prototype bounding box and apply the instance transform and
-        // the caller's transform.
-        GfBBox3d &thisBounds = *result++;
-        thisBounds = ComputeUntransformedBound(protoPrim);
-        thisBounds.Transform(cinstanceTransforms[*iid] * xform);
+    {
+        TF_PY_ALLOW_THREADS_IN_SCOPE();
+        WorkParallelForN(
+            numIds,
+            [&cprotoIndices, &cinstanceTransforms, &protoBounds,
+             instanceIdBegin, &xform, result](size_t begin, size_t end) {
+                for (size_t i = begin; i != end; ++i) {
+                    const int64_t instanceId = instanceIdBegin[i];
+
+                    // Apply the instance transform and the caller's
+                    // transform to the prototype's bounding box.
+                    GfBBox3d &thisBounds = result[i];
+                    thisBounds = protoBounds[cprotoIndices[instanceId]];
+                    thisBounds.Transform(
+                        cinstanceTransforms[instanceId] * xform);
+                }
+            });
     }
-    
+
     return true;
 }
 
@@ -668,6 +691,119 @@ UsdGeomBBoxCache::Clear()
     _bboxCache.clear();
 }
 
+void
+UsdGeomBBoxCache::Invalidate(const UsdNotice::ObjectsChanged &notice)
+{
+    SdfPathVector subtreeRoots;
+    for (const SdfPath &path : notice.GetResyncedPaths()) {
+        subtreeRoots.push_back(path);
+    }
+    for (const SdfPath &path : notice.GetChangedInfoOnlyPaths()) {
+        subtreeRoots.push_back(path);
+    }
+    InvalidateSubtrees(subtreeRoots);
+}
+
+void
+UsdGeomBBoxCache::InvalidateSubtrees(const SdfPathVector &subtreeRoots)
+{
+    TRACE_FUNCTION();
+
+    // Normalize to unique prim paths, dropping roots that are descendants
+    // of other roots.
+    SdfPathVector roots;
+    roots.reserve(subtreeRoots.size());
+    for (const SdfPath &path : subtreeRoots) {
+        roots.push_back(path.GetAbsoluteRootOrPrimPath());
+    }
+    SdfPath::RemoveDescendentPaths(&roots);
+
+    if (roots.empty()) {
+        return;
+    }
+
+    // If the pseudo-root is affected, everything is.
+    if (roots.front() == SdfPath::AbsoluteRootPath()) {
+        Clear();
+        return;
+    }
+
+    TF_DEBUG(USDGEOM_BBOX).Msg("[BBox Cache] INVALIDATING %zu subtree(s)\n",
+                               roots.size());
+
+    // The xform cache has no subtree invalidation, and transforms under the
+    // invalidated roots may have changed. It is cheap to repopulate relative
+    // to bounds, so clear it wholesale.
+    _ctmCache.Clear();
+
+    // Sweep the cache. An entry at or below a root is invalidated entirely,
+    // since its attributes, descendants or computed purpose may have
+    // changed; an entry that's an ancestor of a root only has its
+    // accumulated bounds dropped. Prims in prototypes live at prototype
+    // paths, so when an invalidated entry is an instance we add its
+    // prototype as another root and sweep again, until the roots close over
+    // nested instancing.
+    std::vector<_PrimContext> deadEntries;
+    bool rootsChanged = true;
+    while (rootsChanged) {
+        rootsChanged = false;
+        for (auto &primAndEntry : _bboxCache) {
+            const UsdPrim &prim = primAndEntry.first.prim;
+            const SdfPath primPath = prim.GetPath();
+            _Entry &entry = primAndEntry.second;
+
+            if (SdfPathFindLongestPrefix(roots.begin(), roots.end(), primPath)
+                    != roots.end()) {
+                // A resync may have removed the prim entirely; drop the
+                // entry, since it can never be queried through again.
+                if (!prim.IsValid()) {
+                    deadEntries.push_back(primAndEntry.first);
+                    continue;
+                }
+
+                TF_DEBUG(USDGEOM_BBOX).Msg(
+                    "[BBox Cache] invalidating %s for subtree change\n",
+                    primAndEntry.first.ToString().c_str());
+
+                entry.isComplete = false;
+                entry.bboxes.clear();
+                entry.isVarying = false;
+                // The attribute queries may reference recomposed properties
+                // and the purpose may now be inherited differently.
+                entry.queries.reset();
+                entry.purposeInfo = UsdGeomImageable::PurposeInfo();
+
+                if (prim.IsInstance()) {
+                    const SdfPath prototypePath =
+                        prim.GetPrototype().GetPath();
+                    if (SdfPathFindLongestPrefix(
+                            roots.begin(), roots.end(), prototypePath)
+                                == roots.end()) {
+                        roots.push_back(prototypePath);
+                        std::sort(roots.begin(), roots.end());
+                        rootsChanged = true;
+                    }
+                }
+            } else {
+                // Ancestors aggregate the bounds of the invalidated
+                // subtrees, but their own attributes are unaffected, so we
+                // keep their queries and purpose.
+                const auto prefixedRange = SdfPathFindPrefixedRange(
+                    roots.begin(), roots.end(), primPath);
+                if (prefixedRange.first != prefixedRange.second) {
+                    entry.isComplete = false;
+                    entry.bboxes.clear();
+                    entry.isVarying = false;
+                }
+            }
+        }
+    }
+
+    for (const _PrimContext &deadEntry : deadEntries) {
+        _bboxCache.erase(deadEntry);
+    }
+}
+
 void
 UsdGeomBBoxCache::SetIncludedPurposes(const TfTokenVector& includedPurposes)
 {
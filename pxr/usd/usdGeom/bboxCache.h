@@ -12,6 +12,7 @@
 #include "pxr/usd/usdGeom/xformCache.h"
 #include "pxr/usd/usdGeom/pointInstancer.h"
 #include "pxr/usd/usd/attributeQuery.h"
+#include "pxr/usd/usd/notice.h"
 #include "pxr/base/gf/bbox3d.h"
 #include "pxr/base/tf/hash.h"
 #include "pxr/base/tf/hashmap.h"
@@ -60,7 +61,9 @@ class UsdGeomModelAPI;
 ///  * This class should only be used with valid UsdPrim objects.
 ///
 ///  * This cache does not listen for change notifications; the user is
-///    responsible for clearing the cache when changes occur.
+///    responsible for clearing the cache (see Clear()) or invalidating the
+///    affected subtrees (see Invalidate(), InvalidateSubtrees()) when
+///    changes occur.
 ///
 ///  * Thread safety: instances of this class may not be used concurrently.
 ///
@@ -303,6 +306,30 @@ public:
     USDGEOM_API
     void Clear();
 
+    /// Invalidate the cached entries affected by the scene changes described
+    /// by \p notice.
+    ///
+    /// This conservatively invalidates the subtree rooted at each resynced
+    /// or changed prim (as well as the cached bounds of its ancestors, which
+    /// aggregate it), leaving the rest of the cache intact. This is much
+    /// cheaper than calling Clear() in response to localized edits on large
+    /// stages.
+    ///
+    /// Note that this method does not filter info-only changes by property;
+    /// any changed property on a prim invalidates its subtree, since
+    /// computed extents may depend on arbitrary schema attributes.
+    USDGEOM_API
+    void Invalidate(const UsdNotice::ObjectsChanged &notice);
+
+    /// Invalidate the cached entries at or below the given \p subtreeRoots,
+    /// as well as the cached bounds of their ancestors.
+    ///
+    /// Property paths in \p subtreeRoots are treated as their owning prim's
+    /// path. If a subtree root is (or contains) an instance, the cached
+    /// entries for its prototype are invalidated as well.
+    USDGEOM_API
+    void InvalidateSubtrees(const SdfPathVector &subtreeRoots);
+
     /// Indicate the set of \p includedPurposes to use when resolving child
     /// bounds. Each child's purpose must match one of the elements of this set
     /// to be included in the computation; if it does not, child is excluded.
@@ -9,6 +9,8 @@
 #include "pxr/usd/usdGeom/boundableComputeExtent.h"
 #include "pxr/usd/usdGeom/boundable.h"
 
+#include "pxr/usd/usd/primRange.h"
+
 #include "pxr/base/js/value.h"
 #include "pxr/base/plug/notice.h"
 #include "pxr/base/plug/plugin.h"
@@ -16,8 +18,10 @@
 #include "pxr/base/tf/instantiateSingleton.h"
 #include "pxr/base/tf/singleton.h"
 #include "pxr/base/tf/weakBase.h"
+#include "pxr/base/work/loops.h"
 
 #include <tbb/queuing_rw_mutex.h>
+#include <atomic>
 #include <memory>
 #include <unordered_map>
 
@@ -72,6 +76,53 @@ public:
         }
     }
 
+    void
+    RegisterComputeBatchFunction(
+        const TfType& schemaType,
+        const UsdGeomComputeExtentBatchFunction& fn)
+    {
+        bool didInsert = false;
+        {
+            _RWMutex::scoped_lock lock(_mutex, /* write = */ true);
+            didInsert = _batchRegistry.emplace(schemaType, fn).second;
+        }
+
+        if (!didInsert) {
+            TF_CODING_ERROR(
+                "UsdGeomComputeExtentBatchFunction already registered for "
+                "prim type '%s'", schemaType.GetTypeName().c_str());
+        }
+    }
+
+    // Returns the batch function registered for the given schema type or
+    // the closest base type, or nullptr if none is registered.  Unlike
+    // GetComputeFunction this performs no plugin loading; callers are
+    // expected to have resolved the per-prim function first, which loads
+    // the plugin that registers both functions.
+    UsdGeomComputeExtentBatchFunction
+    GetComputeBatchFunction(const TfType& primSchemaType)
+    {
+        _WaitUntilInitialized();
+
+        UsdGeomComputeExtentBatchFunction fn = nullptr;
+        {
+            _RWMutex::scoped_lock lock(_mutex, /* write = */ false);
+            if (TfMapLookup(_batchRegistry, primSchemaType, &fn) && fn) {
+                return fn;
+            }
+        }
+
+        for (const TfType& type :
+                 _GetTypesThatMayHaveRegisteredFunctions(primSchemaType)) {
+            _RWMutex::scoped_lock lock(_mutex, /* write = */ false);
+            if (TfMapLookup(_batchRegistry, type, &fn) && fn) {
+                return fn;
+            }
+        }
+
+        return nullptr;
+    }
+
     UsdGeomComputeExtentFunction
     GetComputeFunction(const UsdPrim& prim)
     {
@@ -205,10 +256,14 @@ private:
     using _RWMutex = tbb::queuing_rw_mutex;
     mutable _RWMutex _mutex;
 
-    using _Registry = 
+    using _Registry =
         std::unordered_map<TfType, UsdGeomComputeExtentFunction, TfHash>;
     _Registry _registry;
 
+    using _BatchRegistry =
+        std::unordered_map<TfType, UsdGeomComputeExtentBatchFunction, TfHash>;
+    _BatchRegistry _batchRegistry;
+
     std::atomic<bool> _initialized;
 };
 
@@ -289,4 +344,122 @@ UsdGeomRegisterComputeExtentFunction(
     _FunctionRegistry::GetInstance().RegisterComputeFunction(primType, fn);
 }
 
+void
+UsdGeomRegisterComputeExtentBatchFunction(
+    const TfType& primType,
+    const UsdGeomComputeExtentBatchFunction& fn)
+{
+    if (!primType.IsA<UsdGeomBoundable>()) {
+        TF_CODING_ERROR(
+            "Prim type '%s' must derive from UsdGeomBoundable",
+            primType.GetTypeName().c_str());
+        return;
+    }
+
+    if (!fn) {
+        TF_CODING_ERROR(
+            "Invalid batch function registered for prim type '%s'",
+            primType.GetTypeName().c_str());
+        return;
+    }
+
+    _FunctionRegistry::GetInstance().RegisterComputeBatchFunction(primType, fn);
+}
+
+bool
+UsdGeomComputeExtentsForSubtree(
+    const UsdPrim& root,
+    const UsdTimeCode& time,
+    std::vector<UsdGeomBoundable>* boundables,
+    std::vector<VtVec3fArray>* extents)
+{
+    if (!root) {
+        TF_CODING_ERROR("Invalid root prim");
+        return false;
+    }
+
+    if (!boundables || !extents) {
+        TF_CODING_ERROR("Invalid pointer passed for output");
+        return false;
+    }
+
+    boundables->clear();
+    for (const UsdPrim& prim : UsdPrimRange(root)) {
+        if (const UsdGeomBoundable boundable = UsdGeomBoundable(prim)) {
+            boundables->push_back(boundable);
+        }
+    }
+
+    extents->clear();
+    extents->resize(boundables->size());
+
+    // Group prims by schema type so each type's functions are resolved
+    // (and its plugin loaded) once per group rather than once per prim.
+    std::unordered_map<TfType, std::vector<size_t>, TfHash> groups;
+    for (size_t i = 0; i != boundables->size(); ++i) {
+        groups[(*boundables)[i].GetPrim().GetPrimTypeInfo().GetSchemaType()]
+            .push_back(i);
+    }
+
+    _FunctionRegistry& registry = _FunctionRegistry::GetInstance();
+    std::atomic<bool> allSucceeded(true);
+
+    for (const auto& group : groups) {
+        const std::vector<size_t>& indices = group.second;
+
+        // Resolving the per-prim function loads the plugin for the type,
+        // which also registers any batch function it supplies.
+        const UsdGeomComputeExtentFunction fn =
+            registry.GetComputeFunction(
+                (*boundables)[indices.front()].GetPrim());
+        if (!fn) {
+            allSucceeded = false;
+            continue;
+        }
+
+        if (const UsdGeomComputeExtentBatchFunction batchFn =
+                registry.GetComputeBatchFunction(group.first)) {
+            std::vector<UsdGeomBoundable> batch;
+            batch.reserve(indices.size());
+            for (const size_t i : indices) {
+                batch.push_back((*boundables)[i]);
+            }
+
+            std::vector<VtVec3fArray> batchExtents(batch.size());
+            if (!(*batchFn)(batch.data(), batch.size(), time,
+                            /* transforms = */ nullptr,
+                            batchExtents.data())) {
+                allSucceeded = false;
+            }
+
+            for (size_t j = 0; j != indices.size(); ++j) {
+                if (batchExtents[j].size() == 2) {
+                    (*extents)[indices[j]] = std::move(batchExtents[j]);
+                } else {
+                    allSucceeded = false;
+                }
+            }
+        } else {
+            WorkParallelForN(
+                indices.size(),
+                [&](size_t begin, size_t end) {
+                    for (size_t j = begin; j != end; ++j) {
+                        const size_t i = indices[j];
+                        VtVec3fArray extent;
+                        if ((*fn)((*boundables)[i], time,
+                                  /* transform = */ nullptr, &extent) &&
+                            extent.size() == 2) {
+                            (*extents)[i] = std::move(extent);
+                        } else {
+                            allSucceeded.store(
+                                false, std::memory_order_relaxed);
+                        }
+                    }
+                });
+        }
+    }
+
+    return allSucceeded;
+}
+
 PXR_NAMESPACE_CLOSE_SCOPE
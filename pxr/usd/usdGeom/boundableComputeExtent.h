@@ -17,9 +17,12 @@
 
 #include "pxr/base/tf/type.h"
 
+#include <vector>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 class UsdGeomBoundable;
+class UsdPrim;
 class UsdTimeCode;
 
 /// Function registered with #UsdGeomRegisterComputeExtentFunction for
@@ -83,11 +86,76 @@ UsdGeomRegisterComputeExtentFunction(
 
 /// \overload
 USDGEOM_API
-void 
+void
 UsdGeomRegisterComputeExtentFunction(
-    const TfType& boundableType, 
+    const TfType& boundableType,
     const UsdGeomComputeExtentFunction& fn);
 
+/// Function registered with #UsdGeomRegisterComputeExtentBatchFunction for
+/// computing extents for a batch of \p numBoundables Boundable prims at the
+/// given time.  Each prim in \p boundables is guaranteed to be convertible
+/// to the prim type this function was registered with.  If \p transforms is
+/// not nullptr, it holds one matrix per prim and each extent is computed as
+/// if the corresponding object was first transformed by its matrix.  The
+/// function must fill \p extents[i] with the extent of \p boundables[i],
+/// leaving it empty on failure, and return true only if every extent was
+/// computed successfully.  The function must be thread-safe.
+///
+/// Batch functions let plugins amortize per-call setup and schedule their
+/// own parallelism across many prims of the same type; prim types without
+/// a registered batch function fall back to parallel invocation of their
+/// #UsdGeomComputeExtentFunction.
+using UsdGeomComputeExtentBatchFunction = bool(*)(
+    const UsdGeomBoundable* boundables,
+    size_t numBoundables,
+    const UsdTimeCode&,
+    const GfMatrix4d* transforms,
+    VtVec3fArray* extents);
+
+/// Registers \p fn as the batch function to use for computing extents for
+/// Boundable prims of type \p PrimType by
+/// #UsdGeomComputeExtentsForSubtree.  \p PrimType must derive from
+/// UsdGeomBoundable and must also have a #UsdGeomComputeExtentFunction
+/// registered; the batch function is an optional acceleration on top of it.
+///
+/// Plugins should generally call this function in the same
+/// TF_REGISTRY_FUNCTION that registers their per-prim function.
+template <class PrimType>
+inline void
+UsdGeomRegisterComputeExtentBatchFunction(
+    const UsdGeomComputeExtentBatchFunction& fn)
+{
+    static_assert(
+        std::is_base_of<UsdGeomBoundable, PrimType>::value,
+        "Prim type must derive from UsdGeomBoundable");
+
+    UsdGeomRegisterComputeExtentBatchFunction(TfType::Find<PrimType>(), fn);
+}
+
+/// \overload
+USDGEOM_API
+void
+UsdGeomRegisterComputeExtentBatchFunction(
+    const TfType& boundableType,
+    const UsdGeomComputeExtentBatchFunction& fn);
+
+/// Computes extents for all Boundable prims in the subtree rooted at
+/// \p root at the given time, in parallel.
+///
+/// Fills \p boundables with the Boundable prims found in the subtree, in
+/// traversal order, and \p extents with one extent per prim, invoking each
+/// prim type's registered batch function where one exists and its per-prim
+/// function in parallel otherwise.  Prims whose extent could not be
+/// computed are left with an empty entry in \p extents.  Returns true only
+/// if extents were computed for all Boundable prims in the subtree.
+USDGEOM_API
+bool
+UsdGeomComputeExtentsForSubtree(
+    const UsdPrim& root,
+    const UsdTimeCode& time,
+    std::vector<UsdGeomBoundable>* boundables,
+    std::vector<VtVec3fArray>* extents);
+
 PXR_NAMESPACE_CLOSE_SCOPE
 
 #endif // PXR_USD_USD_GEOM_BOUNDABLE_COMPUTE_EXTENT_H
@@ -0,0 +1,255 @@
+//
+// Copyright 2026 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+#include "pxr/pxr.h"
+#include "pxr/usd/usdGeom/inheritanceCache.h"
+#include "pxr/usd/usdGeom/tokens.h"
+
+#include "pxr/usd/usd/primRange.h"
+#include "pxr/usd/usd/stage.h"
+#include "pxr/usd/sdf/schema.h"
+
+#include "pxr/base/arch/hints.h"
+#include "pxr/base/tf/diagnostic.h"
+#include "pxr/base/trace/trace.h"
+
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+// The values a root prim inherits from: no inheritable purpose opinion,
+// 'inherited' visibility, no kind.
+static UsdGeomInheritanceCache::ResolvedValues
+_GetRootParentValues()
+{
+    UsdGeomInheritanceCache::ResolvedValues values;
+    values.visibility = UsdGeomTokens->inherited;
+    return values;
+}
+
+UsdGeomInheritanceCache::UsdGeomInheritanceCache(
+    const UsdStageWeakPtr &stage, UsdTimeCode time)
+    : _stage(stage)
+    , _time(time)
+{
+    if (stage) {
+        _noticeKey = TfNotice::Register(
+            TfCreateWeakPtr(this),
+            &UsdGeomInheritanceCache::_OnObjectsChanged, stage);
+    } else {
+        TF_CODING_ERROR("Invalid stage");
+    }
+}
+
+UsdGeomInheritanceCache::~UsdGeomInheritanceCache()
+{
+    TfNotice::Revoke(_noticeKey);
+}
+
+void
+UsdGeomInheritanceCache::SetTime(UsdTimeCode time)
+{
+    if (time == _time) {
+        return;
+    }
+    _time = time;
+    Clear();
+}
+
+UsdGeomInheritanceCache::ResolvedValues
+UsdGeomInheritanceCache::GetResolvedValues(const UsdPrim &prim)
+{
+    if (!prim) {
+        TF_CODING_ERROR("Invalid prim");
+        return _GetRootParentValues();
+    }
+    if (ARCH_UNLIKELY(prim.GetStage() != _stage)) {
+        TF_CODING_ERROR("Prim <%s> does not belong to this cache's stage",
+                        prim.GetPath().GetText());
+        return _GetRootParentValues();
+    }
+    return _Resolve(prim);
+}
+
+TfToken
+UsdGeomInheritanceCache::GetPurpose(const UsdPrim &prim)
+{
+    return GetResolvedValues(prim).purposeInfo.purpose;
+}
+
+TfToken
+UsdGeomInheritanceCache::GetVisibility(const UsdPrim &prim)
+{
+    return GetResolvedValues(prim).visibility;
+}
+
+TfToken
+UsdGeomInheritanceCache::GetKind(const UsdPrim &prim)
+{
+    return GetResolvedValues(prim).kind;
+}
+
+void
+UsdGeomInheritanceCache::ComputeSubtree(
+    const UsdPrim &root,
+    const std::function<void (const UsdPrim &, const ResolvedValues &)> &fn)
+{
+    TRACE_FUNCTION();
+
+    if (!root) {
+        TF_CODING_ERROR("Invalid root prim");
+        return;
+    }
+
+    // Each prim's values derive from its parent's in constant time, so
+    // carry the parent values down the traversal on a stack.
+    std::vector<ResolvedValues> parentStack;
+    if (const UsdPrim parent = root.GetParent()) {
+        parentStack.push_back(_Resolve(parent));
+    } else {
+        parentStack.push_back(_GetRootParentValues());
+    }
+
+    UsdPrimRange range = UsdPrimRange::PreAndPostVisit(root);
+    for (auto it = range.begin(); it != range.end(); ++it) {
+        if (it.IsPostVisit()) {
+            parentStack.pop_back();
+            continue;
+        }
+        ResolvedValues values = _ResolveFromParent(*it, parentStack.back());
+        _cache[it->GetPath()] = values;
+        if (fn) {
+            fn(*it, values);
+        }
+        parentStack.push_back(std::move(values));
+    }
+}
+
+void
+UsdGeomInheritanceCache::Clear()
+{
+    _cache.clear();
+}
+
+UsdGeomInheritanceCache::ResolvedValues
+UsdGeomInheritanceCache::_Resolve(const UsdPrim &prim)
+{
+    const auto it = _cache.find(prim.GetPath());
+    if (it != _cache.end()) {
+        return it->second;
+    }
+
+    ResolvedValues values = _ResolveFromParent(
+        prim,
+        prim.GetParent() ? _Resolve(prim.GetParent()) :
+                           _GetRootParentValues());
+    _cache[prim.GetPath()] = values;
+    return values;
+}
+
+UsdGeomInheritanceCache::ResolvedValues
+UsdGeomInheritanceCache::_ResolveFromParent(
+    const UsdPrim &prim, const ResolvedValues &parentValues) const
+{
+    ResolvedValues values;
+
+    const UsdGeomImageable ip(prim);
+
+    // Visibility is pruning: once an ancestor is invisible, so is the
+    // whole subtree.  See UsdGeomImageable::ComputeVisibility().
+    TfToken localVis;
+    if (ip) {
+        ip.GetVisibilityAttr().Get(&localVis, _time);
+    }
+    values.visibility =
+        (localVis == UsdGeomTokens->invisible ||
+         parentValues.visibility == UsdGeomTokens->invisible)
+        ? UsdGeomTokens->invisible
+        : UsdGeomTokens->inherited;
+
+    // Purpose uses the incremental form of ComputePurposeInfo, which is
+    // exactly the per-prim step of the reference implementation.
+    values.purposeInfo = ip.ComputePurposeInfo(parentValues.purposeInfo);
+
+    // Kind is taken from the prim when authored, otherwise inherited from
+    // the nearest ancestor with an authored kind.
+    TfToken authoredKind;
+    values.kind = prim.GetKind(&authoredKind) ? authoredKind :
+        parentValues.kind;
+
+    return values;
+}
+
+void
+UsdGeomInheritanceCache::_OnObjectsChanged(
+    const UsdNotice::ObjectsChanged &notice, const UsdStageWeakPtr &sender)
+{
+    if (sender != _stage) {
+        return;
+    }
+
+    SdfPathVector subtreeRoots;
+    for (const SdfPath &path : notice.GetResyncedPaths()) {
+        subtreeRoots.push_back(path);
+    }
+    for (const SdfPath &path : notice.GetChangedInfoOnlyPaths()) {
+        if (path.IsPrimPropertyPath()) {
+            // Only purpose and visibility opinions feed the table.
+            const TfToken &name = path.GetNameToken();
+            if (name == UsdGeomTokens->visibility ||
+                name == UsdGeomTokens->purpose) {
+                subtreeRoots.push_back(path);
+            }
+        } else if (path.IsAbsoluteRootOrPrimPath()) {
+            // Metadata change on a prim; only kind feeds the table.
+            for (const TfToken &field : notice.GetChangedFields(path)) {
+                if (field == SdfFieldKeys->Kind) {
+                    subtreeRoots.push_back(path);
+                    break;
+                }
+            }
+        }
+    }
+    _InvalidateSubtrees(subtreeRoots);
+}
+
+void
+UsdGeomInheritanceCache::_InvalidateSubtrees(
+    const SdfPathVector &subtreeRoots)
+{
+    // Normalize to unique prim paths, dropping roots that are descendants
+    // of other roots.
+    SdfPathVector roots;
+    roots.reserve(subtreeRoots.size());
+    for (const SdfPath &path : subtreeRoots) {
+        roots.push_back(path.GetAbsoluteRootOrPrimPath());
+    }
+    SdfPath::RemoveDescendentPaths(&roots);
+
+    if (roots.empty()) {
+        return;
+    }
+    if (roots.front() == SdfPath::AbsoluteRootPath()) {
+        Clear();
+        return;
+    }
+
+    // Resolved values depend only on ancestors, so entries outside the
+    // changed subtrees remain valid and survive the sweep.
+    std::vector<SdfPath> deadEntries;
+    for (const auto &pathAndValues : _cache) {
+        const SdfPath &path = pathAndValues.first;
+        if (SdfPathFindLongestPrefix(roots.begin(), roots.end(), path)
+                != roots.end()) {
+            deadEntries.push_back(path);
+        }
+    }
+    for (const SdfPath &path : deadEntries) {
+        _cache.erase(path);
+    }
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
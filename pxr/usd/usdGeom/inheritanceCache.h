@@ -0,0 +1,150 @@
+//
+// Copyright 2026 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+#ifndef PXR_USD_USD_GEOM_INHERITANCE_CACHE_H
+#define PXR_USD_USD_GEOM_INHERITANCE_CACHE_H
+
+#include "pxr/pxr.h"
+#include "pxr/usd/usdGeom/api.h"
+#include "pxr/usd/usdGeom/imageable.h"
+#include "pxr/usd/usd/common.h"
+#include "pxr/usd/usd/notice.h"
+#include "pxr/usd/usd/prim.h"
+#include "pxr/usd/sdf/path.h"
+
+#include "pxr/base/tf/hashmap.h"
+#include "pxr/base/tf/token.h"
+#include "pxr/base/tf/weakBase.h"
+
+#include <functional>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// \class UsdGeomInheritanceCache
+///
+/// A stage-level table of resolved inherited attributes -- purpose,
+/// visibility and kind -- with notice-driven incremental invalidation.
+///
+/// UsdGeomImageable::ComputePurpose() and ComputeVisibility() walk the
+/// prim's ancestors on every call, so resolving them for each prim of a
+/// large stage is quadratic in namespace depth.  This cache resolves each
+/// prim at most once per edit: a query walks up only until it reaches an
+/// already-cached ancestor, and ComputeSubtree() resolves an entire
+/// subtree in a single top-down traversal where each prim derives its
+/// values from its parent's in constant time.
+///
+/// The cache listens for UsdNotice::ObjectsChanged notices from its stage
+/// and discards the entries at and beneath every resynced prim and every
+/// prim with a changed purpose, visibility or kind opinion, leaving the
+/// rest of the table intact.  Clients therefore never need to clear it
+/// explicitly in response to edits.
+///
+/// Visibility is resolved at the time passed to the constructor or
+/// SetTime(); changing the time clears the table.  Purpose and kind are
+/// not time-varying.
+///
+/// The Get and Compute methods mutate internal state and are not thread
+/// safe; use one instance per thread, or populate via ComputeSubtree()
+/// before reading concurrently.  Invalidation runs during stage change
+/// processing, so the usual Usd rule applies: do not query the cache
+/// concurrently with edits to its stage.
+///
+class UsdGeomInheritanceCache : public TfWeakBase
+{
+public:
+    /// The resolved inherited values for a prim.
+    struct ResolvedValues {
+        /// The prim's purpose and whether namespace children without
+        /// their own opinion inherit it; see
+        /// UsdGeomImageable::ComputePurposeInfo().
+        UsdGeomImageable::PurposeInfo purposeInfo;
+
+        /// The prim's computed visibility: either 'inherited' or
+        /// 'invisible'; see UsdGeomImageable::ComputeVisibility().
+        TfToken visibility;
+
+        /// The prim's kind, inherited from the nearest ancestor with an
+        /// authored kind when the prim has none.  Empty if no kind is
+        /// authored on the prim or any ancestor.
+        TfToken kind;
+    };
+
+    /// Construct a cache for \p stage that resolves visibility at
+    /// \p time.
+    USDGEOM_API
+    explicit UsdGeomInheritanceCache(
+        const UsdStageWeakPtr &stage,
+        UsdTimeCode time = UsdTimeCode::Default());
+
+    USDGEOM_API
+    ~UsdGeomInheritanceCache();
+
+    UsdGeomInheritanceCache(UsdGeomInheritanceCache const &) = delete;
+    UsdGeomInheritanceCache &operator=(
+        UsdGeomInheritanceCache const &) = delete;
+
+    /// Return the time at which visibility is resolved.
+    UsdTimeCode GetTime() const { return _time; }
+
+    /// Use \p time for visibility resolution.  Clears the table if
+    /// \p time differs from the current time.
+    USDGEOM_API
+    void SetTime(UsdTimeCode time);
+
+    /// Return the resolved values for \p prim, resolving and caching
+    /// them and any uncached ancestors if necessary.
+    USDGEOM_API
+    ResolvedValues GetResolvedValues(const UsdPrim &prim);
+
+    /// Equivalent to GetResolvedValues(prim).purposeInfo.purpose.
+    USDGEOM_API
+    TfToken GetPurpose(const UsdPrim &prim);
+
+    /// Equivalent to GetResolvedValues(prim).visibility.
+    USDGEOM_API
+    TfToken GetVisibility(const UsdPrim &prim);
+
+    /// Equivalent to GetResolvedValues(prim).kind.
+    USDGEOM_API
+    TfToken GetKind(const UsdPrim &prim);
+
+    /// Resolve every prim at and beneath \p root in a single top-down
+    /// traversal, invoking \p fn for each prim with its resolved values.
+    /// All visited prims are cached.  This is the preferred entry point
+    /// for stage-wide consumers such as exporters.
+    USDGEOM_API
+    void ComputeSubtree(
+        const UsdPrim &root,
+        const std::function<
+            void (const UsdPrim &, const ResolvedValues &)> &fn);
+
+    /// Clears all cached values.
+    USDGEOM_API
+    void Clear();
+
+private:
+    ResolvedValues _Resolve(const UsdPrim &prim);
+
+    ResolvedValues _ResolveFromParent(
+        const UsdPrim &prim, const ResolvedValues &parentValues) const;
+
+    void _OnObjectsChanged(const UsdNotice::ObjectsChanged &notice,
+                           const UsdStageWeakPtr &sender);
+
+    void _InvalidateSubtrees(const SdfPathVector &subtreeRoots);
+
+    UsdStageWeakPtr _stage;
+    UsdTimeCode _time;
+    TfNotice::Key _noticeKey;
+
+    using _PathToValuesMap =
+        TfHashMap<SdfPath, ResolvedValues, SdfPath::Hash>;
+    _PathToValuesMap _cache;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // PXR_USD_USD_GEOM_INHERITANCE_CACHE_H
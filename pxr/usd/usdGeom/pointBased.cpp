@@ -183,10 +183,13 @@ PXR_NAMESPACE_CLOSE_SCOPE
 #include "pxr/usd/usdGeom/boundableComputeExtent.h"
 #include "pxr/usd/usdGeom/motionAPI.h"
 #include "pxr/base/tf/registryManager.h"
+#include "pxr/base/gf/math.h"
 #include "pxr/base/gf/transform.h"
 #include "pxr/base/work/loops.h"
 #include "pxr/base/work/reduce.h"
 
+#include <limits>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 TfToken 
@@ -250,8 +253,22 @@ UsdGeomPointBased::ComputeExtent(const VtVec3fArray& points,
 {
     return _ComputeExtentImpl(points, extent,
         [&points](size_t b, size_t e, GfRange3d init){
+            // Accumulate component-wise with branchless min/max so the
+            // compiler can vectorize the loop, and widen to double only
+            // once per chunk.
+            GfVec3f bmin(std::numeric_limits<float>::max());
+            GfVec3f bmax(std::numeric_limits<float>::lowest());
             for (size_t i = b; i != e; ++i) {
-                init.UnionWith(points[i]);
+                const GfVec3f& p = points[i];
+                bmin[0] = GfMin(bmin[0], p[0]);
+                bmin[1] = GfMin(bmin[1], p[1]);
+                bmin[2] = GfMin(bmin[2], p[2]);
+                bmax[0] = GfMax(bmax[0], p[0]);
+                bmax[1] = GfMax(bmax[1], p[1]);
+                bmax[2] = GfMax(bmax[2], p[2]);
+            }
+            if (b != e) {
+                init.UnionWith(GfRange3d(GfVec3d(bmin), GfVec3d(bmax)));
             }
             return init;
         }
@@ -264,8 +281,21 @@ UsdGeomPointBased::ComputeExtent(const VtVec3fArray& points,
 {
     return _ComputeExtentImpl(points, extent,
         [&points, &transform](size_t b, size_t e, GfRange3d init){
+            // As above, but accumulate in double since the transformed
+            // points are computed in double precision anyway.
+            GfVec3d bmin(std::numeric_limits<double>::max());
+            GfVec3d bmax(std::numeric_limits<double>::lowest());
             for (size_t i = b; i != e; ++i) {
-                init.UnionWith(transform.Transform(points[i]));
+                const GfVec3d p = transform.Transform(points[i]);
+                bmin[0] = GfMin(bmin[0], p[0]);
+                bmin[1] = GfMin(bmin[1], p[1]);
+                bmin[2] = GfMin(bmin[2], p[2]);
+                bmax[0] = GfMax(bmax[0], p[0]);
+                bmax[1] = GfMax(bmax[1], p[1]);
+                bmax[2] = GfMax(bmax[2], p[2]);
+            }
+            if (b != e) {
+                init.UnionWith(GfRange3d(bmin, bmax));
             }
             return init;
         }
@@ -92,6 +92,14 @@ PXR_NAMESPACE_CLOSE_SCOPE
 // ===================================================================== //
 // --(BEGIN CUSTOM CODE)--
 
+#include "pxr/usd/usd/primRange.h"
+
+#include "pxr/base/tf/hashmap.h"
+#include "pxr/base/tf/pyLock.h"
+#include "pxr/base/work/loops.h"
+
+#include <memory>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 UsdGeomPrimvar 
@@ -489,6 +497,106 @@ UsdGeomPrimvarsAPI::FindPrimvarsWithInheritance(
     return primvars.empty() ? inheritedFromAncestors : primvars;
 }
 
+/* static */
+std::vector<std::vector<UsdGeomPrimvar>>
+UsdGeomPrimvarsAPI::ComputePrimvarsWithInheritance(
+    const UsdPrim &root,
+    std::vector<UsdPrim> *prims,
+    const Usd_PrimFlagsPredicate &predicate)
+{
+    TRACE_FUNCTION();
+
+    std::vector<std::vector<UsdGeomPrimvar>> result;
+    if (!prims) {
+        TF_CODING_ERROR("'prims' pointer is null.");
+        return result;
+    }
+    prims->clear();
+    if (!root) {
+        TF_CODING_ERROR("ComputePrimvarsWithInheritance called on invalid "
+                        "prim: %s", UsdDescribe(root).c_str());
+        return result;
+    }
+
+    // Gather the subtree in a single traversal, recording each prim's
+    // parent index so that inherited primvars can be propagated from
+    // parent to child without re-walking ancestors, and bucketing the
+    // prims by namespace depth so that independent prims within a depth
+    // level can be processed in parallel below.
+    constexpr size_t invalidIndex = ~size_t(0);
+    std::vector<size_t> parentIndices;
+    std::vector<std::vector<size_t>> indicesPerDepth;
+    TfHashMap<SdfPath, size_t, SdfPath::Hash> indexForPath;
+    const size_t rootDepth = root.GetPath().GetPathElementCount();
+    for (const UsdPrim &prim : UsdPrimRange(root, predicate)) {
+        const size_t index = prims->size();
+        indexForPath[prim.GetPath()] = index;
+        if (prim == root) {
+            parentIndices.push_back(invalidIndex);
+        } else {
+            parentIndices.push_back(
+                indexForPath.find(prim.GetPath().GetParentPath())->second);
+        }
+        const size_t depth = prim.GetPath().GetPathElementCount() - rootDepth;
+        if (indicesPerDepth.size() <= depth) {
+            indicesPerDepth.resize(depth + 1);
+        }
+        indicesPerDepth[depth].push_back(index);
+        prims->push_back(prim);
+    }
+    result.resize(prims->size());
+
+    // Resolve the primvars inherited by the root from its ancestors once;
+    // every prim in the subtree builds on this result.
+    std::vector<UsdGeomPrimvar> fromRootAncestors;
+    if (const UsdPrim parent = root.GetParent()) {
+        fromRootAncestors =
+            UsdGeomPrimvarsAPI(parent).FindInheritablePrimvars();
+    }
+    const auto rootAncestorPrimvars =
+        std::make_shared<const std::vector<UsdGeomPrimvar>>(
+            std::move(fromRootAncestors));
+
+    // The primvars each prim makes inheritable to its children. When a
+    // prim does not alter the inherited set, it shares its parent's
+    // vector rather than copying it.
+    std::vector<std::shared_ptr<const std::vector<UsdGeomPrimvar>>>
+        inheritablePrimvars(prims->size());
+
+    TF_PY_ALLOW_THREADS_IN_SCOPE();
+
+    // Process the prims level by level, so that each prim's parent has
+    // published its inheritable primvars by the time the prim itself is
+    // visited. Within a level all prims are independent.
+    for (const std::vector<size_t> &indices : indicesPerDepth) {
+        WorkParallelForN(
+            indices.size(),
+            [&](size_t begin, size_t end) {
+                for (size_t i = begin; i != end; ++i) {
+                    const size_t index = indices[i];
+                    const UsdGeomPrimvarsAPI pvAPI((*prims)[index]);
+                    const size_t parentIndex = parentIndices[index];
+                    const std::shared_ptr<const std::vector<UsdGeomPrimvar>>
+                        &fromAncestors = parentIndex == invalidIndex
+                            ? rootAncestorPrimvars
+                            : inheritablePrimvars[parentIndex];
+                    result[index] =
+                        pvAPI.FindPrimvarsWithInheritance(*fromAncestors);
+                    std::vector<UsdGeomPrimvar> inheritable =
+                        pvAPI.FindIncrementallyInheritablePrimvars(
+                            *fromAncestors);
+                    inheritablePrimvars[index] = inheritable.empty()
+                        ? fromAncestors
+                        : std::make_shared<
+                              const std::vector<UsdGeomPrimvar>>(
+                                  std::move(inheritable));
+                }
+            });
+    }
+
+    return result;
+}
+
 
 bool
 UsdGeomPrimvarsAPI::HasPrimvar(const TfToken &name) const
@@ -410,6 +410,30 @@ public:
     std::vector<UsdGeomPrimvar> FindPrimvarsWithInheritance(
         const std::vector<UsdGeomPrimvar> &inheritedFromAncestors) const;
 
+    /// Compute the value-producing primvars, either defined locally or
+    /// inherited from ancestors, for every prim in the subtree rooted at
+    /// \p root that passes \p predicate.
+    ///
+    /// The subtree is traversed only once: each prim's inherited primvars
+    /// are computed incrementally from its parent's (see
+    /// FindIncrementallyInheritablePrimvars()), ancestors *above* \p root
+    /// are resolved once rather than once per prim, and independent prims
+    /// are processed in parallel.  This makes it far cheaper than calling
+    /// FindPrimvarsWithInheritance() on each prim of a large subtree,
+    /// which re-walks the full ancestor chain per prim.
+    ///
+    /// The visited prims are returned in \p prims, in UsdPrimRange order,
+    /// and element *i* of the returned vector holds the primvars that
+    /// FindPrimvarsWithInheritance() would return for `(*prims)[i]`.
+    ///
+    /// \sa \ref usdGeom_PrimvarFetchingAPI
+    USDGEOM_API
+    static std::vector<std::vector<UsdGeomPrimvar>>
+    ComputePrimvarsWithInheritance(
+        const UsdPrim &root,
+        std::vector<UsdPrim> *prims,
+        const Usd_PrimFlagsPredicate &predicate = UsdPrimDefaultPredicate);
+
     /// Is there a defined Primvar \p name on this prim?
     ///
     /// Name lookup will account for Primvar namespacing.
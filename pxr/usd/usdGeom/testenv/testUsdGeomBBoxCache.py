@@ -528,6 +528,60 @@ def TestMeshBounds():
             expectedExtent
     
 
+def TestInvalidation():
+    """ Tests incremental invalidation of cached bounds via Invalidate()
+        and InvalidateSubtrees().
+    """
+    stage = Usd.Stage.CreateInMemory()
+    UsdGeom.Xform.Define(stage, "/World/A")
+    sphere = UsdGeom.Sphere.Define(stage, "/World/A/sphere")
+    UsdGeom.Xform.Define(stage, "/World/B")
+    cube = UsdGeom.Cube.Define(stage, "/World/B/cube")
+    world = stage.GetPrimAtPath("/World")
+
+    purposes = [UsdGeom.Tokens.default_]
+    bboxCache = UsdGeom.BBoxCache(Usd.TimeCode.Default(),
+                                  includedPurposes=purposes)
+    oldWorldBound = bboxCache.ComputeWorldBound(world)
+
+    # Feed the ObjectsChanged notices resulting from an edit back into the
+    # cache; note that the notice is only valid during delivery.
+    def _OnObjectsChanged(notice, sender):
+        bboxCache.Invalidate(notice)
+    listener = Tf.Notice.Register(
+        Usd.Notice.ObjectsChanged, _OnObjectsChanged, stage)
+    sphere.GetRadiusAttr().Set(5.0)
+    listener.Revoke()
+
+    freshCache = UsdGeom.BBoxCache(Usd.TimeCode.Default(),
+                                   includedPurposes=purposes)
+    newWorldBound = bboxCache.ComputeWorldBound(world)
+    assert newWorldBound != oldWorldBound
+    AssertBBoxesClose(newWorldBound, freshCache.ComputeWorldBound(world),
+                      "world bound is stale after Invalidate()")
+    AssertBBoxesClose(bboxCache.ComputeWorldBound(cube.GetPrim()),
+                      freshCache.ComputeWorldBound(cube.GetPrim()),
+                      "unaffected subtree changed after Invalidate()")
+
+    # Direct subtree invalidation without a notice.
+    sphere.GetRadiusAttr().Set(10.0)
+    bboxCache.InvalidateSubtrees([sphere.GetPath()])
+    freshCache = UsdGeom.BBoxCache(Usd.TimeCode.Default(),
+                                   includedPurposes=purposes)
+    AssertBBoxesClose(bboxCache.ComputeWorldBound(world),
+                      freshCache.ComputeWorldBound(world),
+                      "world bound is stale after InvalidateSubtrees()")
+
+    # Removing a prim must both invalidate the ancestor bounds and drop the
+    # cache entries for the removed subtree.
+    stage.RemovePrim(cube.GetPath())
+    bboxCache.InvalidateSubtrees([cube.GetPath()])
+    freshCache = UsdGeom.BBoxCache(Usd.TimeCode.Default(),
+                                   includedPurposes=purposes)
+    AssertBBoxesClose(bboxCache.ComputeWorldBound(world),
+                      freshCache.ComputeWorldBound(world),
+                      "world bound is stale after removing a prim")
+
 if __name__ == "__main__":
     Main()
     TestWithInstancing()
@@ -536,6 +590,7 @@ if __name__ == "__main__":
     TestIgnoredPrims()
     TestIgnoreVisibility()
     TestPurposeWithInstancing()
+    TestInvalidation()
     
     # Turn off debug symbol for these regression tests.
     Tf.Debug.SetDebugSymbolsByName("USDGEOM_BBOX", 0)
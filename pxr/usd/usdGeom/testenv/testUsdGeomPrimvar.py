@@ -584,7 +584,24 @@ class TestUsdGeomPrimvarsAPI(unittest.TestCase):
         self.assertEqual(len(s5_full), 3)
         s5_incr = s5p.FindPrimvarsWithInheritance(s4_pvars)
         self.assertEqual(set(s5_full), set(s5_incr))
-       
+
+        # Test the bulk subtree query, which must agree with the per-prim
+        # FindPrimvarsWithInheritance() results for every visited prim.
+        bulk = UsdGeom.PrimvarsAPI.ComputePrimvarsWithInheritance(
+            s0.GetPrim())
+        self.assertEqual([prim.GetPath() for prim, _ in bulk],
+                         [p.GetPath() for p in Usd.PrimRange(s0.GetPrim())])
+        for prim, primvars in bulk:
+            expected = UsdGeom.PrimvarsAPI(prim).FindPrimvarsWithInheritance()
+            self.assertEqual(set(primvars), set(expected))
+        # Rooting the query below authored primvars must still resolve the
+        # primvars inherited from ancestors above the root.
+        bulk = UsdGeom.PrimvarsAPI.ComputePrimvarsWithInheritance(
+            s3.GetPrim(), Usd.PrimDefaultPredicate)
+        for prim, primvars in bulk:
+            expected = UsdGeom.PrimvarsAPI(prim).FindPrimvarsWithInheritance()
+            self.assertEqual(set(primvars), set(expected))
+
 
 
         # Test HasPossiblyInheritedPrimvar().
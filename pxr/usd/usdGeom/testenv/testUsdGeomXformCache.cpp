@@ -13,6 +13,7 @@
 #include "pxr/usd/usdGeom/scope.h"
 
 #include <iostream>
+#include <vector>
 
 PXR_NAMESPACE_USING_DIRECTIVE
 
@@ -275,6 +276,24 @@ void VerifyTransforms(UsdStageRefPtr const& stage,
     TF_VERIFY(ctm == (xform),
               "ComputeRelativeTransform value for (%s,%s) is incorrect.",
               bar.GetPath().GetText(), root.GetPath().GetText());
+
+    // --------------------------------------------------------------------- //
+    // Test ComputeLocalToWorldTransforms
+    // --------------------------------------------------------------------- //
+
+    // Batched computation through a fresh cache must agree with the
+    // per-prim queries above.
+    UsdGeomXformCache batchCache(xfCache.GetTime());
+    const std::vector<UsdPrim> prims = {
+        stage->GetPseudoRoot(), root, foo, fooBar, fooBarBaz, bar };
+    std::vector<GfMatrix4d> ctms;
+    batchCache.ComputeLocalToWorldTransforms(prims, &ctms);
+    TF_VERIFY(ctms.size() == prims.size());
+    for (size_t i = 0; i < prims.size(); ++i) {
+        TF_VERIFY(ctms[i] == xfCache.GetLocalToWorldTransform(prims[i]),
+                  "Batched LocalToWorldTransform value for %s is incorrect.",
+                  prims[i].GetPath().GetText());
+    }
 }
 
 void XformCacheTest(UsdStageRefPtr const& stage)
@@ -151,6 +151,9 @@ void wrapUsdGeomBBoxCache()
              (arg("instancer"), arg("instanceId")))
         
         .def("Clear", &BBoxCache::Clear)
+        .def("Invalidate", &BBoxCache::Invalidate, arg("notice"))
+        .def("InvalidateSubtrees", &BBoxCache::InvalidateSubtrees,
+             arg("subtreeRoots"))
         .def("SetIncludedPurposes", &BBoxCache::SetIncludedPurposes,
              arg("includedPurposes"))
         .def("GetIncludedPurposes", &BBoxCache::GetIncludedPurposes,
@@ -108,6 +108,32 @@ _CreateNonIndexedPrimvar(const UsdGeomPrimvarsAPI &self, const TfToken &name,
             elementSize, time);
 }
 
+static list
+_ComputePrimvarsWithInheritance(const UsdPrim &root,
+                                const Usd_PrimFlagsPredicate &predicate)
+{
+    std::vector<UsdPrim> prims;
+    const std::vector<std::vector<UsdGeomPrimvar>> primvars =
+        UsdGeomPrimvarsAPI::ComputePrimvarsWithInheritance(
+            root, &prims, predicate);
+
+    list result;
+    for (size_t i = 0; i < prims.size(); ++i) {
+        list primvarList;
+        for (const UsdGeomPrimvar &pv : primvars[i]) {
+            primvarList.append(pv);
+        }
+        result.append(make_tuple(prims[i], primvarList));
+    }
+    return result;
+}
+
+static list
+_ComputePrimvarsWithInheritanceDefault(const UsdPrim &root)
+{
+    return _ComputePrimvarsWithInheritance(root, UsdPrimDefaultPredicate);
+}
+
 static UsdGeomPrimvar
 _CreateIndexedPrimvar(const UsdGeomPrimvarsAPI &self, const TfToken &name, 
         const SdfValueTypeName &typeName, const object &pyVal, 
@@ -166,6 +192,13 @@ WRAP_CUSTOM {
              (std::vector<UsdGeomPrimvar> (UsdGeomPrimvarsAPI::*)(const std::vector<UsdGeomPrimvar>&) const)&UsdGeomPrimvarsAPI::FindPrimvarsWithInheritance,
              (arg("inheritedFromAncestors")),
              return_value_policy<TfPySequenceToList>())
+        .def("ComputePrimvarsWithInheritance",
+             &_ComputePrimvarsWithInheritanceDefault,
+             (arg("root")))
+        .def("ComputePrimvarsWithInheritance",
+             &_ComputePrimvarsWithInheritance,
+             (arg("root"), arg("predicate")))
+        .staticmethod("ComputePrimvarsWithInheritance")
         .def("HasPrimvar", &UsdGeomPrimvarsAPI::HasPrimvar, arg("name"))
         .def("HasPossiblyInheritedPrimvar", 
              &UsdGeomPrimvarsAPI::HasPossiblyInheritedPrimvar,
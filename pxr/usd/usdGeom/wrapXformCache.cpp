@@ -8,6 +8,7 @@
 #include "pxr/usd/usdGeom/xformCache.h"
 
 #include <boost/python/class.hpp>
+#include <boost/python/stl_iterator.hpp>
 
 using namespace boost::python;
 
@@ -40,7 +41,22 @@ _ComputeRelativeTransform(UsdGeomXformCache& self,
     return make_tuple(xform, resetXformStack);
 }
 
-} // anonymous namespace 
+static
+list
+_ComputeLocalToWorldTransforms(UsdGeomXformCache& self, object prims)
+{
+    boost::python::stl_input_iterator<UsdPrim> begin(prims), end;
+    std::vector<UsdPrim> primVec(begin, end);
+    std::vector<GfMatrix4d> xforms;
+    self.ComputeLocalToWorldTransforms(primVec, &xforms);
+
+    list ret;
+    for (auto const &xform: xforms)
+        ret.append(xform);
+    return ret;
+}
+
+} // anonymous namespace
 
 void wrapUsdGeomXformCache()
 {
@@ -56,6 +72,8 @@ void wrapUsdGeomXformCache()
              &_GetLocalTransformation, arg("prim"))
         .def("ComputeRelativeTransform",
              &_ComputeRelativeTransform, (arg("prim"), arg("ancestor")))
+        .def("ComputeLocalToWorldTransforms",
+             &_ComputeLocalToWorldTransforms, arg("prims"))
         .def("Clear", &XformCache::Clear)
         .def("SetTime", &XformCache::SetTime, arg("time"))
         .def("GetTime", &XformCache::GetTime)
@@ -11,6 +11,10 @@
 #include "pxr/base/trace/trace.h"
 
 #include "pxr/base/tf/diagnostic.h"
+#include "pxr/base/tf/hashset.h"
+#include "pxr/base/tf/pyLock.h"
+
+#include "pxr/base/work/loops.h"
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -136,6 +140,88 @@ UsdGeomXformCache::ComputeRelativeTransform(const UsdPrim &prim,
     return xform;
 }
 
+void
+UsdGeomXformCache::ComputeLocalToWorldTransforms(
+    const std::vector<UsdPrim> &prims,
+    std::vector<GfMatrix4d> *xforms)
+{
+    TRACE_FUNCTION();
+
+    if (!xforms) {
+        TF_CODING_ERROR("'xforms' pointer is null.");
+        return;
+    }
+    xforms->assign(prims.size(), GfMatrix4d(1));
+
+    // Gather the prims whose ctms still need to be resolved, together with
+    // their ancestors, bucketed by namespace depth. Walking up from each
+    // requested prim stops at the first prim that is already queued or has
+    // a valid cached ctm, so each shared ancestor is visited only once.
+    // All cache mutation happens here, serially; the parallel phase below
+    // only fills in the entries created here.
+    struct _WorkItem {
+        UsdPrim prim;
+        _Entry *entry;
+    };
+    std::vector<std::vector<_WorkItem>> itemsPerDepth;
+    TfHashSet<UsdPrim, TfHash> queued;
+    for (const UsdPrim &prim : prims) {
+        for (UsdPrim p = prim; p; p = p.GetParent()) {
+            _Entry *entry = _GetCacheEntryForPrim(p);
+            if (entry->ctmIsValid || !queued.insert(p).second) {
+                break;
+            }
+            const size_t depth = p.GetPath().GetPathElementCount();
+            if (itemsPerDepth.size() <= depth) {
+                itemsPerDepth.resize(depth + 1);
+            }
+            itemsPerDepth[depth].push_back({p, entry});
+        }
+    }
+
+    // Drop the GIL if we have it, since value resolution in worker threads
+    // may invoke plugin code that needs it.
+    TF_PY_ALLOW_THREADS_IN_SCOPE();
+
+    // Resolve and compose the ctms level by level, so that a prim's parent
+    // ctm is always valid by the time the prim itself is processed. Within
+    // a level all prims are independent, so the local transform resolution
+    // and the matrix composition run in parallel.
+    for (const std::vector<_WorkItem> &items : itemsPerDepth) {
+        WorkParallelForN(
+            items.size(),
+            [this, &items](size_t begin, size_t end) {
+                for (size_t i = begin; i != end; ++i) {
+                    const _WorkItem &item = items[i];
+                    GfMatrix4d xform(1.);
+                    item.entry->query.GetLocalTransformation(&xform, _time);
+                    if (!item.entry->query.GetResetXformStack()) {
+                        if (const UsdPrim parent = item.prim.GetParent()) {
+                            // The parent's entry exists and was validated
+                            // at a shallower level.
+                            const auto it = _ctmCache.find(parent);
+                            if (TF_VERIFY(it != _ctmCache.end() &&
+                                          it->second.ctmIsValid)) {
+                                xform = xform * it->second.ctm;
+                            }
+                        }
+                    }
+                    item.entry->ctm = xform;
+                    item.entry->ctmIsValid = true;
+                }
+            });
+    }
+
+    // Copy out the requested ctms, which are now all cached. Invalid prims
+    // keep the identity, matching GetLocalToWorldTransform's treatment of
+    // the pseudo-root's (invalid) parent.
+    for (size_t i = 0; i < prims.size(); ++i) {
+        if (prims[i]) {
+            (*xforms)[i] = _ctmCache.find(prims[i])->second.ctm;
+        }
+    }
+}
+
 GfMatrix4d const*
 UsdGeomXformCache::_GetCtm(const UsdPrim& prim)
 {
@@ -0,0 +1,267 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+#include "pxr/usd/usdLux/lightListCache.h"
+
+#include "pxr/base/trace/trace.h"
+#include "pxr/usd/usd/primFlags.h"
+#include "pxr/usd/usd/stage.h"
+#include "pxr/usd/usdLux/lightAPI.h"
+#include "pxr/usd/usdLux/lightFilter.h"
+#include "pxr/usd/usdLux/tokens.h"
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+UsdLuxLightListCache::UsdLuxLightListCache(
+    const UsdPrim &root,
+    UsdLuxLightListAPI::ComputeMode mode)
+    : _root(root)
+    , _mode(mode)
+{
+    if (root) {
+        _stage = root.GetStage();
+        _rootPath = root.GetPath();
+    } else {
+        TF_CODING_ERROR("Invalid root prim");
+    }
+}
+
+const SdfPathSet &
+UsdLuxLightListCache::ComputeLightList()
+{
+    if (!_valid) {
+        _RecomputeFull();
+    }
+    return _lights;
+}
+
+void
+UsdLuxLightListCache::Update(const UsdNotice::ObjectsChanged &notice)
+{
+    if (!_stage || notice.GetStage() != _stage) {
+        return;
+    }
+    Update(SdfPathVector(notice.GetResyncedPaths()),
+           SdfPathVector(notice.GetChangedInfoOnlyPaths()));
+}
+
+void
+UsdLuxLightListCache::Update(const SdfPathVector &resyncedPaths,
+                             const SdfPathVector &changedInfoOnlyPaths)
+{
+    TRACE_FUNCTION();
+
+    if (!_stage || !_valid) {
+        // Nothing maintained yet; the next ComputeLightList() call will
+        // compute a fresh list.
+        return;
+    }
+
+    const SdfPath &rootPath = _rootPath;
+
+    for (const SdfPath &path : resyncedPaths) {
+        const SdfPath primPath = path.GetPrimPath();
+        if (rootPath.HasPrefix(primPath)) {
+            // The root itself or one of its ancestors was resynced; the
+            // root prim may have been removed or arbitrarily changed, so
+            // recompute the whole list.
+            _RecomputeFull();
+            return;
+        }
+        if (primPath.HasPrefix(rootPath)) {
+            _RecomputeSubtree(primPath);
+        }
+    }
+
+    // When consulting the model hierarchy cache, value changes to the
+    // lightList relationship or its behavior attribute alter the computed
+    // list without a resync.
+    if (_mode == UsdLuxLightListAPI::ComputeModeConsultModelHierarchyCache) {
+        for (const SdfPath &path : changedInfoOnlyPaths) {
+            if (!path.IsPropertyPath()) {
+                continue;
+            }
+            const TfToken &name = path.GetNameToken();
+            if (name != UsdLuxTokens->lightList &&
+                name != UsdLuxTokens->lightListCacheBehavior) {
+                continue;
+            }
+            const SdfPath primPath = path.GetPrimPath();
+            if (rootPath.HasPrefix(primPath)) {
+                _RecomputeFull();
+                return;
+            }
+            if (primPath.HasPrefix(rootPath)) {
+                _RecomputeSubtree(primPath);
+            }
+        }
+    }
+}
+
+bool
+UsdLuxLightListCache::TakeLightListDeltas(SdfPathSet *added,
+                                          SdfPathSet *removed)
+{
+    if (!added || !removed) {
+        TF_CODING_ERROR("'added' and 'removed' must not be null");
+        return false;
+    }
+    added->clear();
+    removed->clear();
+    added->swap(_added);
+    removed->swap(_removed);
+    return !added->empty() || !removed->empty();
+}
+
+void
+UsdLuxLightListCache::_RecomputeFull()
+{
+    TRACE_FUNCTION();
+
+    // Re-fetch the root prim; it may have been removed or re-created.
+    _root = _stage ? _stage->GetPrimAtPath(_rootPath) : UsdPrim();
+
+    // Retract everything, then re-traverse from the root.  The delta
+    // bookkeeping nets out entries that remain in the list.
+    _RetractSubtreeContributions(SdfPath::AbsoluteRootPath());
+    if (_root) {
+        _TraverseAndRecord(_root);
+        _valid = true;
+    } else {
+        _valid = false;
+    }
+}
+
+void
+UsdLuxLightListCache::_RecomputeSubtree(const SdfPath &primPath)
+{
+    _RetractSubtreeContributions(primPath);
+
+    const UsdPrim prim = _stage->GetPrimAtPath(primPath);
+    if (prim && _SubtreeIsTraversed(primPath)) {
+        _TraverseAndRecord(prim);
+    }
+}
+
+void
+UsdLuxLightListCache::_RetractSubtreeContributions(const SdfPath &primPath)
+{
+    auto it = _contributions.lower_bound(primPath);
+    while (it != _contributions.end() && it->first.HasPrefix(primPath)) {
+        for (const SdfPath &entry : it->second) {
+            const auto refIt = _entryRefCounts.find(entry);
+            if (TF_VERIFY(refIt != _entryRefCounts.end()) &&
+                --refIt->second == 0) {
+                _entryRefCounts.erase(refIt);
+                _lights.erase(entry);
+                if (!_added.erase(entry)) {
+                    _removed.insert(entry);
+                }
+            }
+        }
+        it = _contributions.erase(it);
+    }
+}
+
+// Return true if the full traversal would reach primPath, i.e. every prim
+// between the root and primPath passes the traversal predicate and, when
+// consulting the model hierarchy cache, no ancestor halts the traversal.
+bool
+UsdLuxLightListCache::_SubtreeIsTraversed(const SdfPath &primPath) const
+{
+    const SdfPath &rootPath = _rootPath;
+    const UsdStageWeakPtr &stage = _stage;
+    const bool cacheMode =
+        _mode == UsdLuxLightListAPI::ComputeModeConsultModelHierarchyCache;
+
+    for (SdfPath p = primPath; p != rootPath; p = p.GetParentPath()) {
+        const UsdPrim prim = stage->GetPrimAtPath(p);
+        if (!prim ||
+            !prim.IsActive() || !prim.IsDefined() || prim.IsAbstract()) {
+            return false;
+        }
+        // When consulting the cache, only model hierarchy is traversed.
+        if (cacheMode && !prim.IsModel()) {
+            return false;
+        }
+        // A halting ancestor stops the traversal before reaching primPath.
+        if (cacheMode && p != primPath) {
+            TfToken cacheBehavior;
+            UsdLuxLightListAPI(prim).GetLightListCacheBehaviorAttr().Get(
+                &cacheBehavior);
+            if (cacheBehavior == UsdLuxTokens->consumeAndHalt) {
+                return false;
+            }
+        }
+    }
+    // Check halting behavior on the root itself.
+    if (cacheMode && rootPath.IsPrimPath()) {
+        TfToken cacheBehavior;
+        UsdLuxLightListAPI(_root).GetLightListCacheBehaviorAttr().Get(
+            &cacheBehavior);
+        if (cacheBehavior == UsdLuxTokens->consumeAndHalt) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Mirrors _Traverse() in lightListAPI.cpp, additionally recording which
+// prim contributed each entry so subtree updates can retract exactly.
+void
+UsdLuxLightListCache::_TraverseAndRecord(const UsdPrim &prim)
+{
+    // If requested, check lightList cache.
+    if (_mode == UsdLuxLightListAPI::ComputeModeConsultModelHierarchyCache &&
+        prim.GetPath().IsPrimPath() /* no cache on pseudoRoot */) {
+        UsdLuxLightListAPI listAPI(prim);
+        TfToken cacheBehavior;
+        if (listAPI.GetLightListCacheBehaviorAttr().Get(&cacheBehavior)) {
+            if (cacheBehavior == UsdLuxTokens->consumeAndContinue ||
+                cacheBehavior == UsdLuxTokens->consumeAndHalt) {
+                // Consume stored lightList.
+                UsdRelationship rel = listAPI.GetLightListRel();
+                SdfPathVector targets;
+                rel.GetForwardedTargets(&targets);
+                for (const SdfPath &target : targets) {
+                    _AddContribution(prim.GetPath(), target);
+                }
+                if (cacheBehavior == UsdLuxTokens->consumeAndHalt) {
+                    return;
+                }
+            }
+        }
+    }
+    // Accumulate discovered prims.
+    if (prim.HasAPI<UsdLuxLightAPI>() || prim.IsA<UsdLuxLightFilter>()) {
+        _AddContribution(prim.GetPath(), prim.GetPath());
+    }
+    // Traverse descendants.
+    auto flags = UsdPrimIsActive && !UsdPrimIsAbstract && UsdPrimIsDefined;
+    if (_mode == UsdLuxLightListAPI::ComputeModeConsultModelHierarchyCache) {
+        // When consulting the cache we only traverse model hierarchy.
+        flags = flags && UsdPrimIsModel;
+    }
+    for (const UsdPrim &child:
+         prim.GetFilteredChildren(UsdTraverseInstanceProxies(flags))) {
+        _TraverseAndRecord(child);
+    }
+}
+
+void
+UsdLuxLightListCache::_AddContribution(const SdfPath &contributor,
+                                       const SdfPath &entry)
+{
+    _contributions[contributor].push_back(entry);
+    if (++_entryRefCounts[entry] == 1) {
+        _lights.insert(entry);
+        if (!_removed.erase(entry)) {
+            _added.insert(entry);
+        }
+    }
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,124 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+#ifndef PXR_USD_USD_LUX_LIGHT_LIST_CACHE_H
+#define PXR_USD_USD_LUX_LIGHT_LIST_CACHE_H
+
+/// \file usdLux/lightListCache.h
+
+#include "pxr/pxr.h"
+#include "pxr/usd/usdLux/api.h"
+#include "pxr/usd/usdLux/lightListAPI.h"
+#include "pxr/usd/usd/notice.h"
+#include "pxr/usd/usd/prim.h"
+#include "pxr/usd/sdf/path.h"
+
+#include <map>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// \class UsdLuxLightListCache
+///
+/// Maintains the light list for a subtree incrementally.
+///
+/// UsdLuxLightListAPI::ComputeLightList() re-traverses the entire subtree
+/// on every call.  This cache computes the list once, then applies change
+/// notification to it, re-traversing only the affected subtrees, so the
+/// cost of refreshing the list is proportional to the edit rather than to
+/// the size of the stage.  It also accumulates the net additions and
+/// removals between updates, so consumers can apply stable deltas instead
+/// of diffing whole lists.
+///
+/// Each entry in the maintained list is tracked with the prim that
+/// contributed it, so retracting a resynced subtree also retracts cached
+/// lightList relationship targets that point outside that subtree.
+///
+/// WARNING: this class does not listen for change notification itself;
+/// forward the stage's UsdNotice::ObjectsChanged notices to Update().  If
+/// notices are missed the cached list will be stale.  No internal
+/// synchronization is performed; use a separate instance per thread.
+class UsdLuxLightListCache
+{
+public:
+    /// Construct a cache maintaining the light list for the subtree rooted
+    /// at \p root, computed in the given \p mode.
+    USDLUX_API
+    explicit UsdLuxLightListCache(
+        const UsdPrim &root,
+        UsdLuxLightListAPI::ComputeMode mode =
+            UsdLuxLightListAPI::ComputeModeIgnoreCache);
+
+    /// Return the maintained light list, computing it from scratch if it
+    /// has not been computed yet.  The result matches what
+    /// UsdLuxLightListAPI::ComputeLightList() would return for the root
+    /// prim, provided all change notices have been forwarded to Update().
+    USDLUX_API
+    const SdfPathSet &ComputeLightList();
+
+    /// Apply \p notice to the maintained list.  Only the subtrees rooted
+    /// at the resynced paths are re-traversed; changes outside the root
+    /// subtree are ignored.  A resync of the root prim or one of its
+    /// ancestors recomputes the whole list.
+    USDLUX_API
+    void Update(const UsdNotice::ObjectsChanged &notice);
+
+    /// \overload
+    /// Apply pre-extracted change paths to the maintained list.  This is
+    /// useful for clients that aggregate change notification before
+    /// forwarding it.
+    USDLUX_API
+    void Update(const SdfPathVector &resyncedPaths,
+                const SdfPathVector &changedInfoOnlyPaths);
+
+    /// Move the net additions and removals accumulated since the previous
+    /// call (or since construction) into \p added and \p removed, clearing
+    /// the accumulated deltas.  Entries that were added and subsequently
+    /// removed (or vice versa) between calls cancel out.  Returns true if
+    /// either delta is non-empty.
+    USDLUX_API
+    bool TakeLightListDeltas(SdfPathSet *added, SdfPathSet *removed);
+
+    /// Return the root prim this cache was constructed with.
+    const UsdPrim &GetRoot() const { return _root; }
+
+    /// Return the compute mode this cache was constructed with.
+    UsdLuxLightListAPI::ComputeMode GetMode() const { return _mode; }
+
+private:
+    void _RecomputeFull();
+    void _RecomputeSubtree(const SdfPath &primPath);
+    void _RetractSubtreeContributions(const SdfPath &primPath);
+    bool _SubtreeIsTraversed(const SdfPath &primPath) const;
+    void _TraverseAndRecord(const UsdPrim &prim);
+    void _AddContribution(const SdfPath &contributor, const SdfPath &entry);
+
+    // The root prim handle may go stale across resyncs, so the stage and
+    // root path are also stored to re-fetch it.
+    UsdPrim _root;
+    UsdStageWeakPtr _stage;
+    SdfPath _rootPath;
+    UsdLuxLightListAPI::ComputeMode _mode;
+
+    // False until the first full compute, and after a failed one.
+    bool _valid = false;
+
+    // The maintained list, and the entries' reference counts across
+    // contributing prims.
+    SdfPathSet _lights;
+    std::map<SdfPath, int> _entryRefCounts;
+
+    // The entries contributed by each traversed prim, keyed by the prim's
+    // path so a subtree's contributions form a contiguous range.
+    std::map<SdfPath, SdfPathVector> _contributions;
+
+    // Net deltas accumulated since the last TakeLightListDeltas() call.
+    SdfPathSet _added;
+    SdfPathSet _removed;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // PXR_USD_USD_LUX_LIGHT_LIST_CACHE_H
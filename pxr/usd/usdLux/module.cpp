@@ -45,4 +45,6 @@ TF_WRAP_MODULE
     TF_WRAP(UsdLuxShadowAPI);
     TF_WRAP(UsdLuxLightFilter);
     TF_WRAP(UsdLuxPluginLightFilter);
+
+    TF_WRAP(UsdLuxLightListCache);
 }
@@ -5,7 +5,7 @@
 # Licensed under the terms set forth in the LICENSE.txt file available at
 # https://openusd.org/license.
 
-from pxr import Usd, UsdGeom, UsdLux, Vt, Sdf
+from pxr import Tf, Usd, UsdGeom, UsdLux, Vt, Sdf
 import unittest
 
 
@@ -88,5 +88,60 @@ class TestUsdLuxListAPI(unittest.TestCase):
         # discard changes
         stage.Reload()
 
+    def test_LightListCache(self):
+        stage = Usd.Stage.Open('root.usda')
+        world = stage.GetPrimAtPath('/World')
+        ignore = UsdLux.LightListAPI.ComputeModeIgnoreCache
+        cache = UsdLux.LightListCache(world, ignore)
+
+        # Forward change notification to the cache.
+        def _OnObjectsChanged(notice, sender):
+            cache.Update(notice.GetResyncedPaths(),
+                         notice.GetChangedInfoOnlyPaths())
+        listener = Tf.Notice.Register(Usd.Notice.ObjectsChanged,
+                                      _OnObjectsChanged, stage)
+
+        def _Baseline():
+            return set(UsdLux.LightListAPI(world).ComputeLightList(ignore))
+
+        # The initial compute matches the non-incremental result, and the
+        # whole list is reported as added.
+        baseline = _Baseline()
+        self.assertEqual(set(cache.ComputeLightList()), baseline)
+        added, removed = cache.TakeLightListDeltas()
+        self.assertEqual(set(added), baseline)
+        self.assertEqual(list(removed), [])
+
+        # Adding a light refreshes only the affected subtree and reports
+        # a single addition.
+        UsdLux.SphereLight.Define(stage, '/World/Lights/NewSphere')
+        self.assertEqual(set(cache.ComputeLightList()), _Baseline())
+        added, removed = cache.TakeLightListDeltas()
+        self.assertEqual(list(added), [Sdf.Path('/World/Lights/NewSphere')])
+        self.assertEqual(list(removed), [])
+
+        # An unrelated value change leaves the list and deltas untouched.
+        light = UsdLux.SphereLight(
+            stage.GetPrimAtPath('/World/Lights/NewSphere'))
+        light.CreateIntensityAttr().Set(2.0)
+        self.assertEqual(set(cache.ComputeLightList()), _Baseline())
+        self.assertEqual(cache.TakeLightListDeltas(), ([], []))
+
+        # Deactivating the light retracts it.
+        stage.GetPrimAtPath('/World/Lights/NewSphere').SetActive(False)
+        self.assertEqual(set(cache.ComputeLightList()), _Baseline())
+        added, removed = cache.TakeLightListDeltas()
+        self.assertEqual(list(added), [])
+        self.assertEqual(list(removed), [Sdf.Path('/World/Lights/NewSphere')])
+
+        # An addition followed by a removal nets out of the deltas.
+        UsdLux.SphereLight.Define(stage, '/World/Lights/Transient')
+        stage.RemovePrim('/World/Lights/Transient')
+        self.assertEqual(set(cache.ComputeLightList()), _Baseline())
+        self.assertEqual(cache.TakeLightListDeltas(), ([], []))
+
+        listener.Revoke()
+        stage.Reload()
+
 if __name__ == "__main__":
     unittest.main()
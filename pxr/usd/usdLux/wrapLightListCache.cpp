@@ -0,0 +1,61 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+#include "pxr/usd/usdLux/lightListCache.h"
+
+#include "pxr/base/tf/pyResultConversions.h"
+
+#include <boost/python.hpp>
+
+using namespace boost::python;
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+static SdfPathVector
+_ComputeLightList(UsdLuxLightListCache &self)
+{
+    const SdfPathSet &lights = self.ComputeLightList();
+    return SdfPathVector(lights.begin(), lights.end());
+}
+
+static void
+_Update(UsdLuxLightListCache &self,
+        const SdfPathVector &resyncedPaths,
+        const SdfPathVector &changedInfoOnlyPaths)
+{
+    self.Update(resyncedPaths, changedInfoOnlyPaths);
+}
+
+static tuple
+_TakeLightListDeltas(UsdLuxLightListCache &self)
+{
+    SdfPathSet added, removed;
+    self.TakeLightListDeltas(&added, &removed);
+    return boost::python::make_tuple(
+        SdfPathVector(added.begin(), added.end()),
+        SdfPathVector(removed.begin(), removed.end()));
+}
+
+} // anonymous namespace
+
+void wrapUsdLuxLightListCache()
+{
+    class_<UsdLuxLightListCache, boost::noncopyable>("LightListCache",
+        init<const UsdPrim &, UsdLuxLightListAPI::ComputeMode>(
+            (arg("root"),
+             arg("mode") = UsdLuxLightListAPI::ComputeModeIgnoreCache)))
+        .def("ComputeLightList", &_ComputeLightList,
+             return_value_policy<TfPySequenceToList>())
+        .def("Update", &_Update,
+             (arg("resyncedPaths"), arg("changedInfoOnlyPaths")))
+        .def("TakeLightListDeltas", &_TakeLightListDeltas)
+        .def("GetRoot", &UsdLuxLightListCache::GetRoot,
+             return_value_policy<return_by_value>())
+        .def("GetMode", &UsdLuxLightListCache::GetMode)
+        ;
+}
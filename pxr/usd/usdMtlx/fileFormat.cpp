@@ -5,23 +5,137 @@
 // https://openusd.org/license.
 //
 #include "pxr/pxr.h"
+#include "pxr/usd/usdMtlx/debugCodes.h"
 #include "pxr/usd/usdMtlx/fileFormat.h"
 #include "pxr/usd/usdMtlx/reader.h"
 #include "pxr/usd/usdMtlx/utils.h"
+#include "pxr/usd/sdf/layer.h"
 #include "pxr/usd/usd/stage.h"
 #include "pxr/usd/usd/usdaFileFormat.h"
+#include "pxr/base/arch/fileSystem.h"
+#include "pxr/base/arch/hash.h"
+#include "pxr/base/tf/envSetting.h"
+#include "pxr/base/tf/fileUtils.h"
 #include "pxr/base/tf/pathUtils.h"
+#include "pxr/base/tf/stringUtils.h"
 #include "pxr/base/trace/trace.h"
 
 #include <MaterialXCore/Document.h>
 #include <MaterialXFormat/XmlIo.h>
 
+#include <cinttypes>
+#include <cstdio>
+
 namespace mx = MaterialX;
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+TF_DEFINE_ENV_SETTING(
+    USDMTLX_TRANSLATION_CACHE_DIR, "",
+    "If set to a writable directory, MaterialX translation results are "
+    "cached there as crate layers keyed by the source document's content "
+    "hash, so repeat opens skip XML parsing and translation.");
+
 namespace {
 
+static const std::string&
+_GetTranslationCacheDir()
+{
+    static const std::string dir =
+        TfGetEnvSetting(USDMTLX_TRANSLATION_CACHE_DIR);
+    return dir;
+}
+
+/// Return the cache layer path for the given document contents, or the
+/// empty string if caching is disabled.
+static std::string
+_GetTranslationCachePath(const std::string& contents)
+{
+    const std::string& dir = _GetTranslationCacheDir();
+    if (dir.empty() || contents.empty()) {
+        return std::string();
+    }
+    // Seed the content hash with the build version so caches written by
+    // older translations are not reused.
+    static const uint64_t seed = []() {
+        const std::string version =
+            TfStringPrintf("usdMtlx-%d", PXR_VERSION);
+        return ArchHash64(version.data(), version.size());
+    }();
+    const uint64_t hash = ArchHash64(contents.data(), contents.size(), seed);
+    return TfStringPrintf("%s/%016" PRIx64 ".usdc", dir.c_str(), hash);
+}
+
+static std::string
+_ReadFileContents(const std::string& resolvedPath)
+{
+    std::string contents;
+    if (FILE* f = ArchOpenFile(resolvedPath.c_str(), "rb")) {
+        const int64_t length = ArchGetFileLength(f);
+        if (length > 0) {
+            contents.resize(length);
+            if (fread(&contents[0], 1, length, f) !=
+                static_cast<size_t>(length)) {
+                contents.clear();
+            }
+        }
+        fclose(f);
+    }
+    return contents;
+}
+
+/// Populate \p layer from the cached translation at \p cachePath, if any.
+static bool
+_ReadFromTranslationCache(const std::string& cachePath, SdfLayer* layer)
+{
+    if (cachePath.empty() || !TfPathExists(cachePath)) {
+        return false;
+    }
+    if (SdfLayerRefPtr cached = SdfLayer::OpenAsAnonymous(cachePath)) {
+        TF_DEBUG(USDMTLX_READER).Msg(
+            "Using cached translation %s\n", cachePath.c_str());
+        layer->TransferContent(cached);
+        return true;
+    }
+    // A partially written or corrupt cache entry; remove it so the
+    // fresh translation below replaces it.
+    ArchUnlinkFile(cachePath.c_str());
+    return false;
+}
+
+/// Store the translated \p stage at \p cachePath.  Failures are not
+/// errors; the cache is best-effort.
+static void
+_WriteToTranslationCache(const std::string& cachePath,
+                         const UsdStagePtr& stage)
+{
+    if (cachePath.empty()) {
+        return;
+    }
+    const std::string& dir = _GetTranslationCacheDir();
+    if (!TfIsDir(dir) && !TfMakeDirs(dir, -1, /* existOk = */ true)) {
+        TF_DEBUG(USDMTLX_READER).Msg(
+            "Could not create translation cache dir %s\n", dir.c_str());
+        return;
+    }
+    // Export to a temporary file and rename it into place so readers
+    // never observe a partially written cache layer.
+    const std::string tmpPath = cachePath + ".tmp";
+    if (!stage->GetRootLayer()->Export(tmpPath)) {
+        TF_DEBUG(USDMTLX_READER).Msg(
+            "Could not write translation cache %s\n", tmpPath.c_str());
+        return;
+    }
+    if (std::rename(tmpPath.c_str(), cachePath.c_str()) != 0) {
+        // Another process may have won the race; their content is
+        // identical since the key is a content hash.
+        ArchUnlinkFile(tmpPath.c_str());
+        return;
+    }
+    TF_DEBUG(USDMTLX_READER).Msg(
+        "Wrote translation cache %s\n", cachePath.c_str());
+}
+
 template <typename R>
 static
 bool
@@ -101,13 +215,25 @@ UsdMtlxFileFormat::Read(
 {
     TRACE_FUNCTION();
 
+    // When the translation cache is enabled, key it on the document's
+    // contents so edited files re-translate while repeat opens skip XML
+    // parsing and translation entirely.
+    std::string cachePath;
+    if (!_GetTranslationCacheDir().empty()) {
+        cachePath = _GetTranslationCachePath(_ReadFileContents(resolvedPath));
+        if (_ReadFromTranslationCache(cachePath, layer)) {
+            return true;
+        }
+    }
+
     auto stage = UsdStage::CreateInMemory();
-    if (!_Read(stage, 
-               [&resolvedPath]() { 
+    if (!_Read(stage,
+               [&resolvedPath]() {
                    return UsdMtlxReadDocument(resolvedPath);
                })) {
         return false;
     }
+    _WriteToTranslationCache(cachePath, stage);
 
     layer->TransferContent(stage->GetRootLayer());
     return true;
@@ -130,6 +256,11 @@ UsdMtlxFileFormat::ReadFromString(
 {
     TRACE_FUNCTION();
 
+    const std::string cachePath = _GetTranslationCachePath(str);
+    if (_ReadFromTranslationCache(cachePath, layer)) {
+        return true;
+    }
+
     auto stage = UsdStage::CreateInMemory();
     if (!_Read(stage,
                [&str]() {
@@ -137,6 +268,7 @@ UsdMtlxFileFormat::ReadFromString(
                })) {
         return false;
     }
+    _WriteToTranslationCache(cachePath, stage);
 
     layer->TransferContent(stage->GetRootLayer());
     return true;
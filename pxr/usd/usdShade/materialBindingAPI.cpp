@@ -5,6 +5,7 @@
 // https://openusd.org/license.
 //
 #include "pxr/usd/usdShade/materialBindingAPI.h"
+#include "pxr/usd/usd/primRange.h"
 #include "pxr/usd/usd/schemaRegistry.h"
 #include "pxr/usd/usd/typed.h"
 
@@ -895,7 +896,57 @@ UsdShadeMaterialBindingAPI::ComputeBoundMaterials(
     return materials;
 }
 
-UsdGeomSubset 
+/* static */
+UsdShadeMaterialBindingAPI::BoundMaterialMap
+UsdShadeMaterialBindingAPI::ComputeBoundMaterialsForSubtree(
+    const UsdPrim &root,
+    const TfToken &materialPurpose,
+    bool supportLegacyBindings)
+{
+    BoundMaterialMap result;
+
+    if (!root) {
+        TF_CODING_ERROR("Invalid root prim.");
+        return result;
+    }
+
+    std::vector<UsdPrim> prims;
+    for (const UsdPrim &prim : UsdPrimRange(root)) {
+        prims.push_back(prim);
+    }
+
+    // This ensures that bindings are only computed once per prim.  In
+    // particular, bindings on ancestor prims shared by the subtree are
+    // resolved once rather than re-walked for every descendant.
+    BindingsCache bindingsCache;
+
+    // The use of CollectionQueryCache ensures that every collection's
+    // MembershipQuery object is only constructed once.
+    CollectionQueryCache collQueryCache;
+
+    std::vector<UsdShadeMaterial> materials(prims.size());
+
+    WorkParallelForN(prims.size(),
+        [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i) {
+                materials[i] = UsdShadeMaterialBindingAPI(prims[i]).
+                    ComputeBoundMaterial(&bindingsCache, &collQueryCache,
+                                         materialPurpose,
+                                         /* bindingRel = */ nullptr,
+                                         supportLegacyBindings);
+            }
+        });
+
+    for (size_t i = 0; i < prims.size(); ++i) {
+        if (materials[i]) {
+            result.emplace(prims[i].GetPath(), materials[i]);
+        }
+    }
+
+    return result;
+}
+
+UsdGeomSubset
 UsdShadeMaterialBindingAPI::CreateMaterialBindSubset(
     const TfToken &subsetName,
     const VtIntArray &indices,
@@ -20,6 +20,7 @@
 #include "pxr/usd/usdGeom/subset.h"
 #include "pxr/usd/usdShade/material.h"
 #include <tbb/concurrent_unordered_map.h>
+#include <unordered_map>
 
 #include "pxr/base/vt/value.h"
 
@@ -846,11 +847,37 @@ public:
     /// relationships.
     USDSHADE_API
     static std::vector<UsdShadeMaterial> ComputeBoundMaterials(
-        const std::vector<UsdPrim> &prims, 
+        const std::vector<UsdPrim> &prims,
         const TfToken &materialPurpose=UsdShadeTokens->allPurpose,
         std::vector<UsdRelationship> *bindingRels=nullptr,
         bool supportLegacyBindings=true);
 
+    /// A map from prim path to the material bound to the prim at that path,
+    /// as returned by ComputeBoundMaterialsForSubtree().
+    using BoundMaterialMap =
+        std::unordered_map<SdfPath, UsdShadeMaterial, SdfPath::Hash>;
+
+    /// Static API for efficiently and concurrently computing the resolved
+    /// material bindings for every prim in the subtree rooted at \p root
+    /// for the given \p materialPurpose, returning a map from prim path to
+    /// the bound material.  Prims with no bound material are omitted from
+    /// the returned map.
+    ///
+    /// This is equivalent to calling ComputeBoundMaterials() on all the
+    /// prims in the subtree: bindings and collection membership queries are
+    /// computed once and shared across the subtree -- in particular,
+    /// bindings on common ancestors are resolved once rather than re-walked
+    /// per prim -- and per-prim resolution runs in parallel.
+    ///
+    /// In order for backward compatibility with old assets not having
+    /// MaterialBindingAPI applied, \p supportLegacyBindings defaults to
+    /// true.  See ComputeBoundMaterials() for details.
+    USDSHADE_API
+    static BoundMaterialMap ComputeBoundMaterialsForSubtree(
+        const UsdPrim &root,
+        const TfToken &materialPurpose=UsdShadeTokens->allPurpose,
+        bool supportLegacyBindings=true);
+
     /// @}
         
     // --------------------------------------------------------------------- //
@@ -0,0 +1,229 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+#include "pxr/usd/usdShade/networkCache.h"
+
+#include "pxr/usd/usdShade/connectableAPI.h"
+#include "pxr/usd/usdShade/input.h"
+#include "pxr/usd/usdShade/nodeDefAPI.h"
+#include "pxr/usd/usdShade/output.h"
+#include "pxr/usd/usdShade/utils.h"
+
+#include "pxr/base/tf/diagnostic.h"
+#include "pxr/base/trace/trace.h"
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+
+UsdShadeNetworkCache::UsdShadeNetworkCache(const UsdTimeCode time)
+    : _time(time)
+{
+}
+
+static TfToken
+_GetNodeIdentifier(const UsdShadeConnectableAPI &node)
+{
+    TfToken id;
+    if (UsdShadeNodeDefAPI nodeDef = UsdShadeNodeDefAPI(node.GetPrim())) {
+        nodeDef.GetShaderId(&id);
+    }
+    // Fall back to the prim's type name for typed shading nodes that do
+    // not carry an info:id, such as light filters.
+    return id.IsEmpty() ? node.GetPrim().GetTypeName() : id;
+}
+
+// Walk the network upstream from \p node, recording each reachable node
+// with its resolved parameter values and connections.
+static void
+_WalkNetwork(const UsdShadeConnectableAPI &node,
+             UsdShadeNetworkCache::Network *network,
+             const UsdTimeCode time)
+{
+    const SdfPath path = node.GetPath();
+    if (!TF_VERIFY(path != SdfPath::EmptyPath())) {
+        return;
+    }
+
+    // Insert an empty node up front, so that cycles and diamond-shaped
+    // networks terminate; the compiled node is filled in below.
+    if (!network->nodes.emplace(path, UsdShadeNetworkCache::Node()).second) {
+        return;
+    }
+
+    UsdShadeNetworkCache::Node compiled;
+    compiled.identifier = _GetNodeIdentifier(node);
+
+    for (const UsdShadeInput &input : node.GetInputs()) {
+        const TfToken inputName = input.GetBaseName();
+
+        // Find the attributes this input is getting its value from, which
+        // might be an output or an input, including possibly itself if
+        // not connected.
+        const UsdShadeAttributeVector attrs =
+            input.GetValueProducingAttributes(/*shaderOutputsOnly*/ false);
+
+        for (const UsdAttribute &attr : attrs) {
+            if (UsdShadeUtils::GetType(attr.GetName()) ==
+                UsdShadeAttributeType::Output) {
+                // An output on an upstream shading node: record the
+                // connection and visit the node.
+                _WalkNetwork(
+                    UsdShadeConnectableAPI(attr.GetPrim()), network, time);
+                compiled.inputConnections[inputName].emplace_back(
+                    attr.GetPrim().GetPath(),
+                    UsdShadeOutput(attr).GetBaseName());
+            } else {
+                // An input attribute: record its authored value.
+                VtValue value;
+                if (attr.Get(&value, time)) {
+                    compiled.parameters[inputName] = std::move(value);
+                }
+            }
+        }
+    }
+
+    // Look the node up again: recursing above may have rehashed the map.
+    network->nodes[path] = std::move(compiled);
+}
+
+// The per-node and per-input hashes are combined with XOR so that the
+// result does not depend on the unordered container iteration order.
+static size_t
+_ComputeTopologyHash(const UsdShadeNetworkCache::Network &network)
+{
+    size_t hash = 0;
+    for (const auto &entry : network.nodes) {
+        size_t nodeHash = TfHash::Combine(entry.first,
+                                          entry.second.identifier);
+        for (const auto &connection : entry.second.inputConnections) {
+            size_t inputHash = TfHash::Combine(connection.first);
+            for (const auto &source : connection.second) {
+                inputHash = TfHash::Combine(inputHash,
+                                            source.first, source.second);
+            }
+            nodeHash ^= inputHash;
+        }
+        hash ^= nodeHash;
+    }
+    return TfHash::Combine(hash, network.terminalPath,
+                           network.terminalOutputName);
+}
+
+UsdShadeNetworkCache::NetworkConstPtr
+UsdShadeNetworkCache::_CompileNetwork(const UsdShadeOutput &output) const
+{
+    TRACE_FUNCTION();
+
+    auto network = std::make_shared<Network>();
+
+    // Resolve the terminal through containers down to shader outputs, and
+    // walk the network upstream from each producing shader.
+    const UsdShadeAttributeVector targets =
+        UsdShadeUtils::GetValueProducingAttributes(
+            output, /*shaderOutputsOnly*/ true);
+    for (const UsdAttribute &attr : targets) {
+        _WalkNetwork(UsdShadeConnectableAPI(attr.GetPrim()),
+                     network.get(), _time);
+    }
+    if (!targets.empty()) {
+        network->terminalPath = targets.front().GetPrim().GetPath();
+        network->terminalOutputName =
+            UsdShadeOutput(targets.front()).GetBaseName();
+    }
+
+    network->topologyHash = _ComputeTopologyHash(*network);
+    return network;
+}
+
+UsdShadeNetworkCache::NetworkConstPtr
+UsdShadeNetworkCache::GetNetwork(const UsdShadeOutput &output)
+{
+    TRACE_FUNCTION();
+
+    if (!output) {
+        TF_CODING_ERROR("GetNetwork called on invalid output.");
+        return nullptr;
+    }
+
+    const SdfPath outputPath = output.GetAttr().GetPath();
+    const auto it = _cache.find(outputPath);
+    if (it != _cache.end()) {
+        return it->second;
+    }
+
+    NetworkConstPtr network = _CompileNetwork(output);
+    _cache.emplace(outputPath, network);
+    return network;
+}
+
+void
+UsdShadeNetworkCache::Invalidate(const UsdNotice::ObjectsChanged &notice)
+{
+    TRACE_FUNCTION();
+
+    SdfPathVector changedPaths;
+    for (const SdfPath &path : notice.GetResyncedPaths()) {
+        changedPaths.push_back(path.GetAbsoluteRootOrPrimPath());
+    }
+    for (const SdfPath &path : notice.GetChangedInfoOnlyPaths()) {
+        changedPaths.push_back(path.GetAbsoluteRootOrPrimPath());
+    }
+    if (changedPaths.empty()) {
+        return;
+    }
+
+    // Drop every network that a changed prim overlaps: a change at or
+    // below one of the network's nodes may alter parameter values, while
+    // a change on an ancestor (e.g. a resync) may restructure the network
+    // wholesale. The terminal attribute itself is covered, since its
+    // owning prim holds the terminal connection.
+    const auto overlapsNetwork =
+        [&changedPaths](const _NetworkMap::value_type &entry) {
+            for (const SdfPath &changedPath : changedPaths) {
+                const SdfPath ownerPath =
+                    entry.first.GetAbsoluteRootOrPrimPath();
+                if (ownerPath.HasPrefix(changedPath) ||
+                    changedPath.HasPrefix(ownerPath)) {
+                    return true;
+                }
+                for (const auto &node : entry.second->nodes) {
+                    if (node.first.HasPrefix(changedPath) ||
+                        changedPath.HasPrefix(node.first)) {
+                        return true;
+                    }
+                }
+            }
+            return false;
+        };
+
+    for (auto it = _cache.begin(); it != _cache.end(); ) {
+        if (overlapsNetwork(*it)) {
+            it = _cache.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void
+UsdShadeNetworkCache::Clear()
+{
+    _cache.clear();
+}
+
+void
+UsdShadeNetworkCache::SetTime(const UsdTimeCode time)
+{
+    if (time == _time) {
+        return;
+    }
+
+    // Parameter values were resolved at the previous time; recompile.
+    Clear();
+    _time = time;
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,135 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+#ifndef PXR_USD_USD_SHADE_NETWORK_CACHE_H
+#define PXR_USD_USD_SHADE_NETWORK_CACHE_H
+
+#include "pxr/pxr.h"
+#include "pxr/usd/usdShade/api.h"
+#include "pxr/usd/usd/notice.h"
+#include "pxr/usd/usd/timeCode.h"
+#include "pxr/usd/sdf/path.h"
+
+#include "pxr/base/tf/hash.h"
+#include "pxr/base/tf/token.h"
+#include "pxr/base/vt/value.h"
+
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+class UsdShadeOutput;
+
+/// \class UsdShadeNetworkCache
+///
+/// A cache of compiled shading networks.
+///
+/// Extracting the network feeding a material terminal requires following
+/// every connection through the \ref UsdShadeAttributeResolution rules,
+/// which is expensive to repeat each time a consumer rebuilds the network.
+/// This cache compiles the network reached from a terminal output once,
+/// into a compact immutable representation that may be shared by multiple
+/// consumers, and supports targeted invalidation from change notices.
+///
+/// WARNING: this class does not automatically invalidate cached values
+/// based on changes to the stage from which values were cached; connect
+/// Invalidate() to change notification, or call Clear(), to refresh
+/// results. Additionally, a separate instance of this class should be used
+/// per-thread, calling GetNetwork() from multiple threads is not safe, as
+/// it mutates internal state.
+///
+class UsdShadeNetworkCache
+{
+public:
+    /// A single shading node in a compiled network.
+    struct Node {
+        /// The shader identifier (\em info:id), or the prim's type name
+        /// when no identifier is authored.
+        TfToken identifier;
+
+        /// Authored parameter values, keyed by input base name.
+        std::unordered_map<TfToken, VtValue, TfHash> parameters;
+
+        /// Upstream connections, keyed by input base name.  Each
+        /// connection names the upstream node's prim path and the base
+        /// name of its output.
+        std::unordered_map<
+            TfToken, std::vector<std::pair<SdfPath, TfToken>>, TfHash>
+            inputConnections;
+    };
+
+    /// An immutable compiled network: the flattened set of shading nodes
+    /// reachable from a terminal output, with connectivity and values
+    /// fully resolved.
+    struct Network {
+        /// All reachable nodes, keyed by prim path.
+        std::unordered_map<SdfPath, Node, SdfPath::Hash> nodes;
+
+        /// The prim path of the node that produces the terminal output,
+        /// or the empty path if the terminal resolves to no shader.
+        SdfPath terminalPath;
+
+        /// The base name of the terminal node's producing output.
+        TfToken terminalOutputName;
+
+        /// Hash of the network's nodes and connectivity.  Parameter
+        /// values do not contribute, so networks that differ only in
+        /// parameter values hash equally.
+        size_t topologyHash = 0;
+    };
+
+    using NetworkConstPtr = std::shared_ptr<const Network>;
+
+    /// Construct a new cache that resolves parameter values at \p time.
+    USDSHADE_API
+    explicit UsdShadeNetworkCache(UsdTimeCode time = UsdTimeCode::Default());
+
+    /// Return the compiled network feeding the terminal \p output,
+    /// compiling and caching it if necessary.  The returned network is
+    /// immutable and shared; callers may retain it beyond the lifetime of
+    /// this cache.
+    ///
+    /// \note This method may mutate internal cache state and is not
+    /// thread safe.
+    USDSHADE_API
+    NetworkConstPtr GetNetwork(const UsdShadeOutput &output);
+
+    /// Conservatively invalidate the cached networks affected by
+    /// \p notice.  A network is dropped if any resynced or changed path
+    /// overlaps one of its nodes, so unrelated networks remain cached.
+    USDSHADE_API
+    void Invalidate(const UsdNotice::ObjectsChanged &notice);
+
+    /// Clears all cached networks.
+    USDSHADE_API
+    void Clear();
+
+    /// Use the new \p time when resolving parameter values.  All cached
+    /// networks are cleared, unless \p time matches the current time.
+    USDSHADE_API
+    void SetTime(UsdTimeCode time);
+
+    /// Get the time from which this cache is resolving parameter values.
+    UsdTimeCode GetTime() const { return _time; }
+
+private:
+    NetworkConstPtr _CompileNetwork(const UsdShadeOutput &output) const;
+
+    // Map of cached networks, keyed by terminal attribute path.
+    using _NetworkMap =
+        std::unordered_map<SdfPath, NetworkConstPtr, SdfPath::Hash>;
+    _NetworkMap _cache;
+
+    // The time at which this cache is resolving parameter values.
+    UsdTimeCode _time;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // PXR_USD_USD_SHADE_NETWORK_CACHE_H
@@ -339,11 +339,22 @@ class TestUsdShadeMaterialBinding(unittest.TestCase):
                 prims=[lampA, lampB, pencilA, pencilB, eraserA, lampABase, 
                    lampAShade])
         self.assertTrue(len(boundMaterials), 7)
-        self.assertEqual([i.GetPath() for i in boundMaterials], 
-            [rubberMat.GetPath(), rubberMat.GetPath(), 
-             Sdf.Path(), Sdf.Path(), Sdf.Path(), 
+        self.assertEqual([i.GetPath() for i in boundMaterials],
+            [rubberMat.GetPath(), rubberMat.GetPath(),
+             Sdf.Path(), Sdf.Path(), Sdf.Path(),
              rubberMat.GetPath(), rubberMat.GetPath()])
 
+        # Test the same results using the subtree bulk-resolution API.
+        boundMaterialMap = \
+            UsdShade.MaterialBindingAPI.ComputeBoundMaterialsForSubtree(
+                root=tableGrp)
+        for p in [lampA, lampB, lampABase, lampAShade]:
+            self.assertEqual(boundMaterialMap[p.GetPath()].GetPath(),
+                             rubberMat.GetPath())
+        # Unbound prims are omitted from the returned map.
+        for p in [pencilA, pencilB, eraserA]:
+            self.assertNotIn(p.GetPath(), boundMaterialMap)
+
         # Test AddPrimToBindingCollection and RemovePrimFromBindingCollection.
         self.assertTrue(tableGrpBindingAPI.AddPrimToBindingCollection(eraserA, 
                         "lamps"))
@@ -0,0 +1,159 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+
+#include "pxr/usd/usd/notice.h"
+#include "pxr/usd/usd/stage.h"
+#include "pxr/usd/usdShade/connectableAPI.h"
+#include "pxr/usd/usdShade/material.h"
+#include "pxr/usd/usdShade/networkCache.h"
+#include "pxr/usd/usdShade/shader.h"
+#include "pxr/base/gf/vec3f.h"
+#include "pxr/base/tf/notice.h"
+#include "pxr/base/tf/weakBase.h"
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+// Forwards stage change notices to a network cache, as a consumer
+// keeping a cache in sync would.
+class _InvalidationListener : public TfWeakBase
+{
+public:
+    _InvalidationListener(UsdShadeNetworkCache *cache,
+                          const UsdStageWeakPtr &stage)
+        : _cache(cache)
+    {
+        _key = TfNotice::Register(
+            TfCreateWeakPtr(this),
+            &_InvalidationListener::_OnObjectsChanged, stage);
+    }
+
+    ~_InvalidationListener()
+    {
+        TfNotice::Revoke(_key);
+    }
+
+private:
+    void _OnObjectsChanged(const UsdNotice::ObjectsChanged &notice,
+                           const UsdStageWeakPtr &sender)
+    {
+        _cache->Invalidate(notice);
+    }
+
+    UsdShadeNetworkCache *_cache;
+    TfNotice::Key _key;
+};
+
+} // anonymous namespace
+
+void TestNetworkCache()
+{
+    const UsdStageRefPtr stage = UsdStage::CreateInMemory();
+
+    // Material with a surface shader fed by a texture node, plus an
+    // unrelated second material.
+    UsdShadeMaterial material =
+        UsdShadeMaterial::Define(stage, SdfPath("/Material"));
+    UsdShadeShader surface =
+        UsdShadeShader::Define(stage, SdfPath("/Material/Surface"));
+    UsdShadeShader texture =
+        UsdShadeShader::Define(stage, SdfPath("/Material/Texture"));
+    UsdShadeMaterial otherMaterial =
+        UsdShadeMaterial::Define(stage, SdfPath("/OtherMaterial"));
+    UsdShadeShader otherSurface =
+        UsdShadeShader::Define(stage, SdfPath("/OtherMaterial/Surface"));
+
+    surface.SetShaderId(TfToken("TestSurface"));
+    texture.SetShaderId(TfToken("TestTexture"));
+    otherSurface.SetShaderId(TfToken("TestSurface"));
+
+    const UsdShadeOutput surfaceOut =
+        surface.CreateOutput(TfToken("out"), SdfValueTypeNames->Token);
+    material.CreateSurfaceOutput().ConnectToSource(surfaceOut);
+
+    const UsdShadeInput roughness =
+        surface.CreateInput(TfToken("roughness"), SdfValueTypeNames->Float);
+    roughness.Set(0.5f);
+
+    const UsdShadeOutput textureOut =
+        texture.CreateOutput(TfToken("rgb"), SdfValueTypeNames->Color3f);
+    surface.CreateInput(TfToken("diffuseColor"),
+                        SdfValueTypeNames->Color3f)
+        .ConnectToSource(textureOut);
+
+    const UsdShadeOutput otherSurfaceOut =
+        otherSurface.CreateOutput(TfToken("out"), SdfValueTypeNames->Token);
+    otherMaterial.CreateSurfaceOutput().ConnectToSource(otherSurfaceOut);
+
+    UsdShadeNetworkCache cache;
+    _InvalidationListener listener(&cache, UsdStageWeakPtr(stage));
+
+    // Compile and verify the network contents.
+    const UsdShadeNetworkCache::NetworkConstPtr network =
+        cache.GetNetwork(material.GetSurfaceOutput());
+    TF_AXIOM(network);
+    TF_AXIOM(network->nodes.size() == 2);
+    TF_AXIOM(network->terminalPath == surface.GetPath());
+    TF_AXIOM(network->terminalOutputName == TfToken("out"));
+
+    const UsdShadeNetworkCache::Node &surfaceNode =
+        network->nodes.at(surface.GetPath());
+    TF_AXIOM(surfaceNode.identifier == TfToken("TestSurface"));
+    TF_AXIOM(surfaceNode.parameters.at(TfToken("roughness")) ==
+             VtValue(0.5f));
+    const auto &diffuseSources =
+        surfaceNode.inputConnections.at(TfToken("diffuseColor"));
+    TF_AXIOM(diffuseSources.size() == 1);
+    TF_AXIOM(diffuseSources[0].first == texture.GetPath());
+    TF_AXIOM(diffuseSources[0].second == TfToken("rgb"));
+
+    const UsdShadeNetworkCache::Node &textureNode =
+        network->nodes.at(texture.GetPath());
+    TF_AXIOM(textureNode.identifier == TfToken("TestTexture"));
+    TF_AXIOM(textureNode.inputConnections.empty());
+
+    // Repeated queries share the compiled network.
+    TF_AXIOM(cache.GetNetwork(material.GetSurfaceOutput()) == network);
+
+    // The topology hash is stable across independent compilations.
+    UsdShadeNetworkCache freshCache;
+    TF_AXIOM(freshCache.GetNetwork(material.GetSurfaceOutput())
+                 ->topologyHash == network->topologyHash);
+
+    // Networks with different structure hash differently.
+    TF_AXIOM(cache.GetNetwork(otherMaterial.GetSurfaceOutput())
+                 ->topologyHash != network->topologyHash);
+
+    // A parameter edit invalidates the affected network, and only that
+    // network.
+    const UsdShadeNetworkCache::NetworkConstPtr otherNetwork =
+        cache.GetNetwork(otherMaterial.GetSurfaceOutput());
+    roughness.Set(0.25f);
+    const UsdShadeNetworkCache::NetworkConstPtr recompiled =
+        cache.GetNetwork(material.GetSurfaceOutput());
+    TF_AXIOM(recompiled != network);
+    TF_AXIOM(recompiled->nodes.at(surface.GetPath())
+                 .parameters.at(TfToken("roughness")) == VtValue(0.25f));
+    TF_AXIOM(cache.GetNetwork(otherMaterial.GetSurfaceOutput()) ==
+             otherNetwork);
+
+    // A parameter-only edit leaves the topology hash unchanged, while a
+    // connectivity edit does not.
+    TF_AXIOM(recompiled->topologyHash == network->topologyHash);
+    surface.CreateInput(TfToken("opacity"), SdfValueTypeNames->Float)
+        .ConnectToSource(textureOut);
+    TF_AXIOM(cache.GetNetwork(material.GetSurfaceOutput())->topologyHash !=
+             network->topologyHash);
+}
+
+int main(int argc, char** argv)
+{
+    TestNetworkCache();
+    printf("Passed!\n");
+    return EXIT_SUCCESS;
+}
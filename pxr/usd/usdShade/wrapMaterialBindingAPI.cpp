@@ -140,12 +140,26 @@ _WrapComputeBoundMaterials(const std::vector<UsdPrim> &prims,
                            const TfToken &materialPurpose, 
                            bool supportLegacyBindings)
 {
-    std::vector<UsdRelationship> bindingRels; 
+    std::vector<UsdRelationship> bindingRels;
     auto materials = UsdShadeMaterialBindingAPI::ComputeBoundMaterials(prims,
         materialPurpose, &bindingRels, supportLegacyBindings);
     return boost::python::make_tuple(materials, bindingRels);
 }
 
+static boost::python::dict
+_WrapComputeBoundMaterialsForSubtree(const UsdPrim &root,
+                                     const TfToken &materialPurpose,
+                                     bool supportLegacyBindings)
+{
+    boost::python::dict result;
+    for (const auto &entry :
+             UsdShadeMaterialBindingAPI::ComputeBoundMaterialsForSubtree(
+                 root, materialPurpose, supportLegacyBindings)) {
+        result[entry.first] = entry.second;
+    }
+    return result;
+}
+
 WRAP_CUSTOM {
 
     using This = UsdShadeMaterialBindingAPI;
@@ -271,6 +285,12 @@ WRAP_CUSTOM {
               arg("supportLegacyBindings")=true))
             .staticmethod("ComputeBoundMaterials")
 
+        .def("ComputeBoundMaterialsForSubtree",
+             &_WrapComputeBoundMaterialsForSubtree,
+             (arg("root"), arg("materialPurpose")=UsdShadeTokens->allPurpose,
+              arg("supportLegacyBindings")=true))
+            .staticmethod("ComputeBoundMaterialsForSubtree")
+
         .def("CreateMaterialBindSubset", 
              &This::CreateMaterialBindSubset,
              (arg("subsetName"), 
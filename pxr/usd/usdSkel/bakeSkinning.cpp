@@ -194,6 +194,13 @@ struct _Task
         return _hasSampleAtCurrentTime;
     }
 
+    /// Returns true if Run() would invoke its computation at \p time,
+    /// rather than skipping it or reusing an unvarying cached value.
+    bool NeedsRunAtTime(const UsdTimeCode time) const {
+        return *this &&
+               (_mightBeTimeVarying || _isFirstSample || time.IsDefault());
+    }
+
     /// Returns true if the task was successfully processed to update
     /// some cached value.
     /// The actual cached value is held externally.
@@ -414,6 +421,13 @@ struct _SkelAdapter
     /// Use \p xfCache to update any transforms required for skinning.
     void UpdateTransform(const size_t timeIndex, UsdGeomXformCache* xfCache);
 
+    /// Append to \p prims the prims whose local-to-world transforms
+    /// UpdateTransform() will read from the xform cache at \p time, so
+    /// that the cache can be warmed in advance with a batched query.
+    void GatherTransformPrims(const size_t timeIndex,
+                              const UsdTimeCode time,
+                              std::vector<UsdPrim>* prims) const;
+
     /// Update any animation data needed for skinning.
     void UpdateAnimation(const UsdTimeCode time, const size_t timeIndex);
 
@@ -701,6 +715,18 @@ _SkelAdapter::UpdateTransform(const size_t timeIndex,
 }
 
 
+void
+_SkelAdapter::GatherTransformPrims(const size_t timeIndex,
+                                   const UsdTimeCode time,
+                                   std::vector<UsdPrim>* prims) const
+{
+    if (ShouldProcessAtTime(timeIndex) &&
+        _skelLocalToWorldXformTask.NeedsRunAtTime(time)) {
+        prims->push_back(GetPrim());
+    }
+}
+
+
 void
 _SkelAdapter::_ComputeSkinningXforms(const UsdTimeCode time)
 {
@@ -843,6 +869,13 @@ struct _SkinningAdapter
     /// time sample. Cached values are stored only if necessary.
     void UpdateTransform(const size_t timeIndex, UsdGeomXformCache* xfCache);
 
+    /// Append to \p prims the prims whose local-to-world transforms
+    /// UpdateTransform() will read from the xform cache at \p time, so
+    /// that the cache can be warmed in advance with a batched query.
+    void GatherTransformPrims(const size_t timeIndex,
+                              const UsdTimeCode time,
+                              std::vector<UsdPrim>* prims) const;
+
     void Update(const UsdTimeCode time, const size_t timeIndex);
 
     /// Write computed values to the SdfLayer.
@@ -1394,6 +1427,25 @@ _SkinningAdapter::UpdateTransform(const size_t timeIndex,
 }
 
 
+void
+_SkinningAdapter::GatherTransformPrims(const size_t timeIndex,
+                                       const UsdTimeCode time,
+                                       std::vector<UsdPrim>* prims) const
+{
+    if (!ShouldProcessAtTime(timeIndex)) {
+        return;
+    }
+    if (_localToWorldXformTask.NeedsRunAtTime(time)) {
+        prims->push_back(GetPrim());
+    }
+    if (_parentToWorldXformTask.NeedsRunAtTime(time)) {
+        // The parent-to-world transform is the parent prim's
+        // local-to-world transform.
+        prims->push_back(GetPrim().GetParent());
+    }
+}
+
+
 bool
 _SkinningAdapter::_ComputeRestPoints(const UsdTimeCode time)
 {
@@ -2385,6 +2437,24 @@ UsdSkelBakeSkinning(const UsdSkelCache& skelCache,
             // Update all required transforms for this time.
             xfCache.SetTime(time);
 
+            // The adapters must read their transforms from the xform cache
+            // in serial below, since UsdGeomXformCache is not thread-safe.
+            // Warm the cache up front with a single batched query, which
+            // resolves every unique prim -- and every shared ancestor --
+            // in parallel, so that the serial reads are all cache hits.
+            {
+                std::vector<UsdPrim> xformPrims;
+                for (const auto& skelAdapter : skelAdapters) {
+                    skelAdapter->GatherTransformPrims(ti, time, &xformPrims);
+                }
+                for (const auto& skinningAdapter : skinningAdapters) {
+                    skinningAdapter->GatherTransformPrims(
+                        ti, time, &xformPrims);
+                }
+                std::vector<GfMatrix4d> xforms;
+                xfCache.ComputeLocalToWorldTransforms(xformPrims, &xforms);
+            }
+
             TF_DEBUG(USDSKEL_BAKESKINNING).Msg(
                 "[UsdSkelBakeSkinning] Reading skel transforms at time %s\n",
                 TfStringify(time).c_str());
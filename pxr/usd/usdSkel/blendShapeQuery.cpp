@@ -14,6 +14,7 @@
 #include "pxr/usd/usdSkel/utils.h"
 
 #include <algorithm>
+#include <atomic>
 
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -473,6 +474,66 @@ UsdSkelBlendShapeQuery::ComputeDeformedNormals(
 }
 
 
+bool
+UsdSkelBlendShapeQuery::ComputeDeformedPointsWithPackedShapeTable(
+    const TfSpan<const float> subShapeWeights,
+    const TfSpan<const GfVec4f> packedShapeTable,
+    const TfSpan<const GfVec2i> ranges,
+    TfSpan<GfVec3f> points) const
+{
+    TRACE_FUNCTION();
+
+    // The packed table may have been sized from an upper bound on the
+    // point count; only the points covered by both arrays are deformed.
+    const size_t numPoints =
+        std::min(static_cast<size_t>(ranges.size()),
+                 static_cast<size_t>(points.size()));
+
+    const size_t numOffsets = packedShapeTable.size();
+    const size_t numWeights = subShapeWeights.size();
+
+    // Flag for marking error state from within threads.
+    std::atomic_bool errors(false);
+
+    WorkParallelForN(
+        numPoints,
+        [&](size_t start, size_t end)
+        {
+            for (size_t i = start; i < end; ++i) {
+                const GfVec2i range = ranges[i];
+                if (ARCH_UNLIKELY(range[0] < 0 || range[1] < range[0] ||
+                                  static_cast<size_t>(range[1])
+                                  > numOffsets)) {
+                    TF_WARN("Invalid range [%d,%d) for point %zu "
+                            "(num offsets = %zu).",
+                            range[0], range[1], i, numOffsets);
+                    errors = true;
+                    return;
+                }
+
+                // Accumulate all weighted offsets for this point.
+                // Each point is owned by a single thread, so the loop is
+                // free of scattered writes and the offsets for the point
+                // are contiguous in memory.
+                GfVec3f p = points[i];
+                for (int j = range[0]; j < range[1]; ++j) {
+                    const GfVec4f& offset = packedShapeTable[j];
+                    const unsigned subShapeIndex =
+                        static_cast<unsigned>(offset[3]);
+                    const float weight = subShapeIndex < numWeights ?
+                        subShapeWeights[subShapeIndex] : 0.0f;
+                    p[0] += offset[0]*weight;
+                    p[1] += offset[1]*weight;
+                    p[2] += offset[2]*weight;
+                }
+                points[i] = p;
+            }
+        });
+
+    return !errors;
+}
+
+
 namespace {
 
 
@@ -138,6 +138,26 @@ public:
         const std::vector<VtVec3fArray>& subShapeNormalOffsets,
         TfSpan<GfVec3f> noramls) const;
 
+    /// Deform \p points by applying all sub-shapes in a single pass over
+    /// the points, using the packed \p packedShapeTable and \p ranges arrays
+    /// computed by ComputePackedShapeTable(), and the flattened
+    /// \p subShapeWeights computed by ComputeFlattenedSubShapeWeights().
+    ///
+    /// This is equivalent to applying each sub-shape with
+    /// ComputeDeformedPoints(), but each point is visited exactly once and
+    /// owned by a single thread, so the accumulation loop is free of
+    /// scattered writes and amenable to vectorization. When many shapes are
+    /// active -- as in facial rigs -- this is substantially faster than
+    /// per-shape application. The packed table depends only on the shape
+    /// topology, not on the weights, so it may be computed once and reused
+    /// across frames.
+    USDSKEL_API bool
+    ComputeDeformedPointsWithPackedShapeTable(
+        const TfSpan<const float> subShapeWeights,
+        const TfSpan<const GfVec4f> packedShapeTable,
+        const TfSpan<const GfVec2i> ranges,
+        TfSpan<GfVec3f> points) const;
+
     /// Compute a packed shape table combining all sub-shapes.
     /// This is intended to help encode blend shapes in a GPU-friendly form.
     /// The resulting \p offsets array holds contiguous runs of
@@ -19,6 +19,19 @@
 
 #include "pxr/base/arch/hints.h"
 
+#include "pxr/base/js/json.h"
+#include "pxr/base/tf/stl.h"
+#include "pxr/base/work/loops.h"
+#include "pxr/base/work/withScopedParallelism.h"
+
+#include "pxr/usd/ar/resolver.h"
+#include "pxr/usd/ar/timestamp.h"
+
+#include "pxr/usd/sdf/layer.h"
+
+#include <atomic>
+#include <fstream>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 
@@ -69,6 +82,233 @@ UsdSkelCache::Populate(const UsdSkelRoot& root,
 }
 
 
+bool
+UsdSkelCache::Populate(const std::vector<UsdSkelRoot>& roots,
+                       Usd_PrimFlagsPredicate predicate) const
+{
+    TRACE_FUNCTION();
+
+    // The underlying caches are concurrent containers, and multiple
+    // ReadScopes may be held concurrently, so the roots can be
+    // populated in parallel.
+    std::atomic_bool success(true);
+    WorkWithScopedParallelism([&]() {
+        WorkParallelForN(
+            roots.size(),
+            [&](size_t start, size_t end) {
+                for (size_t i = start; i < end; ++i) {
+                    if (!UsdSkel_CacheImpl::ReadScope(_impl.get())
+                            .Populate(roots[i], predicate)) {
+                        success = false;
+                    }
+                }
+            });
+    });
+    return success;
+}
+
+
+namespace {
+
+// Keys of the JSON file written by ExportPopulation().
+constexpr char _populationVersionKey[] = "version";
+constexpr char _populationLayersKey[] = "layers";
+constexpr char _populationBindingsKey[] = "bindings";
+
+constexpr int _populationFileVersion = 1;
+
+// Returns the modification timestamp of the given layer identifier, or
+// 0.0 if the resolver cannot provide one; using a fixed fallback keeps
+// the export- and import-side comparisons consistent.
+double
+_GetLayerTimestamp(ArResolver& resolver, const std::string& identifier)
+{
+    const ArTimestamp timestamp =
+        resolver.GetModificationTimestamp(
+            identifier, resolver.Resolve(identifier));
+    return timestamp.IsValid() ? timestamp.GetTime() : 0.0;
+}
+
+void
+_SetPathField(JsObject* obj, const char* key, const SdfPath& path)
+{
+    if (!path.IsEmpty()) {
+        (*obj)[key] = JsValue(path.GetString());
+    }
+}
+
+SdfPath
+_GetPathField(const JsObject& obj, const char* key)
+{
+    const JsValue* value = TfMapLookupPtr(obj, key);
+    return value && value->IsString() ?
+        SdfPath(value->GetString()) : SdfPath();
+}
+
+} // namespace
+
+
+bool
+UsdSkelCache::ExportPopulation(const UsdSkelRoot& root,
+                               const std::string& filePath,
+                               Usd_PrimFlagsPredicate predicate) const
+{
+    TRACE_FUNCTION();
+
+    UsdSkel_CacheImpl::PopulationRecordVector records;
+    if (!UsdSkel_CacheImpl::ReadScope(_impl.get())
+            .ExtractPopulationRecords(root, predicate, &records)) {
+        return false;
+    }
+
+    // Record the identifiers and modification timestamps of the layers
+    // used by the stage, so that import can reject stale files.
+    JsObject layers;
+    ArResolver& resolver = ArGetResolver();
+    for (SdfLayerHandle const& layer :
+             root.GetPrim().GetStage()->GetUsedLayers()) {
+        if (layer->IsAnonymous()) {
+            continue;
+        }
+        layers[layer->GetIdentifier()] =
+            JsValue(_GetLayerTimestamp(resolver, layer->GetIdentifier()));
+    }
+
+    JsArray bindings;
+    bindings.reserve(records.size());
+    for (const UsdSkel_CacheImpl::PopulationRecord& record : records) {
+        JsObject binding;
+        binding["prim"] = JsValue(record.primPath.GetString());
+        _SetPathField(&binding, "skel", record.skelPath);
+        _SetPathField(&binding, "jointIndices", record.jointIndicesPath);
+        _SetPathField(&binding, "jointWeights", record.jointWeightsPath);
+        _SetPathField(&binding, "skinningMethod", record.skinningMethodPath);
+        _SetPathField(&binding, "geomBindTransform",
+                      record.geomBindTransformPath);
+        _SetPathField(&binding, "joints", record.jointsPath);
+        _SetPathField(&binding, "blendShapes", record.blendShapesPath);
+        _SetPathField(&binding, "blendShapeTargets",
+                      record.blendShapeTargetsPath);
+        bindings.push_back(JsValue(std::move(binding)));
+    }
+
+    JsObject contents;
+    contents[_populationVersionKey] = JsValue(_populationFileVersion);
+    contents[_populationLayersKey] = JsValue(std::move(layers));
+    contents[_populationBindingsKey] = JsValue(std::move(bindings));
+
+    std::ofstream stream(filePath.c_str());
+    if (!stream) {
+        TF_RUNTIME_ERROR("Unable to open '%s' for writing.",
+                         filePath.c_str());
+        return false;
+    }
+    JsWriteToStream(JsValue(std::move(contents)), stream);
+    return static_cast<bool>(stream);
+}
+
+
+bool
+UsdSkelCache::ImportPopulation(const UsdSkelRoot& root,
+                               const std::string& filePath) const
+{
+    TRACE_FUNCTION();
+
+    if (!root) {
+        TF_CODING_ERROR("'root' is invalid.");
+        return false;
+    }
+
+    std::ifstream stream(filePath.c_str());
+    if (!stream) {
+        TF_DEBUG(USDSKEL_CACHE).Msg(
+            "[UsdSkelCache] Unable to open population file '%s'\n",
+            filePath.c_str());
+        return false;
+    }
+
+    JsParseError error;
+    const JsValue contents = JsParseStream(stream, &error);
+    if (!contents.IsObject()) {
+        TF_WARN("Unable to parse population file '%s': %s (line %d, "
+                "column %d)", filePath.c_str(), error.reason.c_str(),
+                error.line, error.column);
+        return false;
+    }
+    const JsObject& contentsObj = contents.GetJsObject();
+
+    const JsValue* version = TfMapLookupPtr(contentsObj, _populationVersionKey);
+    if (!version || !version->IsInt() ||
+        version->GetInt() != _populationFileVersion) {
+        TF_WARN("Population file '%s' has missing or unsupported version.",
+                filePath.c_str());
+        return false;
+    }
+
+    // Reject the file if any layer it was built from has since been
+    // modified; the recorded bindings may no longer match discovery.
+    const JsValue* layers = TfMapLookupPtr(contentsObj, _populationLayersKey);
+    if (!layers || !layers->IsObject()) {
+        TF_WARN("Population file '%s' has no layer records.",
+                filePath.c_str());
+        return false;
+    }
+    ArResolver& resolver = ArGetResolver();
+    for (const auto& pair : layers->GetJsObject()) {
+        if (!(pair.second.IsReal() || pair.second.IsInt()) ||
+            _GetLayerTimestamp(resolver, pair.first) !=
+                pair.second.GetReal()) {
+            TF_DEBUG(USDSKEL_CACHE).Msg(
+                "[UsdSkelCache] Rejecting stale population file '%s': "
+                "layer @%s@ has been modified\n",
+                filePath.c_str(), pair.first.c_str());
+            return false;
+        }
+    }
+
+    const JsValue* bindings =
+        TfMapLookupPtr(contentsObj, _populationBindingsKey);
+    if (!bindings || !bindings->IsArray()) {
+        TF_WARN("Population file '%s' has no binding records.",
+                filePath.c_str());
+        return false;
+    }
+
+    UsdSkel_CacheImpl::PopulationRecordVector records;
+    records.reserve(bindings->GetJsArray().size());
+    for (const JsValue& value : bindings->GetJsArray()) {
+        if (!value.IsObject()) {
+            TF_WARN("Malformed binding record in population file '%s'.",
+                    filePath.c_str());
+            return false;
+        }
+        const JsObject& binding = value.GetJsObject();
+
+        UsdSkel_CacheImpl::PopulationRecord record;
+        record.primPath = _GetPathField(binding, "prim");
+        if (record.primPath.IsEmpty()) {
+            TF_WARN("Malformed binding record in population file '%s'.",
+                    filePath.c_str());
+            return false;
+        }
+        record.skelPath = _GetPathField(binding, "skel");
+        record.jointIndicesPath = _GetPathField(binding, "jointIndices");
+        record.jointWeightsPath = _GetPathField(binding, "jointWeights");
+        record.skinningMethodPath = _GetPathField(binding, "skinningMethod");
+        record.geomBindTransformPath =
+            _GetPathField(binding, "geomBindTransform");
+        record.jointsPath = _GetPathField(binding, "joints");
+        record.blendShapesPath = _GetPathField(binding, "blendShapes");
+        record.blendShapeTargetsPath =
+            _GetPathField(binding, "blendShapeTargets");
+        records.push_back(std::move(record));
+    }
+
+    return UsdSkel_CacheImpl::ReadScope(_impl.get())
+        .PopulateFromRecords(root.GetPrim().GetStage(), records);
+}
+
+
 UsdSkelSkinningQuery
 UsdSkelCache::GetSkinningQuery(const UsdPrim& prim) const
 {
@@ -19,6 +19,8 @@
 #include "pxr/usd/usdSkel/binding.h"
 
 #include <memory>
+#include <string>
+#include <vector>
 
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -56,6 +58,40 @@ public:
     bool Populate(const UsdSkelRoot& root,
                   Usd_PrimFlagsPredicate predicate) const;
 
+    /// \overload
+    /// Populate the cache for several skel roots, processing the roots
+    /// in parallel. Returns true if population succeeded for all roots.
+    USDSKEL_API
+    bool Populate(const std::vector<UsdSkelRoot>& roots,
+                  Usd_PrimFlagsPredicate predicate) const;
+
+    /// Export the bindings that Populate() would discover beneath \p root
+    /// -- as traversed using \p predicate -- to a file at \p filePath,
+    /// so that a later process can ImportPopulation() instead of
+    /// re-running binding discovery.
+    ///
+    /// The exported file records the identifiers and modification
+    /// timestamps of the layers used by the stage, which are validated
+    /// on import. Returns false if the bindings cannot be serialized
+    /// (e.g., they reference content inside an instancing prototype,
+    /// whose paths are not stable across processes) or the file cannot
+    /// be written.
+    USDSKEL_API
+    bool ExportPopulation(const UsdSkelRoot& root,
+                          const std::string& filePath,
+                          Usd_PrimFlagsPredicate predicate) const;
+
+    /// Populate the cache for \p root from bindings previously written
+    /// by ExportPopulation(), skipping binding discovery.
+    ///
+    /// Returns false -- without populating the cache -- if the file
+    /// cannot be read, if any layer recorded in the file has since been
+    /// modified, or if a recorded binding no longer resolves on the
+    /// stage. Callers should then fall back to Populate().
+    USDSKEL_API
+    bool ImportPopulation(const UsdSkelRoot& root,
+                          const std::string& filePath) const;
+
     /// Get a skel query for computing properties of \p skel.
     ///
     /// This does not require Populate() to be called on the cache.
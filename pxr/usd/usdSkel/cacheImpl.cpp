@@ -209,6 +209,28 @@ UsdSkel_CacheImpl::ReadScope::Populate(const UsdSkelRoot& root,
     TF_DEBUG(USDSKEL_CACHE).Msg("[UsdSkelCache] Populate map from <%s>\n",
                                 root.GetPrim().GetPath().GetText());
 
+    return _ForEachSkinnablePrim(
+        root, predicate,
+        [this](const UsdPrim& prim, const _SkinningQueryKey& key) {
+            _PrimToSkinningQueryMap::accessor a;
+            if (_cache->_primSkinningQueryCache.insert(a, prim)) {
+                a->second = _FindOrCreateSkinningQuery(prim, key);
+            }
+
+            TF_DEBUG(USDSKEL_CACHE).Msg(
+                "[UsdSkelCache] Added skinning query for prim <%s>\n",
+                prim.GetPath().GetText());
+        });
+}
+
+
+bool
+UsdSkel_CacheImpl::ReadScope::_ForEachSkinnablePrim(
+    const UsdSkelRoot& root,
+    Usd_PrimFlagsPredicate predicate,
+    const std::function<void(const UsdPrim&,
+                             const _SkinningQueryKey&)>& fn)
+{
     if (!root) {
         TF_CODING_ERROR("'root' is invalid.");
         return false;
@@ -309,17 +331,9 @@ UsdSkel_CacheImpl::ReadScope::Populate(const UsdSkelRoot& root,
         }
 
         if (isSkinnable) {
-            // Append a skinning query using the resolved binding properties.
-
-            _PrimToSkinningQueryMap::accessor a;
-            if (_cache->_primSkinningQueryCache.insert(a, *it)) {
-                a->second = _FindOrCreateSkinningQuery(*it, key);
-            }
-
-            TF_DEBUG(USDSKEL_CACHE).Msg(
-                "[UsdSkelCache] %sAdded skinning query for prim <%s>\n",
-                _MakeIndent(stack.size()).c_str(),
-                it->GetPath().GetText());
+            // Report the skinnable prim with its resolved binding
+            // properties.
+            fn(*it, key);
 
             // Don't allow skinnable prims to be nested.
             it.PruneChildren();
@@ -330,4 +344,156 @@ UsdSkel_CacheImpl::ReadScope::Populate(const UsdSkelRoot& root,
     return true;
 }
 
+
+namespace {
+
+/// Return the path of \p obj, or the empty path if \p obj is invalid.
+template <typename UsdObjectType>
+SdfPath
+_GetPath(const UsdObjectType& obj)
+{
+    return obj ? obj.GetPath() : SdfPath();
+}
+
+} // namespace
+
+
+bool
+UsdSkel_CacheImpl::ReadScope::ExtractPopulationRecords(
+    const UsdSkelRoot& root,
+    Usd_PrimFlagsPredicate predicate,
+    PopulationRecordVector* records)
+{
+    TRACE_FUNCTION();
+
+    bool recordsAreSerializable = true;
+
+    const bool traversed = _ForEachSkinnablePrim(
+        root, predicate,
+        [&](const UsdPrim& prim, const _SkinningQueryKey& key) {
+            // Binding properties resolved through instance proxies are
+            // mapped to the instancing prototypes, whose paths are not
+            // stable across processes.
+            if (prim.IsInPrototype() ||
+                (key.skel && key.skel.IsInPrototype()) ||
+                (key.jointIndicesAttr &&
+                 key.jointIndicesAttr.GetPrim().IsInPrototype()) ||
+                (key.jointWeightsAttr &&
+                 key.jointWeightsAttr.GetPrim().IsInPrototype()) ||
+                (key.skinningMethodAttr &&
+                 key.skinningMethodAttr.GetPrim().IsInPrototype()) ||
+                (key.geomBindTransformAttr &&
+                 key.geomBindTransformAttr.GetPrim().IsInPrototype()) ||
+                (key.jointsAttr &&
+                 key.jointsAttr.GetPrim().IsInPrototype()) ||
+                (key.blendShapesAttr &&
+                 key.blendShapesAttr.GetPrim().IsInPrototype()) ||
+                (key.blendShapeTargetsRel &&
+                 key.blendShapeTargetsRel.GetPrim().IsInPrototype())) {
+                recordsAreSerializable = false;
+                return;
+            }
+
+            PopulationRecord record;
+            record.primPath = prim.GetPath();
+            record.skelPath = _GetPath(key.skel);
+            record.jointIndicesPath = _GetPath(key.jointIndicesAttr);
+            record.jointWeightsPath = _GetPath(key.jointWeightsAttr);
+            record.skinningMethodPath = _GetPath(key.skinningMethodAttr);
+            record.geomBindTransformPath = _GetPath(key.geomBindTransformAttr);
+            record.jointsPath = _GetPath(key.jointsAttr);
+            record.blendShapesPath = _GetPath(key.blendShapesAttr);
+            record.blendShapeTargetsPath = _GetPath(key.blendShapeTargetsRel);
+
+            records->push_back(std::move(record));
+        });
+
+    if (!traversed) {
+        return false;
+    }
+
+    if (!recordsAreSerializable) {
+        TF_WARN("Cannot extract population records for <%s>: bindings "
+                "reference content inside an instancing prototype.",
+                root.GetPrim().GetPath().GetText());
+        records->clear();
+        return false;
+    }
+    return true;
+}
+
+
+bool
+UsdSkel_CacheImpl::ReadScope::PopulateFromRecords(
+    const UsdStagePtr& stage,
+    const PopulationRecordVector& records)
+{
+    TRACE_FUNCTION();
+
+    for (const PopulationRecord& record : records) {
+
+        const UsdPrim prim = stage->GetPrimAtPath(record.primPath);
+        if (!prim) {
+            TF_WARN("Stale population record: prim <%s> does not exist.",
+                    record.primPath.GetText());
+            return false;
+        }
+
+        _SkinningQueryKey key;
+        if (!record.skelPath.IsEmpty()) {
+            key.skel = stage->GetPrimAtPath(record.skelPath);
+            if (!key.skel) {
+                TF_WARN("Stale population record: skel <%s> does not exist.",
+                        record.skelPath.GetText());
+                return false;
+            }
+        }
+
+        const auto getAttr = [&stage](const SdfPath& path,
+                                      UsdAttribute* attr) {
+            if (path.IsEmpty()) {
+                return true;
+            }
+            *attr = stage->GetAttributeAtPath(path);
+            if (!*attr) {
+                TF_WARN("Stale population record: attribute <%s> does "
+                        "not exist.", path.GetText());
+            }
+            return static_cast<bool>(*attr);
+        };
+
+        if (!(getAttr(record.jointIndicesPath, &key.jointIndicesAttr) &&
+              getAttr(record.jointWeightsPath, &key.jointWeightsAttr) &&
+              getAttr(record.skinningMethodPath, &key.skinningMethodAttr) &&
+              getAttr(record.geomBindTransformPath,
+                      &key.geomBindTransformAttr) &&
+              getAttr(record.jointsPath, &key.jointsAttr) &&
+              getAttr(record.blendShapesPath, &key.blendShapesAttr))) {
+            return false;
+        }
+
+        if (!record.blendShapeTargetsPath.IsEmpty()) {
+            key.blendShapeTargetsRel =
+                stage->GetRelationshipAtPath(record.blendShapeTargetsPath);
+            if (!key.blendShapeTargetsRel) {
+                TF_WARN("Stale population record: relationship <%s> does "
+                        "not exist.",
+                        record.blendShapeTargetsPath.GetText());
+                return false;
+            }
+        }
+
+        _PrimToSkinningQueryMap::accessor a;
+        if (_cache->_primSkinningQueryCache.insert(a, prim)) {
+            a->second = _FindOrCreateSkinningQuery(prim, key);
+        }
+
+        TF_DEBUG(USDSKEL_CACHE).Msg(
+            "[UsdSkelCache] Added skinning query for prim <%s> "
+            "from population record\n",
+            record.primPath.GetText());
+    }
+    return true;
+}
+
 PXR_NAMESPACE_CLOSE_SCOPE
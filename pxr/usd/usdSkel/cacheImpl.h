@@ -24,7 +24,9 @@
 #include <tbb/concurrent_hash_map.h>
 #include <tbb/queuing_rw_mutex.h>
 
+#include <functional>
 #include <unordered_map>
+#include <vector>
 
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -65,7 +67,27 @@ public:
         UsdRelationship blendShapeTargetsRel;
         UsdPrim skel;
     };
-    
+
+    /// Serializable description of the resolved binding of one skinnable
+    /// prim, as discovered by Populate(). Binding properties are recorded
+    /// as property paths so that the equivalent _SkinningQueryKey can be
+    /// rebuilt against a live stage without re-running discovery.
+    /// See UsdSkelCache::ExportPopulation.
+    struct PopulationRecord {
+        SdfPath primPath;
+        SdfPath skelPath;
+        SdfPath jointIndicesPath;
+        SdfPath jointWeightsPath;
+        SdfPath skinningMethodPath;
+        SdfPath geomBindTransformPath;
+        SdfPath jointsPath;
+        SdfPath blendShapesPath;
+        SdfPath blendShapeTargetsPath;
+    };
+
+    using PopulationRecordVector = std::vector<PopulationRecord>;
+
+
     /// Scope for performing read-only operations on the cache.
     /// Any thread-safe operations should be called here.
     struct ReadScope {
@@ -90,6 +112,23 @@ public:
         bool Populate(const UsdSkelRoot& root,
                       Usd_PrimFlagsPredicate predicate);
 
+        /// Run binding discovery beneath \p root and return the
+        /// discovered bindings as serializable records, without
+        /// mutating the cache. Returns false if \p root is invalid or
+        /// if a binding references content inside an instancing
+        /// prototype, whose paths are not stable across processes.
+        bool ExtractPopulationRecords(const UsdSkelRoot& root,
+                                      Usd_PrimFlagsPredicate predicate,
+                                      PopulationRecordVector* records);
+
+        /// Populate the cache from previously extracted \p records,
+        /// resolved against \p stage, skipping binding discovery.
+        /// Returns false if any recorded object no longer exists on
+        /// the stage, in which case callers should fall back to
+        /// Populate().
+        bool PopulateFromRecords(const UsdStagePtr& stage,
+                                 const PopulationRecordVector& records);
+
         // Getters for properties added to the cache through Populate().
 
         UsdSkelSkinningQuery
@@ -97,6 +136,14 @@ public:
 
     private:
 
+        /// Run binding discovery beneath \p root, invoking \p fn with
+        /// each skinnable prim and its resolved binding key.
+        bool _ForEachSkinnablePrim(
+            const UsdSkelRoot& root,
+            Usd_PrimFlagsPredicate predicate,
+            const std::function<void(const UsdPrim&,
+                                     const _SkinningQueryKey&)>& fn);
+
         UsdSkelSkinningQuery
         _FindOrCreateSkinningQuery(const UsdPrim& skinnedPrim,
                                    const _SkinningQueryKey& key);
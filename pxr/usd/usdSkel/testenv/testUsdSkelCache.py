@@ -232,6 +232,67 @@ class TestUsdSkelCache(unittest.TestCase):
         self.assertEqual(list(query.GetJointOrder()), ["override"])
         self.assertEqual(list(query.GetBlendShapeOrder()), ["override"])
 
+    def test_PopulationSerialization(self):
+        """Tests export/import of populated binding state."""
+
+        testFile = "populate.usda"
+        stage = Usd.Stage.Open(testFile)
+        root = UsdSkel.Root(stage.GetPrimAtPath("/SkelBinding"))
+
+        populationFile = "population.json"
+
+        cache = UsdSkel.Cache()
+        self.assertTrue(cache.ExportPopulation(
+            root, populationFile, Usd.PrimDefaultPredicate))
+
+        # An imported cache should produce the same bindings as one
+        # populated through discovery.
+        populatedCache = UsdSkel.Cache()
+        self.assertTrue(populatedCache.Populate(
+            root, Usd.PrimDefaultPredicate))
+
+        importedCache = UsdSkel.Cache()
+        self.assertTrue(importedCache.ImportPopulation(root, populationFile))
+
+        populatedBindings = populatedCache.ComputeSkelBindings(
+            root, Usd.PrimDefaultPredicate)
+        importedBindings = importedCache.ComputeSkelBindings(
+            root, Usd.PrimDefaultPredicate)
+        self.assertEqual(len(populatedBindings), len(importedBindings))
+        for populated,imported in zip(populatedBindings, importedBindings):
+            self.assertEqual(populated.GetSkeleton().GetPrim(),
+                             imported.GetSkeleton().GetPrim())
+            self.assertEqual(
+                [t.GetPrim() for t in populated.GetSkinningTargets()],
+                [t.GetPrim() for t in imported.GetSkinningTargets()])
+
+        # Bindings that reference instancing prototypes cannot be
+        # serialized; their paths are not stable across processes.
+        self.assertFalse(cache.ExportPopulation(
+            root, populationFile, Usd.TraverseInstanceProxies()))
+
+        # Importing a nonexistent file fails so that callers can fall
+        # back to Populate().
+        self.assertFalse(
+            UsdSkel.Cache().ImportPopulation(root, "noSuchFile.json"))
+
+
+    def test_PopulateMultipleRoots(self):
+        """Tests populating several skel roots in one call."""
+
+        testFile = "populate.usda"
+        stage = Usd.Stage.Open(testFile)
+
+        roots = [UsdSkel.Root(stage.GetPrimAtPath("/SkelBinding")),
+                 UsdSkel.Root(stage.GetPrimAtPath("/AnimBinding"))]
+
+        cache = UsdSkel.Cache()
+        self.assertTrue(cache.Populate(roots, Usd.PrimDefaultPredicate))
+
+        self.assertTrue(cache.GetSkinningQuery(
+            stage.GetPrimAtPath("/SkelBinding/Scope/Inherit")))
+
+
     def test_InstancedBlendShape(self):
         """Tests for correctness in the interpretation of instanced 
            blend shapes."""
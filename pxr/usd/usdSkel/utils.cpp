@@ -1255,52 +1255,69 @@ void
 _ConvertToDualQuaternions(TfSpan<const Matrix4> jointXforms,
                           TfSpan<GfDualQuatd> jointDualQuats,
                           TfSpan<Matrix3> jointScales,
+                          const bool inSerial,
                           bool *hasJointScale=nullptr)
 {
     TF_DEV_AXIOM(jointXforms.size() == jointDualQuats.size());
     TF_DEV_AXIOM(jointXforms.size() == jointScales.size());
 
-    GfMatrix4d scaleOrientMat, factoredRotMat, perspMat;
-    GfVec3d scale, translation;
-
     // when given, set *hasJointScale to true if any jointScales is not identity
-    if (hasJointScale) {
-        *hasJointScale = false;
-    }
-
-    for (size_t ji = 0; ji < jointXforms.size(); ++ji) {
-        const GfMatrix4d matrix = GfMatrix4d(jointXforms[ji]);
-
-        if (!matrix.Factor(&scaleOrientMat, &scale, &factoredRotMat,
-                           &translation, &perspMat)) {
-            // unable to decompose, set to zero
-            jointDualQuats[ji] = GfDualQuatd::GetZero();
-            jointScales[ji] = Matrix3(1);
-            continue;
-        }
-
-        // Remove shear & extract rotation
-        factoredRotMat.Orthonormalize();
-        const GfQuaternion rotationQ = factoredRotMat.ExtractRotationMatrix()
-            .ExtractRotationQuaternion();
+    std::atomic_bool anyJointScale(false);
 
-        // Construct dual quaternion from rotation & translation
-        jointDualQuats[ji] =
-            GfDualQuatd(GfQuatd(rotationQ.GetReal(), rotationQ.GetImaginary()),
-                        translation);
+    // Each joint is factored independently, and the factorization dominates
+    // the conversion cost, so process the joints in parallel. Large crowd
+    // skeletons easily exceed the grain size.
+    _ParallelForN(
+        jointXforms.size(), /* inSerial = */ inSerial,
+        [&](size_t start, size_t end)
+        {
+            GfMatrix4d scaleOrientMat, factoredRotMat, perspMat;
+            GfVec3d scale, translation;
+
+            for (size_t ji = start; ji < end; ++ji) {
+                const GfMatrix4d matrix = GfMatrix4d(jointXforms[ji]);
+
+                if (!matrix.Factor(&scaleOrientMat, &scale, &factoredRotMat,
+                                   &translation, &perspMat)) {
+                    // unable to decompose, set to zero
+                    jointDualQuats[ji] = GfDualQuatd::GetZero();
+                    jointScales[ji] = Matrix3(1);
+                    continue;
+                }
 
-        // Calculate jointScales by removing jointDualQuats from jointXforms
-        const GfMatrix4d tmpNonScaleXform =
-            factoredRotMat * GfMatrix4d(1.0).SetTranslate(translation);
-        // Extract the upper-left 3x3 matrix;
-        jointScales[ji] = Matrix3((matrix * tmpNonScaleXform.GetInverse()).
-                                  ExtractRotationMatrix());
+                // Remove shear & extract rotation
+                factoredRotMat.Orthonormalize();
+                const GfQuaternion rotationQ =
+                    factoredRotMat.ExtractRotationMatrix()
+                    .ExtractRotationQuaternion();
+
+                // Construct dual quaternion from rotation & translation
+                jointDualQuats[ji] =
+                    GfDualQuatd(GfQuatd(rotationQ.GetReal(),
+                                        rotationQ.GetImaginary()),
+                                translation);
+
+                // Calculate jointScales by removing jointDualQuats
+                // from jointXforms
+                const GfMatrix4d tmpNonScaleXform =
+                    factoredRotMat * GfMatrix4d(1.0).SetTranslate(translation);
+                // Extract the upper-left 3x3 matrix;
+                jointScales[ji] =
+                    Matrix3((matrix * tmpNonScaleXform.GetInverse()).
+                            ExtractRotationMatrix());
+
+                // If jointScales[ji] is not an identity matrix,
+                // need to set the flag
+                if (hasJointScale && !anyJointScale &&
+                    !GfIsClose(jointScales[ji], Matrix3(1), 1e-6)) {
+                    anyJointScale = true;
+                }
+            }
+        },
+        /*grainSize*/ 100);
 
-        // If jointScales[ji] is not an identity matrix, need to set the flag
-        if (hasJointScale && !*hasJointScale &&
-            !GfIsClose(jointScales[ji], Matrix3(1), 1e-6)) {
-            *hasJointScale = true;
-        }
+    if (hasJointScale) {
+        *hasJointScale = anyJointScale;
     }
 }
 
@@ -1434,6 +1451,7 @@ _SkinPointsDQS(const Matrix4& geomBindTransform,
     _ConvertToDualQuaternions(jointXforms,
                               TfSpan<GfDualQuatd>(jointDualQuats),
                               TfSpan<GfMatrix3f>(jointScales),
+                              inSerial,
                               &hasJointScale);
 
     _ParallelForN(
@@ -2501,6 +2519,7 @@ UsdSkel_SkinTransformDQS(const Matrix4& geomBindTransform,
     _ConvertToDualQuaternions(jointXforms,
                               TfSpan<GfDualQuatd>(jointDualQuats),
                               TfSpan<GfMatrix3f>(jointScales),
+                              /* inSerial = */ false,
                               &hasJointScale);
 
     // One option for skinning transforms would be to decompose the transforms
@@ -65,9 +65,24 @@ void wrapUsdSkelCache()
 
         .def("Clear", &This::Clear)
 
-        .def("Populate", &This::Populate,
+        .def("Populate",
+             (bool (UsdSkelCache::*)(const UsdSkelRoot&,
+                                     Usd_PrimFlagsPredicate) const)
+             &This::Populate,
              (arg("skelRoot"), arg("predicate")))
 
+        .def("Populate",
+             (bool (UsdSkelCache::*)(const std::vector<UsdSkelRoot>&,
+                                     Usd_PrimFlagsPredicate) const)
+             &This::Populate,
+             (arg("skelRoots"), arg("predicate")))
+
+        .def("ExportPopulation", &This::ExportPopulation,
+             (arg("skelRoot"), arg("filePath"), arg("predicate")))
+
+        .def("ImportPopulation", &This::ImportPopulation,
+             (arg("skelRoot"), arg("filePath")))
+
         .def("GetSkelQuery", &This::GetSkelQuery)
         
         .def("GetSkinningQuery", &This::GetSkinningQuery)
@@ -89,4 +104,8 @@ void wrapUsdSkelCache()
         .def("ComputeSkelBinding", &_ComputeSkelBinding,
              (arg("skelRoot"), arg("skel"), arg("predicate")))
         ;
-}            
+
+    TfPyContainerConversions::from_python_sequence<
+        std::vector<UsdSkelRoot>,
+        TfPyContainerConversions::variable_capacity_policy>();
+}
@@ -12,6 +12,7 @@
 
 #include "pxr/usd/ar/packageUtils.h"
 #include "pxr/usd/ar/resolver.h"
+#include "pxr/usd/ar/resolverContextBinder.h"
 #include "pxr/usd/sdf/assetPath.h"
 #include "pxr/usd/sdf/fileFormat.h"
 #include "pxr/usd/sdf/layerUtils.h"
@@ -30,6 +31,9 @@
 #include "pxr/base/tf/pathUtils.h"
 #include "pxr/base/tf/stringUtils.h"
 #include "pxr/base/trace/trace.h"
+#include "pxr/base/work/loops.h"
+#include "pxr/base/work/threadLimits.h"
+#include "pxr/base/work/withScopedParallelism.h"
 
 #include <stack>
 #include <vector>
@@ -51,16 +55,47 @@ UsdUtils_LocalizationContext::Process(
     _ProcessLayer(_rootLayer);
 
     while (!_queue.empty()) {
-        std::string anchoredPath = _queue.back();
-        _queue.pop_back();
-
-        if (!UsdStage::IsSupportedFile(anchoredPath)) {
-            continue;
+        // Drain the queue into a wave and open the wave's layers in
+        // parallel; resolving and reading layers dominates scan time for
+        // large assets.  Discovery itself stays on this thread because
+        // delegates are not required to be thread-safe.
+        std::vector<std::string> wave;
+        wave.swap(_queue);
+
+        std::vector<SdfLayerRefPtr> layers(wave.size());
+        const auto openLayer = [&wave, &layers](size_t i) {
+            if (UsdStage::IsSupportedFile(wave[i])) {
+                layers[i] = SdfLayer::FindOrOpen(wave[i]);
+            }
+        };
+
+        if (wave.size() > 1 && WorkHasConcurrency()) {
+            // The caller's resolver context binding is thread-local, so
+            // rebind it on each worker thread.
+            const ArResolverContext resolverContext =
+                ArGetResolver().GetCurrentContext();
+            WorkWithScopedParallelism([&]() {
+                WorkParallelForN(
+                    wave.size(),
+                    [&openLayer, &resolverContext](size_t begin, size_t end) {
+                        ArResolverContextBinder binder(resolverContext);
+                        for (size_t i = begin; i != end; ++i) {
+                            openLayer(i);
+                        }
+                    });
+            });
+        } else {
+            for (size_t i = 0; i != wave.size(); ++i) {
+                openLayer(i);
+            }
         }
 
-        SdfLayerRefPtr layer = SdfLayer::FindOrOpen(anchoredPath);
-        if (layer) {
-            _ProcessLayer(layer);
+        // Process in reverse to preserve the previous LIFO ordering
+        // within the wave.
+        for (size_t i = wave.size(); i-- > 0; ) {
+            if (layers[i]) {
+                _ProcessLayer(layers[i]);
+            }
         }
     }
 
@@ -0,0 +1,175 @@
+//
+// Copyright 2026 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+#include "pxr/pxr.h"
+#include "pxr/usd/usdUtils/compositionSnapshot.h"
+
+#include "pxr/usd/ar/resolver.h"
+#include "pxr/usd/ar/resolvedPath.h"
+#include "pxr/usd/ar/timestamp.h"
+#include "pxr/usd/sdf/layer.h"
+#include "pxr/base/tf/staticTokens.h"
+#include "pxr/base/trace/trace.h"
+#include "pxr/base/vt/dictionary.h"
+#include "pxr/base/vt/value.h"
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+TF_DEFINE_PRIVATE_TOKENS(
+    _tokens,
+
+    // customLayerData keys carrying snapshot provenance.
+    ((sourceLayers, "usdUtilsCompositionSnapshotSourceLayers"))
+    ((sourceLayerTimestamps, "usdUtilsCompositionSnapshotSourceLayerTimestamps"))
+);
+
+// Returns the modification timestamp of the given layer identifier, or
+// 0.0 if the resolver cannot provide one (e.g., for assets without
+// timestamps); using a fixed fallback keeps the create- and open-side
+// comparisons consistent.
+static
+double
+_GetLayerTimestamp(
+    ArResolver &resolver,
+    const std::string &identifier,
+    const ArResolvedPath &resolvedPath)
+{
+    const ArTimestamp timestamp =
+        resolver.GetModificationTimestamp(identifier, resolvedPath);
+    return timestamp.IsValid() ? timestamp.GetTime() : 0.0;
+}
+
+bool
+UsdUtilsCreateCompositionSnapshot(
+    const UsdStagePtr &stage,
+    const std::string &snapshotPath)
+{
+    if (!stage) {
+        TF_CODING_ERROR("Invalid stage");
+        return false;
+    }
+
+    TRACE_FUNCTION();
+
+    // Flatten preserves scenegraph instancing by emitting independent
+    // roots for each prototype; see UsdStage::Flatten.
+    SdfLayerRefPtr const flattened = stage->Flatten();
+    if (!flattened) {
+        return false;
+    }
+
+    // Record the identities and modification timestamps of the layers
+    // the composition consumed.  Anonymous layers (e.g., the session
+    // layer) have no on-disk representation to validate against, so
+    // they are omitted.
+    VtStringArray identifiers;
+    VtDoubleArray timestamps;
+    ArResolver &resolver = ArGetResolver();
+    for (SdfLayerHandle const &layer : stage->GetUsedLayers()) {
+        if (layer->IsAnonymous()) {
+            continue;
+        }
+        identifiers.push_back(layer->GetIdentifier());
+        timestamps.push_back(
+            _GetLayerTimestamp(
+                resolver, layer->GetIdentifier(),
+                ArResolvedPath(layer->GetRealPath())));
+    }
+
+    VtDictionary customLayerData = flattened->GetCustomLayerData();
+    customLayerData[_tokens->sourceLayers.GetString()] =
+        VtValue(identifiers);
+    customLayerData[_tokens->sourceLayerTimestamps.GetString()] =
+        VtValue(timestamps);
+    flattened->SetCustomLayerData(customLayerData);
+
+    return flattened->Export(snapshotPath);
+}
+
+UsdStageRefPtr
+UsdUtilsOpenCompositionSnapshot(
+    const std::string &snapshotPath)
+{
+    TRACE_FUNCTION();
+
+    SdfLayerRefPtr const layer = SdfLayer::FindOrOpen(snapshotPath);
+    if (!layer) {
+        return nullptr;
+    }
+
+    const VtDictionary customLayerData = layer->GetCustomLayerData();
+    const VtValue *const identifiersValue =
+        TfMapLookupPtr(customLayerData, _tokens->sourceLayers.GetString());
+    const VtValue *const timestampsValue =
+        TfMapLookupPtr(
+            customLayerData, _tokens->sourceLayerTimestamps.GetString());
+
+    if (!(identifiersValue &&
+          identifiersValue->IsHolding<VtStringArray>() &&
+          timestampsValue &&
+          timestampsValue->IsHolding<VtDoubleArray>())) {
+        TF_WARN(
+            "Layer @%s@ was not created by "
+            "UsdUtilsCreateCompositionSnapshot",
+            snapshotPath.c_str());
+        return nullptr;
+    }
+
+    const VtStringArray identifiers =
+        identifiersValue->UncheckedGet<VtStringArray>();
+    const VtDoubleArray timestamps =
+        timestampsValue->UncheckedGet<VtDoubleArray>();
+    if (identifiers.size() != timestamps.size()) {
+        TF_WARN(
+            "Malformed snapshot provenance in layer @%s@",
+            snapshotPath.c_str());
+        return nullptr;
+    }
+
+    // Reject the snapshot if any source layer changed on disk since
+    // the snapshot was written; the caller is expected to fall back to
+    // composing the stage normally.
+    ArResolver &resolver = ArGetResolver();
+    for (size_t i = 0; i < identifiers.size(); ++i) {
+        const double currentTimestamp =
+            _GetLayerTimestamp(
+                resolver, identifiers[i], resolver.Resolve(identifiers[i]));
+        if (currentTimestamp != timestamps[i]) {
+            TF_WARN(
+                "Composition snapshot @%s@ is stale: layer @%s@ has "
+                "changed since the snapshot was created",
+                snapshotPath.c_str(), identifiers[i].c_str());
+            return nullptr;
+        }
+    }
+
+    return UsdStage::Open(layer);
+}
+
+std::vector<std::string>
+UsdUtilsGetCompositionSnapshotSourceLayers(
+    const SdfLayerHandle &snapshotLayer)
+{
+    std::vector<std::string> result;
+
+    if (!snapshotLayer) {
+        TF_CODING_ERROR("Invalid layer");
+        return result;
+    }
+
+    const VtDictionary customLayerData = snapshotLayer->GetCustomLayerData();
+    const VtValue *const identifiersValue =
+        TfMapLookupPtr(customLayerData, _tokens->sourceLayers.GetString());
+    if (identifiersValue && identifiersValue->IsHolding<VtStringArray>()) {
+        const VtStringArray identifiers =
+            identifiersValue->UncheckedGet<VtStringArray>();
+        result.assign(identifiers.begin(), identifiers.end());
+    }
+
+    return result;
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
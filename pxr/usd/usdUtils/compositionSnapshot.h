@@ -0,0 +1,78 @@
+//
+// Copyright 2026 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+#ifndef PXR_USD_USD_UTILS_COMPOSITION_SNAPSHOT_H
+#define PXR_USD_USD_UTILS_COMPOSITION_SNAPSHOT_H
+
+/// \file usdUtils/compositionSnapshot.h
+///
+/// Utilities for sharing the composed results of a stage between
+/// processes.
+
+#include "pxr/pxr.h"
+#include "pxr/usd/usd/stage.h"
+#include "pxr/usd/usdUtils/api.h"
+#include "pxr/usd/sdf/declareHandles.h"
+
+#include <string>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+SDF_DECLARE_HANDLES(SdfLayer);
+
+/// Serialize the composed results of \p stage to \p snapshotPath so
+/// that sibling processes can open the same scene without repeating
+/// composition.
+///
+/// This is intended for farm-style workflows where many processes
+/// consume the same shot: one process composes the stage once and
+/// writes a snapshot; the others open the snapshot instead, paying
+/// only for deserialization.  Write snapshots as crate files (use a
+/// ".usdc" extension) so that sibling processes on the same host read
+/// the composed data through memory mapping rather than parsing.
+///
+/// The snapshot is built on UsdStage::Flatten and therefore preserves
+/// \ref Usd_Page_ScenegraphInstancing "scenegraph instancing": each
+/// prototype becomes an independent root referenced by its instances.
+/// The identities and modification timestamps of all layers the
+/// composition consumed are recorded in the snapshot's customLayerData
+/// so that the snapshot can be validated for freshness and inspected
+/// for provenance; see UsdUtilsOpenCompositionSnapshot and
+/// UsdUtilsGetCompositionSnapshotSourceLayers.
+///
+/// Returns true on success.
+USDUTILS_API
+bool
+UsdUtilsCreateCompositionSnapshot(
+    const UsdStagePtr &stage,
+    const std::string &snapshotPath);
+
+/// Open a stage from a snapshot previously written by
+/// UsdUtilsCreateCompositionSnapshot.
+///
+/// The recorded source layers are checked against their current
+/// modification timestamps on disk; if any layer has changed since the
+/// snapshot was written, or \p snapshotPath was not created by
+/// UsdUtilsCreateCompositionSnapshot, a null stage is returned and the
+/// caller should fall back to composing the scene normally.
+USDUTILS_API
+UsdStageRefPtr
+UsdUtilsOpenCompositionSnapshot(
+    const std::string &snapshotPath);
+
+/// Return the identifiers of the layers that were consumed by the
+/// composition recorded in \p snapshotLayer, in the order reported by
+/// UsdStage::GetUsedLayers at snapshot time.  Returns an empty vector
+/// if the layer does not carry snapshot provenance.
+USDUTILS_API
+std::vector<std::string>
+UsdUtilsGetCompositionSnapshotSourceLayers(
+    const SdfLayerHandle &snapshotLayer);
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif /* PXR_USD_USD_UTILS_COMPOSITION_SNAPSHOT_H */
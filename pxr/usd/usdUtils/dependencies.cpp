@@ -121,20 +121,35 @@ struct UsdUtils_ComputeAllDependenciesClient
 
         if (resolvedPath.empty()) {
             if (PathShouldResolve(layer, resolvedPath, dependencyType)) {
-                unresolvedPaths.insert(anchoredPath);
+                if (unresolvedPaths.insert(anchoredPath).second &&
+                    unresolvedPathFn) {
+                    unresolvedPathFn(anchoredPath);
+                }
             }
         }
         else if (UsdStage::IsSupportedFile(anchoredPath)) {
-            layers.insert(SdfLayer::FindOrOpen(anchoredPath));
+            SdfLayerRefPtr dependentLayer = SdfLayer::FindOrOpen(anchoredPath);
+            if (layers.insert(dependentLayer).second &&
+                dependentLayer && layerFn) {
+                layerFn(dependentLayer);
+            }
         }
         else {
-            assets.insert(resolvedPath);
+            if (assets.insert(resolvedPath).second && assetFn) {
+                assetFn(resolvedPath);
+            }
         }
     }
 
     std::unordered_set<SdfLayerRefPtr, TfHash> layers;
     std::unordered_set<std::string> assets, unresolvedPaths;
     std::function<UsdUtilsProcessingFunc> processingFunc;
+
+    // Optional callbacks that stream out dependencies as they are first
+    // discovered.
+    UsdUtilsDependencyLayerFn layerFn;
+    UsdUtilsDependencyAssetFn assetFn;
+    UsdUtilsDependencyUnresolvedPathFn unresolvedPathFn;
 };
 
 bool
@@ -184,7 +199,43 @@ UsdUtilsComputeAllDependencies(
     return true;
 }
 
-void 
+bool
+UsdUtilsComputeAllDependencies(
+    const SdfAssetPath &assetPath,
+    const UsdUtilsDependencyLayerFn &layerFn,
+    const UsdUtilsDependencyAssetFn &assetFn,
+    const UsdUtilsDependencyUnresolvedPathFn &unresolvedPathFn,
+    const std::function<UsdUtilsProcessingFunc> &processingFunc)
+{
+    SdfLayerRefPtr rootLayer = SdfLayer::FindOrOpen(assetPath.GetAssetPath());
+
+    if (!rootLayer) {
+        return false;
+    }
+
+    UsdUtils_ComputeAllDependenciesClient client(processingFunc);
+    client.layerFn = layerFn;
+    client.assetFn = assetFn;
+    client.unresolvedPathFn = unresolvedPathFn;
+
+    // Report the root layer up front, and record it so a cycle back to the
+    // root does not report it a second time.
+    client.layers.insert(rootLayer);
+    if (layerFn) {
+        layerFn(rootLayer);
+    }
+
+    UsdUtils_ReadOnlyLocalizationDelegate delegate(
+        std::bind(&UsdUtils_ComputeAllDependenciesClient::Process, &client,
+            std::placeholders::_1, std::placeholders::_2,
+            std::placeholders::_3));
+    UsdUtils_LocalizationContext context(&delegate);
+    context.SetMetadataFilteringEnabled(true);
+
+    return context.Process(rootLayer);
+}
+
+void
 UsdUtilsModifyAssetPaths(
     const SdfLayerHandle& layer,
     const UsdUtilsModifyAssetPathFn& modifyFn,
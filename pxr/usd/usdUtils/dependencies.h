@@ -70,7 +70,39 @@ UsdUtilsComputeAllDependencies(
     std::vector<SdfLayerRefPtr> *layers,
     std::vector<std::string> *assets,
     std::vector<std::string> *unresolvedPaths,
-    const std::function<UsdUtilsProcessingFunc> &processingFunc = 
+    const std::function<UsdUtilsProcessingFunc> &processingFunc =
+        std::function<UsdUtilsProcessingFunc>());
+
+/// Callbacks invoked by the streaming overload of
+/// UsdUtilsComputeAllDependencies as dependencies are discovered.
+/// \sa UsdUtilsComputeAllDependencies
+using UsdUtilsDependencyLayerFn = std::function<void(
+    const SdfLayerRefPtr &layer)>;
+using UsdUtilsDependencyAssetFn = std::function<void(
+    const std::string &assetPath)>;
+using UsdUtilsDependencyUnresolvedPathFn = std::function<void(
+    const std::string &unresolvedPath)>;
+
+/// \overload
+///
+/// Streaming variant of UsdUtilsComputeAllDependencies.  Instead of
+/// collecting results into vectors that are only available once the full
+/// scan completes, \p layerFn, \p assetFn, and \p unresolvedPathFn are
+/// invoked as each dependency is first discovered, so clients can begin
+/// acting on dependencies (e.g. copying files into a package) while the
+/// scan continues.  Each dependency is reported exactly once; the root
+/// layer is reported to \p layerFn before the scan begins.  Callbacks are
+/// invoked from the calling thread and in discovery order rather than the
+/// sorted order produced by the collecting overload.  Any of the callbacks
+/// may be empty if the corresponding dependency type is not of interest.
+USDUTILS_API
+bool
+UsdUtilsComputeAllDependencies(
+    const SdfAssetPath &assetPath,
+    const UsdUtilsDependencyLayerFn &layerFn,
+    const UsdUtilsDependencyAssetFn &assetFn,
+    const UsdUtilsDependencyUnresolvedPathFn &unresolvedPathFn,
+    const std::function<UsdUtilsProcessingFunc> &processingFunc =
         std::function<UsdUtilsProcessingFunc>());
 
 /// Callback that is used to modify asset paths in a layer.  The \c assetPath
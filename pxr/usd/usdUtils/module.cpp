@@ -13,6 +13,7 @@ TF_WRAP_MODULE
 {
     TF_WRAP( Authoring );
     TF_WRAP( CoalescingDiagnosticDelegate );
+    TF_WRAP( CompositionSnapshot );
     TF_WRAP( ConditionalAbortDiagnosticDelegate );
     TF_WRAP( Dependencies );
     TF_WRAP( FlattenLayerStack );
@@ -189,6 +189,23 @@ namespace {
             referencedIdentifier : resultingIdentifier;
     }
 
+    // Resolve an authored clip asset path to a normalized absolute path
+    // for comparison against a caller-supplied clip file path. Paths
+    // authored relative to the result layer (the output of
+    // _GetRelativePathIfPossible) are anchored to the result layer's
+    // directory; all other paths are anchored to the current directory,
+    // matching how they were originally passed in.
+    std::string
+    _ResolveClipAssetPath(const std::string& assetPath,
+                          const std::string& resultDir)
+    {
+        if (TfGetPathName(assetPath).empty() ||
+            TfStringStartsWith(assetPath, "./")) {
+            return TfNormPath(resultDir + "/" + assetPath);
+        }
+        return TfNormPath(TfAbsPath(assetPath));
+    }
+
     // During parallel generation, we will generate non-relative paths
     // for clipAssetPaths so we need to make a post-processing pass.
     // We want to respect paths which have already been normalized,
@@ -630,16 +647,64 @@ namespace {
         return result;
     }
 
+    // Generates sub-manifests from ranges of clip layers in parallel and
+    // joins them. Manifests hold only attribute declarations, so joining
+    // two sub-manifests is an ordinary topology merge. Note that
+    // parallel_reduce joins ranges in left-to-right order, so the result
+    // is deterministic.
+    struct _GenerateManifestResult {
+        SdfPath clipPath;
+        SdfLayerRefPtr manifest;
+
+        explicit _GenerateManifestResult(const SdfPath& _clipPath)
+            : clipPath(_clipPath)
+        {
+        }
+
+        _GenerateManifestResult(const _GenerateManifestResult& s, tbb::split)
+            : _GenerateManifestResult(s.clipPath)
+        {
+        }
+
+        void operator()(const tbb::blocked_range<
+                          SdfLayerRefPtrVector::const_iterator>& clipLayers)
+        {
+            SdfLayerRefPtr generated =
+                UsdClipsAPI::GenerateClipManifestFromLayers(
+                    SdfLayerHandleVector(clipLayers.begin(), clipLayers.end()),
+                    clipPath);
+            if (manifest) {
+                _StitchLayersIgnoringTimeSamples(manifest, generated);
+            } else {
+                manifest = generated;
+            }
+        }
+
+        void join(_GenerateManifestResult& rhs) {
+            if (manifest && rhs.manifest) {
+                _StitchLayersIgnoringTimeSamples(manifest, rhs.manifest);
+            } else if (rhs.manifest) {
+                manifest = rhs.manifest;
+            }
+        }
+    };
+
     void
     _GenerateClipManifest(const SdfLayerRefPtr& manifestLayer,
                           const SdfLayerRefPtr& topologyLayer,
                           const SdfLayerRefPtrVector& clipLayers,
                           const SdfPath& clipPath)
     {
-        SdfLayerRefPtr generatedManifest =
-            UsdClipsAPI::GenerateClipManifestFromLayers(
-                SdfLayerHandleVector(clipLayers.begin(), clipLayers.end()),
-                clipPath);
+        _GenerateManifestResult result(clipPath);
+        tbb::parallel_reduce(
+            tbb::blocked_range<SdfLayerRefPtrVector::const_iterator>(
+                clipLayers.begin(), clipLayers.end()),
+            result);
+
+        SdfLayerRefPtr generatedManifest = result.manifest;
+        if (!generatedManifest) {
+            return;
+        }
 
         generatedManifest->Traverse(clipPath,
             [&generatedManifest, &manifestLayer, &topologyLayer](
@@ -972,6 +1037,95 @@ UsdUtilsStitchClips(const SdfLayerHandle& resultLayer,
     return true;
 }
 
+bool
+UsdUtilsStitchClipsIncremental(const SdfLayerHandle& resultLayer,
+                               const _ClipFileVector& clipLayerFiles,
+                               const SdfPath& clipPath,
+                               const double startTimeCode,
+                               const double endTimeCode,
+                               const bool interpolateMissingClipValues,
+                               const TfToken& clipSet)
+{
+    // XXX: See comment in UsdUtilsStitchClipsTopology above.
+    TF_PY_ALLOW_THREADS_IN_SCOPE();
+
+    if (!_LayerIsWritable(resultLayer)) {
+        return false;
+    }
+
+    // Find the topology and manifest layers from the previous stitch. If
+    // either is missing, or the result layer holds no clip metadata to
+    // extend, there is nothing to be incremental about; run a full stitch.
+    SdfLayerRefPtr topologyLayer = SdfLayer::FindOrOpen(
+        UsdUtilsGenerateClipTopologyName(resultLayer->GetIdentifier()));
+    SdfLayerRefPtr manifestLayer = SdfLayer::FindOrOpen(
+        UsdUtilsGenerateClipManifestName(resultLayer->GetIdentifier()));
+    const auto existingAssets
+        = _GetUnboxedValue<_SdfAssetArray>(resultLayer, clipPath,
+                                           UsdClipsAPIInfoKeys->assetPaths,
+                                           clipSet);
+
+    if (!topologyLayer
+        || !manifestLayer
+        || !resultLayer->GetPrimAtPath(clipPath)
+        || existingAssets.empty()) {
+        return UsdUtilsStitchClips(resultLayer, clipLayerFiles, clipPath,
+                                   startTimeCode, endTimeCode,
+                                   interpolateMissingClipValues, clipSet);
+    }
+
+    if (!_LayerIsWritable(topologyLayer)
+        || !_LayerIsWritable(manifestLayer)) {
+        return false;
+    }
+
+    // Collect the clip files the clip set does not reference yet. Clips
+    // which are already referenced need no restitching: their time samples
+    // are read from the clip files at resolve time rather than copied into
+    // the result, so edits to their contents are picked up for free.
+    const std::string resultDir
+        = TfGetPathName(TfNormPath(resultLayer->GetRealPath()));
+    std::set<std::string> existingPaths;
+    for (const auto& asset : existingAssets) {
+        existingPaths.insert(
+            _ResolveClipAssetPath(asset.GetAssetPath(), resultDir));
+    }
+
+    _ClipFileVector newClipFiles;
+    newClipFiles.reserve(clipLayerFiles.size());
+    for (const std::string& clipFile : clipLayerFiles) {
+        if (!existingPaths.count(TfNormPath(TfAbsPath(clipFile)))) {
+            newClipFiles.push_back(clipFile);
+        }
+    }
+
+    // The result layer already references every requested clip.
+    if (newClipFiles.empty()) {
+        return true;
+    }
+
+    // Stitch only the new clips; _StitchLayers merges their aggregated
+    // metadata into the result layer's existing clip metadata, and the
+    // topology and manifest layers are extended in place.
+    SdfLayerRefPtrVector clipLayers;
+    const bool clipLayersAreValid
+        = _OpenClipLayers(&clipLayers, newClipFiles, clipPath);
+
+    if (!clipLayersAreValid
+        || !_UsdUtilsStitchClipsImpl(resultLayer, topologyLayer, manifestLayer,
+                                     clipLayers, clipPath,
+                                     startTimeCode, endTimeCode,
+                                     interpolateMissingClipValues,
+                                     clipSet)) {
+        return false;
+    }
+
+    topologyLayer->Save();
+    manifestLayer->Save();
+    resultLayer->Save();
+    return true;
+}
+
 std::string
 UsdUtilsGenerateClipTopologyName(const std::string& baseFileName)
 {
@@ -114,6 +114,42 @@ UsdUtilsStitchClips(const SdfLayerHandle& resultLayer,
                     const TfToken& clipSet
                         = UsdClipsAPISetNames->default_);
 
+/// A variant of UsdUtilsStitchClips which extends an existing stitched
+/// result rather than regenerating it from scratch.
+///
+/// The previously stitched \p resultLayer, and its associated topology and
+/// manifest layers, are examined to determine which of \p clipLayerFiles
+/// the clip set at \p clipPath does not reference yet; only those clips
+/// are analyzed and stitched in, so restitching a long sequence after
+/// publishing a handful of new per-frame files touches only the new files.
+/// Clips which are already referenced are left untouched: their time
+/// samples are consumed from the clip files at resolve time rather than
+/// copied into the result, so content edits to existing clips do not
+/// require restitching. Note that clips are identified by file path, and
+/// that an existing clip whose time range has changed will not have its
+/// clipTimes or clipActive entries updated; run a full stitch for that.
+///
+/// If \p resultLayer does not contain clip metadata for \p clipSet at
+/// \p clipPath, or the topology or manifest layer from the previous stitch
+/// cannot be found, this falls back to a full UsdUtilsStitchClips.
+///
+/// Parameters are as for UsdUtilsStitchClips.
+///
+USDUTILS_API
+bool
+UsdUtilsStitchClipsIncremental(
+    const SdfLayerHandle& resultLayer,
+    const std::vector<std::string>& clipLayerFiles,
+    const SdfPath& clipPath,
+    const double startTimeCode
+        = std::numeric_limits<double>::max(),
+    const double endTimeCode
+        = std::numeric_limits<double>::max(),
+    const bool interpolateMissingClipValues
+        = false,
+    const TfToken& clipSet
+        = UsdClipsAPISetNames->default_);
+
 /// A function which aggregates the topology of a set of \p clipLayerFiles
 /// for use in USD's Value Clips system. This aggregated scene topology
 /// will only include non-time-varying data, as it is for use in conjunction
@@ -0,0 +1,74 @@
+#!/pxrpythonsubst
+#
+# Copyright 2026 Pixar
+#
+# Licensed under the terms set forth in the LICENSE.txt file available at
+# https://openusd.org/license.
+
+from pxr import UsdUtils, Sdf, Usd
+import os, unittest
+
+class TestUsdUtilsCompositionSnapshot(unittest.TestCase):
+    def _CreateSourceScene(self):
+        refLayer = Sdf.Layer.CreateNew('model.usda')
+        refStage = Usd.Stage.Open(refLayer)
+        model = refStage.DefinePrim('/Model', 'Xform')
+        refStage.DefinePrim('/Model/Shape', 'Sphere')
+        refLayer.Save()
+
+        rootLayer = Sdf.Layer.CreateNew('shot.usda')
+        rootStage = Usd.Stage.Open(rootLayer)
+        for name in ['Instance1', 'Instance2']:
+            prim = rootStage.DefinePrim('/World/' + name, 'Xform')
+            prim.GetReferences().AddReference('model.usda', '/Model')
+            prim.SetInstanceable(True)
+        rootLayer.Save()
+
+        return Usd.Stage.Open(rootLayer)
+
+    def test_Basic(self):
+        srcStage = self._CreateSourceScene()
+
+        self.assertTrue(
+            UsdUtils.CreateCompositionSnapshot(srcStage, 'snapshot.usdc'))
+
+        stage = UsdUtils.OpenCompositionSnapshot('snapshot.usdc')
+        self.assertTrue(stage)
+
+        # The composed namespace survives, including instancing: both
+        # instances share a prototype rather than having been
+        # de-instanced.
+        for name in ['Instance1', 'Instance2']:
+            prim = stage.GetPrimAtPath('/World/' + name)
+            self.assertTrue(prim)
+            self.assertTrue(prim.IsInstance())
+            self.assertTrue(prim.GetChild('Shape'))
+
+        # The source layer identities are recorded for inspection.
+        sourceLayers = UsdUtils.GetCompositionSnapshotSourceLayers(
+            stage.GetRootLayer())
+        self.assertEqual(
+            sorted(os.path.basename(l) for l in sourceLayers),
+            ['model.usda', 'shot.usda'])
+
+    def test_StaleSnapshot(self):
+        srcStage = self._CreateSourceScene()
+
+        self.assertTrue(
+            UsdUtils.CreateCompositionSnapshot(srcStage, 'stale.usdc'))
+
+        # Changing a source layer on disk invalidates the snapshot.
+        refLayer = Sdf.Layer.FindOrOpen('model.usda')
+        Usd.Stage.Open(refLayer).DefinePrim('/Model/Extra', 'Cube')
+        refLayer.Save(force=True)
+        os.utime(refLayer.realPath, None)
+
+        self.assertFalse(UsdUtils.OpenCompositionSnapshot('stale.usdc'))
+
+    def test_NotASnapshot(self):
+        layer = Sdf.Layer.CreateNew('plain.usda')
+        layer.Save()
+        self.assertFalse(UsdUtils.OpenCompositionSnapshot('plain.usda'))
+
+if __name__=="__main__":
+    unittest.main()
@@ -138,6 +138,44 @@ class TestUsdUtilsStitchClips(unittest.TestCase):
         self.assertTrue(topologyLayer)
         self.assertTrue(topologyLayer.GetPrimAtPath(newClipPath))
 
+    def test_StitchClipsIncremental(self):
+        resultLayer = Sdf.Layer.CreateNew('incremental.usd')
+
+        # With no prior stitch to extend, this falls back to a full stitch.
+        UsdUtils.StitchClipsIncremental(resultLayer, self.layerFileNames[0:4],
+                                        self.clipPath)
+        prim = resultLayer.GetPrimAtPath(self.clipPath)
+        self.assertEqual(
+            len(prim.GetInfo('clips')['default']['assetPaths']), 4)
+        self.assertEqual(resultLayer.endTimeCode, 104)
+
+        # Restitching with new clips appended only stitches the new clips,
+        # extending the existing metadata.
+        UsdUtils.StitchClipsIncremental(resultLayer, self.layerFileNames[0:7],
+                                        self.clipPath)
+        prim = resultLayer.GetPrimAtPath(self.clipPath)
+        clipInfo = prim.GetInfo('clips')['default']
+        self.assertEqual(len(clipInfo['assetPaths']), 7)
+        self.assertEqual([i[1] for i in clipInfo['active']],
+                         list(range(7)))
+        self.assertEqual(resultLayer.startTimeCode, 101)
+        self.assertEqual(resultLayer.endTimeCode, 107)
+
+        # The topology and manifest cover the new clips as well.
+        topologyLayer = Sdf.Layer.FindOrOpen('incremental.topology.usd')
+        self.assertTrue(topologyLayer)
+        self.assertTrue(topologyLayer.GetPrimAtPath(self.clipPath))
+        manifestLayer = Sdf.Layer.FindOrOpen('incremental.manifest.usd')
+        self.assertTrue(manifestLayer)
+        self.assertTrue(manifestLayer.GetPrimAtPath(self.clipPath))
+
+        # Restitching an up-to-date result is a no-op.
+        UsdUtils.StitchClipsIncremental(resultLayer, self.layerFileNames[0:7],
+                                        self.clipPath)
+        prim = resultLayer.GetPrimAtPath(self.clipPath)
+        self.assertEqual(
+            len(prim.GetInfo('clips')['default']['assetPaths']), 7)
+
     def test_ExplicitEndCodes(self):
         start = 104
         end   = 105
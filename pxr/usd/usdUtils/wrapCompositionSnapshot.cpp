@@ -0,0 +1,36 @@
+//
+// Copyright 2026 Pixar
+//
+// Licensed under the terms set forth in the LICENSE.txt file available at
+// https://openusd.org/license.
+//
+#include "pxr/pxr.h"
+#include <boost/python/def.hpp>
+
+#include "pxr/usd/usdUtils/compositionSnapshot.h"
+#include "pxr/usd/sdf/layer.h"
+#include "pxr/base/tf/pyResultConversions.h"
+#include "pxr/base/tf/pyPtrHelpers.h"
+#include "pxr/base/tf/makePyConstructor.h"
+
+using namespace boost::python;
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+void wrapCompositionSnapshot()
+{
+    def("CreateCompositionSnapshot",
+        UsdUtilsCreateCompositionSnapshot,
+        (arg("stage"), arg("snapshotPath")));
+
+    def("OpenCompositionSnapshot",
+        UsdUtilsOpenCompositionSnapshot,
+        (arg("snapshotPath")),
+        boost::python::return_value_policy<
+        TfPyRefPtrFactory<UsdStagePtr> >());
+
+    def("GetCompositionSnapshotSourceLayers",
+        UsdUtilsGetCompositionSnapshotSourceLayers,
+        (arg("snapshotLayer")),
+        boost::python::return_value_policy<TfPySequenceToList>());
+}
@@ -52,6 +52,26 @@ _ConvertStitchClips(const SdfLayerHandle& resultLayer,
         clipSet);
 }
 
+bool
+_ConvertStitchClipsIncremental(const SdfLayerHandle& resultLayer,
+                               const std::vector<std::string>& clipLayerFiles,
+                               const SdfPath& clipPath,
+                               const object pyStartFrame,
+                               const object pyEndFrame,
+                               const object pyInterpolateMissingClipValues,
+                               const object pyClipSet)
+{
+    const auto clipSet
+        = _ConvertWithDefault(pyClipSet, UsdClipsAPISetNames->default_);
+    constexpr double dmax = std::numeric_limits<double>::max();
+    return UsdUtilsStitchClipsIncremental(
+        resultLayer, clipLayerFiles, clipPath,
+        _ConvertWithDefault(pyStartFrame, dmax),
+        _ConvertWithDefault(pyEndFrame, dmax),
+        _ConvertWithDefault(pyInterpolateMissingClipValues, false),
+        clipSet);
+}
+
 bool
 _ConvertStitchClipsTopology(const SdfLayerHandle& topologyLayer,
                            const std::vector<std::string>& clipLayerFiles)
@@ -105,6 +125,16 @@ void wrapStitchClips()
          arg("interpolateMissingClipValues")=object(),
          arg("clipSet")=object()));
 
+    def("StitchClipsIncremental",
+        _ConvertStitchClipsIncremental,
+        (arg("resultLayer"),
+         arg("clipLayerFiles"),
+         arg("clipPath"),
+         arg("startFrame")=object(),
+         arg("endFrame")=object(),
+         arg("interpolateMissingClipValues")=object(),
+         arg("clipSet")=object()));
+
     def("StitchClipsTopology",
         _ConvertStitchClipsTopology,
         (arg("topologyLayer"),
@@ -1633,8 +1633,20 @@ UsdImagingDelegate::_RefreshUsdObject(
         }
     }
 
-    // PERFORMANCE: We could execute this in parallel, for large numbers of
-    // prims.
+    // Process*Change and the dirty-bits propagation below mutate shared
+    // state and stay serial; TrackVariability only reads the stage and is
+    // by far the most expensive step, so it runs as a separate parallel
+    // phase over the affected prims, mirroring
+    // _ExecuteWorkForVariabilityUpdate.
+    struct _AffectedPrim {
+        _HdPrimInfo *primInfo;
+        SdfPath cachePath;
+        HdDirtyBits dirtyBits;
+    };
+    std::vector<_AffectedPrim> dirtiedPrims;
+    // Indices into dirtiedPrims needing variability re-discovery.
+    std::vector<size_t> variabilityIndices;
+
     for (SdfPath const& affectedCachePath: affectedCachePaths) {
 
         _HdPrimInfo *primInfo = _GetHdPrimInfo(affectedCachePath);
@@ -1674,24 +1686,15 @@ UsdImagingDelegate::_RefreshUsdObject(
             if (dirtyBits == HdChangeTracker::Clean) {
                 // Do nothing
             } else if (dirtyBits != HdChangeTracker::AllDirty) {
+                dirtiedPrims.push_back(
+                    {primInfo, affectedCachePath, dirtyBits});
+
                 // Update variability, if we haven't already done so for this
                 // prim while refreshing another prim that affects this one.
-                if (allTrackedVariabilityPaths->find(affectedCachePath) ==
-                    allTrackedVariabilityPaths->end()) {
+                if (allTrackedVariabilityPaths->insert(
+                        affectedCachePath).second) {
                     _timeVaryingPrimCacheValid = false;
-                    primInfo->timeVaryingBits = HdChangeTracker::Clean;
-                    adapter->TrackVariability(primInfo->usdPrim,
-                                              affectedCachePath,
-                                              &primInfo->timeVaryingBits);
-                    allTrackedVariabilityPaths->insert(affectedCachePath);
-                }
-
-                // Propagate the dirty bits back out to the change tracker.
-                HdDirtyBits combinedBits =
-                    dirtyBits | primInfo->timeVaryingBits;
-                if (combinedBits != HdChangeTracker::Clean) {
-                    adapter->MarkDirty(primInfo->usdPrim, affectedCachePath,
-                                       combinedBits, proxy);
+                    variabilityIndices.push_back(dirtiedPrims.size() - 1);
                 }
             } else {
                 // If we want to resync the hydra prim, generate a fake resync
@@ -1702,6 +1705,41 @@ UsdImagingDelegate::_RefreshUsdObject(
         }
     }
 
+    if (!variabilityIndices.empty()) {
+        _primvarDescCache.DisableMutation();
+        {
+            // Release the GIL to ensure that threaded work won't deadlock if
+            // they also need the GIL.
+            TF_PY_ALLOW_THREADS_IN_SCOPE();
+            WorkParallelForN(
+                variabilityIndices.size(),
+                [&dirtiedPrims, &variabilityIndices](size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; ++i) {
+                        const _AffectedPrim &affected =
+                            dirtiedPrims[variabilityIndices[i]];
+                        affected.primInfo->timeVaryingBits =
+                            HdChangeTracker::Clean;
+                        affected.primInfo->adapter->TrackVariability(
+                            affected.primInfo->usdPrim,
+                            affected.cachePath,
+                            &affected.primInfo->timeVaryingBits);
+                    }
+                });
+        }
+        _primvarDescCache.EnableMutation();
+    }
+
+    // Propagate the dirty bits back out to the change tracker.
+    for (const _AffectedPrim &affected : dirtiedPrims) {
+        const HdDirtyBits combinedBits =
+            affected.dirtyBits | affected.primInfo->timeVaryingBits;
+        if (combinedBits != HdChangeTracker::Clean) {
+            affected.primInfo->adapter->MarkDirty(
+                affected.primInfo->usdPrim, affected.cachePath,
+                combinedBits, proxy);
+        }
+    }
+
     return resyncNeeded;
 }
 
@@ -39,12 +39,15 @@
 
 #include "pxr/base/gf/matrix4f.h"
 #include "pxr/base/gf/range3d.h"
+#include "pxr/base/tf/hash.h"
 #include "pxr/base/tf/token.h"
 
 #include "pxr/pxr.h"
 
 #include <array>
 #include <bitset>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -1089,6 +1092,23 @@ private:
         }
         
     private:
+        /// Geometry depending only on the card configuration - not on the
+        /// prim itself. Since layout scenes tend to contain many carded
+        /// assets with identical configurations, this data is pooled
+        /// flyweight-style and shared between all standins whose schema
+        /// values produce an equal _GetSharedGeometry key.
+        struct _SharedGeometry
+        {
+            VtVec3fArray points;
+            HdContainerDataSourceHandle extent;
+            HdDataSourceBaseHandle uvs;
+            HdContainerDataSourceHandle meshTopology;
+        };
+
+        static
+        std::shared_ptr<const _SharedGeometry>
+        _GetSharedGeometry(const _SchemaValues &values);
+
         static
         VtVec3fArray
         _ComputePoints(const _SchemaValues &values);
@@ -1148,27 +1168,10 @@ _ConvertToMatrix(const Vec &mvec, GfMatrix4d *mat)
 
 /// Open image to extract worldtoscreen matrix.
 bool
-GetWorldToScreenFromImageMetadata(
-    HdAssetPathDataSourceHandle const &src,
+_ReadWorldToScreenFromImageMetadata(
+    const std::string &file,
     GfMatrix4d * const mat)
 {
-    if (!src) {
-        return false;
-    }
-
-    const SdfAssetPath asset = src->GetTypedValue(0.0f);
-
-    // If the literal path is empty, ignore this attribute.
-    if (asset.GetAssetPath().empty()) {
-        return false;
-    }
-
-    std::string file = asset.GetResolvedPath();
-    // Fallback to the literal path if it couldn't be resolved.
-    if (file.empty()) {
-        file = asset.GetAssetPath();
-    }
-
     HioImageSharedPtr const img = HioImage::OpenForReading(file);
     if (!img) {
         return false;
@@ -1233,6 +1236,65 @@ GetWorldToScreenFromImageMetadata(
     return false;
 }
 
+bool
+GetWorldToScreenFromImageMetadata(
+    HdAssetPathDataSourceHandle const &src,
+    GfMatrix4d * const mat)
+{
+    if (!src) {
+        return false;
+    }
+
+    const SdfAssetPath asset = src->GetTypedValue(0.0f);
+
+    // If the literal path is empty, ignore this attribute.
+    if (asset.GetAssetPath().empty()) {
+        return false;
+    }
+
+    std::string file = asset.GetResolvedPath();
+    // Fallback to the literal path if it couldn't be resolved.
+    if (file.empty()) {
+        file = asset.GetAssetPath();
+    }
+
+    // Reading the metadata requires opening the image. Many standins
+    // typically reference the same texture, so share the result (and any
+    // warning issued while reading it) across all of them. Entries live
+    // for the rest of the process - like the texture data itself, the
+    // metadata is assumed not to change behind our back.
+    struct _CacheEntry
+    {
+        bool valid;
+        GfMatrix4d mat;
+    };
+    static std::mutex cacheMutex;
+    static std::unordered_map<std::string, _CacheEntry> cache;
+
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        const auto it = cache.find(file);
+        if (it != cache.end()) {
+            if (it->second.valid) {
+                *mat = it->second.mat;
+            }
+            return it->second.valid;
+        }
+    }
+
+    // Read outside of the lock so that concurrent reads of distinct
+    // textures are not serialized. Two threads may race to read the same
+    // texture; the first result inserted wins.
+    const bool valid = _ReadWorldToScreenFromImageMetadata(file, mat);
+
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        cache.insert({ file, { valid, valid ? *mat : GfMatrix4d(1.0) } });
+    }
+
+    return valid;
+}
+
 _CardsDataCache::_SchemaValues::_SchemaValues(UsdImagingGeomModelSchema schema)
 {
     if (HdTokenDataSourceHandle src = schema.GetCardGeometry()) {
@@ -1318,17 +1380,95 @@ _DisjointQuadTopology(const size_t n)
             .Build();
 }
 
+/// Key identifying the schema values the shared cards geometry is computed
+/// from. The worldToScreen matrices only feed into the geometry for
+/// cardGeometry = fromTexture (and are only initialized for faces that are
+/// drawn), so they only enter the key in that case.
+struct _CardsGeometryKey
+{
+    TfToken cardGeometry;
+    unsigned long hasTexture;
+    unsigned long hasFace;
+    std::vector<GfMatrix4d> worldToScreen;
+
+    bool operator==(const _CardsGeometryKey &other) const {
+        return
+            cardGeometry == other.cardGeometry &&
+            hasTexture == other.hasTexture &&
+            hasFace == other.hasFace &&
+            worldToScreen == other.worldToScreen;
+    }
+
+    template <class HashState>
+    friend void TfHashAppend(HashState &h, const _CardsGeometryKey &key) {
+        h.Append(
+            key.cardGeometry,
+            key.hasTexture,
+            key.hasFace,
+            key.worldToScreen);
+    }
+};
+
+/// Get (creating it if necessary) the pooled geometry for the card
+/// configuration described by the given schema values.
+std::shared_ptr<const _CardsDataCache::_CardsData::_SharedGeometry>
+_CardsDataCache::_CardsData::_GetSharedGeometry(const _SchemaValues &values)
+{
+    _CardsGeometryKey key;
+    key.cardGeometry = values.cardGeometry;
+    key.hasTexture = values.hasTexture.to_ulong();
+    key.hasFace = values.hasFace.to_ulong();
+    if (values.cardGeometry == UsdGeomTokens->fromTexture) {
+        for (size_t i = 0; i < 6; i++) {
+            if (values.hasFace[i]) {
+                key.worldToScreen.push_back(values.worldToScreen[i]);
+            }
+        }
+    }
+
+    // Entries are small (at most 24 points plus a few immutable data
+    // sources) and scenes only use a handful of distinct card
+    // configurations, so entries simply live for the rest of the process.
+    static std::mutex poolMutex;
+    static std::unordered_map<
+        _CardsGeometryKey,
+        std::shared_ptr<const _SharedGeometry>,
+        TfHash> pool;
+
+    std::lock_guard<std::mutex> lock(poolMutex);
+    std::shared_ptr<const _SharedGeometry> &entry = pool[key];
+    if (!entry) {
+        auto geometry = std::make_shared<_SharedGeometry>();
+        geometry->points = _ComputePoints(values);
+        geometry->extent = _ComputeExtent(values.cardGeometry,
+                                          geometry->points);
+        geometry->uvs = HdRetainedTypedSampledDataSource<VtVec2fArray>::New(
+            _ComputeUVs(values));
+        geometry->meshTopology = _DisjointQuadTopology(values.hasFace.count());
+        entry = geometry;
+    }
+    return entry;
+}
+
 /// Compute cached data from schema values.
 _CardsDataCache::_CardsData::_CardsData(const _SchemaValues &values,
     const SdfPath &primPath)
   : cardGeometry(values.cardGeometry)
-  , points(_ComputePoints(values))
-  , extent(_ComputeExtent(cardGeometry, points))
-  , uvs(HdRetainedTypedSampledDataSource<VtVec2fArray>::New(_ComputeUVs(values)))
   , geomSubsets(_ComputeGeomSubsets(values, primPath))
-  , meshTopology(_DisjointQuadTopology(values.hasFace.count()))
   , materials(_ComputeMaterials(values))
 {
+    // The geom subsets and materials above reference the prim path and
+    // the prim's drawModeColor and texture data sources, so they are
+    // per-prim. The geometry, on the other hand, is shared between all
+    // prims with the same card configuration - VtArray is copy-on-write
+    // and the data sources are immutable, so the copies here merely
+    // alias the pooled data.
+    const std::shared_ptr<const _SharedGeometry> geometry =
+        _GetSharedGeometry(values);
+    points = geometry->points;
+    extent = geometry->extent;
+    uvs = geometry->uvs;
+    meshTopology = geometry->meshTopology;
 }
 
 GfVec3f
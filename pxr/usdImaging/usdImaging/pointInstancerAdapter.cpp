@@ -708,8 +708,12 @@ UsdImagingPointInstancerAdapter::UpdateForTime(UsdPrim const& prim,
             // PERFORMANCE: It would be nice to track variability of individual
             // primvars separately, since uniform values will  needlessly be
             // sent to the GPU on every frame.
-            VtVec3fArray positions;
-            if (instancer.GetPositionsAttr().Get(&positions, time)) {
+            //
+            // Note that we only need to know whether each attribute resolves
+            // to a value here; the array data itself is pulled later through
+            // Get()/SamplePrimvar(). HasValue() answers that without reading
+            // the (potentially huge) instance arrays.
+            if (instancer.GetPositionsAttr().HasValue()) {
                 _MergePrimvar(
                     &vPrimvars,
                     HdInstancerTokens->instanceTranslations,
@@ -718,51 +722,36 @@ UsdImagingPointInstancerAdapter::UpdateForTime(UsdPrim const& prim,
             }
 
             UsdAttribute orientationsAttr;
-            if (instancer.UsesOrientationsf(&orientationsAttr)) {
-                VtQuatfArray orientationsf;
-                if (orientationsAttr.Get(&orientationsf, time)) {
-                    _MergePrimvar(
-                        &vPrimvars,
-                        HdInstancerTokens->instanceRotations,
-                        HdInterpolationInstance);
-                }
-            } else {
-                VtQuathArray orientations;
-                if (orientationsAttr.Get(&orientations, time)) {
-                    _MergePrimvar(
-                        &vPrimvars,
-                        HdInstancerTokens->instanceRotations,
-                        HdInterpolationInstance);
-                }
+            instancer.UsesOrientationsf(&orientationsAttr);
+            if (orientationsAttr.HasValue()) {
+                _MergePrimvar(
+                    &vPrimvars,
+                    HdInstancerTokens->instanceRotations,
+                    HdInterpolationInstance);
             }
 
-            VtVec3fArray scales;
-            if (instancer.GetScalesAttr().Get(&scales, time)) {
+            if (instancer.GetScalesAttr().HasValue()) {
                 _MergePrimvar(
                     &vPrimvars,
                     HdInstancerTokens->instanceScales,
                     HdInterpolationInstance);
             }
 
-            VtVec3fArray velocities;
-            if (instancer.GetVelocitiesAttr().Get(&velocities, time)) {
+            if (instancer.GetVelocitiesAttr().HasValue()) {
                 _MergePrimvar(
                     &vPrimvars,
                     HdTokens->velocities,
                     HdInterpolationInstance);
             }
 
-            VtVec3fArray accelerations;
-            if (instancer.GetAccelerationsAttr().Get(&accelerations, time)) {
+            if (instancer.GetAccelerationsAttr().HasValue()) {
                 _MergePrimvar(
                     &vPrimvars,
                     HdTokens->accelerations,
                     HdInterpolationInstance);
             }
 
-            VtVec3fArray angularVelocities;
-            if (instancer.GetAngularVelocitiesAttr()
-                    .Get(&angularVelocities, time)) {
+            if (instancer.GetAngularVelocitiesAttr().HasValue()) {
                 _MergePrimvar(
                     &vPrimvars,
                     HdTokens->angularVelocities,
@@ -18,12 +18,19 @@
 #include "pxr/imaging/hd/dataSourceTypeDefs.h"
 
 #include "pxr/base/tf/denseHashSet.h"
+#include "pxr/base/tf/envSetting.h"
+#include "pxr/base/tf/pyLock.h"
+#include "pxr/base/work/loops.h"
 
 PXR_NAMESPACE_OPEN_SCOPE
 
 TF_DEFINE_PUBLIC_TOKENS(UsdImagingStageSceneIndexTokens,
                         USDIMAGING_STAGE_SCENE_INDEX_TOKENS);
 
+TF_DEFINE_ENV_SETTING(USDIMAGING_PARALLEL_STAGE_POPULATION, true,
+                      "Enumerate imaging subprims and their types in "
+                      "parallel during stage scene index population.");
+
 namespace
 {
 
@@ -393,17 +400,25 @@ void UsdImagingStageSceneIndex::_PopulateSubtree(UsdPrim subtreeRoot)
         return;
     }
 
-    HdSceneIndexObserver::AddedPrimEntries addedPrims;
-    size_t lastEnd = 0;
+    // Gather the prims to populate with a serial traversal; pruning
+    // decisions depend on each prim's adapter, so the traversal itself
+    // is inherently ordered.  The adapter lookups here warm the adapter
+    // manager's caches, which are concurrent containers, so the per-prim
+    // subprim enumeration below is safe to run in parallel.
+    struct _WorkItem {
+        UsdPrim prim;
+        // Note: references into the adapter manager's caches are stable.
+        const UsdImaging_AdapterManager::AdaptersEntry *entry;
+    };
+    std::vector<_WorkItem> workItems;
+    bool foundPseudoRoot = false;
 
     UsdPrimRange range(subtreeRoot, _GetPrimPredicate());
 
     for (auto it = range.begin(); it != range.end(); ++it) {
         const UsdPrim &prim = *it;
         if (prim.IsPseudoRoot()) {
-            // XXX for now, we have to make sure the prim at the absolute root
-            // path is "added"
-            addedPrims.emplace_back(SdfPath::AbsoluteRootPath(), TfToken());
+            foundPseudoRoot = true;
             continue;
         }
 
@@ -416,31 +431,67 @@ void UsdImagingStageSceneIndex::_PopulateSubtree(UsdPrim subtreeRoot)
             it.PruneChildren();
         }
 
-        // Enumerate the imaging sub-prims.
-        const SdfPath primPath = prim.GetPath();
-        const TfTokenVector subprims =
-            _GetImagingSubprims(prim, entry.allAdapters);
+        workItems.push_back({prim, &entry});
+    }
 
-        for (TfToken const& subprim : subprims) {
-            const SdfPath subpath =
-                subprim.IsEmpty() ? primPath : primPath.AppendProperty(subprim);
+    // Enumerate each prim's imaging sub-prims and their types, writing the
+    // results to per-prim slots so that the batched notice below preserves
+    // traversal order.
+    std::vector<HdSceneIndexObserver::AddedPrimEntries> perPrimEntries(
+        workItems.size());
+
+    const auto enumerateFn = [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            const UsdPrim &prim = workItems[i].prim;
+            const AdapterEntries &adapters = workItems[i].entry->allAdapters;
+            const SdfPath primPath = prim.GetPath();
+
+            for (TfToken const& subprim :
+                     _GetImagingSubprims(prim, adapters)) {
+                const SdfPath subpath =
+                    subprim.IsEmpty()
+                    ? primPath : primPath.AppendProperty(subprim);
 
-            addedPrims.emplace_back(subpath,
-                _GetImagingSubprimType(entry.allAdapters, prim, subprim));
+                perPrimEntries[i].emplace_back(subpath,
+                    _GetImagingSubprimType(adapters, prim, subprim));
+            }
         }
+    };
+
+    if (TfGetEnvSetting(USDIMAGING_PARALLEL_STAGE_POPULATION)) {
+        // Release the GIL to ensure that threaded work won't deadlock if
+        // they also need the GIL.
+        TF_PY_ALLOW_THREADS_IN_SCOPE();
+        WorkParallelForN(workItems.size(), enumerateFn,
+                         16 /* grainSize: adapter queries are cheap
+                               individually but vary per prim type */);
+    } else {
+        enumerateFn(0, workItems.size());
+    }
+
+    HdSceneIndexObserver::AddedPrimEntries addedPrims;
+    if (foundPseudoRoot) {
+        // XXX for now, we have to make sure the prim at the absolute root
+        // path is "added"
+        addedPrims.emplace_back(SdfPath::AbsoluteRootPath(), TfToken());
+    }
 
+    for (size_t i = 0; i < workItems.size(); ++i) {
         if (TfDebug::IsEnabled(USDIMAGING_POPULATION)) {
+            const UsdPrim &prim = workItems[i].prim;
             TF_DEBUG(USDIMAGING_POPULATION).Msg(
                 "[Population] Populating <%s> (type = %s) ->\n",
-                primPath.GetText(),
+                prim.GetPath().GetText(),
                 prim.GetPrimTypeInfo().GetSchemaTypeName().GetText());
-            for (size_t i = lastEnd; i < addedPrims.size(); ++i) {
+            for (const HdSceneIndexObserver::AddedPrimEntry &entry :
+                     perPrimEntries[i]) {
                 TF_DEBUG(USDIMAGING_POPULATION).Msg("\t<%s> (type = %s)\n",
-                    addedPrims[i].primPath.GetText(),
-                    addedPrims[i].primType.GetText());
+                    entry.primPath.GetText(),
+                    entry.primType.GetText());
             }
-            lastEnd = addedPrims.size();
         }
+        addedPrims.insert(addedPrims.end(),
+                          perPrimEntries[i].begin(), perPrimEntries[i].end());
     }
 
     _SendPrimsAdded(addedPrims);
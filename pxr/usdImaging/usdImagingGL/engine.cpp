@@ -190,7 +190,7 @@ UsdImagingGLEngine::UsdImagingGLEngine(
 }
 
 void
-UsdImagingGLEngine::_DestroyHydraObjects()
+UsdImagingGLEngine::_DestroyHydraObjects(bool retainUsdImagingSceneIndices)
 {
     // Destroy objects in opposite order of construction.
     _engine = nullptr;
@@ -198,11 +198,13 @@ UsdImagingGLEngine::_DestroyHydraObjects()
     if (_GetUseSceneIndices()) {
         if (_renderIndex && _sceneIndex) {
             _renderIndex->RemoveSceneIndex(_sceneIndex);
-            _stageSceneIndex = nullptr;
-            _rootOverridesSceneIndex = nullptr;
-            _selectionSceneIndex = nullptr;
-            _displayStyleSceneIndex = nullptr;
-            _sceneIndex = nullptr;
+            if (!retainUsdImagingSceneIndices) {
+                _stageSceneIndex = nullptr;
+                _rootOverridesSceneIndex = nullptr;
+                _selectionSceneIndex = nullptr;
+                _displayStyleSceneIndex = nullptr;
+                _sceneIndex = nullptr;
+            }
         }
     } else {
         _sceneDelegate = nullptr;
@@ -226,6 +228,8 @@ UsdImagingGLEngine::~UsdImagingGLEngine()
 {
     TF_PY_ALLOW_THREADS_IN_SCOPE();
 
+    _WaitForAsyncPrepareBatch();
+
     _DestroyHydraObjects();
 }
 
@@ -235,13 +239,57 @@ UsdImagingGLEngine::~UsdImagingGLEngine()
 
 void
 UsdImagingGLEngine::PrepareBatch(
-    const UsdPrim& root, 
+    const UsdPrim& root,
+    const UsdImagingGLRenderParams& params)
+{
+    if (ARCH_UNLIKELY(!_renderDelegate)) {
+        return;
+    }
+
+    // If an asynchronous prepare is in flight, let it finish; the impl
+    // below is cheap to re-run since SetTime and ApplyPendingUpdates only
+    // react to outstanding changes.
+    _WaitForAsyncPrepareBatch();
+
+    _PrepareBatchImpl(root, params);
+}
+
+void
+UsdImagingGLEngine::PrepareBatchAsync(
+    const UsdPrim& root,
     const UsdImagingGLRenderParams& params)
 {
     if (ARCH_UNLIKELY(!_renderDelegate)) {
         return;
     }
 
+    // Serialize with any prepare already in flight.
+    _WaitForAsyncPrepareBatch();
+
+    _asyncPrepareInFlight = true;
+    _prepareBatchDispatcher.Run(
+        [this, root, params]() {
+            _PrepareBatchImpl(root, params);
+        });
+}
+
+void
+UsdImagingGLEngine::_WaitForAsyncPrepareBatch()
+{
+    if (_asyncPrepareInFlight) {
+        // Release the GIL so worker code that needs it won't deadlock
+        // against us while we wait.
+        TF_PY_ALLOW_THREADS_IN_SCOPE();
+        _prepareBatchDispatcher.Wait();
+        _asyncPrepareInFlight = false;
+    }
+}
+
+void
+UsdImagingGLEngine::_PrepareBatchImpl(
+    const UsdPrim& root,
+    const UsdImagingGLRenderParams& params)
+{
     HD_TRACE_FUNCTION();
 
     if (_CanPrepare(root)) {
@@ -410,6 +458,9 @@ UsdImagingGLEngine::RenderBatch(
         return;
     }
 
+    // Ensure any asynchronous prepare has finished before syncing.
+    _WaitForAsyncPrepareBatch();
+
     _UpdateHydraCollection(&_renderCollection, paths, params);
     _taskController->SetCollection(_renderCollection);
 
@@ -1128,10 +1179,16 @@ UsdImagingGLEngine::_SetRenderDelegate(
 {
     // This relies on SetRendererPlugin to release the GIL...
 
-    // Destruction
-    _DestroyHydraObjects();
+    // Destruction.  When scene index emulation is active, retain the
+    // usdImaging scene index stack: stage population is independent of the
+    // render delegate, so the populated indices can be re-attached to the
+    // new render index rather than rebuilt.
+    const bool retainSceneIndices = _GetUseSceneIndices() && bool(_sceneIndex);
+    _DestroyHydraObjects(retainSceneIndices);
 
-    _isPopulated = false;
+    if (!retainSceneIndices) {
+        _isPopulated = false;
+    }
 
     // Use the render delegate ptr (rather than 'this' ptr) for generating
     // the unique id.
@@ -1167,22 +1224,25 @@ UsdImagingGLEngine::_SetRenderDelegate(
             _renderDelegate.Get(), {&_hgiDriver}, renderInstanceId));
 
     if (_GetUseSceneIndices()) {
-        UsdImagingCreateSceneIndicesInfo info;
-        info.displayUnloadedPrimsWithBounds = _displayUnloadedPrimsWithBounds;
-        info.overridesSceneIndexCallback =
-            std::bind(
-                &UsdImagingGLEngine::_AppendOverridesSceneIndices,
-                this, std::placeholders::_1);
-
-        const UsdImagingSceneIndices sceneIndices =
-            UsdImagingCreateSceneIndices(info);
-        
-        _stageSceneIndex = sceneIndices.stageSceneIndex;
-        _selectionSceneIndex = sceneIndices.selectionSceneIndex;
-        _sceneIndex = sceneIndices.finalSceneIndex;
-
-        _sceneIndex = _displayStyleSceneIndex =
-            HdsiLegacyDisplayStyleOverrideSceneIndex::New(_sceneIndex);
+        if (!_sceneIndex) {
+            UsdImagingCreateSceneIndicesInfo info;
+            info.displayUnloadedPrimsWithBounds =
+                _displayUnloadedPrimsWithBounds;
+            info.overridesSceneIndexCallback =
+                std::bind(
+                    &UsdImagingGLEngine::_AppendOverridesSceneIndices,
+                    this, std::placeholders::_1);
+
+            const UsdImagingSceneIndices sceneIndices =
+                UsdImagingCreateSceneIndices(info);
+
+            _stageSceneIndex = sceneIndices.stageSceneIndex;
+            _selectionSceneIndex = sceneIndices.selectionSceneIndex;
+            _sceneIndex = sceneIndices.finalSceneIndex;
+
+            _sceneIndex = _displayStyleSceneIndex =
+                HdsiLegacyDisplayStyleOverrideSceneIndex::New(_sceneIndex);
+        }
 
         _renderIndex->InsertSceneIndex(_sceneIndex, _sceneDelegateId);
     } else {
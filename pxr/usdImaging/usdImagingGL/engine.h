@@ -47,6 +47,7 @@
 #include "pxr/base/vt/dictionary.h"
 
 #include "pxr/base/tf/declarePtrs.h"
+#include "pxr/base/work/dispatcher.h"
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -154,10 +155,26 @@ public:
 
     /// Support for batched drawing
     USDIMAGINGGL_API
-    void PrepareBatch(const UsdPrim& root, 
+    void PrepareBatch(const UsdPrim& root,
                       const UsdImagingGLRenderParams& params);
+
+    /// Begin processing pending scene edits and the time change for an
+    /// upcoming call to Render or RenderBatch on a worker thread. This
+    /// overlaps the CPU-side scene update with other work on the calling
+    /// thread -- typically the previous frame's GPU execution or UI
+    /// processing.
+    ///
+    /// The stage must not be edited while the asynchronous prepare is in
+    /// flight; the prepared state reflects the stage as of this call.
+    /// Render, RenderBatch and PrepareBatch block until the worker has
+    /// finished, so using this trades a frame of update latency for
+    /// overlap, never consistency.
+    USDIMAGINGGL_API
+    void PrepareBatchAsync(const UsdPrim& root,
+                           const UsdImagingGLRenderParams& params);
+
     USDIMAGINGGL_API
-    void RenderBatch(const SdfPathVector& paths, 
+    void RenderBatch(const SdfPathVector& paths,
                      const UsdImagingGLRenderParams& params);
 
     /// Entry point for kicking off a render
@@ -365,6 +382,11 @@ public:
 
     /// Set the current render-graph delegate to \p id.
     /// the plugin will be loaded if it's not yet.
+    ///
+    /// When scene index emulation is in use, the usdImaging scene index
+    /// stack (stage population and overrides) is retained and re-attached
+    /// to the new render index, so switching delegates does not repopulate
+    /// the scene.
     USDIMAGINGGL_API
     bool SetRendererPlugin(TfToken const &id);
 
@@ -606,6 +628,11 @@ protected:
     USDIMAGINGGL_API
     bool _CanPrepare(const UsdPrim& root);
     USDIMAGINGGL_API
+    void _PrepareBatchImpl(const UsdPrim& root,
+                           const UsdImagingGLRenderParams& params);
+    USDIMAGINGGL_API
+    void _WaitForAsyncPrepareBatch();
+    USDIMAGINGGL_API
     void _PreSetTime(const UsdImagingGLRenderParams& params);
     USDIMAGINGGL_API
     void _PostSetTime(const UsdImagingGLRenderParams& params);
@@ -734,7 +761,11 @@ private:
     
     UsdImagingGLEngine_Impl::_AppSceneIndicesSharedPtr _appSceneIndices;
 
-    void _DestroyHydraObjects();
+    // Tears down the render index, render delegate, and task controller.
+    // When \p retainUsdImagingSceneIndices is true, the usdImaging scene
+    // index stack is detached from the render index but kept alive so it
+    // can be re-attached to a new render index without repopulating.
+    void _DestroyHydraObjects(bool retainUsdImagingSceneIndices = false);
 
     // Note that we'll only ever use one of _sceneIndex/_sceneDelegate
     // at a time.
@@ -750,6 +781,11 @@ private:
 
     std::unique_ptr<HdEngine> _engine;
 
+    // Used by PrepareBatchAsync to overlap scene processing with the
+    // caller's frame work.
+    WorkDispatcher _prepareBatchDispatcher;
+    bool _asyncPrepareInFlight = false;
+
     bool _allowAsynchronousSceneProcessing = false;
 };
 
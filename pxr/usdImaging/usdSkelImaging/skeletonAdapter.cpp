@@ -474,6 +474,11 @@ UsdSkelImagingSkeletonAdapter::MarkDirty(const UsdPrim& prim,
         if (dirty & HdChangeTracker::DirtyPrimvar) {
             index->RequestUpdateForTime(cachePath);
         }
+        // Animation changes arrive as dirtiness on the bone mesh; drop the
+        // shared anim caches so they're recomputed for the new state.
+        if (_SkelData* skelData = _GetSkelData(cachePath)) {
+            skelData->InvalidateAnimCache();
+        }
     } else if (_IsSkinnedPrimPath(cachePath)) {
 
         // Since The SkeletonAdapter hijacks skinned prims (see SkelRootAdapter),
@@ -520,7 +525,16 @@ UsdSkelImagingSkeletonAdapter::MarkDirty(const UsdPrim& prim,
                 cachePath.GetText(), prim.GetPath().GetText(), dirty);
 
         index->MarkSprimDirty(cachePath, dirty);
-    
+
+        // The computation's inputs may pull on the shared anim caches;
+        // drop them so they're recomputed for the new state.
+        if (const _SkinnedPrimData* skinnedPrimData =
+                _GetSkinnedPrimData(cachePath.GetParentPath())) {
+            if (_SkelData* skelData = _GetSkelData(skinnedPrimData->skelPath)) {
+                skelData->InvalidateAnimCache();
+            }
+        }
+
     } else {
         // We don't expect to get callbacks on behalf of any other prims on
         // the USD stage.
@@ -1412,75 +1426,6 @@ _GetInfluences(const UsdSkelSkinningQuery& skinningQuery,
 }
 
 
-bool
-_ComputeSkinningTransforms(const UsdSkelSkeletonQuery& skelQuery,
-                           const UsdSkelSkinningQuery& skinningQuery,
-                           UsdTimeCode time,
-                           VtMatrix4fArray* xforms)
-{
-    HD_TRACE_FUNCTION();
-    // PERFORMANCE:
-    // Would be better to query skinning transforms only once per
-    // skeleton, and share the results across each skinned prim.
-    VtMatrix4fArray xformsInSkelOrder;
-    if (skelQuery.ComputeSkinningTransforms(&xformsInSkelOrder, time)) {
-        
-        if (skinningQuery.GetJointMapper()) {
-            // Each skinned prim may specify its own ordering of joints.
-            // (eg., because only a subset set of joints may apply to the prim).
-            // Return the remapped results.
-            return skinningQuery.GetJointMapper()->RemapTransforms(
-                xformsInSkelOrder, xforms);
-        } else {
-            // Prim does not specify a joint order, so joints are returned
-            // in skel order.
-            *xforms = std::move(xformsInSkelOrder);
-            return true;
-        }
-    }
-    return false;
-}
-               
-
-bool
-_ComputeSubShapeWeights(const UsdSkelSkeletonQuery& skelQuery,
-                        const UsdSkelBlendShapeQuery& blendShapeQuery,
-                        const UsdSkelSkinningQuery& skinningQuery,
-                        UsdTimeCode time,
-                        VtFloatArray* subShapeWeights)
-{
-    HD_TRACE_FUNCTION();
-
-    // PERFORMANCE:
-    // It is better to compute the initial weight values from the skel query,
-    // and then share the results across each skinned prim!
-    VtFloatArray weights;
-    if (const UsdSkelAnimQuery& animQuery = skelQuery.GetAnimQuery()) {
-        if (animQuery.ComputeBlendShapeWeights(&weights, time)) {
-
-            // Each skinned prim may specify its own ordering of blend shapes   
-            // (eg., because only a subset of blend shapes may apply to
-            // the prim). Remap them.
-            VtFloatArray weightsInPrimOrder;
-            
-            if (skinningQuery.GetBlendShapeMapper()) {
-                const float defaultValue = 0.0f;
-                if (!skinningQuery.GetBlendShapeMapper()->Remap(
-                        weights, &weightsInPrimOrder,
-                        /*elementSize*/ 1, &defaultValue)) {
-                    return false;
-                }
-            } else {
-                weightsInPrimOrder = std::move(weights);
-            }
-
-            return blendShapeQuery.ComputeFlattenedSubShapeWeights(
-                weightsInPrimOrder, subShapeWeights);
-        }
-    }
-    return false;
-}
-
 // Extract the Scale & Shear parts of 4x4 matrices by removing the
 // translation & rotation. Return only the upper-left 3x3 matrices.
 bool
@@ -1636,9 +1581,9 @@ UsdSkelImagingSkeletonAdapter::_GetExtComputationInputForSkinningComputation(
             // Compute skinningXforms
             VtMatrix4fArray skinningXforms;
             if (!skinnedPrimData->hasJointInfluences ||
-                !_ComputeSkinningTransforms(skelData->skelQuery,
-                                            skinnedPrimData->skinningQuery,
-                                            time, &skinningXforms)) {
+                !skelData->ComputeSkinningTransforms(
+                    skinnedPrimData->skinningQuery,
+                    time, &skinningXforms)) {
                 skinningXforms.assign(
                     skinnedPrimData->skinningQuery.GetJointMapper() ?
                     skinnedPrimData->skinningQuery.GetJointMapper()->size():
@@ -1673,10 +1618,10 @@ UsdSkelImagingSkeletonAdapter::_GetExtComputationInputForSkinningComputation(
         if (name == _tokens->blendShapeWeights) {
             VtFloatArray weights;
             if (!skinnedPrimData->blendShapeQuery ||
-                !_ComputeSubShapeWeights(skelData->skelQuery,
-                                         *skinnedPrimData->blendShapeQuery,
-                                         skinnedPrimData->skinningQuery,
-                                         time, &weights)) {
+                !skelData->ComputeSubShapeWeights(
+                    *skinnedPrimData->blendShapeQuery,
+                    skinnedPrimData->skinningQuery,
+                    time, &weights)) {
                 if (skinnedPrimData->blendShapeQuery) {
                     weights.assign(
                         skinnedPrimData->blendShapeQuery->GetNumSubShapes(),
@@ -1953,8 +1898,8 @@ UsdSkelImagingSkeletonAdapter::_SampleExtComputationInputForSkinningComputation(
                     sampleTimes[i] = times[i] - time.GetValue();
 
                     VtMatrix4fArray skinningXforms;
-                    if (!_ComputeSkinningTransforms(
-                            skelData->skelQuery, skinnedPrimData->skinningQuery,
+                    if (!skelData->ComputeSkinningTransforms(
+                            skinnedPrimData->skinningQuery,
                             times[i], &skinningXforms)) {
                         _InitIdentityXforms(skelData->skelQuery,
                                             skinnedPrimData->skinningQuery,
@@ -2008,8 +1953,7 @@ UsdSkelImagingSkeletonAdapter::_SampleExtComputationInputForSkinningComputation(
                     sampleTimes[i] = times[i] - time.GetValue();
 
                     VtFloatArray weights;
-                    if (!_ComputeSubShapeWeights(
-                            skelData->skelQuery,
+                    if (!skelData->ComputeSubShapeWeights(
                             *skinnedPrimData->blendShapeQuery,
                             skinnedPrimData->skinningQuery, times[i],
                             &weights)) {
@@ -2598,6 +2542,109 @@ UsdSkelImagingSkeletonAdapter::_GetSkelData(const SdfPath& cachePath) const
 }
 
 
+bool
+UsdSkelImagingSkeletonAdapter::_SkelData::ComputeSkinningTransforms(
+    const UsdSkelSkinningQuery& skinningQuery,
+    const UsdTimeCode time,
+    VtMatrix4fArray* xforms) const
+{
+    HD_TRACE_FUNCTION();
+
+    // Compute (or fetch) the transforms in skel order; these are shared
+    // across all skinned prims bound to this skeleton, so they're only
+    // evaluated once per time sample.
+    bool valid = false;
+    VtMatrix4fArray xformsInSkelOrder;
+    {
+        std::lock_guard<std::mutex> lock(_animCacheMutex);
+        const auto iterAndInserted = _skinningXformCache.insert({time, {}});
+        _CachedXforms& entry = iterAndInserted.first->second;
+        if (iterAndInserted.second) {
+            entry.valid =
+                skelQuery.ComputeSkinningTransforms(&entry.xforms, time);
+        }
+        valid = entry.valid;
+        xformsInSkelOrder = entry.xforms;
+    }
+    if (!valid) {
+        return false;
+    }
+
+    if (skinningQuery.GetJointMapper()) {
+        // Each skinned prim may specify its own ordering of joints.
+        // (eg., because only a subset set of joints may apply to the prim).
+        // Return the remapped results.
+        return skinningQuery.GetJointMapper()->RemapTransforms(
+            xformsInSkelOrder, xforms);
+    } else {
+        // Prim does not specify a joint order, so joints are returned
+        // in skel order.
+        *xforms = std::move(xformsInSkelOrder);
+        return true;
+    }
+}
+
+
+bool
+UsdSkelImagingSkeletonAdapter::_SkelData::ComputeSubShapeWeights(
+    const UsdSkelBlendShapeQuery& blendShapeQuery,
+    const UsdSkelSkinningQuery& skinningQuery,
+    const UsdTimeCode time,
+    VtFloatArray* subShapeWeights) const
+{
+    HD_TRACE_FUNCTION();
+
+    // Compute (or fetch) the weights in anim order; as with the skinning
+    // transforms, these are shared across the skinned prims.
+    bool valid = false;
+    VtFloatArray weights;
+    {
+        std::lock_guard<std::mutex> lock(_animCacheMutex);
+        const auto iterAndInserted = _blendShapeWeightCache.insert({time, {}});
+        _CachedWeights& entry = iterAndInserted.first->second;
+        if (iterAndInserted.second) {
+            if (const UsdSkelAnimQuery& animQuery = skelQuery.GetAnimQuery()) {
+                entry.valid =
+                    animQuery.ComputeBlendShapeWeights(&entry.weights, time);
+            }
+        }
+        valid = entry.valid;
+        weights = entry.weights;
+    }
+    if (!valid) {
+        return false;
+    }
+
+    // Each skinned prim may specify its own ordering of blend shapes
+    // (eg., because only a subset of blend shapes may apply to
+    // the prim). Remap them.
+    VtFloatArray weightsInPrimOrder;
+
+    if (skinningQuery.GetBlendShapeMapper()) {
+        const float defaultValue = 0.0f;
+        if (!skinningQuery.GetBlendShapeMapper()->Remap(
+                weights, &weightsInPrimOrder,
+                /*elementSize*/ 1, &defaultValue)) {
+            return false;
+        }
+    } else {
+        weightsInPrimOrder = std::move(weights);
+    }
+
+    return blendShapeQuery.ComputeFlattenedSubShapeWeights(
+        weightsInPrimOrder, subShapeWeights);
+}
+
+
+void
+UsdSkelImagingSkeletonAdapter::_SkelData::InvalidateAnimCache()
+{
+    std::lock_guard<std::mutex> lock(_animCacheMutex);
+    _skinningXformCache.clear();
+    _blendShapeWeightCache.clear();
+}
+
+
 HdMeshTopology
 UsdSkelImagingSkeletonAdapter::_SkelData::ComputeTopologyAndRestState()
 {
@@ -19,6 +19,8 @@
 #include "pxr/usd/usdSkel/skeleton.h"
 #include "pxr/usd/usdSkel/skeletonQuery.h"
 
+#include <map>
+#include <mutex>
 #include <unordered_map>
 
 
@@ -405,12 +407,51 @@ private:
         /// ancestors. If none exists, returns an empty token.
         TfToken ComputePurpose() const;
 
+        /// Compute the skinning transforms for \p skinningQuery at \p time.
+        /// The skeleton-order transforms are computed once per time sample
+        /// and shared across all skinned prims bound to this skeleton; only
+        /// the optional per-prim joint reordering happens per call.
+        bool ComputeSkinningTransforms(
+            const UsdSkelSkinningQuery& skinningQuery,
+            UsdTimeCode time,
+            VtMatrix4fArray* xforms) const;
+
+        /// Compute the flattened sub-shape weights for \p blendShapeQuery.
+        /// As above, the underlying animation weights are computed once per
+        /// time sample and shared across the skinned prims.
+        bool ComputeSubShapeWeights(
+            const UsdSkelBlendShapeQuery& blendShapeQuery,
+            const UsdSkelSkinningQuery& skinningQuery,
+            UsdTimeCode time,
+            VtFloatArray* weights) const;
+
+        /// Drop any cached animation state. Called when the skinning
+        /// computations are invalidated.
+        void InvalidateAnimCache();
+
     private:
         // Cache of a mesh for a skeleton (at rest)
         // TODO: Dedupe this infromation across UsdSkelSkeleton instances.
         VtVec3fArray    _boneMeshPoints;
         VtIntArray      _boneMeshJointIndices;
         size_t          _numJoints;
+
+        // Caches of the skeleton-order skinning transforms and anim-order
+        // blend shape weights, keyed by time. Ext computation inputs are
+        // pulled from multiple threads during sync, so access is guarded by
+        // a mutex. Entries are dropped via InvalidateAnimCache when the
+        // skinning computations are dirtied.
+        struct _CachedXforms {
+            bool valid = false;
+            VtMatrix4fArray xforms;
+        };
+        struct _CachedWeights {
+            bool valid = false;
+            VtFloatArray weights;
+        };
+        mutable std::mutex _animCacheMutex;
+        mutable std::map<UsdTimeCode, _CachedXforms> _skinningXformCache;
+        mutable std::map<UsdTimeCode, _CachedWeights> _blendShapeWeightCache;
     };
 
     _SkelData*  _GetSkelData(const SdfPath& cachePath) const;